@@ -136,6 +136,14 @@ def pytest_addoption(parser):
         ),
     )
     parser.addoption("--rounds", type=int, default=1, help="Run each case N times (default: 1)")
+    parser.addoption("--warmup", type=int, default=0, help="Extra untimed rounds ahead of --rounds (default: 0)")
+    parser.addoption(
+        "--bench-json",
+        default=None,
+        metavar="PATH",
+        help="Merge per-case median/p90/p99 + CI of the measured rounds into PATH "
+        "(compare with python -m simpler_setup.tools.bench_stats compare)",
+    )
     parser.addoption(
         "--skip-golden", action="store_true", default=False, help="Skip golden comparison (benchmark mode)"
     )
@@ -149,6 +157,14 @@ def pytest_addoption(parser):
         help="Enable L2 swimlane. Bare flag=level 4 (full). "
         "1=AICore timing, 2=+dispatch/fanout, 3=+sched phases, 4=+orch phases",
     )
+    parser.addoption(
+        "--enable-l2-edges",
+        action="store_true",
+        default=False,
+        help="Also export every wired (producer, consumer) dependency into l2_swimlane_records.json "
+        "(task_edges), so the swimlane tools need no separate --enable-dep-gen run. "
+        "Implies --enable-l2-swimlane 1 when no level is given. tensormap_and_ringbuffer only.",
+    )
     parser.addoption(
         "--enable-device-log-timing",
         action="store_true",
@@ -221,6 +237,17 @@ def pytest_addoption(parser):
             "(e.g. LD_PRELOAD=$(g++ -print-file-name=libasan.so))."
         ),
     )
+    parser.addoption(
+        "--sim-profile",
+        action="store",
+        default="default",
+        choices=["default", "fast"],
+        help=(
+            "Sim kernel build profile. 'fast' compiles incore kernels with -O3 "
+            "-march=native (override via SIMPLER_SIM_MARCH) -funroll-loops; fp "
+            "results stay identical to 'default'."
+        ),
+    )
     parser.addoption(
         "--require-pto-isa",
         action="store_true",
@@ -424,6 +451,13 @@ def _configure_sanitizer(config):
         )
 
 
+def _configure_sim_profile(config):
+    """Wire the `--sim-profile` option into the sim incore kernel compile."""
+    from simpler_setup.kernel_compiler import KernelCompiler  # noqa: PLC0415
+
+    KernelCompiler._sim_profile = config.getoption("--sim-profile", default="default")
+
+
 def pytest_configure(config):
     """Register custom markers and apply global config."""
     config.addinivalue_line("markers", "platforms(list): supported platforms for standalone ST functions")
@@ -436,6 +470,7 @@ def pytest_configure(config):
     )
 
     _configure_sanitizer(config)
+    _configure_sim_profile(config)
 
     # Configure logging unconditionally (not only when --log-level is passed) so
     # simpler's own WARNINGs — e.g. the device-log-timing "no device log written"
@@ -31,6 +31,11 @@
 #define FUNC_SOFTMAX_PREPARE 1
 #define FUNC_PV_MATMUL 2
 #define FUNC_ONLINE_UPDATE 3
+
+// Smallest KV range worth its own split: below this the extra combine task
+// costs more than the shortened accumulation chain saves.
+constexpr uint32_t PA_MIN_BLOCKS_PER_SPLIT = 4;
+
 constexpr uint64_t PLATFORM_PROF_SYS_CNT_FREQ = 50000000;  // 50 MHz
 
 inline double cycles_to_us(uint64_t cycles) {
@@ -121,6 +126,9 @@ __attribute__((visibility("default"))) void build_paged_attention_graph(const L2
     Tensor value_cache = make_tensor_external(vc_ptr, value_cache_shapes, 2, data_type);
     Tensor out = make_tensor_external(out_ptr, out_shapes, 2, DataType::FLOAT32);
     CYCLE_COUNT_LAP(prof_ext_tensor);
+    // The per-row / per-block views only move their origin; replay them instead
+    // of rebuilding each descriptor.
+    PTO2ViewCache<> views;
 
     uint32_t bt_shapes[2] = {static_cast<uint32_t>(batch), static_cast<uint32_t>(block_num)};
     Tensor block_table =
@@ -143,19 +151,36 @@ __attribute__((visibility("default"))) void build_paged_attention_graph(const L2
 
     int total_tasks = 0;
 
+    // Split-KV sizing: spread the total KV walk (every row's blocks, once per
+    // q tile) over the AIC cores so short batches with long contexts still
+    // fill the machine. Large batches keep one accumulation chain per row.
+    int32_t aic_count = 0;
+    int32_t aiv_count = 0;
+    rt_get_core_counts(&aic_count, &aiv_count);
+    uint64_t total_work = 0;
+    for (uint64_t b_idx = 0; b_idx < batch; b_idx++) {
+        uint32_t cl_idx[1] = {static_cast<uint32_t>(b_idx)};
+        total_work += pto2_split_kv_row_blocks(get_tensor_data<int32_t>(context_lens, 1, cl_idx), block_size) * q_loop;
+    }
+    uint32_t blocks_per_split = pto2_split_kv_blocks_per_split(
+        total_work, static_cast<uint32_t>(aic_count > 0 ? aic_count : 0), PA_MIN_BLOCKS_PER_SPLIT
+    );
+    CYCLE_COUNT_LAP(prof_param_extract);
+
     for (uint64_t b_idx = 0; b_idx < batch; b_idx++) {
         uint32_t cl_idx[1] = {static_cast<uint32_t>(b_idx)};
         uint64_t cur_seq = static_cast<uint64_t>(get_tensor_data<int32_t>(context_lens, 1, cl_idx));
-        uint64_t bn_this_batch = (cur_seq + block_size - 1) / block_size;
+        uint32_t bn_this_batch = pto2_split_kv_row_blocks(static_cast<int64_t>(cur_seq), block_size);
+        uint32_t num_splits = pto2_split_kv_num_splits(bn_this_batch, blocks_per_split);
         for (uint64_t q_idx = 0; q_idx < q_loop; q_idx++) {
             PTO2_SCOPE() {
                 CYCLE_COUNT_LAP(prof_scope);
                 uint64_t cur_offset = b_idx * q_head_num + q_idx * q_tile;
 
                 uint32_t qi_offsets[2] = {static_cast<uint32_t>(cur_offset), 0};
-                Tensor qi = query.view(tile2d_shapes, qi_offsets);
+                const Tensor &qi = views.view(query, tile2d_shapes, qi_offsets);
                 uint32_t out_view_offsets[2] = {static_cast<uint32_t>(cur_offset), 0};
-                Tensor out_view = out.view(tile2d_shapes, out_view_offsets);
+                const Tensor &out_view = views.view(out, tile2d_shapes, out_view_offsets);
                 prof_view_count += 2;
                 CYCLE_COUNT_LAP(prof_tensor_view);
 
@@ -167,79 +192,127 @@ __attribute__((visibility("default"))) void build_paged_attention_graph(const L2
                 prof_submit_count++;
                 CYCLE_COUNT_LAP(prof_submit_task);
 
-                for (uint64_t bn = 0; bn < bn_this_batch; bn++) {
-                    PTO2_SCOPE_GUARD();
-
-                    uint32_t bt_idx[2] = {static_cast<uint32_t>(b_idx), static_cast<uint32_t>(bn)};
-                    uint64_t cur_block_idx = static_cast<uint64_t>(get_tensor_data<int32_t>(block_table, 2, bt_idx));
-                    uint64_t valid_len = std::min(block_size, cur_seq - bn * block_size);
-                    CYCLE_COUNT_LAP(prof_param_extract);
-
-                    uint32_t kv_shapes[2] = {static_cast<uint32_t>(block_size), static_cast<uint32_t>(head_dim)};
-                    uint32_t kv_offsets[2] = {static_cast<uint32_t>(cur_block_idx * block_size), 0};
-                    Tensor kj = key_cache.view(kv_shapes, kv_offsets);
-                    Tensor vj = value_cache.view(kv_shapes, kv_offsets);
-                    prof_view_count += 2;
-                    CYCLE_COUNT_LAP(prof_tensor_view);
-
-                    L0TaskArgs params_qk;
-                    params_qk.add_input(qi);
-                    params_qk.add_input(kj);
-                    params_qk.add_output(sij_ci);
-                    CYCLE_COUNT_LAP(prof_param_setup);
-                    TaskOutputTensors qk_outs = rt_submit_aic_task(FUNC_QK_MATMUL, params_qk);
-                    const Tensor &sij = qk_outs.get_ref(0);
-                    prof_submit_count++;
-                    CYCLE_COUNT_LAP(prof_submit_task);
-
-                    uint32_t sij_valid_shapes[2] = {static_cast<uint32_t>(q_tile), static_cast<uint32_t>(valid_len)};
-                    uint32_t sij_valid_offsets[2] = {0, 0};
-                    Tensor sij_valid = sij.view(sij_valid_shapes, sij_valid_offsets);
-                    prof_view_count += 1;
-                    CYCLE_COUNT_LAP(prof_tensor_view);
-
-                    L0TaskArgs params_sf;
-                    params_sf.add_input(sij_valid);
-                    params_sf.add_output(pij_f16_ci);
-                    params_sf.add_output(scalar_ci);
-                    params_sf.add_output(scalar_ci);
-                    params_sf.add_scalar(scale_value);
-                    CYCLE_COUNT_LAP(prof_param_setup);
-                    TaskOutputTensors sf_outs = rt_submit_aiv_task(FUNC_SOFTMAX_PREPARE, params_sf);
-                    const Tensor &pij_f16 = sf_outs.get_ref(0);
-                    const Tensor &mi = sf_outs.get_ref(1);
-                    const Tensor &li = sf_outs.get_ref(2);
-                    prof_submit_count++;
-                    CYCLE_COUNT_LAP(prof_submit_task);
-
-                    L0TaskArgs params_pv;
-                    params_pv.add_input(pij_f16);
-                    params_pv.add_input(vj);
-                    params_pv.add_output(tile2d_ci);
-                    CYCLE_COUNT_LAP(prof_param_setup);
-                    TaskOutputTensors pv_outs = rt_submit_aic_task(FUNC_PV_MATMUL, params_pv);
-                    const Tensor &oi_tmp = pv_outs.get_ref(0);
-                    prof_submit_count++;
-                    CYCLE_COUNT_LAP(prof_submit_task);
-
-                    uint64_t is_first = (bn == 0) ? 1 : 0;
-                    uint64_t is_last = (bn == bn_this_batch - 1) ? 1 : 0;
-                    CYCLE_COUNT_LAP(prof_param_extract);
-
-                    L0TaskArgs params_up;
-                    params_up.add_input(mi);
-                    params_up.add_input(li);
-                    params_up.add_input(oi_tmp);
-                    params_up.add_inout(mi_update);
-                    params_up.add_inout(li_update);
-                    params_up.add_inout(oi);
-                    params_up.add_inout(out_view);
-                    params_up.add_scalar(is_first);
-                    params_up.add_scalar(is_last);
-                    CYCLE_COUNT_LAP(prof_param_setup);
-                    rt_submit_aiv_task(FUNC_ONLINE_UPDATE, params_up);
-                    prof_submit_count++;
-                    CYCLE_COUNT_LAP(prof_submit_task);
+                // One split: accumulate straight into (mi_update, li_update, oi)
+                // and normalize into out_view on the last block. Several splits:
+                // each accumulates an unnormalized partial, then the partials are
+                // merged into the row accumulators with the same online update.
+                for (uint32_t split = 0; split < num_splits; split++) {
+                    PTO2SplitKvRange range = pto2_split_kv_range(bn_this_batch, num_splits, split);
+                    bool single = (num_splits == 1);
+
+                    TaskOutputTensors part_outs;
+                    if (!single) {
+                        part_outs = alloc_tensors(tile2d_ci, scalar_ci, scalar_ci);
+                        prof_submit_count++;
+                    }
+                    const Tensor &acc_oi = single ? oi : part_outs.get_ref(0);
+                    const Tensor &acc_li = single ? li_update : part_outs.get_ref(1);
+                    const Tensor &acc_mi = single ? mi_update : part_outs.get_ref(2);
+
+                    for (uint32_t bn = range.block_begin; bn < range.block_end; bn++) {
+                        PTO2_SCOPE_GUARD();
+
+                        uint32_t bt_idx[2] = {static_cast<uint32_t>(b_idx), bn};
+                        uint64_t cur_block_idx =
+                            static_cast<uint64_t>(get_tensor_data<int32_t>(block_table, 2, bt_idx));
+                        uint64_t valid_len = std::min(block_size, cur_seq - bn * block_size);
+                        CYCLE_COUNT_LAP(prof_param_extract);
+
+                        uint32_t kv_shapes[2] = {static_cast<uint32_t>(block_size), static_cast<uint32_t>(head_dim)};
+                        uint32_t kv_offsets[2] = {static_cast<uint32_t>(cur_block_idx * block_size), 0};
+                        const Tensor &kj = views.view(key_cache, kv_shapes, kv_offsets);
+                        const Tensor &vj = views.view(value_cache, kv_shapes, kv_offsets);
+                        prof_view_count += 2;
+                        CYCLE_COUNT_LAP(prof_tensor_view);
+
+                        L0TaskArgs params_qk;
+                        params_qk.add_input(qi);
+                        params_qk.add_input(kj);
+                        params_qk.add_output(sij_ci);
+                        CYCLE_COUNT_LAP(prof_param_setup);
+                        TaskOutputTensors qk_outs = rt_submit_aic_task(FUNC_QK_MATMUL, params_qk);
+                        const Tensor &sij = qk_outs.get_ref(0);
+                        prof_submit_count++;
+                        CYCLE_COUNT_LAP(prof_submit_task);
+
+                        uint32_t sij_valid_shapes[2] = {
+                            static_cast<uint32_t>(q_tile), static_cast<uint32_t>(valid_len)
+                        };
+                        uint32_t sij_valid_offsets[2] = {0, 0};
+                        Tensor sij_valid = sij.view(sij_valid_shapes, sij_valid_offsets);
+                        prof_view_count++;
+                        CYCLE_COUNT_LAP(prof_tensor_view);
+
+                        L0TaskArgs params_sf;
+                        params_sf.add_input(sij_valid);
+                        params_sf.add_output(pij_f16_ci);
+                        params_sf.add_output(scalar_ci);
+                        params_sf.add_output(scalar_ci);
+                        params_sf.add_scalar(scale_value);
+                        CYCLE_COUNT_LAP(prof_param_setup);
+                        TaskOutputTensors sf_outs = rt_submit_aiv_task(FUNC_SOFTMAX_PREPARE, params_sf);
+                        const Tensor &pij_f16 = sf_outs.get_ref(0);
+                        const Tensor &mi = sf_outs.get_ref(1);
+                        const Tensor &li = sf_outs.get_ref(2);
+                        prof_submit_count++;
+                        CYCLE_COUNT_LAP(prof_submit_task);
+
+                        L0TaskArgs params_pv;
+                        params_pv.add_input(pij_f16);
+                        params_pv.add_input(vj);
+                        params_pv.add_output(tile2d_ci);
+                        CYCLE_COUNT_LAP(prof_param_setup);
+                        TaskOutputTensors pv_outs = rt_submit_aic_task(FUNC_PV_MATMUL, params_pv);
+                        const Tensor &oi_tmp = pv_outs.get_ref(0);
+                        prof_submit_count++;
+                        CYCLE_COUNT_LAP(prof_submit_task);
+
+                        uint64_t is_first = (bn == range.block_begin) ? 1 : 0;
+                        uint64_t is_last = (single && bn == range.block_end - 1) ? 1 : 0;
+                        CYCLE_COUNT_LAP(prof_param_extract);
+
+                        L0TaskArgs params_up;
+                        params_up.add_input(mi);
+                        params_up.add_input(li);
+                        params_up.add_input(oi_tmp);
+                        params_up.add_inout(acc_mi);
+                        params_up.add_inout(acc_li);
+                        params_up.add_inout(acc_oi);
+                        if (single) {
+                            params_up.add_inout(out_view);
+                        } else {
+                            // dst is only written when is_last; a split never
+                            // normalizes, so pass a read-only placeholder instead
+                            // of serializing every split on out_view.
+                            params_up.add_input(oi_tmp);
+                        }
+                        params_up.add_scalar(is_first);
+                        params_up.add_scalar(is_last);
+                        CYCLE_COUNT_LAP(prof_param_setup);
+                        rt_submit_aiv_task(FUNC_ONLINE_UPDATE, params_up);
+                        prof_submit_count++;
+                        CYCLE_COUNT_LAP(prof_submit_task);
+                    }
+
+                    if (!single) {
+                        uint64_t is_first = (split == 0) ? 1 : 0;
+                        uint64_t is_last = (split == num_splits - 1) ? 1 : 0;
+
+                        L0TaskArgs params_combine;
+                        params_combine.add_input(acc_mi);
+                        params_combine.add_input(acc_li);
+                        params_combine.add_input(acc_oi);
+                        params_combine.add_inout(mi_update);
+                        params_combine.add_inout(li_update);
+                        params_combine.add_inout(oi);
+                        params_combine.add_inout(out_view);
+                        params_combine.add_scalar(is_first);
+                        params_combine.add_scalar(is_last);
+                        CYCLE_COUNT_LAP(prof_param_setup);
+                        rt_submit_aiv_task(FUNC_ONLINE_UPDATE, params_combine);
+                        prof_submit_count++;
+                        CYCLE_COUNT_LAP(prof_submit_task);
+                    }
                 }
             }
             CYCLE_COUNT_LAP(prof_scope);
@@ -270,6 +343,9 @@ __attribute__((visibility("default"))) void build_paged_attention_graph(const L2
             prof_tensor_view * 100.0 / total,
             prof_view_count > 0 ? cycles_to_us(prof_tensor_view) / prof_view_count : 0.0
         );
+        LOG_INFO_V9(
+            "  view_cache       : %" PRIu64 " hits / %" PRIu64 " misses", views.hits(), views.misses()
+        );
         LOG_INFO_V9(
             "  param_setup      : %7.3fus (%5.1f%%)", cycles_to_us(prof_param_setup), prof_param_setup * 100.0 / total
         );
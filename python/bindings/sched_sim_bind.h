@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Nanobind bindings for the scheduler what-if simulator (src/common/sched_sim).
+ *
+ * Compiled into the same _task_interface extension module as task_interface.cpp.
+ * Call bind_sched_sim(m) from the NB_MODULE definition in task_interface.cpp.
+ * The Python driver is simpler_setup/tools/sched_whatif.py.
+ */
+
+#pragma once
+
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/vector.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "sched_sim.h"
+
+namespace nb = nanobind;
+
+inline void bind_sched_sim(nb::module_ &m) {
+    using namespace simpler::sched_sim;
+
+    nb::enum_<ReadyPolicy>(m, "SchedSimPolicy")
+        .value("FIFO", ReadyPolicy::FIFO)
+        .value("PRIORITY", ReadyPolicy::PRIORITY)
+        .value("SUBMIT_ORDER", ReadyPolicy::SUBMIT_ORDER);
+
+    nb::enum_<CoreAssignment>(m, "SchedSimCoreAssignment")
+        .value("PARTITIONED", CoreAssignment::PARTITIONED)
+        .value("SHARED", CoreAssignment::SHARED);
+
+    nb::class_<SchedSimConfig>(m, "SchedSimConfig")
+        .def(nb::init<>())
+        .def_rw("num_threads", &SchedSimConfig::num_threads)
+        .def_rw("num_aic", &SchedSimConfig::num_aic)
+        .def_rw("num_aiv", &SchedSimConfig::num_aiv)
+        .def_rw("policy", &SchedSimConfig::policy)
+        .def_rw("core_assignment", &SchedSimConfig::core_assignment)
+        .def_rw("early_dispatch", &SchedSimConfig::early_dispatch)
+        .def_rw("ring_size", &SchedSimConfig::ring_size)
+        .def_rw("orch_submit_ns", &SchedSimConfig::orch_submit_ns)
+        .def_rw("dispatch_ns", &SchedSimConfig::dispatch_ns)
+        .def_rw("complete_ns", &SchedSimConfig::complete_ns)
+        .def_rw("fanout_edge_ns", &SchedSimConfig::fanout_edge_ns)
+        .def_rw("launch_ns", &SchedSimConfig::launch_ns)
+        .def_rw("spec_release_ns", &SchedSimConfig::spec_release_ns);
+
+    nb::class_<SchedSimResult>(m, "SchedSimResult")
+        .def_ro("makespan_ns", &SchedSimResult::makespan_ns)
+        .def_ro("critical_path_ns", &SchedSimResult::critical_path_ns)
+        .def_ro("aic_utilization", &SchedSimResult::aic_utilization)
+        .def_ro("aiv_utilization", &SchedSimResult::aiv_utilization)
+        .def_ro("thread_utilization", &SchedSimResult::thread_utilization)
+        .def_ro("orch_ring_stall_ns", &SchedSimResult::orch_ring_stall_ns)
+        .def_ro("mean_ready_wait_ns", &SchedSimResult::mean_ready_wait_ns)
+        .def_ro("tasks", &SchedSimResult::tasks)
+        .def_ro("subtasks", &SchedSimResult::subtasks)
+        .def_ro("spec_staged", &SchedSimResult::spec_staged);
+
+    nb::class_<SchedSimGraph>(m, "SchedSimGraph")
+        .def(
+            nb::init<
+                uint32_t, const std::vector<uint32_t> &, const std::vector<uint32_t> &, const std::vector<uint32_t> &,
+                const std::vector<uint8_t> &, const std::vector<uint64_t> &>(),
+            nb::arg("num_tasks"), nb::arg("edge_src"), nb::arg("edge_dst"), nb::arg("sub_task"),
+            nb::arg("sub_core_type"), nb::arg("sub_duration_ns"),
+            "Build the CSR task graph once. Task indices are submission order; "
+            "sub_core_type is 0 (AIC) or 1 (AIV). Raises ValueError on bad indices or cycles."
+        )
+        .def_prop_ro("num_tasks", &SchedSimGraph::num_tasks)
+        .def_prop_ro("num_edges", &SchedSimGraph::num_edges)
+        .def_prop_ro("num_subtasks", &SchedSimGraph::num_subtasks)
+        .def(
+            "simulate",
+            [](const SchedSimGraph &self, const SchedSimConfig &config) {
+                nb::gil_scoped_release release;
+                return simulate(self, config);
+            },
+            nb::arg("config"), "Replay the graph under `config` and return a SchedSimResult."
+        );
+}
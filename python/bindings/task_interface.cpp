@@ -18,11 +18,13 @@
  */
 
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/pair.h>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
 
 #include <cstring>
+#include <functional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -32,8 +34,12 @@
 #include "arg_direction.h"
 #include "callable.h"
 #include "callable_protocol.h"
+#include "chip_child_loop.h"
 #include "chip_worker.h"
 #include "data_type.h"
+#include "native_sub.h"
+#include "remote_session_server.h"
+#include "sched_sim_bind.h"
 #include "worker_bind.h"
 #include "task_args.h"
 #include "tensor.h"
@@ -470,7 +476,9 @@ NB_MODULE(_task_interface, m) {
         const ChipCallable &get() const { return *reinterpret_cast<const ChipCallable *>(buffer_.data()); }
     };
 
-    nb::class_<PyChipCallable>(m, "ChipCallable")
+    // Weak-referenceable so callable_identity can memoize the blob digest
+    // per object; the bytes never change after build / from_bytes.
+    nb::class_<PyChipCallable>(m, "ChipCallable", nb::is_weak_referenceable())
         .def_static(
             "build",
             [](std::vector<ArgDirection> signature, std::string func_name, nb::bytes binary,
@@ -750,16 +758,34 @@ NB_MODULE(_task_interface, m) {
             },
             // Accept either an int perf_level (0-4) or a Python bool. `True` maps to
             // level 4 (full collection) to preserve the pre-perf_level semantics for
-            // callers that still pass a boolean; `False` maps to 0.
+            // callers that still pass a boolean; `False` maps to 0. The edge-export
+            // bit (0x100, see enable_l2_edges) is kept across level changes and may
+            // also arrive inside the int, e.g. from a serialized CallConfig.
             [](CallConfig &c, nb::object v) {
+                constexpr int32_t kEdgesFlag = 0x100;
+                int32_t edges = c.enable_l2_swimlane & kEdgesFlag;
                 if (PyBool_Check(v.ptr())) {
-                    c.enable_l2_swimlane = nb::cast<bool>(v) ? 4 : 0;
+                    c.enable_l2_swimlane = edges | (nb::cast<bool>(v) ? 4 : 0);
                 } else {
-                    int level = nb::cast<int>(v);
-                    c.enable_l2_swimlane = (level < 0) ? 0 : (level > 4) ? 4 : level;
+                    int raw = nb::cast<int>(v);
+                    int level = (raw < 0) ? 0 : (raw & 0xff);
+                    if (raw > 0) edges |= raw & kEdgesFlag;
+                    c.enable_l2_swimlane = edges | ((level > 4) ? 4 : level);
                 }
             }
         )
+        .def_prop_rw(
+            "enable_l2_edges",
+            [](const CallConfig &c) {
+                return (c.enable_l2_swimlane & 0x100) != 0;
+            },
+            // Export every wired (producer, consumer) pair into l2_swimlane_records.json
+            // ("task_edges"). Rides on enable_l2_swimlane as bit 0x100; with level 0 the
+            // runtime collects at level 1 so the edges have somewhere to go.
+            [](CallConfig &c, bool v) {
+                c.enable_l2_swimlane = v ? (c.enable_l2_swimlane | 0x100) : (c.enable_l2_swimlane & ~0x100);
+            }
+        )
         .def_prop_rw(
             "enable_dump_tensor",
             [](const CallConfig &c) {
@@ -927,14 +953,16 @@ NB_MODULE(_task_interface, m) {
             [](ChipWorker &self, int32_t callable_id, ChipStorageTaskArgs &args, const CallConfig &config) {
                 return self.run(callable_id, &args, config);
             },
-            nb::arg("callable_id"), nb::arg("args"), nb::arg("config"),
+            nb::arg("callable_id"), nb::arg("args"), nb::arg("config"), nb::call_guard<nb::gil_scoped_release>(),
             "Launch a callable_id previously staged via prepare_callable. "
-            "Returns RunTiming with host/device wall."
+            "Returns RunTiming with host/device wall. Releases the GIL so runs on "
+            "different run lanes can overlap."
         )
         .def(
             "run",
             [](ChipWorker &self, int32_t callable_id, TaskArgs &args, const CallConfig &config) {
                 TaskArgsView view = make_view(args);
+                nb::gil_scoped_release release;
                 return self.run(callable_id, view, config);
             },
             nb::arg("callable_id"), nb::arg("args"), nb::arg("config"),
@@ -952,6 +980,7 @@ NB_MODULE(_task_interface, m) {
                 // loops never re-implement the tensor/scalar layout in Python
                 // (where it has historically dropped fields like child_memory).
                 TaskArgsView view = read_blob(reinterpret_cast<const uint8_t *>(args_blob_ptr), blob_capacity);
+                nb::gil_scoped_release release;
                 return self.run(callable_id, view, config);
             },
             nb::arg("callable_id"), nb::arg("args_blob_ptr"), nb::arg("blob_capacity"), nb::arg("config"),
@@ -970,6 +999,14 @@ NB_MODULE(_task_interface, m) {
             "of the device orch SO buffer (kernel binaries stay resident until "
             "finalize)."
         )
+        .def(
+            "configure_run_lanes", &ChipWorker::configure_run_lanes, nb::arg("block_dims"),
+            nb::arg("aicpu_thread_nums"),
+            "Split the device into run lanes (one device context each, capped at block_dims[i] AICore "
+            "blocks and aicpu_thread_nums[i] AICPU threads) so run can be called concurrently. "
+            "Call after init and before any prepare_callable."
+        )
+        .def_prop_ro("run_lane_count", &ChipWorker::run_lane_count)
         .def_prop_ro("device_id", &ChipWorker::device_id)
         .def_prop_ro("initialized", &ChipWorker::initialized)
         .def_prop_ro(
@@ -985,10 +1022,27 @@ NB_MODULE(_task_interface, m) {
             "host_build_graph variants. Mirrors aicpu_dlopen_count for the "
             "host-orchestration path; 0 on device-orch variants."
         )
+        .def(
+            "configure_flight_recorder", &ChipWorker::configure_flight_recorder, nb::arg("enable"),
+            nb::arg("slow_step_ns") = 0, nb::arg("dump_dir") = "",
+            "Set the flight-recorder auto-dump policy: with a dump_dir, failed runs and runs whose device "
+            "wall exceeds slow_step_ns (0 = off) are snapshotted there."
+        )
+        .def(
+            "dump_flight_recorder", &ChipWorker::dump_flight_recorder, nb::arg("path"),
+            "Write the current flight-recorder rings to path as JSON."
+        )
         .def("malloc", &ChipWorker::malloc, nb::arg("size"))
         .def("free", &ChipWorker::free, nb::arg("ptr"))
         .def("copy_to", &ChipWorker::copy_to, nb::arg("dst"), nb::arg("src"), nb::arg("size"))
         .def("copy_from", &ChipWorker::copy_from, nb::arg("dst"), nb::arg("src"), nb::arg("size"))
+        .def("copy_to_async", &ChipWorker::copy_to_async, nb::arg("dst"), nb::arg("src"), nb::arg("size"))
+        .def("copy_from_async", &ChipWorker::copy_from_async, nb::arg("dst"), nb::arg("src"), nb::arg("size"))
+        .def(
+            "wait_copy", &ChipWorker::wait_copy, nb::arg("token"), nb::call_guard<nb::gil_scoped_release>(),
+            "Block (GIL released) until the async copy behind token completes; raises if it failed."
+        )
+        .def("copy_done", &ChipWorker::copy_done, nb::arg("token"))
         .def(
             "comm_init", &ChipWorker::comm_init, nb::arg("rank"), nb::arg("nranks"), nb::arg("rootinfo_path"),
             "Initialize a communicator for this rank.  ChipWorker owns ACL + stream "
@@ -1037,6 +1091,180 @@ NB_MODULE(_task_interface, m) {
         )
         .def("comm_destroy_all", &ChipWorker::comm_destroy_all, "Destroy all owned communicators in LIFO order.");
 
+    // --- ChipChildLoop (native chip-child mailbox loop) ---
+    nb::class_<ChipChildLoop>(m, "_ChipChildLoop")
+        .def(
+            "__init__",
+            [](ChipChildLoop *self, ChipWorker &worker, uint64_t mailbox_addr, int32_t device_id, uint32_t spin_iters,
+               uint32_t yield_iters, uint32_t max_park_us) {
+                ChipChildLoopOptions options;
+                options.spin_iters = spin_iters;
+                options.yield_iters = yield_iters;
+                options.max_park_us = max_park_us;
+                new (self) ChipChildLoop(worker, reinterpret_cast<void *>(mailbox_addr), device_id, options);
+            },
+            nb::arg("worker"), nb::arg("mailbox_addr"), nb::arg("device_id"), nb::arg("spin_iters") = 4096,
+            nb::arg("yield_iters") = 64, nb::arg("max_park_us") = 100, nb::keep_alive<1, 2>()
+        )
+        .def(
+            "bind",
+            [](ChipChildLoop &self, nb::bytes digest, int32_t cid, bool prepared) {
+                ChipChildLoop::Digest d;
+                if (digest.size() != d.size()) throw std::invalid_argument("callable digest must be 32 bytes");
+                std::memcpy(d.data(), digest.c_str(), d.size());
+                self.bind(d, cid, prepared);
+            },
+            nb::arg("digest"), nb::arg("cid"), nb::arg("prepared"),
+            "Map a callable digest to its child-local cid; `prepared` skips the lazy-prepare hook."
+        )
+        .def("clear", &ChipChildLoop::clear, "Drop every digest binding.")
+        .def("__len__", &ChipChildLoop::size)
+        .def(
+            "run",
+            [](ChipChildLoop &self, nb::object on_control, nb::object on_prepare, nb::object on_task_done) {
+                // Hooks run on the loop thread with the GIL re-acquired. A
+                // Python exception becomes "<ExcType>: <msg>" so mailbox
+                // errors read the same as the Python loop's _format_exc.
+                auto rethrow = [](nb::python_error &e) -> std::runtime_error {
+                    std::string type = nb::cast<std::string>(e.type().attr("__name__"));
+                    std::string value = nb::cast<std::string>(nb::str(e.value()));
+                    return std::runtime_error(type + ": " + value);
+                };
+                if (!on_control.is_none()) {
+                    self.set_control_hook([&on_control, rethrow](uint64_t sub_cmd) {
+                        nb::gil_scoped_acquire gil;
+                        try {
+                            return nb::cast<ChipChildLoop::Outcome>(on_control(sub_cmd));
+                        } catch (nb::python_error &e) {
+                            throw rethrow(e);
+                        }
+                    });
+                }
+                if (!on_prepare.is_none()) {
+                    self.set_prepare_hook([&on_prepare, rethrow](int32_t cid) {
+                        nb::gil_scoped_acquire gil;
+                        try {
+                            on_prepare(cid);
+                        } catch (nb::python_error &e) {
+                            throw rethrow(e);
+                        }
+                    });
+                }
+                if (!on_task_done.is_none()) {
+                    self.set_task_done_hook([&on_task_done, rethrow]() {
+                        nb::gil_scoped_acquire gil;
+                        try {
+                            return nb::cast<ChipChildLoop::Outcome>(on_task_done());
+                        } catch (nb::python_error &e) {
+                            throw rethrow(e);
+                        }
+                    });
+                }
+                // The hooks borrow the nb::objects above, so they must be
+                // dropped before this frame returns, even on error.
+                struct ClearHooks {
+                    ChipChildLoop &loop;
+                    ~ClearHooks() {
+                        loop.set_control_hook(nullptr);
+                        loop.set_prepare_hook(nullptr);
+                        loop.set_task_done_hook(nullptr);
+                    }
+                } clear_hooks{self};
+                nb::gil_scoped_release release;
+                self.run();
+            },
+            nb::arg("on_control").none() = nb::none(), nb::arg("on_prepare").none() = nb::none(),
+            nb::arg("on_task_done").none() = nb::none(),
+            "Serve the mailbox until SHUTDOWN with the GIL released. TASK_READY and CTRL_MALLOC / FREE / "
+            "COPY_TO / COPY_FROM never enter Python; other control sub-commands call on_control(sub_cmd) -> "
+            "(code, msg), a bound-but-unprepared cid calls on_prepare(cid), and a successful run calls "
+            "on_task_done() -> (code, msg)."
+        )
+        .def_prop_ro("stats", [](const ChipChildLoop &self) {
+            const ChipChildLoopStats &s = self.stats();
+            nb::dict d;
+            d["tasks"] = s.tasks;
+            d["controls"] = s.controls;
+            d["python_controls"] = s.python_controls;
+            d["parks"] = s.parks;
+            return d;
+        });
+
+    // --- RemoteL3SessionServer (native remote L3 command lane) ---
+    nb::class_<RemoteL3SessionServer>(m, "_RemoteL3SessionServer")
+        .def(
+            "__init__",
+            [](RemoteL3SessionServer *self, ChipWorker *worker, uint64_t session_id, int32_t worker_id,
+               const std::string &comm_profile, const std::string &listen_host, double accept_timeout_s) {
+                RemoteL3SessionOptions options;
+                options.session_id = session_id;
+                options.worker_id = worker_id;
+                options.comm_profile = comm_profile;
+                options.listen_host = listen_host;
+                options.accept_timeout_s = accept_timeout_s;
+                new (self) RemoteL3SessionServer(worker, options);
+            },
+            nb::arg("worker").none(), nb::arg("session_id"), nb::arg("worker_id"), nb::arg("comm_profile") = "sim",
+            nb::arg("listen_host") = "127.0.0.1", nb::arg("accept_timeout_s") = 30.0, nb::keep_alive<1, 2>()
+        )
+        .def("listen", &RemoteL3SessionServer::listen, "Bind the command and health listeners on ephemeral ports.")
+        .def_prop_ro("command_port", &RemoteL3SessionServer::command_port)
+        .def_prop_ro("health_port", &RemoteL3SessionServer::health_port)
+        .def(
+            "bind",
+            [](RemoteL3SessionServer &self, nb::bytes digest, int32_t cid) {
+                RemoteL3SessionServer::Digest d;
+                if (digest.size() != d.size()) throw std::invalid_argument("callable digest must be 32 bytes");
+                std::memcpy(d.data(), digest.c_str(), d.size());
+                self.bind(d, cid);
+            },
+            nb::arg("digest"), nb::arg("cid"), "Make a digest dispatchable as an already-prepared ChipWorker cid."
+        )
+        .def(
+            "serve",
+            [](RemoteL3SessionServer &self) {
+                nb::gil_scoped_release release;
+                self.serve();
+            },
+            "Accept the command connection, send HELLO READY and serve frames until SHUTDOWN or EOF, with the "
+            "GIL released."
+        )
+        .def("stop", &RemoteL3SessionServer::stop, "Unblock serve() from another thread.")
+        .def_prop_ro("stats", [](const RemoteL3SessionServer &self) {
+            const RemoteL3SessionStats &s = self.stats();
+            nb::dict d;
+            d["tasks"] = s.tasks;
+            d["controls"] = s.controls;
+            d["failed_tasks"] = s.failed_tasks;
+            d["failed_controls"] = s.failed_controls;
+            return d;
+        });
+
+    // --- NativeSubFunction (NATIVE_SO SUB callable in a forked SUB child) ---
+    nb::class_<NativeSubFunction>(m, "_NativeSubFunction")
+        .def(nb::init<const std::string &, const std::string &>(), nb::arg("path"), nb::arg("symbol"))
+        .def_prop_ro("path", &NativeSubFunction::path)
+        .def_prop_ro("symbol", &NativeSubFunction::symbol)
+        .def(
+            "run_blob",
+            [](const NativeSubFunction &self, uint64_t blob_ptr, size_t capacity) {
+                TaskArgsView view = read_blob(reinterpret_cast<const uint8_t *>(blob_ptr), capacity);
+                nb::gil_scoped_release release;
+                self.run(view);
+            },
+            nb::arg("blob_ptr"), nb::arg("capacity") = MAILBOX_ARGS_CAPACITY,
+            "Run the symbol directly over a mailbox TaskArgs blob (no decode, GIL released)."
+        )
+        .def(
+            "__call__",
+            [](const NativeSubFunction &self, const TaskArgs &args) {
+                TaskArgsView view = make_view(args);
+                nb::gil_scoped_release release;
+                self.run(view);
+            },
+            nb::arg("args"), "Run the symbol over a TaskArgs (same contract as a Python SUB callable)."
+        );
+
     // --- Standalone blob helpers ---
     m.def(
         "read_args_from_blob",
@@ -1057,4 +1285,5 @@ NB_MODULE(_task_interface, m) {
     );
 
     bind_worker(m);
+    bind_sched_sim(m);
 }
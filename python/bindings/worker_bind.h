@@ -26,14 +26,18 @@
 
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
 
 #include <cstdint>
 #include <cstring>
 #include <limits>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "compiled_orch.h"
 #include "ring.h"
 #include "orchestrator.h"
 #include "types.h"
@@ -92,6 +96,7 @@ inline CallableKind parse_callable_kind(const std::string &kind) {
     if (kind == "CHIP_CALLABLE") return CallableKind::CHIP_CALLABLE;
     if (kind == "PYTHON_SERIALIZED") return CallableKind::PYTHON_SERIALIZED;
     if (kind == "PYTHON_IMPORT") return CallableKind::PYTHON_IMPORT;
+    if (kind == "NATIVE_SO") return CallableKind::NATIVE_SO;
     throw std::invalid_argument("CALLABLE_KIND_UNSUPPORTED: " + kind);
 }
 
@@ -336,6 +341,15 @@ inline void bind_worker(nb::module_ &m) {
             },
             nb::arg("worker_id"), nb::arg("dst"), nb::arg("src"), nb::arg("size"), "Copy worker src to host dst."
         )
+        .def(
+            "submit_copy",
+            [](Orchestrator &self, int32_t src_worker_id, const Tensor &src, int32_t dst_worker_id, const Tensor &dst) {
+                self.submit_copy(src_worker_id, src, dst_worker_id, dst);
+            },
+            nb::arg("src_worker_id"), nb::arg("src"), nb::arg("dst_worker_id"), nb::arg("dst"),
+            "Submit src@src_worker_id -> dst@dst_worker_id as a DAG node (-1 = host). "
+            "Ordered against other tasks through the TensorMap."
+        )
         .def(
             "alloc",
             [](Orchestrator &self, const std::vector<uint32_t> &shape, DataType dtype) {
@@ -360,6 +374,31 @@ inline void bind_worker(nb::module_ &m) {
             "_clear_error", &Orchestrator::clear_error, "Clear any stored dispatch error so the next run can proceed."
         );
 
+    // --- CompiledOrchFunction (compiled L3 orch fn, see l3_orchestration_api.h) ---
+    nb::class_<CompiledOrchFunction>(m, "_CompiledOrchFunction")
+        .def(nb::init<const std::string &, const std::string &>(), nb::arg("path"), nb::arg("symbol"))
+        .def_prop_ro("path", &CompiledOrchFunction::path)
+        .def_prop_ro("symbol", &CompiledOrchFunction::symbol)
+        .def(
+            "run",
+            [](const CompiledOrchFunction &self, Orchestrator &orch, const TaskArgs &args, const CallConfig &config,
+               const std::vector<std::tuple<nb::bytes, std::string, std::string, std::vector<int32_t>>> &callables) {
+                std::vector<CompiledOrchCallable> table;
+                table.reserve(callables.size());
+                for (const auto &[digest, kind, target_namespace, eligible] : callables) {
+                    CompiledOrchCallable c;
+                    c.identity = make_callable_identity(digest, kind, target_namespace);
+                    c.eligible_worker_ids = eligible;
+                    table.push_back(std::move(c));
+                }
+                nb::gil_scoped_release release;
+                self.run(orch, args, config, table);
+            },
+            nb::arg("orch"), nb::arg("args"), nb::arg("config"), nb::arg("callables"),
+            "Run the entry inside the current scope (GIL released). `callables` is a list of "
+            "(digest, kind, target_namespace, eligible_worker_ids) the entry indexes into."
+        );
+
     // --- Worker ---
     // Bound as `_Worker` because the Python user-facing `Worker` factory
     // (simpler.worker.Worker) wraps this C++ class.
@@ -398,6 +437,29 @@ inline void bind_worker(nb::module_ &m) {
             "MAILBOX_SIZE-byte MAP_SHARED region; the child process loop is "
             "Python-managed (fork + _sub_worker_loop)."
         )
+        .def(
+            "add_native_sub_worker",
+            [](Worker &self, const std::vector<std::tuple<nb::bytes, std::string, std::string, int32_t>> &preload) {
+                std::vector<NativeSubPreload> entries;
+                entries.reserve(preload.size());
+                for (const auto &[digest, path, symbol, refs] : preload) {
+                    NativeSubPreload e;
+                    if (digest.size() != e.digest.size()) {
+                        throw std::invalid_argument("callable digest must be exactly 32 bytes");
+                    }
+                    std::memcpy(e.digest.data(), digest.c_str(), e.digest.size());
+                    e.path = path;
+                    e.symbol = symbol;
+                    e.refs = refs;
+                    entries.push_back(std::move(e));
+                }
+                return self.add_native_sub_worker(entries);
+            },
+            nb::arg("preload") = std::vector<std::tuple<nb::bytes, std::string, std::string, int32_t>>{},
+            "Add an in-process SUB worker that runs NATIVE_SO callables on the parent's own worker thread. "
+            "`preload` is a list of (digest, so_path, symbol, refs) for identities registered before start; "
+            "later ones arrive through the usual SUB control broadcast. Returns the SUB worker id."
+        )
         .def(
             "add_remote_l3_socket",
             [](Worker &self, int32_t worker_id, uint64_t session_id, const std::string &transport_name,
@@ -437,16 +499,18 @@ inline void bind_worker(nb::module_ &m) {
         )
         .def(
             "broadcast_register_all",
-            [](Worker &self, uint64_t blob_ptr, uint64_t blob_size, nb::object digest) {
+            [](Worker &self, uint64_t blob_ptr, uint64_t blob_size, nb::object digest, bool probe_held) {
                 std::string digest_bytes = bytes_from_digest_arg(digest);
                 nb::gil_scoped_release release;
                 return self.broadcast_register_all(
-                    blob_ptr, blob_size, reinterpret_cast<const uint8_t *>(digest_bytes.data())
+                    blob_ptr, blob_size, reinterpret_cast<const uint8_t *>(digest_bytes.data()), probe_held
                 );
             },
-            nb::arg("blob_ptr"), nb::arg("blob_size"), nb::arg("digest"),
+            nb::arg("blob_ptr"), nb::arg("blob_size"), nb::arg("digest"), nb::arg("probe_held") = false,
             "Stage `blob_size` bytes from `blob_ptr` into a POSIX shm and broadcast "
-            "CTRL_REGISTER to every NEXT_LEVEL child in parallel. Returns per-child status."
+            "CTRL_REGISTER to every NEXT_LEVEL child in parallel. With probe_held, children "
+            "that already hold the digest are registered digest-only and the blob is staged "
+            "only for the rest. Returns per-child status."
         )
         .def(
             "control_digest_only",
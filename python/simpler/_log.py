@@ -33,7 +33,10 @@ This module configures the "simpler" logger at import so that an unconfigured
 user gets the V5 default rather than Python's WARNING root inheritance.
 """
 
+from __future__ import annotations
+
 import logging
+import os
 
 # DEFAULT_LOG_THRESHOLD is exposed by the _task_interface nanobind module so
 # Python and C++ share one constant. During a fresh `pip install -e .` the
@@ -118,6 +121,28 @@ def _split_threshold(t: int) -> tuple[int, int]:
     return (_SEV_NUL, 0)
 
 
+_binary_log_path: str | None = None
+
+
+def set_binary_log(path: str | os.PathLike | None) -> None:
+    """Enable deferred-format binary logging for subsequently created workers.
+
+    With a path set, ``ChipWorker.init`` switches the host logger (and, on sim,
+    the AICPU log backend) from per-line stderr formatting to raw per-thread
+    record rings; pending records are appended to ``path`` on
+    ``ChipWorker.finalize``. ERROR lines are still printed as text. Decode with
+    ``simpler_setup.tools.device_log_resolver.decode_binary_log``. ``None``
+    restores text mode for the next worker.
+    """
+    global _binary_log_path  # noqa: PLW0603
+    _binary_log_path = None if path is None else os.fspath(path)
+
+
+def get_binary_log() -> str | None:
+    """Return the binary log path configured via `set_binary_log`, if any."""
+    return _binary_log_path
+
+
 def get_current_config() -> tuple[int, int]:
     """Return current (severity, info_v) for forwarding to ChipWorker.init().
 
@@ -12,7 +12,12 @@ from __future__ import annotations
 
 import ctypes
 import hashlib
+import json
+import os
 import struct
+import tempfile
+import threading
+import weakref
 from dataclasses import dataclass, field
 from typing import Any, Literal
 
@@ -23,11 +28,14 @@ CALLABLE_HASH_DIGEST_BYTES = 32
 CALLABLE_KIND_CHIP = 1
 CALLABLE_KIND_PYTHON_SERIALIZED = 2
 CALLABLE_KIND_PYTHON_IMPORT = 3
+CALLABLE_KIND_NATIVE_SO = 4
+# Descriptor-only: compiled L3 orch fns are run by Worker.run, never submitted.
+CALLABLE_KIND_NATIVE_ORCH = 5
 TARGET_NAMESPACE_LOCAL_CHIP = "LOCAL_CHIP"
 TARGET_NAMESPACE_LOCAL_PYTHON = "LOCAL_PYTHON"
 TARGET_NAMESPACE_REMOTE_TASK_DISPATCHER = "REMOTE_TASK_DISPATCHER"
 
-CallableKindName = Literal["CHIP_CALLABLE", "PYTHON_SERIALIZED", "PYTHON_IMPORT"]
+CallableKindName = Literal["CHIP_CALLABLE", "PYTHON_SERIALIZED", "PYTHON_IMPORT", "NATIVE_SO"]
 TargetNamespaceName = Literal["LOCAL_CHIP", "LOCAL_PYTHON", "REMOTE_TASK_DISPATCHER"]
 
 __all__ = [
@@ -37,9 +45,13 @@ __all__ = [
     "TargetNamespaceName",
     "build_chip_callable_descriptor",
     "build_chip_signature_schema",
+    "build_native_orch_descriptor",
+    "build_native_so_descriptor",
     "build_python_import_descriptor",
     "build_python_serialized_descriptor",
     "compute_callable_hashid",
+    "hash_chip_callable_blob",
+    "hash_shared_library",
     "hashid_to_digest",
     "parse_python_import_target",
     "parse_python_callable_payload",
@@ -77,7 +89,7 @@ def _validate_dotted_ident(value: str, *, field_name: str) -> None:
         raise ValueError(f"{field_name} contains a non-identifier component: {value!r}")
 
 
-def _sha256_digest(data: bytes) -> bytes:
+def _sha256_digest(data: bytes | memoryview) -> bytes:
     return hashlib.sha256(data).digest()
 
 
@@ -95,8 +107,27 @@ def _platform_arch(platform: str) -> str:
     raise ValueError(f"Unknown platform for callable descriptor: {platform}")
 
 
-def _chip_callable_bytes(target: ChipCallable) -> bytes:
-    return ctypes.string_at(int(target.buffer_ptr()), int(target.buffer_size()))
+def _chip_callable_view(target: ChipCallable) -> memoryview:
+    size = int(target.buffer_size())
+    return memoryview((ctypes.c_char * size).from_address(int(target.buffer_ptr()))).cast("B")
+
+
+# ChipCallable bytes are fixed at construction, so the blob digest is taken
+# once per object. Entries die with the object; a binding without weakref
+# support just hashes every time.
+_CHIP_BLOB_DIGESTS: weakref.WeakKeyDictionary[ChipCallable, bytes] = weakref.WeakKeyDictionary()
+
+
+def hash_chip_callable_blob(target: ChipCallable) -> bytes:
+    """SHA-256 of a ChipCallable's serialized bytes, memoized per object."""
+    try:
+        cached = _CHIP_BLOB_DIGESTS.get(target)
+    except TypeError:
+        return _sha256_digest(_chip_callable_view(target))
+    if cached is None:
+        cached = _sha256_digest(_chip_callable_view(target))
+        _CHIP_BLOB_DIGESTS[target] = cached
+    return cached
 
 
 def _arg_direction_value(direction: ArgDirection) -> int:
@@ -113,8 +144,18 @@ def build_chip_signature_schema(target: ChipCallable) -> bytes:
     return bytes(data)
 
 
-def build_chip_callable_descriptor(*, target: ChipCallable, platform: str = "", runtime: str = "") -> bytes:
-    blob = _chip_callable_bytes(target)
+def build_chip_callable_descriptor(
+    *, target: ChipCallable, platform: str = "", runtime: str = "", blob_sha256: bytes | None = None
+) -> bytes:
+    """Canonical CHIP_CALLABLE descriptor.
+
+    ``blob_sha256`` lets a receiver that has just verified the wire blob
+    against its SHA-256 skip hashing the rebuilt object a second time.
+    """
+    if blob_sha256 is None:
+        blob_sha256 = hash_chip_callable_blob(target)
+    elif len(blob_sha256) != CALLABLE_HASH_DIGEST_BYTES:
+        raise ValueError(f"CHIP_CALLABLE blob hash must be {CALLABLE_HASH_DIGEST_BYTES} bytes")
     signature_digest = _sha256_digest(build_chip_signature_schema(target))
     data = bytearray()
     data += _pack_u32(CALLABLE_DESCRIPTOR_SCHEMA_VERSION)
@@ -122,7 +163,7 @@ def build_chip_callable_descriptor(*, target: ChipCallable, platform: str = "",
     data += _pack_string(_platform_arch(platform))
     data += _pack_string(platform)
     data += _pack_string(runtime)
-    data += _pack_bytes(_sha256_digest(blob))
+    data += _pack_bytes(blob_sha256)
     data += _pack_bytes(signature_digest)
     return bytes(data)
 
@@ -184,6 +225,158 @@ def build_python_import_descriptor(module: str, qualname: str) -> bytes:
     return bytes(data)
 
 
+def _hash_file(path: str) -> bytes:
+    h = hashlib.sha256()
+    with open(path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            h.update(chunk)
+    return h.digest()
+
+
+_IDENTITY_CACHE_ENV = "SIMPLER_IDENTITY_CACHE"
+_IDENTITY_CACHE_VERSION = 1
+_IDENTITY_CACHE_MAX_ENTRIES = 4096
+
+
+def _identity_cache_file() -> str | None:
+    """Where file digests persist: ``$SIMPLER_IDENTITY_CACHE``, else the user cache dir.
+
+    An empty value, ``0`` or ``off`` keeps the cache in-process only.
+    """
+    configured = os.environ.get(_IDENTITY_CACHE_ENV)
+    if configured is not None:
+        return None if configured.strip().lower() in ("", "0", "off") else os.path.expanduser(configured)
+    base = os.environ.get("XDG_CACHE_HOME") or os.path.join(os.path.expanduser("~"), ".cache")
+    return os.path.join(base, "simpler", "identity-cache.json")
+
+
+def _file_identity_key(path: str, st: os.stat_result) -> str:
+    # ctime moves on every content write and cannot be set back by utime(),
+    # so an in-place rewrite that preserves size and mtime still misses.
+    return f"{path}|{st.st_dev}:{st.st_ino}:{st.st_size}:{st.st_mtime_ns}:{st.st_ctime_ns}"
+
+
+class _FileDigestCache:
+    """Content digests of files on disk, keyed by path and stat identity.
+
+    Each file is hashed at most once per process while its (device, inode,
+    size, mtime, ctime) stays the same. Digests are also persisted to a small
+    JSON file so the next process (a forked child, a rerun of the same model)
+    only stats the file. The persisted cache is advisory: a missing, corrupt
+    or unwritable file just means hashing again.
+    """
+
+    def __init__(self) -> None:
+        self._lock = threading.Lock()
+        self._entries: dict[str, bytes] = {}
+        self._loaded_from: str | None = None
+
+    def digest(self, path: str) -> bytes:
+        path = os.path.realpath(path)
+        st = os.stat(path)
+        key = _file_identity_key(path, st)
+        cache_file = _identity_cache_file()
+        with self._lock:
+            if cache_file is not None and self._loaded_from != cache_file:
+                self._entries.update(_load_identity_cache(cache_file))
+                self._loaded_from = cache_file
+            cached = self._entries.get(key)
+        if cached is not None:
+            return cached
+        digest = _hash_file(path)
+        if _file_identity_key(path, os.stat(path)) != key:
+            return digest  # changed while hashing: usable now, not cacheable
+        with self._lock:
+            self._entries[key] = digest
+            while len(self._entries) > _IDENTITY_CACHE_MAX_ENTRIES:
+                del self._entries[next(iter(self._entries))]
+        if cache_file is not None:
+            _store_identity_cache(cache_file, {key: digest})
+        return digest
+
+    def clear(self) -> None:
+        with self._lock:
+            self._entries.clear()
+            self._loaded_from = None
+
+
+def _load_identity_cache(cache_file: str) -> dict[str, bytes]:
+    try:
+        with open(cache_file, encoding="utf-8") as f:
+            data = json.load(f)
+        if data.get("version") != _IDENTITY_CACHE_VERSION:
+            return {}
+        return {
+            str(key): bytes.fromhex(value)
+            for key, value in data.get("entries", {}).items()
+            if isinstance(value, str) and len(value) == 2 * CALLABLE_HASH_DIGEST_BYTES
+        }
+    except (OSError, ValueError, AttributeError):
+        return {}
+
+
+def _store_identity_cache(cache_file: str, new_entries: dict[str, bytes]) -> None:
+    """Merge ``new_entries`` into the persisted cache; atomic via rename."""
+    try:
+        entries = _load_identity_cache(cache_file)
+        entries.update(new_entries)
+        items = list(entries.items())[-_IDENTITY_CACHE_MAX_ENTRIES:]
+        directory = os.path.dirname(cache_file) or "."
+        os.makedirs(directory, exist_ok=True)
+        fd, tmp = tempfile.mkstemp(prefix=".identity-cache-", dir=directory)
+        try:
+            with os.fdopen(fd, "w", encoding="utf-8") as f:
+                json.dump({"version": _IDENTITY_CACHE_VERSION, "entries": {k: v.hex() for k, v in items}}, f)
+            os.replace(tmp, cache_file)
+        except BaseException:
+            os.unlink(tmp)
+            raise
+    except OSError:
+        pass
+
+
+_FILE_DIGESTS = _FileDigestCache()
+
+
+def hash_shared_library(path: str) -> bytes:
+    """SHA-256 of a shared library's bytes: the content half of a NATIVE_SO identity.
+
+    Served from the file identity cache while the file is unchanged on disk.
+    """
+    return _FILE_DIGESTS.digest(os.fspath(path))
+
+
+def _build_native_symbol_descriptor(kind: int, label: str, so_sha256: bytes, symbol: str) -> bytes:
+    if len(so_sha256) != CALLABLE_HASH_DIGEST_BYTES:
+        raise ValueError(f"{label} library hash must be {CALLABLE_HASH_DIGEST_BYTES} bytes")
+    if not symbol or not (symbol.isascii() and symbol.isidentifier()):
+        raise ValueError(f"{label} symbol must be a C identifier: {symbol!r}")
+    data = bytearray()
+    data += _pack_u32(CALLABLE_DESCRIPTOR_SCHEMA_VERSION)
+    data += _pack_u32(kind)
+    data += _pack_bytes(so_sha256)
+    data += _pack_string(symbol)
+    return bytes(data)
+
+
+def build_native_so_descriptor(so_sha256: bytes, symbol: str) -> bytes:
+    """Descriptor for a C ABI SUB callable: library content hash + exported symbol.
+
+    The path is deliberately not part of the identity — the same library
+    copied elsewhere is the same callable.
+    """
+    return _build_native_symbol_descriptor(CALLABLE_KIND_NATIVE_SO, "NATIVE_SO", so_sha256, symbol)
+
+
+def build_native_orch_descriptor(so_sha256: bytes, symbol: str) -> bytes:
+    """Descriptor for a compiled L3 orchestration entry (l3_orchestration_api.h).
+
+    Same shape as NATIVE_SO under its own kind, so one library exporting both
+    a SUB callable and an orch entry never yields colliding hashids.
+    """
+    return _build_native_symbol_descriptor(CALLABLE_KIND_NATIVE_ORCH, "NATIVE_ORCH", so_sha256, symbol)
+
+
 def compute_callable_hashid(descriptor: bytes) -> str:
     return _sha256_hashid(descriptor)
 
@@ -245,7 +438,7 @@ class CallableHandle:
         return handle
 
     def _validate_public_fields(self) -> None:
-        if self.kind not in ("CHIP_CALLABLE", "PYTHON_SERIALIZED", "PYTHON_IMPORT"):
+        if self.kind not in ("CHIP_CALLABLE", "PYTHON_SERIALIZED", "PYTHON_IMPORT", "NATIVE_SO"):
             raise ValueError(f"CALLABLE_KIND_UNSUPPORTED: {self.kind}")
         if self.target_namespace not in (
             TARGET_NAMESPACE_LOCAL_CHIP,
@@ -32,8 +32,9 @@ directly.
 
 from __future__ import annotations
 
+import bisect
 import contextlib
-from collections.abc import Iterator, Sequence
+from collections.abc import Iterable, Iterator, Sequence
 from typing import Any
 
 from _task_interface import _Orchestrator as _COrchestrator  # pyright: ignore[reportMissingImports]
@@ -124,6 +125,74 @@ def _remote_data_eligible_worker_ids(
     return final_worker_ids
 
 
+_MAX_RING_DEPTH = 4  # hierarchical/types.h MAX_RING_DEPTH
+
+
+class LifetimeTrace:
+    """Submission-order lifetimes of ``Orchestrator.alloc`` buffers.
+
+    Filled while ``Orchestrator.lifetime_trace()`` is active. Each alloc
+    becomes one entry whose ``def`` is the index of the next submit and whose
+    ``last_use`` is the index of the latest submit naming an address inside
+    the buffer (its base or an offset view). ``ring`` is the heap ring the
+    alloc lands in, counting scopes opened after the trace started (open the
+    trace at the top level of the orch fn). ``to_dict()`` is the input format of
+    ``python -m simpler_setup.tools.buffer_planner``.
+    """
+
+    def __init__(self) -> None:
+        self.buffers: list[dict] = []
+        # Live alloc ranges: sorted bases, and base -> (end, entry). A use is
+        # any tensor whose address falls inside a range, so offset views
+        # count towards the buffer they slice.
+        self._starts: list[int] = []
+        self._ranges: dict[int, tuple[int, dict]] = {}
+        self._submits = 0
+        self._depth = 0
+
+    def _on_alloc(self, tensor: Tensor) -> None:
+        addr = int(tensor.data)
+        if addr == 0:
+            return
+        nbytes = int(tensor.nbytes())
+        entry = {
+            "name": hex(addr),
+            "ring": min(self._depth, _MAX_RING_DEPTH - 1),
+            "bytes": nbytes,
+            "def": self._submits,
+            "last_use": self._submits,
+        }
+        self.buffers.append(entry)
+        end = addr + max(nbytes, 1)
+        # The heap handed this range out again, so older buffers overlapping
+        # it were reclaimed and later uses there are not theirs.
+        i = bisect.bisect_left(self._starts, end)
+        while i > 0 and self._ranges[self._starts[i - 1]][0] > addr:
+            i -= 1
+            del self._ranges[self._starts.pop(i)]
+        bisect.insort(self._starts, addr)
+        self._ranges[addr] = (end, entry)
+
+    def _on_submit(self, tensors: Iterable[Tensor]) -> None:
+        for t in tensors:
+            addr = int(t.data)
+            i = bisect.bisect_right(self._starts, addr) - 1
+            if i >= 0:
+                end, entry = self._ranges[self._starts[i]]
+                if addr < end:
+                    entry["last_use"] = self._submits
+        self._submits += 1
+
+    def to_dict(self) -> dict:
+        return {"buffers": [dict(b) for b in self.buffers]}
+
+
+def _args_tensors(args_list: Sequence[TaskArgs]) -> Iterator[Tensor]:
+    for args in args_list:
+        for i in range(args.tensor_count()):
+            yield args.tensor(i)
+
+
 class Orchestrator:
     """DAG builder. Valid only inside the orch function passed to Worker.run().
 
@@ -140,6 +209,8 @@ class Orchestrator:
         # Worker's chip mailboxes.  None when the Orchestrator is constructed
         # in isolation for tests.
         self._worker = worker
+        # Active lifetime_trace(), or None (the common case: no bookkeeping).
+        self._trace: LifetimeTrace | None = None
 
     def _expected_next_level_namespace(self) -> str | None:
         if self._worker is None:
@@ -200,6 +271,8 @@ class Orchestrator:
             raise
         if self._worker is not None:
             self._worker._adopt_remote_slot_refs(captured_refs)
+        if self._trace is not None:
+            self._trace._on_submit(_args_tensors([c_args]))
 
     def submit_next_level_group(
         self,
@@ -274,6 +347,8 @@ class Orchestrator:
             raise
         if self._worker is not None:
             self._worker._adopt_remote_slot_refs(captured_refs)
+        if self._trace is not None:
+            self._trace._on_submit(_args_tensors(c_args_list))
 
     def submit_sub(self, callable_handle: Any, args: TaskArgs | None = None):
         """Submit a SUB task by registered callable handle.
@@ -290,6 +365,8 @@ class Orchestrator:
         )
         _reject_remote_sidecar_args(args, kind="orch.submit_sub")
         self._o.submit_sub(digest, kind, target_namespace, args)
+        if self._trace is not None:
+            self._trace._on_submit(_args_tensors([args]))
 
     def submit_sub_group(self, callable_handle: Any, args_list: list):
         """Submit a group of SUB tasks (N TaskArgs → N workers, 1 DAG node)."""
@@ -302,6 +379,8 @@ class Orchestrator:
         for args in args_list:
             _reject_remote_sidecar_args(args, kind="orch.submit_sub_group")
         self._o.submit_sub_group(digest, kind, target_namespace, args_list)
+        if self._trace is not None:
+            self._trace._on_submit(_args_tensors(args_list))
 
     # ------------------------------------------------------------------
     # Dynamic CommDomain allocation (collective; blocks orch_fn for the
@@ -373,9 +452,13 @@ class Orchestrator:
 
     def scope_begin(self) -> None:
         self._o.scope_begin()
+        if self._trace is not None:
+            self._trace._depth += 1
 
     def scope_end(self) -> None:
         self._o.scope_end()
+        if self._trace is not None:
+            self._trace._depth -= 1
 
     @contextlib.contextmanager
     def scope(self) -> Iterator[Orchestrator]:
@@ -385,11 +468,11 @@ class Orchestrator:
         reclaim independently of the outer scope (see Strict-1 in
         ``.claude/plans/HIERARCHICAL_RUNTIME_REFACTOR.md``).
         """
-        self._o.scope_begin()
+        self.scope_begin()
         try:
             yield self
         finally:
-            self._o.scope_end()
+            self.scope_end()
 
     def malloc(self, worker_id: int, size: int) -> int:
         """Allocate memory on next-level worker *worker_id*. Returns a pointer."""
@@ -407,6 +490,20 @@ class Orchestrator:
         """Copy *size* bytes from worker *src* to host *dst*."""
         self._o.copy_from(int(worker_id), int(dst), int(src), int(size))
 
+    def submit_copy(self, src_worker_id: int, src: Tensor, dst_worker_id: int, dst: Tensor) -> None:
+        """Copy *src* on worker *src_worker_id* into *dst* on *dst_worker_id* as a DAG node.
+
+        ``-1`` names host memory (which must be MAP_SHARED, e.g. from
+        :meth:`alloc`). Unlike ``copy_from`` + ``copy_to`` this does not block
+        the orch fn: *src* is tracked as an input and *dst* as an inout, so the
+        copy waits for their producers, downstream tasks wait for the copy,
+        and independent kernels keep running meanwhile. Chip tensors are keyed
+        per worker, matching tasks submitted with ``worker=``.
+        """
+        self._o.submit_copy(int(src_worker_id), src, int(dst_worker_id), dst)
+        if self._trace is not None:
+            self._trace._on_submit((src, dst))
+
     def alloc(self, shape: Sequence[int], dtype: DataType) -> Tensor:
         """Allocate a runtime-managed intermediate buffer.
 
@@ -420,7 +517,34 @@ class Orchestrator:
         pre-allocating with ``torch.share_memory_()`` — the runtime owns
         the lifecycle.
         """
-        return self._o.alloc(list(shape), dtype)
+        t = self._o.alloc(list(shape), dtype)
+        if self._trace is not None:
+            self._trace._on_alloc(t)
+        return t
+
+    @contextlib.contextmanager
+    def lifetime_trace(self) -> Iterator[LifetimeTrace]:
+        """Record alloc/submit lifetimes for the buffer planner during the ``with`` block.
+
+        Usage::
+
+            def my_orch(orch, args, cfg):
+                with orch.lifetime_trace() as trace:
+                    ...
+                json.dump(trace.to_dict(), open("lifetimes.json", "w"))
+
+        Then ``python -m simpler_setup.tools.buffer_planner lifetimes.json``
+        reports the per-ring peak footprint against the live set. Only
+        ``alloc`` buffers are tracked; auto-allocated OUTPUT slabs are not.
+        """
+        if self._trace is not None:
+            raise RuntimeError("lifetime_trace is already active")
+        trace = LifetimeTrace()
+        self._trace = trace
+        try:
+            yield trace
+        finally:
+            self._trace = None
 
     # ------------------------------------------------------------------
     # Internal (called by Worker.run)
@@ -31,6 +31,11 @@ MAX_STAGED_BLOB_TOKEN_BYTES = 1024
 REMOTE_BUFFER_ACCESS_READ = 1 << 0
 REMOTE_BUFFER_ACCESS_WRITE = 1 << 1
 REMOTE_BUFFER_ACCESS_READ_WRITE = REMOTE_BUFFER_ACCESS_READ | REMOTE_BUFFER_ACCESS_WRITE
+# HelloPayload.feature_flags: the session accepts HELD_BLOB chip callables.
+HELLO_FEATURE_HELD_CHIP_BLOB = 1 << 0
+# ControlReplyPayload error codes; BLOB_NOT_HELD asks the sender to resend INLINE_BLOB.
+CONTROL_ERROR = 1
+CONTROL_ERROR_BLOB_NOT_HELD = 2
 CALLABLE_HASH_DIGEST_BYTES = 32
 FRAME_HEADER_BYTES = 40
 MAGIC = b"SLR3"
@@ -78,6 +83,9 @@ class CallableKind(enum.IntEnum):
 class ChipCallableBlobLocation(enum.IntEnum):
     INLINE_BLOB = 1
     STAGED_BLOB = 2
+    # No bytes on the wire: the receiver already holds the callable named by
+    # the command digest.
+    HELD_BLOB = 3
 
 
 class ReadyState(enum.IntEnum):
@@ -619,6 +627,9 @@ def encode_remote_chip_callable_payload(payload: RemoteChipCallablePayload) -> b
     elif location == ChipCallableBlobLocation.STAGED_BLOB:
         if payload.inline_blob or not payload.staged_blob_token:
             raise ValueError("remote_wire: CHIP_CALLABLE staged payload fields are inconsistent")
+    elif location == ChipCallableBlobLocation.HELD_BLOB:
+        if payload.inline_blob or payload.staged_blob_token:
+            raise ValueError("remote_wire: CHIP_CALLABLE held payload fields are inconsistent")
     out = bytearray()
     _put_blob(out, payload.descriptor_bytes, MAX_CHIP_CALLABLE_DESCRIPTOR_BYTES, "CHIP_CALLABLE.descriptor_bytes")
     out.extend(struct.pack("<IQ", int(location), blob_size))
@@ -789,6 +800,36 @@ def encode_import_buffer_result(result: ImportBufferResult) -> bytes:
     return bytes(out)
 
 
+def decode_import_buffer_result(data: bytes) -> ImportBufferResult:
+    reader = _Reader(data)
+    result = ImportBufferResult(
+        importer_worker_id=reader.i32(),
+        owner_worker_id=reader.i32(),
+        buffer_id=reader.u64(),
+        generation=reader.u64(),
+        import_id=reader.u64(),
+        address_space=RemoteAddressSpace(reader.u32()),
+        offset=reader.u64(),
+        nbytes=reader.u64(),
+        remote_addr=reader.u64(),
+        rkey_or_token=reader.u64(),
+        ub_ldst_va=reader.u64(),
+        access_flags=reader.u32(),
+        transport_profile=reader.string(MAX_TRANSPORT_PROFILE_BYTES, "import result transport_profile"),
+        import_descriptor=reader.blob(MAX_TRANSPORT_DESCRIPTOR_BYTES, "import result import_descriptor"),
+    )
+    if reader.u32() != 0:
+        raise ValueError("remote_wire: import result reserved field must be zero")
+    reader.done("import result")
+    _validate_import_result_identity(result)
+    _validate_access_flags(result.access_flags, "import result access_flags")
+    if result.address_space not in (RemoteAddressSpace.REMOTE_WINDOW, RemoteAddressSpace.UB_LDST):
+        raise ValueError("remote_wire: import result address_space is invalid")
+    if result.import_id == 0 or result.nbytes <= 0:
+        raise ValueError("remote_wire: import result requires non-zero import_id and nbytes")
+    return result
+
+
 def decode_release_import_request(data: bytes) -> ReleaseImportRequest:
     reader = _Reader(data)
     request = ReleaseImportRequest(
@@ -30,16 +30,22 @@ from dataclasses import dataclass
 from multiprocessing import shared_memory
 from typing import Any, Callable
 
+from _task_interface import _RemoteL3SessionServer  # pyright: ignore[reportMissingImports]
+
 from .callable_identity import (
     CallableHandle,
     build_chip_callable_descriptor,
     build_python_import_descriptor,
     compute_callable_hashid,
+    hash_chip_callable_blob,
     hashid_to_digest,
     parse_python_import_target,
     validate_hashid,
 )
 from .remote_l3_protocol import (
+    CONTROL_ERROR,
+    CONTROL_ERROR_BLOB_NOT_HELD,
+    HELLO_FEATURE_HELD_CHIP_BLOB,
     CallableKind,
     ChipCallableBlobLocation,
     ControlName,
@@ -70,7 +76,7 @@ from .remote_l3_protocol import (
     read_frame,
     send_frame,
 )
-from .task_interface import ChipCallable, TaskArgs, Tensor
+from .task_interface import ChipCallable, ChipWorker, TaskArgs, Tensor
 from .worker import Worker
 
 sys.modules.setdefault("simpler.remote_l3_session", sys.modules[__name__])
@@ -224,21 +230,41 @@ def _chip_callable_bytes(callable_obj: ChipCallable) -> bytes:
     return ctypes.string_at(int(callable_obj.buffer_ptr()), int(callable_obj.buffer_size()))
 
 
-def _prepare_inner_chip_callable(command_payload: bytes, manifest: dict[str, Any]) -> tuple[bytes, ChipCallable]:
+class _BlobNotHeld(ValueError):
+    """A HELD_BLOB prepare named a digest this session does not hold."""
+
+
+def _prepare_inner_chip_callable(
+    command_payload: bytes,
+    manifest: dict[str, Any],
+    held_chip: Callable[[bytes], ChipCallable | None] | None = None,
+) -> tuple[bytes, ChipCallable]:
     command = decode_register_callable_command(command_payload)
     if command.callable_kind != CallableKind.CHIP_CALLABLE:
         raise ValueError("CHIP_CALLABLE command expected")
     if command.payload_version != 1:
         raise ValueError("CHIP_CALLABLE payload_version must be 1")
     payload = decode_remote_chip_callable_payload(command.payload)
-    if payload.blob_location != ChipCallableBlobLocation.INLINE_BLOB:
+    if payload.blob_location == ChipCallableBlobLocation.HELD_BLOB:
+        held = held_chip(command.digest) if held_chip is not None else None
+        if held is None:
+            raise _BlobNotHeld("CHIP_CALLABLE HELD_BLOB names a callable this session does not hold; resend INLINE_BLOB")
+        if int(held.buffer_size()) != payload.blob_size or hash_chip_callable_blob(held) != payload.blob_sha256:
+            raise ValueError("CHIP_CALLABLE HELD_BLOB does not match the held executable blob")
+        callable_obj = held
+    elif payload.blob_location != ChipCallableBlobLocation.INLINE_BLOB:
         raise ValueError("CHIP_CALLABLE STAGED_BLOB is unsupported without a negotiated staged-blob adapter")
-    if hashlib.sha256(payload.inline_blob).digest() != payload.blob_sha256:
-        raise ValueError("CHIP_CALLABLE executable blob SHA-256 mismatch")
-    callable_obj = ChipCallable.from_bytes(payload.inline_blob)
+    else:
+        if hashlib.sha256(payload.inline_blob).digest() != payload.blob_sha256:
+            raise ValueError("CHIP_CALLABLE executable blob SHA-256 mismatch")
+        callable_obj = ChipCallable.from_bytes(payload.inline_blob)
     platform = str(manifest.get("platform", ""))
     runtime = str(manifest.get("runtime", ""))
-    rebuilt_descriptor = build_chip_callable_descriptor(target=callable_obj, platform=platform, runtime=runtime)
+    # The blob digest was just checked against the wire (or the held object),
+    # so the rebuilt descriptor reuses it instead of hashing the copy again.
+    rebuilt_descriptor = build_chip_callable_descriptor(
+        target=callable_obj, platform=platform, runtime=runtime, blob_sha256=payload.blob_sha256
+    )
     if rebuilt_descriptor != payload.descriptor_bytes:
         raise ValueError("CHIP_CALLABLE descriptor does not match executable blob or endpoint context")
     rebuilt_digest = hashid_to_digest(compute_callable_hashid(rebuilt_descriptor))
@@ -248,7 +274,9 @@ def _prepare_inner_chip_callable(command_payload: bytes, manifest: dict[str, Any
 
 
 def _prepare_register_callable(
-    command_payload: bytes, manifest: dict[str, Any]
+    command_payload: bytes,
+    manifest: dict[str, Any],
+    held_chip: Callable[[bytes], ChipCallable | None] | None = None,
 ) -> tuple[bytes, CallableKind, RemoteRegistryTarget, Any]:
     command = decode_register_callable_command(command_payload)
     if command.callable_kind == CallableKind.PYTHON_SERIALIZED:
@@ -263,7 +291,7 @@ def _prepare_register_callable(
             digest, target, _target_callable = _validate_python_import_command(command_payload)
             return digest, command.callable_kind, command.target_registry, target
         if command.callable_kind == CallableKind.CHIP_CALLABLE:
-            digest, callable_obj = _prepare_inner_chip_callable(command_payload, manifest)
+            digest, callable_obj = _prepare_inner_chip_callable(command_payload, manifest, held_chip)
             return digest, command.callable_kind, command.target_registry, callable_obj
     raise ValueError("unsupported remote callable target/kind combination")
 
@@ -515,12 +543,19 @@ def _run_command_loop(  # noqa: PLR0912, PLR0915
     next_import_id = 1
     buffers: dict[tuple[int, ...], _RemoteBufferEntry] = {}
 
+    def held_chip(digest: bytes) -> ChipCallable | None:
+        # HELD_BLOB re-registers reuse a prepared or committed inner chip callable.
+        held = prepared_inner.get((CallableKind.CHIP_CALLABLE, digest))
+        if held is None and inner_worker is not None:
+            held = inner_worker._held_chip_callable(digest)  # noqa: SLF001
+        return held
+
     hello = HelloPayload(
         session_id=session_id,
         worker_id=worker_id,
         protocol_version=1,
         comm_profile=str(manifest["transport"]),
-        feature_flags=0,
+        feature_flags=HELLO_FEATURE_HELD_CHIP_BLOB,
         ready_state=ReadyState.READY,
     )
     send_frame(conn, FrameHeader(FrameType.HELLO, session_id, worker_id, 0), encode_hello(hello))
@@ -537,7 +572,9 @@ def _run_command_loop(  # noqa: PLR0912, PLR0915
                 try:
                     control = decode_control(frame.payload)
                     if control.control_name == ControlName.PREPARE_REGISTER_CALLABLE:
-                        digest, kind, registry, target = _prepare_register_callable(control.command_bytes, manifest)
+                        digest, kind, registry, target = _prepare_register_callable(
+                            control.command_bytes, manifest, held_chip
+                        )
                         if registry == RemoteRegistryTarget.REMOTE_TASK_DISPATCHER:
                             prepared_dispatcher[digest] = target
                         else:
@@ -556,7 +593,9 @@ def _run_command_loop(  # noqa: PLR0912, PLR0915
                         elif registry == RemoteRegistryTarget.INNER_L3_WORKER:
                             key = (kind, digest)
                             if key not in prepared_inner:
-                                raise KeyError("COMMIT_REGISTER_CALLABLE inner digest was not prepared")
+                                raise KeyError("COMMIT_REGISTER_CALLABLE digest was not prepared")
+                            if inner_worker is None:
+                                raise RuntimeError("remote session has no ChipWorker attached")
                             target = prepared_inner.pop(key)
                             if kind == CallableKind.PYTHON_IMPORT:
                                 handle = inner_worker._register_child_python_import(target, digest=digest)  # noqa: SLF001
@@ -854,7 +893,7 @@ def _run_command_loop(  # noqa: PLR0912, PLR0915
                         header.sequence,
                         control_name,
                         control_version,
-                        1,
+                        CONTROL_ERROR_BLOB_NOT_HELD if isinstance(exc, _BlobNotHeld) else CONTROL_ERROR,
                         _format_remote_error(f"remote worker_id={worker_id} control sequence={header.sequence}", exc),
                     )
                 continue
@@ -894,7 +933,97 @@ def _run_command_loop(  # noqa: PLR0912, PLR0915
             _INNER_HANDLES.clear()
 
 
+def _install_manifest_native_registry(manifest: dict[str, Any], chip_worker: ChipWorker, server: Any) -> None:
+    """Preload inner ``CHIP_CALLABLE`` manifest entries onto the native session's ChipWorker."""
+    if manifest.get("remote_task_dispatcher"):
+        raise ValueError("native session server cannot host remote_task_dispatcher PYTHON_IMPORT entries")
+    entries = manifest.get("inner_l3_worker", []) or []
+    if not isinstance(entries, list):
+        raise ValueError("inner_l3_worker manifest registry must be a list")
+    seen_digests: set[bytes] = set()
+    for cid, entry in enumerate(entries):
+        if not isinstance(entry, dict):
+            raise ValueError("inner_l3_worker manifest entries must be objects")
+        if _manifest_kind(entry) != CallableKind.CHIP_CALLABLE:
+            raise ValueError("native session server only preloads CHIP_CALLABLE inner_l3_worker entries")
+        digest, callable_obj = _prepare_inner_chip_callable(_manifest_inner_register_command(entry), manifest)
+        if digest in seen_digests:
+            raise ValueError(f"inner_l3_worker manifest contains duplicate hashid {digest.hex()}")
+        seen_digests.add(digest)
+        chip_worker._prepare_callable_at_slot(cid, callable_obj)  # noqa: SLF001
+        server.bind(digest, cid)
+
+
+def run_native_session(manifest: dict[str, Any], ready_fd: int) -> int:
+    """Serve the command lane from C++ (``_RemoteL3SessionServer``) on one ChipWorker.
+
+    Used for ``"session_server": "native"`` manifests. The runner only builds
+    the ChipWorker and preloads manifest chip callables; HELLO, HEALTH, buffer
+    controls, CHIP_CALLABLE registration and TASK dispatch never enter Python.
+    """
+    from simpler_setup.runtime_builder import RuntimeBuilder  # noqa: PLC0415
+
+    chip_worker: ChipWorker | None = None
+    server: Any = None
+    ready_sent = False
+    try:
+        session_timeout_s = _session_timeout_s(manifest)
+        device_ids = [int(x) for x in manifest.get("device_ids", [])]
+        if len(device_ids) != 1:
+            raise ValueError("native session server requires exactly one device_id")
+        if int(manifest.get("num_sub_workers", 0)) != 0:
+            raise ValueError("native session server does not host SUB workers")
+        platform = str(manifest["platform"])
+        runtime = str(manifest.get("runtime", "tensormap_and_ringbuffer"))
+        chip_worker = ChipWorker()
+        chip_worker.init(device_ids[0], RuntimeBuilder(platform).get_binaries(runtime))
+
+        listen_host = str(manifest.get("listen_host", "127.0.0.1"))
+        server = _RemoteL3SessionServer(
+            chip_worker._impl,  # noqa: SLF001
+            int(manifest["session_id"]),
+            int(manifest["worker_id"]),
+            comm_profile=str(manifest["transport"]),
+            listen_host=listen_host,
+            accept_timeout_s=session_timeout_s,
+        )
+        _install_manifest_native_registry(manifest, chip_worker, server)
+        server.listen()
+        _send_ready(
+            ready_fd,
+            {
+                "ok": True,
+                "command_host": str(manifest.get("connect_host", listen_host)),
+                "command_port": int(server.command_port),
+                "health_host": str(manifest.get("connect_host", listen_host)),
+                "health_port": int(server.health_port),
+            },
+        )
+        ready_sent = True
+        server.serve()
+        return 0
+    except BaseException as exc:  # noqa: BLE001
+        # Once the parent holds an ok READY, a serve() failure is only the exit code.
+        if not ready_sent:
+            try:
+                _send_ready(ready_fd, {"ok": False, "error": _format_remote_error("remote session startup", exc)})
+            except OSError:
+                pass
+        return 1
+    finally:
+        if server is not None:
+            server.stop()
+            del server
+        if chip_worker is not None:
+            try:
+                chip_worker.finalize()
+            except BaseException:  # noqa: BLE001
+                pass
+
+
 def run_session(manifest: dict[str, Any], ready_fd: int) -> int:
+    if manifest.get("session_server", "python") == "native":
+        return run_native_session(manifest, ready_fd)
     inner_worker = Worker(
         level=3,
         platform=str(manifest["platform"]),
@@ -907,6 +1036,7 @@ def run_session(manifest: dict[str, Any], ready_fd: int) -> int:
     health_sock: socket.socket | None = None
     stop_health = threading.Event()
     health_thread: threading.Thread | None = None
+    ready_sent = False
     try:
         session_timeout_s = _session_timeout_s(manifest)
         manifest_dispatch_registry = _install_manifest_dispatcher_registry(manifest)
@@ -936,6 +1066,7 @@ def run_session(manifest: dict[str, Any], ready_fd: int) -> int:
                 "health_port": health_port,
             },
         )
+        ready_sent = True
 
         command_sock.settimeout(session_timeout_s)
         conn, _addr = command_sock.accept()
@@ -943,10 +1074,11 @@ def run_session(manifest: dict[str, Any], ready_fd: int) -> int:
             _run_command_loop(conn, manifest, inner_worker, manifest_inner_handles, manifest_dispatch_registry)
         return 0
     except BaseException as exc:  # noqa: BLE001
-        try:
-            _send_ready(ready_fd, {"ok": False, "error": _format_remote_error("remote session startup", exc)})
-        except OSError:
-            pass
+        if not ready_sent:
+            try:
+                _send_ready(ready_fd, {"ok": False, "error": _format_remote_error("remote session startup", exc)})
+            except OSError:
+                pass
         return 1
     finally:
         stop_health.set()
@@ -61,6 +61,8 @@ def _validate_manifest(manifest: dict[str, Any]) -> None:
         raise ValueError("manifest platform must be non-empty")
     if str(manifest["transport"]) != "sim":
         raise ValueError("only sim transport is accepted by simpler-remote-worker")
+    if manifest.get("session_server", "python") not in ("python", "native"):
+        raise ValueError("manifest session_server must be 'python' or 'native'")
 
 
 def _session_timeout_s(manifest: dict[str, Any]) -> float:
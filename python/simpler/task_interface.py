@@ -943,6 +943,7 @@ class ChipWorker:
         self._identity_registry: dict[bytes, Any] = {}
         self._live_handles: dict[int, bytes] = {}
         self._next_handle_id = 0
+        self._log_handle = None
 
     def init(self, device_id, bins, log_level=None, log_info_v=None):
         """Attach the calling thread to ``device_id``, load the host runtime
@@ -994,6 +995,17 @@ class ChipWorker:
         if rc != 0:
             raise RuntimeError(f"simpler_log_init failed with code {rc}")
 
+        # Binary (deferred-format) log mode must be set before host_runtime.so
+        # loads the AICPU SO: the sim runner forwards the path at dlopen time.
+        from . import _log  # noqa: PLC0415
+
+        binary_log = _log.get_binary_log()
+        if binary_log is not None:
+            log_handle.simpler_log_set_binary.argtypes = [ctypes.c_char_p]
+            log_handle.simpler_log_set_binary.restype = ctypes.c_int
+            log_handle.simpler_log_set_binary(os.fsencode(binary_log))
+            self._log_handle = log_handle
+
         # 2. libcpu_sim_context.so — sim platforms only (host_runtime.so's sim
         #    variant resolves sim_context_set_* / pto_sim_get_* against it).
         if bins.sim_context_path:
@@ -1020,6 +1032,12 @@ class ChipWorker:
         Terminal operation — the object cannot be reused after this.
         """
         self._impl.finalize()
+        if self._log_handle is not None:
+            # Sim runs flush both sinks after every run; this picks up host
+            # records logged since (AICPU ones were flushed at SO unload).
+            self._log_handle.simpler_log_flush_binary.restype = ctypes.c_int
+            self._log_handle.simpler_log_flush_binary()
+            self._log_handle = None
         with self._registry_lock:
             self._callable_registry.clear()
             self._identity_registry.clear()
@@ -1167,6 +1185,26 @@ class ChipWorker:
         if self.initialized:
             self._impl.unregister_callable(int(slot_id))
 
+    def configure_run_lanes(self, block_dims, aicpu_thread_nums):
+        """Split the device into run lanes for concurrent ``run`` calls.
+
+        Lane *i* is its own device context (AICPU/AICore streams and runtime
+        arena) and runs with at most ``block_dims[i]`` AICore blocks and
+        ``aicpu_thread_nums[i]`` AICPU threads. Afterwards ``run`` may be
+        called from several threads: each call takes the smallest free lane
+        whose block_dim covers ``config.block_dim`` (0 = the lane's cap) and
+        waits while all fitting lanes are busy. Call after ``init`` and before
+        ``prepare_callable``. Sim only: onboard runtimes raise, because every
+        context on a device shares one AICPU executor. See
+        docs/chip-level-arch.md ("Run Lanes").
+        """
+        self._impl.configure_run_lanes([int(b) for b in block_dims], [int(t) for t in aicpu_thread_nums])
+
+    @property
+    def run_lane_count(self):
+        """Number of configured run lanes (0 = single-lane mode)."""
+        return self._impl.run_lane_count
+
     def _prepare_callable_at_slot(self, callable_id, callable):
         self._impl.prepare_callable(int(callable_id), callable)
 
@@ -1190,6 +1228,22 @@ class ChipWorker:
         """Number of host-side orch SO dlopens (host_build_graph variants)."""
         return self._impl.host_dlopen_count
 
+    def configure_flight_recorder(self, enable=True, slow_step_ns=0, dump_dir=""):
+        """Turn the flight recorder on or off and set its auto-dump policy.
+
+        The recorder is off until this is called with *enable* true; see
+        docs/dfx/flight-recorder.md.
+
+        With a non-empty *dump_dir*, failed runs and runs whose device wall
+        exceeds *slow_step_ns* (0 disables the slow-step trigger) write a
+        snapshot JSON into that directory.
+        """
+        self._impl.configure_flight_recorder(bool(enable), int(slow_step_ns), str(dump_dir))
+
+    def dump_flight_recorder(self, path):
+        """Write the current flight-recorder rings to *path* as JSON."""
+        self._impl.dump_flight_recorder(str(path))
+
     def malloc(self, size):
         """Allocate memory. Returns a pointer (uint64)."""
         return int(self._impl.malloc(int(size)))
@@ -1206,6 +1260,26 @@ class ChipWorker:
         """Copy *size* bytes from worker *src* to host *dst*."""
         self._impl.copy_from(int(dst), int(src), int(size))
 
+    def copy_to_async(self, dst, src, size):
+        """Start copying *size* bytes from host *src* to worker *dst*.
+
+        Returns a completion token for ``wait_copy`` / ``copy_done``. The host
+        buffer must stay alive and unmodified until the copy is done.
+        """
+        return int(self._impl.copy_to_async(int(dst), int(src), int(size)))
+
+    def copy_from_async(self, dst, src, size):
+        """Start copying *size* bytes from worker *src* to host *dst*; returns a token."""
+        return int(self._impl.copy_from_async(int(dst), int(src), int(size)))
+
+    def wait_copy(self, token):
+        """Block until the async copy *token* completes. Raises if it failed."""
+        self._impl.wait_copy(int(token))
+
+    def copy_done(self, token):
+        """Return True once the async copy *token* has completed."""
+        return bool(self._impl.copy_done(int(token)))
+
     def comm_init(self, rank: int, nranks: int, rootinfo_path: str) -> int:
         """Initialize a distributed communicator for this rank.
 
@@ -70,7 +70,7 @@ import sys
 import threading
 import time
 import uuid
-from dataclasses import dataclass
+from dataclasses import dataclass, field
 from multiprocessing.shared_memory import SharedMemory
 from typing import Any
 
@@ -80,6 +80,9 @@ from _task_interface import (  # pyright: ignore[reportMissingImports]
     RUNTIME_ENV_RING_COUNT,
     RunTiming,
     WorkerType,
+    _ChipChildLoop,
+    _CompiledOrchFunction,
+    _NativeSubFunction,
     _mailbox_load_i32,
     _mailbox_store_i32,
     read_args_from_blob,
@@ -91,9 +94,12 @@ from .callable_identity import (
     CallableHandle,
     _CallableIdentityState,
     build_chip_callable_descriptor,
+    build_native_orch_descriptor,
+    build_native_so_descriptor,
     build_python_import_descriptor,
     build_python_serialized_descriptor,
     compute_callable_hashid,
+    hash_shared_library,
     hashid_to_digest,
     parse_python_callable_payload,
     parse_python_import_target,
@@ -185,6 +191,10 @@ _CTRL_PREPARE = 4
 # the mailbox; the child mmaps the shm, allocates its own local slot, and
 # prepares that slot. See docs/callable-identity-registration.md for the design.
 _CTRL_REGISTER = 5
+# Digest-only _CTRL_REGISTER (payload size 0, empty shm name): a child that
+# already holds the digest takes another reference and writes this to
+# _CTRL_OFF_RESULT; otherwise it leaves 0 and the parent resends the blob.
+_CTRL_REGISTER_HELD = 1
 # Symmetric unregister by callable digest. The child drops one local reference
 # and frees the target-local slot when the final digest reference is removed.
 _CTRL_UNREGISTER = 6
@@ -204,6 +214,15 @@ _CTRL_COMM_INIT = 9
 _CTRL_PY_REGISTER = 10
 _CTRL_PY_UNREGISTER = 11
 _CTRL_PY_IMPORT_REGISTER = 12
+# NATIVE_SO SUB callable: raw payload "<so path>\0<symbol>" framed like
+# _CTRL_PY_IMPORT_REGISTER. Unregister reuses _CTRL_PY_UNREGISTER.
+_CTRL_NATIVE_SO_REGISTER = 13
+# Async copy hops for copy nodes: same args as _CTRL_COPY_TO / _FROM, the
+# token comes back at _CTRL_OFF_RESULT. _CTRL_COPY_QUERY polls the token at
+# _CTRL_OFF_ARG0 and writes 1 once it is done.
+_CTRL_COPY_TO_ASYNC = 14
+_CTRL_COPY_FROM_ASYNC = 15
+_CTRL_COPY_QUERY = 16
 
 # Layout of the CTRL_COMM_INIT request shm.
 _COMM_INIT_HEADER = struct.Struct("<II")  # rank (u32), nranks (u32)
@@ -282,6 +301,89 @@ class RemoteCallable:
         return self.target.split(":", 1)[1]
 
 
+@dataclass(frozen=True)
+class NativeSubCallable:
+    """C ABI SUB callable exported from a shared library (see native_sub_abi.h).
+
+    Register it like any SUB callable and submit it with ``submit_sub``; the
+    SUB worker calls ``symbol`` straight over the task's TaskArgs blob
+    instead of decoding it into a Python ``TaskArgs``. With
+    ``Worker(..., sub_mode="thread")`` it runs on the parent's own worker
+    threads and never touches a mailbox.
+
+    Identity is the library's content hash plus ``symbol``, taken when the
+    object is built; ``path`` only says where to load it from. A rebuilt
+    library is a new callable, and a child refuses to load a library whose
+    bytes changed since.
+    """
+
+    path: str
+    symbol: str
+    so_sha256: bytes = field(init=False, repr=False)
+
+    def __post_init__(self) -> None:
+        path = os.path.abspath(os.fspath(self.path))
+        object.__setattr__(self, "path", path)
+        object.__setattr__(self, "symbol", str(self.symbol))
+        object.__setattr__(self, "so_sha256", hash_shared_library(path))
+
+    def descriptor(self) -> bytes:
+        return build_native_so_descriptor(self.so_sha256, self.symbol)
+
+    def payload(self) -> bytes:
+        return self.path.encode("utf-8") + b"\x00" + self.symbol.encode("utf-8")
+
+    def verify(self) -> None:
+        if hash_shared_library(self.path) != self.so_sha256:
+            raise RuntimeError(f"HASHID_DESCRIPTOR_MISMATCH: {self.path} changed since NativeSubCallable was built")
+
+    def load(self) -> _NativeSubFunction:
+        self.verify()
+        return _NativeSubFunction(self.path, self.symbol)
+
+
+def _parse_native_sub_payload(payload: bytes) -> tuple[str, str]:
+    path, sep, symbol = payload.partition(b"\x00")
+    if not sep or not path or not symbol:
+        raise RuntimeError("NATIVE_SO payload must be '<path>\\0<symbol>'")
+    return path.decode("utf-8"), symbol.decode("utf-8")
+
+
+@dataclass(frozen=True)
+class CompiledOrchestration:
+    """Compiled L3+ orch fn: an entry exported from a shared library.
+
+    Pass it to ``Worker.run`` in place of a Python orch fn. The entry (built
+    with ``SIMPLER_L3_ORCHESTRATION``, see l3_orchestration_api.h) builds the
+    DAG in C++; each submit names a callable by its index in ``callables``,
+    a sequence of handles from this Worker's ``register``.
+
+    Identity follows NativeSubCallable — library content hash plus
+    ``symbol`` — and keys the Worker's cache of loaded entries, so the
+    library is opened once however many runs reuse it.
+    """
+
+    path: str
+    symbol: str
+    callables: tuple[CallableHandle, ...] = ()
+    so_sha256: bytes = field(init=False, repr=False)
+
+    def __post_init__(self) -> None:
+        path = os.path.abspath(os.fspath(self.path))
+        object.__setattr__(self, "path", path)
+        object.__setattr__(self, "symbol", str(self.symbol))
+        object.__setattr__(self, "callables", tuple(self.callables))
+        object.__setattr__(self, "so_sha256", hash_shared_library(path))
+
+    def descriptor(self) -> bytes:
+        return build_native_orch_descriptor(self.so_sha256, self.symbol)
+
+    def load(self) -> _CompiledOrchFunction:
+        if hash_shared_library(self.path) != self.so_sha256:
+            raise RuntimeError(f"HASHID_DESCRIPTOR_MISMATCH: {self.path} changed since CompiledOrchestration was built")
+        return _CompiledOrchFunction(self.path, self.symbol)
+
+
 @dataclass(frozen=True)
 class RemoteWorkerSpec:
     endpoint: str
@@ -458,6 +560,21 @@ def _build_callable_registration(worker: Worker, target, *, workers: list[int] |
             payload=target.target.encode("utf-8"),
             eligible_worker_ids=worker_ids,
         )
+    if isinstance(target, NativeSubCallable):
+        if workers is not None:
+            raise TypeError("Worker.register: workers= is only supported for RemoteCallable")
+        descriptor = target.descriptor()
+        hashid = compute_callable_hashid(descriptor)
+        return _CallableRegistration(
+            target=target,
+            kind="NATIVE_SO",
+            target_namespace="LOCAL_PYTHON",
+            descriptor=descriptor,
+            hashid=hashid,
+            digest=hashid_to_digest(hashid),
+            payload_digest=descriptor,
+            payload=target.payload(),
+        )
     if isinstance(target, ChipCallable):
         if workers is not None:
             raise TypeError("Worker.register: workers= is only supported for RemoteCallable")
@@ -600,6 +717,16 @@ def _read_control_digest(buf) -> bytes:
     return bytes(buf[_OFF_CONTROL_CALLABLE_HASH : _OFF_CONTROL_CALLABLE_HASH + CALLABLE_HASH_DIGEST_BYTES])
 
 
+def _read_control_shm_name(buf) -> str:
+    raw = bytes(buf[_OFF_ARGS : _OFF_ARGS + _CTRL_SHM_NAME_BYTES])
+    nul = raw.find(b"\x00")
+    return raw[: nul if nul >= 0 else _CTRL_SHM_NAME_BYTES].decode("utf-8", "replace")
+
+
+def _is_digest_only_register(buf) -> bool:
+    return struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0] == 0 and buf[_OFF_ARGS] == 0
+
+
 def _read_task_digest(buf) -> bytes:
     return bytes(buf[_OFF_TASK_CALLABLE_HASH : _OFF_TASK_CALLABLE_HASH + CALLABLE_HASH_DIGEST_BYTES])
 
@@ -651,6 +778,24 @@ def _handle_py_callable_control(
             digest,
             _load_py_import_target(target),
         )
+    elif sub_cmd == _CTRL_NATIVE_SO_REGISTER:
+        shm_name = _read_shm_name(buf, _OFF_ARGS)
+        payload_size = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
+        path, symbol = _parse_native_sub_payload(_read_raw_payload_from_shm(shm_name, int(payload_size)))
+        # Re-hash here: the library is loaded from the path, and the path may
+        # no longer hold the bytes the parent hashed.
+        descriptor = build_native_so_descriptor(hash_shared_library(path), symbol)
+        _validate_descriptor_digest(expected=digest, descriptor=descriptor, context=f"{context} native callable")
+        if digest in identity_table:
+            identity_refs[digest] = identity_refs.get(digest, 1) + 1
+            return
+        _install_local_identity(
+            registry,
+            identity_table,
+            identity_refs,
+            digest,
+            _NativeSubFunction(path, symbol),
+        )
     elif sub_cmd == _CTRL_PY_UNREGISTER:
         _remove_local_identity(registry, identity_table, identity_refs, digest)
     else:
@@ -736,8 +881,13 @@ def _sub_worker_loop(
     ``error=1`` and ``f"sub_worker: <ExcType>: <msg>"`` into the mailbox
     error-message region; the parent's ``WorkerThread::dispatch_process``
     rethrows it as ``std::runtime_error``.
+
+    NATIVE_SO callables skip the TaskArgs decode: the C symbol runs directly
+    over the mailbox blob. Ones inherited through the fork snapshot are
+    still ``NativeSubCallable`` descriptors and are loaded on first use.
     """
     state_addr = _buffer_field_addr(buf, _OFF_STATE)
+    blob_addr = _buffer_field_addr(buf, _OFF_TASK_ARGS_BLOB)
     while True:
         state = _mailbox_load_i32(state_addr)
         if state == _TASK_READY:
@@ -751,8 +901,12 @@ def _sub_worker_loop(
                 msg = f"sub_worker: callable hash {_format_digest(digest)} not registered"
             else:
                 try:
-                    args = _read_args_from_mailbox(buf)
-                    fn(args)
+                    if isinstance(fn, NativeSubCallable):
+                        fn = registry[int(cid)] = fn.load()
+                    if isinstance(fn, _NativeSubFunction):
+                        fn.run_blob(blob_addr, _MAILBOX_ARGS_CAPACITY)
+                    else:
+                        fn(_read_args_from_mailbox(buf))
                 except Exception as e:  # noqa: BLE001
                     code = 1
                     msg = _format_exc("sub_worker", e)
@@ -929,6 +1083,128 @@ def _ensure_prepared(cw, registry, prepared, cid: int, *, lazy: bool, device_id:
     prepared.add(cid)
 
 
+def _handle_chip_control(  # noqa: PLR0912, PLR0913 -- one branch per control sub-command
+    cw: ChipWorker,
+    buf: memoryview,
+    sub_cmd: int,
+    device_id: int,
+    registry: dict[int, Any],
+    identity_table: dict[bytes, int],
+    identity_refs: dict[bytes, int],
+    prepared: set[int],
+    *,
+    chip_platform: str = "",
+    chip_runtime: str = "",
+) -> tuple[int, str]:
+    """Serve one CONTROL_REQUEST on a chip child; returns ``(code, msg)``.
+
+    Shared by the Python loop and the native ``_ChipChildLoop`` (which
+    serves MALLOC / FREE / COPY_* itself and only calls in here for the
+    rest).
+    """
+    try:
+        if sub_cmd == _CTRL_MALLOC:
+            size = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
+            ptr = cw.malloc(size)
+            struct.pack_into("Q", buf, _CTRL_OFF_RESULT, ptr)
+        elif sub_cmd == _CTRL_FREE:
+            ptr = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
+            cw.free(ptr)
+        elif sub_cmd == _CTRL_COPY_TO:
+            dst = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
+            src = struct.unpack_from("Q", buf, _CTRL_OFF_ARG1)[0]
+            n = struct.unpack_from("Q", buf, _CTRL_OFF_ARG2)[0]
+            cw.copy_to(dst, src, n)
+        elif sub_cmd == _CTRL_COPY_FROM:
+            dst = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
+            src = struct.unpack_from("Q", buf, _CTRL_OFF_ARG1)[0]
+            n = struct.unpack_from("Q", buf, _CTRL_OFF_ARG2)[0]
+            cw.copy_from(dst, src, n)
+        elif sub_cmd in (_CTRL_COPY_TO_ASYNC, _CTRL_COPY_FROM_ASYNC):
+            dst = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
+            src = struct.unpack_from("Q", buf, _CTRL_OFF_ARG1)[0]
+            n = struct.unpack_from("Q", buf, _CTRL_OFF_ARG2)[0]
+            start = cw.copy_to_async if sub_cmd == _CTRL_COPY_TO_ASYNC else cw.copy_from_async
+            struct.pack_into("Q", buf, _CTRL_OFF_RESULT, start(dst, src, n))
+        elif sub_cmd == _CTRL_COPY_QUERY:
+            token = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
+            struct.pack_into("Q", buf, _CTRL_OFF_RESULT, 1 if cw.copy_done(token) else 0)
+        elif sub_cmd == _CTRL_PREPARE:
+            digest = _read_control_digest(buf)
+            cid = identity_table.get(digest)
+            if cid is None:
+                raise RuntimeError(f"prepare chip={device_id}: callable hash {_format_digest(digest)} not registered")
+            _ensure_prepared(cw, registry, prepared, int(cid), lazy=False, device_id=device_id)
+        elif sub_cmd == _CTRL_REGISTER and _is_digest_only_register(buf):
+            digest = _read_control_digest(buf)
+            if digest in identity_table:
+                identity_refs[digest] = identity_refs.get(digest, 1) + 1
+                struct.pack_into("Q", buf, _CTRL_OFF_RESULT, _CTRL_REGISTER_HELD)
+        elif sub_cmd == _CTRL_REGISTER:
+            digest = _read_control_digest(buf)
+            payload_size = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
+            shm = SharedMemory(name=_read_control_shm_name(buf))
+            shm_buf = shm.buf
+            assert shm_buf is not None
+            try:
+                if payload_size <= 0 or payload_size > shm.size:
+                    raise RuntimeError(f"CTRL_REGISTER payload size mismatch: payload={payload_size}, shm={shm.size}")
+                callable_obj = ChipCallable.from_bytes(bytes(shm_buf[:payload_size]))
+                _validate_chip_payload_digest(
+                    callable_obj,
+                    digest,
+                    platform=chip_platform,
+                    runtime=chip_runtime,
+                    context=f"chip_process dev={device_id}",
+                )
+                if digest in identity_table:
+                    identity_refs[digest] = identity_refs.get(digest, 1) + 1
+                else:
+                    cid = _install_local_identity(registry, identity_table, identity_refs, digest, callable_obj)
+                    # Self-heal when a prior unregister popped the local
+                    # identity table but failed before clearing device
+                    # prepared state for the reusable private slot.
+                    if int(cid) in prepared:
+                        try:
+                            cw._unregister_slot(int(cid))
+                        except Exception:  # noqa: BLE001
+                            pass
+                        prepared.discard(int(cid))
+                    exported = ctypes.c_char.from_buffer(shm_buf)
+                    try:
+                        addr = ctypes.addressof(exported)
+                        cw._impl.prepare_callable_from_blob(int(cid), addr)
+                    finally:
+                        del exported
+                    prepared.add(int(cid))
+            finally:
+                shm_buf.release()
+                # Release the local mmap as soon as prepare returns;
+                # prepare_callable has already H2D-copied the bytes to
+                # device GM, so the child no longer needs the shm.
+                shm.close()
+        elif sub_cmd == _CTRL_UNREGISTER:
+            digest = _read_control_digest(buf)
+            cid, removed = _remove_local_identity(registry, identity_table, identity_refs, digest)
+            if removed and cid is not None:
+                cw._unregister_slot(int(cid))
+                prepared.discard(int(cid))
+        elif sub_cmd == _CTRL_ALLOC_DOMAIN:
+            _handle_ctrl_alloc_domain(cw, buf)
+        elif sub_cmd == _CTRL_RELEASE_DOMAIN:
+            _handle_ctrl_release_domain(cw, buf)
+        elif sub_cmd == _CTRL_COMM_INIT:
+            _handle_ctrl_comm_init(cw, buf)
+        else:
+            raise RuntimeError(f"unknown control sub-command {int(sub_cmd)}")
+    except Exception as e:  # noqa: BLE001
+        if sub_cmd in (_CTRL_REGISTER, _CTRL_UNREGISTER):
+            op = "register" if sub_cmd == _CTRL_REGISTER else "unregister"
+            return 1, _format_exc(f"{op} hash={_format_digest(_read_control_digest(buf))} chip={device_id}", e)
+        return 1, _format_exc(f"chip_process dev={device_id} ctrl={int(sub_cmd)}", e)
+    return 0, ""
+
+
 def _run_chip_main_loop(  # noqa: PLR0912, PLR0913, PLR0915 -- unified TASK_READY / CONTROL_REQUEST state machine
     cw: ChipWorker,
     buf: memoryview,
@@ -943,7 +1219,11 @@ def _run_chip_main_loop(  # noqa: PLR0912, PLR0913, PLR0915 -- unified TASK_READ
     chip_runtime: str = "",
     on_task_done_success=None,
 ) -> None:
-    """Unified TASK_READY / CONTROL_REQUEST / SHUTDOWN state machine.
+    """Unified TASK_READY / CONTROL_REQUEST / SHUTDOWN state machine (Python).
+
+    Chip children run the native ``_run_chip_native_loop``; this loop is the
+    reference implementation, driven directly by the white-box tests with a
+    mocked ``ChipWorker``.
 
     `on_task_done_success`, if provided, is invoked after a successful
     ``run_prepared_from_blob`` and before publishing TASK_DONE. It must
@@ -993,109 +1273,81 @@ def _run_chip_main_loop(  # noqa: PLR0912, PLR0913, PLR0915 -- unified TASK_READ
             _mailbox_store_i32(state_addr, _TASK_DONE)
         elif state == _CONTROL_REQUEST:
             sub_cmd = struct.unpack_from("Q", buf, _OFF_CALLABLE)[0]
-            code = 0
-            msg = ""
-            try:
-                if sub_cmd == _CTRL_MALLOC:
-                    size = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
-                    ptr = cw.malloc(size)
-                    struct.pack_into("Q", buf, _CTRL_OFF_RESULT, ptr)
-                elif sub_cmd == _CTRL_FREE:
-                    ptr = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
-                    cw.free(ptr)
-                elif sub_cmd == _CTRL_COPY_TO:
-                    dst = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
-                    src = struct.unpack_from("Q", buf, _CTRL_OFF_ARG1)[0]
-                    n = struct.unpack_from("Q", buf, _CTRL_OFF_ARG2)[0]
-                    cw.copy_to(dst, src, n)
-                elif sub_cmd == _CTRL_COPY_FROM:
-                    dst = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
-                    src = struct.unpack_from("Q", buf, _CTRL_OFF_ARG1)[0]
-                    n = struct.unpack_from("Q", buf, _CTRL_OFF_ARG2)[0]
-                    cw.copy_from(dst, src, n)
-                elif sub_cmd == _CTRL_PREPARE:
-                    digest = _read_control_digest(buf)
-                    cid = identity_table.get(digest)
-                    if cid is None:
-                        raise RuntimeError(
-                            f"prepare chip={device_id}: callable hash {_format_digest(digest)} not registered"
-                        )
-                    _ensure_prepared(cw, registry, prepared, int(cid), lazy=False, device_id=device_id)
-                elif sub_cmd == _CTRL_REGISTER:
-                    digest = _read_control_digest(buf)
-                    payload_size = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
-                    raw = bytes(buf[_OFF_ARGS : _OFF_ARGS + _CTRL_SHM_NAME_BYTES])
-                    nul = raw.find(b"\x00")
-                    shm_name = raw[: nul if nul >= 0 else _CTRL_SHM_NAME_BYTES].decode("utf-8", "replace")
-                    shm = SharedMemory(name=shm_name)
-                    shm_buf = shm.buf
-                    assert shm_buf is not None
-                    try:
-                        if payload_size <= 0 or payload_size > shm.size:
-                            raise RuntimeError(
-                                f"CTRL_REGISTER payload size mismatch: payload={payload_size}, shm={shm.size}"
-                            )
-                        callable_obj = ChipCallable.from_bytes(bytes(shm_buf[:payload_size]))
-                        _validate_chip_payload_digest(
-                            callable_obj,
-                            digest,
-                            platform=chip_platform,
-                            runtime=chip_runtime,
-                            context=f"chip_process dev={device_id}",
-                        )
-                        if digest in identity_table:
-                            identity_refs[digest] = identity_refs.get(digest, 1) + 1
-                        else:
-                            cid = _install_local_identity(registry, identity_table, identity_refs, digest, callable_obj)
-                            # Self-heal when a prior unregister popped the local
-                            # identity table but failed before clearing device
-                            # prepared state for the reusable private slot.
-                            if int(cid) in prepared:
-                                try:
-                                    cw._unregister_slot(int(cid))
-                                except Exception:  # noqa: BLE001
-                                    pass
-                                prepared.discard(int(cid))
-                            exported = ctypes.c_char.from_buffer(shm_buf)
-                            try:
-                                addr = ctypes.addressof(exported)
-                                cw._impl.prepare_callable_from_blob(int(cid), addr)
-                            finally:
-                                del exported
-                            prepared.add(int(cid))
-                    finally:
-                        shm_buf.release()
-                        # Release the local mmap as soon as prepare returns;
-                        # prepare_callable has already H2D-copied the bytes to
-                        # device GM, so the child no longer needs the shm.
-                        shm.close()
-                elif sub_cmd == _CTRL_UNREGISTER:
-                    digest = _read_control_digest(buf)
-                    cid, removed = _remove_local_identity(registry, identity_table, identity_refs, digest)
-                    if removed and cid is not None:
-                        cw._unregister_slot(int(cid))
-                        prepared.discard(int(cid))
-                elif sub_cmd == _CTRL_ALLOC_DOMAIN:
-                    _handle_ctrl_alloc_domain(cw, buf)
-                elif sub_cmd == _CTRL_RELEASE_DOMAIN:
-                    _handle_ctrl_release_domain(cw, buf)
-                elif sub_cmd == _CTRL_COMM_INIT:
-                    _handle_ctrl_comm_init(cw, buf)
-                else:
-                    raise RuntimeError(f"unknown control sub-command {int(sub_cmd)}")
-            except Exception as e:  # noqa: BLE001
-                code = 1
-                if sub_cmd in (_CTRL_REGISTER, _CTRL_UNREGISTER):
-                    op = "register" if sub_cmd == _CTRL_REGISTER else "unregister"
-                    msg = _format_exc(f"{op} hash={_format_digest(_read_control_digest(buf))} chip={device_id}", e)
-                else:
-                    msg = _format_exc(f"chip_process dev={device_id} ctrl={int(sub_cmd)}", e)
+            code, msg = _handle_chip_control(
+                cw,
+                buf,
+                int(sub_cmd),
+                device_id,
+                registry,
+                identity_table,
+                identity_refs,
+                prepared,
+                chip_platform=chip_platform,
+                chip_runtime=chip_runtime,
+            )
             _write_error(buf, code, msg)
             _mailbox_store_i32(state_addr, _CONTROL_DONE)
         elif state == _SHUTDOWN:
             break
 
 
+def _run_chip_native_loop(
+    cw: ChipWorker,
+    buf: memoryview,
+    mailbox_addr: int,
+    device_id: int,
+    registry: dict[int, Any],
+    identity_table: dict[bytes, int],
+    identity_refs: dict[bytes, int],
+    *,
+    chip_platform: str = "",
+    chip_runtime: str = "",
+    on_task_done_success=None,
+) -> None:
+    """Serve the chip mailbox from C++ (``_ChipChildLoop``) until SHUTDOWN.
+
+    Same protocol and error strings as ``_run_chip_main_loop``, but the poll
+    loop, digest lookup, config decode, run and MALLOC / FREE / COPY_* stay in
+    C++ with the GIL released, and idle polling backs off from spin to yield
+    to a short sleep instead of pinning a host core per chip. Python is only
+    entered for the remaining control sub-commands, for a lazy prepare when
+    prewarm was missed, and for ``on_task_done_success``.
+
+    The C++ digest table mirrors ``identity_table``; every Python-served
+    control re-syncs it, which is cheap because controls are rare.
+    """
+    prepared: set[int] = set()
+    loop = _ChipChildLoop(cw._impl, mailbox_addr, device_id)
+
+    def sync() -> None:
+        loop.clear()
+        for digest, cid in identity_table.items():
+            loop.bind(digest, int(cid), int(cid) in prepared)
+
+    def on_control(sub_cmd: int) -> tuple[int, str]:
+        try:
+            return _handle_chip_control(
+                cw,
+                buf,
+                sub_cmd,
+                device_id,
+                registry,
+                identity_table,
+                identity_refs,
+                prepared,
+                chip_platform=chip_platform,
+                chip_runtime=chip_runtime,
+            )
+        finally:
+            sync()
+
+    def on_prepare(cid: int) -> None:
+        _ensure_prepared(cw, registry, prepared, cid, lazy=True, device_id=device_id)
+
+    sync()
+    loop.run(on_control, on_prepare, on_task_done_success)
+
+
 def _chip_process_loop(
     buf: memoryview,
     bins,
@@ -1114,8 +1366,9 @@ def _chip_process_loop(
     (computed via `_log.get_current_config()`); the child cannot read the
     parent's logger after fork, so the values are passed explicitly.
 
-    The main loop is delegated to ``_run_chip_main_loop`` — see its docstring
-    for the TASK_READY / CONTROL_REQUEST / SHUTDOWN state machine.
+    The main loop is delegated to ``_run_chip_native_loop`` — see
+    ``_run_chip_main_loop`` for the TASK_READY / CONTROL_REQUEST / SHUTDOWN
+    state machine it implements.
     """
     import traceback as _tb  # noqa: PLC0415
 
@@ -1142,11 +1395,10 @@ def _chip_process_loop(
     sys.stderr.flush()
 
     try:
-        _run_chip_main_loop(
+        _run_chip_native_loop(
             cw,
             buf,
             mailbox_addr,
-            state_addr,
             device_id,
             registry,
             identity_table,
@@ -1236,30 +1488,42 @@ def _child_worker_loop(
                 if sub_cmd == _CTRL_REGISTER:
                     digest = _read_control_digest(buf)
                     payload_size = struct.unpack_from("Q", buf, _CTRL_OFF_ARG0)[0]
-                    raw = bytes(buf[_OFF_ARGS : _OFF_ARGS + _CTRL_SHM_NAME_BYTES])
-                    nul = raw.find(b"\x00")
-                    shm_name = raw[: nul if nul >= 0 else _CTRL_SHM_NAME_BYTES].decode("utf-8", "replace")
-                    callable_obj = _read_chip_callable_from_shm(shm_name, int(payload_size))
-                    inner_registered = False
-                    try:
-                        inner_worker._register_child_chip(callable_obj, digest=digest)
-                        inner_registered = True
-                        _install_local_identity(
-                            registry,
-                            identity_table,
-                            identity_refs,
-                            digest,
-                            callable_obj,
-                        )
-                    except Exception:
-                        if inner_registered:
-                            inner_worker._unregister_child_digest(digest=digest)
-                        raise
+                    digest_only = _is_digest_only_register(buf)
+                    if digest_only:
+                        # Not held here: callable_obj stays None and the
+                        # result stays 0, so the parent resends the blob.
+                        cid = identity_table.get(digest)
+                        callable_obj = registry.get(int(cid)) if cid is not None else None
+                    else:
+                        callable_obj = _read_chip_callable_from_shm(_read_control_shm_name(buf), int(payload_size))
+                    if callable_obj is not None:
+                        inner_registered = False
+                        try:
+                            inner_worker._register_child_chip(callable_obj, digest=digest)
+                            inner_registered = True
+                            _install_local_identity(
+                                registry,
+                                identity_table,
+                                identity_refs,
+                                digest,
+                                callable_obj,
+                            )
+                        except Exception:
+                            if inner_registered:
+                                inner_worker._unregister_child_digest(digest=digest)
+                            raise
+                        if digest_only:
+                            struct.pack_into("Q", buf, _CTRL_OFF_RESULT, _CTRL_REGISTER_HELD)
                 elif sub_cmd == _CTRL_UNREGISTER:
                     digest = _read_control_digest(buf)
                     inner_worker._unregister_child_digest(digest=digest)
                     _remove_local_identity(registry, identity_table, identity_refs, digest)
-                elif sub_cmd in (_CTRL_PY_REGISTER, _CTRL_PY_IMPORT_REGISTER, _CTRL_PY_UNREGISTER):
+                elif sub_cmd in (
+                    _CTRL_PY_REGISTER,
+                    _CTRL_PY_IMPORT_REGISTER,
+                    _CTRL_NATIVE_SO_REGISTER,
+                    _CTRL_PY_UNREGISTER,
+                ):
                     _handle_py_callable_control(
                         buf,
                         registry,
@@ -1280,7 +1544,7 @@ def _child_worker_loop(
                         if sub_cmd == _CTRL_UNREGISTER
                         else (
                             "py_register"
-                            if sub_cmd in (_CTRL_PY_REGISTER, _CTRL_PY_IMPORT_REGISTER)
+                            if sub_cmd in (_CTRL_PY_REGISTER, _CTRL_PY_IMPORT_REGISTER, _CTRL_NATIVE_SO_REGISTER)
                             else ("py_unregister" if sub_cmd == _CTRL_PY_UNREGISTER else f"ctrl={int(sub_cmd)}")
                         )
                     )
@@ -1333,6 +1597,12 @@ class Worker:
         self._pending_unregister_cids: set[int] = set()
         self._pending_remote_unregister_hashids: set[bytes] = set()
         self._py_control_timeout_s = float(config.get("py_control_timeout_s", _PY_CONTROL_TIMEOUT_S))
+        # "process": SUB workers are forked children behind a mailbox.
+        # "thread": SUB workers are in-process endpoints that only run
+        # NativeSubCallable targets, on the parent's own worker threads.
+        self._sub_mode = str(config.get("sub_mode", "process"))
+        if self._sub_mode not in ("process", "thread"):
+            raise ValueError(f"Worker: sub_mode must be 'process' or 'thread', got {self._sub_mode!r}")
         self._hierarchical_start_state = "not_started"
         self._hierarchical_start_mu = threading.Lock()
         self._hierarchical_start_cv = threading.Condition(self._hierarchical_start_mu)
@@ -1365,6 +1635,8 @@ class Worker:
         # among live handles).  ``orch.allocate_domain`` adds entries here;
         # ``release()`` removes them and queues a deferred backend free.
         self._live_domains: dict[str, CommDomainHandle] = {}
+        # CompiledOrchestration entries by hashid: dlopen once, run many.
+        self._compiled_orch_cache: dict[str, _CompiledOrchFunction] = {}
         # Handles whose `release()` has been called inside an orch function.
         # The backend free is deferred until after Worker.run.drain() so that
         # tasks already submitted with this domain's device_ctx / buffer_ptrs
@@ -2093,7 +2365,7 @@ class Worker:
         try:
             results = self._broadcast_py_control_results(
                 worker_types,
-                _CTRL_PY_REGISTER,
+                _CTRL_NATIVE_SO_REGISTER if reg.kind == "NATIVE_SO" else _CTRL_PY_REGISTER,
                 digest=handle.digest,
                 payload=reg.payload,
             )
@@ -2305,6 +2577,18 @@ class Worker:
             "unregister unused callables before registering more"
         )
 
+    def _held_chip_callable(self, digest: bytes) -> ChipCallable | None:
+        """The ChipCallable this Worker already holds under ``digest``, if any.
+
+        Lets a digest-only re-register (no blob re-upload) reuse the bytes
+        installed by an earlier register.
+        """
+        with self._registry_lock:
+            state = self._identity_registry.get(digest)
+            if state is None or state.kind != "CHIP_CALLABLE" or state.slot_id in self._pending_unregister_cids:
+                return None
+            return state.target
+
     def _register_child_chip(  # noqa: PLR0912
         self, target: ChipCallable, *, digest: bytes, publish_handle: bool = False
     ) -> CallableHandle | None:
@@ -2462,7 +2746,11 @@ class Worker:
             return
         assert self._worker is not None
         try:
-            results = self._worker.broadcast_register_all(int(target.buffer_ptr()), int(target.buffer_size()), digest)
+            # A repeat register of a digest the children already hold goes
+            # digest-only; the blob is staged only for a child that lost it.
+            results = self._worker.broadcast_register_all(
+                int(target.buffer_ptr()), int(target.buffer_size()), digest, probe_held=not is_new
+            )
         except Exception:
             cleanup_errors = self._cleanup_chip_registration(digest) if is_new else []
             if cleanup_errors:
@@ -2840,7 +3128,8 @@ class Worker:
             raise RuntimeError("Worker level >= 4 must use add_worker(); device_ids are only supported on L3 Workers")
 
         # 1. Allocate sub-worker mailboxes (unified layout, MAILBOX_SIZE each).
-        for _ in range(n_sub):
+        #    In-process SUB workers (sub_mode="thread") have none.
+        for _ in range(n_sub if self._sub_mode == "process" else 0):
             shm = SharedMemory(create=True, size=MAILBOX_SIZE)
             assert shm.buf is not None
             _mailbox_store_i32(_buffer_field_addr(shm.buf, _OFF_STATE), _IDLE)
@@ -2940,14 +3229,14 @@ class Worker:
                 self._hierarchical_start_cv.notify_all()
 
             # Fork SubWorker processes (MUST be before any C++ threads)
-            for i in range(n_sub):
+            for i in range(len(self._sub_shms)):
                 pid = os.fork()
                 if pid == 0:
                     buf = self._sub_shms[i].buf
                     assert buf is not None
                     registry, identity_table, identity_refs = _make_local_identity_tables(
                         identity_snapshot,
-                        callable_kind=("PYTHON_SERIALIZED", "PYTHON_IMPORT"),
+                        callable_kind=("PYTHON_SERIALIZED", "PYTHON_IMPORT", "NATIVE_SO"),
                         target_namespace="LOCAL_PYTHON",
                     )
                     _sub_worker_loop(buf, registry, identity_table, identity_refs)
@@ -3015,7 +3304,7 @@ class Worker:
                     inner_worker.init()
                     registry, identity_table, identity_refs = _make_local_identity_tables(
                         identity_snapshot,
-                        callable_kind=("PYTHON_SERIALIZED", "PYTHON_IMPORT"),
+                        callable_kind=("PYTHON_SERIALIZED", "PYTHON_IMPORT", "NATIVE_SO"),
                         target_namespace="LOCAL_PYTHON",
                     )
                     _child_worker_loop(buf, registry, identity_table, identity_refs, inner_worker)
@@ -3044,6 +3333,17 @@ class Worker:
             for shm in self._sub_shms:
                 dw.add_sub_worker(_mailbox_addr(shm))
 
+            # In-process SUB workers: each gets its own table seeded with the
+            # NATIVE_SO identities registered so far.
+            if self._sub_mode == "thread" and n_sub > 0:
+                preload = []
+                for digest, target, ref_count, kind, _namespace in identity_snapshot:
+                    if kind == "NATIVE_SO":
+                        target.verify()
+                        preload.append((digest, target.path, target.symbol, max(int(ref_count), 1)))
+                for _ in range(n_sub):
+                    dw.add_native_sub_worker(preload)
+
             # Start Scheduler + WorkerThreads (C++ threads start here, after fork)
             dw.init()
 
@@ -3594,7 +3894,8 @@ class Worker:
             ``Worker.register(chip_callable)``. Routes to the private slot
             carried by the handle.
           - L3+: ``callable`` is a Python orch fn invoked with the
-            ``Orchestrator`` handle.
+            ``Orchestrator`` handle, or a :class:`CompiledOrchestration`
+            whose C++ entry builds the DAG without calling back into Python.
 
         ``args``  : TaskArgs (optional)
         ``config``: CallConfig (optional, default-constructed if None)
@@ -3617,6 +3918,8 @@ class Worker:
         self._start_hierarchical()
         assert self._orch is not None
         assert self._worker is not None
+        if isinstance(callable, CompiledOrchestration):
+            callable = self._bind_compiled_orchestration(callable)
         # Drop any error stashed by a previous run() so this call starts
         # clean. drain() rethrows on the way out; every successful run()
         # leaves the error slot empty, but an unrelated caller may have
@@ -3658,6 +3961,27 @@ class Worker:
         # individual run calls.
         return RunTiming(time.perf_counter_ns() - t_start, 0)
 
+    def _bind_compiled_orchestration(self, orch: CompiledOrchestration):
+        """Resolve ``orch`` to an orch fn that runs its cached C++ entry.
+
+        Handles are resolved here, before the run opens its scope, so a stale
+        handle fails without leaving a half-built DAG behind.
+        """
+        hashid = compute_callable_hashid(orch.descriptor())
+        fn = self._compiled_orch_cache.get(hashid)
+        if fn is None:
+            fn = orch.load()
+            self._compiled_orch_cache[hashid] = fn
+        table = []
+        for handle in orch.callables:
+            state = self._resolve_handle(handle)
+            table.append((state.digest, state.kind, state.target_namespace, list(state.eligible_worker_ids)))
+
+        def run_compiled(o: Orchestrator, args, cfg) -> None:
+            fn.run(o._o, args if args is not None else TaskArgs(), cfg, table)
+
+        return run_compiled
+
     @property
     def aicpu_dlopen_count(self) -> int:
         """L2 only: number of distinct callable identities the AICPU has dlopened for.
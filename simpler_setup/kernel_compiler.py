@@ -54,6 +54,11 @@ class KernelCompiler:
     # do. Must match the runtime's install-time SIMPLER_SANITIZER.
     _sanitizers = ""
 
+    # Sim kernel build profile (toolchain.SIM_PROFILES), set once by conftest
+    # from the pytest `--sim-profile` option. Only the Gxx15 sim incore build
+    # honors it; orchestration and device builds are unaffected.
+    _sim_profile = "default"
+
     def __init__(self, platform: str = "a2a3"):
         """
         Initialize KernelCompiler.
@@ -555,7 +560,7 @@ class KernelCompiler:
         )
 
         # Build command from toolchain
-        cmd = [self.gxx15.cxx_path] + self.gxx15.get_compile_flags(core_type=core_type)
+        cmd = [self.gxx15.cxx_path] + self.gxx15.get_compile_flags(core_type=core_type, profile=self._sim_profile)
         cmd += self._sanitizer_flags(self.gxx15)
 
         # Add PTO ISA header paths if provided
@@ -575,7 +580,7 @@ class KernelCompiler:
         cmd.extend(["-o", output_path, source_path])
 
         # Log compilation command
-        logger.info(f"[SimKernel] Compiling: {source_path}")
+        logger.info(f"[SimKernel] Compiling ({self._sim_profile}): {source_path}")
         logger.debug(f"  Command: {' '.join(cmd)}")
 
         return self._compile_to_bytes(
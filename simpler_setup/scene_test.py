@@ -36,6 +36,11 @@ from .pto_isa import ensure_pto_isa_root
 
 logger = logging.getLogger(__name__)
 
+# CallConfig.enable_l2_swimlane packing (mirrors l2_swimlane_profiling.h):
+# low byte is the level, bit 8 asks the runtime to export wired edges.
+L2_SWIMLANE_LEVEL_MASK = 0xFF
+L2_SWIMLANE_EDGES_FLAG = 0x100
+
 _compile_cache: dict[tuple[str, str, str], object] = {}
 
 
@@ -325,6 +330,12 @@ def _temporary_env(env_updates):
                 os.environ[k] = v
 
 
+# Per-case benchmark context, set by run_class_cases while --warmup or
+# --bench-json is active. _log_round_timings / device-log timing read it
+# instead of taking new kwargs, for the same override reason noted there.
+_bench_ctx = None
+
+
 def _log_round_timings(timings):
     """Print per-round + summary host/device wall (µs) for multi-round runs.
 
@@ -340,7 +351,14 @@ def _log_round_timings(timings):
     column reports 0 when the runtime was built without PTO2_PROFILING (the
     default build has it on) or when an L3+ DAG is in use (per-task device
     cycles aren't aggregated).
+
+    Under a bench context the leading warmup rounds are dropped first, the
+    samples are recorded for the JSON report, and median / p90 / p99 with
+    the median's confidence interval are printed after the averages.
     """
+    ctx = _bench_ctx
+    if ctx is not None:
+        timings = timings[ctx["warmup"] :]
     if not timings:
         return
     n = len(timings)
@@ -387,6 +405,15 @@ def _log_round_timings(timings):
         msg += f"  (dropped {trim} low + {trim} high, {tc} rounds used)"
         print(msg)
 
+    if ctx is not None:
+        from .tools.bench_stats import format_summary, summarize  # noqa: PLC0415
+
+        ctx["metrics"]["host_wall_us"] = [t[0] for t in timings]
+        ctx["metrics"]["device_wall_us"] = dev_nonzero
+        for metric in ("host_wall_us", "device_wall_us"):
+            if ctx["metrics"][metric]:
+                print(format_summary(metric, summarize(ctx["metrics"][metric])))
+
 
 def _get_device_log_dir(device_id) -> Path:
     """Return the CANN device log directory for *device_id*.
@@ -422,7 +449,7 @@ def _snapshot_log_offsets(log_dir: Path) -> dict[str, int]:
     return offsets
 
 
-def _print_device_log_timing(device_id, before_time, baseline_offsets, expected_rounds, timeout=20.0):
+def _print_device_log_timing(device_id, before_time, baseline_offsets, expected_rounds, skip=0, timeout=20.0):
     """Read the freshest device log and print per-round Total / Orch / Sched.
 
     Driven by ``--enable-device-log-timing``. The orch/sched ``LOG_INFO_V9``
@@ -438,6 +465,7 @@ def _print_device_log_timing(device_id, before_time, baseline_offsets, expected_
     several files; all files written after ``before_time`` are read in mtime
     order, not just the newest. ``baseline_offsets`` (from ``_snapshot_log_offsets``)
     caps each pre-existing file's read to the bytes appended after the run began.
+    The first ``skip`` (warmup) blocks are dropped; the rest are returned.
     """
     import time  # noqa: PLC0415
 
@@ -448,7 +476,7 @@ def _print_device_log_timing(device_id, before_time, baseline_offsets, expected_
             "device-log timing: ASCEND_SLOG_PRINT_TO_STDOUT=1 routes CANN logs to stdout, not to a "
             "device log file — the orch/sched timing markers are in the run output above, not parseable here."
         )
-        return
+        return []
 
     log_dir = _get_device_log_dir(device_id)
     deadline = time.monotonic() + timeout
@@ -476,7 +504,7 @@ def _print_device_log_timing(device_id, before_time, baseline_offsets, expected_
 
     if not fresh:
         logger.warning("device-log timing: no device log written after run under %s", log_dir)
-        return
+        return []
     if len(rounds) < expected_rounds:
         logger.warning(
             "device-log timing: only %d/%d round blocks flushed within %.0fs (CANN async log lag)",
@@ -484,8 +512,10 @@ def _print_device_log_timing(device_id, before_time, baseline_offsets, expected_
             expected_rounds,
             timeout,
         )
+    rounds = rounds[skip:]
     source = fresh[-1] if len(fresh) == 1 else f"{len(fresh)} files under {log_dir}"
     print(format_device_log_timing(rounds, source=source))
+    return rounds
 
 
 def _resolve_callable_paths(cls, cls_dir):
@@ -720,6 +750,17 @@ def _sanitize_for_filename(s: str) -> str:
     return "".join(c if c.isalnum() or c in "._-" else "_" for c in s)
 
 
+def _sched_phase_metrics(output_prefix: Path) -> dict[str, list[float]]:
+    """Scheduler phase durations from the case's swimlane records, for ``--bench-json``."""
+    perf_file = output_prefix / "l2_swimlane_records.json"
+    if not perf_file.exists():
+        return {}
+    from .tools.bench_stats import sched_phase_samples  # noqa: PLC0415
+    from .tools.swimlane_converter import read_perf_data  # noqa: PLC0415
+
+    return sched_phase_samples(read_perf_data(perf_file))
+
+
 def _convert_case_swimlane(
     case_label: str,
     output_prefix: Path,
@@ -847,13 +888,20 @@ def run_class_cases(  # noqa: PLR0913 -- shared layer-5 entry; kwargs mirror CLI
     enable_scope_stats,
     enable_device_log_timing=False,
     enable_swimlane_overhead=False,
+    warmup=0,
+    bench_json=None,
 ):
     """Execute a pre-filtered list of cases for one class (layers 5-6).
 
     Caller is responsible for platform/selector/manual filtering. Profiling
     snapshots wrap each case. Validation failures propagate; caller decides
     fail-fast vs collect semantics.
+
+    ``warmup`` extra rounds run ahead of the ``rounds`` measured ones and are
+    left out of every statistic. With ``bench_json`` set, each passing case's
+    samples are summarised into that report (see ``tools/bench_stats.py``).
     """
+    global _bench_ctx  # noqa: PLW0603
     cls_name = type(cls_inst).__name__
     callable_spec = getattr(type(cls_inst), "CALLABLE", None)
     diagnostics_on = enable_l2_swimlane or enable_dump_args or enable_pmu or enable_dep_gen or enable_scope_stats
@@ -880,13 +928,14 @@ def run_class_cases(  # noqa: PLR0913 -- shared layer-5 entry; kwargs mirror CLI
         prefix = _build_output_prefix(case_label) if diagnostics_on else Path("")
         dlt_baseline = _snapshot_time() if dlt_on else None
         dlt_offsets = _snapshot_log_offsets(_get_device_log_dir(dlt_device_id)) if dlt_on else None
+        bench = _bench_ctx = {"warmup": warmup, "metrics": {}} if (warmup or bench_json) else None
         try:
             cls_inst._run_and_validate(
                 worker,
                 callable_obj,
                 case,
                 sub_handles=sub_handles,
-                rounds=rounds,
+                rounds=rounds + warmup,
                 skip_golden=skip_golden,
                 enable_l2_swimlane=enable_l2_swimlane,
                 enable_dump_args=enable_dump_args,
@@ -903,12 +952,26 @@ def run_class_cases(  # noqa: PLR0913 -- shared layer-5 entry; kwargs mirror CLI
                     callable_spec=callable_spec,
                     enable_overhead=enable_swimlane_overhead,
                 )
+                if bench is not None and (enable_l2_swimlane & L2_SWIMLANE_LEVEL_MASK) >= 3:
+                    bench["metrics"].update(_sched_phase_metrics(prefix))
             if enable_dep_gen:
                 _graph_case_dep_gen(case_label, prefix, callable_spec=callable_spec)
             if enable_scope_stats:
                 _plot_case_scope_stats(case_label, prefix)
+            _bench_ctx = None
             if dlt_baseline is not None:
-                _print_device_log_timing(dlt_device_id, dlt_baseline, dlt_offsets, rounds)
+                dlt_rounds = _print_device_log_timing(
+                    dlt_device_id, dlt_baseline, dlt_offsets, rounds + warmup, skip=warmup
+                )
+                if bench is not None:
+                    bench["metrics"]["dlt_total_us"] = [r.total_us for r in dlt_rounds]
+                    bench["metrics"]["dlt_orch_us"] = [r.orch_us for r in dlt_rounds]
+                    bench["metrics"]["dlt_sched_us"] = [r.sched_us for r in dlt_rounds]
+        if bench_json and bench["metrics"]:
+            from .tools.bench_stats import merge_into_file  # noqa: PLC0415
+
+            meta = {"platform": worker._config.get("platform", ""), "rounds": rounds, "warmup": warmup}
+            merge_into_file(bench_json, f"{cls_name}::{case['name']}", bench["metrics"], meta)
 
 
 def _compare_outputs(test_args, golden_args, output_names, rtol, atol):
@@ -1370,7 +1433,9 @@ class SceneTestCase:
         ``super().test_run()`` already warned."""
         if not request.config.getoption("--enable-dep-gen", default=False):
             return False
-        if request.config.getoption("--rounds", default=1) > 1:
+        multi_round = request.config.getoption("--rounds", default=1)
+        multi_round += request.config.getoption("--warmup", default=0)
+        if multi_round > 1:
             if warn:
                 logger.warning("dep_gen disabled: --rounds > 1")
             return False
@@ -1382,8 +1447,12 @@ class SceneTestCase:
         selectors = [_parse_case_selector(v) for v in raw_selectors]
         manual_mode = request.config.getoption("--manual", default="exclude")
         rounds = request.config.getoption("--rounds", default=1)
+        warmup = request.config.getoption("--warmup", default=0)
+        bench_json = request.config.getoption("--bench-json", default=None)
         skip_golden = request.config.getoption("--skip-golden", default=False)
         enable_l2_swimlane = request.config.getoption("--enable-l2-swimlane", default=0)
+        if request.config.getoption("--enable-l2-edges", default=False):
+            enable_l2_swimlane |= L2_SWIMLANE_EDGES_FLAG
         enable_dump_args = request.config.getoption("--dump-args", default=0)
         enable_pmu = request.config.getoption("--enable-pmu", default=0)
         enable_dep_gen = self._effective_enable_dep_gen(request, warn=True)
@@ -1392,7 +1461,8 @@ class SceneTestCase:
         # so unlike the heavy diagnostics it is NOT disabled when --rounds > 1.
         enable_device_log_timing = request.config.getoption("--enable-device-log-timing", default=False)
         enable_swimlane_overhead = request.config.getoption("--enable-swimlane-overhead", default=False)
-        if rounds > 1:
+        # Warmup rounds are real rounds to the runtime, so they count here.
+        if rounds + warmup > 1:
             if enable_l2_swimlane:
                 logger.warning("Profiling disabled: --rounds > 1")
                 enable_l2_swimlane = 0
@@ -1448,6 +1518,8 @@ class SceneTestCase:
             enable_scope_stats=enable_scope_stats,
             enable_device_log_timing=enable_device_log_timing,
             enable_swimlane_overhead=enable_swimlane_overhead,
+            warmup=warmup,
+            bench_json=bench_json,
         )
 
     # ------------------------------------------------------------------
@@ -1484,6 +1556,12 @@ class SceneTestCase:
                 "the runtime preloaded, e.g. LD_PRELOAD=$(g++ -print-file-name=libasan.so)."
             ),
         )
+        parser.add_argument(
+            "--sim-profile",
+            choices=["default", "fast"],
+            default="default",
+            help="Sim kernel build profile; 'fast' = -O3 -march=native -funroll-loops (fp results unchanged)",
+        )
         parser.add_argument(
             "--case",
             action="append",
@@ -1497,6 +1575,16 @@ class SceneTestCase:
             help="Manual case handling: exclude (default), include, only",
         )
         parser.add_argument("--rounds", type=int, default=1, help="Run each case N times (default: 1)")
+        parser.add_argument(
+            "--warmup", type=int, default=0, help="Extra untimed rounds ahead of --rounds (default: 0)"
+        )
+        parser.add_argument(
+            "--bench-json",
+            default=None,
+            metavar="PATH",
+            help="Merge per-case median/p90/p99 + CI of the measured rounds into PATH "
+            "(compare with python -m simpler_setup.tools.bench_stats compare)",
+        )
         parser.add_argument("--skip-golden", action="store_true", help="Skip golden comparison (benchmark mode)")
         parser.add_argument(
             "--enable-l2-swimlane",
@@ -1508,6 +1596,13 @@ class SceneTestCase:
             help="Enable L2 swimlane. Bare flag=level 4 (full). "
             "1=AICore timing, 2=+dispatch/fanout, 3=+sched phases, 4=+orch phases",
         )
+        parser.add_argument(
+            "--enable-l2-edges",
+            action="store_true",
+            help="Also export every wired (producer, consumer) dependency into l2_swimlane_records.json "
+            "(task_edges), so the swimlane tools need no separate --enable-dep-gen run. "
+            "Implies --enable-l2-swimlane 1 when no level is given. tensormap_and_ringbuffer only.",
+        )
         parser.add_argument(
             "--enable-device-log-timing",
             action="store_true",
@@ -1624,6 +1719,11 @@ class SceneTestCase:
                     f"  {_san.preload_command(_san_tokens, args.platform)} python {module_name} ..."
                 )
 
+        if args.sim_profile != "default":
+            from .kernel_compiler import KernelCompiler  # noqa: PLC0415
+
+            KernelCompiler._sim_profile = args.sim_profile
+
         os.environ["PTO_ISA_ROOT"] = ensure_pto_isa_root(
             commit=args.pto_isa_commit,
             clone_protocol=args.clone_protocol,
@@ -1631,13 +1731,16 @@ class SceneTestCase:
             verbose=True,
         )
 
-        if args.rounds > 1 and args.enable_l2_swimlane:
+        if args.enable_l2_edges:
+            args.enable_l2_swimlane |= L2_SWIMLANE_EDGES_FLAG
+        multi_round = args.rounds + args.warmup > 1
+        if multi_round and args.enable_l2_swimlane:
             logger.warning("Profiling disabled: --rounds > 1")
             args.enable_l2_swimlane = 0
-        if args.rounds > 1 and args.enable_dep_gen:
+        if multi_round and args.enable_dep_gen:
             logger.warning("dep_gen disabled: --rounds > 1")
             args.enable_dep_gen = False
-        if args.rounds > 1 and args.enable_scope_stats:
+        if multi_round and args.enable_scope_stats:
             logger.warning("scope_stats disabled: --rounds > 1")
             args.enable_scope_stats = False
 
@@ -1772,6 +1875,8 @@ class SceneTestCase:
                                 enable_scope_stats=args.enable_scope_stats,
                                 enable_device_log_timing=args.enable_device_log_timing,
                                 enable_swimlane_overhead=args.enable_swimlane_overhead,
+                                warmup=args.warmup,
+                                bench_json=args.bench_json,
                             )
                             print("PASSED")
                         except Exception as e:  # noqa: BLE001
@@ -1803,12 +1908,20 @@ def _dispatch_test_phases_standalone(module_name, selected_by_cls, args):  # noq
     common = ["-p", args.platform, "--manual", args.manual, "--log-level", args.log_level]
     if args.sanitizer != "none":
         common += ["--sanitizer", args.sanitizer]
+    if args.sim_profile != "default":
+        common += ["--sim-profile", args.sim_profile]
     if args.rounds != 1:
         common += ["--rounds", str(args.rounds)]
+    if args.warmup:
+        common += ["--warmup", str(args.warmup)]
+    if args.bench_json:
+        common += ["--bench-json", os.path.abspath(args.bench_json)]
     if args.skip_golden:
         common.append("--skip-golden")
-    if args.enable_l2_swimlane:
-        common += ["--enable-l2-swimlane", str(args.enable_l2_swimlane)]
+    if args.enable_l2_swimlane & L2_SWIMLANE_LEVEL_MASK:
+        common += ["--enable-l2-swimlane", str(args.enable_l2_swimlane & L2_SWIMLANE_LEVEL_MASK)]
+    if args.enable_l2_swimlane & L2_SWIMLANE_EDGES_FLAG:
+        common.append("--enable-l2-edges")
     if args.dump_args:
         common += ["--dump-args", str(args.dump_args)]
     if args.enable_dep_gen:
@@ -197,6 +197,17 @@ class CCECToolchain(Toolchain):
         ]
 
 
+# Sim kernel build profiles (Gxx15Toolchain). "default" is the portable -O2
+# build; "fast" only changes compiler flags, trading portability of the .so
+# for host-native SIMD codegen. Neither reassociates fp math nor contracts to
+# FMA, so a kernel produces the same bits under either profile and on any host.
+SIM_PROFILES = ("default", "fast")
+
+# Overrides -march for the "fast" profile (e.g. "x86-64-v3" for a binary that
+# must run on other hosts of the same generation; "" drops -march entirely).
+_SIM_MARCH_ENV = "SIMPLER_SIM_MARCH"
+
+
 class Gxx15Toolchain(Toolchain):
     """g++-15 compiler for simulation kernels."""
 
@@ -206,7 +217,9 @@ class Gxx15Toolchain(Toolchain):
         super().__init__()
         self.cxx_path = "g++-15"
 
-    def get_compile_flags(self, core_type: str = "", **kwargs) -> list[str]:
+    def get_compile_flags(self, core_type: str = "", profile: str = "default", **kwargs) -> list[str]:
+        if profile not in SIM_PROFILES:
+            raise ValueError(f"Unknown sim profile: {profile!r}. Supported: {', '.join(SIM_PROFILES)}")
         flags = [
             "-shared",
             "-O2",
@@ -218,7 +231,25 @@ class Gxx15Toolchain(Toolchain):
             "-D__CPU_SIM",
             "-DPTO_CPU_MAX_THREADS=1",
             "-DNDEBUG",
+            # Keep a*b+c as two rounded ops. GCC contracts to FMA by default
+            # wherever the target has it (aarch64 always, x86 only with
+            # -march), so an aarch64 default build would differ from the fast
+            # profile and from x86 hosts.
+            "-ffp-contract=off",
         ]
+        if profile == "fast":
+            flags[flags.index("-O2")] = "-O3"
+            march = os.environ.get(_SIM_MARCH_ENV, "native")
+            if march:
+                flags.append(f"-march={march}")
+            # No -fopenmp-simd: an `omp simd reduction` would be free to
+            # reorder fp sums. Without -ffast-math, -O3 only vectorizes loops
+            # whose per-element operation order is unchanged.
+            flags += [
+                "-funroll-loops",
+                "-fno-semantic-interposition",
+                "-DSIMPLER_SIM_FAST=1",
+            ]
         # g++ does not define __DAV_VEC__/__DAV_CUBE__ like ccec does,
         # so we must add them explicitly based on core_type.
         if core_type == "aiv":
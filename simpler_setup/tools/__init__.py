@@ -12,11 +12,13 @@ Invoke via ``python -m simpler_setup.tools.<name>``:
 
 - ``swimlane_converter``   : perf JSON -> Perfetto/Chrome trace
 - ``sched_overhead_analysis``: scheduler overhead deep-dive
+- ``sched_whatif``          : replay a captured DAG under other scheduler configs
+- ``buffer_planner``        : heap-ring footprint of intermediates vs. their live set
 - ``deps_viewer``           : deps.json -> text or pan/zoom HTML dependency graph
 - ``dump_viewer``           : inspect args dumps
 - ``device_log_timing``     : Total/Orch/Sched from a CANN device log
 
 Shared helper modules (imported by the CLIs above, not run directly):
 
-- ``device_log_resolver``   : resolve a CANN device log path
+- ``device_log_resolver``   : resolve a CANN device log path; decode binary logs
 """
@@ -0,0 +1,277 @@
+#!/usr/bin/env python3
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Robust per-round benchmark statistics, JSON reports and baseline comparison.
+
+``scene_test`` feeds this module when a case runs with ``--bench-json PATH``:
+the scene is loaded once, ``--warmup`` rounds are run and discarded, then
+``--rounds`` measured rounds go through ``Worker.run`` (``ChipWorker::run`` at
+L2). Each metric's samples are summarised as
+
+    median, p90, p99, mean, stdev, min, max
+    median_ci  — distribution-free confidence interval for the median
+                 (order statistics of Binomial(n, 1/2); exact ranks up to
+                 n = 1000, normal approximation above)
+
+and merged into ``PATH`` keyed by ``Class::Case``. Metrics:
+
+    host_wall_us        RunTiming host wall
+    device_wall_us      RunTiming device wall (rounds that reported one)
+    dlt_total_us / dlt_orch_us / dlt_sched_us
+                        device-log Total / Orch / Sched, with
+                        ``--enable-device-log-timing`` (onboard L2 only)
+    sched_<phase>_us    per-record AICPU scheduler phase durations
+                        (``dispatch``, ``complete``, ...) from the swimlane
+                        records of ``--enable-l2-swimlane 3`` or higher; also
+                        carry a power-of-two ``hist``. Works on sim, but the
+                        swimlane records only the first round (a warmup round
+                        when ``--warmup`` is set), and the sim clock is only
+                        comparable against another sim run on the same host.
+
+Compare mode flags a regression only when the median moved by more than
+``--threshold`` AND the two medians' confidence intervals do not overlap, so
+run-to-run jitter on a noisy sim host does not trip it.
+
+Usage:
+    python -m simpler_setup.tools.bench_stats show bench.json
+    python -m simpler_setup.tools.bench_stats compare baseline.json bench.json --threshold 0.05
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import math
+import os
+import socket
+import statistics
+import sys
+import time
+from pathlib import Path
+
+SCHEMA = "simpler-bench/1"
+SCHED_METRIC_PREFIX = "sched_"
+_HIST_MIN_EXP = -4  # 1/16 us; a2a3 cycles are 0.02 us
+
+
+def percentile(sorted_vals: list[float], q: float) -> float:
+    """Linear-interpolated percentile (``q`` in [0, 100]) of pre-sorted samples."""
+    if not sorted_vals:
+        return 0.0
+    pos = (len(sorted_vals) - 1) * q / 100.0
+    lo = math.floor(pos)
+    hi = math.ceil(pos)
+    return sorted_vals[lo] + (sorted_vals[hi] - sorted_vals[lo]) * (pos - lo)
+
+
+_EXACT_CI_MAX_N = 1000
+
+
+def median_ci(sorted_vals: list[float], confidence: float = 0.95) -> tuple[float, float]:
+    """Distribution-free CI for the median: order statistics ``(r, n + 1 - r)``
+    (1-based) with ``r`` the largest rank whose Binomial(n, 1/2) tail
+    ``P(X <= r - 1)`` stays within ``(1 - confidence) / 2``. Exact up to
+    ``_EXACT_CI_MAX_N`` samples; beyond that the standard normal-approximation
+    ranks ``floor(n/2 - z*sqrt(n)/2)`` and ``ceil(1 + n/2 + z*sqrt(n)/2)``.
+    Widens to the sample range when n is too small for the confidence."""
+    n = len(sorted_vals)
+    if n == 0:
+        return (0.0, 0.0)
+    alpha_half = (1.0 - confidence) / 2.0
+    if n <= _EXACT_CI_MAX_N:
+        total = 1 << n
+        tail = 0
+        r = 0
+        while r < n // 2 and (tail + math.comb(n, r)) / total <= alpha_half:
+            tail += math.comb(n, r)
+            r += 1
+        lo_rank, hi_rank = r, n + 1 - r
+    else:
+        z = statistics.NormalDist().inv_cdf(1.0 - alpha_half)
+        half = z * math.sqrt(n) / 2.0
+        lo_rank = math.floor(n / 2.0 - half)
+        hi_rank = math.ceil(1.0 + n / 2.0 + half)
+    lo = min(n - 1, max(0, lo_rank - 1))
+    hi = max(0, min(n - 1, hi_rank - 1))
+    return (sorted_vals[lo], sorted_vals[hi])
+
+
+def log2_histogram(samples: list[float]) -> dict:
+    """Counts per power-of-two bucket: ``count[i]`` holds the samples in
+    ``[lo_us[i], 2 * lo_us[i])``. Samples below ``2**_HIST_MIN_EXP`` us share
+    the first bucket (``lo_us`` 0). Only the span between the lowest and the
+    highest non-empty bucket is kept."""
+    counts: dict[int, int] = {}
+    for v in samples:
+        k = max(_HIST_MIN_EXP, math.floor(math.log2(v))) if v > 0 else _HIST_MIN_EXP
+        counts[k] = counts.get(k, 0) + 1
+    if not counts:
+        return {"lo_us": [], "count": []}
+    exps = range(min(counts), max(counts) + 1)
+    return {
+        "lo_us": [0.0 if k == _HIST_MIN_EXP else 2.0**k for k in exps],
+        "count": [counts.get(k, 0) for k in exps],
+    }
+
+
+def sched_phase_samples(perf_data: dict) -> dict[str, list[float]]:
+    """``sched_<phase>_us`` duration samples from ``swimlane_converter.read_perf_data``
+    output, pooled over scheduler threads. Empty below swimlane level 3."""
+    out: dict[str, list[float]] = {}
+    for records in perf_data.get("aicpu_scheduler_phases", []):
+        for rec in records:
+            metric = f"{SCHED_METRIC_PREFIX}{rec.get('phase', 'unknown')}_us"
+            out.setdefault(metric, []).append(rec.get("end_time_us", 0.0) - rec.get("start_time_us", 0.0))
+    return out
+
+
+def summarize(samples: list[float], confidence: float = 0.95, histogram: bool = False) -> dict:
+    """Summary dict for one metric. ``samples`` is kept for re-analysis."""
+    vals = sorted(float(v) for v in samples)
+    n = len(vals)
+    lo, hi = median_ci(vals, confidence)
+    extra = {"hist": log2_histogram(vals)} if histogram else {}
+    return {
+        "n": n,
+        "median": percentile(vals, 50),
+        "p90": percentile(vals, 90),
+        "p99": percentile(vals, 99),
+        "mean": statistics.fmean(vals) if n else 0.0,
+        "stdev": statistics.stdev(vals) if n > 1 else 0.0,
+        "min": vals[0] if n else 0.0,
+        "max": vals[-1] if n else 0.0,
+        "median_ci": [lo, hi],
+        "confidence": confidence,
+        "samples": [float(v) for v in samples],
+        **extra,
+    }
+
+
+def format_summary(metric: str, s: dict) -> str:
+    lo, hi = s["median_ci"]
+    return (
+        f"  {metric}: median {s['median']:.1f} us [{lo:.1f}, {hi:.1f}]  "
+        f"p90 {s['p90']:.1f}  p99 {s['p99']:.1f}  stdev {s['stdev']:.1f}  (n={s['n']})"
+    )
+
+
+def format_histogram(hist: dict) -> str:
+    """One line, ``<lower edge us>:<count>`` per bucket."""
+    return "    hist " + " ".join(f"{lo:g}:{c}" for lo, c in zip(hist["lo_us"], hist["count"]))
+
+
+def merge_into_file(path: str | os.PathLike, label: str, metrics: dict[str, list[float]], meta: dict) -> None:
+    """Summarise ``metrics`` and merge them under ``cases[label]`` in ``path``.
+
+    Parallel per-case subprocesses share one report, so the read-modify-write
+    runs under an exclusive ``flock`` on a sidecar lock file.
+    """
+    import fcntl  # noqa: PLC0415
+
+    path = Path(path)
+    path.parent.mkdir(parents=True, exist_ok=True)
+    with open(str(path) + ".lock", "w") as lock:
+        fcntl.flock(lock, fcntl.LOCK_EX)
+        report = {"schema": SCHEMA, "meta": {}, "cases": {}}
+        if path.exists() and path.stat().st_size > 0:
+            report = json.loads(path.read_text())
+        report["meta"].update(meta)
+        report["meta"].setdefault("host", socket.gethostname())
+        report["meta"]["updated"] = time.strftime("%Y-%m-%dT%H:%M:%S")
+        report["cases"][label] = {
+            m: summarize(v, histogram=m.startswith(SCHED_METRIC_PREFIX)) for m, v in metrics.items() if v
+        }
+        tmp = path.with_suffix(path.suffix + ".tmp")
+        tmp.write_text(json.dumps(report, indent=2) + "\n")
+        os.replace(tmp, path)
+
+
+def compare(baseline: dict, current: dict, threshold: float = 0.05) -> list[dict]:
+    """One row per (case, metric) present in both reports.
+
+    ``verdict`` is ``regression`` / ``improvement`` when the relative median
+    change exceeds ``threshold`` and the median CIs are disjoint, else ``same``.
+    """
+    rows = []
+    for label, cur_metrics in sorted(current.get("cases", {}).items()):
+        base_metrics = baseline.get("cases", {}).get(label)
+        if not base_metrics:
+            continue
+        for metric, cur in sorted(cur_metrics.items()):
+            base = base_metrics.get(metric)
+            if not base or base["median"] <= 0.0:
+                continue
+            delta = cur["median"] / base["median"] - 1.0
+            verdict = "same"
+            if delta > threshold and cur["median_ci"][0] > base["median_ci"][1]:
+                verdict = "regression"
+            elif delta < -threshold and cur["median_ci"][1] < base["median_ci"][0]:
+                verdict = "improvement"
+            rows.append(
+                {
+                    "case": label,
+                    "metric": metric,
+                    "baseline": base["median"],
+                    "current": cur["median"],
+                    "delta": delta,
+                    "verdict": verdict,
+                }
+            )
+    return rows
+
+
+def _load(path: str) -> dict:
+    report = json.loads(Path(path).read_text())
+    if report.get("schema") != SCHEMA:
+        raise ValueError(f"{path}: not a {SCHEMA} report")
+    return report
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description="Summarise or compare scene_test --bench-json reports.")
+    sub = parser.add_subparsers(dest="cmd", required=True)
+    show = sub.add_parser("show", help="Print the per-case summary of a report")
+    show.add_argument("report")
+    cmp_ = sub.add_parser("compare", help="Compare a report against a baseline; exit 1 on regression")
+    cmp_.add_argument("baseline")
+    cmp_.add_argument("current")
+    cmp_.add_argument(
+        "--threshold", type=float, default=0.05, help="Relative median change that counts (default: 0.05)"
+    )
+    cmp_.add_argument("--json", dest="json_out", help="Also write the comparison rows to this file")
+    args = parser.parse_args(argv)
+
+    if args.cmd == "show":
+        report = _load(args.report)
+        for label, metrics in sorted(report["cases"].items()):
+            print(label)
+            for metric, s in sorted(metrics.items()):
+                print(format_summary(metric, s))
+                if "hist" in s:
+                    print(format_histogram(s["hist"]))
+        return 0
+
+    rows = compare(_load(args.baseline), _load(args.current), args.threshold)
+    print(f"  {'case':<48} {'metric':<16} {'base (us)':>10} {'cur (us)':>10} {'delta':>8}  verdict")
+    for r in rows:
+        print(
+            f"  {r['case']:<48} {r['metric']:<16} {r['baseline']:>10.1f} {r['current']:>10.1f} "
+            f"{r['delta'] * 100:>+7.1f}%  {r['verdict']}"
+        )
+    if args.json_out:
+        Path(args.json_out).write_text(json.dumps(rows, indent=2) + "\n")
+    regressions = [r for r in rows if r["verdict"] == "regression"]
+    if regressions:
+        print(f"{len(regressions)} regression(s) beyond {args.threshold * 100:.0f}%", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
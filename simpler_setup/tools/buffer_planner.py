@@ -0,0 +1,398 @@
+#!/usr/bin/env python3
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Liveness-based intermediate buffer planner — how small can the heap rings be?
+
+Runtime-allocated intermediates (TMR ``alloc_tensors`` / packed task outputs
+on the heap ring, L3 ``Orchestrator.alloc``) each take a fresh region and are
+reclaimed FIFO, so the ring has to hold far more than the live set. This tool
+derives each intermediate's lifetime in submission order (def = the task that
+allocated it, end = its last consumer) and reports, per heap ring:
+
+  naive       every intermediate held at once (one enclosing scope)
+  fifo_peak   peak of the FIFO ring when each buffer is reclaimed as soon as
+              it and every older buffer are dead (best case for the runtime)
+  max_live    peak of the true live set (lower bound for any allocator)
+  planned     arena of a static offset assignment (greedy by size, best fit
+              among lifetime-overlapping buffers), as static memory planners do
+
+The offset plan is advisory: the runtime does not consume it. Use the numbers
+to size ``PTO2_RING_HEAP`` / ``Worker(heap_ring_size=...)``.
+
+Inputs (either):
+  1. deps.json from an ``--enable-dep-gen`` run (L2, tensormap_and_ringbuffer).
+     Intermediates are started by ``creator`` edges, one per creator task.
+  2. A lifetime trace from ``Orchestrator.lifetime_trace()`` (L3).
+
+Model and limits: docs/dfx/buffer-planner.md.
+
+Usage:
+    python -m simpler_setup.tools.buffer_planner outputs/<dep_gen case>/deps.json
+    python -m simpler_setup.tools.buffer_planner lifetimes.json --json plan.json
+"""
+
+import argparse
+import bisect
+import json
+import sys
+
+from .swimlane_converter import normalize_pto2_task_id_int
+
+HEAP_ALIGN = 1024  # PTO2_PACKED_OUTPUT_ALIGN (L2) == HEAP_ALIGN (L3)
+
+_DTYPE_BYTES = {
+    "FLOAT32": 4,
+    "FLOAT16": 2,
+    "BFLOAT16": 2,
+    "INT64": 8,
+    "UINT64": 8,
+    "INT32": 4,
+    "UINT32": 4,
+    "INT16": 2,
+    "UINT16": 2,
+    "INT8": 1,
+    "UINT8": 1,
+    "BOOL": 1,
+}
+
+
+def _align_up(value, align):
+    return (value + align - 1) // align * align if align > 1 else value
+
+
+def _next_pow2(value):
+    return 1 << (value - 1).bit_length() if value > 1 else 1
+
+
+def lifetimes_from_deps(deps_data, align=HEAP_ALIGN):
+    """Derive intermediate-buffer lifetimes from a dep_gen ``deps.json``.
+
+    Time is the submission index: deps.json ``tasks[]`` order, then any task
+    id seen only in ``edges`` in ascending id order. Each distinct ``pred``
+    of a ``source == "creator"`` edge starts one intermediate at that edge's
+    ``buffer_addr``: the pred allocated it and fixes its ring. Once the heap
+    ring wraps, one address hosts several intermediates in turn. A creator
+    edge's consumer is a use of that edge's intermediate. Any other use of a
+    tensor id (an arg, or a non-creator edge consumer) goes to the latest
+    intermediate at its address allocated at or before the using task,
+    since tensor ids only hash (address, version). ``bytes`` is the largest
+    ``buffer_numel * dtype size`` over the versions used, aligned to
+    ``align``. A reused address names its later intermediates
+    ``<addr>#1``, ``<addr>#2``, ...
+
+    Returns a list of ``{"name", "ring", "bytes", "def", "last_use"}`` dicts
+    ordered by (def, name).
+    """
+    index = {}
+    for t in deps_data.get("tasks") or []:
+        tid = normalize_pto2_task_id_int(t.get("task_id")) if isinstance(t, dict) else None
+        if tid is not None and tid not in index:
+            index[tid] = len(index)
+    edges = deps_data.get("edges") or []
+    extra = set()
+    for e in edges:
+        for key in ("pred", "succ"):
+            tid = normalize_pto2_task_id_int(e.get(key))
+            if tid is not None and tid not in index:
+                extra.add(tid)
+    for tid in sorted(extra):
+        index[tid] = len(index)
+
+    tensors = {}
+    for t in deps_data.get("tensors") or []:
+        try:
+            tensor_id = int(t["tensor_id"])
+            addr = int(t["buffer_addr"])
+            nbytes = int(t.get("buffer_numel", 0)) * _DTYPE_BYTES.get(t.get("dtype"), 1)
+        except (KeyError, TypeError, ValueError):
+            continue
+        tensors[tensor_id] = (addr, nbytes)
+
+    lifetimes = {}  # (addr, creator task id) -> lifetime
+    uses = []  # (tensor_id, task index, lifetime key or None)
+    for e in edges:
+        try:
+            tensor_id = int(e["tensor_id"])
+        except (KeyError, TypeError, ValueError):
+            continue
+        if tensor_id not in tensors:
+            continue
+        key = None
+        pred_id = normalize_pto2_task_id_int(e.get("pred"))
+        if e.get("source") == "creator" and pred_id is not None:
+            key = (tensors[tensor_id][0], pred_id)
+            if key not in lifetimes:
+                def_index = index[pred_id]
+                lifetimes[key] = {"ring": (pred_id >> 32) & 0xFF, "bytes": 0, "def": def_index, "last_use": def_index}
+        uses.append((tensor_id, index.get(normalize_pto2_task_id_int(e.get("succ"))), key))
+    for t in deps_data.get("tasks") or []:
+        if not isinstance(t, dict):
+            continue
+        task_index = index.get(normalize_pto2_task_id_int(t.get("task_id")))
+        for arg in t.get("args") or []:
+            try:
+                tensor_id = int(arg["tensor_id"])
+            except (KeyError, TypeError, ValueError):
+                continue
+            if tensor_id in tensors:
+                uses.append((tensor_id, task_index, None))
+
+    by_addr = {}
+    for (addr, _pred_id), life in lifetimes.items():
+        by_addr.setdefault(addr, []).append(life)
+    for lives in by_addr.values():
+        lives.sort(key=lambda life: life["def"])
+    defs = {addr: [life["def"] for life in lives] for addr, lives in by_addr.items()}
+
+    for tensor_id, task_index, key in uses:
+        addr, nbytes = tensors[tensor_id]
+        if key is not None:
+            life = lifetimes[key]
+        elif task_index is not None:
+            pos = bisect.bisect_right(defs.get(addr, []), task_index) - 1
+            if pos < 0:
+                continue  # external, or touched before any intermediate took the address
+            life = by_addr[addr][pos]
+        else:
+            continue
+        life["bytes"] = max(life["bytes"], nbytes)
+        if task_index is not None:
+            life["last_use"] = max(life["last_use"], task_index)
+
+    buffers = []
+    for addr, lives in by_addr.items():
+        for n, life in enumerate(lives):
+            buffers.append(
+                {
+                    "name": hex(addr) if n == 0 else f"{hex(addr)}#{n}",
+                    "ring": life["ring"],
+                    "bytes": _align_up(life["bytes"], align),
+                    "def": life["def"],
+                    "last_use": life["last_use"],
+                }
+            )
+    buffers.sort(key=lambda b: (b["def"], b["name"]))
+    return buffers
+
+
+def lifetimes_from_trace(trace_data, align=HEAP_ALIGN):
+    """Normalize an ``Orchestrator.lifetime_trace()`` dump (``{"buffers": [...]}``).
+
+    Each entry needs ``bytes``, ``def`` and ``last_use`` (submission indices);
+    ``name`` and ``ring`` default to the entry index and 0. Entries are
+    re-aligned to ``align`` and returned in (def, name) order.
+    """
+    buffers = []
+    for i, b in enumerate(trace_data.get("buffers") or []):
+        def_index = int(b["def"])
+        buffers.append(
+            {
+                "name": str(b.get("name", i)),
+                "ring": int(b.get("ring", 0)),
+                "bytes": _align_up(int(b["bytes"]), align),
+                "def": def_index,
+                "last_use": max(int(b.get("last_use", def_index)), def_index),
+            }
+        )
+    buffers.sort(key=lambda b: (b["def"], b["name"]))
+    return buffers
+
+
+def load_lifetimes(data, align=HEAP_ALIGN):
+    """Dispatch on the input shape: lifetime trace if it has ``buffers``, else deps.json."""
+    if "buffers" in data:
+        return lifetimes_from_trace(data, align)
+    if "edges" in data or "tasks" in data:
+        return lifetimes_from_deps(data, align)
+    raise ValueError("input is neither a deps.json (tasks/edges) nor a lifetime trace (buffers)")
+
+
+def _peak(intervals):
+    """Peak of sum(bytes) over inclusive [start, end] intervals."""
+    events = []
+    for start, end, nbytes in intervals:
+        events.append((start, 1, nbytes))
+        events.append((end + 1, 0, -nbytes))  # frees sort before allocs at the same time
+    live = peak = 0
+    for _, _, delta in sorted(events):
+        live += delta
+        peak = max(peak, live)
+    return peak
+
+
+def max_live(buffers):
+    """Peak of the true live set: every buffer held exactly over [def, last_use]."""
+    return _peak((b["def"], b["last_use"], b["bytes"]) for b in buffers)
+
+
+def fifo_peak(buffers):
+    """Peak of a FIFO heap ring that reclaims the oldest-first contiguous dead prefix.
+
+    A buffer is freed once it and every buffer allocated before it are dead,
+    i.e. at the running max of ``last_use`` in allocation order. Ignores the
+    tail the ring skips when an allocation does not fit before wrap-around.
+    """
+    reclaim = -1
+    intervals = []
+    for b in buffers:
+        reclaim = max(reclaim, b["last_use"])
+        intervals.append((b["def"], reclaim, b["bytes"]))
+    return _peak(intervals)
+
+
+def plan_offsets(buffers):
+    """Assign offsets so lifetime-overlapping buffers never share bytes.
+
+    Greedy by size: largest first (ties by def), each placed in the smallest
+    gap between already-placed buffers whose lifetime overlaps its own, else
+    on top of them. Returns ``(offsets, arena_bytes)`` with ``offsets[i]``
+    for ``buffers[i]``.
+    """
+    order = sorted(range(len(buffers)), key=lambda i: (-buffers[i]["bytes"], buffers[i]["def"], i))
+    offsets = [0] * len(buffers)
+    placed = []
+    arena = 0
+    for i in order:
+        b = buffers[i]
+        size = b["bytes"]
+        busy = sorted(
+            (offsets[j], buffers[j]["bytes"])
+            for j in placed
+            if buffers[j]["def"] <= b["last_use"] and b["def"] <= buffers[j]["last_use"]
+        )
+        best = None
+        best_gap = None
+        top = 0
+        for off, nbytes in busy:
+            gap = off - top
+            if gap >= size and (best_gap is None or gap < best_gap):
+                best, best_gap = top, gap
+            top = max(top, off + nbytes)
+        offsets[i] = best if best is not None else top
+        arena = max(arena, offsets[i] + size)
+        placed.append(i)
+    return offsets, arena
+
+
+def verify_plan(buffers, offsets):
+    """Return (i, j) pairs that overlap in both lifetime and address range (should be empty)."""
+    conflicts = []
+    for i, a in enumerate(buffers):
+        for j in range(i + 1, len(buffers)):
+            b = buffers[j]
+            if a["def"] > b["last_use"] or b["def"] > a["last_use"]:
+                continue
+            if offsets[i] < offsets[j] + b["bytes"] and offsets[j] < offsets[i] + a["bytes"]:
+                conflicts.append((i, j))
+    return conflicts
+
+
+def plan_rings(buffers):
+    """Per-ring statistics and offset plan. Returns a list of per-ring dicts, ring order."""
+    rings = {}
+    for b in buffers:
+        rings.setdefault(b["ring"], []).append(b)
+    results = []
+    for ring in sorted(rings):
+        members = rings[ring]
+        offsets, arena = plan_offsets(members)
+        live = max_live(members)
+        fifo = fifo_peak(members)
+        largest = max((b["bytes"] for b in members), default=0)
+        results.append(
+            {
+                "ring": ring,
+                "buffers": len(members),
+                "naive_bytes": sum(b["bytes"] for b in members),
+                "fifo_peak_bytes": fifo,
+                "max_live_bytes": live,
+                "planned_bytes": arena,
+                "fragmentation": 1.0 - live / arena if arena else 0.0,
+                "fifo_overhead": fifo / live - 1.0 if live else 0.0,
+                # FIFO ring skips the tail on wrap: leave room for one more largest buffer.
+                "suggested_ring_bytes": _next_pow2(fifo + largest) if members else 0,
+                "plan": [
+                    {
+                        "name": b["name"],
+                        "offset": off,
+                        "bytes": b["bytes"],
+                        "def": b["def"],
+                        "last_use": b["last_use"],
+                    }
+                    for b, off in zip(members, offsets)
+                ],
+            }
+        )
+    return results
+
+
+def _fmt_bytes(n):
+    for unit in ("B", "KiB", "MiB", "GiB"):
+        if n < 1024 or unit == "GiB":
+            return f"{n:.0f} {unit}" if unit == "B" else f"{n:.1f} {unit}"
+        n /= 1024.0
+    return f"{n} B"
+
+
+def print_report(results):
+    header = (
+        f"{'ring':>4} {'bufs':>7} {'naive':>11} {'fifo_peak':>11} {'max_live':>11} "
+        f"{'planned':>11} {'frag%':>6} {'fifo+%':>7} {'suggest':>11}"
+    )
+    print(header)
+    print("-" * len(header))
+    for r in results:
+        print(
+            f"{r['ring']:>4} {r['buffers']:>7} {_fmt_bytes(r['naive_bytes']):>11} "
+            f"{_fmt_bytes(r['fifo_peak_bytes']):>11} {_fmt_bytes(r['max_live_bytes']):>11} "
+            f"{_fmt_bytes(r['planned_bytes']):>11} {r['fragmentation'] * 100:>6.1f} "
+            f"{r['fifo_overhead'] * 100:>7.1f} {_fmt_bytes(r['suggested_ring_bytes']):>11}"
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Liveness-based intermediate buffer planner",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  %(prog)s outputs/<dep_gen case>/deps.json
+  %(prog)s l3_lifetimes.json --json plan.json
+        """,
+    )
+    parser.add_argument("input", help="deps.json (dep_gen output) or an Orchestrator.lifetime_trace() dump")
+    parser.add_argument(
+        "--align", type=int, default=HEAP_ALIGN, help=f"Per-buffer size alignment in bytes (default {HEAP_ALIGN})"
+    )
+    parser.add_argument("--json", help="Also write the statistics and per-buffer offsets to this JSON file")
+    args = parser.parse_args()
+
+    try:
+        with open(args.input) as f:
+            data = json.load(f)
+        buffers = load_lifetimes(data, args.align)
+    except (OSError, ValueError, KeyError, TypeError) as e:
+        print(f"Error: failed to read {args.input}: {e}", file=sys.stderr)
+        return 1
+    if not buffers:
+        print(f"No runtime-allocated intermediates in {args.input}")
+        return 0
+
+    results = plan_rings(buffers)
+    print(f"Source: {args.input} | {len(buffers)} intermediates, align {args.align} B")
+    print_report(results)
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({"align": args.align, "rings": results}, f, indent=2)
+        print(f"\nWrote {args.json}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -14,6 +14,8 @@ from __future__ import annotations
 import glob
 import os
 import re
+import struct
+from dataclasses import dataclass
 from datetime import datetime
 from pathlib import Path
 
@@ -225,3 +227,152 @@ def resolve_device_log_paths(
 
     single, strategy = resolve_device_log_path(device_id=device_id, device_log=device_log)
     return ([single] if single is not None else []), strategy
+
+
+# ---------------------------------------------------------------------------
+# Binary (deferred-format) log decoding.
+#
+# Mirrors src/common/log/include/common/binary_log.h: a file is a sequence of
+# self-contained chunks (host HostLogger and sim AICPU sinks each append their
+# own), every chunk carrying the format table its records reference. Records
+# hold raw printf arguments; formatting happens here.
+# ---------------------------------------------------------------------------
+
+_BINLOG_MAGIC = b"SIMPLBL1"
+_BINLOG_HEADER = struct.Struct("<8sIIIIQQ")
+_BINLOG_MAX_ARGS = 12
+_BINLOG_STR_BYTES = 136
+_BINLOG_RECORD = struct.Struct(f"<QIIIBBH{_BINLOG_MAX_ARGS}Q{_BINLOG_STR_BYTES}s")
+_BINLOG_FMT_ENTRY = struct.Struct("<II")
+_BINLOG_NO_STRING = 0xFFFFFFFF
+_BINLOG_SPEC = re.compile(
+    r"%(?P<flags>[-+ #0']*)(?P<width>\*|\d+)?(?:\.(?P<prec>\*|\d*))?(?:hh|h|ll|l|j|z|t|L)?(?P<conv>[diouxXeEfFgGaAspcn%])"
+)
+
+
+@dataclass
+class BinaryLogRecord:
+    """One decoded binary log record."""
+
+    ts_ns: int  # CLOCK_MONOTONIC
+    tid: int
+    level: str  # DEBUG / WARN / ERROR / INFO_V<N>
+    func: str
+    message: str
+
+    def format(self) -> str:
+        """Render in the host text layout, with a monotonic timestamp."""
+        sec, nsec = divmod(self.ts_ns, 1_000_000_000)
+        return f"[{sec}.{nsec:09d}][T{self.tid}][{self.level}] {self.func}: {self.message}"
+
+
+def _binlog_level(tag: int) -> str:
+    if tag >= 0x10:
+        return f"INFO_V{tag - 0x10}"
+    return {0: "DEBUG", 1: "INFO", 2: "WARN", 3: "ERROR"}.get(tag, f"TAG{tag}")
+
+
+def _binlog_format(fmt: str, args: tuple[int, ...], strs: bytes) -> str:
+    """printf-style render of `fmt` against raw 64-bit argument slots."""
+    it = iter(args)
+    out = []
+    pos = 0
+    for m in _BINLOG_SPEC.finditer(fmt):
+        out.append(fmt[pos : m.start()])
+        pos = m.end()
+        conv = m.group("conv")
+        if conv == "%":
+            out.append("%")
+            continue
+        if conv == "n":
+            continue
+        flags = m.group("flags").replace("'", "")
+        width = m.group("width") or ""
+        prec = m.group("prec")
+        try:
+            if width == "*":
+                w = _to_signed64(next(it))
+                if w < 0:
+                    flags, w = flags + "-", -w
+                width = str(w)
+            if prec == "*":
+                prec = str(max(_to_signed64(next(it)), 0))
+            v = next(it)
+        except StopIteration:
+            out.append("<?>")
+            continue
+        spec = "%" + flags + width + ("" if prec is None else "." + (prec or "0"))
+        if conv in "di":
+            out.append((spec + "d") % _to_signed64(v))
+        elif conv == "u":
+            out.append((spec + "d") % v)
+        elif conv in "oxX":
+            out.append((spec + conv) % v)
+        elif conv in "eEfFgG":
+            out.append((spec + conv) % _to_double(v))
+        elif conv in "aA":
+            text = _to_double(v).hex()
+            out.append(text.upper() if conv == "A" else text)
+        elif conv == "s":
+            if v == _BINLOG_NO_STRING or v >= len(strs):
+                text = "(null)"
+            else:
+                text = strs[v:].split(b"\0", 1)[0].decode("utf-8", errors="replace")
+            out.append((spec + "s") % text)
+        elif conv == "p":
+            out.append((spec.replace(".", "") + "s") % (f"0x{v:x}" if v else "(nil)"))
+        elif conv == "c":
+            out.append((spec + "c") % chr(v & 0xFF))
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def _to_signed64(v: int) -> int:
+    return v - (1 << 64) if v & (1 << 63) else v
+
+
+def _to_double(v: int) -> float:
+    return struct.unpack("<d", struct.pack("<Q", v))[0]
+
+
+def decode_binary_log(path: Path | str) -> tuple[list[BinaryLogRecord], int]:
+    """Decode a binary log file into records sorted by timestamp.
+
+    Returns ``(records, dropped)`` where ``dropped`` totals the records the
+    writers lost to full per-thread rings. A truncated trailing chunk (process
+    killed mid-flush) is ignored rather than raising.
+    """
+    data = Path(path).expanduser().read_bytes()
+    records: list[BinaryLogRecord] = []
+    dropped = 0
+    off = 0
+    while off + _BINLOG_HEADER.size <= len(data):
+        magic, version, record_size, nfmt, _reserved, nrec, chunk_dropped = _BINLOG_HEADER.unpack_from(data, off)
+        if magic != _BINLOG_MAGIC:
+            raise ValueError(f"{path}: bad binary log chunk magic at offset {off}")
+        if version != 1 or record_size != _BINLOG_RECORD.size:
+            raise ValueError(f"{path}: unsupported binary log chunk (version={version}, record_size={record_size})")
+        off += _BINLOG_HEADER.size
+        fmts: dict[int, str] = {}
+        try:
+            for _ in range(nfmt):
+                fid, flen = _BINLOG_FMT_ENTRY.unpack_from(data, off)
+                off += _BINLOG_FMT_ENTRY.size
+                fmts[fid] = data[off : off + flen].decode("utf-8", errors="replace")
+                off += flen
+        except struct.error:
+            break
+        if off + nrec * _BINLOG_RECORD.size > len(data):
+            break
+        for _ in range(nrec):
+            fields = _BINLOG_RECORD.unpack_from(data, off)
+            off += _BINLOG_RECORD.size
+            ts_ns, fmt_id, func_id, tid, tag, nargs, _str_used = fields[:7]
+            args = fields[7 : 7 + min(nargs, _BINLOG_MAX_ARGS)]
+            strs = fields[7 + _BINLOG_MAX_ARGS]
+            fmt = fmts.get(fmt_id)
+            message = "<unknown format>" if fmt is None else _binlog_format(fmt, args, strs)
+            records.append(BinaryLogRecord(ts_ns, tid, _binlog_level(tag), fmts.get(func_id, "?"), message))
+        dropped += chunk_dropped
+    records.sort(key=lambda r: r.ts_ns)
+    return records, dropped
@@ -622,7 +622,8 @@ def run_analysis(  # noqa: PLR0912, PLR0915
             load on large artifacts.
         deps_json_path: Optional deps.json (dep_gen replay output) co-located
             with the perf JSON. When present, per-thread fanout / fanin
-            aggregates are derived from it.
+            aggregates are derived from it. Without one, the perf JSON's own
+            ``task_edges`` (--enable-l2-edges run) stand in for the DAG.
 
     Returns:
         int: 0 on success, non-zero on failure.
@@ -672,19 +673,29 @@ def run_analysis(  # noqa: PLR0912, PLR0915
     # bubbles from dependency stalls, which is the whole point of this tool.
     # Capture deps.json SEPARATELY with --enable-dep-gen (do NOT co-run with
     # --enable-l2-swimlane: dep_gen perturbs timing).
+    # An --enable-l2-edges run carries the wired edges itself; that costs one
+    # 16 B record per edge on the wiring thread, far less than dep_gen.
     if deps_json_path is None:
-        print(
-            "Error: scheduler-overhead analysis needs the task DAG (deps.json). Capture it in a "
-            "SEPARATE run with --enable-dep-gen (not co-run with --enable-l2-swimlane), then pass --deps-json.",
-            file=sys.stderr,
-        )
-        return 1
-    try:
-        with open(deps_json_path) as df:
-            deps_data = json.load(df)
-    except (OSError, ValueError) as e:
-        print(f"Error: failed to read deps.json {deps_json_path}: {e}", file=sys.stderr)
-        return 1
+        from .swimlane_converter import deps_from_task_edges  # noqa: PLC0415
+
+        deps_data = deps_from_task_edges(data)
+        if deps_data is None:
+            print(
+                "Error: scheduler-overhead analysis needs the task DAG (deps.json). Capture it in a "
+                "SEPARATE run with --enable-dep-gen (not co-run with --enable-l2-swimlane), then pass "
+                "--deps-json — or re-run the swimlane with --enable-l2-edges.",
+                file=sys.stderr,
+            )
+            return 1
+        if print_sources:
+            print(f"Deps:       task_edges in perf JSON ({len(deps_data['edges'])} wired edges)")
+    else:
+        try:
+            with open(deps_json_path) as df:
+                deps_data = json.load(df)
+        except (OSError, ValueError) as e:
+            print(f"Error: failed to read deps.json {deps_json_path}: {e}", file=sys.stderr)
+            return 1
 
     w0 = min(t["start_time_us"] for t in tasks)
     w1 = max(t["end_time_us"] for t in tasks)
@@ -0,0 +1,340 @@
+#!/usr/bin/env python3
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Scheduler what-if simulator for PTO2 — predict makespan under other scheduler settings.
+
+Replays a captured task DAG through a discrete-event model of the
+tensormap_and_ringbuffer scheduler (src/common/sched_sim, bound into
+``_task_interface``) and sweeps scheduler thread count, ready-queue policy,
+core ownership, speculative early dispatch and task-ring size. Each config is
+answered in about a second, even for a 1M-task graph, with no device run.
+
+Inputs (same pair as sched_overhead_analysis, captured in SEPARATE runs):
+  1. l2_swimlane_records_*.json: per-subtask kernel durations and core types.
+     The measured makespan is printed as the baseline, and the median
+     dispatch -> start latency calibrates ``--launch-us``.
+  2. deps.json: the task DAG from a ``--enable-dep-gen`` run. Task order in
+     ``tasks[]`` is taken as submission order. Optional when the swimlane
+     run used ``--enable-l2-edges``: its ``task_edges`` are used instead,
+     in task-id order.
+
+Model and calibration: docs/dfx/sched-whatif.md.
+
+Usage:
+    python -m simpler_setup.tools.sched_whatif \\
+        --l2-swimlane-records-json <swimlane.json> --deps-json <deps.json> \\
+        --threads 2,3,4 --policy fifo,priority --early-dispatch off,on
+"""
+
+import argparse
+import itertools
+import json
+import statistics
+import sys
+from pathlib import Path
+
+from .sched_overhead_analysis import auto_select_l2_swimlane_records_json
+from .swimlane_converter import deps_from_task_edges, normalize_pto2_task_id_int, read_perf_data
+
+_POLICIES = {"fifo": "FIFO", "priority": "PRIORITY", "submit": "SUBMIT_ORDER"}
+_ASSIGNMENTS = {"partitioned": "PARTITIONED", "shared": "SHARED"}
+_ON_OFF = {"off": False, "on": True}
+
+
+def build_sim_inputs(deps_data, perf_data):
+    """Flatten deps.json + joined swimlane records into SchedSimGraph arrays.
+
+    Task index = submission order: deps.json ``tasks[]`` order, then any task
+    id seen only in ``edges`` or the swimlane, in ascending id order. Every
+    swimlane row becomes one subtask (SPMD blocks and MIX halves are separate
+    rows already). Tasks without rows (alloc / dummy, or records dropped on
+    buffer rotation) get no subtasks and complete at zero cost.
+
+    Returns a dict with ``num_tasks``, ``edge_src``, ``edge_dst``,
+    ``sub_task``, ``sub_core_type`` (0 = AIC, 1 = AIV), ``sub_duration_ns``,
+    ``task_ids`` and the measured baseline: ``measured_makespan_us``,
+    ``launch_us`` (median dispatch -> start, or None), ``aic_cores`` /
+    ``aiv_cores`` (distinct cores seen per type) and ``threads`` (distinct
+    scheduler threads in ``core_to_thread``, or None).
+    """
+    order = []
+    index = {}
+
+    def _index(task_id):
+        i = index.get(task_id)
+        if i is None:
+            i = len(order)
+            index[task_id] = i
+            order.append(task_id)
+        return i
+
+    for t in deps_data.get("tasks") or []:
+        tid = normalize_pto2_task_id_int(t.get("task_id")) if isinstance(t, dict) else None
+        if tid is not None:
+            _index(tid)
+
+    rows = perf_data.get("tasks") or []
+    extra = set()
+    pairs = set()
+    for e in deps_data.get("edges") or []:
+        if not isinstance(e, dict):
+            continue
+        pred = normalize_pto2_task_id_int(e.get("pred"))
+        succ = normalize_pto2_task_id_int(e.get("succ"))
+        if pred is None or succ is None:
+            continue
+        pairs.add((pred, succ))
+        extra.update(x for x in (pred, succ) if x not in index)
+    extra.update(int(r["task_id"]) for r in rows if int(r["task_id"]) not in index)
+    for tid in sorted(extra):
+        _index(tid)
+
+    edge_src, edge_dst = [], []
+    for pred, succ in sorted(pairs):
+        edge_src.append(index[pred])
+        edge_dst.append(index[succ])
+
+    sub_task, sub_core_type, sub_duration_ns = [], [], []
+    cores = {0: set(), 1: set()}
+    launch = []
+    t0, t1 = None, None
+    for r in rows:
+        ctype = 0 if r.get("core_type") == "aic" else 1
+        sub_task.append(index[int(r["task_id"])])
+        sub_core_type.append(ctype)
+        sub_duration_ns.append(max(0, round(float(r["duration_us"]) * 1000.0)))
+        cores[ctype].add(int(r["core_id"]))
+        start = float(r["start_time_us"])
+        dispatch = float(r.get("dispatch_time_us") or 0.0)
+        begin = dispatch if dispatch > 0 else start
+        t0 = begin if t0 is None else min(t0, begin)
+        end = max(float(r["end_time_us"]), float(r.get("finish_time_us") or 0.0))
+        t1 = end if t1 is None else max(t1, end)
+        if dispatch > 0 and start >= dispatch:
+            launch.append(start - dispatch)
+
+    core_to_thread = perf_data.get("core_to_thread") or []
+    threads = {t for t in core_to_thread if isinstance(t, int) and t >= 0}
+    return {
+        "num_tasks": len(order),
+        "edge_src": edge_src,
+        "edge_dst": edge_dst,
+        "sub_task": sub_task,
+        "sub_core_type": sub_core_type,
+        "sub_duration_ns": sub_duration_ns,
+        "task_ids": order,
+        "measured_makespan_us": (t1 - t0) if rows else 0.0,
+        "launch_us": statistics.median(launch) if launch else None,
+        "aic_cores": len(cores[0]),
+        "aiv_cores": len(cores[1]),
+        "threads": len(threads) or None,
+    }
+
+
+def _split(value, choices=None):
+    items = [v.strip().lower() for v in value.split(",") if v.strip()]
+    if choices is not None:
+        bad = [v for v in items if v not in choices]
+        if bad:
+            raise argparse.ArgumentTypeError(f"unknown value(s) {bad}; choose from {sorted(choices)}")
+    return items
+
+
+def _int_list(value):
+    try:
+        return [int(v) for v in _split(value)]
+    except ValueError as e:
+        raise argparse.ArgumentTypeError(str(e)) from e
+
+
+def run_sweep(inputs, args):
+    """Replay every config in the sweep. Returns a list of result dicts."""
+    # Lazy import: build_sim_inputs / --help work without the native module.
+    try:
+        import _task_interface as ti  # noqa: PLC0415  # pyright: ignore[reportMissingImports]
+    except ImportError as e:
+        raise RuntimeError("sched_whatif needs the _task_interface extension (pip install the simpler wheel)") from e
+
+    graph = ti.SchedSimGraph(
+        inputs["num_tasks"],
+        inputs["edge_src"],
+        inputs["edge_dst"],
+        inputs["sub_task"],
+        inputs["sub_core_type"],
+        inputs["sub_duration_ns"],
+    )
+    launch_us = args.launch_us if args.launch_us is not None else (inputs["launch_us"] or 0.5)
+    results = []
+    for threads, policy, assign, early, ring in itertools.product(
+        args.threads, args.policy, args.core_assignment, args.early_dispatch, args.ring_size
+    ):
+        cfg = ti.SchedSimConfig()
+        cfg.num_threads = threads
+        cfg.num_aic = args.aic
+        cfg.num_aiv = args.aiv
+        cfg.policy = getattr(ti.SchedSimPolicy, _POLICIES[policy])
+        cfg.core_assignment = getattr(ti.SchedSimCoreAssignment, _ASSIGNMENTS[assign])
+        cfg.early_dispatch = _ON_OFF[early]
+        cfg.ring_size = ring
+        cfg.orch_submit_ns = round(args.orch_submit_us * 1000)
+        cfg.dispatch_ns = round(args.dispatch_us * 1000)
+        cfg.complete_ns = round(args.complete_us * 1000)
+        cfg.fanout_edge_ns = round(args.fanout_edge_us * 1000)
+        cfg.launch_ns = round(launch_us * 1000)
+        cfg.spec_release_ns = round(args.spec_release_us * 1000)
+        r = graph.simulate(cfg)
+        results.append(
+            {
+                "threads": threads,
+                "policy": policy,
+                "core_assignment": assign,
+                "early_dispatch": early,
+                "ring_size": ring,
+                "makespan_us": r.makespan_ns / 1000.0,
+                "critical_path_us": r.critical_path_ns / 1000.0,
+                "aic_utilization": r.aic_utilization,
+                "aiv_utilization": r.aiv_utilization,
+                "thread_utilization": r.thread_utilization,
+                "orch_ring_stall_us": r.orch_ring_stall_ns / 1000.0,
+                "mean_ready_wait_us": r.mean_ready_wait_ns / 1000.0,
+                "spec_staged": r.spec_staged,
+            }
+        )
+    return results
+
+
+def print_report(inputs, results, launch_us):
+    measured = inputs["measured_makespan_us"]
+    print(
+        f"Graph: {inputs['num_tasks']} tasks, {len(inputs['edge_src'])} edges, "
+        f"{len(inputs['sub_task'])} subtasks | launch {launch_us:.3f} us"
+    )
+    print(f"Measured makespan: {measured:.2f} us")
+    if results:
+        print(f"Critical path (no overhead, infinite cores): {results[0]['critical_path_us']:.2f} us")
+    print()
+    header = (
+        f"{'thr':>3} {'policy':>8} {'cores':>11} {'early':>5} {'ring':>6} {'makespan_us':>12} "
+        f"{'vs meas':>8} {'aic%':>6} {'aiv%':>6} {'sched%':>6} {'wait_us':>8} {'stall_us':>9}"
+    )
+    print(header)
+    print("-" * len(header))
+    for r in sorted(results, key=lambda r: r["makespan_us"]):
+        delta = f"{(r['makespan_us'] / measured - 1.0) * 100.0:+.1f}%" if measured > 0 else "n/a"
+        print(
+            f"{r['threads']:>3} {r['policy']:>8} {r['core_assignment']:>11} {r['early_dispatch']:>5} "
+            f"{r['ring_size'] or '-':>6} {r['makespan_us']:>12.2f} {delta:>8} "
+            f"{r['aic_utilization'] * 100:>6.1f} {r['aiv_utilization'] * 100:>6.1f} "
+            f"{r['thread_utilization'] * 100:>6.1f} {r['mean_ready_wait_us']:>8.3f} {r['orch_ring_stall_us']:>9.2f}"
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Scheduler what-if simulator for PTO2",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+Examples:
+  %(prog)s --l2-swimlane-records-json outputs/<case>_<ts>/l2_swimlane_records.json \
+      --deps-json outputs/<dep_gen case>/deps.json --threads 1,2,3,4
+  %(prog)s ... --policy fifo,priority --early-dispatch off,on --json sweep.json
+        """,
+    )
+    parser.add_argument(
+        "--l2-swimlane-records-json",
+        help="Path to l2_swimlane_records_*.json. If not specified, uses the latest in outputs/",
+    )
+    parser.add_argument(
+        "--deps-json",
+        help="Path to deps.json (dep_gen output). Defaults to deps.json next to the perf JSON, "
+        "else the perf JSON's own task_edges (--enable-l2-edges).",
+    )
+    parser.add_argument(
+        "--threads", type=_int_list, help="Scheduler thread counts to sweep (default: measured count, else 3)"
+    )
+    parser.add_argument(
+        "--policy", type=lambda v: _split(v, _POLICIES), default=["fifo"], help="fifo,priority,submit (default fifo)"
+    )
+    parser.add_argument(
+        "--core-assignment",
+        type=lambda v: _split(v, _ASSIGNMENTS),
+        default=["partitioned"],
+        help="partitioned,shared (default partitioned)",
+    )
+    parser.add_argument(
+        "--early-dispatch", type=lambda v: _split(v, _ON_OFF), default=["off"], help="off,on (default off)"
+    )
+    parser.add_argument("--ring-size", type=_int_list, default=[0], help="Task-ring sizes, 0 = unbounded (default 0)")
+    parser.add_argument("--aic", type=int, help="AIC core count (default: distinct AIC cores in the swimlane)")
+    parser.add_argument("--aiv", type=int, help="AIV core count (default: distinct AIV cores in the swimlane)")
+    parser.add_argument("--orch-submit-us", type=float, default=0.0, help="Orchestrator cost per submit (default 0)")
+    parser.add_argument("--dispatch-us", type=float, default=0.2, help="Scheduler cost per dispatch (default 0.2)")
+    parser.add_argument("--complete-us", type=float, default=0.1, help="Scheduler cost per completion (default 0.1)")
+    parser.add_argument(
+        "--fanout-edge-us", type=float, default=0.02, help="Scheduler cost per successor on completion (default 0.02)"
+    )
+    parser.add_argument(
+        "--launch-us", type=float, help="Dispatch -> kernel start latency (default: measured median, else 0.5)"
+    )
+    parser.add_argument(
+        "--spec-release-us", type=float, default=0.1, help="Doorbell -> start for staged tasks (default 0.1)"
+    )
+    parser.add_argument("--json", help="Also write the sweep results to this JSON file")
+    args = parser.parse_args()
+
+    try:
+        perf_path = (
+            Path(args.l2_swimlane_records_json)
+            if args.l2_swimlane_records_json
+            else auto_select_l2_swimlane_records_json()
+        )
+        perf_data = read_perf_data(perf_path)
+    except (OSError, ValueError) as e:
+        print(f"Error: failed to read perf JSON: {e}", file=sys.stderr)
+        return 1
+    deps_path = Path(args.deps_json) if args.deps_json else perf_path.parent / "deps.json"
+    wired_deps = deps_from_task_edges(perf_data)
+    if not args.deps_json and not deps_path.exists() and wired_deps is not None:
+        # --enable-l2-edges run: the swimlane carries its own DAG.
+        deps_data = wired_deps
+        deps_path = "task_edges"
+    else:
+        try:
+            with deps_path.open() as f:
+                deps_data = json.load(f)
+        except (OSError, ValueError) as e:
+            print(f"Error: failed to read deps.json {deps_path}: {e}", file=sys.stderr)
+            return 1
+
+    inputs = build_sim_inputs(deps_data, perf_data)
+    args.threads = args.threads or [inputs["threads"] or 3]
+    if args.aic is None:
+        args.aic = inputs["aic_cores"]
+    if args.aiv is None:
+        args.aiv = inputs["aiv_cores"]
+    launch_us = args.launch_us if args.launch_us is not None else (inputs["launch_us"] or 0.5)
+
+    try:
+        results = run_sweep(inputs, args)
+    except (RuntimeError, ValueError) as e:
+        print(f"Error: {e}", file=sys.stderr)
+        return 1
+
+    print(f"Sources: {perf_path} + {deps_path}")
+    print_report(inputs, results, launch_us)
+    if args.json:
+        payload = {"measured_makespan_us": inputs["measured_makespan_us"], "launch_us": launch_us, "results": results}
+        with open(args.json, "w") as f:
+            json.dump(payload, f, indent=2)
+        print(f"\nWrote {args.json}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -123,7 +123,8 @@ def read_perf_data(filepath):  # noqa: PLR0912, PLR0915
                             end_cycles, receive_to_start_cycles], ...],
           "aicpu_tasks":  [[core_id, reg_task_id, dispatch_cycles, finish_cycles], ...],
           "aicpu_scheduler_phases":     [ [ {kind, start_cycles, end_cycles, ...}, ... ], ... ],
-          "aicpu_orchestrator_phases":  [ [ {submit_idx, task_id, start_cycles, end_cycles}, ... ], ... ]
+          "aicpu_orchestrator_phases":  [ [ {submit_idx, task_id, start_cycles, end_cycles}, ... ], ... ],
+          "task_edges": [[producer_task_id, consumer_task_id], ...]   # optional (--enable-l2-edges)
         }
 
     aicore_tasks columns (v3 schema): the trailing receive_to_start_cycles
@@ -139,7 +140,8 @@ def read_perf_data(filepath):  # noqa: PLR0912, PLR0915
     Returns a dict shaped for `generate_chrome_trace_json`,
     `print_task_statistics`, and `sched_overhead_analysis`: `tasks`,
     `aicpu_scheduler_phases`, `aicpu_orchestrator_phases`,
-    `core_to_thread`.
+    `core_to_thread`, and `task_edges` when the run exported wired edges
+    (see `deps_from_task_edges`).
 
     The join logic that used to live in `export_swimlane_json` (host C++):
 
@@ -366,9 +368,37 @@ def read_perf_data(filepath):  # noqa: PLR0912, PLR0915
         out["aicpu_orchestrator_phases"] = aicpu_orchestrator_phases
     if core_to_thread:
         out["core_to_thread"] = core_to_thread
+    task_edges = data.get("task_edges")
+    if task_edges is not None:
+        out["task_edges"] = [(int(p), int(c)) for p, c in task_edges]
     return out
 
 
+def deps_from_task_edges(perf_data):
+    """Build a deps.json-shaped dict from a swimlane run's ``task_edges``.
+
+    ``--enable-l2-edges`` makes the scheduler's wiring thread record every
+    (producer, consumer) pair it wires, so one swimlane run carries both the
+    timing and the DAG. The result has the deps.json v2 shape consumed by
+    ``load_deps_json`` / ``sched_overhead_analysis`` / ``sched_whatif``, with
+    ``source: "wired"`` on every edge. There is no submission order or
+    tensor annotation: ``tasks`` is empty, so consumers fall back to task-id
+    order (the local id is monotonic per ring).
+
+    Returns:
+        dict, or ``None`` when ``perf_data`` carries no ``task_edges`` (edge
+        export was off). An enabled run with no dependencies returns a dict
+        with an empty ``edges`` list.
+    """
+    task_edges = perf_data.get("task_edges")
+    if task_edges is None:
+        return None
+    return {
+        "tasks": [],
+        "edges": [{"pred": str(p), "succ": str(c), "source": "wired"} for p, c in task_edges],
+    }
+
+
 def load_deps_json(deps_path):
     """Load a dep_gen replay output (``deps.json``).
 
@@ -397,6 +427,11 @@ def load_deps_json(deps_path):
     if not isinstance(edges, list):
         print(f"Warning: {deps_path} has no 'edges' array", file=sys.stderr)
         return None
+    return deps_edges_by_pred(edges)
+
+
+def deps_edges_by_pred(edges):
+    """Project deps.json ``edges[]`` to ``pred_raw → [succ_raw, ...]``."""
     # The converter only needs flow-event endpoints (not the per-edge tensor
     # annotations). Project annotated edges down to a (pred, succ) set and
     # dedup so multiple annotated edges sharing the same pair (distinct arg
@@ -2319,7 +2354,12 @@ def main():
         # the real kernel name. Optional — pre-schema deps.json without
         # kernel_ids and AICPU_TIMING+ runs both leave this at None.
         deps_kernel_map = load_deps_kernel_map(deps_path)
-        if deps_edges is not None:
+        wired_deps = deps_from_task_edges(data) if deps_edges is None else None
+        if wired_deps is not None:
+            deps_edges = deps_edges_by_pred(wired_deps["edges"])
+            if args.verbose:
+                print(f"  Using wired task_edges ({len(wired_deps['edges'])} total) from {input_path}")
+        elif deps_edges is not None:
             if args.verbose:
                 print(f"  Using deps.json edges ({sum(len(v) for v in deps_edges.values())} total) from {deps_path}")
                 if deps_kernel_map is not None:
@@ -2327,7 +2367,8 @@ def main():
         else:
             print(
                 f"Warning: no usable deps.json at {deps_path}; Perfetto trace will have no dependency arrows. "
-                f"Run a dep_gen capture (--enable-dep-gen) and pass --deps-json <path> to add them.",
+                f"Run a dep_gen capture (--enable-dep-gen) and pass --deps-json <path>, or re-run with "
+                f"--enable-l2-edges, to add them.",
                 file=sys.stderr,
             )
 
@@ -28,6 +28,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include "common/core_type.h"
 #include "common/platform_config.h"
 
 #ifdef __cplusplus
@@ -160,6 +161,26 @@ int32_t platform_deinit_aicore_regs(uint64_t reg_addr);
  */
 uint64_t inner_get_deinit_timeout_ticks();
 
+/**
+ * Variant-specific PMU counter source, called just before the AICPU reads a
+ * finished task's PMU counters.
+ *
+ * Implemented per-variant in:
+ *   sim/aicpu/inner_platform_regs.cpp     -- writes deterministic synthetic
+ *                                            counters into the simulated PMU
+ *                                            register block
+ *   onboard/aicpu/inner_platform_regs.cpp -- no-op (silicon counts for real)
+ *
+ * The synthetic values depend only on (event id, core type, func_id,
+ * task_id), so sim runs exercise rotation and derived metrics reproducibly.
+ *
+ * @param reg_base   PMU MMIO base of the core
+ * @param event_ids  Selector programmed into each of the PMU_CNTn_IDX slots
+ */
+void inner_pmu_synthesize_counters(
+    uint64_t reg_base, const uint32_t *event_ids, uint64_t task_id, uint32_t func_id, CoreType core_type
+);
+
 /**
  * Get physical core count for current platform
  *
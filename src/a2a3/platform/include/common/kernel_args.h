@@ -114,6 +114,11 @@ struct KernelArgs {
     // single-uint64 wall_ns write-through (sim AICPU and host share memory).
     // Zero when the buffer was not allocated.
     uint64_t device_wall_data_base{0};
+    // Device pointer to the flight-recorder region (FlightRecorderHeader +
+    // one overwrite ring per AICPU thread, see common/flight_recorder.h).
+    // Allocated once and kept resident; ring contents persist across runs so
+    // a snapshot covers the tail of earlier steps too. Zero = recorder off.
+    uint64_t flight_recorder_data_base{0};
     // ACL device ordinal. Pushed to the AICPU so the executor can suffix the
     // staged orchestration SO name (libdevice_orch_<pid>_<cid>_<device_id>.so):
     // paired a2a3 dies share the preinstall filesystem, and a content/pid-only
@@ -52,6 +52,24 @@ enum class PmuEventType : uint32_t {
 
 constexpr uint32_t PMU_EVENT_TYPE_DEFAULT = static_cast<uint32_t>(PmuEventType::PIPE_UTILIZATION);
 
+// Upper bound on the event types a run may multiplex (one slot per enum value).
+constexpr int PMU_MAX_EVENT_GROUPS = 8;
+
+/**
+ * How the collector multiplexes several event groups onto the 8 counters.
+ *
+ *   NONE      — one group for the whole run (the classic single-event mode).
+ *   PER_TASK  — AICPU reprograms a core's selectors after every recorded task,
+ *               walking the group list round-robin per core.
+ *   PER_ROUND — the host picks the next group on each run() of the same
+ *               DeviceRunner; the device sees a single group per run.
+ */
+enum class PmuRotationMode : uint32_t {
+    NONE = 0,
+    PER_TASK = 1,
+    PER_ROUND = 2,
+};
+
 /**
  * Event ID table for a single event type.
  * `event_ids[i]` programs PMU_CNTi_IDX; `pmu_counters[i]` in the PmuRecord is the
@@ -139,8 +157,11 @@ struct PmuRecord {
     CoreType core_type;                             // AIC or AIV
     uint64_t pmu_total_cycles;                      // PMU_CNT_TOTAL (64-bit combined)
     uint32_t pmu_counters[PMU_COUNTER_COUNT_A2A3];  // PMU_CNT0..CNT7
+    uint32_t event_type;                            // PmuEventType programmed while the task ran
 } __attribute__((aligned(64)));
 
+static_assert(sizeof(PmuRecord) == 64, "PmuRecord must stay one cache line");
+
 // =============================================================================
 // PMU Streaming Buffer Structures (mirrors l2_swimlane_profiling.h)
 // =============================================================================
@@ -227,8 +248,10 @@ struct PmuDataHeader {
     volatile uint32_t queue_heads[PLATFORM_MAX_AICPU_THREADS];  // Host reads (consumer)
     volatile uint32_t queue_tails[PLATFORM_MAX_AICPU_THREADS];  // AICPU writes (producer)
     uint32_t num_cores;
-    uint32_t event_type;  // PmuEventType value, written by host at init
-    uint32_t pad[2];
+    uint32_t event_type;     // PmuEventType value, written by host at init
+    uint32_t rotation_mode;  // PmuRotationMode; only PER_TASK changes device behavior
+    uint32_t group_count;    // Valid entries in event_groups (PER_TASK only)
+    uint32_t event_groups[PMU_MAX_EVENT_GROUPS];  // PmuEventType values to rotate through
 } __attribute__((aligned(64)));
 
 // =============================================================================
@@ -44,12 +44,13 @@
 // ---------------------------------------------------------------------------
 
 /**
- * L2 Perf has four distinct buffer kinds going through one ready queue per
+ * L2 Perf has five distinct buffer kinds going through one ready queue per
  * AICPU thread:
  *   - kind 0: per-core    L2SwimlaneAicpuTaskBuffer      (task records)
  *   - kind 1: per-thread  L2SwimlaneAicpuSchedPhaseBuffer (scheduler phase records)
  *   - kind 2: per-thread  L2SwimlaneAicpuOrchPhaseBuffer  (orchestrator phase records)
  *   - kind 3: per-core    L2SwimlaneAicoreTaskBuffer     (AICore-written records)
+ *   - kind 4: per-thread  L2SwimlaneAicpuEdgeBuffer      (wired dependency edges)
  * The ReadyQueueEntry::kind flag picks among them.
  */
 
@@ -63,6 +64,7 @@ enum class ProfBufferType {
     AICPU_SCHED_PHASE = 1,
     AICPU_ORCH_PHASE = 2,
     AICORE_TASK = 3,
+    AICPU_EDGE = 4,
 };
 
 /**
@@ -83,7 +85,7 @@ struct L2SwimlaneModule {
     using ReadyBufferInfo = ::ReadyBufferInfo;
     using FreeQueue = L2SwimlaneFreeQueue;  // all pool types share the same free_queue layout
 
-    static constexpr int kBufferKinds = 4;
+    static constexpr int kBufferKinds = 5;
     static constexpr uint32_t kReadyQueueSize = PLATFORM_PROF_READYQUEUE_SIZE;
     static constexpr uint32_t kSlotCount = PLATFORM_PROF_SLOT_COUNT;
     static constexpr const char *kSubsystemName = "L2SwimlaneModule";
@@ -91,14 +93,15 @@ struct L2SwimlaneModule {
     /**
      * batch_size for proactive_replenish's alloc fallback. Sized so that a
      * fully empty recycled pool refills to the configured per-instance
-     * ceiling in one tick. Sched and orch phase pools are sized independently
-     * (PLATFORM_PROF_{SCHED,ORCH}_BUFFERS_PER_THREAD).
+     * ceiling in one tick. Sched, orch and edge pools are sized independently
+     * (PLATFORM_PROF_{SCHED,ORCH,EDGE}_BUFFERS_PER_THREAD).
      */
     static constexpr int batch_size(int kind) {
         constexpr int kPerfBatch = PLATFORM_PROF_BUFFERS_PER_CORE - PLATFORM_PROF_SLOT_COUNT;
         constexpr int kSchedBatch = PLATFORM_PROF_SCHED_BUFFERS_PER_THREAD - PLATFORM_PROF_SLOT_COUNT;
         constexpr int kOrchBatch = PLATFORM_PROF_ORCH_BUFFERS_PER_THREAD - PLATFORM_PROF_SLOT_COUNT;
         constexpr int kAicoreBatch = PLATFORM_AICORE_BUFFERS_PER_CORE - PLATFORM_PROF_SLOT_COUNT;
+        constexpr int kEdgeBatch = PLATFORM_PROF_EDGE_BUFFERS_PER_THREAD - PLATFORM_PROF_SLOT_COUNT;
         int b = kPerfBatch;
         switch (static_cast<L2SwimlaneBufferKind>(kind)) {
         case L2SwimlaneBufferKind::AicpuTask:
@@ -113,6 +116,9 @@ struct L2SwimlaneModule {
         case L2SwimlaneBufferKind::AicoreTask:
             b = kAicoreBatch;
             break;
+        case L2SwimlaneBufferKind::AicpuEdge:
+            b = kEdgeBatch;
+            break;
         }
         return b < 1 ? 1 : b;
     }
@@ -123,7 +129,7 @@ struct L2SwimlaneModule {
 
     /**
      * Branch on entry.kind to pick the per-core task state, per-thread sched-
-     * or orch-phase state, or per-core AICore state. Returns nullopt for
+     * / orch-phase / edge state, or per-core AICore state. Returns nullopt for
      * out-of-range kind or core_index.
      */
     static std::optional<profiling_common::EntrySite<L2SwimlaneModule>>
@@ -134,14 +140,16 @@ struct L2SwimlaneModule {
         // Validate kind first — out-of-range silently falling into the wrong
         // branch reads a wrong-typed pool.
         if (kind != L2SwimlaneBufferKind::AicpuTask && kind != L2SwimlaneBufferKind::AicpuSchedPhase &&
-            kind != L2SwimlaneBufferKind::AicpuOrchPhase && kind != L2SwimlaneBufferKind::AicoreTask) {
+            kind != L2SwimlaneBufferKind::AicpuOrchPhase && kind != L2SwimlaneBufferKind::AicoreTask &&
+            kind != L2SwimlaneBufferKind::AicpuEdge) {
             LOG_ERROR("L2SwimlaneModule: invalid entry kind=%u", static_cast<uint32_t>(kind));
             return std::nullopt;
         }
 
-        // Sched/orch phase entries are indexed by thread_idx; task/aicore by core_index.
-        const bool is_phase =
-            (kind == L2SwimlaneBufferKind::AicpuSchedPhase) || (kind == L2SwimlaneBufferKind::AicpuOrchPhase);
+        // Sched/orch phase and edge entries are indexed by thread_idx; task/aicore by core_index.
+        const bool is_phase = (kind == L2SwimlaneBufferKind::AicpuSchedPhase) ||
+                              (kind == L2SwimlaneBufferKind::AicpuOrchPhase) ||
+                              (kind == L2SwimlaneBufferKind::AicpuEdge);
         if (is_phase) {
             if (entry.core_index >= static_cast<uint32_t>(PLATFORM_MAX_AICPU_THREADS)) {
                 LOG_ERROR("L2SwimlaneModule: invalid phase entry: thread=%u", entry.core_index);
@@ -194,6 +202,13 @@ struct L2SwimlaneModule {
             site.info.type = ProfBufferType::AICORE_TASK;
             break;
         }
+        case L2SwimlaneBufferKind::AicpuEdge: {
+            auto *state = get_edge_buffer_state(shm, num_cores, static_cast<int>(entry.core_index));
+            site.free_queue = &state->free_queue;
+            site.buffer_size = sizeof(L2SwimlaneAicpuEdgeBuffer);
+            site.info.type = ProfBufferType::AICPU_EDGE;
+            break;
+        }
         }
         return site;
     }
@@ -240,6 +255,18 @@ struct L2SwimlaneModule {
             cb(/*kind=*/static_cast<int>(L2SwimlaneBufferKind::AicpuOrchPhase), &state->free_queue,
                sizeof(L2SwimlaneAicpuOrchPhaseBuffer));
         }
+
+        // AicpuEdge: per-thread (kind 4) — zero unless edge export was
+        // requested and the AICPU primed the pools. Same bounds clamp.
+        int num_edge_threads = static_cast<int>(header->num_edge_threads);
+        if (num_edge_threads > PLATFORM_MAX_AICPU_THREADS) {
+            num_edge_threads = 0;
+        }
+        for (int t = 0; t < num_edge_threads; t++) {
+            auto *state = get_edge_buffer_state(shm, num_cores, t);
+            cb(/*kind=*/static_cast<int>(L2SwimlaneBufferKind::AicpuEdge), &state->free_queue,
+               sizeof(L2SwimlaneAicpuEdgeBuffer));
+        }
     }
 };
 
@@ -311,6 +338,10 @@ public:
      *                                 collector so `export_swimlane_json()`
      *                                 can gate phase sections and stamp the
      *                                 JSON `version`.
+     * @param enable_edges             Allocate the per-thread edge pools and ask
+     *                                 the AICPU to emit one record per wired
+     *                                 dependency (L2_SWIMLANE_EDGES_FLAG).
+     *                                 Exported as `task_edges`.
      * @param alloc_cb                 Device memory allocation callback
      * @param register_cb              Memory registration callback (nullptr for
      *                                 simulation)
@@ -323,7 +354,7 @@ public:
      * @return 0 on success, error code on failure
      */
     int initialize(
-        int num_aicore, int aicpu_thread_num, int device_id, L2SwimlaneLevel l2_swimlane_level,
+        int num_aicore, int aicpu_thread_num, int device_id, L2SwimlaneLevel l2_swimlane_level, bool enable_edges,
         const L2SwimlaneAllocCallback &alloc_cb, L2SwimlaneRegisterCallback register_cb,
         const L2SwimlaneFreeCallback &free_cb, const std::string &output_prefix
     );
@@ -436,6 +467,7 @@ private:
     // does not encode the AICPU thread).
     int aicpu_thread_num_{0};
     L2SwimlaneLevel l2_swimlane_level_{L2SwimlaneLevel::DISABLED};
+    bool enable_edges_{false};
 
     // Per-core core_type table populated by set_core_types(). Indexed by
     // core_id; size matches num_aicore_ once populated. Used by the level=1
@@ -461,6 +493,10 @@ private:
     std::vector<std::vector<L2SwimlaneAicpuOrchPhaseRecord>> collected_orch_phase_records_;
     bool has_phase_data_{false};
 
+    // Wired dependency edges, flattened across threads (order is irrelevant;
+    // the consumer dedups). Empty unless enable_edges_.
+    std::vector<L2SwimlaneAicpuEdgeRecord> collected_edge_records_;
+
     // Core-to-thread mapping (core_id → scheduler thread index, -1 = unassigned)
     std::vector<int8_t> core_to_thread_;
 
@@ -468,6 +504,7 @@ private:
     uint64_t total_perf_collected_{0};
     uint64_t total_sched_phase_collected_{0};
     uint64_t total_orch_phase_collected_{0};
+    uint64_t total_edge_collected_{0};
 
     // Allocate a single buffer (any of the L2SwimlaneAicpu*Buffer kinds) and register it.
     // The RAII counterpart ``release_one_buffer`` lives on ProfilerBase and
@@ -479,6 +516,7 @@ private:
     void copy_sched_phase_buffer(const ReadyBufferInfo &info);
     void copy_orch_phase_buffer(const ReadyBufferInfo &info);
     void copy_aicore_buffer(const ReadyBufferInfo &info);
+    void copy_edge_buffer(const ReadyBufferInfo &info);
 };
 
 #endif  // SRC_A2A3_PLATFORM_INCLUDE_HOST_L2_SWIMLANE_COLLECTOR_H_
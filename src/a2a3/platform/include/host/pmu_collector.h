@@ -13,6 +13,12 @@
  * @file pmu_collector.h
  * @brief Host-side PMU buffer allocation, streaming collection, and CSV export.
  *
+ * Event multiplexing: SIMPLER_PMU_EVENT_GROUPS lists several PmuEventTypes;
+ * the collector rotates them per task (AICPU reprograms each core after a
+ * record) or per round (each init() on this collector picks the next group).
+ * Records carry their own event_type, and PmuKernelAggregator (pmu_metrics.h)
+ * folds them into per-kernel derived metrics written to pmu_summary.bin.
+ *
  * Architecture:
  * - BufferPoolManager<PmuModule>: shared mgmt-thread infrastructure that polls
  *   per-thread DumpReadyQueues, drains the done_queue, and replenishes the
@@ -38,7 +44,8 @@
  *                                  device-flush bug, logged as ERROR) and run
  *                                  the device-side cross-check:
  *                                  collected + dropped == total.
- *   finalize()                   — Free all device memory and unregister.
+ *   finalize()                   — Close the CSV, write pmu_summary.bin, free
+ *                                  all device memory and unregister.
  */
 
 #ifndef SRC_A2A3_PLATFORM_INCLUDE_HOST_PMU_COLLECTOR_H_
@@ -62,6 +69,7 @@
 #include "common/platform_config.h"
 #include "common/pmu_profiling.h"
 #include "common/unified_log.h"
+#include "host/pmu_metrics.h"
 #include "host/profiler_base.h"
 
 // ---------------------------------------------------------------------------
@@ -155,6 +163,20 @@ using PmuRegisterCallback = profiling_common::ProfRegisterCallback;
 using PmuUnregisterCallback = profiling_common::ProfUnregisterCallback;
 using PmuFreeCallback = profiling_common::ProfFreeCallback;
 
+// ---------------------------------------------------------------------------
+// Event-group rotation
+// ---------------------------------------------------------------------------
+
+/**
+ * Resolved multiplexing plan. mode == NONE means a single-group run using the
+ * event type passed to PmuCollector::init().
+ */
+struct PmuRotationConfig {
+    PmuRotationMode mode = PmuRotationMode::NONE;
+    uint32_t group_count = 0;
+    PmuEventType groups[PMU_MAX_EVENT_GROUPS] = {};
+};
+
 // ---------------------------------------------------------------------------
 // PmuCollector
 // ---------------------------------------------------------------------------
@@ -186,7 +208,9 @@ public:
      * @param csv_path                     Output CSV path
      * @param event_type                   PmuEventType selector (written to
      *                                     PmuDataHeader::event_type so AICPU
-     *                                     can configure the HW counters)
+     *                                     can configure the HW counters).
+     *                                     Ignored when SIMPLER_PMU_EVENT_GROUPS
+     *                                     selects a multi-group rotation.
      * @param alloc_cb / register_cb / free_cb  Memory operation callbacks
      *                                          (register_cb nullptr in sim)
      * @param user_data                    Opaque pointer forwarded to callbacks
@@ -224,7 +248,12 @@ public:
     void reconcile_counters();
 
     /**
-     * Free all device memory and unregister mappings. Idempotent.
+     * Close the CSV, write the per-kernel summary next to it, then free all
+     * device memory and unregister mappings. Idempotent.
+     *
+     * In PER_ROUND rotation the aggregates survive finalize(): the next
+     * init() with the same csv_path resumes them (and appends to the CSV),
+     * so each round rewrites a summary covering every round so far.
      */
     void finalize(PmuUnregisterCallback unregister_cb, const PmuFreeCallback &free_cb);
 
@@ -233,11 +262,20 @@ public:
      */
     bool is_initialized() const { return initialized_; }
 
+    /**
+     * Per-kernel aggregates collected so far. Only stable after stop().
+     */
+    const PmuKernelAggregator &aggregates() const { return aggregates_; }
+
 private:
     bool initialized_ = false;
     int num_cores_ = 0;
     int num_threads_ = 0;
     PmuEventType event_type_{PmuEventType::PIPE_UTILIZATION};
+    PmuRotationConfig rotation_;
+
+    // PER_ROUND cursor into rotation_.groups; advances once per init().
+    uint32_t round_cursor_ = 0;
 
     // Shared memory region (PmuDataHeader + PmuBufferState[]). shm_host_ /
     // device_id_ live on ProfilerBase (set via set_memory_context in init()).
@@ -257,6 +295,13 @@ private:
     std::ofstream csv_file_;
     std::mutex csv_mutex_;
 
+    // True when init() resumed a PER_ROUND series: the CSV is appended to
+    // instead of truncated and its header is not rewritten.
+    bool csv_append_ = false;
+
+    // Per-kernel aggregates, guarded by csv_mutex_ while the poll thread runs.
+    PmuKernelAggregator aggregates_;
+
     // Running total of records written to CSV. Used at drain time to verify
     // collected + device-side dropped == device-side total.
     uint64_t total_collected_ = 0;
@@ -266,6 +311,7 @@ private:
 
     void write_buffer_to_csv(int core_id, int thread_idx, const void *buf_host_ptr);
     void ensure_csv_open_unlocked();
+    void write_summary();
 };
 
 // ---------------------------------------------------------------------------
@@ -297,6 +343,71 @@ inline PmuEventType resolve_pmu_event_type(int requested_event_type) {
     return resolved;
 }
 
+/**
+ * Resolve the event-group rotation from the environment:
+ *
+ *   SIMPLER_PMU_EVENT_GROUPS  Comma-separated PmuEventType values, or "all".
+ *                             Fewer than two valid, distinct groups leaves
+ *                             rotation off.
+ *   SIMPLER_PMU_ROTATE        "task" (default) or "round".
+ */
+inline PmuRotationConfig resolve_pmu_rotation() {
+    PmuRotationConfig cfg;
+    const char *groups_env = std::getenv("SIMPLER_PMU_EVENT_GROUPS");
+    if (groups_env == nullptr || groups_env[0] == '\0') {
+        return cfg;
+    }
+    auto add_group = [&cfg](int val) {
+        if (val <= 0 || pmu_resolve_event_config_a2a3(static_cast<PmuEventType>(val)) == nullptr) {
+            LOG_WARN("Ignoring invalid PMU event group %d in SIMPLER_PMU_EVENT_GROUPS", val);
+            return;
+        }
+        for (uint32_t i = 0; i < cfg.group_count; i++) {
+            if (static_cast<int>(cfg.groups[i]) == val) return;
+        }
+        if (cfg.group_count < static_cast<uint32_t>(PMU_MAX_EVENT_GROUPS)) {
+            cfg.groups[cfg.group_count++] = static_cast<PmuEventType>(val);
+        }
+    };
+    if (std::string(groups_env) == "all") {
+        for (int val = 1; val < PMU_EVENT_TYPE_SLOTS; val++) {
+            if (pmu_resolve_event_config_a2a3(static_cast<PmuEventType>(val)) != nullptr) {
+                add_group(val);
+            }
+        }
+    } else {
+        const char *p = groups_env;
+        while (*p != '\0') {
+            char *end = nullptr;
+            long val = std::strtol(p, &end, 10);
+            if (end == p) {
+                LOG_WARN("Malformed SIMPLER_PMU_EVENT_GROUPS=%s, stopping at '%s'", groups_env, p);
+                break;
+            }
+            add_group(static_cast<int>(val));
+            p = (*end == ',') ? end + 1 : end;
+        }
+    }
+    if (cfg.group_count < 2) {
+        LOG_WARN("SIMPLER_PMU_EVENT_GROUPS=%s names fewer than two groups, rotation disabled", groups_env);
+        cfg.group_count = 0;
+        return cfg;
+    }
+
+    cfg.mode = PmuRotationMode::PER_TASK;
+    const char *rotate_env = std::getenv("SIMPLER_PMU_ROTATE");
+    if (rotate_env != nullptr && std::string(rotate_env) == "round") {
+        cfg.mode = PmuRotationMode::PER_ROUND;
+    } else if (rotate_env != nullptr && rotate_env[0] != '\0' && std::string(rotate_env) != "task") {
+        LOG_WARN("Invalid SIMPLER_PMU_ROTATE=%s, using per-task rotation", rotate_env);
+    }
+    LOG_INFO_V0(
+        "PMU event rotation: %u groups, per-%s", cfg.group_count,
+        cfg.mode == PmuRotationMode::PER_ROUND ? "round" : "task"
+    );
+    return cfg;
+}
+
 /**
  * Build the CSV path under the caller-provided per-task directory. Filename is
  * fixed (no timestamp) — the directory is the per-task uniqueness boundary.
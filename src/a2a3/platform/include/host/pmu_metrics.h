@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file pmu_metrics.h
+ * @brief Per-kernel PMU aggregation, derived metrics, and the columnar summary.
+ *
+ * PmuKernelAggregator folds PmuRecords into one PmuKernelAggregate per
+ * (func_id, core_type). Each aggregate keeps separate sums for every event
+ * group it was sampled under, so records from a multiplexed run (groups
+ * rotated across tasks or rounds) never mix counters of different meaning.
+ *
+ * Derived metrics are ratio estimators: a metric built from group G divides
+ * G's counter sums by the cycles of the tasks that ran under G. Groups are
+ * therefore comparable even when each task only saw one of them. Metrics
+ * whose group was never sampled are NaN.
+ *
+ * encode_columnar() serializes the aggregates as pmu_summary.bin:
+ *
+ *   uint32 magic ("PMUS"), uint32 version, uint32 row_count, uint32 column_count
+ *   column_count x { uint8 dtype, uint8 reserved, uint16 name_len, char name[name_len] }
+ *   zero pad to 8 bytes
+ *   column_count x { row_count values of dtype, zero pad to 8 bytes }
+ *
+ * dtype is PmuColumnType; all values are host-endian (little-endian on every
+ * supported host).
+ */
+
+#ifndef SRC_A2A3_PLATFORM_INCLUDE_HOST_PMU_METRICS_H_
+#define SRC_A2A3_PLATFORM_INCLUDE_HOST_PMU_METRICS_H_
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "common/core_type.h"
+#include "common/pmu_profiling.h"
+
+// Aggregate slots are indexed directly by PmuEventType value (1..8).
+constexpr int PMU_EVENT_TYPE_SLOTS = 9;
+
+// Nominal bytes moved per counted memory request. The MEMORY / MEMORY_UB
+// counters count requests, so bandwidth metrics are request-granular estimates.
+constexpr double PMU_A2A3_MEM_REQ_BYTES = 32.0;
+
+constexpr uint32_t PMU_SUMMARY_MAGIC = 0x53554d50u;  // "PMUS"
+constexpr uint32_t PMU_SUMMARY_VERSION = 1;
+
+enum class PmuColumnType : uint8_t {
+    U32 = 0,
+    U64 = 1,
+    F64 = 2,
+};
+
+enum class PmuMetric : int {
+    CUBE_UTIL = 0,             // PIPE_UTILIZATION: cube_busy / cycles
+    VEC_UTIL,                  // PIPE_UTILIZATION: vec_busy / cycles
+    SCALAR_UTIL,               // PIPE_UTILIZATION: scalar_busy / cycles
+    MTE1_UTIL,                 // PIPE_UTILIZATION: mte1_busy / cycles
+    MTE2_UTIL,                 // PIPE_UTILIZATION: mte2_busy / cycles
+    MTE3_UTIL,                 // PIPE_UTILIZATION: mte3_busy / cycles
+    ICACHE_MISS_RATE,          // PIPE_UTILIZATION: icache_miss / icache_req
+    CUBE_EXEC_RATIO,           // ARITHMETIC_UTILIZATION: cube exec / cycles
+    VEC_EXEC_RATIO,            // ARITHMETIC_UTILIZATION: vector exec / cycles
+    MAIN_MEM_BYTES_PER_CYCLE,  // MEMORY: main read+write requests * bytes / cycles
+    L2_BYTES_PER_CYCLE,        // MEMORY: L2 read+write requests * bytes / cycles
+    MTE_UB_BYTES_PER_CYCLE,    // MEMORY_UB: MTE UB read+write * bytes / cycles
+    BANKGROUP_STALL_RATIO,     // RESOURCE_CONFLICT: bankgroup stalls / cycles
+    BANK_STALL_RATIO,          // RESOURCE_CONFLICT: bank stalls / cycles
+    VEC_CONFLICT_RATIO,        // RESOURCE_CONFLICT: vector resource conflicts / cycles
+    L2_HIT_RATE,               // L2_CACHE: hits / (hits + miss-allocates)
+    OPS_PER_CYCLE,             // Roofline y: (cube + vector exec) / cycles
+    ARITHMETIC_INTENSITY,      // Roofline x: OPS_PER_CYCLE / MAIN_MEM_BYTES_PER_CYCLE
+    COUNT,
+};
+
+constexpr int PMU_METRIC_COUNT = static_cast<int>(PmuMetric::COUNT);
+
+constexpr const char *PMU_METRIC_NAMES[PMU_METRIC_COUNT] = {
+    "cube_util",
+    "vec_util",
+    "scalar_util",
+    "mte1_util",
+    "mte2_util",
+    "mte3_util",
+    "icache_miss_rate",
+    "cube_exec_ratio",
+    "vec_exec_ratio",
+    "main_mem_bytes_per_cycle",
+    "l2_bytes_per_cycle",
+    "mte_ub_bytes_per_cycle",
+    "bankgroup_stall_ratio",
+    "bank_stall_ratio",
+    "vec_conflict_ratio",
+    "l2_hit_rate",
+    "ops_per_cycle",
+    "arithmetic_intensity",
+};
+
+/**
+ * Counter sums for one (kernel, event group) pair.
+ */
+struct PmuGroupTotals {
+    uint64_t samples = 0;
+    uint64_t cycles = 0;
+    uint64_t counters[PMU_COUNTER_COUNT_A2A3] = {};
+
+    /**
+     * Sum of the counter named `name` in `evt`, or -1 when the group does not
+     * carry that counter.
+     */
+    double counter(const PmuEventConfig &evt, const char *name) const {
+        for (int i = 0; i < PMU_COUNTER_COUNT_A2A3; i++) {
+            if (std::strcmp(evt.counter_names[i], name) == 0) {
+                return static_cast<double>(counters[i]);
+            }
+        }
+        return -1.0;
+    }
+};
+
+struct PmuKernelAggregate {
+    uint32_t func_id = 0;
+    CoreType core_type = CoreType::AIC;
+    PmuGroupTotals groups[PMU_EVENT_TYPE_SLOTS];
+
+    uint64_t tasks() const {
+        uint64_t n = 0;
+        for (const PmuGroupTotals &g : groups) {
+            n += g.samples;
+        }
+        return n;
+    }
+
+    uint64_t cycles() const {
+        uint64_t n = 0;
+        for (const PmuGroupTotals &g : groups) {
+            n += g.cycles;
+        }
+        return n;
+    }
+
+    // Bit `t` is set when event type `t` contributed at least one sample.
+    uint32_t group_mask() const {
+        uint32_t mask = 0;
+        for (int t = 0; t < PMU_EVENT_TYPE_SLOTS; t++) {
+            if (groups[t].samples != 0) {
+                mask |= 1u << t;
+            }
+        }
+        return mask;
+    }
+
+    const PmuGroupTotals *sampled(PmuEventType type) const {
+        const PmuGroupTotals &g = groups[static_cast<uint32_t>(type)];
+        return (g.samples != 0 && g.cycles != 0) ? &g : nullptr;
+    }
+};
+
+/**
+ * Derived metrics for one kernel. Entries are NaN when the event group they
+ * need was never sampled.
+ */
+inline void pmu_derive_metrics(const PmuKernelAggregate &agg, double out[PMU_METRIC_COUNT]) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (int i = 0; i < PMU_METRIC_COUNT; i++) {
+        out[i] = nan;
+    }
+    auto set = [out](PmuMetric m, double v) {
+        out[static_cast<int>(m)] = v;
+    };
+    // Ratio of named counters over the group's own cycles; NaN if any is absent.
+    using Names = std::initializer_list<const char *>;
+    auto per_cycle = [](const PmuGroupTotals &g, const PmuEventConfig &evt, Names names) {
+        double sum = 0.0;
+        for (const char *name : names) {
+            double v = g.counter(evt, name);
+            if (v < 0.0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            sum += v;
+        }
+        return sum / static_cast<double>(g.cycles);
+    };
+
+    if (const PmuGroupTotals *g = agg.sampled(PmuEventType::PIPE_UTILIZATION)) {
+        const PmuEventConfig &evt = PMU_EVENTS_A2A3_PIPE_UTIL;
+        set(PmuMetric::CUBE_UTIL, per_cycle(*g, evt, {"cube_busy_cycles"}));
+        set(PmuMetric::VEC_UTIL, per_cycle(*g, evt, {"vec_busy_cycles"}));
+        set(PmuMetric::SCALAR_UTIL, per_cycle(*g, evt, {"scalar_busy_cycles"}));
+        set(PmuMetric::MTE1_UTIL, per_cycle(*g, evt, {"mte1_busy_cycles"}));
+        set(PmuMetric::MTE2_UTIL, per_cycle(*g, evt, {"mte2_busy_cycles"}));
+        set(PmuMetric::MTE3_UTIL, per_cycle(*g, evt, {"mte3_busy_cycles"}));
+        double req = g->counter(evt, "icache_req");
+        if (req > 0.0) {
+            set(PmuMetric::ICACHE_MISS_RATE, g->counter(evt, "icache_miss") / req);
+        }
+    }
+
+    if (const PmuGroupTotals *g = agg.sampled(PmuEventType::ARITHMETIC_UTILIZATION)) {
+        const PmuEventConfig &evt = PMU_EVENTS_A2A3_ARITHMETIC;
+        double cube = per_cycle(*g, evt, {"cube_fp16_exec", "cube_int8_exec"});
+        double vec = per_cycle(
+            *g, evt,
+            {"vec_fp32_exec", "vec_fp16_128lane_exec", "vec_fp16_64lane_exec", "vec_int32_exec", "vec_misc_exec"}
+        );
+        set(PmuMetric::CUBE_EXEC_RATIO, cube);
+        set(PmuMetric::VEC_EXEC_RATIO, vec);
+        set(PmuMetric::OPS_PER_CYCLE, cube + vec);
+    }
+
+    if (const PmuGroupTotals *g = agg.sampled(PmuEventType::MEMORY)) {
+        const PmuEventConfig &evt = PMU_EVENTS_A2A3_MEMORY;
+        double main_req = per_cycle(*g, evt, {"main_read_req", "main_write_req"});
+        double l2_req = per_cycle(*g, evt, {"l2_read_req", "l2_write_req"});
+        set(PmuMetric::MAIN_MEM_BYTES_PER_CYCLE, main_req * PMU_A2A3_MEM_REQ_BYTES);
+        set(PmuMetric::L2_BYTES_PER_CYCLE, l2_req * PMU_A2A3_MEM_REQ_BYTES);
+    }
+
+    if (const PmuGroupTotals *g = agg.sampled(PmuEventType::MEMORY_UB)) {
+        double mte_req = per_cycle(*g, PMU_EVENTS_A2A3_MEMORY_UB, {"ub_read_bw_mte", "ub_write_bw_mte"});
+        set(PmuMetric::MTE_UB_BYTES_PER_CYCLE, mte_req * PMU_A2A3_MEM_REQ_BYTES);
+    }
+
+    if (const PmuGroupTotals *g = agg.sampled(PmuEventType::RESOURCE_CONFLICT)) {
+        const PmuEventConfig &evt = PMU_EVENTS_A2A3_RESOURCE_CONFLICT;
+        set(PmuMetric::BANKGROUP_STALL_RATIO, per_cycle(*g, evt, {"bankgroup_stall_cycles"}));
+        set(PmuMetric::BANK_STALL_RATIO, per_cycle(*g, evt, {"bank_stall_cycles"}));
+        set(PmuMetric::VEC_CONFLICT_RATIO, per_cycle(*g, evt, {"vec_resc_conflict_cycles"}));
+    }
+
+    if (const PmuGroupTotals *g = agg.sampled(PmuEventType::L2_CACHE)) {
+        const PmuEventConfig &evt = PMU_EVENTS_A2A3_L2_CACHE;
+        double hits = g->counter(evt, "write_cache_hit") + g->counter(evt, "r0_read_cache_hit") +
+                      g->counter(evt, "r1_read_cache_hit");
+        double misses = g->counter(evt, "write_cache_miss_allocate") + g->counter(evt, "r0_read_cache_miss_allocate") +
+                        g->counter(evt, "r1_read_cache_miss_allocate");
+        if (hits + misses > 0.0) {
+            set(PmuMetric::L2_HIT_RATE, hits / (hits + misses));
+        }
+    }
+
+    double ops = out[static_cast<int>(PmuMetric::OPS_PER_CYCLE)];
+    double bytes = out[static_cast<int>(PmuMetric::MAIN_MEM_BYTES_PER_CYCLE)];
+    if (!std::isnan(ops) && !std::isnan(bytes) && bytes > 0.0) {
+        set(PmuMetric::ARITHMETIC_INTENSITY, ops / bytes);
+    }
+}
+
+class PmuKernelAggregator {
+public:
+    /**
+     * Fold one record in. Records whose event_type has no a2a3 event table
+     * are ignored (they carry counters of unknown meaning).
+     */
+    void add(const PmuRecord &r) {
+        if (r.event_type == 0 || r.event_type >= static_cast<uint32_t>(PMU_EVENT_TYPE_SLOTS) ||
+            pmu_resolve_event_config_a2a3(static_cast<PmuEventType>(r.event_type)) == nullptr) {
+            return;
+        }
+        auto key = std::make_pair(r.func_id, static_cast<int32_t>(r.core_type));
+        PmuKernelAggregate &agg = kernels_[key];
+        agg.func_id = r.func_id;
+        agg.core_type = r.core_type;
+        PmuGroupTotals &g = agg.groups[r.event_type];
+        g.samples += 1;
+        g.cycles += r.pmu_total_cycles;
+        for (int i = 0; i < PMU_COUNTER_COUNT_A2A3; i++) {
+            g.counters[i] += r.pmu_counters[i];
+        }
+    }
+
+    void clear() { kernels_.clear(); }
+    bool empty() const { return kernels_.empty(); }
+    size_t size() const { return kernels_.size(); }
+
+    // Aggregates ordered by (func_id, core_type).
+    std::vector<const PmuKernelAggregate *> kernels() const {
+        std::vector<const PmuKernelAggregate *> out;
+        out.reserve(kernels_.size());
+        for (const auto &kv : kernels_) {
+            out.push_back(&kv.second);
+        }
+        return out;
+    }
+
+    /**
+     * Serialize every aggregate as one row of the pmu_summary.bin layout
+     * described in the file comment.
+     */
+    std::vector<uint8_t> encode_columnar() const {
+        std::vector<const PmuKernelAggregate *> rows = kernels();
+        const uint32_t row_count = static_cast<uint32_t>(rows.size());
+
+        struct Column {
+            const char *name;
+            PmuColumnType type;
+        };
+        std::vector<Column> columns = {
+            {"func_id", PmuColumnType::U32},      {"core_type", PmuColumnType::U32},
+            {"tasks", PmuColumnType::U64},        {"total_cycles", PmuColumnType::U64},
+            {"group_mask", PmuColumnType::U32},
+        };
+        for (int m = 0; m < PMU_METRIC_COUNT; m++) {
+            columns.push_back({PMU_METRIC_NAMES[m], PmuColumnType::F64});
+        }
+
+        std::vector<uint8_t> out;
+        auto put = [&out](const void *p, size_t n) {
+            const uint8_t *b = static_cast<const uint8_t *>(p);
+            out.insert(out.end(), b, b + n);
+        };
+        auto put_u32 = [&put](uint32_t v) {
+            put(&v, sizeof(v));
+        };
+        auto align8 = [&out]() {
+            out.resize((out.size() + 7) & ~static_cast<size_t>(7), 0);
+        };
+
+        put_u32(PMU_SUMMARY_MAGIC);
+        put_u32(PMU_SUMMARY_VERSION);
+        put_u32(row_count);
+        put_u32(static_cast<uint32_t>(columns.size()));
+        for (const Column &c : columns) {
+            uint8_t type = static_cast<uint8_t>(c.type);
+            uint8_t reserved = 0;
+            uint16_t len = static_cast<uint16_t>(std::strlen(c.name));
+            put(&type, 1);
+            put(&reserved, 1);
+            put(&len, sizeof(len));
+            put(c.name, len);
+        }
+        align8();
+
+        std::vector<double> metrics(static_cast<size_t>(row_count) * PMU_METRIC_COUNT);
+        for (uint32_t r = 0; r < row_count; r++) {
+            pmu_derive_metrics(*rows[r], &metrics[static_cast<size_t>(r) * PMU_METRIC_COUNT]);
+        }
+        for (uint32_t r = 0; r < row_count; r++) put_u32(rows[r]->func_id);
+        align8();
+        for (uint32_t r = 0; r < row_count; r++) put_u32(static_cast<uint32_t>(rows[r]->core_type));
+        align8();
+        for (uint32_t r = 0; r < row_count; r++) {
+            uint64_t v = rows[r]->tasks();
+            put(&v, sizeof(v));
+        }
+        for (uint32_t r = 0; r < row_count; r++) {
+            uint64_t v = rows[r]->cycles();
+            put(&v, sizeof(v));
+        }
+        for (uint32_t r = 0; r < row_count; r++) put_u32(rows[r]->group_mask());
+        align8();
+        for (int m = 0; m < PMU_METRIC_COUNT; m++) {
+            for (uint32_t r = 0; r < row_count; r++) {
+                put(&metrics[static_cast<size_t>(r) * PMU_METRIC_COUNT + m], sizeof(double));
+            }
+        }
+        return out;
+    }
+
+private:
+    std::map<std::pair<uint32_t, int32_t>, PmuKernelAggregate> kernels_;
+};
+
+#endif  // SRC_A2A3_PLATFORM_INCLUDE_HOST_PMU_METRICS_H_
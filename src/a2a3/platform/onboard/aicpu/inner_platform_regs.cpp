@@ -15,8 +15,8 @@
  * a2a3 sim and onboard share the same register layout, so read_reg /
  * write_reg live in the shared src/aicpu/platform_regs.cpp. This file
  * exists only for the deinit-timeout split where onboard keeps the
- * legacy 1 s budget while sim widens it — see platform_regs.h for the
- * rationale.
+ * legacy 1 s budget while sim widens it, and for the PMU counter source
+ * that sim synthesizes — see platform_regs.h for the rationale.
  */
 
 #include <cstdint>
@@ -34,3 +34,11 @@
  * @return Timeout in profiling system-counter ticks.
  */
 uint64_t inner_get_deinit_timeout_ticks() { return PLATFORM_PROF_SYS_CNT_FREQ; }
+
+/**
+ * @brief PMU counters on real hardware come from the silicon; nothing to do.
+ */
+void inner_pmu_synthesize_counters(
+    uint64_t /*reg_base*/, const uint32_t * /*event_ids*/, uint64_t /*task_id*/, uint32_t /*func_id*/,
+    CoreType /*core_type*/
+) {}
@@ -211,6 +211,7 @@ int DeviceRunner::run(Runtime &runtime, int block_dim, int launch_aicpu_num) {
     }
 
     ensure_device_wall_buffer();
+    ensure_flight_recorder_buffer();
 
     block_dim = resolve_block_dim(block_dim);
     if (block_dim < 0) return -1;
@@ -816,7 +817,8 @@ int DeviceRunner::init_l2_swimlane(int num_aicore, int aicpu_thread_num, int dev
     };
 
     int rc = l2_swimlane_collector_.initialize(
-        num_aicore, aicpu_thread_num, device_id, l2_swimlane_level_, alloc_cb, register_cb, free_cb, output_prefix_
+        num_aicore, aicpu_thread_num, device_id, l2_swimlane_level_, enable_l2_edges_, alloc_cb, register_cb, free_cb,
+        output_prefix_
     );
     if (rc != 0) {
         return rc;
@@ -21,6 +21,12 @@
  *   - Per-thread ready_queue: AICPU enqueues full buffers for host collection.
  *   - On free_queue empty or ready_queue full: overwrite current buffer (data lost,
  *     avoids blocking the AICPU dispatch loop).
+ *
+ * Event rotation (PmuRotationMode::PER_TASK): each core walks the header's
+ * event_groups round-robin, starting at core_id % group_count so concurrent
+ * cores cover different groups. The selectors are reprogrammed right after a
+ * task's counters are read; PMU runs single-issue dispatch, so the next task
+ * on that core has not started yet.
  */
 
 #include "aicpu/pmu_collector_aicpu.h"
@@ -47,6 +53,12 @@ static PmuDataHeader *s_pmu_header = nullptr;
 // Populated by pmu_aicpu_init(); 0 means "no PMU for this core" (sim).
 static uint64_t s_pmu_reg_addrs[PLATFORM_MAX_CORES] = {0};
 
+// Event groups to rotate through (PER_TASK only; count 1 otherwise) and each
+// core's position in that list.
+static PmuEventType s_pmu_groups[PMU_MAX_EVENT_GROUPS];
+static uint32_t s_pmu_group_count = 1;
+static uint32_t s_pmu_core_group[PLATFORM_MAX_CORES];
+
 extern "C" void set_platform_pmu_base(uint64_t pmu_data_base) { g_platform_pmu_base = pmu_data_base; }
 
 extern "C" uint64_t get_platform_pmu_base() { return g_platform_pmu_base; }
@@ -186,8 +198,26 @@ void pmu_aicpu_init(const uint32_t *physical_core_ids, int num_cores) {
 
     s_pmu_header = get_pmu_header(pmu_base);
 
-    // Read event_type from SHM header (written by host at init)
+    // Read event_type and the rotation plan from SHM header (written by host at init)
     uint32_t pmu_event_type = s_pmu_header->event_type;
+    if (pmu_resolve_event_config_a2a3(static_cast<PmuEventType>(pmu_event_type)) == nullptr) {
+        pmu_event_type = PMU_EVENT_TYPE_DEFAULT;
+    }
+    s_pmu_groups[0] = static_cast<PmuEventType>(pmu_event_type);
+    s_pmu_group_count = 1;
+    if (s_pmu_header->rotation_mode == static_cast<uint32_t>(PmuRotationMode::PER_TASK)) {
+        uint32_t n = s_pmu_header->group_count;
+        uint32_t valid = 0;
+        for (uint32_t g = 0; g < n && g < static_cast<uint32_t>(PMU_MAX_EVENT_GROUPS); g++) {
+            PmuEventType type = static_cast<PmuEventType>(s_pmu_header->event_groups[g]);
+            if (pmu_resolve_event_config_a2a3(type) != nullptr) {
+                s_pmu_groups[valid++] = type;
+            }
+        }
+        if (valid > 0) {
+            s_pmu_group_count = valid;
+        }
+    }
 
     // Resolve per-core PMU MMIO base from physical_core_ids. 0 means "no PMU
     // for this core" (sim or misconfigured) — subsequent record/stop become no-ops.
@@ -201,17 +231,14 @@ void pmu_aicpu_init(const uint32_t *physical_core_ids, int num_cores) {
     }
 
     // Program event selectors and start PMU counters on all cores
-    const PmuEventConfig *evt = pmu_resolve_event_config_a2a3(static_cast<PmuEventType>(pmu_event_type));
-    if (evt == nullptr) {
-        evt = &PMU_EVENTS_A2A3_PIPE_UTIL;
-    }
-    for (int i = 0; i < num_cores; i++) {
+    for (int i = 0; i < num_cores && i < PLATFORM_MAX_CORES; i++) {
+        s_pmu_core_group[i] = static_cast<uint32_t>(i) % s_pmu_group_count;
         uint64_t reg_addr = s_pmu_reg_addrs[i];
         if (reg_addr == 0) {
             LOG_WARN("pmu_aicpu_init: core %d has no PMU reg_addr, skipping (sim or misconfigured)", i);
             continue;
         }
-        pmu_program_events(reg_addr, *evt);
+        pmu_program_events(reg_addr, *pmu_resolve_event_config_a2a3(s_pmu_groups[s_pmu_core_group[i]]));
         g_pmu_saved_ctrl0[i] = pmu_start(reg_addr);
     }
 
@@ -243,7 +270,9 @@ void pmu_aicpu_init(const uint32_t *physical_core_ids, int num_cores) {
     }
 
     wmb();
-    LOG_INFO_V0("PMU initialized: %d cores, event_type=%u", num_cores, pmu_event_type);
+    LOG_INFO_V0(
+        "PMU initialized: %d cores, event_type=%u, event_groups=%u", num_cores, pmu_event_type, s_pmu_group_count
+    );
 }
 
 void pmu_aicpu_record_task(int core_id, int thread_idx, uint64_t task_id, uint32_t func_id, CoreType core_type) {
@@ -288,12 +317,22 @@ void pmu_aicpu_record_task(int core_id, int thread_idx, uint64_t task_id, uint32
 
     uint32_t idx = pmu_buf->count;
     PmuRecord *rec = &pmu_buf->records[idx];
+    PmuEventType type = s_pmu_groups[s_pmu_core_group[core_id]];
+    const PmuEventConfig *evt = pmu_resolve_event_config_a2a3(type);
     rec->task_id = task_id;
     rec->func_id = func_id;
     rec->core_type = core_type;
+    rec->event_type = static_cast<uint32_t>(type);
+    inner_pmu_synthesize_counters(reg_addr, evt->event_ids, task_id, func_id, core_type);
     pmu_read_counters(reg_addr, rec);
     pmu_buf->count = idx + 1;
     wmb();
+
+    if (s_pmu_group_count > 1) {
+        uint32_t next = (s_pmu_core_group[core_id] + 1) % s_pmu_group_count;
+        s_pmu_core_group[core_id] = next;
+        pmu_program_events(reg_addr, *pmu_resolve_event_config_a2a3(s_pmu_groups[next]));
+    }
 }
 
 void pmu_aicpu_flush_buffers(int thread_idx, const int *cur_thread_cores, int core_num) {
@@ -14,7 +14,8 @@
  * @brief Host-side PMU collector. The mgmt-thread + buffer-pool machinery
  *        lives in profiling_common::BufferPoolManager parameterized by
  *        PmuModule (host/pmu_collector.h); this file owns the per-buffer
- *        on_buffer_collected callback (CSV output) and the device-side
+ *        on_buffer_collected callback (CSV output + per-kernel
+ *        aggregation), the pmu_summary.bin export, and the device-side
  *        cross-check. The poll loop itself lives in
  *        profiling_common::ProfilerBase.
  */
@@ -45,6 +46,19 @@ int PmuCollector::init(
         return -1;
     }
 
+    rotation_ = resolve_pmu_rotation();
+    if (rotation_.mode == PmuRotationMode::PER_ROUND) {
+        event_type = rotation_.groups[round_cursor_ % rotation_.group_count];
+        round_cursor_++;
+    }
+
+    // A PER_ROUND series continues while the runner keeps writing to the same
+    // output directory; anything else starts a fresh CSV and fresh aggregates.
+    csv_append_ = rotation_.mode == PmuRotationMode::PER_ROUND && csv_path == csv_path_ && !aggregates_.empty();
+    if (!csv_append_) {
+        aggregates_.clear();
+    }
+
     num_cores_ = num_cores;
     num_threads_ = num_threads;
     event_type_ = event_type;
@@ -82,6 +96,11 @@ int PmuCollector::init(
     PmuDataHeader *hdr = get_pmu_header(shm_host_);
     hdr->event_type = static_cast<uint32_t>(event_type);
     hdr->num_cores = static_cast<uint32_t>(num_cores);
+    hdr->rotation_mode = static_cast<uint32_t>(rotation_.mode);
+    hdr->group_count = rotation_.group_count;
+    for (uint32_t i = 0; i < rotation_.group_count; i++) {
+        hdr->event_groups[i] = static_cast<uint32_t>(rotation_.groups[i]);
+    }
 
     // ---- Allocate per-core PmuBuffers and populate free_queues + recycled pool ----
     const size_t buf_size = sizeof(PmuBuffer);
@@ -126,19 +145,27 @@ int PmuCollector::init(
     }
 
     // ---- Build CSV header string ----
+    // With rotation active the meaning of each counter slot changes per row,
+    // so the columns are the raw slots and the row's event_type names them.
     {
         std::string header = "thread_id,core_id,task_id,func_id,core_type,pmu_total_cycles";
-        const PmuEventConfig *evt = pmu_resolve_event_config_a2a3(event_type);
-        if (evt == nullptr) {
-            evt = &PMU_EVENTS_A2A3_PIPE_UTIL;
-        }
-        for (int i = 0; i < PMU_COUNTER_COUNT_A2A3; i++) {
-            const char *name = evt->counter_names[i];
-            if (name == nullptr || name[0] == '\0') {
-                continue;
+        if (rotation_.mode != PmuRotationMode::NONE) {
+            for (int i = 0; i < PMU_COUNTER_COUNT_A2A3; i++) {
+                header += ",counter" + std::to_string(i);
+            }
+        } else {
+            const PmuEventConfig *evt = pmu_resolve_event_config_a2a3(event_type);
+            if (evt == nullptr) {
+                evt = &PMU_EVENTS_A2A3_PIPE_UTIL;
+            }
+            for (int i = 0; i < PMU_COUNTER_COUNT_A2A3; i++) {
+                const char *name = evt->counter_names[i];
+                if (name == nullptr || name[0] == '\0') {
+                    continue;
+                }
+                header += ',';
+                header += name;
             }
-            header += ',';
-            header += name;
         }
         header += ",event_type\n";
         csv_header_ = std::move(header);
@@ -167,12 +194,14 @@ int PmuCollector::init(
 
 void PmuCollector::ensure_csv_open_unlocked() {
     if (csv_file_.is_open()) return;
-    csv_file_.open(csv_path_, std::ios::out | std::ios::trunc);
+    csv_file_.open(csv_path_, std::ios::out | (csv_append_ ? std::ios::app : std::ios::trunc));
     if (!csv_file_.is_open()) {
         LOG_ERROR("PmuCollector: failed to open CSV file: %s", csv_path_.c_str());
         return;
     }
-    csv_file_ << csv_header_;
+    if (!csv_append_) {
+        csv_file_ << csv_header_;
+    }
 }
 
 void PmuCollector::write_buffer_to_csv(int core_id, int thread_idx, const void *buf_host_ptr) {
@@ -188,26 +217,53 @@ void PmuCollector::write_buffer_to_csv(int core_id, int thread_idx, const void *
     if (!csv_file_.is_open()) return;
     total_collected_ += n;
 
+    const bool rotating = rotation_.mode != PmuRotationMode::NONE;
     const PmuEventConfig *evt = pmu_resolve_event_config_a2a3(event_type_);
     if (evt == nullptr) {
         evt = &PMU_EVENTS_A2A3_PIPE_UTIL;
     }
+    // No per-buffer flush: the stream is flushed when finalize() closes it,
+    // which keeps the poll thread off the filesystem between buffers.
     for (uint32_t i = 0; i < n; i++) {
         const PmuRecord &r = buf->records[i];
+        aggregates_.add(r);
+
         csv_file_ << thread_idx << ',' << core_id << ',';
         csv_file_ << "0x" << std::hex << std::setw(16) << std::setfill('0') << r.task_id << std::dec
                   << std::setfill(' ');
         csv_file_ << ',' << r.func_id << ',' << static_cast<int>(r.core_type) << ',' << r.pmu_total_cycles;
         for (int k = 0; k < PMU_COUNTER_COUNT_A2A3; k++) {
             const char *name = evt->counter_names[k];
-            if (name == nullptr || name[0] == '\0') {
+            if (!rotating && (name == nullptr || name[0] == '\0')) {
                 continue;
             }
             csv_file_ << ',' << r.pmu_counters[k];
         }
-        csv_file_ << ',' << static_cast<uint32_t>(event_type_) << '\n';
+        csv_file_ << ',' << r.event_type << '\n';
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Summary export
+// ---------------------------------------------------------------------------
+
+void PmuCollector::write_summary() {
+    std::scoped_lock<std::mutex> lock(csv_mutex_);
+    if (aggregates_.empty()) return;
+
+    std::filesystem::path path = std::filesystem::path(csv_path_).parent_path() / "pmu_summary.bin";
+    std::vector<uint8_t> bytes = aggregates_.encode_columnar();
+    std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        LOG_ERROR("PmuCollector: failed to open summary file: %s", path.string().c_str());
+        return;
+    }
+    out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    if (!out) {
+        LOG_ERROR("PmuCollector: failed to write summary file: %s", path.string().c_str());
+        return;
     }
-    csv_file_.flush();
+    LOG_INFO_V0("PMU summary: %zu kernels written to %s", aggregates_.size(), path.string().c_str());
 }
 
 // ---------------------------------------------------------------------------
@@ -307,6 +363,7 @@ void PmuCollector::finalize(PmuUnregisterCallback unregister_cb, const PmuFreeCa
     if (csv_file_.is_open()) {
         csv_file_.close();
     }
+    write_summary();
 
     // Release per-buffer mappings tracked by the framework. PMU registered
     // each PmuBuffer individually at init time (when register_cb was set), so
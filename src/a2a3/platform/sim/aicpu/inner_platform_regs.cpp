@@ -15,12 +15,15 @@
  * a2a3 sim and onboard share the same register layout, so read_reg /
  * write_reg live in the shared src/aicpu/platform_regs.cpp. This file
  * exists only for the deinit-timeout split where sim wants a much wider
- * budget than onboard — see platform_regs.h for the rationale.
+ * budget than onboard, and for the synthetic PMU counter source (the sim
+ * PMU register block is plain memory nothing else writes) — see
+ * platform_regs.h for the rationale.
  */
 
 #include <cstdint>
 #include "aicpu/platform_regs.h"
 #include "common/platform_config.h"
+#include "common/pmu_profiling.h"
 
 /**
  * @brief Deinit ACK-wait budget on sim: 10 s.
@@ -33,3 +36,81 @@
  * @return Timeout in profiling system-counter ticks.
  */
 uint64_t inner_get_deinit_timeout_ticks() { return 10 * PLATFORM_PROF_SYS_CNT_FREQ; }
+
+namespace {
+
+uint64_t sim_pmu_mix(uint64_t x) {
+    // splitmix64 finalizer: cheap, stateless, well-spread.
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * Share of a task's cycles, in 1/1024ths, that the synthetic model charges to
+ * `event_id`. Known DAV_2201 events get a shape that respects the core type
+ * (no cube activity on AIV, no vector activity on AIC); anything else gets a
+ * small per-kernel pseudo-random share.
+ */
+uint32_t sim_pmu_event_share(uint32_t event_id, CoreType core_type, uint32_t func_id) {
+    const bool aic = core_type == CoreType::AIC;
+    switch (event_id) {
+    case 0x08:  // vec_busy_cycles
+        return aic ? 0 : 620;
+    case 0x0a:  // cube_busy_cycles
+    case 0x49:  // cube_fp16_exec
+        return aic ? 660 : 0;
+    case 0x09:  // scalar_busy_cycles
+        return 90;
+    case 0x0b:  // mte1_busy_cycles
+        return aic ? 310 : 0;
+    case 0x0c:  // mte2_busy_cycles
+        return 400;
+    case 0x0d:  // mte3_busy_cycles
+        return 170;
+    case 0x54:  // icache_req
+        return 48;
+    case 0x55:  // icache_miss
+        return 3;
+    case 0x4a:  // cube_int8_exec
+        return 0;
+    case 0x4b:  // vec_fp32_exec
+    case 0x4c:  // vec_fp16_128lane_exec
+    case 0x4d:  // vec_fp16_64lane_exec
+    case 0x4e:  // vec_int32_exec
+    case 0x4f:  // vec_misc_exec
+        return aic ? 0 : 110;
+    case 0x66:  // vec_resc_conflict_cycles
+        return aic ? 0 : 45;
+    case 0x0:  // unused slot
+        return 0;
+    default:
+        return 16 + static_cast<uint32_t>(sim_pmu_mix((static_cast<uint64_t>(func_id) << 32) | event_id) & 0xff);
+    }
+}
+
+}  // namespace
+
+/**
+ * @brief Synthetic PMU counters for sim.
+ *
+ * Total cycles are a per-kernel base (from func_id) plus a small per-task
+ * jitter; each counter is the event's share of that total scaled by a
+ * per-kernel factor in [7/8, 9/8). Values are written straight into the
+ * simulated register block so pmu_read_counters() reads them the same way
+ * it reads silicon.
+ */
+void inner_pmu_synthesize_counters(
+    uint64_t reg_base, const uint32_t *event_ids, uint64_t task_id, uint32_t func_id, CoreType core_type
+) {
+    uint64_t kernel_seed = sim_pmu_mix(func_id);
+    uint64_t total = 2048 + kernel_seed % 6144 + sim_pmu_mix(task_id) % 128;
+    uint64_t scale = 896 + (kernel_seed >> 32) % 256;
+    for (int i = 0; i < PMU_COUNTER_COUNT_A2A3; i++) {
+        uint64_t share = sim_pmu_event_share(event_ids[i], core_type, func_id);
+        write_reg(reg_base, reg_index(RegId::PMU_CNT0, i), total * share / 1024 * scale / 1024);
+    }
+    write_reg(reg_base, RegId::PMU_CNT_TOTAL0, total & 0xffffffffULL);
+    write_reg(reg_base, RegId::PMU_CNT_TOTAL1, total >> 32);
+}
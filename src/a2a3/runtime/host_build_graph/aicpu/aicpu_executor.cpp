@@ -28,6 +28,7 @@
 #include "common/unified_log.h"
 #include "runtime.h"
 #include "spin_hint.h"
+#include "wave_plan.h"
 
 #ifndef unlikely
 #define unlikely(x) __builtin_expect(!!(x), 0)
@@ -113,12 +114,20 @@ struct AicpuExecutor {
     // ===== Performance profiling state =====
     uint64_t dispatch_timestamps_[RUNTIME_MAX_WORKER];  // Per-core AICPU dispatch timestamp
 
+    // ===== Static wave schedule state (see wave_plan.h) =====
+    bool wave_plan_active_{false};
+    WavePlanView wave_plan_{};
+    int core_type_index_[MAX_CORES];           // worker_id -> index in aic_cores_ / aiv_cores_
+    std::atomic<uint32_t> wave_arrivals_{0};  // Monotonic: wave w is done at (w + 1) * aicpu_thread_num_
+
     // ===== Methods =====
     int init(Runtime *runtime);
     int handshake_all_cores(Runtime *runtime);
     void assign_cores_to_threads();
     void classify_and_distribute_initial_tasks(Runtime *runtime);
+    bool select_wave_plan(Runtime *runtime);
     int resolve_and_dispatch(Runtime &runtime, int thread_idx, const int *cur_thread_cores, int core_num);
+    int run_wave_plan(Runtime &runtime, int thread_idx, const int *cur_thread_cores, int core_num);
     int shutdown_aicore(Runtime *runtime, int thread_idx, const int *cur_thread_cores);
     int run(Runtime *runtime);
     void deinit(Runtime *runtime);
@@ -359,7 +368,11 @@ int AicpuExecutor::init(Runtime *runtime) {
     }
 
     assign_cores_to_threads();
-    classify_and_distribute_initial_tasks(runtime);
+    wave_plan_active_ = select_wave_plan(runtime);
+    if (!wave_plan_active_) {
+        classify_and_distribute_initial_tasks(runtime);
+    }
+    wave_arrivals_.store(0, std::memory_order_release);
 
     total_tasks_.store(runtime->get_task_count(), std::memory_order_release);
     completed_tasks_.store(0, std::memory_order_release);
@@ -461,12 +474,14 @@ int AicpuExecutor::handshake_all_cores(Runtime *runtime) {
         CoreType type = hank->core_type;
 
         if (type == CoreType::AIC) {
+            core_type_index_[i] = aic_count_;
             aic_cores_[aic_count_].worker_id = i;
             aic_cores_[aic_count_].physical_core_id = physical_core_id;
             aic_cores_[aic_count_].reg_addr = reg_addr;
             aic_cores_[aic_count_].core_type = type;
             aic_count_++;
         } else if (type == CoreType::AIV) {
+            core_type_index_[i] = aiv_count_;
             aiv_cores_[aiv_count_].worker_id = i;
             aiv_cores_[aiv_count_].physical_core_id = physical_core_id;
             aiv_cores_[aiv_count_].reg_addr = reg_addr;
@@ -646,6 +661,52 @@ void AicpuExecutor::classify_and_distribute_initial_tasks(Runtime *runtime) {
     }
 }
 
+/**
+ * Decide whether this run executes the host-built wave plan.
+ *
+ * Falls back to dynamic dispatch when no plan was uploaded, when it does not
+ * match the task table, when it needs a core type that was not discovered,
+ * or when any per-task profiling hook is on (those live in the dynamic loop).
+ */
+bool AicpuExecutor::select_wave_plan(Runtime *runtime) {
+    void *storage = runtime->get_wave_plan_storage();
+    if (storage == nullptr) {
+        return false;
+    }
+
+    bool profiling = is_l2_swimlane_enabled();
+#if PTO2_PROFILING
+    profiling = profiling || is_pmu_enabled() || is_dump_args_enabled();
+#endif
+    if (profiling) {
+        LOG_INFO_V0("Wave plan present but profiling is enabled; using dynamic dispatch");
+        return false;
+    }
+
+    if (!wave_plan_view(storage, runtime->get_wave_plan_storage_bytes(), &wave_plan_)) {
+        LOG_WARN("Wave plan storage is malformed; using dynamic dispatch");
+        return false;
+    }
+    const WavePlanHeader *header = wave_plan_.header;
+    if (static_cast<int>(header->task_count) != runtime->get_task_count()) {
+        LOG_WARN(
+            "Wave plan covers %u tasks but runtime has %d; using dynamic dispatch", header->task_count,
+            runtime->get_task_count()
+        );
+        return false;
+    }
+    if ((header->aic_task_count > 0 && aic_count_ == 0) || (header->aiv_task_count > 0 && aiv_count_ == 0)) {
+        LOG_WARN(
+            "Wave plan needs AIC=%u AIV=%u tasks but only %d AIC / %d AIV cores; using dynamic dispatch",
+            header->aic_task_count, header->aiv_task_count, aic_count_, aiv_count_
+        );
+        return false;
+    }
+
+    LOG_INFO_V0("Init: Using wave plan (%u tasks in %u waves)", header->task_count, header->wave_count);
+    return true;
+}
+
 /**
  * Shutdown AICore - Send quit signal to all AICore kernels
  */
@@ -1084,6 +1145,118 @@ int AicpuExecutor::resolve_and_dispatch(Runtime &runtime, int thread_idx, const
     return cur_thread_completed;
 }
 
+/**
+ * Execute the host-built wave plan.
+ *
+ * Each core owns a fixed stride of lanes in every wave (see wave_plan.h), so a
+ * thread only dispatches onto its own cores and polls their COND registers.
+ * Dispatch is pipelined through the pending/running slots exactly like the
+ * dynamic loop, minus dependency resolution: once every owned core has run
+ * out of lanes and gone idle, the thread arrives at the wave barrier and
+ * waits for the other threads before starting the next wave.
+ */
+int AicpuExecutor::run_wave_plan(Runtime &runtime, int thread_idx, const int *cur_thread_cores, int core_num) {
+    Handshake *hank = reinterpret_cast<Handshake *>(runtime.workers);
+    const WavePlanHeader *header = wave_plan_.header;
+    const int32_t *task_ids = wave_plan_.task_ids;
+
+    const int MAX_IDLE_ITERATIONS = 50000000;
+    int cur_thread_completed = 0;
+    int next_lane[MAX_CORES_PER_THREAD];
+
+    LOG_INFO_V0("Thread %d: Starting wave plan with %d cores, %u waves", thread_idx, core_num, header->wave_count);
+
+    for (uint32_t w = 0; w < header->wave_count; w++) {
+        const WavePlanWave &wave = wave_plan_.waves[w];
+        for (int i = 0; i < core_num; i++) {
+            next_lane[i] = core_type_index_[cur_thread_cores[i]];
+        }
+
+        int idle_iterations = 0;
+        bool wave_done = false;
+        while (!wave_done) {
+            wave_done = true;
+            bool made_progress = false;
+            for (int i = 0; i < core_num; i++) {
+                int core_id = cur_thread_cores[i];
+                uint64_t reg_addr = core_id_to_reg_addr_[core_id];
+
+                if (pending_task_ids_[core_id] != AICPU_TASK_INVALID ||
+                    running_task_ids_[core_id] != AICPU_TASK_INVALID) {
+                    uint64_t reg_val = read_reg(reg_addr, RegId::COND);
+                    rmb();
+                    int reg_task_id = EXTRACT_TASK_ID(reg_val);
+                    int reg_state = EXTRACT_TASK_STATE(reg_val);
+
+                    // Same three observations as resolve_and_dispatch; a FIN or
+                    // ACK of the pending task implicitly completes the running one.
+                    if (reg_task_id == pending_task_ids_[core_id] && reg_state == TASK_FIN_STATE) {
+                        cur_thread_completed += (running_task_ids_[core_id] != AICPU_TASK_INVALID) ? 2 : 1;
+                        pending_task_ids_[core_id] = AICPU_TASK_INVALID;
+                        running_task_ids_[core_id] = AICPU_TASK_INVALID;
+                        made_progress = true;
+                    } else if (reg_task_id == pending_task_ids_[core_id] && reg_state == TASK_ACK_STATE) {
+                        if (running_task_ids_[core_id] != AICPU_TASK_INVALID) {
+                            cur_thread_completed++;
+                        }
+                        running_task_ids_[core_id] = pending_task_ids_[core_id];
+                        pending_task_ids_[core_id] = AICPU_TASK_INVALID;
+                        made_progress = true;
+                    } else if (reg_task_id == running_task_ids_[core_id] && reg_state == TASK_FIN_STATE) {
+                        cur_thread_completed++;
+                        running_task_ids_[core_id] = AICPU_TASK_INVALID;
+                        made_progress = true;
+                    }
+                }
+
+                bool is_aic = hank[core_id].core_type == CoreType::AIC;
+                int lane_count = static_cast<int>(is_aic ? wave.aic_count : wave.aiv_count);
+                if (pending_task_ids_[core_id] == AICPU_TASK_INVALID && next_lane[i] < lane_count) {
+                    uint32_t entry = wave.begin + (is_aic ? 0 : wave.aic_count) + static_cast<uint32_t>(next_lane[i]);
+                    int task_id = task_ids[entry];
+                    next_lane[i] += is_aic ? aic_count_ : aiv_count_;
+                    pending_task_ids_[core_id] = task_id;
+                    wmb();
+                    write_reg(reg_addr, RegId::DATA_MAIN_BASE, static_cast<uint64_t>(task_id));
+                    made_progress = true;
+                }
+
+                if (next_lane[i] < lane_count || pending_task_ids_[core_id] != AICPU_TASK_INVALID ||
+                    running_task_ids_[core_id] != AICPU_TASK_INVALID) {
+                    wave_done = false;
+                }
+            }
+
+            if (made_progress) {
+                idle_iterations = 0;
+            } else if (!wave_done && ++idle_iterations > MAX_IDLE_ITERATIONS) {
+                LOG_ERROR("Thread %d: Timeout in wave %u after %d idle iterations!", thread_idx, w, idle_iterations);
+                diagnose_stuck_state(runtime, thread_idx, cur_thread_cores, core_num, hank);
+                return -1;
+            } else if (!wave_done) {
+                SPIN_WAIT_HINT();
+            }
+        }
+
+        // Wave barrier. Release publishes this thread's FIN observations; the
+        // acquire on the other side orders them before next-wave dispatch.
+        uint32_t target = (w + 1) * static_cast<uint32_t>(aicpu_thread_num_);
+        wave_arrivals_.fetch_add(1, std::memory_order_acq_rel);
+        idle_iterations = 0;
+        while (wave_arrivals_.load(std::memory_order_acquire) < target) {
+            if (++idle_iterations > MAX_IDLE_ITERATIONS) {
+                LOG_ERROR("Thread %d: Timeout waiting for wave %u barrier", thread_idx, w);
+                return -1;
+            }
+            SPIN_WAIT_HINT();
+        }
+    }
+
+    completed_tasks_.fetch_add(cur_thread_completed, std::memory_order_release);
+    LOG_INFO_V0("Thread %d: Wave plan complete, completed %d tasks", thread_idx, cur_thread_completed);
+    return cur_thread_completed;
+}
+
 int AicpuExecutor::run(Runtime *runtime) {
     int affinity_exec_idx = platform_aicpu_affinity_thread_idx();
     int thread_idx = (affinity_exec_idx >= 0) ? affinity_exec_idx : (thread_idx_++);
@@ -1100,7 +1273,9 @@ int AicpuExecutor::run(Runtime *runtime) {
     const int *cur_thread_cores = core_assignments_[thread_idx];
 
     LOG_INFO_V0("Thread %d: Runtime has %d tasks", thread_idx, runtime->get_task_count());
-    int completed = resolve_and_dispatch(*runtime, thread_idx, cur_thread_cores, thread_cores_num_[thread_idx]);
+    int completed = wave_plan_active_ ?
+                        run_wave_plan(*runtime, thread_idx, cur_thread_cores, thread_cores_num_[thread_idx]) :
+                        resolve_and_dispatch(*runtime, thread_idx, cur_thread_cores, thread_cores_num_[thread_idx]);
     LOG_INFO_V0("Thread %d: Executed %d tasks from runtime", thread_idx, completed);
 
     // Flush performance buffers for cores managed by this thread
@@ -1157,6 +1332,11 @@ void AicpuExecutor::deinit(Runtime *runtime) {
             static_cast<size_t>(runtime->get_tensor_allocation_storage_bytes())
         );
     }
+    if (runtime->get_wave_plan_storage() != nullptr && runtime->get_wave_plan_storage_bytes() > 0) {
+        cache_invalidate_range(
+            runtime->get_wave_plan_storage(), static_cast<size_t>(runtime->get_wave_plan_storage_bytes())
+        );
+    }
 
     // === Existing reset logic ===
     ready_count_aic_.store(0, std::memory_order_release);
@@ -1184,6 +1364,9 @@ void AicpuExecutor::deinit(Runtime *runtime) {
     completed_tasks_.store(0, std::memory_order_release);
     total_tasks_.store(0, std::memory_order_release);
     finished_count_.store(0, std::memory_order_release);
+    wave_plan_active_ = false;
+    wave_plan_ = WavePlanView{};
+    wave_arrivals_.store(0, std::memory_order_release);
 
     // Reset core discovery and assignment state
     aic_count_ = 0;
@@ -42,6 +42,7 @@
 #include "prepare_callable_common.h"
 #include "runtime.h"  // Includes unified_log.h and provides LOG_* macros
 #include "task_args.h"
+#include "wave_plan.h"
 
 namespace {
 
@@ -50,6 +51,7 @@ struct OrchestrationRuntimeImpl {
     Runtime *runtime;
     struct TensorInfoBuilder *tensor_info_builder;
     struct TensorAllocationBuilder *tensor_allocation_builder;
+    bool wave_schedule_requested;
 };
 
 struct TensorInfoBuilder {
@@ -153,10 +155,14 @@ int runtime_copy_to_device(OrchestrationRuntime *runtime, void *dev_ptr, const v
     return unwrap_runtime(runtime)->host_api.copy_to_device(dev_ptr, host_ptr, size);
 }
 
+void runtime_enable_wave_schedule(OrchestrationRuntime *runtime) {
+    reinterpret_cast<OrchestrationRuntimeImpl *>(runtime)->wave_schedule_requested = true;
+}
+
 const OrchestrationRuntimeOps k_orchestration_runtime_ops = {
     runtime_add_task,       runtime_set_tensor_info_to_task, runtime_add_successor, runtime_record_tensor_pair,
     runtime_get_task_count, runtime_print_runtime,           runtime_device_malloc, runtime_device_free,
-    runtime_copy_to_device,
+    runtime_copy_to_device, runtime_enable_wave_schedule,
 };
 
 bool write_all_bytes(int fd, const uint8_t *data, size_t size) {
@@ -270,6 +276,34 @@ int upload_tensor_allocation_storage(Runtime *runtime, const TensorAllocationBui
     return 0;
 }
 
+// Levelize the finished graph and upload it as the run's wave plan. Every
+// failure here is soft: the run just keeps dynamic fanin/fanout dispatch.
+void upload_wave_plan(Runtime *runtime) {
+    std::vector<uint8_t> plan;
+    if (!wave_plan_build(runtime->tasks, runtime->get_task_count(), &plan)) {
+        LOG_WARN("Wave schedule requested but the task graph cannot be levelized; using dynamic dispatch");
+        return;
+    }
+
+    void *dev_plan = runtime->host_api.device_malloc(plan.size());
+    if (dev_plan == nullptr) {
+        LOG_WARN("Failed to allocate wave plan (%zu bytes); using dynamic dispatch", plan.size());
+        return;
+    }
+    int rc = runtime->host_api.copy_to_device(dev_plan, plan.data(), plan.size());
+    if (rc != 0) {
+        LOG_WARN("Failed to copy wave plan to device: %d; using dynamic dispatch", rc);
+        runtime->host_api.device_free(dev_plan);
+        return;
+    }
+
+    runtime->set_wave_plan_storage(dev_plan, plan.size());
+    const WavePlanHeader *header = reinterpret_cast<const WavePlanHeader *>(plan.data());
+    LOG_INFO_V0(
+        "Uploaded wave plan: %u tasks in %u waves (%zu bytes)", header->task_count, header->wave_count, plan.size()
+    );
+}
+
 }  // namespace
 
 #ifdef __cplusplus
@@ -377,6 +411,7 @@ int bind_callable_to_runtime_impl(
     }
 
     runtime->tensor_pairs_.clear();
+    runtime->clear_wave_plan_storage();
 
     LOG_INFO_V0("=== Calling Orchestration Function ===");
     LOG_DEBUG(
@@ -387,7 +422,7 @@ int bind_callable_to_runtime_impl(
     TensorInfoBuilder tensor_info_builder;
     TensorAllocationBuilder tensor_allocation_builder;
     OrchestrationRuntimeImpl orchestration_runtime = {
-        &k_orchestration_runtime_ops, runtime, &tensor_info_builder, &tensor_allocation_builder
+        &k_orchestration_runtime_ops, runtime, &tensor_info_builder, &tensor_allocation_builder, false
     };
 
     // hbg orch runs on the host, so it may legitimately need to dereference
@@ -423,6 +458,10 @@ int bind_callable_to_runtime_impl(
         return rc;
     }
 
+    if (orchestration_runtime.wave_schedule_requested) {
+        upload_wave_plan(runtime);
+    }
+
     LOG_INFO_V0("Runtime initialized. Ready for execution from Python.");
     return 0;
 }
@@ -495,6 +534,10 @@ int validate_runtime_impl(Runtime *runtime) {
         runtime->host_api.device_free(runtime->get_tensor_allocation_storage());
         runtime->clear_tensor_allocation_storage();
     }
+    if (runtime->get_wave_plan_storage() != nullptr) {
+        runtime->host_api.device_free(runtime->get_wave_plan_storage());
+        runtime->clear_wave_plan_storage();
+    }
 
     // Clear tensor pairs
     runtime->tensor_pairs_.clear();
@@ -257,6 +257,10 @@ private:
     uint64_t tensor_allocation_storage_bytes_;
     uint32_t tensor_allocation_count_;
 
+    // Optional static wave schedule (see wave_plan.h); null = dynamic dispatch
+    void *wave_plan_storage_;
+    uint64_t wave_plan_storage_bytes_;
+
 public:
     /**
      * Constructor - zero-initialize all arrays
@@ -404,6 +408,24 @@ public:
 
     uint64_t get_tensor_allocation_storage_bytes() const { return tensor_allocation_storage_bytes_; }
 
+    // =========================================================================
+    // Static Wave Schedule
+    // =========================================================================
+
+    void set_wave_plan_storage(void *ptr, uint64_t bytes) {
+        wave_plan_storage_ = ptr;
+        wave_plan_storage_bytes_ = bytes;
+    }
+
+    void clear_wave_plan_storage() {
+        wave_plan_storage_ = nullptr;
+        wave_plan_storage_bytes_ = 0;
+    }
+
+    void *get_wave_plan_storage() const { return wave_plan_storage_; }
+
+    uint64_t get_wave_plan_storage_bytes() const { return wave_plan_storage_bytes_; }
+
     // =========================================================================
     // Device Orchestration (stub for API compatibility)
     // =========================================================================
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Static wave schedule for host_build_graph.
+ *
+ * The host already holds the whole task graph when the orchestration function
+ * returns, so for static graphs it can levelize it once: wave 0 is every task
+ * with fanin == 0, wave w+1 every task whose last predecessor sits in wave w.
+ * No two tasks in a wave depend on each other, so the AICPU executor only has
+ * to dispatch a wave and wait for it to drain before the next one; it never
+ * touches Task::fanin or walks Task::fanout.
+ *
+ * Storage layout (one contiguous, device-uploaded block):
+ *
+ *   WavePlanHeader
+ *   WavePlanWave   waves[wave_count]
+ *   int32_t        task_ids[task_count]
+ *
+ * Inside a wave the AIC tasks come first, then the AIV tasks, each group in
+ * task-id order. A task's position inside its group is its lane; lane L of a
+ * group runs on core (L % cores_of_that_type) of the matching type. Core
+ * discovery happens on the device, so the host fixes the lane and the device
+ * only applies the modulo: core k walks lanes k, k + n, k + 2n, ...
+ */
+
+#ifndef SRC_A2A3_RUNTIME_HOST_BUILD_GRAPH_RUNTIME_WAVE_PLAN_H_
+#define SRC_A2A3_RUNTIME_HOST_BUILD_GRAPH_RUNTIME_WAVE_PLAN_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/core_type.h"
+
+struct WavePlanHeader {
+    uint32_t wave_count;
+    uint32_t task_count;
+    uint32_t aic_task_count;
+    uint32_t aiv_task_count;
+};
+
+struct WavePlanWave {
+    uint32_t begin;      // Index of the wave's first entry in task_ids[]
+    uint32_t aic_count;  // task_ids[begin, begin + aic_count) are AIC lanes
+    uint32_t aiv_count;  // followed by aiv_count AIV lanes
+    uint32_t reserved;
+};
+
+static_assert(sizeof(WavePlanHeader) == 16, "WavePlanHeader must stay compact");
+static_assert(sizeof(WavePlanWave) == 16, "WavePlanWave must stay compact");
+
+/**
+ * Read-only view over an uploaded plan. Filled by wave_plan_view(), which
+ * checks that the block is large enough for the counts its header claims.
+ */
+struct WavePlanView {
+    const WavePlanHeader *header;
+    const WavePlanWave *waves;
+    const int32_t *task_ids;
+};
+
+inline bool wave_plan_view(const void *storage, uint64_t bytes, WavePlanView *out) {
+    if (storage == nullptr || out == nullptr || bytes < sizeof(WavePlanHeader)) {
+        return false;
+    }
+    const WavePlanHeader *header = reinterpret_cast<const WavePlanHeader *>(storage);
+    uint64_t need = sizeof(WavePlanHeader) + static_cast<uint64_t>(header->wave_count) * sizeof(WavePlanWave) +
+                    static_cast<uint64_t>(header->task_count) * sizeof(int32_t);
+    if (bytes < need || header->aic_task_count + header->aiv_task_count != header->task_count) {
+        return false;
+    }
+    const uint8_t *base = reinterpret_cast<const uint8_t *>(storage);
+    out->header = header;
+    out->waves = reinterpret_cast<const WavePlanWave *>(base + sizeof(WavePlanHeader));
+    out->task_ids = reinterpret_cast<const int32_t *>(
+        base + sizeof(WavePlanHeader) + static_cast<uint64_t>(header->wave_count) * sizeof(WavePlanWave)
+    );
+    return true;
+}
+
+/**
+ * Levelize tasks[0, task_count) into a wave plan (host side).
+ *
+ * TaskT needs `fanin` (convertible to int), `fanout[]`, `fanout_count` and
+ * `core_type`, which is what Runtime's Task provides. Returns false, leaving
+ * *out empty, when the graph has a cycle or an out-of-range successor; the
+ * caller then keeps the dynamic fanin/fanout dispatch.
+ */
+template <typename TaskT>
+bool wave_plan_build(const TaskT *tasks, int task_count, std::vector<uint8_t> *out) {
+    out->clear();
+    if (tasks == nullptr || task_count <= 0) {
+        return false;
+    }
+
+    // Kahn's algorithm, one level at a time. `remaining` is a private copy of
+    // fanin so the Task table is left exactly as the orchestration built it.
+    std::vector<int> remaining(static_cast<size_t>(task_count));
+    std::vector<int32_t> order;
+    std::vector<uint32_t> level_begin;
+    order.reserve(static_cast<size_t>(task_count));
+    for (int i = 0; i < task_count; i++) {
+        remaining[i] = tasks[i].fanin;
+        if (remaining[i] == 0) {
+            order.push_back(i);
+        }
+    }
+
+    size_t cursor = 0;
+    while (cursor < order.size()) {
+        size_t level_end = order.size();
+        level_begin.push_back(static_cast<uint32_t>(cursor));
+        for (; cursor < level_end; cursor++) {
+            const TaskT &task = tasks[order[cursor]];
+            for (int j = 0; j < task.fanout_count; j++) {
+                int succ = task.fanout[j];
+                if (succ < 0 || succ >= task_count) {
+                    return false;
+                }
+                if (--remaining[succ] == 0) {
+                    order.push_back(succ);
+                }
+            }
+        }
+    }
+    if (order.size() != static_cast<size_t>(task_count)) {
+        return false;  // Cycle: some task never reached fanin 0
+    }
+
+    WavePlanHeader header = {};
+    header.wave_count = static_cast<uint32_t>(level_begin.size());
+    header.task_count = static_cast<uint32_t>(task_count);
+    std::vector<WavePlanWave> waves(level_begin.size());
+    std::vector<int32_t> task_ids;
+    task_ids.reserve(static_cast<size_t>(task_count));
+    for (size_t w = 0; w < level_begin.size(); w++) {
+        size_t begin = level_begin[w];
+        size_t end = (w + 1 < level_begin.size()) ? level_begin[w + 1] : order.size();
+        waves[w].begin = static_cast<uint32_t>(task_ids.size());
+        // Sorting by id keeps lanes deterministic across identical graphs.
+        std::vector<int32_t> aic;
+        std::vector<int32_t> aiv;
+        for (size_t k = begin; k < end; k++) {
+            (tasks[order[k]].core_type == CoreType::AIC ? aic : aiv).push_back(order[k]);
+        }
+        std::sort(aic.begin(), aic.end());
+        std::sort(aiv.begin(), aiv.end());
+        task_ids.insert(task_ids.end(), aic.begin(), aic.end());
+        task_ids.insert(task_ids.end(), aiv.begin(), aiv.end());
+        waves[w].aic_count = static_cast<uint32_t>(aic.size());
+        waves[w].aiv_count = static_cast<uint32_t>(aiv.size());
+        header.aic_task_count += waves[w].aic_count;
+        header.aiv_task_count += waves[w].aiv_count;
+    }
+
+    size_t waves_bytes = waves.size() * sizeof(WavePlanWave);
+    size_t ids_bytes = task_ids.size() * sizeof(int32_t);
+    out->resize(sizeof(WavePlanHeader) + waves_bytes + ids_bytes);
+    memcpy(out->data(), &header, sizeof(WavePlanHeader));
+    memcpy(out->data() + sizeof(WavePlanHeader), waves.data(), waves_bytes);
+    memcpy(out->data() + sizeof(WavePlanHeader) + waves_bytes, task_ids.data(), ids_bytes);
+    return true;
+}
+
+#endif  // SRC_A2A3_RUNTIME_HOST_BUILD_GRAPH_RUNTIME_WAVE_PLAN_H_
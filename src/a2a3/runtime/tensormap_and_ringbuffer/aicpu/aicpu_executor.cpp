@@ -35,6 +35,7 @@
 #include "pto_shared_memory.h"
 
 // Performance profiling headers
+#include "aicpu/flight_recorder_aicpu.h"
 #include "aicpu/l2_swimlane_collector_aicpu.h"
 #include "aicpu/scope_stats_collector_aicpu.h"
 #include "aicpu/tensor_dump_aicpu.h"
@@ -158,7 +159,7 @@ struct AicpuExecutor {
         for (auto &e : orch_so_table_) {
             if (!e.in_use) continue;
             if (e.handle != nullptr) dlclose(e.handle);
-            if (e.path[0] != '\0') unlink(e.path);
+            release_orch_so_file(e.path);
             e = OrchSoEntry{};
         }
     }
@@ -239,10 +240,8 @@ int32_t AicpuExecutor::ensure_orch_so_loaded(Runtime *runtime, int32_t thread_id
     if (entry.handle != nullptr) {
         dlclose(entry.handle);
     }
-    if (entry.path[0] != '\0') {
-        // Unlink the old file so the new open() lands on a fresh inode.
-        unlink(entry.path);
-    }
+    // Release the old file so the new open() lands on a fresh inode.
+    release_orch_so_file(entry.path);
     entry = OrchSoEntry{};
 
     const void *so_data = reinterpret_cast<const void *>(runtime->get_dev_orch_so_addr());
@@ -270,7 +269,7 @@ int32_t AicpuExecutor::ensure_orch_so_loaded(Runtime *runtime, int32_t thread_id
         close(fd);
         if (written != static_cast<ssize_t>(so_size)) {
             LOG_INFO_V0("Thread %d: Cannot write SO to %s (errno=%d), trying next path", thread_idx, so_path, errno);
-            unlink(so_path);
+            release_orch_so_file(so_path);
             continue;
         }
         file_created = true;
@@ -287,13 +286,15 @@ int32_t AicpuExecutor::ensure_orch_so_loaded(Runtime *runtime, int32_t thread_id
     const char *dlopen_err = dlerror();
     if (handle == nullptr) {
         LOG_ERROR("Thread %d: dlopen failed: %s", thread_idx, dlopen_err ? dlopen_err : "unknown");
-        unlink(so_path);
+        release_orch_so_file(so_path);
         return -1;
     }
     LOG_INFO_V0("Thread %d: dlopen succeeded, handle=%p", thread_idx, handle);
 
     // The image is mmap'd after dlopen; keeping only the handle avoids stale
     // libdevice_orch_<pid>_<cid>.so files when worker children exit via os._exit.
+    // sim memfd paths (/proc/self/fd/<N>) are unaffected; their fd is closed
+    // by release_orch_so_file once the handle is dropped.
     unlink(so_path);
 
     const char *entry_symbol = runtime->get_device_orch_func_name();
@@ -311,13 +312,13 @@ int32_t AicpuExecutor::ensure_orch_so_loaded(Runtime *runtime, int32_t thread_id
     if (entry_dlsym_error != nullptr) {
         LOG_ERROR("Thread %d: dlsym failed for entry symbol '%s': %s", thread_idx, entry_symbol, entry_dlsym_error);
         dlclose(handle);
-        unlink(so_path);
+        release_orch_so_file(so_path);
         return -1;
     }
     if (orch_func == nullptr) {
         LOG_ERROR("Thread %d: dlsym returned NULL for entry symbol '%s'", thread_idx, entry_symbol);
         dlclose(handle);
-        unlink(so_path);
+        release_orch_so_file(so_path);
         return -1;
     }
 
@@ -365,6 +366,9 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
     }
     int32_t run_rc = 0;
     LOG_INFO_V0("Thread %d: Start (exec_idx=%d)", thread_idx, affinity_exec_idx);
+#if PTO2_FLIGHT_RECORDER
+    flight_recorder_record(thread_idx, FLIGHT_RECORDER_EVENT_RUN_BEGIN, 0, thread_idx >= sched_thread_num_ ? 1 : 0);
+#endif
 
     // Orchestrator check
     if (thread_idx >= sched_thread_num_) {
@@ -420,7 +424,7 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
                             *p_handle = nullptr;
                         }
                         if (p_path[0] != '\0') {
-                            unlink(p_path);
+                            release_orch_so_file(p_path);
                             p_path[0] = '\0';
                         }
                         *p_func = nullptr;
@@ -510,8 +514,13 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
             // Fill ops / core counts (host can't resolve s_runtime_ops's
             // device address nor know the SchedulerContext's core fan-out).
             runtime_finalize_after_wire(rt, sched_ctx_.aic_count(), sched_ctx_.aiv_count());
+            // Shard wiring across the dedicated scheduler threads. Fixed for
+            // the run: with orch_to_sched the orchestrator thread joins
+            // dispatch later but never takes over a shard.
+            rt->scheduler.wiring.thread_count = sched_thread_num_ > 0 ? sched_thread_num_ : 1;
 #if PTO2_PROFILING
             rt->orchestrator.l2_swimlane_level = get_l2_swimlane_level();
+            rt->scheduler.l2_swimlane_edges = l2_swimlane_aicpu_edges_enabled();
             {
                 auto &orch = rt->orchestrator;
                 for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
@@ -553,6 +562,9 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
             // popped lazily on the first scope_end append.
             scope_stats_aicpu_set_orch_thread_idx(thread_idx);
 #endif
+#if PTO2_FLIGHT_RECORDER
+            flight_recorder_set_orch_thread_idx(thread_idx);
+#endif
 
 #if PTO2_PROFILING
             orch_cycle_start = get_sys_cnt_aicpu();
@@ -714,6 +726,9 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
     }
 
     LOG_INFO_V0("Thread %d: Completed", thread_idx);
+#if PTO2_FLIGHT_RECORDER
+    flight_recorder_record(thread_idx, FLIGHT_RECORDER_EVENT_RUN_END, static_cast<uint32_t>(run_rc), 0);
+#endif
 
     // Check if this is the last thread to finish
     int32_t prev_finished = finished_count_.fetch_add(1, std::memory_order_acq_rel);
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Split-KV work partitioning for paged attention style orchestrations.
+ *
+ * A decode batch with ragged context lengths is a poor fit for one-task-chain
+ * per (sequence, head tile): the longest sequence serializes its whole KV walk
+ * through the online-softmax accumulator while short rows leave cores idle.
+ * Split-KV cuts each row's KV blocks into contiguous ranges that run as
+ * independent accumulation chains, then merges the per-split (m, l, o)
+ * partials in a final combine step (the same online-softmax merge used
+ * between blocks, since a split partial has exactly the semantics of one
+ * block's contribution).
+ *
+ * The planner is pure arithmetic on block counts so it costs nothing on the
+ * submit path and keeps no state:
+ *
+ *   uint64_t work = sum over rows of pto2_split_kv_row_blocks(len, block_size) * q_loop;
+ *   uint32_t bps  = pto2_split_kv_blocks_per_split(work, aic_count, min_blocks);
+ *   for each row:
+ *       uint32_t n = pto2_split_kv_num_splits(row_blocks, bps);
+ *       for (uint32_t s = 0; s < n; s++) {
+ *           PTO2SplitKvRange r = pto2_split_kv_range(row_blocks, n, s);
+ *           // blocks [r.block_begin, r.block_end) accumulate into split s
+ *       }
+ *       // n > 1: merge the n partials into the row output
+ *
+ * Sizing targets one split per parallel slot (typically the AIC count from
+ * rt_get_core_counts): with fewer rows than cores long rows fan out, with
+ * many rows every row stays a single chain and nothing changes. Splits of a
+ * row differ in length by at most one block.
+ *
+ * Auto-included at the bottom of pto_orchestration_api.h; self-contained so
+ * host unit tests can include it directly.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/** Contiguous range of logical KV blocks [block_begin, block_end) of one row. */
+struct PTO2SplitKvRange {
+    uint32_t block_begin;
+    uint32_t block_end;
+};
+
+/** Number of KV blocks covering context_len tokens (0 for an empty row). */
+static inline uint32_t pto2_split_kv_row_blocks(int64_t context_len, uint64_t block_size) {
+    if (context_len <= 0 || block_size == 0) return 0;
+    return static_cast<uint32_t>((static_cast<uint64_t>(context_len) + block_size - 1) / block_size);
+}
+
+/**
+ * Maximum KV blocks per split so that total_work blocks spread over about
+ * parallel_slots work items. parallel_slots == 0 disables splitting (every
+ * row becomes one split). The result is never below min_blocks_per_split,
+ * which bounds the per-split fixed cost (one extra combine task).
+ */
+static inline uint32_t pto2_split_kv_blocks_per_split(
+    uint64_t total_work, uint32_t parallel_slots, uint32_t min_blocks_per_split
+) {
+    uint64_t bps = (parallel_slots == 0) ? total_work : (total_work + parallel_slots - 1) / parallel_slots;
+    if (bps < min_blocks_per_split) bps = min_blocks_per_split;
+    if (bps == 0) bps = 1;
+    if (bps > UINT32_MAX) bps = UINT32_MAX;
+    return static_cast<uint32_t>(bps);
+}
+
+/** Splits for a row of row_blocks blocks (0 for an empty row). */
+static inline uint32_t pto2_split_kv_num_splits(uint32_t row_blocks, uint32_t blocks_per_split) {
+    if (row_blocks == 0) return 0;
+    if (blocks_per_split == 0) return 1;
+    return static_cast<uint32_t>((static_cast<uint64_t>(row_blocks) + blocks_per_split - 1) / blocks_per_split);
+}
+
+/**
+ * Block range of split `split` when row_blocks blocks are divided into
+ * num_splits near-equal contiguous ranges (the first row_blocks % num_splits
+ * splits take one extra block).
+ */
+static inline PTO2SplitKvRange pto2_split_kv_range(uint32_t row_blocks, uint32_t num_splits, uint32_t split) {
+    if (num_splits == 0) return PTO2SplitKvRange{0, 0};
+    uint32_t base = row_blocks / num_splits;
+    uint32_t rem = row_blocks % num_splits;
+    uint32_t begin = split * base + (split < rem ? split : rem);
+    uint32_t end = begin + base + (split < rem ? 1 : 0);
+    return PTO2SplitKvRange{begin, end};
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Orchestration-side memo for repeated Tensor::view() calls.
+ *
+ * Hot orchestration loops slice the same parent with the same tile shape over
+ * and over, only moving the origin (one KV block per iteration, one head tile
+ * per row, ...). Tensor::view() rebuilds the whole 128 B descriptor each time:
+ * line-1 copy, per-dim stride carry, then refresh_derived() to recompute
+ * extent_elem_cache and the contiguity flag. None of that depends on the
+ * offsets, so PTO2ViewCache keeps the last view built for each
+ * (parent buffer, parent origin, view shape) and re-bases it in place through
+ * Tensor::reoffset(), which only patches start_offset and version.
+ *
+ *   PTO2ViewCache<> views;
+ *   for (...) {
+ *       const Tensor &kj = views.view(key_cache, kv_shapes, kv_offsets);  // == key_cache.view(...)
+ *       params.add_input(kj);
+ *   }
+ *
+ * view() returns a reference into the cache. It stays valid and unchanged
+ * until a later view() call asks for the same parent/shape (which re-bases
+ * it) or misses (which may evict it); bind it by value when it has to live
+ * longer, e.g. two tiles of the same parent in one task. Submitting copies the
+ * tensor into the task payload, so the usual "build view, submit, next block"
+ * loop is safe as long as the cache has an entry per distinct parent/shape.
+ *
+ * The result is bit-identical to parent.view(shapes, offsets, manual_dep) in
+ * every field a consumer reads. A hit requires the parent to match on buffer,
+ * owner task, origin, dtype, ndims, strides, and memory kind, so a ring-heap
+ * address reused by a later task's output never aliases an older view.
+ * Fixed capacity, round-robin replacement, no allocation; owned by a single
+ * orchestration thread (typically a local in aicpu_orchestration_entry).
+ *
+ * Auto-included at the bottom of pto_orchestration_api.h.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "tensor.h"  // Tensor, MAX_TENSOR_DIMS
+
+template <uint32_t CAPACITY = 8>
+class PTO2ViewCache {
+    static_assert(CAPACITY > 0, "PTO2ViewCache needs at least one entry");
+
+public:
+    PTO2ViewCache() { clear(); }
+    PTO2ViewCache(const PTO2ViewCache &) = delete;
+    PTO2ViewCache &operator=(const PTO2ViewCache &) = delete;
+
+    /// parent.view(view_shapes, view_offsets, manual_dep), served from the cache.
+    const Tensor &view(
+        const Tensor &parent, const uint32_t view_shapes[], const uint32_t view_offsets[], bool manual_dep = false
+    ) {
+        Entry *e = find(parent, view_shapes, manual_dep);
+        if (e != nullptr) {
+            hits_++;
+            uint64_t start = parent.start_offset;
+            for (uint32_t i = 0; i < parent.ndims; i++) {
+                debug_assert(view_offsets[i] + view_shapes[i] <= parent.shapes[i]);
+                start += static_cast<uint64_t>(view_offsets[i]) * static_cast<uint64_t>(parent.strides[i]);
+            }
+            e->view.reoffset(start, parent.version);
+            return e->view;
+        }
+        misses_++;
+        Entry &slot = entries_[next_victim_];
+        next_victim_ = (next_victim_ + 1) % CAPACITY;
+        slot.parent_start_offset = parent.start_offset;
+        slot.view = parent.view(view_shapes, view_offsets, manual_dep);
+        last_ = &slot;
+        return slot.view;
+    }
+
+    void clear() {
+        for (uint32_t i = 0; i < CAPACITY; i++) {
+            entries_[i].view.ndims = 0;  // ndims == 0 marks an empty entry (real views have ndims > 0)
+        }
+        last_ = &entries_[0];
+        next_victim_ = 0;
+        hits_ = 0;
+        misses_ = 0;
+    }
+
+    uint64_t hits() const { return hits_; }
+    uint64_t misses() const { return misses_; }
+
+private:
+    struct Entry {
+        uint64_t parent_start_offset;
+        Tensor view;  // last view built from this parent/shape; origin is stale
+    };
+
+    static bool matches(const Entry &e, const Tensor &parent, const uint32_t view_shapes[], bool manual_dep) {
+        const Tensor &v = e.view;
+        // Branch-free accumulate over the identity words: the common outcome
+        // in a loop is a hit, so there is nothing to gain from early exits.
+        uint64_t diff = (v.buffer.addr ^ parent.buffer.addr) | (v.buffer.size ^ parent.buffer.size) |
+                        (v.owner_task_id.raw ^ parent.owner_task_id.raw) |
+                        (e.parent_start_offset ^ parent.start_offset);
+        diff |= static_cast<uint64_t>(v.ndims ^ parent.ndims) |
+                static_cast<uint64_t>(static_cast<uint8_t>(v.dtype) ^ static_cast<uint8_t>(parent.dtype)) |
+                static_cast<uint64_t>(v.manual_dep != manual_dep) |
+                static_cast<uint64_t>(v.child_memory ^ parent.child_memory);
+        if (diff != 0) return false;
+        uint32_t dims_diff = 0;
+        for (uint32_t i = 0; i < v.ndims; i++) {
+            dims_diff |= (v.shapes[i] ^ view_shapes[i]) | (v.strides[i] ^ parent.strides[i]);
+        }
+        return dims_diff == 0;
+    }
+
+    Entry *find(const Tensor &parent, const uint32_t view_shapes[], bool manual_dep) {
+        // Loops usually alternate between a few parents; check the last hit first.
+        if (matches(*last_, parent, view_shapes, manual_dep)) return last_;
+        for (uint32_t i = 0; i < CAPACITY; i++) {
+            if (matches(entries_[i], parent, view_shapes, manual_dep)) {
+                last_ = &entries_[i];
+                return last_;
+            }
+        }
+        return nullptr;
+    }
+
+    Entry entries_[CAPACITY];
+    Entry *last_;
+    uint32_t next_victim_;
+    uint64_t hits_;
+    uint64_t misses_;
+};
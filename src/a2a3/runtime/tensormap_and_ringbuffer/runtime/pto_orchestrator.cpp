@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include "aicpu/dep_gen_collector_aicpu.h"
+#include "aicpu/flight_recorder_aicpu.h"
 #include "common/dep_gen.h"
 #include "common/unified_log.h"
 #include "pto_dep_compute.h"
@@ -72,6 +73,12 @@ extern "C" __attribute__((weak, visibility("hidden"))) bool is_scope_stats_enabl
 // this weak no-op so the runtime translation unit stays self-contained.
 extern "C" __attribute__((weak, visibility("hidden"))) void scope_stats_note_heap_wrap(int) {}
 
+#if PTO2_FLIGHT_RECORDER
+// Flight-recorder probe for scope / allocator-block / fatal events. Strong
+// definition lives in the AICPU flight recorder; host builds record nothing.
+extern "C" __attribute__((weak, visibility("hidden"))) void flight_recorder_orch_record(uint32_t, uint64_t, uint32_t) {}
+#endif
+
 // =============================================================================
 // Orchestrator Profiling (compile-time toggle)
 // =============================================================================
@@ -183,6 +190,10 @@ static void
 orch_report_fatal_v(PTO2OrchestratorState *orch, int32_t error_code, const char *func, const char *fmt, va_list args) {
     int32_t latched_code = orch_mark_fatal(orch, error_code);
 
+#if PTO2_FLIGHT_RECORDER
+    flight_recorder_orch_record(FLIGHT_RECORDER_EVENT_ERROR, static_cast<uint32_t>(error_code), 0);
+#endif
+
 #if PTO2_PROFILING
     // Flush the current scope's peaks BEFORE the FATAL log line, so the
     // diagnostic context (which pool/window filled up) appears right next to
@@ -431,7 +442,7 @@ static bool prepare_task(
     // here lets RingSchedState::init() skip the O(window_size) bind loop.
     // Both writes hit the same 64B slot_state cache line we're about to
     // dirty below, so the extra cost is two stores on an already-hot line.
-    // Must precede the scheduler wiring.queue.push at the end of
+    // Must precede the scheduler wiring-shard queue.push at the end of
     // submit_task_common — that push is the first read of slot_state->task /
     // slot_state->payload by another thread.
     out->slot_state->bind_buffers(out->payload, out->task);
@@ -479,6 +490,17 @@ static void scope_tasks_push(PTO2OrchestratorState *orch, PTO2TaskSlotState *tas
     orch->scope_tasks[orch->scope_tasks_size++] = task_slot_state;
 }
 
+#if PTO2_FLIGHT_RECORDER
+// Scope boundary record: the next task id of the scope's ring (so the host can
+// bracket the tasks submitted inside it) and the depth after begin / before end.
+static inline void orch_record_scope(PTO2OrchestratorState *orch, uint32_t kind) {
+    uint8_t ring_id = orch->current_ring_id();
+    uint64_t next_task = (static_cast<uint64_t>(ring_id) << 32) |
+                         static_cast<uint32_t>(orch->rings[ring_id].task_allocator.task_head());
+    flight_recorder_orch_record(kind, next_task, static_cast<uint32_t>(orch->scope_stack_top));
+}
+#endif
+
 void PTO2OrchestratorState::begin_scope(PTO2ScopeMode mode) {
     auto *orch = this;
     if (orch->fatal) {
@@ -496,6 +518,9 @@ void PTO2OrchestratorState::begin_scope(PTO2ScopeMode mode) {
     if (mode == PTO2ScopeMode::MANUAL && !already_in_manual_scope) {
         orch->manual_begin_depth = orch->scope_stack_top;
     }
+#if PTO2_FLIGHT_RECORDER
+    orch_record_scope(orch, FLIGHT_RECORDER_EVENT_SCOPE_BEGIN);
+#endif
 #if PTO2_PROFILING
     // Gate via is_scope_stats_enabled() (weak-false in host builds) BEFORE the
     // collector call: when disabled we pay nothing. Sample the current ring's
@@ -526,6 +551,9 @@ void PTO2OrchestratorState::end_scope() {
     // Snapshot the ring start/end BEFORE the orchestrator drains pending tasks
     // via scheduler->on_scope_end, so the end record reflects the scope's
     // occupancy at close, not the residual after teardown.
+#if PTO2_FLIGHT_RECORDER
+    orch_record_scope(orch, FLIGHT_RECORDER_EVENT_SCOPE_END);
+#endif
 #if PTO2_PROFILING
     // Gate via is_scope_stats_enabled() (see begin_scope). One collector call
     // emits the end-boundary record and tears down bookkeeping.
@@ -851,17 +879,21 @@ static TaskOutputTensors submit_task_common(
     // === STEP 6: push to wiring queue ===
     // Deferred wiring: orchestrator only stores dependency metadata and increments
     // fanout_count. The actual fanout_head wiring (lock + dep_pool + early_finished)
-    // is handled asynchronously by scheduler thread 0 via the wiring queue.
-    // Push to global wiring queue — scheduler sets fanin_count, wires fanout, checks readiness
-    if (!sched->wiring.queue.push(&cur_slot_state)) {
+    // is handled asynchronously by the scheduler thread owning this ring's
+    // wiring shard.
+    // Push to this ring's wiring shard — scheduler sets fanin_count, wires fanout, checks readiness
+    PTO2SpscQueue &wiring_queue = sched->wiring.shards[ring_id].queue;
+    if (!wiring_queue.push(&cur_slot_state)) {
         // producer_blocked is the wiring deadlock detector's "orchestrator is
         // stuck in push" observable: set ONLY while we actually spin (queue
         // full), cleared on exit, so the just-filled-then-scope_end case (push
         // succeeded, no spin) never trips a false deadlock. Also poll the shared
         // orch_error_code so a fatal latched by any party (e.g. that detector)
         // breaks this otherwise-unbounded spin and unwinds orchestration.
-        sched->wiring.producer_blocked.store(1, std::memory_order_release);
-        while (!sched->wiring.queue.push(&cur_slot_state)) {
+        // Holds ring_id + 1 so the detector only trusts it for the shard the
+        // orchestrator is actually stuck on.
+        sched->wiring.producer_blocked.store(ring_id + 1, std::memory_order_release);
+        while (!wiring_queue.push(&cur_slot_state)) {
             if (orch->sm_header->orch_error_code.load(std::memory_order_acquire) != PTO2_ERROR_NONE) {
                 orch->fatal = true;
                 sched->wiring.producer_blocked.store(0, std::memory_order_release);
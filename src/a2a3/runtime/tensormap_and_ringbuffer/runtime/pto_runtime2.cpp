@@ -65,6 +65,11 @@ void rt_orchestration_done(PTO2Runtime *rt) { rt->orchestrator.mark_done(); }
 
 static bool is_fatal_impl(PTO2Runtime *rt) { return rt->orchestrator.fatal; }
 
+static void get_core_counts_impl(PTO2Runtime *rt, int32_t *aic_count, int32_t *aiv_count) {
+    *aic_count = rt->orchestrator.total_cluster_count;
+    *aiv_count = rt->orchestrator.total_aiv_count;
+}
+
 void rt_report_fatal(PTO2Runtime *rt, int32_t error_code, const char *func, const char *fmt, ...) {
     va_list args;
     va_start(args, fmt);
@@ -280,6 +285,7 @@ static const PTO2RuntimeOps s_runtime_ops = {
 #else
     .scope_set_site = nullptr,
 #endif
+    .get_core_counts = get_core_counts_impl,
 };
 
 // =============================================================================
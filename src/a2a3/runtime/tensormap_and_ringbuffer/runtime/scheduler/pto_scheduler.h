@@ -40,6 +40,9 @@
 #include "pto_shared_memory.h"
 
 #include "aicpu/device_time.h"  // get_sys_cnt_aicpu (weak; used by spec doorbell timing too)
+#if PTO2_PROFILING
+#include "aicpu/l2_swimlane_collector_aicpu.h"  // l2_swimlane_aicpu_record_edge (weak fallback in pto_scheduler.cpp)
+#endif
 #if PTO2_SCHED_PROFILING
 #define PTO2_SCHED_CYCLE_START() uint64_t _st0 = get_sys_cnt_aicpu(), _st1
 #define PTO2_SCHED_CYCLE_LAP(acc)   \
@@ -426,7 +429,7 @@ void ready_queue_destroy(PTO2ReadyQueue *queue);
 //
 // Bounded ring buffer optimized for the wiring queue use case:
 //   - Producer: orchestrator thread (push)
-//   - Consumer: scheduler thread 0 (pop_batch)
+//   - Consumer: the scheduler thread owning the ring's wiring shard (pop_batch)
 //
 // Design based on Rigtorp's cached-index technique: each side caches
 // the other's index locally, avoiding cross-core cache line bouncing
@@ -440,7 +443,7 @@ struct alignas(64) PTO2SpscQueue {
     alignas(64) std::atomic<uint64_t> head_{0};
     alignas(64) uint64_t tail_cached_{0};
 
-    // --- Consumer cache lines (scheduler thread 0) ---
+    // --- Consumer cache lines (owning scheduler thread) ---
     alignas(64) std::atomic<uint64_t> tail_{0};
     alignas(64) uint64_t head_cached_{0};
 
@@ -454,7 +457,7 @@ struct alignas(64) PTO2SpscQueue {
     // Reserve the backing buffer region on the supplied arena. Returns the
     // region offset, to be passed to init_from_layout() after the arena is
     // committed. Cache-line aligned: the buffer is shared between the
-    // orchestrator (push) and scheduler thread 0 (pop_batch), so its base
+    // orchestrator (push) and one scheduler thread (pop_batch), so its base
     // must not false-share with neighboring regions.
     static size_t reserve_layout(DeviceArena &arena, uint64_t capacity) {
         return arena.reserve(capacity * sizeof(uintptr_t), PTO2_ALIGN_SIZE);
@@ -562,7 +565,7 @@ struct PTO2SchedulerLayout {
     size_t off_dummy_ready_queue_slots;
     size_t off_early_dispatch_queue_slots;
     size_t off_dep_pool_entries[PTO2_MAX_RING_DEPTH];
-    size_t off_wiring_spsc_buffer;
+    size_t off_wiring_spsc_buffers[PTO2_MAX_RING_DEPTH];
     uint64_t ready_queue_capacity;
     uint64_t spsc_capacity;
     int32_t dep_pool_capacities[PTO2_MAX_RING_DEPTH];
@@ -586,9 +589,9 @@ struct PTO2SchedulerState {
         int32_t last_task_alive;
         std::atomic<int32_t> advance_lock;  // multi-thread CAS
 
-        // --- Cache Line 1+: Thread 0 only (wiring dep_pool) ---
+        // --- Cache Line 1+: wiring-shard owner only (dep_pool) ---
         alignas(64) PTO2DepListPool dep_pool;
-        // One-shot latch for the wiring-queue deadlock report (thread 0 only):
+        // One-shot latch for the wiring-queue deadlock report (shard owner only):
         // the drain breaks on dep_pool exhaustion every call while wedged, so
         // the tier-1 structural diagnostic is emitted once, not per call.
         bool dep_deadlock_reported = false;
@@ -653,43 +656,63 @@ struct PTO2SchedulerState {
     // the dispatch loop and completed inline -- never goes to AICore.
     PTO2ReadyQueue dummy_ready_queue;
 
-    // Wiring subsystem — groups all wiring-related state for cache-line isolation.
+    // Wiring subsystem — one shard per ring, so up to PTO2_MAX_RING_DEPTH
+    // scheduler threads wire concurrently while every ring's dep_pool keeps a
+    // single writer. Shard r is drained by scheduler thread r % thread_count.
     //
-    // Three cache-line regions by writer:
-    //   1. batch_*  / backoff — thread 0 exclusive (local batch buffer)
-    //   2. queue    — SPSC: orchestrator push, thread 0 pop
-    //   3. orch_needs_drain — orchestrator write, thread 0 read
-    struct alignas(64) WiringState {
+    // Cache-line regions by writer:
+    //   1. shards[r].batch_* / backoff — owning thread exclusive
+    //   2. shards[r].queue  — SPSC: orchestrator push, owning thread pop
+    //   3. orch_needs_drain / producer_blocked — orchestrator write, wiring threads read
+    struct alignas(64) WiringShard {
         static constexpr uint64_t BATCH_SIZE = 30;
         static constexpr int BACKOFF_LIMIT = 32;
 
-        // --- Thread 0 exclusive: local batch buffer + backoff ---
+        // --- Owning thread exclusive: local batch buffer + backoff ---
         int batch_count = 0;
         int batch_index = 0;
         int backoff_counter = 0;
         PTO2TaskSlotState *batch[BATCH_SIZE];
 
-        // --- SPSC queue: orchestrator (push) ↔ thread 0 (pop) ---
+        // --- SPSC queue: orchestrator (push) ↔ owning thread (pop) ---
         PTO2SpscQueue queue;
+    };
 
-        // --- Orchestrator write, thread 0 read ---
+    static_assert(
+        offsetof(WiringShard, queue) == 256, "WiringShard: batch region must be exactly 4 cache lines before queue"
+    );
+    static_assert(sizeof(WiringShard) == 576, "WiringShard must be exactly 9 cache lines (576B)");
+
+    struct alignas(64) WiringState {
+        WiringShard shards[PTO2_MAX_RING_DEPTH];
+
+        // --- Orchestrator write, wiring threads read ---
         alignas(64) std::atomic<bool> orch_needs_drain{false};
-        // Set to 1 only while the orchestrator is actually spinning in
-        // queue.push() (queue full), cleared on a successful push. The wiring
-        // deadlock detector reads this as the producer-blocked observable: it
-        // proves the orchestrator is stuck BEFORE its scope_end, as opposed to
-        // having just filled the queue with its last in-scope push and being
-        // about to call scope_end (which would release the head -> no deadlock).
+        // Set to ring_id + 1 only while the orchestrator is actually spinning
+        // in that shard's queue.push() (queue full), cleared to 0 on a
+        // successful push. The wiring deadlock detector reads this as the
+        // producer-blocked observable: it proves the orchestrator is stuck
+        // BEFORE its scope_end, as opposed to having just filled the queue with
+        // its last in-scope push and being about to call scope_end (which would
+        // release the head -> no deadlock). The ring tag matters: a push
+        // blocked on another ring's shard can still complete once that shard
+        // drains, so only the wedged shard's own ring counts as proof.
         std::atomic<int32_t> producer_blocked{0};
+        // Scheduler threads sharing the shards. Set once at boot, before the
+        // scheduler threads start, and never changed mid-run, so a shard's
+        // owner stays fixed when the orchestrator thread later joins dispatch.
+        int32_t thread_count{1};
     } wiring;
 
-    static_assert(
-        offsetof(WiringState, queue) == 256, "WiringState: batch region must be exactly 4 cache lines before queue"
-    );
-    static_assert(sizeof(WiringState) == 640, "WiringState must be exactly 10 cache lines (640B)");
-
     alignas(64) AsyncWaitList async_wait_list;
 
+#if PTO2_PROFILING
+    // Online edge export (L2_SWIMLANE_EDGES_FLAG). Set once per run from
+    // l2_swimlane_aicpu_edges_enabled() before the scheduler threads start;
+    // read by the wiring thread in wire_task.
+    bool l2_swimlane_edges{false};
+#endif
+
     // Statistics (cold path, isolated from hot-path fields)
 #if PTO2_SCHED_PROFILING
     alignas(64) std::atomic<int64_t> tasks_completed;
@@ -700,39 +723,57 @@ struct PTO2SchedulerState {
     // =========================================================================
 
     /**
-     * Drain wiring queue: pop submitted tasks and wire their fanout edges.
-     * Called by scheduler thread 0 each loop iteration. Sets fanin_count,
-     * acquires fanout_lock per producer, allocates dep_pool entries, and
-     * pushes ready tasks to the appropriate ready queue.
+     * Drain the wiring shards owned by `thread_idx`: rings thread_idx,
+     * thread_idx + wiring.thread_count, ... Called by every scheduler thread
+     * each loop iteration; threads past wiring.thread_count own no shard.
      *
+     * @param thread_idx Calling scheduler thread; selects its shards and its
+     *                   edge-export pool.
      * @return Number of tasks wired this call.
      */
+    int drain_wiring_queue(bool force_drain = false, int thread_idx = 0) {
+        int wired = 0;
+        for (int r = thread_idx; r < PTO2_MAX_RING_DEPTH && thread_idx < wiring.thread_count;
+             r += wiring.thread_count) {
+            wired += drain_wiring_shard(r, force_drain, thread_idx);
+        }
+        return wired;
+    }
 
-    int drain_wiring_queue(bool force_drain = false) {
+    /**
+     * Drain one ring's wiring shard: pop submitted tasks and wire their
+     * fanout edges. Only the shard's owning thread may call this. Sets
+     * fanin_count, acquires fanout_lock per producer, allocates dep_pool
+     * entries from this ring's pool, and pushes ready tasks to the
+     * appropriate ready queue.
+     *
+     * @return Number of tasks wired this call.
+     */
+    int drain_wiring_shard(int ring_id, bool force_drain, int thread_idx) {
+        WiringShard &shard = wiring.shards[ring_id];
+        auto &rss = ring_sched_states[ring_id];
         int wired = 0;
 
         // Refill local batch buffer when exhausted.
-        if (wiring.batch_index >= wiring.batch_count) {
+        if (shard.batch_index >= shard.batch_count) {
             // Backoff: defer pop when queue holds fewer than a full batch,
             // unless force_drain, orch_needs_drain, or backoff limit reached.
-            if (!force_drain && wiring.queue.size() < WiringState::BATCH_SIZE) {
+            if (!force_drain && shard.queue.size() < WiringShard::BATCH_SIZE) {
                 if (!wiring.orch_needs_drain.load(std::memory_order_acquire) &&
-                    wiring.backoff_counter < WiringState::BACKOFF_LIMIT) {
-                    wiring.backoff_counter++;
+                    shard.backoff_counter < WiringShard::BACKOFF_LIMIT) {
+                    shard.backoff_counter++;
                     return 0;
                 }
             }
-            wiring.backoff_counter = 0;
-            wiring.batch_count = wiring.queue.pop_batch(wiring.batch, WiringState::BATCH_SIZE);
-            wiring.batch_index = 0;
-            if (wiring.batch_count == 0) return 0;
+            shard.backoff_counter = 0;
+            shard.batch_count = shard.queue.pop_batch(shard.batch, WiringShard::BATCH_SIZE);
+            shard.batch_index = 0;
+            if (shard.batch_count == 0) return 0;
         }
 
         // Process tasks from local buffer in strict FIFO order.
-        while (wiring.batch_index < wiring.batch_count) {
-            PTO2TaskSlotState *ws = wiring.batch[wiring.batch_index];
-            int ring_id = ws->ring_id;
-            auto &rss = ring_sched_states[ring_id];
+        while (shard.batch_index < shard.batch_count) {
+            PTO2TaskSlotState *ws = shard.batch[shard.batch_index];
             int32_t wfanin = ws->payload->fanin_actual_count;
 
             if (wfanin > 0 && rss.dep_pool.available() < wfanin) {
@@ -747,8 +788,9 @@ struct PTO2SchedulerState {
                     // wedged. This runs on the scheduler thread, so unlike
                     // alloc()'s detector it cannot self-observe that the
                     // orchestrator is blocked; wiring.producer_blocked is the
-                    // external certificate -- the orchestrator sets it ONLY while
-                    // it is actually spinning in queue.push() (cleared on a
+                    // external certificate -- the orchestrator sets it to
+                    // ring_id + 1 ONLY while it is actually spinning in this
+                    // shard's queue.push() (cleared on a
                     // successful push), so the "just filled the queue then called
                     // scope_end" case (push succeeded -> flag stays 0) cannot trip
                     // a false report. With the producer provably stuck in push
@@ -758,7 +800,7 @@ struct PTO2SchedulerState {
                     // deadlock. The producer-blocked gate also pins the head:
                     // scope_end has not run, so the scope-gated head cannot be
                     // CONSUMED/reset concurrently while we read it.
-                    if (!rss.dep_deadlock_reported && wiring.producer_blocked.load(std::memory_order_acquire) != 0) {
+                    if (!rss.dep_deadlock_reported && wiring.producer_blocked.load(std::memory_order_acquire) == ring_id + 1) {
                         int32_t last_alive = rss.last_task_alive;
                         PTO2TaskSlotState &h = rss.ring->get_slot_state_by_task_id(last_alive);
                         // Read the head under its fanout_lock: fanout_count is a
@@ -789,8 +831,8 @@ struct PTO2SchedulerState {
                 }
             }
 
-            wiring.batch_index++;
-            wire_task(rss, ws, wfanin);
+            shard.batch_index++;
+            wire_task(rss, ws, wfanin, thread_idx);
             wired++;
         }
 
@@ -840,13 +882,21 @@ struct PTO2SchedulerState {
      * Wire fanout edges for a single task. Sets fanin_count, acquires each
      * producer's fanout_lock, allocates dep_pool entries for live producers,
      * pushes the task to the ready queue once its fanin refcount is satisfied.
+     * With edge export on, also emits one (producer, consumer) record per
+     * fanin, early-finished producers included.
      */
-    void wire_task(RingSchedState &rss, PTO2TaskSlotState *ws, int32_t wfanin) {
+    void wire_task(RingSchedState &rss, PTO2TaskSlotState *ws, int32_t wfanin, int thread_idx = 0) {
         PTO2TaskPayload *wp = ws->payload;
         ws->fanin_count = wfanin + 1;
 
         if (wfanin != 0) {
             int32_t early_finished = 0;
+#if PTO2_PROFILING
+            const bool record_edges = l2_swimlane_edges;
+            const uint64_t consumer_id = record_edges ? ws->task->task_id.raw : 0;
+#else
+            (void)thread_idx;
+#endif
             for_each_fanin_slot_state(*wp, [&](PTO2TaskSlotState *producer) {
                 producer->lock_fanout();
                 int32_t pstate = producer->task_state.load(std::memory_order_acquire);
@@ -856,6 +906,11 @@ struct PTO2SchedulerState {
                     producer->fanout_head = rss.dep_pool.prepend(producer->fanout_head, ws);
                 }
                 producer->unlock_fanout();
+#if PTO2_PROFILING
+                if (record_edges) {
+                    l2_swimlane_aicpu_record_edge(thread_idx, producer->task->task_id.raw, consumer_id);
+                }
+#endif
             });
 
             // Seed dispatch_fanin with producers already complete at wiring
@@ -1428,7 +1483,7 @@ struct PTO2SchedulerState {
 
     // Phase 3b: write the arena-internal pointer fields
     // (ready_queues[].slots, dummy_ready_queue.slots, dep_pool.base for each
-    // ring, wiring.queue.buffer_). Called on both host and device sides.
+    // ring, wiring.shards[].queue.buffer_). Called on both host and device sides.
     void wire_arena_pointers(const PTO2SchedulerLayout &layout, DeviceArena &arena);
 
     // Forget per-region pointers; arena owns the backing memory.
@@ -23,6 +23,7 @@
 #include "spin_hint.h"
 
 // Performance profiling headers
+#include "aicpu/flight_recorder_aicpu.h"
 #include "aicpu/l2_swimlane_collector_aicpu.h"
 #include "aicpu/pmu_collector_aicpu.h"
 #include "aicpu/tensor_dump_aicpu.h"
@@ -95,6 +96,11 @@ void SchedulerContext::complete_slot_task(
     auto &l2_swimlane = sched_l2_swimlane_[thread_idx];
 #else
     (void)hank;
+#endif
+#if PTO2_FLIGHT_RECORDER
+    flight_recorder_record(
+        thread_idx, FLIGHT_RECORDER_EVENT_FIN, slot_state.task->task_id.raw, static_cast<uint32_t>(core_id)
+    );
 #endif
     // MPSC fast-path is opt-in per task: only tasks with at least one subtask
     // that registered a deferred condition route through the mailbox. Pure
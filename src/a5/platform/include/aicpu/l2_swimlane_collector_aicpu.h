@@ -251,4 +251,46 @@ void l2_swimlane_aicpu_flush_sched_phase_buffer(int thread_idx);
  */
 void l2_swimlane_aicpu_flush_orch_phase_buffer(int thread_idx);
 
+/**
+ * Initialize online edge export (L2_SWIMLANE_EDGES_FLAG).
+ *
+ * No-op unless the host set `L2SwimlaneDataHeader::edges_enabled`. Otherwise
+ * writes `num_edge_threads` into the header and primes one edge pool per
+ * wiring-capable scheduler thread. Must be called once after
+ * l2_swimlane_aicpu_init(), independent of the level.
+ *
+ * @param worker_count      Number of AICore workers (cores) — resolves the
+ *                          edge region's offset relative to the L2Swimlane base
+ * @param num_edge_threads  Number of edge pools to prime
+ */
+void l2_swimlane_aicpu_init_edges(int worker_count, int num_edge_threads);
+
+/**
+ * @return true when edge pools were primed for the current launch. The
+ *         scheduler caches this once per run (PTO2SchedulerState) so the
+ *         per-fanin gate in wire_task is a plain bool load.
+ */
+bool l2_swimlane_aicpu_edges_enabled();
+
+/**
+ * Record one wired dependency. Called from wire_task for every fanin producer.
+ * Silently drops (and counts) the record when no buffer is available.
+ *
+ * extern "C" so runtime UT builds that don't link the collector can supply a
+ * weak fallback (same pattern as is_scope_stats_enabled).
+ *
+ * @param thread_idx  Wiring scheduler thread (= edge pool index = ready queue)
+ * @param producer    Producer task id, PTO2 raw encoding
+ * @param consumer    Consumer task id, PTO2 raw encoding
+ */
+extern "C" void l2_swimlane_aicpu_record_edge(int thread_idx, uint64_t producer, uint64_t consumer);
+
+/**
+ * Flush the remaining edge records for a scheduler thread. Called at
+ * scheduler-thread exit; no-op for threads whose pool was never primed.
+ *
+ * @param thread_idx Scheduler thread index (= edge pool index = ready queue)
+ */
+void l2_swimlane_aicpu_flush_edge_buffer(int thread_idx);
+
 #endif  // PLATFORM_AICPU_L2_SWIMLANE_COLLECTOR_AICPU_H_
@@ -95,6 +95,11 @@ struct KernelArgs {
     // See the a2a3 kernel_args.h for the full design rationale (CANN's
     // AICPU args copy makes inline fields write-only).
     uint64_t device_wall_data_base{0};
+    // Device pointer to the flight-recorder region (FlightRecorderHeader +
+    // one overwrite ring per AICPU thread, see common/flight_recorder.h).
+    // Allocated once and kept resident; ring contents persist across runs so
+    // a snapshot covers the tail of earlier steps too. Zero = recorder off.
+    uint64_t flight_recorder_data_base{0};
     // ACL device ordinal. Pushed to the AICPU so the executor can suffix the
     // staged orchestration SO name (libdevice_orch_<pid>_<cid>_<device_id>.so),
     // mirroring the per-device simpler_inner preinstall fix.
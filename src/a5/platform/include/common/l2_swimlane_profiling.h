@@ -22,6 +22,7 @@
  * │  - num_cores, l2_swimlane_level                             │
  * │  - num_sched_phase_threads, num_orch_phase_threads,         │
  * │    num_phase_cores, core_to_thread[]                        │
+ * │  - edges_enabled, num_edge_threads                          │
  * ├─────────────────────────────────────────────────────────────┤
  * │ L2SwimlaneAicpuTaskPool[0..num_cores-1]                     │
  * │  - head:       active L2SwimlaneAicpuTaskBuffer + counters  │
@@ -40,6 +41,9 @@
  * ├─────────────────────────────────────────────────────────────┤
  * │ L2SwimlaneAicpuOrchPhasePool[0..num_orch_phase_threads-1]   │
  * │  - head, free_queue                                         │
+ * ├─────────────────────────────────────────────────────────────┤
+ * │ L2SwimlaneAicpuEdgePool[0..num_edge_threads-1]              │
+ * │  - head, free_queue                                         │
  * └─────────────────────────────────────────────────────────────┘
  *
  * Actual L2SwimlaneAicpuTaskBuffer / L2SwimlaneAicpuSchedPhaseBuffer /
@@ -50,6 +54,7 @@
  * With phases = Base + num_cores * sizeof(L2SwimlaneAicoreTaskPool)
  *                    + num_sched_phase_threads * sizeof(L2SwimlaneAicpuSchedPhasePool)
  *                    + num_orch_phase_threads  * sizeof(L2SwimlaneAicpuOrchPhasePool)
+ * With edges  = With phases + num_edge_threads * sizeof(L2SwimlaneAicpuEdgePool)
  */
 
 #ifndef SRC_A5_PLATFORM_INCLUDE_COMMON_L2_SWIMLANE_PROFILING_H_
@@ -84,6 +89,13 @@ enum class L2SwimlaneLevel : uint32_t {
     ORCH_PHASES = 4,    // + orchestrator phase records
 };
 
+// Edge export is orthogonal to the level ladder (it can ride on any level,
+// including AICORE_TIMING), so it travels as a flag bit above the level in
+// `CallConfig::enable_l2_swimlane`. Host splits the two apart before writing
+// `L2SwimlaneDataHeader::{l2_swimlane_level, edges_enabled}`.
+constexpr int32_t L2_SWIMLANE_LEVEL_MASK = 0xff;
+constexpr int32_t L2_SWIMLANE_EDGES_FLAG = 0x100;
+
 // =============================================================================
 // L2SwimlaneAicpuTaskRecord - AICPU-side timing record
 // =============================================================================
@@ -106,11 +118,12 @@ enum class L2SwimlaneLevel : uint32_t {
  * func_id = -1 (resolved post-process by `swimlane_converter.py` from
  * deps.json's `kernel_ids[]`). Same path AICORE_TIMING (level=1) uses.
  *
- * Fanout edges live in the static DAG (deps.json from dep_gen) — not in
- * this record. Keeping fanout out of the hot AICPU commit path avoids a
- * per-task ~1 KB GM store + a linked-list walk on the scheduler's
- * critical fanin tail. `swimlane_converter.py` joins deps.json at
- * post-process time.
+ * Fanout edges are not in this record. Keeping fanout out of the hot AICPU
+ * commit path avoids a per-task ~1 KB GM store + a linked-list walk on the
+ * scheduler's critical fanin tail. Edges come either from the static DAG
+ * (deps.json from dep_gen) or, with L2_SWIMLANE_EDGES_FLAG, from the
+ * per-thread L2SwimlaneAicpuEdgeRecord stream emitted at wiring time;
+ * `swimlane_converter.py` joins them at post-process time.
  *
  * Layout: 16B timing + 4B reg_task_id → 20B logical; `aligned(32)` rounds
  * the struct size up to 32B (compiler-inserted trailing pad) and forces
@@ -371,6 +384,7 @@ enum class L2SwimlaneBufferKind : uint32_t {
     AicpuSchedPhase = 1,  // Per-thread L2SwimlaneAicpuSchedPhaseBuffer, AICPU writes
     AicpuOrchPhase = 2,   // Per-thread L2SwimlaneAicpuOrchPhaseBuffer, AICPU writes
     AicoreTask = 3,       // Per-core L2SwimlaneAicoreTaskBuffer, AICore writes, AICPU enqueues at rotation
+    AicpuEdge = 4,        // Per-thread L2SwimlaneAicpuEdgeBuffer, AICPU writes at wiring time
 };
 
 /**
@@ -433,6 +447,12 @@ struct L2SwimlaneDataHeader {
     uint32_t num_orch_phase_threads;            // Number of orch-phase pools the AICPU initialized
     uint32_t num_phase_cores;                   // Number of valid entries in core_to_thread (0 = unset)
     int8_t core_to_thread[PLATFORM_MAX_CORES];  // core_id → scheduler thread index (-1 = unassigned)
+
+    // Edge export (L2_SWIMLANE_EDGES_FLAG). Host writes edges_enabled at init;
+    // AICPU writes num_edge_threads in l2_swimlane_aicpu_init_edges (0 = edge
+    // pools never primed).
+    uint32_t edges_enabled;
+    uint32_t num_edge_threads;
 } __attribute__((aligned(64)));
 
 // ABI lock for the merged header. The phase metadata fields and the
@@ -454,6 +474,11 @@ static_assert(
         offsetof(L2SwimlaneDataHeader, num_phase_cores) + sizeof(uint32_t),
     "L2SwimlaneDataHeader: core_to_thread[] must follow num_phase_cores"
 );
+static_assert(
+    offsetof(L2SwimlaneDataHeader, edges_enabled) ==
+        offsetof(L2SwimlaneDataHeader, core_to_thread) + PLATFORM_MAX_CORES * sizeof(int8_t),
+    "L2SwimlaneDataHeader: edges_enabled must follow core_to_thread[]"
+);
 static_assert(sizeof(L2SwimlaneDataHeader) % 64 == 0, "L2SwimlaneDataHeader must be 64-byte aligned");
 
 // =============================================================================
@@ -587,6 +612,30 @@ using L2SwimlaneAicpuOrchPhaseBuffer = TypedBuffer<L2SwimlaneAicpuOrchPhaseRecor
 using L2SwimlaneAicpuSchedPhasePool = L2SwimlaneAicpuTaskPool;
 using L2SwimlaneAicpuOrchPhasePool = L2SwimlaneAicpuTaskPool;
 
+// =============================================================================
+// AICPU Edge Export - Online Dependency Graph
+// =============================================================================
+
+/**
+ * One wired dependency (16 bytes). Emitted by the scheduler's wire_task for
+ * every fanin producer of a task, including producers that had already
+ * completed by wiring time, so the stream reproduces the full DAG rather than
+ * only the edges that ended up in a fanout list. Both ids are the full PTO2
+ * encoding (ring_id << 32) | local_id, the same key as the AICore record's
+ * task_token_raw. No timestamps: ordering and timing come from the task
+ * records, this stream only carries structure.
+ */
+struct L2SwimlaneAicpuEdgeRecord {
+    uint64_t producer;  // Producer task id (PTO2 raw encoding)
+    uint64_t consumer;  // Consumer task id (PTO2 raw encoding)
+};
+static_assert(sizeof(L2SwimlaneAicpuEdgeRecord) == 16, "L2SwimlaneAicpuEdgeRecord layout drift");
+
+// Same capacity as the phase buffers (~256KB of edges per buffer) so the
+// shared phase acquire / switch / flush helpers drive edge pools unchanged.
+using L2SwimlaneAicpuEdgeBuffer = TypedBuffer<L2SwimlaneAicpuEdgeRecord, PLATFORM_PHASE_RECORDS_PER_THREAD>;
+using L2SwimlaneAicpuEdgePool = L2SwimlaneAicpuTaskPool;
+
 // =============================================================================
 // Helper Functions - Memory Layout
 // =============================================================================
@@ -715,6 +764,31 @@ inline L2SwimlaneAicpuOrchPhasePool *get_orch_phase_buffer_state(void *base_ptr,
     return &get_orch_phase_buffer_states(base_ptr, num_cores)[thread_idx];
 }
 
+/**
+ * Calculate total memory size including the per-thread edge pools. Edge pools
+ * follow the orch-phase array; both phase arrays sit at the
+ * `PLATFORM_MAX_AICPU_THREADS` stride (see get_orch_phase_buffer_states).
+ */
+inline size_t calc_perf_data_size_with_edges(int num_cores, int num_edge_threads) {
+    return calc_perf_data_size_with_phases(num_cores, PLATFORM_MAX_AICPU_THREADS, PLATFORM_MAX_AICPU_THREADS) +
+           num_edge_threads * sizeof(L2SwimlaneAicpuEdgePool);
+}
+
+/**
+ * Get L2SwimlaneAicpuEdgePool array start address (located immediately after
+ * the L2SwimlaneAicpuOrchPhasePool array, same fixed-stride rule).
+ */
+inline L2SwimlaneAicpuEdgePool *get_edge_buffer_states(void *base_ptr, int num_cores) {
+    return reinterpret_cast<L2SwimlaneAicpuEdgePool *>(
+        reinterpret_cast<char *>(get_orch_phase_buffer_states(base_ptr, num_cores)) +
+        PLATFORM_MAX_AICPU_THREADS * sizeof(L2SwimlaneAicpuOrchPhasePool)
+    );
+}
+
+inline L2SwimlaneAicpuEdgePool *get_edge_buffer_state(void *base_ptr, int num_cores, int thread_idx) {
+    return &get_edge_buffer_states(base_ptr, num_cores)[thread_idx];
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -166,6 +166,14 @@ constexpr int PLATFORM_PROF_BUFFERS_PER_CORE = 8;
 constexpr int PLATFORM_PROF_SCHED_BUFFERS_PER_THREAD = 6;
 constexpr int PLATFORM_PROF_ORCH_BUFFERS_PER_THREAD = 8;
 
+/**
+ * Host preallocation count per AICPU thread for the optional edge-export pool
+ * (L2SwimlaneAicpuEdgeBuffer, L2_SWIMLANE_EDGES_FLAG). Allocated only when edge
+ * export is requested. Same floor as the phase pools. The edge pools share the
+ * per-thread ready queue below; its phase term already has ample slack.
+ */
+constexpr int PLATFORM_PROF_EDGE_BUFFERS_PER_THREAD = 6;
+
 /**
  * Per-core L2SwimlaneAicoreTaskBuffer pre-allocation count.
  * 1 goes into the free_queue at init, the rest are recycled by host as
@@ -396,6 +404,41 @@ constexpr int PLATFORM_SCOPE_STATS_READYQUEUE_SIZE = PLATFORM_SCOPE_STATS_BUFFER
  */
 constexpr int PLATFORM_SCOPE_STATS_TIMEOUT_SECONDS = 30;
 
+// =============================================================================
+// Flight Recorder Configuration
+// =============================================================================
+
+/**
+ * FlightRecord slots per AICPU thread ring (must be a power of two).
+ * Each record is 16 B, so one ring is 64 KB and the whole region is
+ * PLATFORM_MAX_AICPU_THREADS rings. Sized to hold the last few thousand
+ * dispatch/FIN events of a thread, i.e. the tail of a slow or failing step.
+ */
+constexpr int PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD = 4096;
+static_assert(
+    (PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD & (PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD - 1)) == 0,
+    "PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD must be a power of two"
+);
+
+// =============================================================================
+// Async Copy Configuration
+// =============================================================================
+
+/**
+ * Chunk size of the async host<->device copy engine. Onboard, each of the two
+ * pinned staging slots is this large: a transfer is split into chunks that
+ * alternate between the slots, so the pageable<->pinned memcpy of one chunk
+ * overlaps the DMA of the other. Sim uses it as the minimum stripe size of
+ * its memcpy pool.
+ */
+constexpr uint64_t PLATFORM_ASYNC_COPY_CHUNK_BYTES = 4ULL * 1024 * 1024;
+
+/**
+ * Sim only: memcpy lanes (including the copy-queue thread itself) that one
+ * async copy is striped across.
+ */
+constexpr int PLATFORM_SIM_ASYNC_COPY_LANES = 4;
+
 // =============================================================================
 // Register Communication Configuration
 // =============================================================================
@@ -36,6 +36,7 @@
 
 #include "common/core_type.h"
 #include "common/platform_config.h"
+#include "common/prof_dirty_summary.h"
 
 /**
  * PMU event type selector. Values match pypto's PROF_PMU_EVENT_TYPE (see
@@ -254,6 +255,21 @@ struct PmuReadyQueueEntry {
 
 static_assert(sizeof(PmuReadyQueueEntry) == 32, "PmuReadyQueueEntry must be 32 bytes");
 
+/**
+ * Dirty-summary slot layout (see common/prof_dirty_summary.h):
+ *   [0, PLATFORM_MAX_AICPU_THREADS)           queue_tails[q]
+ *   [PMU_DIRTY_CORE_SLOT_BASE, + num_cores)   PmuBufferState[core]
+ *
+ * AICPU bumps a core slot whenever it pops free_queue.head or changes
+ * current_buf_ptr. The per-task counters (total/dropped/mismatch) are not
+ * tracked: the mgmt tick never reads them, and reconcile pulls the whole
+ * region after stop().
+ */
+constexpr int PMU_DIRTY_QUEUE_SLOT_BASE = 0;
+constexpr int PMU_DIRTY_CORE_SLOT_BASE = PLATFORM_MAX_AICPU_THREADS;
+constexpr int PMU_DIRTY_SLOT_COUNT = PLATFORM_MAX_AICPU_THREADS + PLATFORM_MAX_CORES;
+using PmuDirtySummary = ProfDirtySummary<PMU_DIRTY_SLOT_COUNT>;
+
 /**
  * PMU data fixed header, located at the start of PMU shared memory.
  *
@@ -268,6 +284,7 @@ struct PmuDataHeader {
     uint32_t num_cores;
     uint32_t event_type;  // PmuEventType value, written by host at init
     uint32_t pad[2];
+    PmuDirtySummary dirty;  // AICPU writes; host pulls it instead of the whole region per tick
 } __attribute__((aligned(64)));
 
 // =============================================================================
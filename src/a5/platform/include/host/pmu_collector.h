@@ -21,8 +21,10 @@
  *   and appends them to the CSV file.
  *
  * a5 specifics: device↔host transfers go through profiling_copy.h. The
- * framework's mgmt loop mirrors the shm region per tick; per-buffer
- * payloads (PmuBuffer) are pulled on demand inside ProfilerAlgorithms.
+ * framework's mgmt loop refreshes the shm region per tick — only the
+ * queue_tails / PmuBufferState ranges whose PmuDirtySummary generation
+ * moved, or the whole region as a fallback; per-buffer payloads
+ * (PmuBuffer) are pulled on demand inside ProfilerAlgorithms.
  *
  * Lifecycle:
  *   init()                       — Allocate header + per-core states +
@@ -146,6 +148,23 @@ struct PmuModule {
             cb(/*kind=*/0, &state->free_queue, sizeof(PmuBuffer));
         }
     }
+
+    // Dirty-range mirroring (see common/prof_dirty_summary.h). Slots past
+    // num_cores map to an empty range and are never pulled.
+    static constexpr int kDirtySlots = PMU_DIRTY_SLOT_COUNT;
+
+    static PmuDirtySummary *dirty_summary_from_shm(void *shm) { return &get_pmu_header(shm)->dirty; }
+
+    static profiling_common::ShmRange dirty_slot_range(void *shm, int slot) {
+        PmuDataHeader *header = get_pmu_header(shm);
+        if (slot < PMU_DIRTY_CORE_SLOT_BASE) {
+            const int q = slot - PMU_DIRTY_QUEUE_SLOT_BASE;
+            return {&header->queue_tails[q], sizeof(header->queue_tails[q])};
+        }
+        const int core = slot - PMU_DIRTY_CORE_SLOT_BASE;
+        if (core >= static_cast<int>(header->num_cores)) return {nullptr, 0};
+        return {get_pmu_buffer_state(shm, core), sizeof(PmuBufferState)};
+    }
 };
 
 // ---------------------------------------------------------------------------
@@ -14,6 +14,7 @@
 #include "common/kernel_args.h"
 #include "common/platform_config.h"
 #include "aicpu/dep_gen_collector_aicpu.h"
+#include "aicpu/flight_recorder_aicpu.h"
 #include "aicpu/device_log.h"
 #include "aicpu/device_time.h"
 #include "aicpu/l2_swimlane_collector_aicpu.h"
@@ -90,6 +91,7 @@ extern "C" __attribute__((visibility("default"))) int simpler_aicpu_exec(void *a
     set_dep_gen_enabled(GET_PROFILING_FLAG(k_args->enable_profiling_flag, PROFILING_FLAG_DEP_GEN));
     set_scope_stats_enabled(GET_PROFILING_FLAG(k_args->enable_profiling_flag, PROFILING_FLAG_SCOPE_STATS));
     set_platform_scope_stats_base(k_args->scope_stats_data_base);
+    set_platform_flight_recorder_base(k_args->flight_recorder_data_base);
 
     // Filter-style affinity gate (a5). Host probed the topology, computed
     // ALLOWED_CPUS, and wrote it into runtime->aicpu_allowed_cpus[]. The
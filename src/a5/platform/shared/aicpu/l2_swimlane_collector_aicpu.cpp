@@ -76,6 +76,12 @@ static L2SwimlaneAicpuOrchPhaseBuffer *s_current_orch_phase_buffers[PLATFORM_MAX
 
 static int s_orch_thread_idx = -1;
 
+// Per-thread edge pool/buffer caches (per wiring scheduler thread). Primed
+// only when the host requested edge export (header->edges_enabled).
+static bool s_edges_initialized = false;
+static L2SwimlaneAicpuEdgePool *s_edge_pools[PLATFORM_MAX_AICPU_THREADS] = {};
+static L2SwimlaneAicpuEdgeBuffer *s_current_edge_buffers[PLATFORM_MAX_AICPU_THREADS] = {};
+
 // L2 swimlane platform state. Published by the host (via dlsym'd setters on sim)
 // or by the AICPU kernel entry (onboard) before perf init runs, so downstream
 // perf code can discover enablement + device-base without reading the generic
@@ -152,6 +158,7 @@ void l2_swimlane_aicpu_init(int worker_count) {
     // in onboard/aicore/kernel.cpp for the AICore-side rotation slot
     // (fixed in #936).
     s_phase_initialized = false;
+    s_edges_initialized = false;
 
     // Reset AICore dispatch-count bookkeeping for the same reason: the next
     // launch must start counting from 0 so the rotation boundary check
@@ -876,12 +883,18 @@ static void flush_phase_pool(
     uint64_t buf_ptr = state->head.current_buf_ptr;
     if (buf_ptr == 0) return;
     // `count` sits AFTER the records[] array in TypedBuffer, so its byte offset
-    // is N * sizeof(Record) — different for sched (40B) vs orch (32B) records.
+    // is N * sizeof(Record) — different for sched (64B), orch (32B) and edge
+    // (16B) records.
     // Read/write it through the matching buffer type; a single fixed cast reads
     // past the orch buffer, sees 0, and silently skips the orch flush.
-    volatile uint32_t *count_ptr = (kind == L2SwimlaneBufferKind::AicpuOrchPhase) ?
-                                       &reinterpret_cast<L2SwimlaneAicpuOrchPhaseBuffer *>(buf_ptr)->count :
-                                       &reinterpret_cast<L2SwimlaneAicpuSchedPhaseBuffer *>(buf_ptr)->count;
+    volatile uint32_t *count_ptr = nullptr;
+    if (kind == L2SwimlaneBufferKind::AicpuOrchPhase) {
+        count_ptr = &reinterpret_cast<L2SwimlaneAicpuOrchPhaseBuffer *>(buf_ptr)->count;
+    } else if (kind == L2SwimlaneBufferKind::AicpuEdge) {
+        count_ptr = &reinterpret_cast<L2SwimlaneAicpuEdgeBuffer *>(buf_ptr)->count;
+    } else {
+        count_ptr = &reinterpret_cast<L2SwimlaneAicpuSchedPhaseBuffer *>(buf_ptr)->count;
+    }
     if (*count_ptr == 0) return;
     uint32_t seq = state->head.current_buf_seq;
     int rc = enqueue_ready_buffer(s_l2_swimlane_header, thread_idx, pool_idx, buf_ptr, seq, kind);
@@ -918,6 +931,66 @@ void l2_swimlane_aicpu_flush_orch_phase_buffer(int thread_idx) {
     s_current_orch_phase_buffers[0] = nullptr;
 }
 
+void l2_swimlane_aicpu_init_edges(int worker_count, int num_edge_threads) {
+    s_edges_initialized = false;
+    void *l2_swimlane_base = reinterpret_cast<void *>(g_platform_l2_swimlane_base);
+    if (l2_swimlane_base == nullptr) {
+        return;
+    }
+    s_l2_swimlane_header = get_l2_swimlane_header(l2_swimlane_base);
+    s_l2_swimlane_header->num_edge_threads = 0;
+    if (s_l2_swimlane_header->edges_enabled == 0) {
+        return;
+    }
+
+    int edge_n = num_edge_threads;
+    if (edge_n > PLATFORM_MAX_AICPU_THREADS) edge_n = PLATFORM_MAX_AICPU_THREADS;
+    for (int t = 0; t < edge_n; t++) {
+        auto *state = get_edge_buffer_state(l2_swimlane_base, worker_count, t);
+        s_edge_pools[t] = state;
+        s_current_edge_buffers[t] = prime_phase_pool<L2SwimlaneAicpuEdgeBuffer>(state, t, "edge");
+    }
+    for (int t = edge_n; t < PLATFORM_MAX_AICPU_THREADS; t++) {
+        s_edge_pools[t] = nullptr;
+        s_current_edge_buffers[t] = nullptr;
+    }
+    s_l2_swimlane_header->num_edge_threads = static_cast<uint32_t>(edge_n);
+    s_edges_initialized = true;
+    wmb();
+
+    LOG_INFO_V0("Edge export initialized: %d threads, %d records/buffer", edge_n, PLATFORM_PHASE_RECORDS_PER_THREAD);
+}
+
+bool l2_swimlane_aicpu_edges_enabled() { return g_enable_l2_swimlane && s_edges_initialized; }
+
+extern "C" void l2_swimlane_aicpu_record_edge(int thread_idx, uint64_t producer, uint64_t consumer) {
+    if (!s_edges_initialized) return;
+    auto *state = s_edge_pools[thread_idx];
+    if (state == nullptr) return;
+
+    state->head.total_record_count += 1;
+
+    auto *record = acquire_phase_slot<L2SwimlaneAicpuEdgeBuffer, L2SwimlaneAicpuEdgeRecord>(
+        /*thread_idx=*/thread_idx, /*pool_idx=*/static_cast<uint32_t>(thread_idx), state,
+        &s_current_edge_buffers[thread_idx], L2SwimlaneBufferKind::AicpuEdge, "edge"
+    );
+    if (record == nullptr) {
+        state->head.dropped_record_count += 1;
+        return;
+    }
+    record->producer = producer;
+    record->consumer = consumer;
+}
+
+void l2_swimlane_aicpu_flush_edge_buffer(int thread_idx) {
+    if (!s_edges_initialized || s_l2_swimlane_header == nullptr) return;
+    flush_phase_pool(
+        thread_idx, static_cast<uint32_t>(thread_idx), s_edge_pools[thread_idx], L2SwimlaneBufferKind::AicpuEdge,
+        "edge"
+    );
+    s_current_edge_buffers[thread_idx] = nullptr;
+}
+
 void l2_swimlane_aicpu_init_core_assignments(int total_cores) {
     if (!s_phase_initialized) {
         return;
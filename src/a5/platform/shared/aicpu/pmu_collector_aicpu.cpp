@@ -120,6 +120,7 @@ static int enqueue_pmu_ready_buffer(int thread_idx, uint32_t core_index, uint64_
     s_pmu_header->queues[thread_idx][current_tail].buffer_ptr = buffer_ptr;
     s_pmu_header->queues[thread_idx][current_tail].buffer_seq = buffer_seq;
     s_pmu_header->queue_tails[thread_idx] = next_tail;
+    prof_dirty_mark(&s_pmu_header->dirty, PMU_DIRTY_QUEUE_SLOT_BASE + thread_idx);
     return 0;
 }
 
@@ -172,6 +173,7 @@ static void pmu_switch_buffer(int core_id, int thread_idx) {
     state->free_queue.head = head + 1;
     state->current_buf_ptr = new_buf_ptr;
     state->current_buf_seq = seq + 1;
+    prof_dirty_mark(&s_pmu_header->dirty, PMU_DIRTY_CORE_SLOT_BASE + core_id);
     wmb();
 
     PmuBuffer *new_buf = reinterpret_cast<PmuBuffer *>(new_buf_ptr);
@@ -259,7 +261,9 @@ void pmu_aicpu_init(const uint32_t *physical_core_ids, int num_cores) {
             LOG_ERROR("Core %d: PMU free_queue is empty during init!", i);
             state->current_buf_ptr = 0;
         }
+        prof_dirty_mark(&s_pmu_header->dirty, PMU_DIRTY_CORE_SLOT_BASE + i);
     }
+    prof_dirty_publish(&s_pmu_header->dirty);
 
     LOG_INFO_V0("PMU initialized: %d cores, event_type=%u", num_cores, pmu_event_type);
 }
@@ -378,6 +382,7 @@ void pmu_aicpu_flush_buffers(int thread_idx, const int *cur_thread_cores, int co
         if (rc == 0) {
             LOG_INFO_V0("Thread %d: Core %d flushed PMU buffer with %u records", thread_idx, core_id, buf->count);
             state->current_buf_ptr = 0;
+            prof_dirty_mark(&s_pmu_header->dirty, PMU_DIRTY_CORE_SLOT_BASE + core_id);
             wmb();
         } else {
             // ready_queue full at end-of-run: account the loss and clear the
@@ -390,6 +395,7 @@ void pmu_aicpu_flush_buffers(int thread_idx, const int *cur_thread_cores, int co
             state->dropped_record_count += buf->count;
             buf->count = 0;
             state->current_buf_ptr = 0;
+            prof_dirty_mark(&s_pmu_header->dirty, PMU_DIRTY_CORE_SLOT_BASE + core_id);
             wmb();
         }
     }
@@ -48,7 +48,7 @@ L2SwimlaneCollector::~L2SwimlaneCollector() {
 }
 
 int L2SwimlaneCollector::initialize(
-    int num_aicore, int aicpu_thread_num, int device_id, L2SwimlaneLevel l2_swimlane_level,
+    int num_aicore, int aicpu_thread_num, int device_id, L2SwimlaneLevel l2_swimlane_level, bool enable_edges,
     const L2SwimlaneAllocCallback &alloc_cb, L2SwimlaneRegisterCallback register_cb,
     const L2SwimlaneFreeCallback &free_cb, const std::string &output_prefix
 ) {
@@ -74,10 +74,12 @@ int L2SwimlaneCollector::initialize(
     num_aicore_ = num_aicore;
     aicpu_thread_num_ = aicpu_thread_num;
     l2_swimlane_level_ = l2_swimlane_level;
+    enable_edges_ = enable_edges;
     output_prefix_ = output_prefix;
     total_perf_collected_ = 0;
     total_sched_phase_collected_ = 0;
     total_orch_phase_collected_ = 0;
+    total_edge_collected_ = 0;
 
     // Stash the memory context on the base up-front so alloc_paired_buffer
     // sees consistent values during init. shm_host_ stays nullptr until the
@@ -99,9 +101,13 @@ int L2SwimlaneCollector::initialize(
     // Step 1: Calculate shared memory size (slot arrays only, no actual
     // buffers). Host over-allocates phase pool slots to the platform max for
     // both sched and orch — AICPU picks the actual counts at init_phase time
-    // and writes them into the header.
+    // and writes them into the header. Edge pools (same over-allocation)
+    // are only laid out when edge export was requested.
     int num_phase_threads = PLATFORM_MAX_AICPU_THREADS;
     size_t total_size = calc_perf_data_size_with_phases(num_aicore, num_phase_threads, num_phase_threads);
+    if (enable_edges_) {
+        total_size = calc_perf_data_size_with_edges(num_aicore, num_phase_threads);
+    }
 
     LOG_DEBUG("Shared memory allocation plan:");
     LOG_DEBUG("  Number of cores:      %d", num_aicore);
@@ -109,6 +115,7 @@ int L2SwimlaneCollector::initialize(
     LOG_DEBUG("  L2SwimlaneAicpuTaskPool size: %zu bytes each", sizeof(L2SwimlaneAicpuTaskPool));
     LOG_DEBUG("  L2SwimlaneAicpuSchedPhasePool size: %zu bytes each", sizeof(L2SwimlaneAicpuSchedPhasePool));
     LOG_DEBUG("  L2SwimlaneAicpuOrchPhasePool size:  %zu bytes each", sizeof(L2SwimlaneAicpuOrchPhasePool));
+    LOG_DEBUG("  Edge export:          %s", enable_edges_ ? "on" : "off");
     LOG_DEBUG("  Total shared memory:  %zu bytes (%zu KB)", total_size, total_size / 1024);
 
     // Step 2: Allocate the shared-memory region (header + SPSC slot arrays)
@@ -163,6 +170,10 @@ int L2SwimlaneCollector::initialize(
     header->num_orch_phase_threads = 0;
     header->num_phase_cores = 0;
     memset(header->core_to_thread, -1, sizeof(header->core_to_thread));
+    // Same zeroing rule for the edge pool count: AICPU only writes it when
+    // edges_enabled is set and init_edges runs.
+    header->edges_enabled = enable_edges_ ? 1 : 0;
+    header->num_edge_threads = 0;
 
     LOG_DEBUG("Initialized L2SwimlaneDataHeader:");
     LOG_DEBUG("  num_cores:              %d", header->num_cores);
@@ -308,6 +319,9 @@ int L2SwimlaneCollector::initialize(
     struct OrchTag {
         using type = L2SwimlaneAicpuOrchPhaseBuffer;
     };
+    struct EdgeTag {
+        using type = L2SwimlaneAicpuEdgeBuffer;
+    };
 
     // Sched: actual scheduler-thread count is unknown at host-alloc time, so
     // size buffers to the platform max. Orch: a single instance (pool 0), so
@@ -333,6 +347,23 @@ int L2SwimlaneCollector::initialize(
         PLATFORM_PROF_SCHED_BUFFERS_PER_THREAD, PLATFORM_PROF_ORCH_BUFFERS_PER_THREAD
     );
 
+    // Step 6b: Edge pools. Like sched, the wiring thread set is only known on
+    // the device, so every thread slot gets buffers.
+    if (enable_edges_) {
+        auto edge_get_state = [](void *base, int n_cores, int t) {
+            return get_edge_buffer_state(base, n_cores, t);
+        };
+        if (init_phase_pools(
+                EdgeTag{}, edge_get_state, /*state_count=*/num_phase_threads, /*buffer_count=*/num_phase_threads,
+                /*buffers_per_thread=*/PLATFORM_PROF_EDGE_BUFFERS_PER_THREAD, ProfBufferType::AICPU_EDGE, "edge"
+            ) != 0) {
+            return -1;
+        }
+        LOG_DEBUG(
+            "Initialized %d edge (%d buf/thread) BufferStates", num_phase_threads, PLATFORM_PROF_EDGE_BUFFERS_PER_THREAD
+        );
+    }
+
     wmb();
 
     // Push the host-initialized region (header + every pool's primed
@@ -359,6 +390,7 @@ int L2SwimlaneCollector::initialize(
     collected_aicore_records_.assign(num_aicore_, {});
     collected_sched_phase_records_.assign(PLATFORM_MAX_AICPU_THREADS, {});
     collected_orch_phase_records_.assign(PLATFORM_MAX_AICPU_THREADS, {});
+    collected_edge_records_.clear();
 
     LOG_INFO_V0("Performance profiling initialized (dynamic buffer mode)");
     guard.commit();
@@ -423,6 +455,19 @@ void L2SwimlaneCollector::copy_orch_phase_buffer(const ReadyBufferInfo &info) {
     }
 }
 
+void L2SwimlaneCollector::copy_edge_buffer(const ReadyBufferInfo &info) {
+    auto *buf = reinterpret_cast<L2SwimlaneAicpuEdgeBuffer *>(info.host_buffer_ptr);
+    rmb();
+    uint32_t count = buf->count;
+    if (count > static_cast<uint32_t>(PLATFORM_PHASE_RECORDS_PER_THREAD)) {
+        count = PLATFORM_PHASE_RECORDS_PER_THREAD;
+    }
+    if (info.index < static_cast<uint32_t>(PLATFORM_MAX_AICPU_THREADS)) {
+        collected_edge_records_.insert(collected_edge_records_.end(), buf->records, buf->records + count);
+        total_edge_collected_ += count;
+    }
+}
+
 // AICore record buffers arrive on the ready queue in per-core rotation order
 // (AICPU enqueues them at PLATFORM_AICORE_BUFFER_SIZE dispatch boundaries +
 // once at flush). Within a single buffer, AICore wrote records[0..buf->count)
@@ -487,6 +532,9 @@ void L2SwimlaneCollector::on_buffer_collected(const ReadyBufferInfo &info) {
     case ProfBufferType::AICORE_TASK:
         copy_aicore_buffer(info);
         break;
+    case ProfBufferType::AICPU_EDGE:
+        copy_edge_buffer(info);
+        break;
     }
 }
 
@@ -627,6 +675,19 @@ void L2SwimlaneCollector::reconcile_counters() {
         },
         sizeof(L2SwimlaneAicpuOrchPhaseBuffer), total_orch_phase_collected_, /*optional=*/true
     );
+
+    if (enable_edges_) {
+        reconcile_one(
+            "EDGE", "thread", PLATFORM_MAX_AICPU_THREADS,
+            [this](int thread_index) {
+                return get_edge_buffer_state(shm_host_, num_aicore_, thread_index);
+            },
+            [](void *host_ptr) {
+                return reinterpret_cast<L2SwimlaneAicpuEdgeBuffer *>(host_ptr)->count;
+            },
+            sizeof(L2SwimlaneAicpuEdgeBuffer), total_edge_collected_, /*optional=*/true
+        );
+    }
 }
 
 void L2SwimlaneCollector::read_phase_header_metadata() {
@@ -911,6 +972,22 @@ int L2SwimlaneCollector::export_swimlane_json() {
         }
     }
 
+    // Online dependency graph: one [pred, succ] pair per wired fanin, in the
+    // same PTO2 raw encoding as aicore_tasks' task_token_raw. May contain
+    // duplicates when a task lists the same producer twice.
+    if (enable_edges_) {
+        outfile << ",\n  \"task_edges\": [";
+        bool first = true;
+        for (const auto &e : collected_edge_records_) {
+            if (!first) outfile << ",";
+            outfile << "\n    [" << e.producer << ", " << e.consumer << "]";
+            first = false;
+        }
+        if (!first) outfile << "\n  ";
+        outfile << "]";
+        LOG_INFO_V0("  task_edges: %zu records", collected_edge_records_.size());
+    }
+
     outfile << "\n}\n";
     outfile.close();
 
@@ -1010,6 +1087,11 @@ int L2SwimlaneCollector::finalize(L2SwimlaneUnregisterCallback unregister_cb, co
     for (int t = 0; t < num_phase_threads; t++) {
         release_phase_pool(get_orch_phase_buffer_state(shm_host_, num_aicore_, t));
     }
+    if (enable_edges_) {
+        for (int t = 0; t < num_phase_threads; t++) {
+            release_phase_pool(get_edge_buffer_state(shm_host_, num_aicore_, t));
+        }
+    }
 
     // Main shm: unregister + free as a pair, same as every other buffer.
     // ProfilerBase's set_memory_context handed register_cb == nullptr iff the
@@ -1035,11 +1117,14 @@ int L2SwimlaneCollector::finalize(L2SwimlaneUnregisterCallback unregister_cb, co
     collected_perf_records_.clear();
     collected_sched_phase_records_.clear();
     collected_orch_phase_records_.clear();
+    collected_edge_records_.clear();
     core_to_thread_.clear();
     has_phase_data_ = false;
     total_perf_collected_ = 0;
     total_sched_phase_collected_ = 0;
     total_orch_phase_collected_ = 0;
+    total_edge_collected_ = 0;
+    enable_edges_ = false;
     clear_memory_context();
 
     LOG_DEBUG("Performance profiling cleanup complete");
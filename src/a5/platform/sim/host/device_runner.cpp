@@ -37,6 +37,7 @@
 #include "common/unified_log.h"
 #include "cpu_sim_context.h"
 #include "host/raii_scope_guard.h"
+#include "host_log.h"
 #include "runtime.h"
 
 // dep_gen_replay_emit_deps_json: strong symbol provided by
@@ -120,10 +121,21 @@ int DeviceRunner::ensure_binaries_loaded() {
         if (!load_sym("set_scope_stats_enabled", reinterpret_cast<void **>(&set_scope_stats_enabled_func_))) return -1;
         if (!load_sym("set_platform_scope_stats_base", reinterpret_cast<void **>(&set_platform_scope_stats_base_func_)))
             return -1;
+        load_optional_sym(
+            "set_platform_flight_recorder_base", reinterpret_cast<void **>(&set_platform_flight_recorder_base_func_)
+        );
 
         // Log config travels via the RTLD_GLOBAL HostLogger singleton in
         // libsimpler_log.so — already seeded by simpler_log_init() before the
         // AICPU sim SO was dlopen'd, so no per-SO setter forwarding is needed.
+        // The one exception is binary log mode: the AICPU SO owns its own
+        // record sink, so the output path is forwarded explicitly.
+        load_optional_sym("set_log_binary_path", reinterpret_cast<void **>(&set_log_binary_path_func_));
+        load_optional_sym("flush_log_binary", reinterpret_cast<void **>(&flush_log_binary_func_));
+        const std::string binlog_path = HostLogger::get_instance().binary_path();
+        if (!binlog_path.empty() && set_log_binary_path_func_ != nullptr) {
+            set_log_binary_path_func_(binlog_path.c_str());
+        }
 
         aicpu_so_loaded_ = true;
         LOG_INFO_V0("DeviceRunner(sim): Loaded aicpu_execute from %s", aicpu_so_path_.c_str());
@@ -187,7 +199,7 @@ int DeviceRunner::invoke_aicpu_prewarm(Runtime &runtime) {
 }
 
 int DeviceRunner::run(Runtime &runtime, int block_dim, int launch_aicpu_num) {
-    clear_cpu_sim_shared_storage();
+    clear_cpu_sim_shared_storage(sim_context_key_);
     if (launch_aicpu_num < 1 || launch_aicpu_num > PLATFORM_MAX_AICPU_THREADS) {
         LOG_ERROR("launch_aicpu_num (%d) must be in range [1, %d]", launch_aicpu_num, PLATFORM_MAX_AICPU_THREADS);
         return -1;
@@ -208,6 +220,19 @@ int DeviceRunner::run(Runtime &runtime, int block_dim, int launch_aicpu_num) {
         return rc;
     }
 
+    // Drain both binary-log sinks after every run, AICPU first so the host
+    // chunk follows it. A thread ring holds kRingRecords records, which one
+    // verbose run can fill; the AICPU / AICore threads of this run have been
+    // joined by the time the guard fires.
+    auto binlog_flush = RAIIScopeGuard([this]() {
+        if (flush_log_binary_func_ != nullptr && flush_log_binary_func_() != 0) {
+            LOG_WARN("DeviceRunner(sim): failed to flush AICPU binary log");
+        }
+        if (HostLogger::get_instance().flush_binary() != 0) {
+            LOG_WARN("DeviceRunner(sim): failed to flush host binary log");
+        }
+    });
+
     if (device_wall_dev_ptr_ == nullptr) {
         device_wall_dev_ptr_ = allocate_tensor(sizeof(uint64_t));
         if (device_wall_dev_ptr_ != nullptr) {
@@ -215,6 +240,9 @@ int DeviceRunner::run(Runtime &runtime, int block_dim, int launch_aicpu_num) {
             *static_cast<uint64_t *>(device_wall_dev_ptr_) = 0;
         }
     }
+    // Flight-recorder rings: allocated once, never reset, so they keep the
+    // tail of earlier runs.
+    ensure_flight_recorder_buffer();
 
     block_dim_ = block_dim;
     int num_aicore = block_dim * cores_per_blockdim_;
@@ -390,6 +418,9 @@ int DeviceRunner::run(Runtime &runtime, int block_dim, int launch_aicpu_num) {
     set_dep_gen_enabled_func_(enable_dep_gen_);
     set_scope_stats_enabled_func_(enable_scope_stats_);
     set_platform_scope_stats_base_func_(kernel_args_.scope_stats_data_base);
+    if (set_platform_flight_recorder_base_func_ != nullptr) {
+        set_platform_flight_recorder_base_func_(kernel_args_.flight_recorder_data_base);
+    }
 
     // Start collector mgmt + poll threads now, just before kernels launch.
     auto thread_factory = [this](std::function<void()> fn) {
@@ -529,6 +560,9 @@ int DeviceRunner::run(Runtime &runtime, int block_dim, int launch_aicpu_num) {
 
 void DeviceRunner::unload_executor_binaries() {
     if (aicpu_so_handle_ != nullptr) {
+        if (flush_log_binary_func_ != nullptr && flush_log_binary_func_() != 0) {
+            LOG_WARN("DeviceRunner(sim): failed to flush AICPU binary log");
+        }
         dlclose(aicpu_so_handle_);
         aicpu_so_handle_ = nullptr;
         aicpu_execute_func_ = nullptr;
@@ -545,6 +579,9 @@ void DeviceRunner::unload_executor_binaries() {
         set_dep_gen_enabled_func_ = nullptr;
         set_scope_stats_enabled_func_ = nullptr;
         set_platform_scope_stats_base_func_ = nullptr;
+        set_platform_flight_recorder_base_func_ = nullptr;
+        set_log_binary_path_func_ = nullptr;
+        flush_log_binary_func_ = nullptr;
         aicpu_so_loaded_ = false;
     }
     if (!aicpu_so_path_.empty()) {
@@ -586,6 +623,9 @@ int DeviceRunner::finalize() {
         kernel_args_.scope_stats_data_base = 0;
     }
 
+    // Queued async copies may still target pooled device memory.
+    stop_async_copy();
+
     release_callable_state();
 
     unload_executor_binaries();
@@ -598,12 +638,13 @@ int DeviceRunner::finalize() {
     cached_runtime_arena_size_ = 0;
 
     mem_alloc_.finalize();
-    clear_cpu_sim_shared_storage();
+    clear_cpu_sim_shared_storage(sim_context_key_);
 
     if (device_wall_dev_ptr_ != nullptr) {
         free_tensor(device_wall_dev_ptr_);
         device_wall_dev_ptr_ = nullptr;
     }
+    release_flight_recorder_buffer();
     device_id_ = -1;
     worker_count_ = 0;
     last_runtime_ = nullptr;
@@ -633,8 +674,8 @@ void DeviceRunner::stop_collectors() {
 
 int DeviceRunner::init_l2_swimlane(int num_aicore, int aicpu_thread_num, int device_id) {
     int rc = l2_swimlane_collector_.initialize(
-        num_aicore, aicpu_thread_num, device_id, l2_swimlane_level_, prof_alloc_cb, /*register_cb=*/nullptr,
-        prof_free_cb, output_prefix_
+        num_aicore, aicpu_thread_num, device_id, l2_swimlane_level_, enable_l2_edges_, prof_alloc_cb,
+        /*register_cb=*/nullptr, prof_free_cb, output_prefix_
     );
     if (rc == 0) {
         kernel_args_.l2_swimlane_data_base =
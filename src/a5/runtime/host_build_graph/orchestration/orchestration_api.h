@@ -46,6 +46,10 @@ typedef struct OrchestrationRuntimeOps {
     void *(*device_malloc)(OrchestrationRuntime *runtime, size_t size);
     void (*device_free)(OrchestrationRuntime *runtime, void *ptr);
     int (*copy_to_device)(OrchestrationRuntime *runtime, void *dev_ptr, const void *host_ptr, size_t size);
+    // Opt this run into the static wave schedule (runtime/wave_plan.h). Only
+    // meaningful for graphs whose shape does not depend on device results;
+    // the runtime falls back to dynamic dispatch when no plan can be built.
+    void (*enable_wave_schedule)(OrchestrationRuntime *runtime);
 } OrchestrationRuntimeOps;
 
 struct OrchestrationRuntime {
@@ -98,6 +102,8 @@ static inline int copy_to_device(OrchestrationRuntime *runtime, void *dev_ptr, c
     return runtime->ops->copy_to_device(runtime, dev_ptr, host_ptr, size);
 }
 
+static inline void enable_wave_schedule(OrchestrationRuntime *runtime) { runtime->ops->enable_wave_schedule(runtime); }
+
 typedef int (*OrchestrationFunc)(OrchestrationRuntime *runtime, const ChipStorageTaskArgs &orch_args);
 
 #endif  // SRC_A5_RUNTIME_HOST_BUILD_GRAPH_ORCHESTRATION_ORCHESTRATION_API_H_
@@ -53,6 +53,8 @@ Runtime::Runtime() {
     tensor_allocation_storage_ = nullptr;
     tensor_allocation_storage_bytes_ = 0;
     tensor_allocation_count_ = 0;
+    wave_plan_storage_ = nullptr;
+    wave_plan_storage_bytes_ = 0;
 
     // Initialize kernel binary tracking
     registered_kernel_count_ = 0;
@@ -91,6 +91,12 @@ typedef struct PTO2RuntimeOps {
     // collector can log it. Always present to keep ops-table layout stable
     // across PTO2_PROFILING settings; set to nullptr at PTO2_PROFILING=0.
     void (*scope_set_site)(const char *file, int line);
+
+    // Cores available to this run; nullptr when a runtime leaves it unset.
+    // The table has no size or version field, so an older runtime's table
+    // simply ends before this slot: build the orchestration SO against the
+    // runtime it is loaded into.
+    void (*get_core_counts)(PTO2Runtime *rt, int32_t *aic_count, int32_t *aiv_count);
 } PTO2RuntimeOps;
 
 /**
@@ -230,6 +236,17 @@ static inline bool rt_is_fatal() {
     return rt->ops->is_fatal(rt);
 }
 
+/**
+ * Query the AIC (= MIX cluster) and AIV core counts of the running device.
+ * Both report 0 when the runtime does not provide the op.
+ */
+static inline void rt_get_core_counts(int32_t *aic_count, int32_t *aiv_count) {
+    PTO2Runtime *rt = current_runtime();
+    *aic_count = 0;
+    *aiv_count = 0;
+    if (rt->ops->get_core_counts) rt->ops->get_core_counts(rt, aic_count, aiv_count);
+}
+
 #define rt_report_fatal(code, fmt, ...)                                          \
     do {                                                                         \
         PTO2Runtime *_rt = current_runtime();                                    \
@@ -384,3 +401,5 @@ struct PTO2OrchestrationConfig {
 // rt_submit_*_task primitives defined above. Orchestration sources include
 // only this single header to access both the primitive and convenience APIs.
 #include "pto_arg_with_deps.h"  // NOLINT(build/include_subdir)
+#include "pto_split_kv.h"       // NOLINT(build/include_subdir)
+#include "pto_view_cache.h"     // NOLINT(build/include_subdir)
@@ -50,6 +50,9 @@
 // pays nothing (no include, no call) when profiling is compiled out.
 #include "aicpu/scope_stats_collector_aicpu.h"
 #endif
+#if PTO2_FLIGHT_RECORDER
+#include "aicpu/flight_recorder_aicpu.h"
+#endif
 
 // Block notification interval (in spin counts)
 #define PTO2_BLOCK_NOTIFY_INTERVAL 10000
@@ -138,6 +141,9 @@ public:
         uint64_t wait_start = 0;
         bool waiting = false;
 #endif
+#if PTO2_FLIGHT_RECORDER
+        bool fr_blocked = false;  // ALLOC_BLOCK recorded; pair it with ALLOC_RESUME
+#endif
 
         while (true) {
             // Check both resources; commit only if both available
@@ -147,6 +153,14 @@ public:
                     int32_t task_id = commit_task();
 #if PTO2_ORCH_PROFILING
                     record_wait(spin_count, wait_start, waiting);
+#endif
+#if PTO2_FLIGHT_RECORDER
+                    if (fr_blocked) {
+                        flight_recorder_orch_record(
+                            FLIGHT_RECORDER_EVENT_ALLOC_RESUME, static_cast<uint32_t>(task_id),
+                            blocked_on_heap ? FLIGHT_RECORDER_ALLOC_HEAP : FLIGHT_RECORDER_ALLOC_TASK_WINDOW
+                        );
+                    }
 #endif
                     return {task_id, task_id & window_mask_, heap_ptr, static_cast<char *>(heap_ptr) + aligned_size};
                 }
@@ -157,6 +171,15 @@ public:
 
             // Spin: wait for scheduler to advance last_task_alive
             spin_count++;
+#if PTO2_FLIGHT_RECORDER
+            if (!fr_blocked) {
+                fr_blocked = true;
+                flight_recorder_orch_record(
+                    FLIGHT_RECORDER_EVENT_ALLOC_BLOCK, static_cast<uint32_t>(local_task_id_),
+                    blocked_on_heap ? FLIGHT_RECORDER_ALLOC_HEAP : FLIGHT_RECORDER_ALLOC_TASK_WINDOW
+                );
+            }
+#endif
 #if PTO2_ORCH_PROFILING
             if (!waiting) {
                 wait_start = get_sys_cnt_aicpu();
@@ -94,6 +94,9 @@ struct PTO2RuntimeOps {
     // collector. Always present to keep ops-table layout stable across
     // PTO2_PROFILING settings; set to nullptr at PTO2_PROFILING=0.
     void (*scope_set_site)(const char *file, int line);
+    // Cores available to this run (AIC = MIX clusters, AIV). Lets orchestration
+    // size its work decomposition to the machine instead of a compile-time guess.
+    void (*get_core_counts)(PTO2Runtime *rt, int32_t *aic_count, int32_t *aiv_count);
 };
 
 /**
@@ -206,7 +209,7 @@ PTO2Runtime *runtime_init_data_from_layout(
  * Phase 3 — wire every arena-internal pointer field (rt->sm_handle,
  * rt->aicore_mailbox, orchestrator.{scope_tasks, scope_begins, scheduler,
  * tensor_map.*, rings[].fanin_pool.base}, scheduler.{ready_queues, dep_pool,
- * wiring.queue}) so each holds arena.base() + offset. Idempotent — runs on
+ * wiring.shards[].queue}) so each holds arena.base() + offset. Idempotent — runs on
  * both host (writing host-mirror addresses) and AICPU (writing device
  * addresses) sides.
  */
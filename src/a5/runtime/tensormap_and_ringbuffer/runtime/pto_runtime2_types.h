@@ -336,7 +336,7 @@ struct alignas(64) PTO2TaskSlotState {
     // and dep_pool_mark to keep PTO2TaskSlotState at 64 bytes.
     std::atomic<bool> any_subtask_deferred{false};
     uint8_t _async_pad{0};
-    int32_t dep_pool_mark{0};  // Dep pool top after wiring (thread-0-only)
+    int32_t dep_pool_mark{0};  // Dep pool top after wiring (wiring-shard owner only)
 
     std::atomic<int16_t> completed_subtasks{0};  // Each core completion increments by 1
     int16_t total_required_subtasks{0};          // = logical_block_num * popcount(active_mask)
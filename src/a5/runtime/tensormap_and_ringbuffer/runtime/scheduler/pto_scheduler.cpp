@@ -25,6 +25,15 @@
 // Weak fallbacks for host/UT builds that don't link the scope_stats collector.
 extern "C" __attribute__((weak, visibility("hidden"))) bool is_scope_stats_enabled() { return false; }
 extern "C" __attribute__((weak, visibility("hidden"))) void scope_stats_note_heap_wrap(int) {}
+// Same for the L2 swimlane edge export called from wire_task.
+extern "C" __attribute__((weak, visibility("hidden"))) void l2_swimlane_aicpu_record_edge(int, uint64_t, uint64_t) {}
+#endif
+
+#if PTO2_FLIGHT_RECORDER
+// Flight-recorder probes (dispatch / FIN here, allocator block from
+// pto_ring_buffer.h). The platform recorder is only linked into AICPU builds.
+extern "C" __attribute__((weak, visibility("hidden"))) void flight_recorder_record(int, uint32_t, uint64_t, uint32_t) {}
+extern "C" __attribute__((weak, visibility("hidden"))) void flight_recorder_orch_record(uint32_t, uint64_t, uint32_t) {}
 #endif
 
 // =============================================================================
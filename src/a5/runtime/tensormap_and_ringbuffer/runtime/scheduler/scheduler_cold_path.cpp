@@ -899,6 +899,12 @@ int32_t SchedulerContext::init(
             const int orch_phase_threads = 1;
             l2_swimlane_aicpu_init_phase(runtime->worker_count, sched_phase_threads, orch_phase_threads);
         }
+        // Edge export is independent of the level and a no-op unless the host
+        // set header->edges_enabled. Wiring runs on a scheduler thread, so the
+        // pool count follows the same normalization as the sched-phase pools.
+        const int edge_threads =
+            orch_to_sched_ ? aicpu_thread_num_ : ((sched_thread_num_ > 0) ? sched_thread_num_ : aicpu_thread_num_);
+        l2_swimlane_aicpu_init_edges(runtime->worker_count, edge_threads);
     } else {
         l2_swimlane_level_ = L2SwimlaneLevel::DISABLED;
     }
@@ -21,6 +21,7 @@
 #include "spin_hint.h"
 
 // Performance profiling headers
+#include "aicpu/flight_recorder_aicpu.h"
 #include "aicpu/l2_swimlane_collector_aicpu.h"
 #include "aicpu/pmu_collector_aicpu.h"
 #include "aicpu/tensor_dump_aicpu.h"
@@ -80,6 +81,11 @@ void SchedulerContext::complete_slot_task(
     auto &l2_swimlane = sched_l2_swimlane_[thread_idx];
 #else
     (void)hank;
+#endif
+#if PTO2_FLIGHT_RECORDER
+    flight_recorder_record(
+        thread_idx, FLIGHT_RECORDER_EVENT_FIN, slot_state.task->task_id.raw, static_cast<uint32_t>(core_id)
+    );
 #endif
     // MPSC fast-path: see a2a3 mirror for the full design narrative. The
     // any_subtask_deferred flag on slot_state discriminates non-deferred
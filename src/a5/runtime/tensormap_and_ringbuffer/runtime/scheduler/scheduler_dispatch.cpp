@@ -27,6 +27,7 @@
 #include "spin_hint.h"
 
 // Performance profiling headers
+#include "aicpu/flight_recorder_aicpu.h"
 #include "aicpu/l2_swimlane_collector_aicpu.h"
 #include "aicpu/pmu_collector_aicpu.h"
 #include "aicpu/tensor_dump_aicpu.h"
@@ -168,6 +169,11 @@ void SchedulerContext::dispatch_subtask_to_core(
         slot_state.task->kernel_id[1], slot_state.task->kernel_id[2], block_idx, slot_state.logical_block_num,
         core_offset, core_id, reg_task_id
     );
+#if PTO2_FLIGHT_RECORDER
+    flight_recorder_record(
+        thread_idx, FLIGHT_RECORDER_EVENT_DISPATCH, slot_state.task->task_id.raw, static_cast<uint32_t>(core_id)
+    );
+#endif
 
     // AICore buffer rotation lives on the dispatch path: count this dispatch
     // and rotate before write_reg when we're about to cross a BUFFER_SIZE
@@ -715,10 +721,11 @@ int32_t SchedulerContext::resolve_and_dispatch(Runtime *runtime, int32_t thread_
             continue;
         }
 
-        // Phase 3: Drain wiring queue (thread 0 only)
+        // Phase 3: Drain the wiring shards this thread owns (threads past
+        // wiring.thread_count, e.g. a joined orchestrator, own none)
         int wired = 0;
-        if (thread_idx == 0) {
-            wired = sched_->drain_wiring_queue(orchestrator_done_);
+        if (thread_idx < sched_->wiring.thread_count) {
+            wired = sched_->drain_wiring_queue(orchestrator_done_, thread_idx);
             if (wired > 0) {
                 made_progress = true;
 #if PTO2_SCHED_PROFILING
@@ -750,7 +757,7 @@ int32_t SchedulerContext::resolve_and_dispatch(Runtime *runtime, int32_t thread_
         // Dependency-only tasks bypass AICore dispatch: they go through the
         // scheduler so fanin/fanout edges stay consistent, but completion is
         // signalled inline here. Pinned to thread 0 to avoid cross-thread
-        // races and to keep cache hot near the wiring drain above.
+        // races and to keep cache hot near the ring-0 wiring drain above.
         if (thread_idx == 0) {
             constexpr int DUMMY_DRAIN_BATCH = 16;
             PTO2TaskSlotState *dummy_batch[DUMMY_DRAIN_BATCH];
@@ -974,6 +981,7 @@ int32_t SchedulerContext::resolve_and_dispatch(Runtime *runtime, int32_t thread_
         if (l2_swimlane_level_ >= L2SwimlaneLevel::SCHED_PHASES) {
             l2_swimlane_aicpu_flush_sched_phase_buffer(thread_idx);
         }
+        l2_swimlane_aicpu_flush_edge_buffer(thread_idx);
     }
 #endif
 #if PTO2_PROFILING
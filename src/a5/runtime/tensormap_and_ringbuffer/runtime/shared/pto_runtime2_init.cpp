@@ -128,13 +128,15 @@ PTO2SchedulerState::reserve_layout(DeviceArena &arena, const int32_t dep_pool_ca
     }
     layout.off_dummy_ready_queue_slots = ready_queue_reserve_layout(arena, PTO2_READY_QUEUE_SIZE);
     for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
-        // Force a cache-line base so writes from scheduler thread 0 (sole
+        // Force a cache-line base so writes from the wiring-shard owner (sole
         // writer of this ring's dep_pool) do not invalidate adjacent
         // multi-threaded regions like ready_queue.slots.
         layout.off_dep_pool_entries[r] =
             arena.reserve(static_cast<size_t>(dep_pool_capacities[r]) * sizeof(PTO2DepListEntry), PTO2_ALIGN_SIZE);
     }
-    layout.off_wiring_spsc_buffer = PTO2SpscQueue::reserve_layout(arena, PTO2_WRIRING_QUEUE_SIZE);
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        layout.off_wiring_spsc_buffers[r] = PTO2SpscQueue::reserve_layout(arena, PTO2_WRIRING_QUEUE_SIZE);
+    }
     return layout;
 }
 
@@ -174,12 +176,16 @@ bool PTO2SchedulerState::init_data_from_layout(
         sched->ring_sched_states[r].dep_pool.init(dep_entries, layout.dep_pool_capacities[r], orch_err);
     }
 
-    if (!sched->wiring.queue.init_data_from_layout(arena, layout.off_wiring_spsc_buffer, layout.spsc_capacity)) {
-        return false;
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        auto &shard = sched->wiring.shards[r];
+        if (!shard.queue.init_data_from_layout(arena, layout.off_wiring_spsc_buffers[r], layout.spsc_capacity)) {
+            return false;
+        }
+        shard.batch_count = 0;
+        shard.batch_index = 0;
+        shard.backoff_counter = 0;
     }
-    sched->wiring.batch_count = 0;
-    sched->wiring.batch_index = 0;
-    sched->wiring.backoff_counter = 0;
+    sched->wiring.thread_count = 1;
 
     return true;
 }
@@ -194,7 +200,9 @@ void PTO2SchedulerState::wire_arena_pointers(const PTO2SchedulerLayout &layout,
         sched->ring_sched_states[r].dep_pool.base =
             static_cast<PTO2DepListEntry *>(arena.region_ptr(layout.off_dep_pool_entries[r]));
     }
-    sched->wiring.queue.wire_arena_pointers(arena, layout.off_wiring_spsc_buffer);
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        sched->wiring.shards[r].queue.wire_arena_pointers(arena, layout.off_wiring_spsc_buffers[r]);
+    }
 }
 
 void PTO2SchedulerState::destroy() {
@@ -203,7 +211,9 @@ void PTO2SchedulerState::destroy() {
         sched->ring_sched_states[r].destroy();
         sched->ring_sched_states[r].dep_pool.base = nullptr;
     }
-    sched->wiring.queue.destroy();
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        sched->wiring.shards[r].queue.destroy();
+    }
     for (int i = 0; i < PTO2_NUM_RESOURCE_SHAPES; i++) {
         ready_queue_destroy(&sched->ready_queues[i]);
     }
@@ -82,8 +82,9 @@ static_assert(offsetof(DeviceArgs, inner_so_len) == 128, "DeviceArgs::inner_so_l
 namespace simpler_dispatcher {
 
 // ELF Build-ID-derived 64-bit fingerprint (linker SHA-1 truncated to 8
-// bytes by `-Wl,--build-id`). Falls back to full-buffer FNV-1a if the SO
-// was somehow linked without a build-id note. Host's
+// bytes by `-Wl,--build-id`). Falls back to full-buffer FNV-1a (never the
+// release-unstable content_hash_64: the value names the installed inner SO)
+// if the SO was somehow linked without a build-id note. Host's
 // load_aicpu_op.cpp::FingerprintBytes calls the same helper, so both sides
 // produce identical fingerprints with no other channel of communication.
 //
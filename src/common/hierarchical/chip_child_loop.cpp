@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "chip_child_loop.h"
+
+#include <sched.h>
+#include <time.h>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+#include "chip_worker.h"
+#include "worker_manager.h"
+
+namespace {
+
+inline void cpu_relax() {
+#if defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ volatile("yield" ::: "memory");
+#endif
+}
+
+std::string format_digest(const uint8_t *digest) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    std::string out = "sha256:";
+    out.reserve(7 + 2 * CALLABLE_HASH_DIGEST_SIZE);
+    for (size_t i = 0; i < CALLABLE_HASH_DIGEST_SIZE; ++i) {
+        out.push_back(kHex[digest[i] >> 4]);
+        out.push_back(kHex[digest[i] & 0x0F]);
+    }
+    return out;
+}
+
+uint64_t read_u64(const char *p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+}  // namespace
+
+size_t ChipChildLoop::DigestHash::operator()(const Digest &d) const noexcept {
+    // The digest is already a SHA-256: any 8 bytes of it are a good hash.
+    uint64_t v;
+    std::memcpy(&v, d.data(), sizeof(v));
+    return static_cast<size_t>(v);
+}
+
+ChipChildLoop::ChipChildLoop(ChipWorker &worker, void *mailbox, int32_t device_id, ChipChildLoopOptions options) :
+    worker_(worker),
+    mailbox_(mailbox),
+    device_id_(device_id),
+    options_(options),
+    error_prefix_("chip_process dev=" + std::to_string(device_id) + ": ") {
+    if (mailbox == nullptr) throw std::invalid_argument("ChipChildLoop: null mailbox");
+}
+
+void ChipChildLoop::bind(const Digest &digest, int32_t cid, bool prepared) {
+    table_[digest] = cid;
+    set_prepared(cid, prepared);
+}
+
+void ChipChildLoop::unbind(const Digest &digest) {
+    auto it = table_.find(digest);
+    if (it == table_.end()) return;
+    prepared_.erase(it->second);
+    table_.erase(it);
+}
+
+void ChipChildLoop::set_prepared(int32_t cid, bool prepared) {
+    if (prepared) {
+        prepared_.insert(cid);
+    } else {
+        prepared_.erase(cid);
+    }
+}
+
+void ChipChildLoop::clear() {
+    table_.clear();
+    prepared_.clear();
+}
+
+// Same acquire/release pairing as LocalMailboxEndpoint::read_mailbox_state /
+// write_mailbox_state on the parent side.
+int32_t ChipChildLoop::load_state() const {
+    volatile int32_t *ptr = reinterpret_cast<volatile int32_t *>(mbox() + MAILBOX_OFF_STATE);
+    int32_t v;
+#if defined(__aarch64__)
+    __asm__ volatile("ldar %w0, [%1]" : "=r"(v) : "r"(ptr) : "memory");
+#elif defined(__x86_64__)
+    v = *ptr;
+    __asm__ volatile("" ::: "memory");
+#else
+    __atomic_load(ptr, &v, __ATOMIC_ACQUIRE);
+#endif
+    return v;
+}
+
+void ChipChildLoop::store_state(int32_t v) {
+    volatile int32_t *ptr = reinterpret_cast<volatile int32_t *>(mbox() + MAILBOX_OFF_STATE);
+#if defined(__aarch64__)
+    __asm__ volatile("stlr %w0, [%1]" : : "r"(v), "r"(ptr) : "memory");
+#elif defined(__x86_64__)
+    __asm__ volatile("" ::: "memory");
+    *ptr = v;
+#else
+    __atomic_store(ptr, &v, __ATOMIC_RELEASE);
+#endif
+}
+
+// Mirrors worker.py::_write_error: truncate to leave room for the NUL the
+// parent's read_error_msg relies on, zero-pad so no stale bytes survive.
+void ChipChildLoop::write_error(int32_t code, const std::string &msg) {
+    std::memcpy(mbox() + MAILBOX_OFF_ERROR, &code, sizeof(code));
+    const size_t n = std::min(msg.size(), MAILBOX_ERROR_MSG_SIZE - 1);
+    char *dst = mbox() + MAILBOX_OFF_ERROR_MSG;
+    std::memcpy(dst, msg.data(), n);
+    std::memset(dst + n, 0, MAILBOX_ERROR_MSG_SIZE - n);
+}
+
+void ChipChildLoop::run() {
+    uint32_t idle_polls = 0;
+    uint32_t park_us = 1;
+    for (;;) {
+        const int32_t state = load_state();
+        if (state == static_cast<int32_t>(MailboxState::TASK_READY)) {
+            serve_task();
+        } else if (state == static_cast<int32_t>(MailboxState::CONTROL_REQUEST)) {
+            serve_control();
+        } else if (state == static_cast<int32_t>(MailboxState::SHUTDOWN)) {
+            return;
+        } else {
+            // IDLE, or our own TASK_DONE / CONTROL_DONE not yet reset by the
+            // parent: back off.
+            if (idle_polls < options_.spin_iters) {
+                cpu_relax();
+            } else if (idle_polls < options_.spin_iters + options_.yield_iters) {
+                sched_yield();
+            } else {
+                struct timespec ts{0, static_cast<long>(park_us) * 1000L};
+                nanosleep(&ts, nullptr);
+                ++stats_.parks;
+                park_us = std::min(park_us * 2, std::max<uint32_t>(options_.max_park_us, 1));
+            }
+            if (idle_polls != UINT32_MAX) ++idle_polls;
+            continue;
+        }
+        idle_polls = 0;
+        park_us = 1;
+    }
+}
+
+void ChipChildLoop::serve_task() {
+    ++stats_.tasks;
+    Digest digest;
+    std::memcpy(digest.data(), mbox() + MAILBOX_OFF_TASK_CALLABLE_HASH, digest.size());
+
+    Outcome outcome{0, std::string()};
+    try {
+        auto it = table_.find(digest);
+        if (it == table_.end()) {
+            throw std::runtime_error("callable hash " + format_digest(digest.data()) + " not registered");
+        }
+        const int32_t cid = it->second;
+        if (prepared_.count(cid) == 0) {
+            if (!on_prepare_) throw std::runtime_error("cid " + std::to_string(cid) + " is not prepared");
+            on_prepare_(cid);
+            prepared_.insert(cid);
+        }
+        // The parent memcpy'd a CallConfig at MAILBOX_OFF_CONFIG; copy it out
+        // so the run never aliases shared memory the parent may reuse.
+        CallConfig config;
+        std::memcpy(static_cast<void *>(&config), mbox() + MAILBOX_OFF_CONFIG, sizeof(CallConfig));
+        config.output_prefix[sizeof(config.output_prefix) - 1] = '\0';
+        TaskArgsView view =
+            read_blob(reinterpret_cast<const uint8_t *>(mbox() + MAILBOX_OFF_TASK_ARGS_BLOB), MAILBOX_ARGS_CAPACITY);
+        worker_.run(cid, view, config);
+    } catch (const std::exception &e) {
+        outcome = {1, error_prefix_ + e.what()};
+    }
+
+    // Failed kernels skip the hook: staging an undefined output region would
+    // only mask the real error.
+    if (outcome.first == 0 && on_task_done_) {
+        try {
+            outcome = on_task_done_();
+        } catch (const std::exception &e) {
+            outcome = {1, error_prefix_ + "task-done hook: " + e.what()};
+        }
+    }
+    write_error(outcome.first, outcome.second);
+    store_state(static_cast<int32_t>(MailboxState::TASK_DONE));
+}
+
+ChipChildLoop::Outcome ChipChildLoop::native_control(uint64_t sub_cmd, bool &handled) {
+    handled = true;
+    const char *m = mbox();
+    switch (sub_cmd) {
+    case CTRL_MALLOC: {
+        const uint64_t ptr = worker_.malloc(static_cast<size_t>(read_u64(m + CTRL_OFF_ARG0)));
+        std::memcpy(mbox() + CTRL_OFF_RESULT, &ptr, sizeof(ptr));
+        break;
+    }
+    case CTRL_FREE:
+        worker_.free(read_u64(m + CTRL_OFF_ARG0));
+        break;
+    case CTRL_COPY_TO:
+        worker_.copy_to(read_u64(m + CTRL_OFF_ARG0), read_u64(m + CTRL_OFF_ARG1), read_u64(m + CTRL_OFF_ARG2));
+        break;
+    case CTRL_COPY_FROM:
+        worker_.copy_from(read_u64(m + CTRL_OFF_ARG0), read_u64(m + CTRL_OFF_ARG1), read_u64(m + CTRL_OFF_ARG2));
+        break;
+    case CTRL_COPY_TO_ASYNC:
+    case CTRL_COPY_FROM_ASYNC: {
+        const uint64_t dst = read_u64(m + CTRL_OFF_ARG0);
+        const uint64_t src = read_u64(m + CTRL_OFF_ARG1);
+        const size_t size = static_cast<size_t>(read_u64(m + CTRL_OFF_ARG2));
+        const uint64_t token = sub_cmd == CTRL_COPY_TO_ASYNC ? worker_.copy_to_async(dst, src, size) :
+                                                               worker_.copy_from_async(dst, src, size);
+        std::memcpy(mbox() + CTRL_OFF_RESULT, &token, sizeof(token));
+        break;
+    }
+    case CTRL_COPY_QUERY: {
+        const uint64_t done = worker_.copy_done(read_u64(m + CTRL_OFF_ARG0)) ? 1 : 0;
+        std::memcpy(mbox() + CTRL_OFF_RESULT, &done, sizeof(done));
+        break;
+    }
+    default:
+        handled = false;
+        break;
+    }
+    return {0, std::string()};
+}
+
+void ChipChildLoop::serve_control() {
+    ++stats_.controls;
+    const uint64_t sub_cmd = read_u64(mbox() + MAILBOX_OFF_CALLABLE);
+    Outcome outcome{0, std::string()};
+    try {
+        bool handled = false;
+        outcome = native_control(sub_cmd, handled);
+        if (!handled) {
+            if (!on_control_) throw std::runtime_error("unknown control sub-command " + std::to_string(sub_cmd));
+            ++stats_.python_controls;
+            outcome = on_control_(sub_cmd);
+        }
+    } catch (const std::exception &e) {
+        outcome = {
+            1, "chip_process dev=" + std::to_string(device_id_) + " ctrl=" + std::to_string(sub_cmd) + ": " + e.what()
+        };
+    }
+    write_error(outcome.first, outcome.second);
+    store_state(static_cast<int32_t>(MailboxState::CONTROL_DONE));
+}
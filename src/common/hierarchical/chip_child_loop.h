@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * ChipChildLoop — native child side of the chip mailbox protocol.
+ *
+ * A forked chip child used to run the TASK_READY / CONTROL_REQUEST /
+ * SHUTDOWN state machine in Python (`_run_chip_main_loop`), busy-polling the
+ * state word with no backoff and paying dict lookups + struct decode on every
+ * task. This class is the same state machine in C++, sitting directly on the
+ * child's `ChipWorker`:
+ *
+ *   - TASK_READY: digest → cid through a C++ table, CallConfig read straight
+ *     out of the mailbox (the parent memcpy'd it there), args handed to
+ *     `read_blob`, then `ChipWorker::run`.
+ *   - CTRL_MALLOC / FREE / COPY_TO / COPY_FROM: served natively.
+ *   - Everything else (register / unregister / prepare / comm bootstrap)
+ *     goes to `on_control`, which the Python binding routes to the existing
+ *     handlers — they are rare and own Python-side state (registry, shm).
+ *
+ * Idle polling is adaptive: a short pause-spin, then sched_yield, then
+ * nanosleep with exponential backoff up to `max_park_us`. Any observed
+ * request resets the ladder, so back-to-back tasks stay on the spin path.
+ *
+ * The loop never touches Python; the binding releases the GIL for run() and
+ * re-acquires it only inside the hooks.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "types.h"
+
+class ChipWorker;
+
+struct ChipChildLoopOptions {
+    uint32_t spin_iters{4096};  // pause-spin polls before yielding
+    uint32_t yield_iters{64};   // sched_yield polls before parking
+    uint32_t max_park_us{100};  // nanosleep backoff cap
+};
+
+struct ChipChildLoopStats {
+    uint64_t tasks{0};
+    uint64_t controls{0};
+    uint64_t python_controls{0};  // controls routed to on_control
+    uint64_t parks{0};            // nanosleep calls while idle
+};
+
+class ChipChildLoop {
+public:
+    using Digest = std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE>;
+    // (error code, message) — written to the mailbox error region as-is.
+    using Outcome = std::pair<int32_t, std::string>;
+    // Non-native control sub-command. The mailbox is readable in place.
+    using ControlHook = std::function<Outcome(uint64_t sub_cmd)>;
+    // Prepare `cid` for a TASK_READY whose digest is bound but not yet
+    // prepared (prewarm missed). Throw to fail the task.
+    using PrepareHook = std::function<void(int32_t cid)>;
+    // Runs after a successful ChipWorker::run, before TASK_DONE is published.
+    using TaskDoneHook = std::function<Outcome()>;
+
+    ChipChildLoop(ChipWorker &worker, void *mailbox, int32_t device_id, ChipChildLoopOptions options = {});
+
+    // Digest table. The owner keeps it in sync with its own identity state;
+    // `on_control` runs with the loop paused, so updating from inside a hook
+    // is safe.
+    void bind(const Digest &digest, int32_t cid, bool prepared);
+    void unbind(const Digest &digest);
+    void set_prepared(int32_t cid, bool prepared);
+    void clear();
+    size_t size() const { return table_.size(); }
+
+    void set_control_hook(ControlHook hook) { on_control_ = std::move(hook); }
+    void set_prepare_hook(PrepareHook hook) { on_prepare_ = std::move(hook); }
+    void set_task_done_hook(TaskDoneHook hook) { on_task_done_ = std::move(hook); }
+
+    // Serve the mailbox until SHUTDOWN.
+    void run();
+
+    const ChipChildLoopStats &stats() const { return stats_; }
+
+private:
+    struct DigestHash {
+        size_t operator()(const Digest &d) const noexcept;
+    };
+
+    char *mbox() const { return static_cast<char *>(mailbox_); }
+    int32_t load_state() const;
+    void store_state(int32_t v);
+    void write_error(int32_t code, const std::string &msg);
+
+    void serve_task();
+    void serve_control();
+    Outcome native_control(uint64_t sub_cmd, bool &handled);
+
+    ChipWorker &worker_;
+    void *mailbox_;
+    int32_t device_id_;
+    ChipChildLoopOptions options_;
+    ChipChildLoopStats stats_;
+    std::string error_prefix_;
+
+    std::unordered_map<Digest, int32_t, DigestHash> table_;
+    std::unordered_set<int32_t> prepared_;
+
+    ControlHook on_control_;
+    PrepareHook on_prepare_;
+    TaskDoneHook on_task_done_;
+};
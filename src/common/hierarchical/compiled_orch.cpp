@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "compiled_orch.h"
+
+#include <dlfcn.h>
+
+#include <exception>
+#include <stdexcept>
+
+namespace {
+
+std::string dl_error() {
+    const char *e = dlerror();
+    return e ? std::string(e) : std::string("unknown dlerror");
+}
+
+// Full context; the entry only sees the SimplerL3Orch base.
+struct HostContext : SimplerL3Orch {
+    Orchestrator *orch{nullptr};
+    const std::vector<CompiledOrchCallable> *callables{nullptr};
+    int32_t open_scopes{0};
+    bool failed{false};
+    std::string error;
+};
+
+HostContext *host(SimplerL3Orch *o) { return static_cast<HostContext *>(o); }
+const HostContext *host(const SimplerL3Orch *o) { return static_cast<const HostContext *>(o); }
+
+void record(HostContext *h, const std::string &message) {
+    if (h->failed) return;
+    h->failed = true;
+    h->error = message;
+}
+
+// Run `body` unless the context already failed; turn an exception into the
+// sticky error.
+template <typename F>
+int32_t guarded(SimplerL3Orch *o, const char *op, F &&body) {
+    HostContext *h = host(o);
+    if (h->failed) return -1;
+    try {
+        body(h);
+        return 0;
+    } catch (const std::exception &e) {
+        record(h, std::string(op) + ": " + e.what());
+    }
+    return -1;
+}
+
+const CompiledOrchCallable &lookup(const HostContext *h, uint32_t index) {
+    if (index >= h->callables->size()) {
+        throw std::out_of_range(
+            "callable index " + std::to_string(index) + " out of range (" + std::to_string(h->callables->size()) +
+            " callables passed to CompiledOrchestration)"
+        );
+    }
+    return (*h->callables)[index];
+}
+
+const CompiledOrchCallable &lookup_sub(const HostContext *h, uint32_t index) {
+    const CompiledOrchCallable &c = lookup(h, index);
+    if (c.identity.target_namespace != TargetNamespace::LOCAL_PYTHON) {
+        throw std::invalid_argument("callable index " + std::to_string(index) + " is not a SUB callable");
+    }
+    return c;
+}
+
+int32_t op_submit_next_level(
+    SimplerL3Orch *o, uint32_t callable, const TaskArgs *args, const CallConfig *config, int32_t worker_id
+) {
+    return guarded(o, "submit_next_level", [&](HostContext *h) {
+        const CompiledOrchCallable &c = lookup(h, callable);
+        h->orch->submit_next_level(c.identity, *args, *config, worker_id, c.eligible_worker_ids);
+    });
+}
+
+int32_t op_submit_next_level_group(
+    SimplerL3Orch *o, uint32_t callable, const TaskArgs *args_list, uint32_t count, const CallConfig *config,
+    const int32_t *worker_ids
+) {
+    return guarded(o, "submit_next_level_group", [&](HostContext *h) {
+        const CompiledOrchCallable &c = lookup(h, callable);
+        std::vector<TaskArgs> list(args_list, args_list + count);
+        std::vector<int32_t> workers;
+        if (worker_ids != nullptr) workers.assign(worker_ids, worker_ids + count);
+        std::vector<std::vector<int32_t>> eligible;
+        if (!c.eligible_worker_ids.empty()) eligible.assign(count, c.eligible_worker_ids);
+        h->orch->submit_next_level_group(c.identity, list, *config, workers, eligible);
+    });
+}
+
+int32_t op_submit_sub(SimplerL3Orch *o, uint32_t callable, const TaskArgs *args) {
+    return guarded(o, "submit_sub", [&](HostContext *h) {
+        h->orch->submit_sub(lookup_sub(h, callable).identity, *args);
+    });
+}
+
+int32_t op_submit_sub_group(SimplerL3Orch *o, uint32_t callable, const TaskArgs *args_list, uint32_t count) {
+    return guarded(o, "submit_sub_group", [&](HostContext *h) {
+        const CompiledOrchCallable &c = lookup_sub(h, callable);
+        h->orch->submit_sub_group(c.identity, std::vector<TaskArgs>(args_list, args_list + count));
+    });
+}
+
+int32_t op_submit_copy(
+    SimplerL3Orch *o, int32_t src_worker_id, const Tensor *src, int32_t dst_worker_id, const Tensor *dst
+) {
+    return guarded(o, "submit_copy", [&](HostContext *h) {
+        h->orch->submit_copy(src_worker_id, *src, dst_worker_id, *dst);
+    });
+}
+
+int32_t op_alloc(SimplerL3Orch *o, const uint32_t *shape, uint32_t ndims, DataType dtype, Tensor *out) {
+    return guarded(o, "alloc", [&](HostContext *h) {
+        *out = h->orch->alloc(std::vector<uint32_t>(shape, shape + ndims), dtype);
+    });
+}
+
+int32_t op_scope_begin(SimplerL3Orch *o) {
+    return guarded(o, "scope_begin", [&](HostContext *h) {
+        h->orch->scope_begin();
+        ++h->open_scopes;
+    });
+}
+
+int32_t op_scope_end(SimplerL3Orch *o) {
+    return guarded(o, "scope_end", [&](HostContext *h) {
+        // Never close the outer scope Worker.run opened.
+        if (h->open_scopes == 0) throw std::logic_error("scope_end without a matching scope_begin");
+        --h->open_scopes;
+        h->orch->scope_end();
+    });
+}
+
+void op_fail(SimplerL3Orch *o, const char *message) {
+    record(host(o), message != nullptr && message[0] != '\0' ? message : "orchestration failed");
+}
+
+int32_t op_failed(const SimplerL3Orch *o) { return host(o)->failed ? 1 : 0; }
+
+const SimplerL3OrchOps kOps = {
+    op_submit_next_level, op_submit_next_level_group,
+    op_submit_sub,        op_submit_sub_group,
+    op_submit_copy,       op_alloc,
+    op_scope_begin,       op_scope_end,
+    op_fail,              op_failed,
+};
+
+}  // namespace
+
+CompiledOrchFunction::CompiledOrchFunction(const std::string &path, const std::string &symbol) :
+    path_(path),
+    symbol_(symbol) {
+    if (path.empty() || symbol.empty()) {
+        throw std::invalid_argument("CompiledOrchFunction: path and symbol must be non-empty");
+    }
+    handle_ = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle_ == nullptr) {
+        throw std::runtime_error("CompiledOrchFunction: dlopen(" + path + ") failed: " + dl_error());
+    }
+    dlerror();
+    void *sym = dlsym(handle_, symbol.c_str());
+    if (sym == nullptr) {
+        std::string msg = "CompiledOrchFunction: symbol '" + symbol + "' not found in " + path + ": " + dl_error();
+        dlclose(handle_);
+        handle_ = nullptr;
+        throw std::runtime_error(msg);
+    }
+    fn_ = reinterpret_cast<SimplerL3OrchFn>(sym);
+}
+
+CompiledOrchFunction::~CompiledOrchFunction() {
+    if (handle_ != nullptr) dlclose(handle_);
+}
+
+void CompiledOrchFunction::run(
+    Orchestrator &orch, const TaskArgs &args, const CallConfig &config,
+    const std::vector<CompiledOrchCallable> &callables
+) const {
+    HostContext ctx;
+    ctx.ops = &kOps;
+    ctx.callable_count = static_cast<uint32_t>(callables.size());
+    ctx.orch = &orch;
+    ctx.callables = &callables;
+
+    const int32_t rc = fn_(&ctx, &args, &config);
+
+    // Balance scopes the entry left open, as `with orch.scope()` would.
+    while (ctx.open_scopes > 0) {
+        --ctx.open_scopes;
+        orch.scope_end();
+    }
+    if (ctx.failed) throw std::runtime_error(symbol_ + ": " + ctx.error);
+    if (rc != 0) throw std::runtime_error(symbol_ + " returned " + std::to_string(rc));
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * CompiledOrchFunction — host side of l3_orchestration_api.h.
+ *
+ * Owns one dlopen'd orchestration entry and runs it against the Worker's
+ * Orchestrator. The ops table it hands the entry forwards each call to the
+ * matching Orchestrator method, translating exceptions into the sticky
+ * context error, so a compiled orch fn builds exactly the DAG the same
+ * sequence of Python `orch.submit_*` calls would — minus the per-submit
+ * validation and binding crossing.
+ *
+ * Scope / drain stay with the caller (`Worker.run`): run() executes inside
+ * the already-open outer scope and only closes scopes the entry itself left
+ * open.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "l3_orchestration_api.h"
+#include "orchestrator.h"
+#include "types.h"
+
+// One entry of the callable table the orch fn indexes into: the identity
+// Worker.register produced plus the NEXT_LEVEL eligibility it resolved to.
+struct CompiledOrchCallable {
+    CallableIdentity identity;
+    std::vector<int32_t> eligible_worker_ids;
+};
+
+class CompiledOrchFunction {
+public:
+    // dlopen(RTLD_NOW | RTLD_LOCAL) + dlsym. Throws std::runtime_error with
+    // dlerror() text when either step fails.
+    CompiledOrchFunction(const std::string &path, const std::string &symbol);
+    ~CompiledOrchFunction();
+
+    CompiledOrchFunction(const CompiledOrchFunction &) = delete;
+    CompiledOrchFunction &operator=(const CompiledOrchFunction &) = delete;
+
+    // Call the entry. Throws std::runtime_error carrying the first recorded
+    // error, or the entry's return code when it failed without one. Tasks
+    // submitted before the failure stay in the DAG; the caller drains them.
+    void run(
+        Orchestrator &orch, const TaskArgs &args, const CallConfig &config,
+        const std::vector<CompiledOrchCallable> &callables
+    ) const;
+
+    const std::string &path() const { return path_; }
+    const std::string &symbol() const { return symbol_; }
+
+private:
+    std::string path_;
+    std::string symbol_;
+    void *handle_{nullptr};
+    SimplerL3OrchFn fn_{nullptr};
+};
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * L3+ Orchestration API — compiled orchestration functions for Worker.run.
+ *
+ * The L3 counterpart of pto_orchestration_api.h: an orchestration `.so`
+ * exports one entry built with SIMPLER_L3_ORCHESTRATION and `Worker.run`
+ * calls it (via `CompiledOrchestration(path, symbol, callables)`) instead of
+ * a Python orch fn, so building the DAG never crosses into Python.
+ *
+ * The `.so` does not link against the runtime. Every call goes through the
+ * SimplerL3OrchOps function-pointer table the host hands in, so the library
+ * loads into any process that hosts a Worker, including a Python extension
+ * whose symbols are not globally visible. (Tensor helpers that assert, such
+ * as views, still need assert_compat.cpp linked into the `.so`.)
+ *
+ * Callables are referenced by index into the `callables` list given to
+ * CompiledOrchestration — the host resolves each index to the registered
+ * identity. Errors are sticky, like the L2 fatal flag: the first failed call
+ * records its message, every later call is a no-op returning false, and
+ * `Worker.run` raises the message once the entry returns and the DAG has
+ * drained.
+ *
+ *     #include "l3_orchestration_api.h"
+ *     SIMPLER_L3_ORCHESTRATION(build_dag) {
+ *         for (int32_t i = 0; i < n; ++i) {
+ *             TaskArgs a;
+ *             a.add_tensor(..., TensorArgType::OUTPUT);
+ *             orch.submit_next_level(0, a, config);
+ *         }
+ *         return orch.ok() ? 0 : 1;
+ *     }
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "../task_interface/call_config.h"
+#include "../task_interface/data_type.h"
+#include "../task_interface/task_args.h"
+#include "../task_interface/tensor.h"
+
+// =============================================================================
+// Ops Table and Opaque Context
+// =============================================================================
+
+typedef struct SimplerL3Orch SimplerL3Orch;
+
+/**
+ * Host-provided operations. Every op returns 0 on success and -1 after
+ * recording an error on the context (or when an earlier op already failed).
+ */
+typedef struct SimplerL3OrchOps {
+    int32_t (*submit_next_level)(
+        SimplerL3Orch *o, uint32_t callable, const TaskArgs *args, const CallConfig *config, int32_t worker_id
+    );
+    // `worker_ids` may be null (no affinity) or hold `count` entries.
+    int32_t (*submit_next_level_group)(
+        SimplerL3Orch *o, uint32_t callable, const TaskArgs *args_list, uint32_t count, const CallConfig *config,
+        const int32_t *worker_ids
+    );
+    int32_t (*submit_sub)(SimplerL3Orch *o, uint32_t callable, const TaskArgs *args);
+    int32_t (*submit_sub_group)(SimplerL3Orch *o, uint32_t callable, const TaskArgs *args_list, uint32_t count);
+    int32_t (*submit_copy)(
+        SimplerL3Orch *o, int32_t src_worker_id, const Tensor *src, int32_t dst_worker_id, const Tensor *dst
+    );
+    int32_t (*alloc)(SimplerL3Orch *o, const uint32_t *shape, uint32_t ndims, DataType dtype, Tensor *out);
+    int32_t (*scope_begin)(SimplerL3Orch *o);
+    int32_t (*scope_end)(SimplerL3Orch *o);
+    void (*fail)(SimplerL3Orch *o, const char *message);
+    int32_t (*failed)(const SimplerL3Orch *o);
+} SimplerL3OrchOps;
+
+/**
+ * Partial context visible to the orchestration `.so`. The host's full
+ * context starts with these fields.
+ */
+struct SimplerL3Orch {
+    const SimplerL3OrchOps *ops;
+    uint32_t callable_count;
+};
+
+// =============================================================================
+// Convenience Wrapper (calls through the ops table)
+// =============================================================================
+
+class L3Orch {
+public:
+    explicit L3Orch(SimplerL3Orch *o) :
+        o_(o) {}
+
+    uint32_t callable_count() const { return o_->callable_count; }
+
+    bool submit_next_level(
+        uint32_t callable, const TaskArgs &args, const CallConfig &config = CallConfig(), int32_t worker = -1
+    ) {
+        return o_->ops->submit_next_level(o_, callable, &args, &config, worker) == 0;
+    }
+
+    bool submit_next_level_group(
+        uint32_t callable, const std::vector<TaskArgs> &args_list, const CallConfig &config = CallConfig(),
+        const std::vector<int32_t> &workers = {}
+    ) {
+        if (!workers.empty() && workers.size() != args_list.size()) {
+            fail("submit_next_level_group: workers must be empty or match args_list");
+            return false;
+        }
+        return o_->ops->submit_next_level_group(
+                   o_, callable, args_list.data(), static_cast<uint32_t>(args_list.size()), &config,
+                   workers.empty() ? nullptr : workers.data()
+               ) == 0;
+    }
+
+    bool submit_sub(uint32_t callable, const TaskArgs &args = TaskArgs()) {
+        return o_->ops->submit_sub(o_, callable, &args) == 0;
+    }
+
+    bool submit_sub_group(uint32_t callable, const std::vector<TaskArgs> &args_list) {
+        return o_->ops->submit_sub_group(o_, callable, args_list.data(), static_cast<uint32_t>(args_list.size())) ==
+               0;
+    }
+
+    bool submit_copy(int32_t src_worker_id, const Tensor &src, int32_t dst_worker_id, const Tensor &dst) {
+        return o_->ops->submit_copy(o_, src_worker_id, &src, dst_worker_id, &dst) == 0;
+    }
+
+    // Returns a default Tensor (null address) once the context has failed.
+    Tensor alloc(const std::vector<uint32_t> &shape, DataType dtype) {
+        Tensor out{};
+        o_->ops->alloc(o_, shape.data(), static_cast<uint32_t>(shape.size()), dtype, &out);
+        return out;
+    }
+
+    // Scopes left open when the entry returns are closed by the host.
+    bool scope_begin() { return o_->ops->scope_begin(o_) == 0; }
+    bool scope_end() { return o_->ops->scope_end(o_) == 0; }
+
+    void fail(const std::string &message) { o_->ops->fail(o_, message.c_str()); }
+    bool ok() const { return o_->ops->failed(o_) == 0; }
+
+private:
+    SimplerL3Orch *o_;
+};
+
+typedef int32_t (*SimplerL3OrchFn)(SimplerL3Orch *orch, const TaskArgs *args, const CallConfig *config);
+
+/**
+ * Define an exported L3 orchestration entry. The body sees `L3Orch &orch`,
+ * `const TaskArgs &args` and `const CallConfig &config`, and returns 0 on
+ * success. Exceptions escaping the body are recorded as the run's error
+ * rather than unwinding into the host.
+ */
+#define SIMPLER_L3_ORCHESTRATION(name)                                                                        \
+    static int32_t name##_body(L3Orch &orch, const TaskArgs &args, const CallConfig &config);                 \
+    extern "C" __attribute__((visibility("default"))) int32_t name(                                           \
+        SimplerL3Orch *ctx, const TaskArgs *args, const CallConfig *config                                    \
+    ) {                                                                                                       \
+        L3Orch orch(ctx);                                                                                     \
+        try {                                                                                                 \
+            return name##_body(orch, *args, *config);                                                         \
+        } catch (const std::exception &e) {                                                                   \
+            orch.fail(e.what());                                                                              \
+        } catch (...) {                                                                                       \
+            orch.fail(#name ": unknown exception");                                                           \
+        }                                                                                                     \
+        return -1;                                                                                            \
+    }                                                                                                         \
+    static int32_t name##_body(L3Orch &orch, const TaskArgs &args, const CallConfig &config)
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "native_sub.h"
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include "ring.h"
+
+namespace {
+
+// Callee-owned message buffer. Sized like the mailbox error region so a
+// message survives the trip back to the parent untruncated.
+constexpr size_t kErrBufSize = MAILBOX_ERROR_MSG_SIZE;
+
+std::string format_digest(const uint8_t *digest) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    std::string out = "sha256:";
+    out.reserve(7 + 2 * CALLABLE_HASH_DIGEST_SIZE);
+    for (size_t i = 0; i < CALLABLE_HASH_DIGEST_SIZE; ++i) {
+        out.push_back(kHex[digest[i] >> 4]);
+        out.push_back(kHex[digest[i] & 0x0F]);
+    }
+    return out;
+}
+
+std::string dl_error() {
+    const char *e = dlerror();
+    return e ? std::string(e) : std::string("unknown dlerror");
+}
+
+// Read a payload the parent staged through broadcast_control_all. The
+// segment is unlinked by the broadcaster once every endpoint answered.
+std::string read_shm_payload(const char *shm_name, size_t size) {
+    if (shm_name == nullptr || shm_name[0] == '\0' || size == 0) {
+        throw std::runtime_error("native SUB register: missing payload");
+    }
+    const std::string full_name = std::string("/") + shm_name;
+    int fd = shm_open(full_name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        throw std::runtime_error("native SUB register: shm_open(" + full_name + ") failed: " + std::strerror(errno));
+    }
+    void *addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    int err = errno;
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        throw std::runtime_error(std::string("native SUB register: mmap failed: ") + std::strerror(err));
+    }
+    std::string out(static_cast<const char *>(addr), size);
+    munmap(addr, size);
+    return out;
+}
+
+}  // namespace
+
+// =============================================================================
+// NativeSubFunction
+// =============================================================================
+
+NativeSubFunction::NativeSubFunction(const std::string &path, const std::string &symbol) :
+    path_(path),
+    symbol_(symbol) {
+    if (path.empty() || symbol.empty()) {
+        throw std::invalid_argument("NativeSubFunction: path and symbol must be non-empty");
+    }
+    handle_ = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle_ == nullptr) {
+        throw std::runtime_error("NativeSubFunction: dlopen(" + path + ") failed: " + dl_error());
+    }
+    dlerror();
+    void *sym = dlsym(handle_, symbol.c_str());
+    if (sym == nullptr) {
+        std::string msg = "NativeSubFunction: symbol '" + symbol + "' not found in " + path + ": " + dl_error();
+        dlclose(handle_);
+        handle_ = nullptr;
+        throw std::runtime_error(msg);
+    }
+    fn_ = reinterpret_cast<SimplerNativeSubFn>(sym);
+}
+
+NativeSubFunction::~NativeSubFunction() {
+    if (handle_ != nullptr) dlclose(handle_);
+}
+
+void NativeSubFunction::run(const TaskArgsView &args) const {
+    char err[kErrBufSize];
+    err[0] = '\0';
+    const int32_t rc = fn_(&args, err, sizeof(err));
+    if (rc == 0) return;
+    err[sizeof(err) - 1] = '\0';
+    std::string msg = symbol_ + " returned " + std::to_string(rc);
+    if (err[0] != '\0') msg += ": " + std::string(err);
+    throw std::runtime_error(msg);
+}
+
+void parse_native_sub_payload(const void *payload, size_t size, std::string &path, std::string &symbol) {
+    const char *p = static_cast<const char *>(payload);
+    const void *sep = p == nullptr ? nullptr : std::memchr(p, '\0', size);
+    if (sep == nullptr) {
+        throw std::runtime_error("native SUB payload must be '<path>\\0<symbol>'");
+    }
+    const size_t path_len = static_cast<size_t>(static_cast<const char *>(sep) - p);
+    path.assign(p, path_len);
+    symbol.assign(p + path_len + 1, size - path_len - 1);
+    // Tolerate a trailing NUL on the symbol.
+    const size_t nul = symbol.find('\0');
+    if (nul != std::string::npos) symbol.resize(nul);
+    if (path.empty() || symbol.empty()) {
+        throw std::runtime_error("native SUB payload must be '<path>\\0<symbol>'");
+    }
+}
+
+// =============================================================================
+// NativeSubEndpoint
+// =============================================================================
+
+size_t NativeSubEndpoint::DigestHash::operator()(const Digest &d) const noexcept {
+    // SHA-256 output: any 8 bytes are already uniformly distributed.
+    uint64_t v;
+    std::memcpy(&v, d.data(), sizeof(v));
+    return static_cast<size_t>(v);
+}
+
+NativeSubEndpoint::NativeSubEndpoint(int32_t worker_id, const std::vector<NativeSubPreload> &preload) {
+    caps_.kind = WorkerEndpointKind::IN_PROCESS;
+    caps_.worker_id = worker_id;
+    caps_.transport = "in-process";
+    for (const auto &p : preload) {
+        install(p.digest.data(), p.path, p.symbol, p.refs);
+    }
+}
+
+void NativeSubEndpoint::install(
+    const uint8_t *digest, const std::string &path, const std::string &symbol, int32_t refs
+) {
+    if (digest == nullptr) throw std::invalid_argument("NativeSubEndpoint::install: null digest");
+    if (refs <= 0) throw std::invalid_argument("NativeSubEndpoint::install: refs must be positive");
+    Digest key;
+    std::memcpy(key.data(), digest, key.size());
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        auto it = table_.find(key);
+        if (it != table_.end()) {
+            it->second.refs += refs;
+            return;
+        }
+    }
+    // dlopen outside the lock: library constructors may be slow.
+    auto fn = std::make_shared<NativeSubFunction>(path, symbol);
+    std::lock_guard<std::mutex> lk(mu_);
+    Entry &e = table_[key];
+    if (!e.fn) e.fn = std::move(fn);
+    e.refs += refs;
+}
+
+void NativeSubEndpoint::remove(const uint8_t *digest) {
+    if (digest == nullptr) return;
+    Digest key;
+    std::memcpy(key.data(), digest, key.size());
+    std::shared_ptr<NativeSubFunction> dropped;
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = table_.find(key);
+    if (it == table_.end()) return;
+    if (--it->second.refs > 0) return;
+    dropped = std::move(it->second.fn);
+    table_.erase(it);
+}
+
+size_t NativeSubEndpoint::size() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return table_.size();
+}
+
+WorkerCompletion NativeSubEndpoint::run(Ring *ring, const WorkerDispatch &dispatch) {
+    if (ring == nullptr) throw std::invalid_argument("NativeSubEndpoint::run: null ring");
+    TaskSlotState &s = *ring->slot_state(dispatch.task_slot);
+    WorkerCompletion completion;
+    completion.task_slot = dispatch.task_slot;
+    completion.group_index = dispatch.group_index;
+
+    std::shared_ptr<NativeSubFunction> fn;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        auto it = table_.find(s.callable.digest);
+        if (it != table_.end()) fn = it->second.fn;
+    }
+    if (!fn) {
+        completion.outcome = EndpointOutcome::TASK_FAILURE;
+        completion.error_message = "NativeSubEndpoint::run: callable hash " + format_digest(s.callable.digest.data()) +
+                                   " is not a registered NATIVE_SO callable (worker_id=" +
+                                   std::to_string(caps_.worker_id) + ")";
+        return completion;
+    }
+    try {
+        fn->run(s.args_view(dispatch.group_index));
+    } catch (const std::exception &e) {
+        completion.outcome = EndpointOutcome::TASK_FAILURE;
+        completion.error_message =
+            "NativeSubEndpoint::run: worker_id=" + std::to_string(caps_.worker_id) + ": " + e.what();
+        return completion;
+    }
+    completion.outcome = EndpointOutcome::SUCCESS;
+    return completion;
+}
+
+void NativeSubEndpoint::control_generic(
+    uint64_t sub_cmd, const char *shm_name, size_t payload_size, double /*timeout_s*/, const uint8_t *digest
+) {
+    if (digest == nullptr) throw std::runtime_error("control_generic: in-process SUB control needs a digest");
+    if (sub_cmd == CTRL_NATIVE_SO_REGISTER) {
+        std::string path;
+        std::string symbol;
+        const std::string payload = read_shm_payload(shm_name, payload_size);
+        parse_native_sub_payload(payload.data(), payload.size(), path, symbol);
+        install(digest, path, symbol);
+    } else if (sub_cmd == CTRL_PY_UNREGISTER) {
+        remove(digest);
+    } else {
+        // CTRL_PY_REGISTER / the Python import register: there is no
+        // interpreter on this side of the endpoint.
+        throw std::runtime_error(
+            "control_generic: in-process SUB workers only run NATIVE_SO callables (sub-command " +
+            std::to_string(sub_cmd) + ")"
+        );
+    }
+}
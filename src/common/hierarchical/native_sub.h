@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Native SUB callables — C ABI functions loaded from shared libraries.
+ *
+ * NativeSubFunction owns one dlopen'd `(path, symbol)` pair and calls it
+ * against a borrowed TaskArgsView (see native_sub_abi.h for the contract).
+ * Two consumers:
+ *
+ *   - A forked SUB child (`_sub_worker_loop`) holds one per NATIVE_SO digest
+ *     and runs it straight over the mailbox blob — no TaskArgs decode, no
+ *     Python call in between.
+ *   - NativeSubEndpoint, an in-process SUB endpoint: the WorkerThread calls
+ *     the function on the slot's own TaskArgs via `args_view()`, so there is
+ *     no child process, no mailbox and no blob copy at all.
+ *
+ * Identity stays the parent's job: the digest is SHA-256 over a descriptor
+ * that includes the library's content hash and the symbol, computed (and, in
+ * forked children, re-checked) in Python. The endpoint keys its table by that
+ * digest and never re-hashes — it lives in the process that computed it.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../task_interface/native_sub_abi.h"
+#include "types.h"
+#include "worker_manager.h"
+
+class NativeSubFunction {
+public:
+    // dlopen(RTLD_NOW | RTLD_LOCAL) + dlsym. Throws std::runtime_error with
+    // dlerror() text when either step fails.
+    NativeSubFunction(const std::string &path, const std::string &symbol);
+    ~NativeSubFunction();
+
+    NativeSubFunction(const NativeSubFunction &) = delete;
+    NativeSubFunction &operator=(const NativeSubFunction &) = delete;
+
+    // Call the symbol. Throws std::runtime_error carrying the callee's
+    // message (or its return code) on a non-zero return.
+    void run(const TaskArgsView &args) const;
+
+    const std::string &path() const { return path_; }
+    const std::string &symbol() const { return symbol_; }
+
+private:
+    std::string path_;
+    std::string symbol_;
+    void *handle_{nullptr};
+    SimplerNativeSubFn fn_{nullptr};
+};
+
+// Pre-start table entry: the identity snapshot handed to a new endpoint.
+struct NativeSubPreload {
+    std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> digest{};
+    std::string path;
+    std::string symbol;
+    int32_t refs{1};
+};
+
+// Split a CTRL_NATIVE_SO_REGISTER payload ("<path>\0<symbol>").
+void parse_native_sub_payload(const void *payload, size_t size, std::string &path, std::string &symbol);
+
+class NativeSubEndpoint : public WorkerEndpoint {
+public:
+    NativeSubEndpoint(int32_t worker_id, const std::vector<NativeSubPreload> &preload = {});
+
+    const WorkerEndpointCaps &caps() const override { return caps_; }
+    WorkerCompletion run(Ring *ring, const WorkerDispatch &dispatch) override;
+
+    // Refcounted like the Python child tables: a second install of a digest
+    // only bumps the count; remove drops the function at zero.
+    void install(const uint8_t *digest, const std::string &path, const std::string &symbol, int32_t refs = 1);
+    void remove(const uint8_t *digest);
+    size_t size() const;
+
+    // Serves the broadcast register/unregister protocol the forked SUB
+    // children speak: CTRL_NATIVE_SO_REGISTER and CTRL_PY_UNREGISTER.
+    // Python callables have nowhere to run here and are rejected.
+    void control_generic(
+        uint64_t sub_cmd, const char *shm_name, size_t payload_size, double timeout_s, const uint8_t *digest
+    ) override;
+
+private:
+    using Digest = std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE>;
+    struct DigestHash {
+        size_t operator()(const Digest &d) const noexcept;
+    };
+    struct Entry {
+        std::shared_ptr<NativeSubFunction> fn;
+        int32_t refs{0};
+    };
+
+    WorkerEndpointCaps caps_;
+    // Guards table_ only; run() copies the shared_ptr out and calls without
+    // the lock, so a concurrent unregister never waits on a running task.
+    mutable std::mutex mu_;
+    std::unordered_map<Digest, Entry, DigestHash> table_;
+};
@@ -181,6 +181,94 @@ SubmitResult Orchestrator::submit_sub_group(const CallableIdentity &callable, co
     return submit_impl(WorkerType::SUB, callable, CallConfig{}, args_list);
 }
 
+// =============================================================================
+// submit_copy — data-movement DAG node
+// =============================================================================
+
+namespace {
+
+// Chip buffers are keyed per worker exactly as infer_deps keys a pinned
+// task's child-memory tensors; host buffers use the shared host key.
+TensorKey copy_endpoint_key(int32_t worker_id, uint64_t ptr) {
+    return worker_id >= 0 ? TensorKey::local_child(ptr, worker_id) : TensorKey::local_host(ptr);
+}
+
+}  // namespace
+
+SubmitResult
+Orchestrator::submit_copy(int32_t src_worker_id, const Tensor &src, int32_t dst_worker_id, const Tensor &dst) {
+    if (src_worker_id < 0 && dst_worker_id < 0) {
+        throw std::invalid_argument("Orchestrator::submit_copy: host-to-host copies are not DAG nodes");
+    }
+    if (src.buffer.addr == 0 || dst.buffer.addr == 0) {
+        throw std::invalid_argument("Orchestrator::submit_copy: src and dst must have a data pointer");
+    }
+    const uint64_t nbytes = src.nbytes();
+    if (dst.nbytes() < nbytes) {
+        throw std::invalid_argument(
+            "Orchestrator::submit_copy: dst holds " + std::to_string(dst.nbytes()) + " bytes, src needs " +
+            std::to_string(nbytes)
+        );
+    }
+    for (int32_t worker_id : {src_worker_id, dst_worker_id}) {
+        if (worker_id < 0 || manager_ == nullptr) continue;
+        WorkerThread *wt = manager_->get_worker_by_id(WorkerType::NEXT_LEVEL, worker_id);
+        if (wt == nullptr) {
+            throw std::invalid_argument(
+                "Orchestrator::submit_copy: worker " + std::to_string(worker_id) + " is not a registered worker"
+            );
+        }
+        if (wt->caps().remote) {
+            throw std::invalid_argument(
+                "Orchestrator::submit_copy: worker " + std::to_string(worker_id) +
+                " is remote; move remote buffers with remote_copy_* instead"
+            );
+        }
+    }
+
+    if (manager_ && manager_->has_error()) {
+        std::rethrow_exception(manager_->take_error());
+    }
+    active_tasks_.fetch_add(1, std::memory_order_relaxed);
+
+    // Only a chip-to-chip copy needs a bounce buffer: the source child writes
+    // it, the destination child reads it, both through MAP_SHARED memory.
+    const bool staged = src_worker_id >= 0 && dst_worker_id >= 0;
+    AllocResult ar = allocator_->alloc(staged ? align_up(nbytes, HEAP_ALIGN) : 0, scope_->current_depth());
+    if (ar.slot == INVALID_SLOT) {
+        active_tasks_.fetch_sub(1, std::memory_order_relaxed);
+        throw std::runtime_error("Orchestrator: allocator shutdown");
+    }
+    TaskSlot slot = ar.slot;
+
+    TaskSlotState &s = slot_state(slot);
+    s.reset();
+    s.worker_type = WorkerType::NEXT_LEVEL;
+    s.is_copy = true;
+    s.copy.src_worker_id = src_worker_id;
+    s.copy.src = src.buffer.addr;
+    s.copy.dst_worker_id = dst_worker_id;
+    s.copy.dst = dst.buffer.addr;
+    s.copy.nbytes = nbytes;
+    s.copy.staging = staged ? reinterpret_cast<uint64_t>(ar.heap_ptr) : 0;
+    // The destination worker drives the copy so its thread, not the orch
+    // thread, absorbs the wait; a copy to host runs on the source worker.
+    s.affinities = {dst_worker_id >= 0 ? dst_worker_id : src_worker_id};
+
+    // src: INPUT (RaW). dst: INOUT (RaW + WaW) — a copy usually lands in a
+    // pre-allocated buffer whose previous writer must finish first.
+    std::vector<TaskSlot> producers;
+    TaskSlot src_prod = tensormap_->lookup(copy_endpoint_key(src_worker_id, src.buffer.addr));
+    if (src_prod != INVALID_SLOT) producers.push_back(src_prod);
+    TensorKey dst_key = copy_endpoint_key(dst_worker_id, dst.buffer.addr);
+    TaskSlot dst_prod = tensormap_->lookup(dst_key);
+    if (dst_prod != INVALID_SLOT && dst_prod != src_prod) producers.push_back(dst_prod);
+    tensormap_->insert(dst_key, slot);
+    s.output_keys.push_back(dst_key);
+
+    return wire_and_publish(slot, producers, WorkerType::NEXT_LEVEL);
+}
+
 // =============================================================================
 // submit_impl — shared 7-step submit machinery
 // =============================================================================
@@ -250,6 +338,18 @@ SubmitResult Orchestrator::submit_impl(
     }
     s.affinities = std::move(affinities);
 
+    return wire_and_publish(slot, producers, worker_type);
+}
+
+// =============================================================================
+// wire_and_publish — fanin wiring + ready push shared by every submit path
+// =============================================================================
+
+SubmitResult Orchestrator::wire_and_publish(
+    TaskSlot slot, const std::vector<TaskSlot> &producers, WorkerType worker_type
+) {
+    TaskSlotState &s = slot_state(slot);
+
     // --- Step 5: Finalize fanin — lock each producer's fanout_mu, attach ---
     //
     // For COMPLETED producers (notably alloc-created synthetic slots), we
@@ -117,6 +117,20 @@ public:
     // Submit a group of SUB tasks: N args -> N workers, 1 DAG node.
     SubmitResult submit_sub_group(const CallableIdentity &callable, const std::vector<TaskArgs> &args_list);
 
+    // Submit a copy of `src` (on worker `src_worker_id`) into `dst` (on
+    // worker `dst_worker_id`) as a DAG node. -1 names parent host memory; at
+    // least one side must be a NEXT_LEVEL worker. `src` is read like an INPUT
+    // and `dst` is written like an INOUT, keyed the same way a task pinned to
+    // that worker keys its child-memory tensors, so producers and consumers
+    // of either buffer order against the copy through the TensorMap.
+    //
+    // Driven by the destination worker's thread (source thread for copies to
+    // host) as async hops on the children's copy threads; that worker keeps
+    // taking tasks while the copy is in flight. A chip-to-chip copy bounces
+    // through a HeapRing staging slab that is reclaimed with the slot. Copies
+    // `src.nbytes()`; `dst` must be at least that large.
+    SubmitResult submit_copy(int32_t src_worker_id, const Tensor &src, int32_t dst_worker_id, const Tensor &dst);
+
     // Open a nested scope. Every task submitted between this call and the
     // matching `scope_end()` picks a heap ring based on the current scope
     // depth (`min(depth, MAX_RING_DEPTH - 1)`) so its slab reclaims
@@ -197,6 +211,11 @@ private:
         std::vector<RemoteTaskArgsSidecar> remote_sidecars = {}
     );
 
+    // Steps 5-6 of every submit: attach `slot` to each producer's fanout,
+    // poison it if a producer already failed, and push it to the ready queue
+    // when no live fanin remains.
+    SubmitResult wire_and_publish(TaskSlot slot, const std::vector<TaskSlot> &producers, WorkerType worker_type);
+
     // Size, in aligned bytes, an OUTPUT tensor should occupy in the HeapRing.
     static uint64_t output_alloc_bytes(const Tensor &t);
 
@@ -55,6 +55,14 @@ uint32_t read_le_u32(const uint8_t *data) {
            (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
 }
 
+// A control the session answered with a non-zero error_code.
+struct RemoteControlError : std::runtime_error {
+    RemoteControlError(int32_t code, const std::string &message) :
+        std::runtime_error(message),
+        error_code(code) {}
+    int32_t error_code;
+};
+
 std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> digest_array(const uint8_t *digest) {
     if (digest == nullptr) throw std::invalid_argument("RemoteL3Endpoint: null callable digest");
     std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> out{};
@@ -555,7 +563,7 @@ std::vector<uint8_t> RemoteL3SocketTransport::read_frame() {
     return frame;
 }
 
-void RemoteL3SocketTransport::expect_hello_ready(
+remote_l3::HelloPayload RemoteL3SocketTransport::expect_hello_ready(
     uint64_t session_id, int32_t worker_id, const std::string &comm_profile
 ) {
     auto frame = remote_l3::decode_frame(read_frame());
@@ -573,6 +581,7 @@ void RemoteL3SocketTransport::expect_hello_ready(
         throw std::runtime_error("RemoteL3SocketTransport: HELLO comm profile mismatch");
     }
     start_health_monitor(session_id, worker_id);
+    return hello;
 }
 
 void RemoteL3SocketTransport::submit_frame(const std::vector<uint8_t> &frame) {
@@ -592,10 +601,12 @@ std::vector<uint8_t> RemoteL3SocketTransport::wait_for_reply(remote_l3::FrameTyp
 void RemoteL3SocketTransport::shutdown() { close_socket(); }
 
 RemoteL3Endpoint::RemoteL3Endpoint(
-    int32_t worker_id, uint64_t session_id, std::string transport_name, std::unique_ptr<RemoteL3Transport> transport
+    int32_t worker_id, uint64_t session_id, std::string transport_name, std::unique_ptr<RemoteL3Transport> transport,
+    uint64_t peer_feature_flags
 ) :
     session_id_(session_id),
-    transport_(std::move(transport)) {
+    transport_(std::move(transport)),
+    peer_accepts_held_blob_((peer_feature_flags & remote_l3::HELLO_FEATURE_HELD_CHIP_BLOB) != 0) {
     if (worker_id < 0) throw std::invalid_argument("RemoteL3Endpoint: worker_id must be non-negative");
     if (session_id == 0) throw std::invalid_argument("RemoteL3Endpoint: session_id must be non-zero");
     if (!transport_) throw std::invalid_argument("RemoteL3Endpoint: null transport");
@@ -720,7 +731,7 @@ RemoteL3Endpoint::run_control(remote_l3::ControlName control_name, const std::ve
             remote_l3::decode_control_reply(reply.payload.data(), reply.payload.size(), sequence, control_name, 1);
         command_lane_.finish_reply(sequence);
         if (decoded.error_code != 0) {
-            throw std::runtime_error(decoded.error_message);
+            throw RemoteControlError(decoded.error_code, decoded.error_message);
         }
         return decoded;
     } catch (...) {
@@ -743,12 +754,54 @@ void RemoteL3Endpoint::control_remote_prepare_register(
     std::vector<uint8_t> bytes;
     const auto *payload_bytes = static_cast<const uint8_t *>(payload);
     if (payload_size > 0) bytes.assign(payload_bytes, payload_bytes + payload_size);
+    auto key = digest_array(digest);
+    if (callable_kind == CallableKind::CHIP_CALLABLE && holds_chip_callable(target_registry, key)) {
+        auto held = remote_l3::decode_remote_chip_callable_payload(bytes.data(), bytes.size());
+        if (held.blob_location == remote_l3::ChipCallableBlobLocation::INLINE_BLOB) {
+            held.blob_location = remote_l3::ChipCallableBlobLocation::HELD_BLOB;
+            held.inline_blob.clear();
+            try {
+                run_control(
+                    remote_l3::ControlName::PREPARE_REGISTER_CALLABLE,
+                    remote_l3::encode_register_callable_command(
+                        target_registry, callable_kind, key, 1, remote_l3::encode_remote_chip_callable_payload(held)
+                    )
+                );
+                return;
+            } catch (const RemoteControlError &e) {
+                // The session dropped the digest behind our back (e.g. a
+                // restart); forget it and ship the blob.
+                if (e.error_code != remote_l3::CONTROL_ERROR_BLOB_NOT_HELD) throw;
+                set_chip_callable_held(target_registry, key, false);
+            }
+        }
+    }
     run_control(
         remote_l3::ControlName::PREPARE_REGISTER_CALLABLE,
-        remote_l3::encode_register_callable_command(target_registry, callable_kind, digest_array(digest), 1, bytes)
+        remote_l3::encode_register_callable_command(target_registry, callable_kind, key, 1, bytes)
     );
 }
 
+bool RemoteL3Endpoint::holds_chip_callable(
+    remote_l3::RemoteRegistryTarget target_registry, const std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> &digest
+) {
+    if (!peer_accepts_held_blob_) return false;
+    std::lock_guard<std::mutex> lk(held_mu_);
+    return held_chip_digests_.count({target_registry, digest}) != 0;
+}
+
+void RemoteL3Endpoint::set_chip_callable_held(
+    remote_l3::RemoteRegistryTarget target_registry, const std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> &digest,
+    bool held
+) {
+    std::lock_guard<std::mutex> lk(held_mu_);
+    if (held) {
+        held_chip_digests_.insert({target_registry, digest});
+    } else {
+        held_chip_digests_.erase({target_registry, digest});
+    }
+}
+
 void RemoteL3Endpoint::control_prepare(const uint8_t *digest) {
     run_control(
         remote_l3::ControlName::PREPARE_CALLABLE,
@@ -765,6 +818,9 @@ void RemoteL3Endpoint::control_remote_commit_register(
         remote_l3::ControlName::COMMIT_REGISTER_CALLABLE,
         remote_l3::encode_digest_callable_command(target_registry, callable_kind, digest_array(digest))
     );
+    if (callable_kind == CallableKind::CHIP_CALLABLE) {
+        set_chip_callable_held(target_registry, digest_array(digest), true);
+    }
 }
 
 void RemoteL3Endpoint::control_remote_abort_register(
@@ -779,6 +835,9 @@ void RemoteL3Endpoint::control_remote_abort_register(
 void RemoteL3Endpoint::control_remote_unregister(
     remote_l3::RemoteRegistryTarget target_registry, CallableKind callable_kind, const uint8_t *digest
 ) {
+    if (callable_kind == CallableKind::CHIP_CALLABLE) {
+        set_chip_callable_held(target_registry, digest_array(digest), false);
+    }
     run_control(
         remote_l3::ControlName::UNREGISTER_CALLABLE,
         remote_l3::encode_digest_callable_command(target_registry, callable_kind, digest_array(digest))
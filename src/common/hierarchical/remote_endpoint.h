@@ -11,11 +11,14 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <mutex>
 #include <atomic>
+#include <set>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "remote_wire.h"
@@ -36,7 +39,8 @@ public:
     );
     ~RemoteL3SocketTransport() override;
 
-    void expect_hello_ready(uint64_t session_id, int32_t worker_id, const std::string &comm_profile);
+    remote_l3::HelloPayload
+    expect_hello_ready(uint64_t session_id, int32_t worker_id, const std::string &comm_profile);
     void submit_frame(const std::vector<uint8_t> &frame) override;
     std::vector<uint8_t> wait_for_reply(remote_l3::FrameType frame_type, uint64_t sequence) override;
     void shutdown() override;
@@ -69,8 +73,10 @@ private:
 
 class RemoteL3Endpoint : public WorkerEndpoint {
 public:
+    // peer_feature_flags: the session's HELLO feature_flags.
     RemoteL3Endpoint(
-        int32_t worker_id, uint64_t session_id, std::string transport_name, std::unique_ptr<RemoteL3Transport> transport
+        int32_t worker_id, uint64_t session_id, std::string transport_name,
+        std::unique_ptr<RemoteL3Transport> transport, uint64_t peer_feature_flags = 0
     );
 
     const WorkerEndpointCaps &caps() const override { return caps_; }
@@ -110,6 +116,22 @@ private:
     std::unique_ptr<RemoteL3Transport> transport_;
     remote_l3::OrderedCommandLane command_lane_;
     std::mutex command_mu_;
+    // CHIP_CALLABLE (registry, digest) pairs this session has committed and
+    // not unregistered. When the session's HELLO advertised
+    // HELLO_FEATURE_HELD_CHIP_BLOB, a re-register of one of these sends
+    // HELD_BLOB instead of the blob.
+    using HeldChipKey = std::pair<remote_l3::RemoteRegistryTarget, std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE>>;
+    const bool peer_accepts_held_blob_;
+    std::mutex held_mu_;
+    std::set<HeldChipKey> held_chip_digests_;
+
+    bool holds_chip_callable(
+        remote_l3::RemoteRegistryTarget target_registry, const std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> &digest
+    );
+    void set_chip_callable_held(
+        remote_l3::RemoteRegistryTarget target_registry, const std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> &digest,
+        bool held
+    );
 
     remote_l3::TaskPayloadWire build_task_payload(const TaskSlotState &slot, int32_t group_index) const;
     remote_l3::ControlReplyPayload
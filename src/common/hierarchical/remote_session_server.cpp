@@ -0,0 +1,966 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "remote_session_server.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+#include "chip_worker.h"
+
+namespace {
+
+static constexpr size_t FRAME_HEADER_BYTES = 40;
+static constexpr int32_t REMOTE_ERROR = remote_l3::CONTROL_ERROR;
+static constexpr int32_t MAX_SERVER_CIDS = 64;  // ChipWorker's callable_id cap
+
+// A HELD_BLOB prepare named a digest this session does not hold; answered
+// with CONTROL_ERROR_BLOB_NOT_HELD so the sender can resend the blob.
+struct BlobNotHeld : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+std::string errno_message(const std::string &what) { return what + ": " + std::strerror(errno); }
+
+void put_u32(std::vector<uint8_t> &out, uint32_t v) {
+    for (int i = 0; i < 4; ++i)
+        out.push_back(static_cast<uint8_t>((v >> (8 * i)) & 0xffU));
+}
+
+void put_i32(std::vector<uint8_t> &out, int32_t v) { put_u32(out, static_cast<uint32_t>(v)); }
+
+void put_u64(std::vector<uint8_t> &out, uint64_t v) {
+    for (int i = 0; i < 8; ++i)
+        out.push_back(static_cast<uint8_t>((v >> (8 * i)) & 0xffU));
+}
+
+uint32_t get_u32(const std::vector<uint8_t> &data, size_t &offset) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i)
+        v |= static_cast<uint32_t>(data[offset++]) << (8 * i);
+    return v;
+}
+
+uint64_t get_u64(const std::vector<uint8_t> &data, size_t &offset) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; ++i)
+        v |= static_cast<uint64_t>(data[offset++]) << (8 * i);
+    return v;
+}
+
+// Copy commands: <i32 worker_id, u64 buffer_id, u64 generation, u64 offset, u64 size> then data.
+struct CopyCommandHeader {
+    int32_t worker_id;
+    uint64_t buffer_id;
+    uint64_t generation;
+    uint64_t offset;
+    uint64_t size;
+};
+
+static constexpr size_t COPY_COMMAND_HEADER_BYTES = 36;
+
+CopyCommandHeader decode_copy_command_header(const std::vector<uint8_t> &command) {
+    if (command.size() < COPY_COMMAND_HEADER_BYTES) throw std::runtime_error("remote buffer copy command is truncated");
+    size_t offset = 0;
+    CopyCommandHeader h{};
+    h.worker_id = static_cast<int32_t>(get_u32(command, offset));
+    h.buffer_id = get_u64(command, offset);
+    h.generation = get_u64(command, offset);
+    h.offset = get_u64(command, offset);
+    h.size = get_u64(command, offset);
+    return h;
+}
+
+bool range_fits(uint64_t offset, uint64_t size, uint64_t limit) { return offset <= limit && size <= limit - offset; }
+
+const char *control_name_str(remote_l3::ControlName name) {
+    switch (name) {
+    case remote_l3::ControlName::UNREGISTER_CALLABLE:
+        return "UNREGISTER_CALLABLE";
+    case remote_l3::ControlName::PREPARE_REGISTER_CALLABLE:
+        return "PREPARE_REGISTER_CALLABLE";
+    case remote_l3::ControlName::COMMIT_REGISTER_CALLABLE:
+        return "COMMIT_REGISTER_CALLABLE";
+    case remote_l3::ControlName::ABORT_REGISTER_CALLABLE:
+        return "ABORT_REGISTER_CALLABLE";
+    case remote_l3::ControlName::PREPARE_CALLABLE:
+        return "PREPARE_CALLABLE";
+    case remote_l3::ControlName::ALLOC_REMOTE_BUFFER:
+        return "ALLOC_REMOTE_BUFFER";
+    case remote_l3::ControlName::FREE_REMOTE_BUFFER:
+        return "FREE_REMOTE_BUFFER";
+    case remote_l3::ControlName::COPY_TO_REMOTE:
+        return "COPY_TO_REMOTE";
+    case remote_l3::ControlName::COPY_FROM_REMOTE:
+        return "COPY_FROM_REMOTE";
+    case remote_l3::ControlName::EXPORT_BUFFER:
+        return "EXPORT_BUFFER";
+    case remote_l3::ControlName::IMPORT_BUFFER:
+        return "IMPORT_BUFFER";
+    case remote_l3::ControlName::RELEASE_IMPORT:
+        return "RELEASE_IMPORT";
+    case remote_l3::ControlName::COMM_INIT:
+        return "COMM_INIT";
+    case remote_l3::ControlName::ALLOC_DOMAIN:
+        return "ALLOC_DOMAIN";
+    case remote_l3::ControlName::RELEASE_DOMAIN:
+        return "RELEASE_DOMAIN";
+    }
+    return "UNKNOWN";
+}
+
+bool is_reserved_domain_control(remote_l3::ControlName name) {
+    return name == remote_l3::ControlName::COMM_INIT || name == remote_l3::ControlName::ALLOC_DOMAIN ||
+           name == remote_l3::ControlName::RELEASE_DOMAIN;
+}
+
+std::string hex(const uint8_t *data, size_t n) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    std::string out;
+    out.reserve(2 * n);
+    for (size_t i = 0; i < n; ++i) {
+        out.push_back(kHex[data[i] >> 4]);
+        out.push_back(kHex[data[i] & 0x0F]);
+    }
+    return out;
+}
+
+// Clip to the wire's error limit without splitting a UTF-8 sequence, so the
+// Python client can still decode the message.
+std::string clip_error(std::string message) {
+    if (message.size() <= remote_l3::MAX_ERROR_BYTES) return message;
+    size_t n = remote_l3::MAX_ERROR_BYTES;
+    while (n > 0 && (static_cast<uint8_t>(message[n]) & 0xC0U) == 0x80U)
+        --n;
+    message.resize(n);
+    return message;
+}
+
+// FIPS 180-4 SHA-256, used only to check CHIP_CALLABLE blobs against the
+// digest their sender computed.
+std::array<uint8_t, 32> sha256(const uint8_t *data, size_t size) {
+    static constexpr uint32_t K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+    };
+    uint32_t h[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    auto rotr = [](uint32_t x, int n) {
+        return (x >> n) | (x << (32 - n));
+    };
+    auto block = [&](const uint8_t *p) {
+        uint32_t w[64];
+        for (int i = 0; i < 16; ++i) {
+            w[i] = (static_cast<uint32_t>(p[4 * i]) << 24) | (static_cast<uint32_t>(p[4 * i + 1]) << 16) |
+                   (static_cast<uint32_t>(p[4 * i + 2]) << 8) | static_cast<uint32_t>(p[4 * i + 3]);
+        }
+        for (int i = 16; i < 64; ++i) {
+            uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+        uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], k = h[7];
+        for (int i = 0; i < 64; ++i) {
+            uint32_t t1 = k + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + w[i];
+            uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+            k = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
+        h[5] += f;
+        h[6] += g;
+        h[7] += k;
+    };
+    size_t full = size / 64;
+    for (size_t i = 0; i < full; ++i)
+        block(data + 64 * i);
+    uint8_t tail[128] = {};
+    size_t rem = size - 64 * full;
+    if (rem > 0) std::memcpy(tail, data + 64 * full, rem);
+    tail[rem] = 0x80;
+    size_t tail_len = (rem < 56) ? 64 : 128;
+    uint64_t bits = static_cast<uint64_t>(size) * 8;
+    for (int i = 0; i < 8; ++i)
+        tail[tail_len - 1 - i] = static_cast<uint8_t>(bits >> (8 * i));
+    for (size_t off = 0; off < tail_len; off += 64)
+        block(tail + off);
+    std::array<uint8_t, 32> out{};
+    for (int i = 0; i < 8; ++i) {
+        out[4 * i] = static_cast<uint8_t>(h[i] >> 24);
+        out[4 * i + 1] = static_cast<uint8_t>(h[i] >> 16);
+        out[4 * i + 2] = static_cast<uint8_t>(h[i] >> 8);
+        out[4 * i + 3] = static_cast<uint8_t>(h[i]);
+    }
+    return out;
+}
+
+int bind_listener(const std::string &host, uint16_t *port_out) {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    addrinfo *results = nullptr;
+    int rc = ::getaddrinfo(host.c_str(), "0", &hints, &results);
+    if (rc != 0) {
+        throw std::runtime_error("RemoteL3SessionServer: getaddrinfo failed for " + host + ": " + gai_strerror(rc));
+    }
+    int fd = -1;
+    std::string last_error = "no address";
+    for (addrinfo *ai = results; ai != nullptr && fd < 0; ai = ai->ai_next) {
+        int candidate = ::socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (candidate < 0) {
+            last_error = std::strerror(errno);
+            continue;
+        }
+        int one = 1;
+        (void)::setsockopt(candidate, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (::bind(candidate, ai->ai_addr, ai->ai_addrlen) != 0 || ::listen(candidate, 1) != 0) {
+            last_error = std::strerror(errno);
+            ::close(candidate);
+            continue;
+        }
+        fd = candidate;
+    }
+    ::freeaddrinfo(results);
+    if (fd < 0) throw std::runtime_error("RemoteL3SessionServer: cannot listen on " + host + ": " + last_error);
+
+    sockaddr_storage addr{};
+    socklen_t len = sizeof(addr);
+    if (::getsockname(fd, reinterpret_cast<sockaddr *>(&addr), &len) != 0) {
+        std::string message = errno_message("RemoteL3SessionServer: getsockname failed");
+        ::close(fd);
+        throw std::runtime_error(message);
+    }
+    *port_out = addr.ss_family == AF_INET6 ? ntohs(reinterpret_cast<sockaddr_in6 *>(&addr)->sin6_port) :
+                                             ntohs(reinterpret_cast<sockaddr_in *>(&addr)->sin_port);
+    return fd;
+}
+
+// Wait up to `timeout_ms` for `fd` to become readable. Returns false on
+// timeout; throws on poll errors other than EINTR.
+bool wait_readable(int fd, int timeout_ms) {
+    pollfd pfd{};
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    int rc = ::poll(&pfd, 1, timeout_ms);
+    if (rc < 0) {
+        if (errno == EINTR) return false;
+        throw std::runtime_error(errno_message("RemoteL3SessionServer: poll failed"));
+    }
+    return rc > 0;
+}
+
+bool send_all(int fd, const uint8_t *data, size_t size) {
+    size_t off = 0;
+    while (off < size) {
+        ssize_t n = ::send(fd, data + off, size - off, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        off += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+void unmap(uint8_t *base, size_t bytes) {
+    if (base != nullptr) (void)::munmap(base, bytes);
+}
+
+}  // namespace
+
+size_t RemoteL3SessionServer::DigestHash::operator()(const Digest &d) const noexcept {
+    uint64_t v;
+    std::memcpy(&v, d.data(), sizeof(v));
+    return static_cast<size_t>(v);
+}
+
+RemoteL3SessionServer::RemoteL3SessionServer(ChipWorker *worker, RemoteL3SessionOptions options) :
+    worker_(worker),
+    options_(std::move(options)) {
+    if (options_.session_id == 0) throw std::invalid_argument("RemoteL3SessionServer: session_id must be non-zero");
+    if (options_.worker_id < 0) throw std::invalid_argument("RemoteL3SessionServer: worker_id must be non-negative");
+    if (options_.accept_timeout_s <= 0.0) {
+        throw std::invalid_argument("RemoteL3SessionServer: accept_timeout_s must be positive");
+    }
+    if (options_.health_interval_ms == 0) {
+        throw std::invalid_argument("RemoteL3SessionServer: health_interval_ms must be non-zero");
+    }
+}
+
+RemoteL3SessionServer::~RemoteL3SessionServer() {
+    stop();
+    if (health_thread_.joinable()) health_thread_.join();
+    if (command_listener_ >= 0) ::close(command_listener_);
+    if (health_listener_ >= 0) ::close(health_listener_);
+    release_session_state();
+}
+
+void RemoteL3SessionServer::listen() {
+    if (command_listener_ >= 0) throw std::runtime_error("RemoteL3SessionServer::listen: already listening");
+    command_listener_ = bind_listener(options_.listen_host, &command_port_);
+    health_listener_ = bind_listener(options_.listen_host, &health_port_);
+    health_thread_ = std::thread([this]() {
+        serve_health();
+    });
+}
+
+void RemoteL3SessionServer::bind(const Digest &digest, int32_t cid) {
+    if (cid < 0 || cid >= MAX_SERVER_CIDS) throw std::out_of_range("RemoteL3SessionServer::bind: cid out of range");
+    ChipEntry entry;
+    entry.cid = cid;
+    callables_[digest] = std::move(entry);
+}
+
+void RemoteL3SessionServer::stop() {
+    stop_.store(true, std::memory_order_release);
+    std::lock_guard<std::mutex> lk(fd_mu_);
+    if (command_fd_ >= 0) ::shutdown(command_fd_, SHUT_RDWR);
+}
+
+void RemoteL3SessionServer::serve_health() {
+    // Same cadence as the Python runner's _health_loop: accept once, send an
+    // empty HEALTH frame every interval, re-accept if the peer goes away.
+    int conn = -1;
+    uint64_t sequence = 0;
+    const int interval_ms = static_cast<int>(options_.health_interval_ms);
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (conn < 0) {
+            if (!wait_readable(health_listener_, interval_ms)) continue;
+            conn = ::accept(health_listener_, nullptr, nullptr);
+            continue;
+        }
+        remote_l3::FrameHeader header;
+        header.frame_type = remote_l3::FrameType::HEALTH;
+        header.session_id = options_.session_id;
+        header.worker_id = options_.worker_id;
+        header.sequence = ++sequence;
+        auto frame = remote_l3::encode_frame(header, {});
+        if (!send_all(conn, frame.data(), frame.size())) {
+            ::close(conn);
+            conn = -1;
+            continue;
+        }
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(interval_ms);
+        while (!stop_.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(std::min(interval_ms, 20)));
+        }
+    }
+    if (conn >= 0) ::close(conn);
+}
+
+void RemoteL3SessionServer::send_frame(
+    remote_l3::FrameType type, uint64_t sequence, const std::vector<uint8_t> &payload
+) {
+    remote_l3::FrameHeader header;
+    header.frame_type = type;
+    header.session_id = options_.session_id;
+    header.worker_id = options_.worker_id;
+    header.sequence = sequence;
+    auto frame = remote_l3::encode_frame(header, payload);
+    if (!send_all(command_fd_, frame.data(), frame.size())) {
+        throw std::runtime_error(errno_message("RemoteL3SessionServer: send failed"));
+    }
+}
+
+bool RemoteL3SessionServer::read_frame(std::vector<uint8_t> &frame) {
+    auto read_exact = [this](uint8_t *data, size_t size, bool allow_eof) -> bool {
+        size_t off = 0;
+        while (off < size) {
+            ssize_t n = ::recv(command_fd_, data + off, size - off, 0);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (stop_.load(std::memory_order_acquire)) return false;
+                throw std::runtime_error(errno_message("RemoteL3SessionServer: recv failed"));
+            }
+            if (n == 0) {
+                if (allow_eof && off == 0) return false;
+                if (stop_.load(std::memory_order_acquire)) return false;
+                throw std::runtime_error("RemoteL3SessionServer: socket closed mid-frame");
+            }
+            off += static_cast<size_t>(n);
+        }
+        return true;
+    };
+    frame.resize(FRAME_HEADER_BYTES);
+    if (!read_exact(frame.data(), FRAME_HEADER_BYTES, true)) return false;
+    uint32_t payload_bytes = static_cast<uint32_t>(frame[32]) | (static_cast<uint32_t>(frame[33]) << 8) |
+                             (static_cast<uint32_t>(frame[34]) << 16) | (static_cast<uint32_t>(frame[35]) << 24);
+    if (payload_bytes > remote_l3::MAX_FRAME_PAYLOAD_BYTES) {
+        throw std::runtime_error("remote_wire: frame payload exceeds maximum");
+    }
+    frame.resize(FRAME_HEADER_BYTES + payload_bytes);
+    if (payload_bytes == 0) return true;
+    return read_exact(frame.data() + FRAME_HEADER_BYTES, payload_bytes, false);
+}
+
+void RemoteL3SessionServer::serve() {
+    if (command_listener_ < 0) throw std::runtime_error("RemoteL3SessionServer::serve: listen() was not called");
+
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double>(options_.accept_timeout_s)
+                    );
+    int fd = -1;
+    while (fd < 0) {
+        if (stop_.load(std::memory_order_acquire)) return;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            throw std::runtime_error("RemoteL3SessionServer: command attach timed out");
+        }
+        if (!wait_readable(command_listener_, 50)) continue;
+        fd = ::accept(command_listener_, nullptr, nullptr);
+        if (fd < 0 && errno != EINTR && errno != ECONNABORTED) {
+            throw std::runtime_error(errno_message("RemoteL3SessionServer: accept failed"));
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lk(fd_mu_);
+        command_fd_ = fd;
+        if (stop_.load(std::memory_order_acquire)) ::shutdown(command_fd_, SHUT_RDWR);
+    }
+    struct CloseCommand {
+        RemoteL3SessionServer &server;
+        ~CloseCommand() {
+            std::lock_guard<std::mutex> lk(server.fd_mu_);
+            ::close(server.command_fd_);
+            server.command_fd_ = -1;
+        }
+    } close_command{*this};
+    struct ReleaseState {
+        RemoteL3SessionServer &server;
+        ~ReleaseState() { server.release_session_state(); }
+    } release_state{*this};
+
+    remote_l3::HelloPayload hello;
+    hello.session_id = options_.session_id;
+    hello.worker_id = options_.worker_id;
+    hello.comm_profile = options_.comm_profile;
+    hello.feature_flags = remote_l3::HELLO_FEATURE_HELD_CHIP_BLOB;
+    hello.ready_state = remote_l3::ReadyState::READY;
+    send_frame(remote_l3::FrameType::HELLO, 0, remote_l3::encode_hello(hello));
+
+    std::vector<uint8_t> bytes;
+    while (read_frame(bytes)) {
+        remote_l3::DecodedFrame frame = remote_l3::decode_frame(bytes);
+        const remote_l3::FrameHeader &header = frame.header;
+        if (header.session_id != options_.session_id || header.worker_id != options_.worker_id) {
+            throw std::runtime_error("remote session received mismatched session or worker frame");
+        }
+        switch (header.frame_type) {
+        case remote_l3::FrameType::SHUTDOWN:
+            return;
+        case remote_l3::FrameType::CONTROL:
+            serve_control(frame);
+            break;
+        case remote_l3::FrameType::TASK:
+            serve_task(frame);
+            break;
+        default: {
+            remote_l3::CompletionPayload completion;
+            completion.sequence = header.sequence;
+            completion.error_code = REMOTE_ERROR;
+            completion.error_message =
+                "unsupported remote frame type " + std::to_string(static_cast<uint32_t>(header.frame_type));
+            send_frame(remote_l3::FrameType::COMPLETION, header.sequence, remote_l3::encode_completion(completion));
+            break;
+        }
+        }
+    }
+}
+
+void RemoteL3SessionServer::serve_task(const remote_l3::DecodedFrame &frame) {
+    remote_l3::CompletionPayload completion;
+    completion.sequence = frame.header.sequence;
+    stats_.tasks++;
+    try {
+        remote_l3::TaskPayloadWire task = remote_l3::decode_task_payload(frame.payload.data(), frame.payload.size());
+        auto it = callables_.find(task.callable_digest);
+        if (it == callables_.end()) {
+            throw std::runtime_error(
+                "remote TASK dispatcher has no callable hashid " +
+                hex(task.callable_digest.data(), CALLABLE_HASH_DIGEST_SIZE)
+            );
+        }
+        if (worker_ == nullptr) throw std::runtime_error("remote session has no ChipWorker attached");
+
+        // Materialize every tensor in place: HOST_INLINE points into the
+        // decoded inline arena, buffers and imports into their shm mappings.
+        const remote_l3::RemoteTaskArgsWire &wire = task.args;
+        ChipStorageTaskArgs args;
+        for (size_t i = 0; i < wire.tensor_metadata.size(); ++i) {
+            Tensor tensor = wire.tensor_metadata[i];
+            const RemoteTensorSidecar &sidecar = wire.remote_desc[i];
+            if (sidecar.present) {
+                const RemoteTensorDesc &desc = sidecar.desc;
+                if (desc.nbytes != tensor.nbytes()) {
+                    throw std::runtime_error("remote TASK descriptor nbytes does not match tensor metadata");
+                }
+                uint8_t *addr = nullptr;
+                if (desc.address_space == RemoteAddressSpace::HOST_INLINE) {
+                    addr = const_cast<uint8_t *>(wire.inline_payload.data()) + desc.inline_payload_offset;
+                } else {
+                    const Buffer *buffer = nullptr;
+                    if (desc.owner_worker_id == options_.worker_id &&
+                        desc.address_space == RemoteAddressSpace::REMOTE_DEVICE) {
+                        auto found = buffers_.find({desc.buffer_id, desc.generation});
+                        if (found != buffers_.end()) buffer = &found->second;
+                    } else if (desc.address_space == RemoteAddressSpace::REMOTE_WINDOW ||
+                               desc.address_space == RemoteAddressSpace::UB_LDST) {
+                        auto found =
+                            imports_.find({desc.owner_worker_id, desc.buffer_id, desc.generation, desc.rkey_or_token});
+                        if (found != imports_.end()) buffer = &found->second;
+                    } else {
+                        throw std::runtime_error(
+                            "remote TASK descriptor names a different worker without an imported buffer handle"
+                        );
+                    }
+                    if (buffer == nullptr) {
+                        throw std::runtime_error(
+                            "remote TASK descriptor names an unknown or stale buffer/import generation"
+                        );
+                    }
+                    if (desc.offset < buffer->offset ||
+                        !range_fits(desc.offset - buffer->offset, desc.nbytes, buffer->nbytes)) {
+                        throw std::runtime_error("remote TASK descriptor range exceeds buffer/import");
+                    }
+                    addr = buffer->base + (desc.offset - buffer->offset);
+                }
+                tensor.buffer.addr = reinterpret_cast<uint64_t>(addr);
+            } else if (tensor.nbytes() != 0) {
+                throw std::runtime_error("remote TASK tensor payload requires a RemoteTensorRef sidecar");
+            }
+            args.add_tensor(tensor);
+        }
+        for (uint64_t scalar : wire.scalars)
+            args.add_scalar(scalar);
+        worker_->run(it->second.cid, &args, task.config);
+    } catch (const std::exception &e) {
+        stats_.failed_tasks++;
+        size_t digest_bytes = std::min(frame.payload.size(), CALLABLE_HASH_DIGEST_SIZE);
+        completion.error_code = REMOTE_ERROR;
+        completion.error_message = clip_error(
+            "remote worker_id=" + std::to_string(options_.worker_id) +
+            " hashid=" + hex(frame.payload.data(), digest_bytes) +
+            " sequence=" + std::to_string(frame.header.sequence) + ": " + e.what()
+        );
+    }
+    send_frame(remote_l3::FrameType::COMPLETION, frame.header.sequence, remote_l3::encode_completion(completion));
+}
+
+void RemoteL3SessionServer::serve_control(const remote_l3::DecodedFrame &frame) {
+    remote_l3::ControlReplyPayload reply;
+    reply.sequence = frame.header.sequence;
+    stats_.controls++;
+    try {
+        remote_l3::ControlPayload control = remote_l3::decode_control(frame.payload.data(), frame.payload.size());
+        reply.control_name = control.control_name;
+        reply.control_version = control.control_version;
+        if (is_reserved_domain_control(control.control_name)) {
+            // Answered like the Python runner: a plain error, not a failure.
+            reply.error_code = REMOTE_ERROR;
+            reply.error_message =
+                std::string("unsupported reserved remote domain control ") + control_name_str(control.control_name);
+        } else {
+            reply.result_bytes = run_control(control);
+        }
+    } catch (const std::exception &e) {
+        // An undecodable control is answered as PREPARE_CALLABLE v1, like the Python runner.
+        stats_.failed_controls++;
+        reply.error_code =
+            dynamic_cast<const BlobNotHeld *>(&e) != nullptr ? remote_l3::CONTROL_ERROR_BLOB_NOT_HELD : REMOTE_ERROR;
+        reply.error_message = clip_error(
+            "remote worker_id=" + std::to_string(options_.worker_id) +
+            " control sequence=" + std::to_string(frame.header.sequence) + ": " + e.what()
+        );
+        reply.result_bytes.clear();
+    }
+    send_frame(remote_l3::FrameType::CONTROL_REPLY, frame.header.sequence, remote_l3::encode_control_reply(reply));
+}
+
+std::vector<uint8_t> RemoteL3SessionServer::run_control(const remote_l3::ControlPayload &control) {
+    using remote_l3::ControlName;
+    const std::vector<uint8_t> &command = control.command_bytes;
+    switch (control.control_name) {
+    case ControlName::PREPARE_REGISTER_CALLABLE:
+        prepare_register(command);
+        return {};
+    case ControlName::COMMIT_REGISTER_CALLABLE:
+        commit_register(command);
+        return {};
+    case ControlName::ABORT_REGISTER_CALLABLE: {
+        auto cmd = remote_l3::decode_digest_callable_command(command.data(), command.size());
+        prepared_.erase({cmd.target_registry, cmd.digest});
+        return {};
+    }
+    case ControlName::UNREGISTER_CALLABLE:
+        unregister(command);
+        return {};
+    case ControlName::PREPARE_CALLABLE: {
+        // RemoteL3Endpoint always names the dispatcher/PYTHON_IMPORT pair
+        // here; only the digest selects the callable.
+        auto cmd = remote_l3::decode_digest_callable_command(command.data(), command.size());
+        if (cmd.target_registry != remote_l3::RemoteRegistryTarget::REMOTE_TASK_DISPATCHER ||
+            cmd.callable_kind != CallableKind::PYTHON_IMPORT) {
+            throw std::runtime_error("PREPARE_CALLABLE target/kind mismatch");
+        }
+        if (callables_.find(cmd.digest) == callables_.end()) {
+            throw std::runtime_error("PREPARE_CALLABLE digest is not committed in dispatcher registry");
+        }
+        return {};
+    }
+    case ControlName::ALLOC_REMOTE_BUFFER:
+        return alloc_buffer(command);
+    case ControlName::FREE_REMOTE_BUFFER:
+        free_buffer(command);
+        return {};
+    case ControlName::COPY_TO_REMOTE:
+        copy_to_buffer(command);
+        return {};
+    case ControlName::COPY_FROM_REMOTE:
+        return copy_from_buffer(command);
+    case ControlName::EXPORT_BUFFER:
+        return export_buffer(command);
+    case ControlName::IMPORT_BUFFER:
+        return import_buffer(command);
+    case ControlName::RELEASE_IMPORT:
+        release_import(command);
+        return {};
+    case ControlName::COMM_INIT:
+    case ControlName::ALLOC_DOMAIN:
+    case ControlName::RELEASE_DOMAIN:
+        break;  // answered by serve_control
+    }
+    throw std::runtime_error(std::string("unsupported remote control ") + control_name_str(control.control_name));
+}
+
+// ---------------------------------------------------------------------------
+// Buffers
+// ---------------------------------------------------------------------------
+
+std::vector<uint8_t> RemoteL3SessionServer::alloc_buffer(const std::vector<uint8_t> &command) {
+    if (command.size() != 8) throw std::runtime_error("ALLOC_REMOTE_BUFFER payload must be uint64 nbytes");
+    size_t offset = 0;
+    uint64_t nbytes = get_u64(command, offset);
+    if (nbytes == 0) throw std::runtime_error("ALLOC_REMOTE_BUFFER nbytes must be non-zero");
+
+    uint64_t buffer_id = next_buffer_id_;
+    std::string name = "simpler_l3_" + std::to_string(::getpid()) + "_" + std::to_string(options_.session_id) + "_" +
+                       std::to_string(buffer_id);
+    std::string path = "/" + name;
+    int fd = ::shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) throw std::runtime_error(errno_message("ALLOC_REMOTE_BUFFER shm_open failed"));
+    if (::ftruncate(fd, static_cast<off_t>(nbytes)) != 0) {
+        std::string message = errno_message("ALLOC_REMOTE_BUFFER ftruncate failed");
+        ::close(fd);
+        ::shm_unlink(path.c_str());
+        throw std::runtime_error(message);
+    }
+    void *base = ::mmap(nullptr, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        ::shm_unlink(path.c_str());
+        throw std::runtime_error(errno_message("ALLOC_REMOTE_BUFFER mmap failed"));
+    }
+    next_buffer_id_++;
+
+    Buffer buffer;
+    buffer.base = static_cast<uint8_t *>(base);
+    buffer.mapped_bytes = nbytes;
+    buffer.nbytes = nbytes;
+    buffer.shm_name = name;
+    buffer.owned = true;
+    const uint64_t generation = 1;
+    buffers_[{buffer_id, generation}] = buffer;
+
+    std::vector<uint8_t> result;
+    put_i32(result, options_.worker_id);
+    put_u64(result, buffer_id);
+    put_u64(result, generation);
+    put_i32(result, static_cast<int32_t>(RemoteAddressSpace::REMOTE_DEVICE));
+    put_u64(result, nbytes);
+    put_u64(result, reinterpret_cast<uint64_t>(base));
+    put_u64(result, 0);
+    put_u64(result, 0);
+    return result;
+}
+
+RemoteL3SessionServer::Buffer &
+RemoteL3SessionServer::owned_buffer(const char *op_name, uint64_t buffer_id, uint64_t generation) {
+    auto it = buffers_.find({buffer_id, generation});
+    if (it == buffers_.end()) throw std::runtime_error(std::string(op_name) + " names unknown buffer");
+    return it->second;
+}
+
+void RemoteL3SessionServer::free_buffer(const std::vector<uint8_t> &command) {
+    if (command.size() != 20) {
+        throw std::runtime_error("FREE_REMOTE_BUFFER payload must be worker_id, buffer_id, generation");
+    }
+    size_t offset = 0;
+    int32_t owner = static_cast<int32_t>(get_u32(command, offset));
+    uint64_t buffer_id = get_u64(command, offset);
+    uint64_t generation = get_u64(command, offset);
+    if (owner != options_.worker_id) throw std::runtime_error("FREE_REMOTE_BUFFER worker mismatch");
+    auto it = buffers_.find({buffer_id, generation});
+    if (it == buffers_.end()) return;  // idempotent, as in the Python runner
+    unmap(it->second.base, it->second.mapped_bytes);
+    ::shm_unlink(("/" + it->second.shm_name).c_str());
+    buffers_.erase(it);
+}
+
+void RemoteL3SessionServer::copy_to_buffer(const std::vector<uint8_t> &command) {
+    CopyCommandHeader h = decode_copy_command_header(command);
+    if (h.worker_id != options_.worker_id) throw std::runtime_error("COPY_TO_REMOTE worker mismatch");
+    Buffer &buffer = owned_buffer("COPY_TO_REMOTE", h.buffer_id, h.generation);
+    if (command.size() - COPY_COMMAND_HEADER_BYTES != h.size) {
+        throw std::runtime_error("COPY_TO_REMOTE payload size mismatch");
+    }
+    if (!range_fits(h.offset, h.size, buffer.nbytes)) throw std::runtime_error("COPY_TO_REMOTE range exceeds buffer");
+    if (h.size > 0) std::memcpy(buffer.base + h.offset, command.data() + COPY_COMMAND_HEADER_BYTES, h.size);
+}
+
+std::vector<uint8_t> RemoteL3SessionServer::copy_from_buffer(const std::vector<uint8_t> &command) {
+    CopyCommandHeader h = decode_copy_command_header(command);
+    if (command.size() != COPY_COMMAND_HEADER_BYTES) {
+        throw std::runtime_error("COPY_FROM_REMOTE request must not carry data bytes");
+    }
+    if (h.worker_id != options_.worker_id) throw std::runtime_error("COPY_FROM_REMOTE worker mismatch");
+    Buffer &buffer = owned_buffer("COPY_FROM_REMOTE", h.buffer_id, h.generation);
+    if (!range_fits(h.offset, h.size, buffer.nbytes)) {
+        throw std::runtime_error("COPY_FROM_REMOTE range exceeds buffer");
+    }
+    return std::vector<uint8_t>(buffer.base + h.offset, buffer.base + h.offset + h.size);
+}
+
+std::vector<uint8_t> RemoteL3SessionServer::export_buffer(const std::vector<uint8_t> &command) {
+    auto request = remote_l3::decode_export_buffer_request(command.data(), command.size());
+    if (request.owner_worker_id != options_.worker_id) throw std::runtime_error("EXPORT_BUFFER worker mismatch");
+    Buffer &buffer = owned_buffer("EXPORT_BUFFER", request.buffer_id, request.generation);
+    if (!range_fits(request.offset, request.nbytes, buffer.nbytes)) {
+        throw std::runtime_error("EXPORT_BUFFER range exceeds buffer");
+    }
+    if (!request.transport_profile.empty() && request.transport_profile != "sim") {
+        throw std::runtime_error("EXPORT_BUFFER transport_profile is not supported by sim");
+    }
+    uint64_t export_id = next_export_id_++;
+    RemoteBufferExport result;
+    result.owner_worker_id = options_.worker_id;
+    result.buffer_id = request.buffer_id;
+    result.generation = request.generation;
+    result.address_space = RemoteAddressSpace::REMOTE_WINDOW;
+    result.offset = request.offset;
+    result.nbytes = request.nbytes;
+    result.export_id = export_id;
+    result.remote_addr = reinterpret_cast<uint64_t>(buffer.base) + request.offset;
+    result.rkey_or_token = export_id;
+    result.access_flags = request.access_flags;
+    result.transport_profile = "sim";
+    result.transport_descriptor.assign(buffer.shm_name.begin(), buffer.shm_name.end());
+    return remote_l3::encode_export_buffer_result(result);
+}
+
+std::vector<uint8_t> RemoteL3SessionServer::import_buffer(const std::vector<uint8_t> &command) {
+    auto request = remote_l3::decode_import_buffer_request(command.data(), command.size());
+    if (request.importer_worker_id != options_.worker_id) throw std::runtime_error("IMPORT_BUFFER worker mismatch");
+    const RemoteBufferExport &desc = request.export_desc;
+    if (desc.transport_profile != "sim") {
+        throw std::runtime_error("IMPORT_BUFFER transport_profile is not supported by sim");
+    }
+    std::string name(desc.transport_descriptor.begin(), desc.transport_descriptor.end());
+    std::string path = "/" + name;
+    int fd = ::shm_open(path.c_str(), O_RDWR, 0);
+    if (fd < 0) throw std::runtime_error(errno_message("IMPORT_BUFFER shm_open(" + name + ") failed"));
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        std::string message = errno_message("IMPORT_BUFFER fstat failed");
+        ::close(fd);
+        throw std::runtime_error(message);
+    }
+    size_t mapped = static_cast<size_t>(st.st_size);
+    if (!range_fits(desc.offset, desc.nbytes, mapped)) {
+        ::close(fd);
+        throw std::runtime_error("IMPORT_BUFFER export range exceeds the shared buffer");
+    }
+    void *base = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) throw std::runtime_error(errno_message("IMPORT_BUFFER mmap failed"));
+
+    uint64_t import_id = next_import_id_++;
+    Buffer buffer;
+    buffer.base = static_cast<uint8_t *>(base);
+    buffer.mapped_bytes = mapped;
+    buffer.nbytes = desc.nbytes;
+    buffer.offset = desc.offset;
+    buffer.shm_name = name;
+    imports_[{desc.owner_worker_id, desc.buffer_id, desc.generation, import_id}] = buffer;
+
+    RemoteBufferHandle result;
+    result.worker_id = options_.worker_id;
+    result.owner_worker_id = desc.owner_worker_id;
+    result.buffer_id = desc.buffer_id;
+    result.generation = desc.generation;
+    result.import_id = import_id;
+    result.address_space = desc.address_space;
+    result.offset = desc.offset;
+    result.nbytes = desc.nbytes;
+    result.remote_addr = reinterpret_cast<uint64_t>(base);
+    result.rkey_or_token = import_id;
+    result.ub_ldst_va = desc.ub_ldst_va;
+    result.access_flags = request.requested_access_flags;
+    result.transport_profile = "sim";
+    return remote_l3::encode_import_buffer_result(result);
+}
+
+void RemoteL3SessionServer::release_import(const std::vector<uint8_t> &command) {
+    auto request = remote_l3::decode_release_import_request(command.data(), command.size());
+    if (request.importer_worker_id != options_.worker_id) throw std::runtime_error("RELEASE_IMPORT worker mismatch");
+    auto it = imports_.find({request.owner_worker_id, request.buffer_id, request.generation, request.import_id});
+    if (it == imports_.end()) throw std::runtime_error("RELEASE_IMPORT names unknown import");
+    unmap(it->second.base, it->second.mapped_bytes);
+    imports_.erase(it);
+}
+
+// ---------------------------------------------------------------------------
+// Callable registry
+// ---------------------------------------------------------------------------
+
+void RemoteL3SessionServer::prepare_register(const std::vector<uint8_t> &command) {
+    auto cmd = remote_l3::decode_register_callable_command(command.data(), command.size());
+    if (cmd.callable_kind == CallableKind::PYTHON_SERIALIZED) {
+        throw std::runtime_error("PYTHON_SERIALIZED is not negotiated for remote protocol v1");
+    }
+    if (cmd.callable_kind != CallableKind::CHIP_CALLABLE) {
+        throw std::runtime_error(
+            "native remote session hosts CHIP_CALLABLE only; PYTHON_IMPORT needs the Python runner"
+        );
+    }
+    if (cmd.payload_version != 1) throw std::runtime_error("CHIP_CALLABLE payload_version must be 1");
+    auto payload = remote_l3::decode_remote_chip_callable_payload(cmd.payload.data(), cmd.payload.size());
+    if (payload.blob_location == remote_l3::ChipCallableBlobLocation::HELD_BLOB) {
+        // Re-register of a callable this session already runs: no bytes on
+        // the wire, and commit is a no-op while the digest stays installed.
+        // Bound (manifest) entries carry no blob, so only owned ones are
+        // checked against the announced blob.
+        auto it = callables_.find(cmd.digest);
+        if (it == callables_.end()) {
+            throw BlobNotHeld(
+                "CHIP_CALLABLE HELD_BLOB names a callable this session does not hold; resend INLINE_BLOB"
+            );
+        }
+        if (it->second.server_owned &&
+            (it->second.blob.size() != payload.blob_size || it->second.blob_sha256 != payload.blob_sha256)) {
+            throw std::runtime_error("CHIP_CALLABLE HELD_BLOB does not match the held executable blob");
+        }
+        prepared_[{cmd.target_registry, cmd.digest}] = PreparedBlob{{}, payload.blob_sha256};
+        return;
+    }
+    if (payload.blob_location != remote_l3::ChipCallableBlobLocation::INLINE_BLOB) {
+        throw std::runtime_error("CHIP_CALLABLE STAGED_BLOB is unsupported without a negotiated staged-blob adapter");
+    }
+    if (sha256(payload.inline_blob.data(), payload.inline_blob.size()) != payload.blob_sha256) {
+        throw std::runtime_error("CHIP_CALLABLE executable blob SHA-256 mismatch");
+    }
+    prepared_[{cmd.target_registry, cmd.digest}] = PreparedBlob{std::move(payload.inline_blob), payload.blob_sha256};
+}
+
+int32_t RemoteL3SessionServer::allocate_cid() const {
+    uint64_t used = 0;
+    for (const auto &kv : callables_)
+        used |= 1ULL << kv.second.cid;
+    for (int32_t cid = 0; cid < MAX_SERVER_CIDS; ++cid) {
+        if ((used & (1ULL << cid)) == 0) return cid;
+    }
+    throw std::runtime_error("COMMIT_REGISTER_CALLABLE: no free callable slot on the ChipWorker");
+}
+
+void RemoteL3SessionServer::commit_register(const std::vector<uint8_t> &command) {
+    auto cmd = remote_l3::decode_digest_callable_command(command.data(), command.size());
+    auto it = prepared_.find({cmd.target_registry, cmd.digest});
+    if (cmd.callable_kind != CallableKind::CHIP_CALLABLE || it == prepared_.end()) {
+        throw std::runtime_error("COMMIT_REGISTER_CALLABLE digest was not prepared");
+    }
+    if (worker_ == nullptr) throw std::runtime_error("remote session has no ChipWorker attached");
+    if (callables_.find(cmd.digest) != callables_.end()) {
+        prepared_.erase(it);  // same digest, same blob: already installed
+        return;
+    }
+    if (it->second.blob.empty()) {
+        prepared_.erase(it);
+        throw std::runtime_error("COMMIT_REGISTER_CALLABLE held callable was unregistered before commit");
+    }
+    ChipEntry entry;
+    entry.cid = allocate_cid();
+    entry.server_owned = true;
+    entry.blob = std::move(it->second.blob);
+    entry.blob_sha256 = it->second.blob_sha256;
+    prepared_.erase(it);
+    worker_->prepare_callable(entry.cid, entry.blob.data());
+    callables_[cmd.digest] = std::move(entry);
+}
+
+void RemoteL3SessionServer::unregister(const std::vector<uint8_t> &command) {
+    auto cmd = remote_l3::decode_digest_callable_command(command.data(), command.size());
+    prepared_.erase({cmd.target_registry, cmd.digest});
+    auto it = callables_.find(cmd.digest);
+    if (it == callables_.end() || !it->second.server_owned) return;
+    int32_t cid = it->second.cid;
+    callables_.erase(it);
+    if (worker_ != nullptr) worker_->unregister_callable(cid);
+}
+
+void RemoteL3SessionServer::release_session_state() {
+    for (auto &kv : buffers_) {
+        unmap(kv.second.base, kv.second.mapped_bytes);
+        ::shm_unlink(("/" + kv.second.shm_name).c_str());
+    }
+    buffers_.clear();
+    for (auto &kv : imports_)
+        unmap(kv.second.base, kv.second.mapped_bytes);
+    imports_.clear();
+    prepared_.clear();
+    for (auto it = callables_.begin(); it != callables_.end();) {
+        if (it->second.server_owned) {
+            if (worker_ != nullptr) {
+                try {
+                    worker_->unregister_callable(it->second.cid);
+                } catch (...) {}
+            }
+            it = callables_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
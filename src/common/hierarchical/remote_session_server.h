@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * RemoteL3SessionServer — native remote side of a Remote L3 session.
+ *
+ * `simpler.remote_l3_session` serves the command lane in Python: every frame
+ * goes through the struct-based codec in remote_l3_protocol.py, and buffer
+ * copies run under the GIL. This class is the same command lane in C++, on
+ * top of the remote_wire codec the client (RemoteL3Endpoint) already uses,
+ * with a `ChipWorker` hosted directly:
+ *
+ *   - HELLO READY on attach, HEALTH frames on a second listener, SHUTDOWN
+ *     or EOF ends the session — the lifecycle `RemoteL3SocketTransport`
+ *     expects from the Python runner.
+ *   - ALLOC / FREE / COPY_TO / COPY_FROM / EXPORT / IMPORT / RELEASE_IMPORT
+ *     are served natively over POSIX shared memory, with the same result
+ *     layouts and the same `sim` export descriptor (the shm name without
+ *     its leading slash), so buffers interoperate with Python sessions.
+ *   - CHIP_CALLABLE registration (INLINE_BLOB, SHA-256 checked, or
+ *     HELD_BLOB for a digest the session already runs) goes straight onto
+ *     the ChipWorker; a TASK whose digest names a committed
+ *     chip callable runs it there. There is no Python in the process, so
+ *     PYTHON_IMPORT / PYTHON_SERIALIZED registrations are answered with a
+ *     CONTROL_REPLY error, as is every control the Python runner rejects.
+ *
+ * Errors never break framing: a failed control or task is a reply with
+ * error_code 1, exactly like the Python runner. A frame for the wrong
+ * session or worker ends the session.
+ *
+ * Threading: listen() / serve() / bind() run on the owning thread (the
+ * binding releases the GIL for serve()); stop() may be called from any
+ * thread to unblock serve().
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "remote_wire.h"
+#include "types.h"
+
+class ChipWorker;
+
+struct RemoteL3SessionOptions {
+    uint64_t session_id{0};
+    int32_t worker_id{-1};
+    std::string comm_profile{"sim"};  // reported in HELLO
+    std::string listen_host{"127.0.0.1"};
+    double accept_timeout_s{30.0};  // bound on the post-ready command attach
+    uint32_t health_interval_ms{200};
+};
+
+struct RemoteL3SessionStats {
+    uint64_t tasks{0};
+    uint64_t controls{0};
+    uint64_t failed_tasks{0};
+    uint64_t failed_controls{0};
+};
+
+class RemoteL3SessionServer {
+public:
+    using Digest = std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE>;
+
+    // `worker` may be null: buffer controls still work, TASK and
+    // CHIP_CALLABLE commits fail with a reply error.
+    RemoteL3SessionServer(ChipWorker *worker, RemoteL3SessionOptions options);
+    ~RemoteL3SessionServer();
+
+    RemoteL3SessionServer(const RemoteL3SessionServer &) = delete;
+    RemoteL3SessionServer &operator=(const RemoteL3SessionServer &) = delete;
+
+    // Bind the command and health listeners on ephemeral ports.
+    void listen();
+    uint16_t command_port() const { return command_port_; }
+    uint16_t health_port() const { return health_port_; }
+
+    // Make `digest` dispatchable as the owner's already-prepared `cid`
+    // (manifest preload). The server never unregisters bound cids.
+    void bind(const Digest &digest, int32_t cid);
+
+    // Accept the command connection, send HELLO READY, and serve frames
+    // until SHUTDOWN, EOF or stop(). Buffers and server-registered
+    // callables are released before returning.
+    void serve();
+
+    // Unblock serve() and stop the health lane. Safe from any thread.
+    void stop();
+
+    const RemoteL3SessionStats &stats() const { return stats_; }
+
+private:
+    struct DigestHash {
+        size_t operator()(const Digest &d) const noexcept;
+    };
+
+    struct Buffer {
+        uint8_t *base{nullptr};  // start of the shm mapping
+        size_t mapped_bytes{0};
+        uint64_t nbytes{0};
+        uint64_t offset{0};  // export offset for imports, 0 for owned buffers
+        std::string shm_name;  // without the leading slash
+        bool owned{false};
+    };
+
+    struct ChipEntry {
+        int32_t cid{-1};
+        bool server_owned{false};
+        std::vector<uint8_t> blob;  // kept alive while prepared
+        Digest blob_sha256{};       // checked by HELD_BLOB re-registers
+    };
+
+    struct PreparedBlob {
+        std::vector<uint8_t> blob;  // empty for HELD_BLOB
+        Digest blob_sha256{};
+    };
+
+    using BufferKey = std::pair<uint64_t, uint64_t>;                       // (buffer_id, generation)
+    using ImportKey = std::tuple<int32_t, uint64_t, uint64_t, uint64_t>;  // (owner, buffer_id, generation, import_id)
+
+    void serve_health();
+    void send_frame(remote_l3::FrameType type, uint64_t sequence, const std::vector<uint8_t> &payload);
+    bool read_frame(std::vector<uint8_t> &frame);
+
+    void serve_task(const remote_l3::DecodedFrame &frame);
+    void serve_control(const remote_l3::DecodedFrame &frame);
+    std::vector<uint8_t> run_control(const remote_l3::ControlPayload &control);
+
+    std::vector<uint8_t> alloc_buffer(const std::vector<uint8_t> &command);
+    void free_buffer(const std::vector<uint8_t> &command);
+    void copy_to_buffer(const std::vector<uint8_t> &command);
+    std::vector<uint8_t> copy_from_buffer(const std::vector<uint8_t> &command);
+    std::vector<uint8_t> export_buffer(const std::vector<uint8_t> &command);
+    std::vector<uint8_t> import_buffer(const std::vector<uint8_t> &command);
+    void release_import(const std::vector<uint8_t> &command);
+    Buffer &owned_buffer(const char *op_name, uint64_t buffer_id, uint64_t generation);
+
+    void prepare_register(const std::vector<uint8_t> &command);
+    void commit_register(const std::vector<uint8_t> &command);
+    void unregister(const std::vector<uint8_t> &command);
+    int32_t allocate_cid() const;
+
+    void release_session_state();
+
+    ChipWorker *worker_;
+    RemoteL3SessionOptions options_;
+    RemoteL3SessionStats stats_;
+
+    int command_listener_{-1};
+    int health_listener_{-1};
+    int command_fd_{-1};
+    uint16_t command_port_{0};
+    uint16_t health_port_{0};
+    std::atomic<bool> stop_{false};
+    std::thread health_thread_;
+    std::mutex fd_mu_;  // guards command_fd_ against stop()
+
+    std::map<BufferKey, Buffer> buffers_;
+    std::map<ImportKey, Buffer> imports_;
+    uint64_t next_buffer_id_{1};
+    uint64_t next_export_id_{1};
+    uint64_t next_import_id_{1};
+
+    std::map<std::pair<remote_l3::RemoteRegistryTarget, Digest>, PreparedBlob> prepared_;
+    std::unordered_map<Digest, ChipEntry, DigestHash> callables_;
+};
@@ -594,6 +594,103 @@ std::vector<uint8_t> encode_digest_callable_command(
     return out;
 }
 
+RegisterCallableCommand decode_register_callable_command(const uint8_t *data, size_t size) {
+    size_t offset = 0;
+    RegisterCallableCommand command;
+    uint32_t raw_target = get_u32(data, size, offset);
+    ensure(valid_remote_registry_target(raw_target), "remote_wire: unknown registry target");
+    command.target_registry = static_cast<RemoteRegistryTarget>(raw_target);
+    uint32_t raw_kind = get_u32(data, size, offset);
+    ensure(valid_callable_kind(raw_kind), "remote_wire: unknown callable kind");
+    command.callable_kind = static_cast<CallableKind>(static_cast<int32_t>(raw_kind));
+    ensure_available(size, offset, CALLABLE_HASH_DIGEST_SIZE, "callable digest");
+    std::memcpy(command.digest.data(), data + offset, CALLABLE_HASH_DIGEST_SIZE);
+    offset += CALLABLE_HASH_DIGEST_SIZE;
+    command.payload_version = get_u32(data, size, offset);
+    ensure(command.payload_version != 0, "remote_wire: callable payload version must be non-zero");
+    uint32_t payload_len = get_u32(data, size, offset);
+    ensure(payload_len <= MAX_FRAME_PAYLOAD_BYTES, "remote_wire: callable payload too large");
+    ensure_available(size, offset, payload_len, "callable payload");
+    command.payload.assign(data + offset, data + offset + payload_len);
+    offset += payload_len;
+    ensure(offset == size, "remote_wire: trailing bytes after register callable command");
+    return command;
+}
+
+DigestCallableCommand decode_digest_callable_command(const uint8_t *data, size_t size) {
+    size_t offset = 0;
+    DigestCallableCommand command;
+    uint32_t raw_target = get_u32(data, size, offset);
+    ensure(valid_remote_registry_target(raw_target), "remote_wire: unknown registry target");
+    command.target_registry = static_cast<RemoteRegistryTarget>(raw_target);
+    uint32_t raw_kind = get_u32(data, size, offset);
+    ensure(valid_callable_kind(raw_kind), "remote_wire: unknown callable kind");
+    command.callable_kind = static_cast<CallableKind>(static_cast<int32_t>(raw_kind));
+    ensure_available(size, offset, CALLABLE_HASH_DIGEST_SIZE, "callable digest");
+    std::memcpy(command.digest.data(), data + offset, CALLABLE_HASH_DIGEST_SIZE);
+    offset += CALLABLE_HASH_DIGEST_SIZE;
+    ensure(offset == size, "remote_wire: trailing bytes after digest callable command");
+    return command;
+}
+
+std::vector<uint8_t> encode_remote_chip_callable_payload(const RemoteChipCallablePayload &payload) {
+    ensure(payload.blob_size != 0, "remote_wire: CHIP_CALLABLE blob_size must be non-zero");
+    if (payload.blob_location == ChipCallableBlobLocation::INLINE_BLOB) {
+        ensure(
+            payload.inline_blob.size() == payload.blob_size && payload.staged_blob_token.empty(),
+            "remote_wire: CHIP_CALLABLE inline payload fields are inconsistent"
+        );
+    } else if (payload.blob_location == ChipCallableBlobLocation::STAGED_BLOB) {
+        ensure(
+            payload.inline_blob.empty() && !payload.staged_blob_token.empty(),
+            "remote_wire: CHIP_CALLABLE staged payload fields are inconsistent"
+        );
+    } else if (payload.blob_location == ChipCallableBlobLocation::HELD_BLOB) {
+        ensure(
+            payload.inline_blob.empty() && payload.staged_blob_token.empty(),
+            "remote_wire: CHIP_CALLABLE held payload fields are inconsistent"
+        );
+    } else {
+        throw std::runtime_error("remote_wire: unknown CHIP_CALLABLE blob location");
+    }
+    std::vector<uint8_t> out;
+    put_blob(out, payload.descriptor_bytes, MAX_CHIP_CALLABLE_DESCRIPTOR_BYTES, "CHIP_CALLABLE.descriptor_bytes");
+    put_u32(out, static_cast<uint32_t>(payload.blob_location));
+    put_u64(out, payload.blob_size);
+    put_bytes(out, payload.blob_sha256.data(), payload.blob_sha256.size());
+    put_blob(out, payload.inline_blob, MAX_FRAME_PAYLOAD_BYTES, "CHIP_CALLABLE.inline_blob");
+    put_blob(out, payload.staged_blob_token, MAX_STAGED_BLOB_TOKEN_BYTES, "CHIP_CALLABLE.staged_blob_token");
+    put_u32(out, 0);
+    return out;
+}
+
+RemoteChipCallablePayload decode_remote_chip_callable_payload(const uint8_t *data, size_t size) {
+    size_t offset = 0;
+    RemoteChipCallablePayload payload;
+    payload.descriptor_bytes =
+        get_blob(data, size, offset, MAX_CHIP_CALLABLE_DESCRIPTOR_BYTES, "CHIP_CALLABLE.descriptor_bytes");
+    uint32_t raw_location = get_u32(data, size, offset);
+    ensure(
+        raw_location == static_cast<uint32_t>(ChipCallableBlobLocation::INLINE_BLOB) ||
+            raw_location == static_cast<uint32_t>(ChipCallableBlobLocation::STAGED_BLOB) ||
+            raw_location == static_cast<uint32_t>(ChipCallableBlobLocation::HELD_BLOB),
+        "remote_wire: unknown CHIP_CALLABLE blob location"
+    );
+    payload.blob_location = static_cast<ChipCallableBlobLocation>(raw_location);
+    payload.blob_size = get_u64(data, size, offset);
+    ensure_available(size, offset, CALLABLE_HASH_DIGEST_SIZE, "CHIP_CALLABLE.blob_sha256");
+    std::memcpy(payload.blob_sha256.data(), data + offset, CALLABLE_HASH_DIGEST_SIZE);
+    offset += CALLABLE_HASH_DIGEST_SIZE;
+    payload.inline_blob = get_blob(data, size, offset, MAX_FRAME_PAYLOAD_BYTES, "CHIP_CALLABLE.inline_blob");
+    payload.staged_blob_token =
+        get_blob(data, size, offset, MAX_STAGED_BLOB_TOKEN_BYTES, "CHIP_CALLABLE.staged_blob_token");
+    ensure(get_u32(data, size, offset) == 0, "remote_wire: CHIP_CALLABLE reserved field must be zero");
+    ensure(offset == size, "remote_wire: trailing bytes after CHIP_CALLABLE payload");
+    // Same consistency rules as the encoder, as the Python codec does.
+    (void)encode_remote_chip_callable_payload(payload);
+    return payload;
+}
+
 std::vector<uint8_t> encode_export_buffer_request(const ExportBufferRequest &request) {
     ensure(request.owner_worker_id >= 0, "remote_wire: EXPORT_BUFFER owner worker must be non-negative");
     ensure(request.buffer_id != 0, "remote_wire: EXPORT_BUFFER buffer_id must be non-zero");
@@ -755,7 +852,7 @@ std::vector<uint8_t> encode_import_buffer_result(const RemoteBufferHandle &resul
     put_u64(out, result.rkey_or_token);
     put_u64(out, result.ub_ldst_va);
     put_u32(out, result.access_flags);
-    put_string(out, "", MAX_TRANSPORT_PROFILE_BYTES, "import result transport_profile");
+    put_string(out, result.transport_profile, MAX_TRANSPORT_PROFILE_BYTES, "import result transport_profile");
     std::vector<uint8_t> empty_descriptor;
     put_blob(out, empty_descriptor, MAX_TRANSPORT_DESCRIPTOR_BYTES, "import result import_descriptor");
     put_u32(out, 0);
@@ -779,7 +876,8 @@ RemoteBufferHandle decode_import_buffer_result(const uint8_t *data, size_t size)
     result.rkey_or_token = get_u64(data, size, offset);
     result.ub_ldst_va = get_u64(data, size, offset);
     result.access_flags = get_u32(data, size, offset);
-    (void)get_string(data, size, offset, MAX_TRANSPORT_PROFILE_BYTES, "import result transport_profile");
+    result.transport_profile =
+        get_string(data, size, offset, MAX_TRANSPORT_PROFILE_BYTES, "import result transport_profile");
     (void)get_blob(data, size, offset, MAX_TRANSPORT_DESCRIPTOR_BYTES, "import result import_descriptor");
     ensure(get_u32(data, size, offset) == 0, "remote_wire: import result reserved field must be zero");
     ensure(offset == size, "remote_wire: trailing bytes after import result");
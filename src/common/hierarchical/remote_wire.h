@@ -31,9 +31,19 @@ static constexpr uint32_t MAX_SCALARS = 4096U;
 static constexpr uint32_t MAX_INLINE_PAYLOAD_BYTES = 1024U * 1024U;
 static constexpr uint32_t MAX_TRANSPORT_PROFILE_BYTES = 128U;
 static constexpr uint32_t MAX_TRANSPORT_DESCRIPTOR_BYTES = 4096U;
+static constexpr uint32_t MAX_CHIP_CALLABLE_DESCRIPTOR_BYTES = 4096U;
+static constexpr uint32_t MAX_STAGED_BLOB_TOKEN_BYTES = 1024U;
 static constexpr uint32_t REMOTE_BUFFER_ACCESS_READ = 1U << 0;
 static constexpr uint32_t REMOTE_BUFFER_ACCESS_WRITE = 1U << 1;
 static constexpr uint32_t REMOTE_BUFFER_ACCESS_READ_WRITE = REMOTE_BUFFER_ACCESS_READ | REMOTE_BUFFER_ACCESS_WRITE;
+// HelloPayload::feature_flags: the session accepts HELD_BLOB chip callables.
+static constexpr uint64_t HELLO_FEATURE_HELD_CHIP_BLOB = 1ULL << 0;
+// ControlReplyPayload::error_code values. Any non-zero code fails the
+// control; CONTROL_ERROR_BLOB_NOT_HELD additionally tells the sender that a
+// HELD_BLOB prepare named a digest the session lacks, so resending INLINE_BLOB
+// is safe.
+static constexpr int32_t CONTROL_ERROR = 1;
+static constexpr int32_t CONTROL_ERROR_BLOB_NOT_HELD = 2;
 
 enum class FrameType : uint32_t {
     HELLO = 1,
@@ -73,6 +83,14 @@ enum class RemoteRegistryTarget : uint32_t {
     INNER_L3_WORKER = 2,
 };
 
+enum class ChipCallableBlobLocation : uint32_t {
+    INLINE_BLOB = 1,
+    STAGED_BLOB = 2,
+    // No bytes on the wire: the receiver already holds the callable named by
+    // the command digest (blob_size / blob_sha256 must match what it holds).
+    HELD_BLOB = 3,
+};
+
 struct FrameHeader {
     FrameType frame_type{FrameType::HELLO};
     uint64_t session_id{0};
@@ -130,6 +148,29 @@ struct ControlReplyPayload {
     std::vector<uint8_t> result_bytes;
 };
 
+struct RegisterCallableCommand {
+    RemoteRegistryTarget target_registry{RemoteRegistryTarget::REMOTE_TASK_DISPATCHER};
+    CallableKind callable_kind{CallableKind::PYTHON_IMPORT};
+    std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> digest{};
+    uint32_t payload_version{1};
+    std::vector<uint8_t> payload;
+};
+
+struct DigestCallableCommand {
+    RemoteRegistryTarget target_registry{RemoteRegistryTarget::REMOTE_TASK_DISPATCHER};
+    CallableKind callable_kind{CallableKind::PYTHON_IMPORT};
+    std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> digest{};
+};
+
+struct RemoteChipCallablePayload {
+    std::vector<uint8_t> descriptor_bytes;
+    ChipCallableBlobLocation blob_location{ChipCallableBlobLocation::INLINE_BLOB};
+    uint64_t blob_size{0};
+    std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> blob_sha256{};
+    std::vector<uint8_t> inline_blob;
+    std::vector<uint8_t> staged_blob_token;
+};
+
 struct ExportBufferRequest {
     int32_t owner_worker_id{-1};
     uint64_t buffer_id{0};
@@ -192,6 +233,11 @@ std::vector<uint8_t> encode_digest_callable_command(
     const std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> &digest
 );
 
+RegisterCallableCommand decode_register_callable_command(const uint8_t *data, size_t size);
+DigestCallableCommand decode_digest_callable_command(const uint8_t *data, size_t size);
+std::vector<uint8_t> encode_remote_chip_callable_payload(const RemoteChipCallablePayload &payload);
+RemoteChipCallablePayload decode_remote_chip_callable_payload(const uint8_t *data, size_t size);
+
 std::vector<uint8_t> encode_export_buffer_request(const ExportBufferRequest &request);
 ExportBufferRequest decode_export_buffer_request(const uint8_t *data, size_t size);
 std::vector<uint8_t> encode_export_buffer_result(const RemoteBufferExport &result);
@@ -37,6 +37,8 @@ void TaskSlotState::reset() {
     is_group_ = false;
     remote_sidecar.clear();
     remote_sidecars.clear();
+    is_copy = false;
+    copy = CopyTaskDesc{};
     affinities.clear();
     // ring_idx / ring_slot_idx are deliberately NOT cleared here: Ring
     // stamps them at alloc() before the Orchestrator ever calls reset(),
@@ -130,6 +130,8 @@ enum class CallableKind : int32_t {
     CHIP_CALLABLE = 1,
     PYTHON_SERIALIZED = 2,
     PYTHON_IMPORT = 3,
+    // C ABI symbol from a shared library (native_sub_abi.h); SUB only.
+    NATIVE_SO = 4,
 };
 
 enum class TargetNamespace : int32_t {
@@ -200,6 +202,7 @@ struct RemoteBufferHandle {
     uint64_t rkey_or_token{0};
     uint64_t ub_ldst_va{0};
     uint32_t access_flags{0};
+    std::string transport_profile;  // import result only; empty on owned buffers
     bool released{false};
     int32_t live_slot_refs{0};
 };
@@ -279,6 +282,19 @@ struct WorkerCompletion {
     std::string error_message;
 };
 
+// Data-movement node submitted by Orchestrator::submit_copy. Worker ids are
+// stable NEXT_LEVEL ids; -1 means the pointer is parent host memory (which
+// must be MAP_SHARED so the child can reach it). `staging` is the HeapRing
+// slab a chip-to-chip copy bounces through; 0 when one side is host.
+struct CopyTaskDesc {
+    int32_t src_worker_id{-1};
+    uint64_t src{0};
+    int32_t dst_worker_id{-1};
+    uint64_t dst{0};
+    uint64_t nbytes{0};
+    uint64_t staging{0};
+};
+
 // =============================================================================
 // TaskSlotState — per-task scheduling bookkeeping
 // =============================================================================
@@ -349,6 +365,11 @@ struct TaskSlotState {
     RemoteTaskArgsSidecar remote_sidecar;
     std::vector<RemoteTaskArgsSidecar> remote_sidecars;
 
+    // Copy nodes carry no callable or TaskArgs: the WorkerThread that picks
+    // the slot up moves `copy` with control copies instead of a mailbox run.
+    bool is_copy{false};
+    CopyTaskDesc copy;
+
     // Runtime-owned OUTPUT slabs live in the Worker's HeapRing and are
     // reclaimed implicitly by Ring::release(slot) — no per-slot
     // munmap is needed. See docs/orchestrator.md §8b.
@@ -79,16 +79,23 @@ void Worker::add_next_level_worker(int32_t worker_id, void *mailbox) {
     manager_.add_next_level_at(worker_id, mailbox);
 }
 
+int32_t Worker::add_native_sub_worker(const std::vector<NativeSubPreload> &preload) {
+    if (initialized_) throw std::runtime_error("Worker: add_native_sub_worker after init");
+    const int32_t worker_id = manager_.sub_count();
+    manager_.add_sub_endpoint(std::make_unique<NativeSubEndpoint>(worker_id, preload));
+    return worker_id;
+}
+
 void Worker::add_remote_l3_socket(
     int32_t worker_id, uint64_t session_id, const std::string &transport_name, const std::string &host, uint16_t port,
     const std::string &health_host, uint16_t health_port, double timeout_s
 ) {
     if (initialized_) throw std::runtime_error("Worker: add_remote_l3_socket after init");
     auto transport = std::make_unique<RemoteL3SocketTransport>(host, port, health_host, health_port, timeout_s);
-    transport->expect_hello_ready(session_id, worker_id, transport_name);
-    manager_.add_next_level_endpoint(
-        std::make_unique<RemoteL3Endpoint>(worker_id, session_id, transport_name, std::move(transport))
-    );
+    auto hello = transport->expect_hello_ready(session_id, worker_id, transport_name);
+    manager_.add_next_level_endpoint(std::make_unique<RemoteL3Endpoint>(
+        worker_id, session_id, transport_name, std::move(transport), hello.feature_flags
+    ));
 }
 
 void Worker::init() {
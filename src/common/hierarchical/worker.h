@@ -24,6 +24,9 @@
  *                                    (a `ChipWorker` for NEXT_LEVEL, a
  *                                    Python callable for SUB) lives in
  *                                    the forked child.
+ *   - add_native_sub_worker()      — in-process SUB worker that runs
+ *                                    NATIVE_SO callables on the parent's
+ *                                    own threads (native_sub.h).
  *   - init() / close()             — lifecycle
  *   - get_orchestrator()           — accessor used by the Python facade
  *                                    (scope_begin / drain / scope_end live
@@ -45,6 +48,7 @@
 #include <string>
 #include <vector>
 
+#include "native_sub.h"
 #include "ring.h"
 #include "orchestrator.h"
 #include "scheduler.h"
@@ -77,6 +81,12 @@ public:
     void add_worker(WorkerType type, void *mailbox);
     void add_next_level_worker(int32_t worker_id, void *mailbox);
 
+    // Register an in-process SUB worker: a WorkerThread that runs NATIVE_SO
+    // callables directly on the slot's TaskArgs (no fork, no mailbox).
+    // `preload` seeds its digest table with the pre-start identities.
+    // Returns the SUB worker id.
+    int32_t add_native_sub_worker(const std::vector<NativeSubPreload> &preload = {});
+
     // Register a REMOTE_L3 endpoint only after its session runner completed
     // prestart and reported HELLO READY on the command lane.
     void add_remote_l3_socket(
@@ -171,9 +181,12 @@ public:
     // the contiguous ChipCallable bytes (see PyChipCallable::buffer_ptr /
     // buffer_size). Register returns per-child status so the facade can
     // reverse only confirmed installs; unregister remains best-effort.
-    std::vector<ControlResult> broadcast_register_all(uint64_t blob_ptr, uint64_t blob_size, const uint8_t *digest) {
+    // `probe_held` asks children digest-only first (see CTRL_REGISTER_HELD).
+    std::vector<ControlResult> broadcast_register_all(
+        uint64_t blob_ptr, uint64_t blob_size, const uint8_t *digest, bool probe_held = false
+    ) {
         return manager_.broadcast_register_all(
-            reinterpret_cast<const void *>(blob_ptr), static_cast<size_t>(blob_size), digest
+            reinterpret_cast<const void *>(blob_ptr), static_cast<size_t>(blob_size), digest, probe_held
         );
     }
     std::vector<std::string> broadcast_unregister_all(const uint8_t *digest) {
@@ -21,6 +21,8 @@
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <thread>
@@ -68,10 +70,23 @@ uint64_t WorkerEndpoint::control_malloc(size_t) { throw_unsupported_control("con
 void WorkerEndpoint::control_free(uint64_t) { throw_unsupported_control("control_free"); }
 void WorkerEndpoint::control_copy_to(uint64_t, uint64_t, size_t) { throw_unsupported_control("control_copy_to"); }
 void WorkerEndpoint::control_copy_from(uint64_t, uint64_t, size_t) { throw_unsupported_control("control_copy_from"); }
+uint64_t WorkerEndpoint::control_copy_to_async(uint64_t dst, uint64_t src, size_t size) {
+    control_copy_to(dst, src, size);
+    return 0;
+}
+uint64_t WorkerEndpoint::control_copy_from_async(uint64_t dst, uint64_t src, size_t size) {
+    control_copy_from(dst, src, size);
+    return 0;
+}
+bool WorkerEndpoint::control_copy_done(uint64_t token) {
+    if (token != 0) throw std::runtime_error("control_copy_done: unknown copy token " + std::to_string(token));
+    return true;
+}
 void WorkerEndpoint::control_prepare(const uint8_t *) { throw_unsupported_control("control_prepare"); }
 void WorkerEndpoint::control_register(const char *, size_t, const uint8_t *) {
     throw_unsupported_control("control_register");
 }
+bool WorkerEndpoint::control_register_held(const uint8_t *) { return false; }
 void WorkerEndpoint::control_unregister(const uint8_t *) { throw_unsupported_control("control_unregister"); }
 void WorkerEndpoint::control_remote_prepare_register(
     remote_l3::RemoteRegistryTarget, CallableKind, const uint8_t *, const void *, size_t
@@ -170,6 +185,8 @@ void WorkerThread::start(
     endpoint_ = std::move(endpoint);
     shutdown_ = false;
     idle_.store(true, std::memory_order_relaxed);
+    inflight_copies_.clear();
+    inflight_copy_count_.store(0, std::memory_order_relaxed);
     thread_ = std::thread(&WorkerThread::loop, this);
 }
 
@@ -204,46 +221,153 @@ int32_t WorkerThread::worker_id() const { return caps().worker_id; }
 // WorkerThread — main loop + per-mode dispatch
 // =============================================================================
 
+namespace {
+
+// How often the worker thread polls its in-flight copy tokens while it has
+// nothing else to run; matches the TASK_DONE spin-poll period.
+constexpr auto kCopyPollInterval = std::chrono::microseconds(50);
+
+WorkerCompletion make_completion(const WorkerDispatch &d, EndpointOutcome outcome, std::string error_message = {}) {
+    WorkerCompletion completion;
+    completion.task_slot = d.task_slot;
+    completion.group_index = d.group_index;
+    completion.outcome = outcome;
+    completion.error_message = std::move(error_message);
+    return completion;
+}
+
+}  // namespace
+
 void WorkerThread::loop() {
     while (true) {
         WorkerDispatch d;
+        bool have_dispatch = false;
         {
             std::unique_lock<std::mutex> lk(mu_);
-            cv_.wait(lk, [this] {
+            auto ready = [this] {
                 return !queue_.empty() || shutdown_;
-            });
-            if (queue_.empty()) break;
-            d = queue_.front();
-            queue_.pop();
-        }
-
-        WorkerCompletion completion;
-        try {
-            completion = dispatch_process(d);
-        } catch (const std::exception &e) {
-            completion.task_slot = d.task_slot;
-            completion.group_index = d.group_index;
-            completion.outcome = EndpointOutcome::ENDPOINT_FAILURE;
-            completion.error_message = std::string("WorkerThread endpoint failed: ") + e.what();
-        } catch (...) {
-            completion.task_slot = d.task_slot;
-            completion.group_index = d.group_index;
-            completion.outcome = EndpointOutcome::ENDPOINT_FAILURE;
-            completion.error_message = "WorkerThread endpoint failed with unknown exception";
+            };
+            if (inflight_copies_.empty()) {
+                cv_.wait(lk, ready);
+            } else {
+                cv_.wait_for(lk, kCopyPollInterval, ready);
+            }
+            if (!queue_.empty()) {
+                d = queue_.front();
+                queue_.pop();
+                have_dispatch = true;
+            } else if (shutdown_) {
+                break;
+            }
         }
 
-        if (completion.outcome != EndpointOutcome::SUCCESS && manager_) {
-            manager_->report_error(std::make_exception_ptr(std::runtime_error(completion.error_message)));
+        if (have_dispatch) {
+            WorkerCompletion completion;
+            bool done = true;
+            try {
+                done = dispatch_process(d, completion);
+            } catch (const std::exception &e) {
+                completion = make_completion(
+                    d, EndpointOutcome::ENDPOINT_FAILURE, std::string("WorkerThread endpoint failed: ") + e.what()
+                );
+            } catch (...) {
+                completion = make_completion(
+                    d, EndpointOutcome::ENDPOINT_FAILURE, "WorkerThread endpoint failed with unknown exception"
+                );
+            }
+            idle_.store(true, std::memory_order_release);
+            if (done) complete(std::move(completion));
         }
+        if (!inflight_copies_.empty()) poll_copies();
+    }
+}
 
-        idle_.store(true, std::memory_order_release);
-        on_complete_(std::move(completion));
+void WorkerThread::complete(WorkerCompletion completion) {
+    if (completion.outcome != EndpointOutcome::SUCCESS && manager_) {
+        manager_->report_error(std::make_exception_ptr(std::runtime_error(completion.error_message)));
     }
+    on_complete_(std::move(completion));
 }
 
-WorkerCompletion WorkerThread::dispatch_process(WorkerDispatch d) {
+bool WorkerThread::dispatch_process(WorkerDispatch d, WorkerCompletion &completion) {
     if (!endpoint_) throw std::runtime_error("WorkerThread::dispatch_process: null endpoint");
-    return endpoint_->run(ring_, d);
+    const TaskSlotState *s = ring_ != nullptr ? ring_->slot_state(d.task_slot) : nullptr;
+    if (s != nullptr && s->is_copy) return run_copy(d, s->copy, completion);
+    completion = endpoint_->run(ring_, d);
+    return true;
+}
+
+WorkerThread *WorkerThread::copy_owner(int32_t worker_id) {
+    if (worker_id == this->worker_id()) return this;
+    WorkerThread *wt = nullptr;
+    if (manager_ != nullptr) wt = manager_->get_worker_by_id(WorkerType::NEXT_LEVEL, worker_id);
+    if (wt == nullptr) {
+        throw std::runtime_error("copy task: worker " + std::to_string(worker_id) + " is not registered");
+    }
+    return wt;
+}
+
+// Copy nodes run as async hops on the owning children's copy threads
+// (CTRL_COPY_*_ASYNC). Starting a hop only claims the child's mailbox for
+// the enqueue, so the child keeps serving tasks while the data moves, and
+// this thread goes back to taking dispatches; the node completes from
+// poll_copies() once its last token is done. A chip-to-chip copy bounces
+// through the staging slab: the hop into the destination is issued when the
+// hop out of the source has landed.
+bool WorkerThread::run_copy(const WorkerDispatch &d, const CopyTaskDesc &c, WorkerCompletion &completion) {
+    if (c.nbytes == 0) {
+        completion = make_completion(d, EndpointOutcome::SUCCESS);
+        return true;
+    }
+    const size_t n = static_cast<size_t>(c.nbytes);
+    InflightCopy f;
+    f.dispatch = d;
+    f.copy = c;
+    if (c.src_worker_id >= 0 && c.dst_worker_id >= 0) {
+        f.owner = copy_owner(c.src_worker_id);
+        f.token = f.owner->control_copy_from_async(c.staging, c.src, n);
+        f.staged = true;
+    } else if (c.src_worker_id >= 0) {
+        f.owner = copy_owner(c.src_worker_id);
+        f.token = f.owner->control_copy_from_async(c.dst, c.src, n);
+    } else {
+        f.owner = copy_owner(c.dst_worker_id);
+        f.token = f.owner->control_copy_to_async(c.dst, c.src, n);
+    }
+    inflight_copies_.push_back(f);
+    inflight_copy_count_.fetch_add(1, std::memory_order_release);
+    return false;
+}
+
+void WorkerThread::poll_copies() {
+    size_t i = 0;
+    while (i < inflight_copies_.size()) {
+        InflightCopy &f = inflight_copies_[i];
+        WorkerCompletion completion;
+        try {
+            if (!f.owner->control_copy_done(f.token)) {
+                ++i;
+                continue;
+            }
+            if (f.staged) {
+                // Re-check the same entry: endpoints without an async path
+                // finish the hop inline.
+                const CopyTaskDesc &c = f.copy;
+                f.owner = copy_owner(c.dst_worker_id);
+                f.token = f.owner->control_copy_to_async(c.dst, c.staging, static_cast<size_t>(c.nbytes));
+                f.staged = false;
+                continue;
+            }
+            completion = make_completion(f.dispatch, EndpointOutcome::SUCCESS);
+        } catch (const std::exception &e) {
+            completion = make_completion(
+                f.dispatch, EndpointOutcome::ENDPOINT_FAILURE, std::string("copy task failed: ") + e.what()
+            );
+        }
+        inflight_copies_.erase(inflight_copies_.begin() + static_cast<ptrdiff_t>(i));
+        inflight_copy_count_.fetch_sub(1, std::memory_order_release);
+        complete(std::move(completion));
+    }
 }
 
 WorkerCompletion LocalMailboxEndpoint::run(Ring *ring, const WorkerDispatch &dispatch) {
@@ -362,7 +486,23 @@ void WorkerManager::add_next_level_endpoint(std::unique_ptr<WorkerEndpoint> endp
     next_level_endpoint_entries_.push_back(std::move(endpoint));
 }
 
-void WorkerManager::add_sub(void *mailbox) { sub_entries_.push_back(mailbox); }
+void WorkerManager::add_sub(void *mailbox) {
+    if (!sub_endpoint_entries_.empty()) {
+        throw std::runtime_error("WorkerManager::add_sub: mailbox SUB workers must be added before SUB endpoints");
+    }
+    sub_entries_.push_back(mailbox);
+}
+
+void WorkerManager::add_sub_endpoint(std::unique_ptr<WorkerEndpoint> endpoint) {
+    if (!endpoint) throw std::invalid_argument("WorkerManager::add_sub_endpoint: null endpoint");
+    if (endpoint->caps().worker_id != sub_count()) {
+        throw std::invalid_argument(
+            "WorkerManager::add_sub_endpoint: worker_id " + std::to_string(endpoint->caps().worker_id) +
+            " does not match next SUB id " + std::to_string(sub_count())
+        );
+    }
+    sub_endpoint_entries_.push_back(std::move(endpoint));
+}
 
 void WorkerManager::start(Ring *ring, const OnCompleteFn &on_complete) {
     if (ring == nullptr) throw std::invalid_argument("WorkerManager::start: null ring");
@@ -413,6 +553,12 @@ void WorkerManager::start(Ring *ring, const OnCompleteFn &on_complete) {
     }
     next_level_endpoint_entries_.clear();
     make_sub_threads(sub_entries_, sub_threads_);
+    for (auto &endpoint : sub_endpoint_entries_) {
+        auto wt = std::make_unique<WorkerThread>();
+        wt->start(ring, this, on_complete, std::move(endpoint));
+        sub_threads_.push_back(std::move(wt));
+    }
+    sub_endpoint_entries_.clear();
 }
 
 void WorkerManager::report_error(std::exception_ptr e) {
@@ -613,6 +759,17 @@ void LocalMailboxEndpoint::control_register(const char *shm_name, size_t blob_si
     run_control_command("control_register");
 }
 
+bool LocalMailboxEndpoint::control_register_held(const uint8_t *digest) {
+    std::lock_guard<std::mutex> lk(mailbox_mu_);
+    write_control_args(mbox(), CTRL_REGISTER);
+    uint64_t result = 0;
+    std::memcpy(mbox() + CTRL_OFF_RESULT, &result, sizeof(uint64_t));
+    write_control_digest(mbox(), digest);
+    std::memset(mbox() + MAILBOX_OFF_ARGS, 0, CTRL_SHM_NAME_BYTES);
+    run_control_command("control_register");
+    return read_control_result(mbox()) == CTRL_REGISTER_HELD;
+}
+
 void LocalMailboxEndpoint::control_unregister(const uint8_t *digest) {
     std::lock_guard<std::mutex> lk(mailbox_mu_);
     write_control_args(mbox(), CTRL_UNREGISTER);
@@ -708,6 +865,30 @@ void LocalMailboxEndpoint::control_copy_from(uint64_t dst, uint64_t src, size_t
     run_control_command("control_copy_from");
 }
 
+uint64_t LocalMailboxEndpoint::control_copy_to_async(uint64_t dst, uint64_t src, size_t size) {
+    std::lock_guard<std::mutex> lk(mailbox_mu_);
+    write_control_args(mbox(), CTRL_COPY_TO_ASYNC, dst, src, static_cast<uint64_t>(size));
+    run_control_command("control_copy_to_async");
+    return read_control_result(mbox());
+}
+
+uint64_t LocalMailboxEndpoint::control_copy_from_async(uint64_t dst, uint64_t src, size_t size) {
+    std::lock_guard<std::mutex> lk(mailbox_mu_);
+    write_control_args(mbox(), CTRL_COPY_FROM_ASYNC, dst, src, static_cast<uint64_t>(size));
+    run_control_command("control_copy_from_async");
+    return read_control_result(mbox());
+}
+
+bool LocalMailboxEndpoint::control_copy_done(uint64_t token) {
+    // A poll must not queue behind a task the child is running: report "not
+    // yet" and let the caller come back.
+    std::unique_lock<std::mutex> lk(mailbox_mu_, std::try_to_lock);
+    if (!lk.owns_lock()) return false;
+    write_control_args(mbox(), CTRL_COPY_QUERY, token);
+    run_control_command("control_copy_done");
+    return read_control_result(mbox()) != 0;
+}
+
 // Stage two NUL-terminated shm names at MAILBOX_OFF_ARGS: request first
 // (CTRL_SHM_NAME_BYTES wide) then reply (CTRL_SHM_NAME_BYTES wide).  Pads each
 // slot with zeros so stale bytes from a prior op cannot leak into the child's
@@ -773,6 +954,11 @@ void WorkerThread::control_register(const char *shm_name, size_t blob_size, cons
     endpoint_->control_register(shm_name, blob_size, digest);
 }
 
+bool WorkerThread::control_register_held(const uint8_t *digest) {
+    if (!endpoint_) throw std::runtime_error("control_register: null endpoint");
+    return endpoint_->control_register_held(digest);
+}
+
 void WorkerThread::control_unregister(const uint8_t *digest) {
     if (!endpoint_) throw std::runtime_error("control_unregister: null endpoint");
     endpoint_->control_unregister(digest);
@@ -871,6 +1057,21 @@ void WorkerThread::control_copy_from(uint64_t dst, uint64_t src, size_t size) {
     endpoint_->control_copy_from(dst, src, size);
 }
 
+uint64_t WorkerThread::control_copy_to_async(uint64_t dst, uint64_t src, size_t size) {
+    if (!endpoint_) throw std::runtime_error("control_copy_to_async: null endpoint");
+    return endpoint_->control_copy_to_async(dst, src, size);
+}
+
+uint64_t WorkerThread::control_copy_from_async(uint64_t dst, uint64_t src, size_t size) {
+    if (!endpoint_) throw std::runtime_error("control_copy_from_async: null endpoint");
+    return endpoint_->control_copy_from_async(dst, src, size);
+}
+
+bool WorkerThread::control_copy_done(uint64_t token) {
+    if (!endpoint_) throw std::runtime_error("control_copy_done: null endpoint");
+    return endpoint_->control_copy_done(token);
+}
+
 void WorkerThread::control_alloc_domain(const char *request_shm_name, const char *reply_shm_name) {
     if (!endpoint_) throw std::runtime_error("control_alloc_domain: null endpoint");
     endpoint_->control_alloc_domain(request_shm_name, reply_shm_name);
@@ -888,7 +1089,7 @@ void WorkerThread::control_comm_init(const char *request_shm_name) {
 
 bool WorkerManager::any_busy() const {
     for (auto &wt : next_level_threads_)
-        if (!wt->idle()) return true;
+        if (!wt->idle() || wt->copies_in_flight()) return true;
     for (auto &wt : sub_threads_)
         if (!wt->idle()) return true;
     return false;
@@ -1176,8 +1377,9 @@ void WorkerManager::control_remote_release_import(const RemoteBufferHandle &hand
     wt->control_remote_release_import(handle);
 }
 
-std::vector<ControlResult>
-WorkerManager::broadcast_register_all(const void *blob_ptr, size_t blob_size, const uint8_t *digest) {
+std::vector<ControlResult> WorkerManager::broadcast_register_all(
+    const void *blob_ptr, size_t blob_size, const uint8_t *digest, bool probe_held
+) {
     std::vector<ControlResult> results;
     results.reserve(next_level_threads_.size());
     for (size_t i = 0; i < next_level_threads_.size(); ++i) {
@@ -1185,9 +1387,19 @@ WorkerManager::broadcast_register_all(const void *blob_ptr, size_t blob_size, co
     }
     if (next_level_threads_.empty()) return results;
 
-    std::string shm_name = make_shm_name();
-    PosixShmHolder shm(shm_name, blob_size);
-    std::memcpy(shm.addr(), blob_ptr, blob_size);
+    // Staged on first need: a probe_held broadcast whose children all hold
+    // the digest never copies the blob at all.
+    std::unique_ptr<PosixShmHolder> shm;
+    std::mutex shm_mu;
+    auto staged_name = [&]() -> std::string {
+        std::lock_guard<std::mutex> lk(shm_mu);
+        if (!shm) {
+            shm = std::make_unique<PosixShmHolder>(make_shm_name(), blob_size);
+            std::memcpy(shm->addr(), blob_ptr, blob_size);
+        }
+        return shm->name();
+    };
+    if (!probe_held) (void)staged_name();
 
     // Fan out to every WorkerThread in parallel. Per-WorkerThread mailbox_mu_
     // is independent, so N control_register calls run concurrently — latency
@@ -1195,9 +1407,10 @@ WorkerManager::broadcast_register_all(const void *blob_ptr, size_t blob_size, co
     std::vector<std::thread> workers;
     workers.reserve(next_level_threads_.size());
     for (size_t i = 0; i < next_level_threads_.size(); ++i) {
-        workers.emplace_back([this, i, digest, blob_size, name = shm.name(), &results]() {
+        workers.emplace_back([this, i, digest, blob_size, probe_held, &staged_name, &results]() {
             try {
-                next_level_threads_[i]->control_register(name.c_str(), blob_size, digest);
+                if (probe_held && next_level_threads_[i]->control_register_held(digest)) return;
+                next_level_threads_[i]->control_register(staged_name().c_str(), blob_size, digest);
             } catch (const std::exception &e) {
                 results[i].ok = false;
                 results[i].error_message = strip_control_prefix(e.what(), "control_register");
@@ -18,7 +18,8 @@
  *
  * Each WorkerThread encodes `(callable digest, config, args_blob)` into a
  * pre-forked child's shared-memory mailbox, signals TASK_READY, and
- * spin-polls TASK_DONE. The child process loop (Python) reads the
+ * spin-polls TASK_DONE. The child process loop (ChipChildLoop for chip
+ * children, Python for SUB) reads the
  * digest, resolves it to a child-local slot, and runs that slot on its
  * `ChipWorker` (NEXT_LEVEL) or registered Python callable (SUB) in its
  * own address space.
@@ -133,7 +134,13 @@ static constexpr uint64_t CTRL_PREPARE = 4;
 // Dynamic post-init register/unregister of a callable identity. CTRL_REGISTER
 // carries (shm_name, blob_size, digest) with bytes staged in POSIX shm by
 // the parent; CTRL_UNREGISTER carries digest only.
+//
+// A CTRL_REGISTER with blob_size 0 and an empty shm name is digest-only: a
+// child that already holds the digest takes one more reference and writes
+// CTRL_REGISTER_HELD to CTRL_OFF_RESULT; otherwise it leaves the result at 0
+// and the parent resends with the blob staged.
 static constexpr uint64_t CTRL_REGISTER = 5;
+static constexpr uint64_t CTRL_REGISTER_HELD = 1;
 static constexpr uint64_t CTRL_UNREGISTER = 6;
 // Dynamic per-orch CommDomain allocation/release.  Both carry a pair of
 // NUL-terminated POSIX shm names at MAILBOX_OFF_ARGS — first the request shm
@@ -151,12 +158,26 @@ static constexpr uint64_t CTRL_RELEASE_DOMAIN = 8;
 static constexpr uint64_t CTRL_COMM_INIT = 9;
 static constexpr uint64_t CTRL_PY_REGISTER = 10;
 static constexpr uint64_t CTRL_PY_UNREGISTER = 11;
+// 12 is the Python-side CTRL_PY_IMPORT_REGISTER.
+// Install a NATIVE_SO SUB callable. Same framing as the Python import
+// register: shm name at MAILBOX_OFF_ARGS, payload size at CTRL_OFF_ARG0,
+// digest in the control hash slot; the payload is "<so path>\0<symbol>".
+// Unregister reuses CTRL_PY_UNREGISTER.
+static constexpr uint64_t CTRL_NATIVE_SO_REGISTER = 13;
+// Async copy hops for copy nodes. CTRL_COPY_{TO,FROM}_ASYNC take the same
+// args as CTRL_COPY_{TO,FROM}, start the transfer on the child's copy thread
+// and return its token at CTRL_OFF_RESULT without waiting for it.
+// CTRL_COPY_QUERY polls the token at CTRL_OFF_ARG0: result 1 once done, 0
+// while in flight; a failed transfer fails the command.
+static constexpr uint64_t CTRL_COPY_TO_ASYNC = 14;
+static constexpr uint64_t CTRL_COPY_FROM_ASYNC = 15;
+static constexpr uint64_t CTRL_COPY_QUERY = 16;
 
 // Control args reuse the task mailbox region (mutually exclusive with task dispatch):
-//   offset 16: uint64 arg0 (size for malloc/register; ptr for free; dst for copy)
+//   offset 16: uint64 arg0 (size for malloc/register; ptr for free; dst for copy; token for query)
 //   offset 24: uint64 arg1 (src for copy)
 //   offset 32: uint64 arg2 (nbytes for copy)
-//   offset 40: uint64 result (returned ptr from malloc)
+//   offset 40: uint64 result (returned ptr from malloc; token / done flag for async copies)
 static constexpr ptrdiff_t CTRL_OFF_ARG0 = 16;
 static constexpr ptrdiff_t CTRL_OFF_ARG1 = 24;
 static constexpr ptrdiff_t CTRL_OFF_ARG2 = 32;
@@ -180,6 +201,7 @@ struct WorkerDispatch;
 enum class WorkerEndpointKind : int32_t {
     LOCAL_MAILBOX = 0,
     REMOTE_L3 = 1,
+    IN_PROCESS = 2,
 };
 
 struct WorkerEndpointCaps {
@@ -203,8 +225,17 @@ public:
     virtual void control_free(uint64_t ptr);
     virtual void control_copy_to(uint64_t dst, uint64_t src, size_t size);
     virtual void control_copy_from(uint64_t dst, uint64_t src, size_t size);
+    // Async copy hops: return a token for control_copy_done. The default runs
+    // the synchronous hop and returns token 0, which is always done.
+    virtual uint64_t control_copy_to_async(uint64_t dst, uint64_t src, size_t size);
+    virtual uint64_t control_copy_from_async(uint64_t dst, uint64_t src, size_t size);
+    // Non-blocking: false while the copy is in flight or the endpoint is busy
+    // with another command. Throws if the transfer failed.
+    virtual bool control_copy_done(uint64_t token);
     virtual void control_prepare(const uint8_t *digest);
     virtual void control_register(const char *shm_name, size_t blob_size, const uint8_t *digest);
+    // Digest-only CTRL_REGISTER; false when the child needs the blob.
+    virtual bool control_register_held(const uint8_t *digest);
     virtual void control_unregister(const uint8_t *digest);
     virtual void control_remote_prepare_register(
         remote_l3::RemoteRegistryTarget target_registry, CallableKind callable_kind, const uint8_t *digest,
@@ -252,8 +283,12 @@ public:
     void control_free(uint64_t ptr) override;
     void control_copy_to(uint64_t dst, uint64_t src, size_t size) override;
     void control_copy_from(uint64_t dst, uint64_t src, size_t size) override;
+    uint64_t control_copy_to_async(uint64_t dst, uint64_t src, size_t size) override;
+    uint64_t control_copy_from_async(uint64_t dst, uint64_t src, size_t size) override;
+    bool control_copy_done(uint64_t token) override;
     void control_prepare(const uint8_t *digest) override;
     void control_register(const char *shm_name, size_t blob_size, const uint8_t *digest) override;
+    bool control_register_held(const uint8_t *digest) override;
     void control_unregister(const uint8_t *digest) override;
     void control_remote_prepare_register(
         remote_l3::RemoteRegistryTarget target_registry, CallableKind callable_kind, const uint8_t *digest,
@@ -346,8 +381,11 @@ public:
     // Enqueue a dispatch for the worker. Non-blocking.
     void dispatch(WorkerDispatch d);
 
-    // True if the worker has no active task.
+    // True if the worker has no active task. A copy node in flight does not
+    // count: once its hop is started the worker takes other dispatches.
     bool idle() const { return idle_.load(std::memory_order_acquire); }
+    // True while copy nodes started on this worker are still in flight.
+    bool copies_in_flight() const { return inflight_copy_count_.load(std::memory_order_acquire) > 0; }
     const WorkerEndpointCaps &caps() const;
     int32_t worker_id() const;
 
@@ -369,6 +407,9 @@ public:
     void control_free(uint64_t ptr);
     void control_copy_to(uint64_t dst, uint64_t src, size_t size);
     void control_copy_from(uint64_t dst, uint64_t src, size_t size);
+    uint64_t control_copy_to_async(uint64_t dst, uint64_t src, size_t size);
+    uint64_t control_copy_from_async(uint64_t dst, uint64_t src, size_t size);
+    bool control_copy_done(uint64_t token);
 
     // Pre-warm a chip child by triggering prepare_callable for the digest's
     // target-local slot via CTRL_PREPARE.
@@ -381,6 +422,7 @@ public:
     // CTRL_REGISTER concurrent with dispatch_process waits for the in-flight
     // TASK_DONE before claiming the mailbox.
     void control_register(const char *shm_name, size_t blob_size, const uint8_t *digest);
+    bool control_register_held(const uint8_t *digest);
     void control_unregister(const uint8_t *digest);
     void control_remote_prepare_register(
         remote_l3::RemoteRegistryTarget target_registry, CallableKind callable_kind, const uint8_t *digest,
@@ -437,8 +479,31 @@ private:
     bool shutdown_{false};
     std::atomic<bool> idle_{true};
 
+    // A copy node whose current hop is in flight on `owner`'s child. `staged`
+    // marks the first hop of a chip-to-chip copy; the hop into the
+    // destination is issued once the data has landed in staging.
+    struct InflightCopy {
+        WorkerDispatch dispatch;
+        CopyTaskDesc copy;
+        WorkerThread *owner{nullptr};
+        uint64_t token{0};
+        bool staged{false};
+    };
+    // Touched only by the worker thread; the count mirrors its size for
+    // copies_in_flight().
+    std::vector<InflightCopy> inflight_copies_;
+    std::atomic<int32_t> inflight_copy_count_{0};
+
     void loop();
-    WorkerCompletion dispatch_process(WorkerDispatch d);
+    // False when the dispatch completes later (a copy node left in flight).
+    bool dispatch_process(WorkerDispatch d, WorkerCompletion &completion);
+    void complete(WorkerCompletion completion);
+    // Start a copy node (TaskSlotState::is_copy): issue its first hop and
+    // park it in inflight_copies_. True only for an empty copy.
+    bool run_copy(const WorkerDispatch &d, const CopyTaskDesc &c, WorkerCompletion &completion);
+    // Advance in-flight copies; complete the nodes whose last hop is done.
+    void poll_copies();
+    WorkerThread *copy_owner(int32_t worker_id);
 };
 
 // =============================================================================
@@ -456,6 +521,11 @@ public:
     void add_next_level_at(int32_t worker_id, void *mailbox);
     void add_next_level_endpoint(std::unique_ptr<WorkerEndpoint> endpoint);
     void add_sub(void *mailbox);
+    // In-process SUB endpoint (NativeSubEndpoint). Its worker_id must be
+    // sub_count() at the time of the call; mailbox SUB workers are numbered
+    // first, so they cannot be added after an endpoint.
+    void add_sub_endpoint(std::unique_ptr<WorkerEndpoint> endpoint);
+    int32_t sub_count() const { return static_cast<int32_t>(sub_entries_.size() + sub_endpoint_entries_.size()); }
 
     void start(Ring *ring, const OnCompleteFn &on_complete);
     void stop();
@@ -524,7 +594,11 @@ public:
     // std::thread per WorkerThread, and joins. Returns one ControlResult per
     // target so the Python facade can clean up only targets that confirmed
     // install/refcount increment on a partial failure.
-    std::vector<ControlResult> broadcast_register_all(const void *blob_ptr, size_t blob_size, const uint8_t *digest);
+    //
+    // With `probe_held`, each child is first asked digest-only; the blob is
+    // staged (once) only for children that do not already hold it.
+    std::vector<ControlResult>
+    broadcast_register_all(const void *blob_ptr, size_t blob_size, const uint8_t *digest, bool probe_held = false);
 
     // Best-effort: broadcast CTRL_UNREGISTER for `digest` to every NEXT_LEVEL
     // worker in parallel. Returns a vector of per-worker error strings
@@ -554,6 +628,7 @@ private:
     std::vector<LocalNextLevelEntry> next_level_entries_;
     std::vector<void *> sub_entries_;
     std::vector<std::unique_ptr<WorkerEndpoint>> next_level_endpoint_entries_;
+    std::vector<std::unique_ptr<WorkerEndpoint>> sub_endpoint_entries_;
 
     std::vector<std::unique_ptr<WorkerThread>> next_level_threads_;
     std::vector<std::unique_ptr<WorkerThread>> sub_threads_;
@@ -32,6 +32,8 @@ HostLogger::HostLogger() :
     current_level_(LogLevel::INFO),
     current_info_v_(simpler::log::kDefaultInfoV) {}
 
+HostLogger::~HostLogger() { binlog_.flush(); }
+
 void HostLogger::set_level(LogLevel level) {
     std::scoped_lock lock(mutex_);
     current_level_ = level;
@@ -93,10 +95,24 @@ void HostLogger::emit(const char *level_tag, const char *func, const char *fmt,
     fflush(stderr);
 }
 
+void HostLogger::set_binary_path(const char *path) { binlog_.set_path(path); }
+
+std::string HostLogger::binary_path() const { return binlog_.path(); }
+
+int HostLogger::flush_binary() { return binlog_.flush(); }
+
 void HostLogger::vlog(LogLevel level, const char *func, const char *fmt, va_list args) {
     if (!is_severity_enabled(level)) {
         return;
     }
+    if (binlog_.enabled()) {
+        // encode_args works on a va_copy, so `args` is still intact for the
+        // ERROR text echo below.
+        binlog_.record(static_cast<uint8_t>(level), func, fmt, args);
+        if (level != LogLevel::ERROR) {
+            return;
+        }
+    }
     emit(level_name(level), func, fmt, args);
 }
 
@@ -104,6 +120,10 @@ void HostLogger::vlog_info_v(int v, const char *func, const char *fmt, va_list a
     if (!is_info_v_enabled(v)) {
         return;
     }
+    if (binlog_.enabled()) {
+        binlog_.record(simpler::log::binlog::info_v_tag(v), func, fmt, args);
+        return;
+    }
     char tag[8];
     snprintf(tag, sizeof(tag), "INFO_V%d", v);
     emit(tag, func, fmt, args);
@@ -147,3 +167,16 @@ extern "C" int simpler_log_init(int log_level, int log_info_v) {
     HostLogger::get_instance().set_info_v(log_info_v);
     return 0;
 }
+
+// Binary log mode (see HostLogger::set_binary_path). Called from the Python
+// ChipWorker wrapper when `simpler._log.set_binary_log(path)` is configured,
+// before host_runtime.so is dlopen'd so the sim runner can forward the path
+// to the AICPU SO. Returns 0.
+extern "C" int simpler_log_set_binary(const char *path) {
+    HostLogger::get_instance().set_binary_path(path);
+    return 0;
+}
+
+// Appends pending binary records to the configured file. 0 on success
+// (including nothing pending / text mode), -1 on I/O failure.
+extern "C" int simpler_log_flush_binary() { return HostLogger::get_instance().flush_binary(); }
@@ -0,0 +1,760 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * @file binary_log.h
+ * @brief Deferred-format binary log sink (header-only, host + sim AICPU).
+ *
+ * In binary mode a LOG_* call site does not run vfprintf. It walks the format
+ * string once to pull the raw arguments off the va_list, and copies them into
+ * a fixed-size Record. The record also carries an interned format id, a
+ * monotonic timestamp and the tid. It is pushed into the calling thread's own
+ * SPSC ring, so the hot path takes no lock and, after a call site's first
+ * record, allocates nothing. Formatting happens later, off the critical path:
+ * Sink::flush() appends a self-describing chunk to a file, and
+ * simpler_setup/tools/device_log_resolver.py decodes that chunk.
+ *
+ * Format and function strings are interned by content into a lock-free
+ * table, which keeps its own copy the first time a string is seen, so they
+ * survive the SO that logged them being dlclosed. The table goes out with
+ * every flushed chunk, so the decoder needs no build artifacts.
+ *
+ * Chunk layout (native little-endian, appended; multiple chunks per file):
+ *   ChunkHeader
+ *   nfmt x { uint32 id; uint32 len; char bytes[len] }
+ *   nrec x Record
+ */
+
+#ifndef PLATFORM_BINARY_LOG_H_
+#define PLATFORM_BINARY_LOG_H_
+
+#include <time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace simpler::log::binlog {
+
+constexpr uint32_t kMaxArgs = 12;
+constexpr uint32_t kStrBytes = 136;
+constexpr uint32_t kFormatSlots = 4096;        // power of two
+constexpr uint32_t kRingRecords = 4096;        // power of two; 1 MiB per thread
+constexpr uint32_t kMaxRings = 256;            // concurrently live threads per sink
+constexpr uint64_t kNoString = 0xFFFFFFFFULL;  // %s arg that did not fit / was null
+constexpr char kChunkMagic[8] = {'S', 'I', 'M', 'P', 'L', 'B', 'L', '1'};
+constexpr uint32_t kChunkVersion = 1;
+
+// Level tag stored per record. Severity values mirror simpler::log::LogLevel;
+// INFO records carry their verbosity tier as kTagInfoV0 + v.
+constexpr uint8_t kTagDebug = 0;
+constexpr uint8_t kTagWarn = 2;
+constexpr uint8_t kTagError = 3;
+constexpr uint8_t kTagInfoV0 = 0x10;
+inline uint8_t info_v_tag(int v) { return static_cast<uint8_t>(kTagInfoV0 + (v < 0 ? 0 : (v > 9 ? 9 : v))); }
+
+struct Record {
+    uint64_t ts_ns;      // CLOCK_MONOTONIC
+    uint32_t fmt_id;     // 0 = format table full
+    uint32_t func_id;    // interned __FUNCTION__
+    uint32_t tid;        // gettid()
+    uint8_t tag;         // kTag*
+    uint8_t nargs;       // args captured (<= kMaxArgs)
+    uint16_t str_used;   // bytes of strs[] in use
+    uint64_t args[kMaxArgs];
+    char strs[kStrBytes];  // %s payloads, NUL-terminated; args[i] = offset
+};
+static_assert(sizeof(Record) == 256, "binlog::Record is a wire format; keep it 256 bytes");
+
+struct ChunkHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t nfmt;
+    uint32_t reserved;
+    uint64_t nrec;
+    uint64_t dropped;  // records lost to full rings since the previous chunk
+};
+static_assert(sizeof(ChunkHeader) == 40, "binlog::ChunkHeader is a wire format");
+
+inline uint64_t now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+inline uint32_t current_tid() {
+#ifdef __linux__
+    return static_cast<uint32_t>(syscall(SYS_gettid));
+#else
+    return 0;
+#endif
+}
+
+// =============================================================================
+// printf conversion walker — shared by the encoder and the C++ decoder
+// =============================================================================
+
+enum class ArgKind : uint8_t { None, Signed, Unsigned, Double, String, Pointer, Char, Skip };
+enum class LenMod : uint8_t { None, HH, H, L, LL, J, Z, T, BigL };
+
+// One parsed conversion spec. [begin, end) spans the whole "%...c" text.
+struct Spec {
+    const char *begin;
+    const char *end;
+    bool star_width;
+    bool star_precision;
+    LenMod len;
+    char conv;
+    ArgKind kind;
+};
+
+// Parses the spec whose '%' is at p (p[1] != '%'). Returns false on a
+// malformed tail, in which case encoding stops.
+inline bool parse_spec(const char *p, Spec *out) {
+    Spec s{};
+    s.begin = p++;
+    while (*p != '\0' && std::strchr("-+ #0'", *p) != nullptr) ++p;
+    if (*p == '*') {
+        s.star_width = true;
+        ++p;
+    } else {
+        while (*p >= '0' && *p <= '9') ++p;
+    }
+    if (*p == '.') {
+        ++p;
+        if (*p == '*') {
+            s.star_precision = true;
+            ++p;
+        } else {
+            while (*p >= '0' && *p <= '9') ++p;
+        }
+    }
+    s.len = LenMod::None;
+    switch (*p) {
+    case 'h':
+        s.len = (p[1] == 'h') ? LenMod::HH : LenMod::H;
+        p += (p[1] == 'h') ? 2 : 1;
+        break;
+    case 'l':
+        s.len = (p[1] == 'l') ? LenMod::LL : LenMod::L;
+        p += (p[1] == 'l') ? 2 : 1;
+        break;
+    case 'j':
+        s.len = LenMod::J;
+        ++p;
+        break;
+    case 'z':
+        s.len = LenMod::Z;
+        ++p;
+        break;
+    case 't':
+        s.len = LenMod::T;
+        ++p;
+        break;
+    case 'L':
+        s.len = LenMod::BigL;
+        ++p;
+        break;
+    default:
+        break;
+    }
+    s.conv = *p;
+    switch (s.conv) {
+    case 'd':
+    case 'i':
+        s.kind = ArgKind::Signed;
+        break;
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+        s.kind = ArgKind::Unsigned;
+        break;
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        s.kind = ArgKind::Double;
+        break;
+    case 's':
+        s.kind = ArgKind::String;
+        break;
+    case 'p':
+        s.kind = ArgKind::Pointer;
+        break;
+    case 'c':
+        s.kind = ArgKind::Char;
+        break;
+    case 'n':
+        s.kind = ArgKind::Skip;
+        break;
+    default:
+        return false;
+    }
+    s.end = p + 1;
+    *out = s;
+    return true;
+}
+
+inline int64_t pull_signed(LenMod len, va_list &args) {
+    switch (len) {
+    case LenMod::HH:
+        return static_cast<signed char>(va_arg(args, int));
+    case LenMod::H:
+        return static_cast<short>(va_arg(args, int));
+    case LenMod::L:
+        return va_arg(args, long);
+    case LenMod::LL:
+        return va_arg(args, long long);
+    case LenMod::J:
+        return va_arg(args, intmax_t);
+    case LenMod::Z:
+    case LenMod::T:
+        return va_arg(args, ptrdiff_t);
+    default:
+        return va_arg(args, int);
+    }
+}
+
+inline uint64_t pull_unsigned(LenMod len, va_list &args) {
+    switch (len) {
+    case LenMod::HH:
+        return static_cast<unsigned char>(va_arg(args, unsigned int));
+    case LenMod::H:
+        return static_cast<unsigned short>(va_arg(args, unsigned int));
+    case LenMod::L:
+        return va_arg(args, unsigned long);
+    case LenMod::LL:
+        return va_arg(args, unsigned long long);
+    case LenMod::J:
+        return va_arg(args, uintmax_t);
+    case LenMod::Z:
+    case LenMod::T:
+        return va_arg(args, size_t);
+    default:
+        return va_arg(args, unsigned int);
+    }
+}
+
+// Fills r.args / r.strs from `args` according to `fmt`. Conversions past
+// kMaxArgs are not consumed; the decoder renders them as "<?>".
+inline void encode_args(Record &r, const char *fmt, va_list caller_args) {
+    r.nargs = 0;
+    r.str_used = 0;
+    va_list args;
+    va_copy(args, caller_args);
+    auto push = [&r](uint64_t v) -> bool {
+        if (r.nargs >= kMaxArgs) return false;
+        r.args[r.nargs++] = v;
+        return true;
+    };
+    for (const char *p = fmt; *p != '\0'; ++p) {
+        if (*p != '%') continue;
+        if (p[1] == '%') {
+            ++p;
+            continue;
+        }
+        Spec s;
+        if (!parse_spec(p, &s)) break;
+        if (s.star_width && !push(static_cast<uint64_t>(static_cast<int64_t>(va_arg(args, int))))) break;
+        if (s.star_precision && !push(static_cast<uint64_t>(static_cast<int64_t>(va_arg(args, int))))) break;
+        if (r.nargs >= kMaxArgs) break;
+        switch (s.kind) {
+        case ArgKind::Signed:
+            push(static_cast<uint64_t>(pull_signed(s.len, args)));
+            break;
+        case ArgKind::Unsigned:
+            push(pull_unsigned(s.len, args));
+            break;
+        case ArgKind::Double: {
+            double d = (s.len == LenMod::BigL) ? static_cast<double>(va_arg(args, long double)) : va_arg(args, double);
+            uint64_t bits;
+            std::memcpy(&bits, &d, sizeof(bits));
+            push(bits);
+            break;
+        }
+        case ArgKind::String: {
+            const char *str = va_arg(args, const char *);
+            uint32_t room = kStrBytes - r.str_used;
+            if (str == nullptr || room == 0) {
+                push(kNoString);
+                break;
+            }
+            size_t n = strnlen(str, room - 1);
+            std::memcpy(r.strs + r.str_used, str, n);
+            r.strs[r.str_used + n] = '\0';
+            push(r.str_used);
+            r.str_used = static_cast<uint16_t>(r.str_used + n + 1);
+            break;
+        }
+        case ArgKind::Pointer:
+            push(reinterpret_cast<uintptr_t>(va_arg(args, void *)));
+            break;
+        case ArgKind::Char:
+            push(static_cast<uint64_t>(va_arg(args, int)));
+            break;
+        case ArgKind::Skip:
+            (void)va_arg(args, void *);
+            break;
+        case ArgKind::None:
+            break;
+        }
+        p = s.end - 1;
+    }
+    va_end(args);
+}
+
+// Renders the message body of `r` against its format string. The per-spec
+// snprintf keeps flags/width/precision identical to the text path.
+inline std::string format_record(const Record &r, const char *fmt) {
+    std::string out;
+    if (fmt == nullptr) return "<unknown format>";
+    uint32_t ai = 0;
+    auto next = [&r, &ai](uint64_t *v) -> bool {
+        if (ai >= r.nargs) return false;
+        *v = r.args[ai++];
+        return true;
+    };
+    char buf[512];
+    for (const char *p = fmt; *p != '\0'; ++p) {
+        if (*p != '%') {
+            out.push_back(*p);
+            continue;
+        }
+        if (p[1] == '%') {
+            out.push_back('%');
+            ++p;
+            continue;
+        }
+        Spec s;
+        if (!parse_spec(p, &s)) {
+            out.append(p);
+            break;
+        }
+        p = s.end - 1;
+        // Rebuild the spec without length modifiers and with '*' resolved.
+        std::string spec;
+        uint64_t v = 0;
+        bool missing = false;
+        for (const char *q = s.begin; q < s.end - 1; ++q) {
+            if (*q == '*') {
+                if (!next(&v)) missing = true;
+                spec += std::to_string(static_cast<int64_t>(v));
+            } else if (std::strchr("hljztL", *q) == nullptr) {
+                spec.push_back(*q);
+            }
+        }
+        if (s.kind == ArgKind::Skip) continue;
+        if (missing || !next(&v)) {
+            out += "<?>";
+            continue;
+        }
+        switch (s.kind) {
+        case ArgKind::Signed:
+            spec += "ll";
+            spec.push_back(s.conv);
+            snprintf(buf, sizeof(buf), spec.c_str(), static_cast<long long>(v));
+            break;
+        case ArgKind::Unsigned:
+            spec += "ll";
+            spec.push_back(s.conv);
+            snprintf(buf, sizeof(buf), spec.c_str(), static_cast<unsigned long long>(v));
+            break;
+        case ArgKind::Double: {
+            double d;
+            std::memcpy(&d, &v, sizeof(d));
+            spec.push_back(s.conv);
+            snprintf(buf, sizeof(buf), spec.c_str(), d);
+            break;
+        }
+        case ArgKind::String:
+            spec.push_back('s');
+            snprintf(
+                buf, sizeof(buf), spec.c_str(),
+                (v == kNoString || v >= r.str_used) ? "(null)" : r.strs + static_cast<size_t>(v)
+            );
+            break;
+        case ArgKind::Pointer:
+            spec.push_back('p');
+            snprintf(buf, sizeof(buf), spec.c_str(), reinterpret_cast<void *>(static_cast<uintptr_t>(v)));
+            break;
+        case ArgKind::Char:
+            spec.push_back('c');
+            snprintf(buf, sizeof(buf), spec.c_str(), static_cast<int>(v));
+            break;
+        default:
+            buf[0] = '\0';
+            break;
+        }
+        out += buf;
+    }
+    return out;
+}
+
+// =============================================================================
+// Format table — lock-free content interning
+// =============================================================================
+
+// Keyed by content, and each entry owns a copy of its string. Format and
+// __FUNCTION__ strings live in whichever SO made the call (host runtime,
+// orchestration SO), and those are dlclosed while the sink lives on; a later
+// SO may even map a different string at the same address.
+class FormatTable {
+public:
+    FormatTable() = default;
+    ~FormatTable() {
+        for (auto &slot : slots_)
+            delete slot.load(std::memory_order_acquire);
+    }
+
+    FormatTable(const FormatTable &) = delete;
+    FormatTable &operator=(const FormatTable &) = delete;
+
+    // Returns a stable non-zero id for the contents of `s`, or 0 when the
+    // table is full. Allocates only the first time a string is seen.
+    uint32_t intern(const char *s) {
+        if (s == nullptr) return 0;
+        uint64_t h = 0xCBF29CE484222325ULL;  // FNV-1a
+        size_t len = 0;
+        for (; s[len] != '\0'; ++len) {
+            h ^= static_cast<uint8_t>(s[len]);
+            h *= 0x100000001B3ULL;
+        }
+        Entry *fresh = nullptr;
+        uint32_t slot = static_cast<uint32_t>(h >> 40) & (kFormatSlots - 1);
+        for (uint32_t probe = 0; probe < kFormatSlots; ++probe, slot = (slot + 1) & (kFormatSlots - 1)) {
+            Entry *cur = slots_[slot].load(std::memory_order_acquire);
+            if (cur == nullptr) {
+                if (fresh == nullptr) fresh = new Entry{h, std::string(s, len)};
+                if (slots_[slot].compare_exchange_strong(cur, fresh, std::memory_order_acq_rel)) return slot + 1;
+            }
+            if (cur->hash == h && cur->text.size() == len && std::memcmp(cur->text.data(), s, len) == 0) {
+                delete fresh;
+                return slot + 1;
+            }
+        }
+        delete fresh;
+        return 0;
+    }
+
+    const char *lookup(uint32_t id) const {
+        if (id == 0 || id > kFormatSlots) return nullptr;
+        const Entry *e = slots_[id - 1].load(std::memory_order_acquire);
+        return e != nullptr ? e->text.c_str() : nullptr;
+    }
+
+    template <typename F>
+    void for_each(F &&fn) const {
+        for (uint32_t i = 0; i < kFormatSlots; ++i) {
+            const Entry *e = slots_[i].load(std::memory_order_acquire);
+            if (e != nullptr) fn(i + 1, e->text);
+        }
+    }
+
+private:
+    struct Entry {
+        uint64_t hash;
+        std::string text;
+    };
+    std::atomic<Entry *> slots_[kFormatSlots]{};
+};
+
+// =============================================================================
+// Per-thread SPSC ring. Producer = owning thread, consumer = Sink::flush().
+// Full ring drops the new record (producer never blocks) and counts it.
+// A ring outlives its thread: on thread exit it is released, keeps any
+// undrained records for the next flush, and is handed to the next thread
+// that asks the sink for a ring.
+// =============================================================================
+
+class Ring {
+public:
+    Ring() :
+        slots_(new Record[kRingRecords]) {}
+
+    Record *claim() {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) >= kRingRecords) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        return &slots_[head & (kRingRecords - 1)];
+    }
+
+    void commit() { head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+    template <typename F>
+    void drain(F &&fn) {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        uint64_t head = head_.load(std::memory_order_acquire);
+        for (; tail != head; ++tail) {
+            fn(slots_[tail & (kRingRecords - 1)]);
+        }
+        tail_.store(tail, std::memory_order_release);
+    }
+
+    uint64_t take_dropped() { return dropped_.exchange(0, std::memory_order_relaxed); }
+
+    // Ownership hand-off between producer threads. The acquire/release pair
+    // orders the previous owner's last head_ store before the next owner's
+    // first claim().
+    bool try_acquire() {
+        bool expected = false;
+        return owned_.compare_exchange_strong(expected, true, std::memory_order_acquire);
+    }
+    void release() { owned_.store(false, std::memory_order_release); }
+
+private:
+    std::unique_ptr<Record[]> slots_;
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<bool> owned_{true};
+};
+
+// =============================================================================
+// Sink — owns the format table and one ring per logging thread
+// =============================================================================
+
+class Sink {
+public:
+    Sink() :
+        id_(next_sink_id().fetch_add(1, std::memory_order_relaxed) + 1) {
+        std::scoped_lock lock(registry_mutex());
+        registry().push_back(this);
+    }
+
+    ~Sink() {
+        {
+            std::scoped_lock lock(registry_mutex());
+            auto &r = registry();
+            r.erase(std::remove(r.begin(), r.end(), this), r.end());
+        }
+        for (uint32_t i = 0; i < kMaxRings; ++i) {
+            delete rings_[i].load(std::memory_order_acquire);
+        }
+    }
+
+    Sink(const Sink &) = delete;
+    Sink &operator=(const Sink &) = delete;
+
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Enables binary mode, appending flushed chunks to `path`. nullptr or ""
+    // flushes what is pending and returns to text mode.
+    void set_path(const char *path) {
+        std::scoped_lock lock(flush_mutex_);
+        if (!path_.empty()) flush_locked();
+        path_ = (path != nullptr) ? path : "";
+        enabled_.store(!path_.empty(), std::memory_order_relaxed);
+    }
+
+    std::string path() const {
+        std::scoped_lock lock(flush_mutex_);
+        return path_;
+    }
+
+    // Hot path. Caller owns va_start/va_end; `args` is consumed.
+    void record(uint8_t tag, const char *func, const char *fmt, va_list args) {
+        Ring *ring = thread_ring();
+        if (ring == nullptr) return;
+        Record *r = ring->claim();
+        if (r == nullptr) return;
+        r->ts_ns = now_ns();
+        r->fmt_id = formats_.intern(fmt);
+        r->func_id = formats_.intern(func);
+        r->tid = tls_tid();
+        r->tag = tag;
+        encode_args(*r, fmt, args);
+        ring->commit();
+    }
+
+    // Drains every ring into one chunk appended to path(). Returns 0 on
+    // success (including "nothing to write"), -1 on I/O failure.
+    int flush() {
+        std::scoped_lock lock(flush_mutex_);
+        return flush_locked();
+    }
+
+    const FormatTable &formats() const { return formats_; }
+
+private:
+    // A thread usually logs into one or two sinks (host + sim AICPU), so a
+    // tiny per-thread map is enough to keep the ring lookup off any lock.
+    // The cache destructor runs at thread exit and hands the thread's rings
+    // back to their sinks, so short-lived threads (sim spawns fresh AICPU /
+    // AICore threads every run) do not exhaust kMaxRings.
+    static constexpr uint32_t kTlsEntries = 4;
+    struct TlsCache {
+        uint64_t sink_id[kTlsEntries];
+        Ring *ring[kTlsEntries];
+        uint32_t next_victim;
+        uint32_t tid;
+
+        ~TlsCache() {
+            for (uint32_t i = 0; i < kTlsEntries; ++i) {
+                if (sink_id[i] != 0) release_ring(sink_id[i], ring[i]);
+            }
+        }
+    };
+
+    static std::atomic<uint64_t> &next_sink_id() {
+        static std::atomic<uint64_t> id{0};
+        return id;
+    }
+
+    // Live sinks, so a thread exiting after its sink was destroyed does not
+    // touch a freed ring. Only the cold paths (sink ctor/dtor, thread exit,
+    // TLS eviction) take this lock.
+    static std::mutex &registry_mutex() {
+        static std::mutex mu;
+        return mu;
+    }
+    static std::vector<Sink *> &registry() {
+        static std::vector<Sink *> sinks;
+        return sinks;
+    }
+
+    static void release_ring(uint64_t sink_id, Ring *ring) {
+        std::scoped_lock lock(registry_mutex());
+        for (Sink *s : registry()) {
+            if (s->id_ == sink_id) {
+                ring->release();
+                return;
+            }
+        }
+    }
+
+    static TlsCache &tls() {
+        static thread_local TlsCache cache{};
+        return cache;
+    }
+
+    static uint32_t tls_tid() {
+        TlsCache &c = tls();
+        if (c.tid == 0) c.tid = current_tid();
+        return c.tid;
+    }
+
+    // Cold path on a thread's first record per sink: reuse a ring released
+    // by an exited thread, else allocate and publish a new one.
+    Ring *thread_ring() {
+        TlsCache &c = tls();
+        for (uint32_t i = 0; i < kTlsEntries; ++i) {
+            if (c.sink_id[i] == id_) return c.ring[i];
+        }
+        Ring *ring = nullptr;
+        uint32_t n = std::min(ring_count_.load(std::memory_order_acquire), kMaxRings);
+        for (uint32_t i = 0; i < n && ring == nullptr; ++i) {
+            Ring *cand = rings_[i].load(std::memory_order_acquire);
+            if (cand != nullptr && cand->try_acquire()) ring = cand;
+        }
+        if (ring == nullptr) {
+            uint32_t idx = ring_count_.fetch_add(1, std::memory_order_relaxed);
+            if (idx >= kMaxRings) {
+                ring_count_.fetch_sub(1, std::memory_order_relaxed);
+                overflow_dropped_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            ring = new Ring();
+            rings_[idx].store(ring, std::memory_order_release);
+        }
+        uint32_t slot = c.next_victim++ % kTlsEntries;
+        if (c.sink_id[slot] != 0) release_ring(c.sink_id[slot], c.ring[slot]);
+        c.sink_id[slot] = id_;
+        c.ring[slot] = ring;
+        return ring;
+    }
+
+    int flush_locked() {
+        if (path_.empty()) return 0;
+        std::vector<Record> recs;
+        uint64_t dropped = overflow_dropped_.exchange(0, std::memory_order_relaxed);
+        uint32_t n = std::min(ring_count_.load(std::memory_order_acquire), kMaxRings);
+        for (uint32_t i = 0; i < n; ++i) {
+            Ring *ring = rings_[i].load(std::memory_order_acquire);
+            if (ring == nullptr) continue;
+            ring->drain([&recs](const Record &r) {
+                recs.push_back(r);
+            });
+            dropped += ring->take_dropped();
+        }
+        if (recs.empty() && dropped == 0) return 0;
+        if (dropped != 0 && !drop_warned_) {
+            // Once per sink; later losses are still counted in each chunk's
+            // `dropped` field.
+            drop_warned_ = true;
+            fprintf(
+                stderr, "[binlog] %llu record(s) dropped: a thread ring (%u records) filled between flushes or "
+                        "more than %u threads were logging at once\n",
+                static_cast<unsigned long long>(dropped), kRingRecords, kMaxRings
+            );
+        }
+        std::stable_sort(recs.begin(), recs.end(), [](const Record &a, const Record &b) {
+            return a.ts_ns < b.ts_ns;
+        });
+
+        std::vector<std::pair<uint32_t, const std::string *>> fmts;
+        formats_.for_each([&fmts](uint32_t id, const std::string &s) {
+            fmts.emplace_back(id, &s);
+        });
+
+        FILE *f = fopen(path_.c_str(), "ab");
+        if (f == nullptr) return -1;
+        ChunkHeader h{};
+        std::memcpy(h.magic, kChunkMagic, sizeof(h.magic));
+        h.version = kChunkVersion;
+        h.record_size = sizeof(Record);
+        h.nfmt = static_cast<uint32_t>(fmts.size());
+        h.nrec = recs.size();
+        h.dropped = dropped;
+        bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+        for (const auto &[id, s] : fmts) {
+            uint32_t entry[2] = {id, static_cast<uint32_t>(s->size())};
+            ok = ok && fwrite(entry, sizeof(entry), 1, f) == 1;
+            ok = ok && (entry[1] == 0 || fwrite(s->data(), entry[1], 1, f) == 1);
+        }
+        ok = ok && (recs.empty() || fwrite(recs.data(), sizeof(Record), recs.size(), f) == recs.size());
+        ok = (fclose(f) == 0) && ok;
+        return ok ? 0 : -1;
+    }
+
+    const uint64_t id_;
+    std::atomic<bool> enabled_{false};
+    FormatTable formats_;
+    std::atomic<Ring *> rings_[kMaxRings]{};
+    std::atomic<uint32_t> ring_count_{0};
+    std::atomic<uint64_t> overflow_dropped_{0};
+    bool drop_warned_ = false;  // guarded by flush_mutex_
+    mutable std::mutex flush_mutex_;
+    std::string path_;
+};
+
+}  // namespace simpler::log::binlog
+
+#endif  // PLATFORM_BINARY_LOG_H_
@@ -28,6 +28,9 @@
 #include <cstdarg>
 #include <cstdio>
 #include <mutex>
+#include <string>
+
+#include "common/binary_log.h"
 
 namespace simpler::log {
 
@@ -78,9 +81,20 @@ public:
     bool is_severity_enabled(simpler::log::LogLevel level) const;
     bool is_info_v_enabled(int v) const;
 
+    // Binary (deferred-format) mode. A non-empty path routes every enabled
+    // record into a per-thread ring instead of formatting it on stderr;
+    // ERROR is additionally emitted as text so failures stay visible.
+    // flush_binary() appends the pending records to `path` as one chunk
+    // (decode with simpler_setup/tools/device_log_resolver.py). nullptr / ""
+    // flushes and returns to text mode. The sim runner forwards the same path
+    // to the AICPU SO so device records land in the same file.
+    void set_binary_path(const char *path);
+    std::string binary_path() const;
+    int flush_binary();
+
 private:
     HostLogger();
-    ~HostLogger() = default;
+    ~HostLogger();
 
     HostLogger(const HostLogger &) = delete;
     HostLogger &operator=(const HostLogger &) = delete;
@@ -93,6 +107,7 @@ private:
     simpler::log::LogLevel current_level_;
     int current_info_v_;
     std::mutex mutex_;
+    simpler::log::binlog::Sink binlog_;
 };
 
 #endif  // PLATFORM_HOST_LOG_H_
@@ -68,6 +68,13 @@ extern "C" void set_log_level(int level);
 extern "C" void set_log_info_v(int v);
 extern "C" int get_log_info_v();
 
+// Binary (deferred-format) log mode. Sim only: the host runner dlsym's these
+// and forwards HostLogger's binary path, so AICPU records are appended to the
+// same file as host records. Onboard keeps text mode (the stubs are no-ops)
+// until there is a device-to-host channel for the rings.
+extern "C" void set_log_binary_path(const char *path);
+extern "C" int flush_log_binary();
+
 // =============================================================================
 // Platform-specific logging functions (low-level layer)
 //
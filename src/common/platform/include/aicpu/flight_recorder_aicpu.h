@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "common/flight_recorder.h"
+
+// Flight recorder — platform-owned, runtime-agnostic.
+//
+// Runtime calls pure-value APIs at dispatch / FIN / scope / allocator-block
+// points; each call writes one 16 B FlightRecord into the calling thread's
+// overwrite ring (see common/flight_recorder.h). There is no enable flag and
+// no host handshake: the recorder is on whenever the host mapped a region, and
+// a null base turns every probe into a single predictable branch.
+//
+// set_platform_flight_recorder_base is exported unconditionally so the
+// host-side sim DeviceRunner's dlsym always resolves.
+
+extern "C" {
+
+// Map the shared region (0 = recorder off). Does not touch ring contents, so
+// history survives across runs.
+void set_platform_flight_recorder_base(uint64_t flight_recorder_data_base);
+
+// Append one record to ring `thread_idx`. `task_id` is a raw PTO2 task id
+// (ring in the high word) or a plain value for non-task events.
+void flight_recorder_record(int thread_idx, uint32_t kind, uint64_t task_id, uint32_t aux);
+
+// Record which AICPU thread runs the orchestrator, so orchestrator-side probes
+// (which have no thread index in scope) land in the right ring. Mirrors
+// scope_stats_aicpu_set_orch_thread_idx.
+void flight_recorder_set_orch_thread_idx(int thread_idx);
+
+// flight_recorder_record on the orchestrator's ring.
+void flight_recorder_orch_record(uint32_t kind, uint64_t task_id, uint32_t aux);
+
+}  // extern "C"
@@ -18,7 +18,8 @@
  * Platform Support (same shape for both arches):
  * - onboard: pid-based naming via open() with mode 0755. AICPU device libc
  *   may not provide mkstemps, and only one runtime runs per device process.
- * - sim: mkstemps() with fchmod(0755). Multiple sim workers can share a
+ * - sim: anonymous memfd exposed as /proc/self/fd/<N> (Linux), falling back
+ *   to mkstemps() with fchmod(0755). Multiple sim workers can share a
  *   process, so names must be unique per call.
  */
 
@@ -54,4 +55,17 @@
 int32_t
 create_orch_so_file(const char *dir, int32_t callable_id, int32_t device_id, char *out_path, size_t out_path_size);
 
+/**
+ * Release a path previously returned by create_orch_so_file.
+ *
+ * Call once the SO is no longer needed (dlclose'd, or staging failed).
+ * onboard unlinks the file. sim closes the backing memfd, which must stay
+ * open while the image is dlopen'd: glibc dedups dlopen by path string, so
+ * a recycled /proc/self/fd/<N> would otherwise resolve to the stale handle.
+ * Unknown or already-released paths are ignored.
+ *
+ * @param path  Path written into `out_path` by create_orch_so_file
+ */
+void release_orch_so_file(const char *path);
+
 #endif  // SRC_COMMON_PLATFORM_INCLUDE_AICPU_ORCH_SO_FILE_H_
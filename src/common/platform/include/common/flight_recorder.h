@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file flight_recorder.h
+ * @brief Always-on flight-recorder shared-memory layout.
+ *
+ * Unlike the streaming collectors (l2_swimlane, PMU, dump, scope_stats), the
+ * flight recorder has no free/ready queues and no host mgmt thread. Each
+ * AICPU thread owns one fixed-size overwrite ring of compact FlightRecords;
+ * the writer never blocks and never drops, it just overwrites the oldest
+ * record. The host copies the whole region back only on demand (slow step,
+ * failed run, or an explicit dump request) while the device is idle.
+ *
+ *   FlightRecorderHeader — magic/version/geometry + error latch.
+ *   FlightRecorderRing   — per-thread monotonic head + record array.
+ *
+ * Rings are not reset between runs, so a snapshot also carries the tail of
+ * the previous runs on that device. Records are ordered by head within a
+ * ring; the host merges rings by timestamp.
+ *
+ * Concurrency contract: each ring has exactly one AICPU writer (the thread
+ * that owns the index). The host reads only between runs, so plain stores
+ * are enough and the hot path carries no barriers.
+ */
+
+#ifndef PLATFORM_COMMON_FLIGHT_RECORDER_H_
+#define PLATFORM_COMMON_FLIGHT_RECORDER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common/platform_config.h"
+
+#define FLIGHT_RECORDER_MAGIC 0x43455246u  // "FREC"
+#define FLIGHT_RECORDER_VERSION 1u
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Event kinds. `arg` / `ring_id` carry the low / high halves of a PTO2 task id
+// unless noted otherwise.
+#define FLIGHT_RECORDER_EVENT_RUN_BEGIN 1     // Thread entered the executor. aux = 1 for the orchestrator.
+#define FLIGHT_RECORDER_EVENT_RUN_END 2       // Thread left the executor. arg = return code.
+#define FLIGHT_RECORDER_EVENT_DISPATCH 3      // Subtask handed to a core. aux = core id.
+#define FLIGHT_RECORDER_EVENT_FIN 4           // Task retired by the scheduler. aux = core id.
+#define FLIGHT_RECORDER_EVENT_SCOPE_BEGIN 5   // Orchestrator scope opened. arg = next task id, aux = depth.
+#define FLIGHT_RECORDER_EVENT_SCOPE_END 6     // Orchestrator scope closed. arg = next task id, aux = depth.
+#define FLIGHT_RECORDER_EVENT_ALLOC_BLOCK 7   // Task allocator started spinning. aux = FLIGHT_RECORDER_ALLOC_*.
+#define FLIGHT_RECORDER_EVENT_ALLOC_RESUME 8  // Task allocator got its slot. aux = FLIGHT_RECORDER_ALLOC_*.
+#define FLIGHT_RECORDER_EVENT_ERROR 9         // Fatal error reported. arg = error code. Latches the header.
+
+// Resource the allocator was blocked on (aux of ALLOC_BLOCK / ALLOC_RESUME).
+#define FLIGHT_RECORDER_ALLOC_TASK_WINDOW 0
+#define FLIGHT_RECORDER_ALLOC_HEAP 1
+
+// One event. Layout MUST stay in sync with the device-side writer in
+// platform/shared/aicpu/flight_recorder_aicpu.cpp and the host decoder in
+// platform/shared/host/flight_recorder.cpp. Kept at 16 B so a record is one
+// timestamp read plus two stores on the hot path.
+struct FlightRecord {
+    uint64_t timestamp;  // get_sys_cnt_aicpu() ticks
+    uint32_t arg;        // Task local id / error code / return code (see event kinds)
+    uint16_t aux;        // Core id / scope depth / allocator resource
+    uint8_t ring_id;     // Task ring of the PTO2 task id (0 when not a task event)
+    uint8_t kind;        // FLIGHT_RECORDER_EVENT_*; 0 = never written
+};
+
+static_assert(sizeof(FlightRecord) == 16, "FlightRecord must stay 16 bytes");
+
+// Per-thread overwrite ring. `head` counts every record ever written; the
+// slot of record n is n & (PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD - 1),
+// so the live window is [max(0, head - N), head).
+struct FlightRecorderRing {
+    volatile uint64_t head;
+    uint64_t _pad[7];  // Keep head on its own cache line.
+
+    FlightRecord records[PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD];
+} __attribute__((aligned(64)));
+
+static_assert(offsetof(FlightRecorderRing, records) == 64, "FlightRecorderRing header must be exactly 64 bytes");
+
+// Region header, written by the host once when the region is allocated.
+// The geometry fields let a snapshot be decoded without knowing the arch.
+struct FlightRecorderHeader {
+    uint32_t magic;             // FLIGHT_RECORDER_MAGIC
+    uint32_t version;           // FLIGHT_RECORDER_VERSION
+    uint32_t num_rings;         // PLATFORM_MAX_AICPU_THREADS
+    uint32_t records_per_ring;  // PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD
+    volatile uint32_t error_latched;  // AICPU sets to 1 on the first ERROR event; sticky for the region's lifetime.
+    uint32_t _pad[11];
+} __attribute__((aligned(64)));
+
+// =============================================================================
+// Memory layout helpers
+// =============================================================================
+
+inline size_t calc_flight_recorder_size(int num_rings) {
+    return sizeof(FlightRecorderHeader) + static_cast<size_t>(num_rings) * sizeof(FlightRecorderRing);
+}
+
+inline FlightRecorderHeader *get_flight_recorder_header(void *base_ptr) {
+    return reinterpret_cast<FlightRecorderHeader *>(base_ptr);
+}
+
+inline FlightRecorderRing *get_flight_recorder_ring(void *base_ptr, int ring_index) {
+    return reinterpret_cast<FlightRecorderRing *>(reinterpret_cast<char *>(base_ptr) + sizeof(FlightRecorderHeader)) +
+           ring_index;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // PLATFORM_COMMON_FLIGHT_RECORDER_H_
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file prof_dirty_summary.h
+ * @brief Device-published dirty summary for host-shadow profiling shm.
+ *
+ * On host-shadow platforms (a5) the host mgmt loop used to pull the whole
+ * profiling shm region every tick. A subsystem that embeds a
+ * ProfDirtySummary in its shm lets the host fetch only the ranges whose
+ * generation word moved since the previous tick.
+ *
+ * Each slot maps to one byte range of the shm (e.g. one `queue_tails[q]`
+ * word or one per-core BufferState); the mapping lives on the host-side
+ * Module (`dirty_slot_range`). Protocol:
+ *
+ *   Device:  write the field(s) of slot s → prof_dirty_mark(summary, s)
+ *            (wmb, then gen[s]++). prof_dirty_publish() once at init, after
+ *            which the host trusts gen[].
+ *   Host:    pull the summary; for every slot whose gen differs from the
+ *            last value seen, pull that slot's range. A range read after
+ *            the gen read observes at least the writes that bumped it.
+ *
+ * A summary that was never published (magic != PROF_DIRTY_SUMMARY_MAGIC)
+ * makes the host fall back to the bulk mirror, so an AICPU build that
+ * does not maintain it stays correct.
+ *
+ * Each gen word must have a single device-side writer (one AICPU thread per
+ * ready queue / per core), so the plain increment needs no atomics.
+ */
+
+#ifndef SRC_COMMON_PLATFORM_INCLUDE_COMMON_PROF_DIRTY_SUMMARY_H_
+#define SRC_COMMON_PLATFORM_INCLUDE_COMMON_PROF_DIRTY_SUMMARY_H_
+
+#include <cstdint>
+
+#include "common/memory_barrier.h"
+
+constexpr uint32_t PROF_DIRTY_SUMMARY_MAGIC = 0x59545244;  // "DRTY"
+
+template <int kSlots>
+struct ProfDirtySummary {
+    volatile uint32_t magic;        // PROF_DIRTY_SUMMARY_MAGIC once the device maintains gen[]
+    volatile uint32_t slot_count;   // kSlots, cross-checked by the host
+    uint32_t pad[14];               // Pad header to 64 bytes
+    volatile uint32_t gen[kSlots];  // Bumped by the device after each publish to slot s
+} __attribute__((aligned(64)));
+
+/**
+ * Bump slot `slot` after its fields have been written. The leading wmb()
+ * orders the field stores before the generation store.
+ */
+template <int kSlots>
+inline void prof_dirty_mark(ProfDirtySummary<kSlots> *summary, int slot) {
+    if (summary == nullptr || slot < 0 || slot >= kSlots) return;
+    wmb();
+    summary->gen[slot] = summary->gen[slot] + 1;
+}
+
+/**
+ * Declare the summary live. Called once by the device after its init pass
+ * has marked every slot it touched.
+ */
+template <int kSlots>
+inline void prof_dirty_publish(ProfDirtySummary<kSlots> *summary) {
+    if (summary == nullptr) return;
+    summary->slot_count = static_cast<uint32_t>(kSlots);
+    wmb();
+    summary->magic = PROF_DIRTY_SUMMARY_MAGIC;
+    wmb();
+}
+
+#endif  // SRC_COMMON_PLATFORM_INCLUDE_COMMON_PROF_DIRTY_SUMMARY_H_
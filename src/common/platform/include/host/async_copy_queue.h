@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file async_copy_queue.h
+ * @brief Completion-token queue behind the async host<->device copy API.
+ *
+ * A DeviceRunner owns one AsyncCopyQueue. `copy_to_device_async` /
+ * `copy_from_device_async` submit a job and return a token immediately; one
+ * dedicated thread (spawned through the runner's device-bound thread
+ * factory) executes jobs in submission order. The platform decides what a
+ * job does:
+ *   - onboard: chunked, double-buffered transfer through pinned staging
+ *     slots on a dedicated stream (PinnedStagingPool);
+ *   - sim:     a striped memcpy across StripedMemcpyPool lanes.
+ *
+ * Tokens are positive and strictly increasing. Because jobs retire in FIFO
+ * order, "token t is done" is simply `t <= completed`; failures are kept
+ * per token so a caller waiting on any token sees its own rc.
+ *
+ * The caller keeps the host buffer alive and unmodified until the token is
+ * done. Async copies are not ordered against `run()`: a consumer must wait
+ * the token (the L3 scheduler treats it as a dependency) before launching
+ * work that reads the data.
+ */
+
+#ifndef SRC_COMMON_PLATFORM_INCLUDE_HOST_ASYNC_COPY_QUEUE_H_
+#define SRC_COMMON_PLATFORM_INCLUDE_HOST_ASYNC_COPY_QUEUE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class AsyncCopyQueue {
+public:
+    using Job = std::function<int()>;
+    using ThreadFactory = std::function<std::thread(std::function<void()>)>;
+
+    AsyncCopyQueue() = default;
+    ~AsyncCopyQueue() { stop(); }
+    AsyncCopyQueue(const AsyncCopyQueue &) = delete;
+    AsyncCopyQueue &operator=(const AsyncCopyQueue &) = delete;
+
+    /** Spawn the copy thread via `spawn`. No-op when already running. */
+    void start(const ThreadFactory &spawn);
+
+    bool running() const;
+
+    /** Enqueue `job`. Returns its token, or 0 when the queue is not running. */
+    uint64_t submit(Job job);
+
+    /**
+     * Block until `token` is done. Returns the job's rc (0 on success), or -1
+     * for a token this queue never issued.
+     */
+    int wait(uint64_t token);
+
+    /** 1 = done OK, 0 = pending, negative = the job's error rc (-1 also for unknown tokens). */
+    int query(uint64_t token);
+
+    /**
+     * Block until every job submitted so far is done. Returns the rc of the
+     * earliest job that failed since the previous wait_all, else 0.
+     */
+    int wait_all();
+
+    /** Finish queued jobs, then join the copy thread. Idempotent. */
+    void stop();
+
+private:
+    void loop();
+
+    mutable std::mutex mu_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+    std::deque<std::pair<uint64_t, Job>> pending_;
+    std::unordered_map<uint64_t, int> failed_;  // token -> rc, only for failed jobs
+    uint64_t next_token_{1};
+    uint64_t completed_{0};
+    uint64_t drained_upto_{0};  // wait_all high-water mark
+    bool running_{false};
+    bool stopping_{false};
+    std::thread worker_;
+};
+
+/**
+ * Persistent memcpy lanes for the sim async copy path. `copy` stripes one
+ * buffer across the helper threads plus the calling thread and returns when
+ * all stripes are done. One `copy` at a time (the AsyncCopyQueue thread is
+ * the only caller).
+ */
+class StripedMemcpyPool {
+public:
+    StripedMemcpyPool() = default;
+    ~StripedMemcpyPool() { stop(); }
+    StripedMemcpyPool(const StripedMemcpyPool &) = delete;
+    StripedMemcpyPool &operator=(const StripedMemcpyPool &) = delete;
+
+    /** Start `lanes - 1` helper threads. No-op when already started. */
+    void start(int lanes);
+    void stop();
+
+    /** memcpy `bytes` in stripes of at least `min_stripe` bytes. */
+    void copy(void *dst, const void *src, size_t bytes, size_t min_stripe);
+
+private:
+    void helper_loop();
+    void run_stripes();
+
+    std::mutex mu_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    std::vector<std::thread> helpers_;
+    bool stopping_{false};
+    uint64_t generation_{0};
+
+    // Current job; written under mu_ before generation_ is bumped.
+    char *dst_{nullptr};
+    const char *src_{nullptr};
+    size_t bytes_{0};
+    size_t stripe_bytes_{0};
+    size_t num_stripes_{0};
+    size_t next_stripe_{0};
+    size_t stripes_done_{0};
+};
+
+#endif  // SRC_COMMON_PLATFORM_INCLUDE_HOST_ASYNC_COPY_QUEUE_H_
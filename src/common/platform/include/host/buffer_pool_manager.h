@@ -48,6 +48,15 @@
  *      `copy_buffer_from_device` inside ProfilerAlgorithms::process_entry
  *      before delivering it to the collector.
  *
+ * Dirty-range refresh: Modules that embed a device-published
+ * ProfDirtySummary (common/prof_dirty_summary.h) in their shm expose
+ * `kDirtySlots` / `dirty_summary_from_shm` / `dirty_slot_range`. The mgmt
+ * loop then calls `refresh_shm_from_device`, which pulls the summary and
+ * only the slot ranges whose generation moved since the last tick instead
+ * of the whole region. Modules without a summary, a summary the device has
+ * not published yet, and `SIMPLER_PROF_FULL_MIRROR=1` all take the bulk
+ * `mirror_shm_from_device` path.
+ *
  * `release_owned_buffers` frees both the device pointer (via `release_fn`)
  * and any paired host shadow that the framework itself malloc'd. Ownership
  * is tracked explicitly in `malloc_shadows_`: only shadows allocated via
@@ -86,6 +95,8 @@
 #include <utility>
 #include <vector>
 
+#include "common/memory_barrier.h"
+#include "common/prof_dirty_summary.h"
 #include "common/unified_log.h"
 
 namespace profiling_common {
@@ -137,6 +148,26 @@ struct DoneInfo {
     int kind;  // [0, Module::kBufferKinds)
 };
 
+/**
+ * A byte range of the host shm shadow, returned by
+ * `Module::dirty_slot_range`. `size == 0` means the slot maps to nothing
+ * (e.g. a per-core slot past the configured core count).
+ */
+struct ShmRange {
+    volatile void *ptr;
+    size_t size;
+};
+
+// Detects the optional dirty-summary traits on a Module.
+template <typename Module, typename = void>
+struct HasDirtySummary : std::false_type {};
+
+template <typename Module>
+struct HasDirtySummary<
+    Module, std::void_t<
+                decltype(Module::kDirtySlots), decltype(Module::dirty_summary_from_shm(nullptr)),
+                decltype(Module::dirty_slot_range(nullptr, 0))>> : std::true_type {};
+
 template <typename Module>
 class BufferPoolManager {
     // Static checks for the Module concept. Required type aliases trigger
@@ -177,8 +208,22 @@ public:
         shared_mem_host_ = shared_mem_host;
         shm_size_ = shm_size;
         device_id_ = device_id;
+        const char *full_env = std::getenv("SIMPLER_PROF_FULL_MIRROR");
+        full_mirror_ = full_env != nullptr && full_env[0] != '\0' && full_env[0] != '0';
+        if constexpr (HasDirtySummary<Module>::value) {
+            dirty_seen_.assign(Module::kDirtySlots, 0);
+        }
     }
 
+    /**
+     * Force the bulk `mirror_shm_from_device` path in
+     * `refresh_shm_from_device` even when the Module publishes a dirty
+     * summary. Defaults to `SIMPLER_PROF_FULL_MIRROR` at
+     * set_memory_context() time. Mgmt-thread only.
+     */
+    void set_full_mirror(bool full) { full_mirror_ = full; }
+    bool full_mirror() const { return full_mirror_; }
+
     /**
      * Release every device buffer the framework currently owns: recycled
      * pools, done_queue, and ready_queue. Buffers still in the per-pool
@@ -311,6 +356,33 @@ public:
         return ops_.copy_from_device(shared_mem_host_, shared_mem_dev_, shm_size_);
     }
 
+    /**
+     * Per-tick refresh of the host shadow. For Modules with a dirty summary
+     * this pulls the summary, then every slot range whose generation word
+     * differs from the value seen on the previous refresh. Falls back to
+     * `mirror_shm_from_device` when the Module has no summary, the device
+     * has not published one (magic / slot_count mismatch), or full-mirror
+     * mode is on. In the fallback the observed generations are still
+     * recorded, so a later switch to the incremental path does not re-pull
+     * ranges the bulk copy already covered.
+     *
+     * Fields outside every slot range (per-task counters, ready-queue
+     * entries) are NOT refreshed by the incremental path; callers re-read
+     * them with `read_range_from_device` or do a bulk pull after stop().
+     */
+    int refresh_shm_from_device() {
+        if (shared_mem_host_ == nullptr || shared_mem_dev_ == nullptr || shm_size_ == 0) {
+            return 0;
+        }
+        if (!ops_.copy_from_device) return 0;
+        if constexpr (HasDirtySummary<Module>::value) {
+            if (!full_mirror_) {
+                return refresh_dirty_ranges();
+            }
+        }
+        return mirror_shm_from_device();
+    }
+
     /**
      * Push the host-side modifications (advanced `queue_heads`, refilled
      * free_queues) back to the device. Called at the bottom of every mgmt
@@ -593,6 +665,34 @@ public:
     int device_id() const { return device_id_; }
 
 private:
+    int refresh_dirty_ranges() {
+        auto *summary = Module::dirty_summary_from_shm(shared_mem_host_);
+        int rc = read_range_from_device(summary, sizeof(*summary));
+        if (rc != 0) return rc;
+        rmb();
+        if (summary->magic != PROF_DIRTY_SUMMARY_MAGIC ||
+            summary->slot_count != static_cast<uint32_t>(Module::kDirtySlots)) {
+            // Not published (yet): bulk pull. The bulk copy overwrites the
+            // summary in the shadow, so latch the generations first.
+            for (int s = 0; s < Module::kDirtySlots; s++) {
+                dirty_seen_[s] = summary->gen[s];
+            }
+            return mirror_shm_from_device();
+        }
+        for (int s = 0; s < Module::kDirtySlots; s++) {
+            const uint32_t gen = summary->gen[s];
+            if (gen == dirty_seen_[s]) continue;
+            ShmRange range = Module::dirty_slot_range(shared_mem_host_, s);
+            if (range.size != 0) {
+                rc = read_range_from_device(range.ptr, range.size);
+                if (rc != 0) return rc;
+            }
+            dirty_seen_[s] = gen;
+        }
+        rmb();
+        return 0;
+    }
+
     // Subsystem inputs (set by ProfilerBase::start via set_memory_context).
     void *shared_mem_dev_{nullptr};
     void *shared_mem_host_{nullptr};
@@ -600,6 +700,11 @@ private:
     int device_id_{-1};
     MemoryOps ops_;
 
+    // Dirty-range refresh state (mgmt thread only). dirty_seen_[s] is the
+    // generation of slot s the host shadow is known to reflect.
+    bool full_mirror_{false};
+    std::vector<uint32_t> dirty_seen_;
+
     // mgmt → collector
     std::mutex ready_mutex_;
     std::condition_variable ready_cv_;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file flight_recorder.h
+ * @brief Host-side flight-recorder decoder, JSON export and dump policy.
+ *
+ * The device region (common/flight_recorder.h) is allocated once per
+ * DeviceRunner and never drained while a run is in flight. The runner copies
+ * it back only when a snapshot is wanted:
+ *   - the run returned an error,
+ *   - the device wall exceeded the configured slow-step threshold, or
+ *   - the caller asked explicitly (dump_flight_recorder C API).
+ *
+ * Output (flight_recorder_<pid>_<seq>_<reason>.json):
+ *   {"version":1,"reason":str,"clock_freq_hz":uint,"error_latched":bool,
+ *    "threads":[{"thread":int,"written":uint,"kept":uint}],
+ *    "events":[{"thread":int,"ts":uint,"event":str,...}]}
+ * Events are the live window of every ring merged by timestamp. Per-event
+ * keys depend on the kind: task_id (+ core / depth / resource) for task,
+ * scope and allocator events, code for run_end / error.
+ */
+
+#ifndef SRC_COMMON_PLATFORM_INCLUDE_HOST_FLIGHT_RECORDER_H_
+#define SRC_COMMON_PLATFORM_INCLUDE_HOST_FLIGHT_RECORDER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "common/flight_recorder.h"
+
+struct FlightRecorderThreadEvent {
+    int thread;
+    FlightRecord record;
+};
+
+struct FlightRecorderSnapshot {
+    bool error_latched{false};
+    std::vector<uint64_t> written;                  // Per ring: records ever written (ring head)
+    std::vector<FlightRecorderThreadEvent> events;  // Live window of every ring, merged by timestamp
+};
+
+/** Fill in the header of a freshly zeroed region image. */
+void flight_recorder_init_header(FlightRecorderHeader *header, int num_rings);
+
+/**
+ * Decode a host copy of the region. Returns false (and logs) when the image
+ * is too small or its magic / version / geometry don't match this build.
+ */
+bool flight_recorder_decode(const void *region, size_t bytes, FlightRecorderSnapshot *out);
+
+/** Stable name of a FLIGHT_RECORDER_EVENT_* kind ("unknown" otherwise). */
+const char *flight_recorder_event_name(uint32_t kind);
+
+/** Write `snap` as JSON to `path`. Returns 0 on success, -1 on I/O error. */
+int flight_recorder_write_json(
+    const FlightRecorderSnapshot &snap, const std::string &path, const char *reason, uint64_t clock_freq_hz
+);
+
+/**
+ * Trigger policy shared by the sim and onboard DeviceRunners. The recorder is
+ * off until configure(true, ...); automatic dumps need a dump directory.
+ */
+class FlightRecorderPolicy {
+public:
+    void configure(bool enabled, uint64_t slow_step_ns, const char *dump_dir);
+
+    bool enabled() const { return enabled_; }
+    const std::string &dump_dir() const { return dump_dir_; }
+
+    /**
+     * Reason to snapshot a finished run ("error" or "slow_step"), or nullptr
+     * when no dump is due. Always nullptr without a dump directory.
+     */
+    const char *auto_dump_reason(int run_rc, uint64_t device_wall_ns) const;
+
+    /** `<dump_dir>/flight_recorder_<pid>_<seq>_<reason>.json`; bumps the sequence. */
+    std::string next_dump_path(const char *reason);
+
+private:
+    bool enabled_{false};
+    uint64_t slow_step_ns_{0};  // 0 = no slow-step trigger
+    std::string dump_dir_;
+    uint32_t dump_seq_{0};
+};
+
+#endif  // SRC_COMMON_PLATFORM_INCLUDE_HOST_FLIGHT_RECORDER_H_
@@ -63,6 +63,15 @@
  *   template <typename Cb>
  *   static void for_each_instance(void* shm_host, DataHeader*, Cb&&);
  *
+ *   // Optional (host-shadow platforms): device-published dirty summary.
+ *   // When present, the per-tick refresh pulls only the slot ranges whose
+ *   // generation moved instead of the whole shm (see buffer_pool_manager.h
+ *   // and common/prof_dirty_summary.h). Must cover every device-written
+ *   // field the mgmt tick reads (queue_tails, free_queue.head).
+ *   static constexpr int kDirtySlots;
+ *   static ProfDirtySummary<kDirtySlots>* dirty_summary_from_shm(void* shm_host);
+ *   static ShmRange dirty_slot_range(void* shm_host, int slot);
+ *
  * Alloc policy
  * ------------
  *
@@ -110,7 +119,9 @@
  *     `copy_to_device` / `copy_from_device` in MemoryOps so every device
  *     read/write goes through rtMemcpy (onboard) or memcpy (sim). The
  *     mgmt_loop then pulls the device-side shared-memory region into the
- *     host shadow at the top of every tick (`mirror_shm_from_device`) and
+ *     host shadow at the top of every tick (`refresh_shm_from_device`:
+ *     only the dirty ranges when the Module publishes a dirty summary,
+ *     otherwise the bulk `mirror_shm_from_device`) and
  *     pushes the few host-modified fields (`queue_heads[q]` after pop,
  *     `free_queue.tail` + `buffer_ptrs[]` after refill) back as narrow
  *     `write_range_to_device` writes. The bulk `mirror_shm_to_device` is
@@ -746,9 +757,10 @@ protected:
 private:
     /**
      * mgmt thread main loop. Each tick:
-     *   0) Mirror the device-side shared-memory region (DataHeader + all
-     *      BufferStates) into the host shadow so subsequent reads see the
-     *      latest queue_tails / current_buf_ptr / per-state counters.
+     *   0) Refresh the host shadow from the device-side shared-memory region
+     *      so subsequent reads see the latest queue_tails / free_queue.head.
+     *      Modules with a dirty summary pull only the ranges that changed;
+     *      the rest mirror the whole region (DataHeader + all BufferStates).
      *   1) Drain done_queue into recycled pools.
      *   2) Iterate AICPU per-thread ready queues (PLATFORM_MAX_AICPU_THREADS
      *      upper bound; empty queues are O(1) head==tail checks) and call
@@ -770,14 +782,15 @@ private:
      *
      * On exit (mgmt_running_ → false) it does one final drain pass without
      * sleeping to flush any straggler entries the device pushed before
-     * stopping.
+     * stopping. That pass always uses the bulk mirror — it runs once, and
+     * keeps the final drain independent of the device's summary upkeep.
      */
     void mgmt_loop() {
         DataHeader *header = Module::header_from_shm(manager_.shared_mem_host());
         using Alg = ProfilerAlgorithms<Module>;
 
         while (mgmt_running_.load(std::memory_order_acquire)) {
-            manager_.mirror_shm_from_device();
+            manager_.refresh_shm_from_device();
 
             manager_.drain_done_into_recycled();
 
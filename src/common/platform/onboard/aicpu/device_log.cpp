@@ -55,6 +55,13 @@ extern "C" void set_log_info_v(int v) {
 
 extern "C" int get_log_info_v() { return g_log_info_v; }
 
+// Binary log mode is sim-only for now: onboard rings would need a
+// device-to-host drain channel. Keep the symbols so both backends export the
+// same ABI; text mode through CANN dlog stays in effect.
+extern "C" void set_log_binary_path(const char * /*path*/) {}
+
+extern "C" int flush_log_binary() { return 0; }
+
 // =============================================================================
 // Low-level dev_log_* / dev_vlog_* (onboard: route through CANN dlog)
 //
@@ -39,3 +39,9 @@ create_orch_so_file(const char *dir, int32_t callable_id, int32_t device_id, cha
     }
     return open(out_path, O_WRONLY | O_CREAT | O_TRUNC, 0755);
 }
+
+void release_orch_so_file(const char *path) {
+    if (path != nullptr && path[0] != '\0') {
+        unlink(path);
+    }
+}
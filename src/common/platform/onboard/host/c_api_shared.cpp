@@ -202,6 +202,46 @@ int copy_from_device_ctx(DeviceContextHandle ctx, void *host_ptr, const void *de
     }
 }
 
+int copy_to_device_async_ctx(
+    DeviceContextHandle ctx, void *dev_ptr, const void *host_ptr, size_t size, uint64_t *token
+) {
+    if (ctx == NULL || dev_ptr == NULL || host_ptr == NULL || token == NULL) return -1;
+    try {
+        return static_cast<DeviceRunnerBase *>(ctx)->copy_to_device_async(dev_ptr, host_ptr, size, token);
+    } catch (...) {
+        return -1;
+    }
+}
+
+int copy_from_device_async_ctx(
+    DeviceContextHandle ctx, void *host_ptr, const void *dev_ptr, size_t size, uint64_t *token
+) {
+    if (ctx == NULL || host_ptr == NULL || dev_ptr == NULL || token == NULL) return -1;
+    try {
+        return static_cast<DeviceRunnerBase *>(ctx)->copy_from_device_async(host_ptr, dev_ptr, size, token);
+    } catch (...) {
+        return -1;
+    }
+}
+
+int wait_copy_ctx(DeviceContextHandle ctx, uint64_t token) {
+    if (ctx == NULL) return -1;
+    try {
+        return static_cast<DeviceRunnerBase *>(ctx)->wait_copy(token);
+    } catch (...) {
+        return -1;
+    }
+}
+
+int query_copy_ctx(DeviceContextHandle ctx, uint64_t token) {
+    if (ctx == NULL) return -1;
+    try {
+        return static_cast<DeviceRunnerBase *>(ctx)->query_copy(token);
+    } catch (...) {
+        return -1;
+    }
+}
+
 int finalize_device(DeviceContextHandle ctx) {
     if (ctx == NULL) return -1;
     try {
@@ -429,6 +469,7 @@ int run_prepared(
 
         rc = runner->run(*r, block_dim, aicpu_thread_num);
         if (rc != 0) {
+            runner->maybe_dump_flight_recorder(rc);
             validate_runtime_impl(r);
             return rc;
         }
@@ -441,6 +482,7 @@ int run_prepared(
         }
 
         rc = validate_runtime_impl(r);
+        runner->maybe_dump_flight_recorder(rc);
         if (out_timing != NULL) {
             const auto host_t1 = std::chrono::steady_clock::now();
             out_timing->host_wall_ns =
@@ -462,6 +504,25 @@ int unregister_callable(DeviceContextHandle ctx, int32_t callable_id) {
     }
 }
 
+int configure_flight_recorder(DeviceContextHandle ctx, int enable, uint64_t slow_step_ns, const char *dump_dir) {
+    if (ctx == NULL) return -1;
+    try {
+        static_cast<DeviceRunnerBase *>(ctx)->configure_flight_recorder(enable != 0, slow_step_ns, dump_dir);
+        return 0;
+    } catch (...) {
+        return -1;
+    }
+}
+
+int dump_flight_recorder(DeviceContextHandle ctx, const char *path) {
+    if (ctx == NULL) return -1;
+    try {
+        return static_cast<DeviceRunnerBase *>(ctx)->dump_flight_recorder(path);
+    } catch (...) {
+        return -1;
+    }
+}
+
 size_t get_aicpu_dlopen_count(DeviceContextHandle ctx) {
     if (ctx == NULL) return 0;
     try {
@@ -471,6 +532,12 @@ size_t get_aicpu_dlopen_count(DeviceContextHandle ctx) {
     }
 }
 
+int supports_run_lanes(void) {
+    // All contexts on a device share simpler_inner_<fp>_<dev>.so and its
+    // static AicpuExecutor, so two lanes would race inside one executor.
+    return 0;
+}
+
 size_t get_host_dlopen_count(DeviceContextHandle ctx) {
     if (ctx == NULL) return 0;
     try {
@@ -68,6 +68,53 @@ int DeviceRunnerBase::copy_from_device(void *host_ptr, const void *dev_ptr, std:
     return rtMemcpy(host_ptr, bytes, dev_ptr, bytes, RT_MEMCPY_DEVICE_TO_HOST);
 }
 
+namespace {
+
+// Shared front half of copy_*_async: lazily start the copy thread, then
+// enqueue `job`. The pool is created on the copy thread because its stream
+// and events belong to that thread's device context.
+int submit_async_copy(
+    AsyncCopyQueue &queue, PinnedStagingPool &pool, const AsyncCopyQueue::ThreadFactory &spawn,
+    std::function<int()> job, uint64_t *token
+) {
+    if (token == nullptr) return -1;
+    *token = 0;
+    queue.start(spawn);
+    *token = queue.submit([&pool, job = std::move(job)]() {
+        int rc = pool.init(PLATFORM_ASYNC_COPY_CHUNK_BYTES);
+        return rc != 0 ? rc : job();
+    });
+    return *token != 0 ? 0 : -1;
+}
+
+}  // namespace
+
+int DeviceRunnerBase::copy_to_device_async(void *dev_ptr, const void *host_ptr, std::size_t bytes, uint64_t *token) {
+    auto spawn = [this](std::function<void()> fn) {
+        return create_thread(std::move(fn));
+    };
+    return submit_async_copy(
+        async_copy_, staging_pool_, spawn,
+        [this, dev_ptr, host_ptr, bytes]() {
+            return staging_pool_.copy_to_device(dev_ptr, host_ptr, bytes);
+        },
+        token
+    );
+}
+
+int DeviceRunnerBase::copy_from_device_async(void *host_ptr, const void *dev_ptr, std::size_t bytes, uint64_t *token) {
+    auto spawn = [this](std::function<void()> fn) {
+        return create_thread(std::move(fn));
+    };
+    return submit_async_copy(
+        async_copy_, staging_pool_, spawn,
+        [this, host_ptr, dev_ptr, bytes]() {
+            return staging_pool_.copy_from_device(host_ptr, dev_ptr, bytes);
+        },
+        token
+    );
+}
+
 int DeviceRunnerBase::device_memset(void *dev_ptr, int value, std::size_t bytes) {
     return aclrtMemset(dev_ptr, bytes, value, bytes);
 }
@@ -378,7 +425,7 @@ uint64_t DeviceRunnerBase::upload_chip_callable_buffer(const ChipCallable *calla
         return 0;
     }
 
-    const ChipCallableLayout layout = compute_chip_callable_layout(callable);
+    const ChipCallableLayout layout = chip_callable_layout_memo_.compute(callable);
 
     // Content-hash dedup: identical bytes → return cached chip_dev.
     auto it = chip_callable_buffers_.find(layout.content_hash);
@@ -553,7 +600,7 @@ int DeviceRunnerBase::register_callable(
         return -1;
     }
 
-    const uint64_t hash = simpler::common::utils::elf_build_id_64(orch_so_data, orch_so_size);
+    const uint64_t hash = simpler::common::utils::elf_build_id_memo_key_64(orch_so_data, orch_so_size);
 
     // Hash dedup: share device buffer across callable_ids that carry the same
     // SO bytes. Refcount drops in unregister_callable; we only free when the
@@ -708,6 +755,11 @@ int DeviceRunnerBase::finalize_common() {
         if (err != 0 && rc == 0) rc = err;
     };
 
+    // Let queued async copies land, then drop the copy stream and pinned
+    // slots while the device context is still alive.
+    async_copy_.stop();
+    staging_pool_.release();
+
     // Streams are persistent for the DeviceRunner's lifetime; destroy them here.
     // Intentionally no pre-destroy sync: when a run hits the AICore op-timeout
     // chain (PR #718), the AICPU stream surfaces ACL_ERROR_RT_AICPU_EXCEPTION
@@ -742,6 +794,7 @@ int DeviceRunnerBase::finalize_common() {
         );
     }
     chip_callable_buffers_.clear();
+    chip_callable_layout_memo_.clear();
 
     // Release any registered-callable orch SO buffers that callers forgot to
     // unregister. Refcounts no longer matter at this point — the device is
@@ -782,6 +835,11 @@ int DeviceRunnerBase::finalize_common() {
         free_tensor(device_wall_dev_ptr_);
         device_wall_dev_ptr_ = nullptr;
     }
+    if (flight_recorder_dev_ptr_ != nullptr) {
+        free_tensor(flight_recorder_dev_ptr_);
+        flight_recorder_dev_ptr_ = nullptr;
+        kernel_args_.args.flight_recorder_data_base = 0;
+    }
 
     // Free all remaining allocations (including handshake buffer and binGmAddr)
     mem_alloc_.finalize();
@@ -1009,6 +1067,67 @@ void DeviceRunnerBase::read_device_wall_ns() {
     }
 }
 
+void DeviceRunnerBase::ensure_flight_recorder_buffer() {
+    if (!flight_recorder_.enabled()) {
+        kernel_args_.args.flight_recorder_data_base = 0;
+        return;
+    }
+    if (flight_recorder_dev_ptr_ == nullptr) {
+        const size_t bytes = calc_flight_recorder_size(PLATFORM_MAX_AICPU_THREADS);
+        void *ptr = allocate_tensor(bytes);
+        if (ptr == nullptr) {
+            LOG_WARN("flight_recorder: failed to allocate %zu bytes; recorder off this run", bytes);
+            kernel_args_.args.flight_recorder_data_base = 0;
+            return;
+        }
+        // One-time H2D of the whole image: header plus zeroed rings.
+        std::vector<uint8_t> image(bytes, 0);
+        flight_recorder_init_header(get_flight_recorder_header(image.data()), PLATFORM_MAX_AICPU_THREADS);
+        if (copy_to_device(ptr, image.data(), bytes) != 0) {
+            LOG_WARN("flight_recorder: init H2D failed; recorder off this run");
+            free_tensor(ptr);
+            kernel_args_.args.flight_recorder_data_base = 0;
+            return;
+        }
+        flight_recorder_dev_ptr_ = ptr;
+    }
+    kernel_args_.args.flight_recorder_data_base = reinterpret_cast<uint64_t>(flight_recorder_dev_ptr_);
+}
+
+int DeviceRunnerBase::snapshot_flight_recorder(const std::string &path, const char *reason) {
+    if (flight_recorder_dev_ptr_ == nullptr) {
+        LOG_WARN("flight_recorder: nothing recorded yet (recorder disabled or no run)");
+        return -1;
+    }
+    const size_t bytes = calc_flight_recorder_size(PLATFORM_MAX_AICPU_THREADS);
+    std::vector<uint8_t> image(bytes);
+    if (copy_from_device(image.data(), flight_recorder_dev_ptr_, bytes) != 0) {
+        LOG_ERROR("flight_recorder: snapshot D2H failed");
+        return -1;
+    }
+    FlightRecorderSnapshot snap;
+    if (!flight_recorder_decode(image.data(), bytes, &snap)) return -1;
+    return flight_recorder_write_json(snap, path, reason, PLATFORM_PROF_SYS_CNT_FREQ);
+}
+
+int DeviceRunnerBase::dump_flight_recorder(const char *path) {
+    std::string out = (path != nullptr) ? path : "";
+    if (out.empty()) {
+        if (flight_recorder_.dump_dir().empty()) {
+            LOG_ERROR("flight_recorder: dump requested without a path or a configured dump directory");
+            return -1;
+        }
+        out = flight_recorder_.next_dump_path("explicit");
+    }
+    return snapshot_flight_recorder(out, "explicit");
+}
+
+void DeviceRunnerBase::maybe_dump_flight_recorder(int run_rc) {
+    const char *reason = flight_recorder_.auto_dump_reason(run_rc, device_wall_ns_);
+    if (reason == nullptr || flight_recorder_dev_ptr_ == nullptr) return;
+    snapshot_flight_recorder(flight_recorder_.next_dump_path(reason), reason);
+}
+
 int DeviceRunnerBase::init_runtime_args_with_metadata(Runtime &runtime) {
     int rc = kernel_args_.init_runtime_args(runtime, mem_alloc_);
     if (rc != 0) {
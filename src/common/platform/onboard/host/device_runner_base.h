@@ -50,10 +50,14 @@
 
 #include "arg_direction.h"
 #include "callable.h"
+#include "chip_callable_layout.h"
 #include "common/l2_swimlane_profiling.h"
 #include "utils/device_arena.h"
 #include "device_runner_helpers.h"
+#include "pinned_staging_pool.h"
 #include "aicpu_loader/host/load_aicpu_op.h"
+#include "host/async_copy_queue.h"
+#include "host/flight_recorder.h"
 #include "host/l2_swimlane_collector.h"
 #include "host/memory_allocator.h"
 #include "host/pmu_collector.h"
@@ -88,6 +92,20 @@ public:
     int copy_from_device(void *host_ptr, const void *dev_ptr, std::size_t bytes);
     int device_memset(void *dev_ptr, int value, std::size_t bytes);
 
+    /**
+     * Async host<->device copies (host/async_copy_queue.h). Each call
+     * enqueues the transfer on the runner's copy thread and writes a
+     * completion token to `*token`; the transfer goes through the pinned
+     * staging pool on its own stream, so it overlaps with runs and with the
+     * caller. The host buffer must stay valid until the token is done.
+     * `wait_copy` returns the transfer's rc; `query_copy` returns 1 (done),
+     * 0 (pending) or the error rc.
+     */
+    int copy_to_device_async(void *dev_ptr, const void *host_ptr, std::size_t bytes, uint64_t *token);
+    int copy_from_device_async(void *host_ptr, const void *dev_ptr, std::size_t bytes, uint64_t *token);
+    int wait_copy(uint64_t token) { return async_copy_.wait(token); }
+    int query_copy(uint64_t token) { return async_copy_.query(token); }
+
     /**
      * Commit the three per-Worker pooled regions (PTO2 GM heap, PTO2
      * shared memory, trb prebuilt runtime arena) as three independent
@@ -197,6 +215,25 @@ public:
      */
     uint64_t last_device_wall_ns() const { return device_wall_ns_; }
 
+    /**
+     * Flight recorder (see host/flight_recorder.h). On by default; the
+     * region is allocated on the next run. `slow_step_ns` (0 = off) and
+     * errors trigger an automatic snapshot into `dump_dir` after the run.
+     */
+    void configure_flight_recorder(bool enable, uint64_t slow_step_ns, const char *dump_dir) {
+        flight_recorder_.configure(enable, slow_step_ns, dump_dir);
+    }
+
+    /**
+     * Copy the flight-recorder region back and write it as JSON to `path`,
+     * or to the dump directory when `path` is empty. Must not race a run.
+     * Returns 0 on success.
+     */
+    int dump_flight_recorder(const char *path);
+
+    /** Post-run trigger check (error / slow step); call after `run()` returns. */
+    void maybe_dump_flight_recorder(int run_rc);
+
     /**
      * Upload an entire ChipCallable buffer to device memory in one shot.
      * Walks child_offsets_ to compute total byte size, allocates device
@@ -392,6 +429,13 @@ public:
      * `set_dep_gen_enabled` is a2a3-only and lives on the subclass.
      */
     void set_l2_swimlane_enabled(int level) {
+        // Low byte is the level; L2_SWIMLANE_EDGES_FLAG rides above it. Edges
+        // alone still need the swimlane pipeline, so they imply AICORE_TIMING.
+        enable_l2_edges_ = (level & L2_SWIMLANE_EDGES_FLAG) != 0;
+        level &= L2_SWIMLANE_LEVEL_MASK;
+        if (enable_l2_edges_ && level == 0) {
+            level = static_cast<int>(L2SwimlaneLevel::AICORE_TIMING);
+        }
         l2_swimlane_level_ = static_cast<L2SwimlaneLevel>(level);
         enable_l2_swimlane_ = (l2_swimlane_level_ != L2SwimlaneLevel::DISABLED);
     }
@@ -499,6 +543,17 @@ protected:
      */
     void ensure_device_wall_buffer();
 
+    /**
+     * Lazy-allocate the flight-recorder region on first run (header H2D'd,
+     * rings zeroed) and publish it on `KernelArgs.flight_recorder_data_base`.
+     * Unlike the device wall buffer it is NOT reset per run: the rings carry
+     * history across steps. Publishes 0 when the recorder is disabled.
+     */
+    void ensure_flight_recorder_buffer();
+
+    /** D2H the region, decode it and write the JSON snapshot. */
+    int snapshot_flight_recorder(const std::string &path, const char *reason);
+
     /**
      * Resolve the caller's `requested_block_dim` into a concrete
      * block_dim:
@@ -625,8 +680,8 @@ protected:
 
     // ---- Group D state shared by both a2a3 and a5 -------------------------
     //
-    // Chip-callable buffer pool. Keyed by FNV-1a 64-bit content hash of
-    // the ChipCallable bytes. Each entry owns one device GM allocation
+    // Chip-callable buffer pool. Keyed by content_hash_64 of the
+    // ChipCallable bytes. Each entry owns one device GM allocation
     // holding the entire ChipCallable buffer (header + storage_, with
     // each child's resolved_addr_ fixed up to its post-H2D device
     // address). Pool-managed: identical buffer bytes share one entry
@@ -636,6 +691,8 @@ protected:
         size_t total_size{0};  // byte size of the device allocation
     };
     std::unordered_map<uint64_t, ChipCallableBuffer> chip_callable_buffers_;
+    // Skips rehashing a caller buffer already seen at the same address.
+    ChipCallableLayoutMemo chip_callable_layout_memo_;
 
     // Per-callable_id registered state.
     //
@@ -752,6 +809,18 @@ protected:
     void *device_wall_dev_ptr_{nullptr};
     uint64_t device_wall_ns_{0};
 
+    // Flight-recorder region; see ensure_flight_recorder_buffer(). Freed in
+    // finalize_common() alongside the device wall buffer.
+    FlightRecorderPolicy flight_recorder_;
+    void *flight_recorder_dev_ptr_{nullptr};
+
+    // Async copy engine. The queue thread is started lazily by the first
+    // copy_*_async call and owns staging_pool_ (created on that thread).
+    // Both are torn down at the top of finalize_common(). Declared in this
+    // order so the queue stops before the pool is destroyed.
+    PinnedStagingPool staging_pool_;
+    AsyncCopyQueue async_copy_;
+
     // True after AICPU SO loaded; reset by the subclass's `finalize()`.
     bool binaries_loaded_{false};
 
@@ -774,6 +843,7 @@ protected:
     bool enable_pmu_{false};
     bool enable_scope_stats_{false};
     L2SwimlaneLevel l2_swimlane_level_{L2SwimlaneLevel::DISABLED};  // resolved from set_l2_swimlane_enabled()
+    bool enable_l2_edges_{false};                                   // L2_SWIMLANE_EDGES_FLAG, same setter
     PmuEventType pmu_event_type_{PmuEventType::PIPE_UTILIZATION};   // resolved from set_pmu_enabled()
     std::string output_prefix_{};                                   // diagnostic artifact root directory
 };
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "pinned_staging_pool.h"
+
+#include <acl/acl.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/unified_log.h"
+
+int PinnedStagingPool::init(size_t chunk_bytes) {
+    if (ready()) return 0;
+    chunk_bytes_ = chunk_bytes;
+    for (int i = 0; i < kSlots; ++i) {
+        aclError rc = aclrtMallocHost(&slots_[i], chunk_bytes_);
+        if (rc != ACL_ERROR_NONE) {
+            LOG_ERROR("PinnedStagingPool: aclrtMallocHost(%zu) failed: %d", chunk_bytes_, static_cast<int>(rc));
+            release();
+            return static_cast<int>(rc);
+        }
+        aclrtEvent event = nullptr;
+        rc = aclrtCreateEvent(&event);
+        if (rc != ACL_ERROR_NONE) {
+            LOG_ERROR("PinnedStagingPool: aclrtCreateEvent failed: %d", static_cast<int>(rc));
+            release();
+            return static_cast<int>(rc);
+        }
+        events_[i] = event;
+    }
+    aclrtStream stream = nullptr;
+    aclError rc = aclrtCreateStream(&stream);
+    if (rc != ACL_ERROR_NONE) {
+        LOG_ERROR("PinnedStagingPool: aclrtCreateStream failed: %d", static_cast<int>(rc));
+        release();
+        return static_cast<int>(rc);
+    }
+    stream_ = stream;
+    LOG_DEBUG("PinnedStagingPool: %d x %zu B pinned slots ready", kSlots, chunk_bytes_);
+    return 0;
+}
+
+void PinnedStagingPool::release() {
+    if (stream_ != nullptr) {
+        drain_all();
+        aclrtDestroyStream(static_cast<aclrtStream>(stream_));
+        stream_ = nullptr;
+    }
+    for (int i = 0; i < kSlots; ++i) {
+        if (events_[i] != nullptr) {
+            aclrtDestroyEvent(static_cast<aclrtEvent>(events_[i]));
+            events_[i] = nullptr;
+        }
+        if (slots_[i] != nullptr) {
+            aclrtFreeHost(slots_[i]);
+            slots_[i] = nullptr;
+        }
+        in_flight_[i] = false;
+    }
+}
+
+int PinnedStagingPool::drain_slot(int slot) {
+    if (!in_flight_[slot]) return 0;
+    in_flight_[slot] = false;
+    return static_cast<int>(aclrtSynchronizeEvent(static_cast<aclrtEvent>(events_[slot])));
+}
+
+int PinnedStagingPool::drain_all() {
+    for (bool &f : in_flight_) {
+        f = false;
+    }
+    return static_cast<int>(aclrtSynchronizeStream(static_cast<aclrtStream>(stream_)));
+}
+
+int PinnedStagingPool::copy_to_device(void *dev_ptr, const void *host_ptr, size_t bytes) {
+    auto *dst = static_cast<char *>(dev_ptr);
+    const auto *src = static_cast<const char *>(host_ptr);
+    aclrtStream stream = static_cast<aclrtStream>(stream_);
+    int slot = 0;
+    for (size_t off = 0; off < bytes; off += chunk_bytes_, slot ^= 1) {
+        const size_t n = std::min(chunk_bytes_, bytes - off);
+        int rc = drain_slot(slot);
+        if (rc == 0) {
+            std::memcpy(slots_[slot], src + off, n);
+            rc = static_cast<int>(aclrtMemcpyAsync(dst + off, n, slots_[slot], n, ACL_MEMCPY_HOST_TO_DEVICE, stream));
+        }
+        if (rc == 0) {
+            rc = static_cast<int>(aclrtRecordEvent(static_cast<aclrtEvent>(events_[slot]), stream));
+        }
+        if (rc != 0) {
+            LOG_ERROR("PinnedStagingPool: H2D chunk at +%zu (%zu B) failed: %d", off, n, rc);
+            drain_all();
+            return rc;
+        }
+        in_flight_[slot] = true;
+    }
+    return drain_all();
+}
+
+int PinnedStagingPool::copy_from_device(void *host_ptr, const void *dev_ptr, size_t bytes) {
+    auto *dst = static_cast<char *>(host_ptr);
+    const auto *src = static_cast<const char *>(dev_ptr);
+    aclrtStream stream = static_cast<aclrtStream>(stream_);
+    const size_t num_chunks = (bytes + chunk_bytes_ - 1) / chunk_bytes_;
+    auto chunk_len = [&](size_t k) {
+        return std::min(chunk_bytes_, bytes - k * chunk_bytes_);
+    };
+    auto issue = [&](size_t k) {
+        const int slot = static_cast<int>(k & 1);
+        const size_t n = chunk_len(k);
+        int rc = static_cast<int>(
+            aclrtMemcpyAsync(slots_[slot], n, src + k * chunk_bytes_, n, ACL_MEMCPY_DEVICE_TO_HOST, stream)
+        );
+        if (rc == 0) rc = static_cast<int>(aclrtRecordEvent(static_cast<aclrtEvent>(events_[slot]), stream));
+        if (rc == 0) in_flight_[slot] = true;
+        return rc;
+    };
+
+    int rc = num_chunks > 0 ? issue(0) : 0;
+    for (size_t k = 0; rc == 0 && k < num_chunks; ++k) {
+        // Slot (k+1)&1 was emptied by the memcpy of chunk k-1, so the next
+        // DMA can start before chunk k is consumed.
+        if (k + 1 < num_chunks) rc = issue(k + 1);
+        if (rc == 0) rc = drain_slot(static_cast<int>(k & 1));
+        if (rc == 0) std::memcpy(dst + k * chunk_bytes_, slots_[k & 1], chunk_len(k));
+    }
+    if (rc != 0) {
+        LOG_ERROR("PinnedStagingPool: D2H of %zu B failed: %d", bytes, rc);
+        drain_all();
+        return rc;
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Pinned-host staging for the onboard async copy path.
+ *
+ * `rtMemcpy` from pageable memory runs at a fraction of link bandwidth and
+ * blocks the caller for the whole transfer. The pool owns two pinned slots
+ * of PLATFORM_ASYNC_COPY_CHUNK_BYTES, one event per slot and a dedicated
+ * copy stream. A transfer is cut into chunks that alternate between the
+ * slots:
+ *
+ *   H2D: memcpy chunk k into slot k&1, then DMA it; before refilling a slot
+ *        wait on its event, so the memcpy of chunk k+1 overlaps the DMA of k.
+ *   D2H: DMA chunk k+1 into its slot while chunk k is memcpy'd out of the
+ *        other one.
+ *
+ * Used only from the AsyncCopyQueue thread, so there is no locking. `init`
+ * must run on a thread attached to the device (the queue thread is spawned
+ * through `DeviceRunnerBase::create_thread`).
+ */
+
+#ifndef SIMPLER_COMMON_PLATFORM_ONBOARD_HOST_PINNED_STAGING_POOL_H
+#define SIMPLER_COMMON_PLATFORM_ONBOARD_HOST_PINNED_STAGING_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+class PinnedStagingPool {
+public:
+    PinnedStagingPool() = default;
+    ~PinnedStagingPool() { release(); }
+    PinnedStagingPool(const PinnedStagingPool &) = delete;
+    PinnedStagingPool &operator=(const PinnedStagingPool &) = delete;
+
+    /** Allocate slots, events and the copy stream. Idempotent. Returns 0 or an ACL error. */
+    int init(size_t chunk_bytes);
+    bool ready() const { return stream_ != nullptr; }
+
+    /** Free everything `init` created. Safe to call when not initialized. */
+    void release();
+
+    int copy_to_device(void *dev_ptr, const void *host_ptr, size_t bytes);
+    int copy_from_device(void *host_ptr, const void *dev_ptr, size_t bytes);
+
+private:
+    static constexpr int kSlots = 2;
+
+    // Wait for the DMA in flight on `slot`, if any.
+    int drain_slot(int slot);
+    // Sync the copy stream and forget every in-flight slot (error / end of transfer).
+    int drain_all();
+
+    size_t chunk_bytes_{0};
+    void *slots_[kSlots]{nullptr, nullptr};
+    void *events_[kSlots]{nullptr, nullptr};  // aclrtEvent
+    bool in_flight_[kSlots]{false, false};
+    void *stream_{nullptr};  // aclrtStream
+};
+
+#endif  // SIMPLER_COMMON_PLATFORM_ONBOARD_HOST_PINNED_STAGING_POOL_H
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Platform-layer flight recorder (always-on overwrite rings).
+//
+// One ring per AICPU thread, single writer each. A record costs one counter
+// read and a handful of plain stores; nothing is published to the host until
+// it copies the region back between runs.
+
+#include "aicpu/flight_recorder_aicpu.h"
+
+#include "aicpu/device_time.h"
+#include "common/flight_recorder.h"
+#include "common/platform_config.h"
+
+namespace {
+
+constexpr uint64_t kSlotMask = PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD - 1;
+
+FlightRecorderHeader *s_fr_header = nullptr;
+FlightRecorderRing *s_fr_rings = nullptr;
+int s_fr_orch_thread_idx = -1;
+
+}  // namespace
+
+extern "C" void set_platform_flight_recorder_base(uint64_t flight_recorder_data_base) {
+    void *base = reinterpret_cast<void *>(flight_recorder_data_base);
+    if (base == nullptr) {
+        s_fr_header = nullptr;
+        s_fr_rings = nullptr;
+        return;
+    }
+    s_fr_header = get_flight_recorder_header(base);
+    s_fr_rings = get_flight_recorder_ring(base, 0);
+}
+
+extern "C" void flight_recorder_record(int thread_idx, uint32_t kind, uint64_t task_id, uint32_t aux) {
+    if (s_fr_rings == nullptr || thread_idx < 0 || thread_idx >= PLATFORM_MAX_AICPU_THREADS) return;
+    FlightRecorderRing &ring = s_fr_rings[thread_idx];
+    uint64_t head = ring.head;
+    FlightRecord &rec = ring.records[head & kSlotMask];
+    rec.timestamp = get_sys_cnt_aicpu();
+    rec.arg = static_cast<uint32_t>(task_id);
+    rec.aux = static_cast<uint16_t>(aux);
+    rec.ring_id = static_cast<uint8_t>(task_id >> 32);
+    rec.kind = static_cast<uint8_t>(kind);
+    ring.head = head + 1;
+    if (kind == FLIGHT_RECORDER_EVENT_ERROR) {
+        s_fr_header->error_latched = 1;
+    }
+}
+
+extern "C" void flight_recorder_set_orch_thread_idx(int thread_idx) { s_fr_orch_thread_idx = thread_idx; }
+
+extern "C" void flight_recorder_orch_record(uint32_t kind, uint64_t task_id, uint32_t aux) {
+    flight_recorder_record(s_fr_orch_thread_idx, kind, task_id, aux);
+}
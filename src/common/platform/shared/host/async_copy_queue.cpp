@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "host/async_copy_queue.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+#include "common/unified_log.h"
+
+// =============================================================================
+// AsyncCopyQueue
+// =============================================================================
+
+void AsyncCopyQueue::start(const ThreadFactory &spawn) {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (running_) return;
+    stopping_ = false;
+    running_ = true;
+    worker_ = spawn([this]() {
+        loop();
+    });
+}
+
+bool AsyncCopyQueue::running() const {
+    std::lock_guard<std::mutex> lk(mu_);
+    return running_ && !stopping_;
+}
+
+uint64_t AsyncCopyQueue::submit(Job job) {
+    uint64_t token = 0;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        if (!running_ || stopping_) return 0;
+        token = next_token_++;
+        pending_.emplace_back(token, std::move(job));
+    }
+    work_cv_.notify_one();
+    return token;
+}
+
+int AsyncCopyQueue::wait(uint64_t token) {
+    std::unique_lock<std::mutex> lk(mu_);
+    if (token == 0 || token >= next_token_) return -1;
+    done_cv_.wait(lk, [&]() {
+        return completed_ >= token;
+    });
+    auto it = failed_.find(token);
+    return it == failed_.end() ? 0 : it->second;
+}
+
+int AsyncCopyQueue::query(uint64_t token) {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (token == 0 || token >= next_token_) return -1;
+    if (completed_ < token) return 0;
+    auto it = failed_.find(token);
+    return it == failed_.end() ? 1 : it->second;
+}
+
+int AsyncCopyQueue::wait_all() {
+    std::unique_lock<std::mutex> lk(mu_);
+    const uint64_t target = next_token_ - 1;
+    done_cv_.wait(lk, [&]() {
+        return completed_ >= target;
+    });
+    uint64_t first_token = 0;
+    int rc = 0;
+    for (const auto &kv : failed_) {
+        if (kv.first > drained_upto_ && kv.first <= target && (first_token == 0 || kv.first < first_token)) {
+            first_token = kv.first;
+            rc = kv.second;
+        }
+    }
+    drained_upto_ = std::max(drained_upto_, target);
+    return rc;
+}
+
+void AsyncCopyQueue::stop() {
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        if (!running_) return;
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    if (worker_.joinable()) worker_.join();
+    std::lock_guard<std::mutex> lk(mu_);
+    running_ = false;
+    stopping_ = false;
+}
+
+void AsyncCopyQueue::loop() {
+    for (;;) {
+        std::pair<uint64_t, Job> item;
+        {
+            std::unique_lock<std::mutex> lk(mu_);
+            work_cv_.wait(lk, [&]() {
+                return stopping_ || !pending_.empty();
+            });
+            // Drain everything already queued before honouring stop().
+            if (pending_.empty()) return;
+            item = std::move(pending_.front());
+            pending_.pop_front();
+        }
+        int rc = -1;
+        try {
+            rc = item.second();
+        } catch (const std::exception &e) {
+            LOG_ERROR("async copy %llu threw: %s", static_cast<unsigned long long>(item.first), e.what());
+        } catch (...) {
+            LOG_ERROR("async copy %llu threw", static_cast<unsigned long long>(item.first));
+        }
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            if (rc != 0) failed_[item.first] = rc;
+            completed_ = item.first;
+        }
+        done_cv_.notify_all();
+    }
+}
+
+// =============================================================================
+// StripedMemcpyPool
+// =============================================================================
+
+void StripedMemcpyPool::start(int lanes) {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (!helpers_.empty()) return;
+    stopping_ = false;
+    for (int i = 1; i < lanes; ++i) {
+        helpers_.emplace_back([this]() {
+            helper_loop();
+        });
+    }
+}
+
+void StripedMemcpyPool::stop() {
+    std::vector<std::thread> helpers;
+    {
+        std::lock_guard<std::mutex> lk(mu_);
+        stopping_ = true;
+        helpers.swap(helpers_);
+    }
+    start_cv_.notify_all();
+    for (auto &t : helpers) {
+        t.join();
+    }
+}
+
+void StripedMemcpyPool::copy(void *dst, const void *src, size_t bytes, size_t min_stripe) {
+    if (min_stripe == 0) min_stripe = 1;
+    std::unique_lock<std::mutex> lk(mu_);
+    const size_t lanes = helpers_.size() + 1;
+    if (lanes == 1 || bytes < 2 * min_stripe) {
+        lk.unlock();
+        std::memcpy(dst, src, bytes);
+        return;
+    }
+    const size_t stripes = std::min(lanes, bytes / min_stripe);
+    // Round stripes up to a cache line so neighbouring lanes never share one.
+    stripe_bytes_ = ((bytes + stripes - 1) / stripes + 63) & ~static_cast<size_t>(63);
+    num_stripes_ = (bytes + stripe_bytes_ - 1) / stripe_bytes_;
+    dst_ = static_cast<char *>(dst);
+    src_ = static_cast<const char *>(src);
+    bytes_ = bytes;
+    next_stripe_ = 0;
+    stripes_done_ = 0;
+    ++generation_;
+    lk.unlock();
+    start_cv_.notify_all();
+
+    run_stripes();
+
+    lk.lock();
+    done_cv_.wait(lk, [&]() {
+        return stripes_done_ == num_stripes_;
+    });
+}
+
+void StripedMemcpyPool::helper_loop() {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lk(mu_);
+            start_cv_.wait(lk, [&]() {
+                return stopping_ || generation_ != seen;
+            });
+            if (stopping_) return;
+            seen = generation_;
+        }
+        run_stripes();
+    }
+}
+
+void StripedMemcpyPool::run_stripes() {
+    for (;;) {
+        char *dst;
+        const char *src;
+        size_t len;
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            if (next_stripe_ >= num_stripes_) return;
+            const size_t offset = next_stripe_++ * stripe_bytes_;
+            dst = dst_ + offset;
+            src = src_ + offset;
+            len = std::min(stripe_bytes_, bytes_ - offset);
+        }
+        std::memcpy(dst, src, len);
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lk(mu_);
+            last = ++stripes_done_ == num_stripes_;
+        }
+        if (last) done_cv_.notify_all();
+    }
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "host/flight_recorder.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#include "common/unified_log.h"
+
+void flight_recorder_init_header(FlightRecorderHeader *header, int num_rings) {
+    std::memset(header, 0, sizeof(*header));
+    header->magic = FLIGHT_RECORDER_MAGIC;
+    header->version = FLIGHT_RECORDER_VERSION;
+    header->num_rings = static_cast<uint32_t>(num_rings);
+    header->records_per_ring = PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD;
+}
+
+bool flight_recorder_decode(const void *region, size_t bytes, FlightRecorderSnapshot *out) {
+    out->error_latched = false;
+    out->written.clear();
+    out->events.clear();
+    if (region == nullptr || bytes < sizeof(FlightRecorderHeader)) {
+        LOG_WARN("flight_recorder: region too small (%zu bytes)", bytes);
+        return false;
+    }
+    void *base = const_cast<void *>(region);
+    const FlightRecorderHeader *hdr = get_flight_recorder_header(base);
+    if (hdr->magic != FLIGHT_RECORDER_MAGIC || hdr->version != FLIGHT_RECORDER_VERSION ||
+        hdr->records_per_ring != static_cast<uint32_t>(PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD)) {
+        LOG_WARN(
+            "flight_recorder: bad header (magic=0x%x version=%u records_per_ring=%u)", hdr->magic, hdr->version,
+            hdr->records_per_ring
+        );
+        return false;
+    }
+    const int num_rings = static_cast<int>(hdr->num_rings);
+    if (bytes < calc_flight_recorder_size(num_rings)) {
+        LOG_WARN(
+            "flight_recorder: %d rings need %zu bytes, got %zu", num_rings, calc_flight_recorder_size(num_rings), bytes
+        );
+        return false;
+    }
+
+    constexpr uint64_t kCap = PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD;
+    out->error_latched = hdr->error_latched != 0;
+    out->written.resize(num_rings);
+    for (int t = 0; t < num_rings; ++t) {
+        const FlightRecorderRing *ring = get_flight_recorder_ring(base, t);
+        const uint64_t head = ring->head;
+        out->written[t] = head;
+        const uint64_t first = head > kCap ? head - kCap : 0;
+        for (uint64_t i = first; i < head; ++i) {
+            const FlightRecord &rec = ring->records[i & (kCap - 1)];
+            if (rec.kind == 0) continue;
+            out->events.push_back({t, rec});
+        }
+    }
+    // Each ring is already in write order; a stable sort keeps that order for
+    // equal timestamps while interleaving the threads.
+    std::stable_sort(out->events.begin(), out->events.end(), [](const auto &a, const auto &b) {
+        return a.record.timestamp < b.record.timestamp;
+    });
+    return true;
+}
+
+const char *flight_recorder_event_name(uint32_t kind) {
+    switch (kind) {
+    case FLIGHT_RECORDER_EVENT_RUN_BEGIN:
+        return "run_begin";
+    case FLIGHT_RECORDER_EVENT_RUN_END:
+        return "run_end";
+    case FLIGHT_RECORDER_EVENT_DISPATCH:
+        return "dispatch";
+    case FLIGHT_RECORDER_EVENT_FIN:
+        return "fin";
+    case FLIGHT_RECORDER_EVENT_SCOPE_BEGIN:
+        return "scope_begin";
+    case FLIGHT_RECORDER_EVENT_SCOPE_END:
+        return "scope_end";
+    case FLIGHT_RECORDER_EVENT_ALLOC_BLOCK:
+        return "alloc_block";
+    case FLIGHT_RECORDER_EVENT_ALLOC_RESUME:
+        return "alloc_resume";
+    case FLIGHT_RECORDER_EVENT_ERROR:
+        return "error";
+    default:
+        return "unknown";
+    }
+}
+
+namespace {
+
+// Kind-specific tail of one event object (everything after "event").
+int format_event_fields(char *buf, size_t size, const FlightRecord &rec) {
+    const uint64_t task_id = (static_cast<uint64_t>(rec.ring_id) << 32) | rec.arg;
+    switch (rec.kind) {
+    case FLIGHT_RECORDER_EVENT_RUN_BEGIN:
+        return std::snprintf(buf, size, ", \"orch\": %s", rec.aux != 0 ? "true" : "false");
+    case FLIGHT_RECORDER_EVENT_RUN_END:
+    case FLIGHT_RECORDER_EVENT_ERROR:
+        return std::snprintf(buf, size, ", \"code\": %d", static_cast<int32_t>(rec.arg));
+    case FLIGHT_RECORDER_EVENT_DISPATCH:
+    case FLIGHT_RECORDER_EVENT_FIN:
+        return std::snprintf(buf, size, ", \"task_id\": %" PRIu64 ", \"core\": %u", task_id, rec.aux);
+    case FLIGHT_RECORDER_EVENT_SCOPE_BEGIN:
+    case FLIGHT_RECORDER_EVENT_SCOPE_END:
+        return std::snprintf(buf, size, ", \"task_id\": %" PRIu64 ", \"depth\": %u", task_id, rec.aux);
+    case FLIGHT_RECORDER_EVENT_ALLOC_BLOCK:
+    case FLIGHT_RECORDER_EVENT_ALLOC_RESUME:
+        return std::snprintf(
+            buf, size, ", \"task_id\": %" PRIu64 ", \"resource\": \"%s\"", task_id,
+            rec.aux == FLIGHT_RECORDER_ALLOC_HEAP ? "heap" : "task_window"
+        );
+    default:
+        return std::snprintf(buf, size, ", \"arg\": %u, \"aux\": %u", rec.arg, rec.aux);
+    }
+}
+
+}  // namespace
+
+int flight_recorder_write_json(
+    const FlightRecorderSnapshot &snap, const std::string &path, const char *reason, uint64_t clock_freq_hz
+) {
+    std::FILE *fp = std::fopen(path.c_str(), "w");
+    if (fp == nullptr) {
+        LOG_ERROR("flight_recorder: failed to open %s", path.c_str());
+        return -1;
+    }
+
+    std::string out;
+    out.reserve(256 + snap.events.size() * 112);
+    char line[256];
+    int n = std::snprintf(
+        line, sizeof(line),
+        "{\"version\": %u, \"reason\": \"%s\", \"clock_freq_hz\": %" PRIu64 ", \"error_latched\": %s",
+        FLIGHT_RECORDER_VERSION, reason != nullptr ? reason : "explicit", clock_freq_hz,
+        snap.error_latched ? "true" : "false"
+    );
+    out.append(line, static_cast<size_t>(n));
+
+    out += ",\n \"threads\": [";
+    constexpr uint64_t kCap = PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD;
+    for (size_t t = 0; t < snap.written.size(); ++t) {
+        n = std::snprintf(
+            line, sizeof(line), "%s{\"thread\": %zu, \"written\": %" PRIu64 ", \"kept\": %" PRIu64 "}",
+            t == 0 ? "" : ", ", t, snap.written[t], std::min(snap.written[t], kCap)
+        );
+        out.append(line, static_cast<size_t>(n));
+    }
+    out += "],\n \"events\": [";
+
+    // One snprintf per event into a single buffer, then a single fwrite (same
+    // approach as the scope_stats exporter).
+    char fields[160];
+    for (size_t i = 0; i < snap.events.size(); ++i) {
+        const FlightRecorderThreadEvent &ev = snap.events[i];
+        format_event_fields(fields, sizeof(fields), ev.record);
+        n = std::snprintf(
+            line, sizeof(line), "%s\n  {\"thread\": %d, \"ts\": %" PRIu64 ", \"event\": \"%s\"%s}", i == 0 ? "" : ",",
+            ev.thread, ev.record.timestamp, flight_recorder_event_name(ev.record.kind), fields
+        );
+        if (n > 0) out.append(line, static_cast<size_t>(std::min<int>(n, sizeof(line) - 1)));
+    }
+    out += "\n ]}\n";
+
+    const bool ok = std::fwrite(out.data(), 1, out.size(), fp) == out.size();
+    std::fclose(fp);
+    if (!ok) {
+        LOG_ERROR("flight_recorder: short write to %s", path.c_str());
+        return -1;
+    }
+    LOG_INFO_V0(
+        "flight_recorder: wrote %zu events (%s) to %s", snap.events.size(), reason != nullptr ? reason : "explicit",
+        path.c_str()
+    );
+    return 0;
+}
+
+void FlightRecorderPolicy::configure(bool enabled, uint64_t slow_step_ns, const char *dump_dir) {
+    enabled_ = enabled;
+    slow_step_ns_ = slow_step_ns;
+    dump_dir_ = (dump_dir != nullptr) ? dump_dir : "";
+}
+
+const char *FlightRecorderPolicy::auto_dump_reason(int run_rc, uint64_t device_wall_ns) const {
+    if (!enabled_ || dump_dir_.empty()) return nullptr;
+    if (run_rc != 0) return "error";
+    if (slow_step_ns_ != 0 && device_wall_ns > slow_step_ns_) return "slow_step";
+    return nullptr;
+}
+
+std::string FlightRecorderPolicy::next_dump_path(const char *reason) {
+    std::error_code ec;
+    std::filesystem::create_directories(dump_dir_, ec);
+    if (ec) {
+        LOG_WARN("flight_recorder: failed to create dump dir %s: %s", dump_dir_.c_str(), ec.message().c_str());
+    }
+    char name[128];
+    std::snprintf(
+        name, sizeof(name), "flight_recorder_%d_%u_%s.json", static_cast<int>(getpid()), dump_seq_++,
+        reason != nullptr ? reason : "explicit"
+    );
+    return (std::filesystem::path(dump_dir_) / name).string();
+}
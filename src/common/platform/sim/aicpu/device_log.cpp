@@ -15,6 +15,10 @@
  * Severity and verbosity flags are populated by host via set_log_level() /
  * set_log_info_v() at AICPU kernel init (see kernel.cpp / aicpu_executor.cpp);
  * this file does not read env vars.
+ *
+ * With set_log_binary_path() the dev_vlog_* entry points skip vfprintf and
+ * push raw records into per-thread rings (see common/binary_log.h); ERROR is
+ * still echoed as text.
  */
 
 #include "aicpu/device_log.h"
@@ -22,6 +26,10 @@
 #include <cstdarg>
 #include <cstdio>
 
+#include "common/binary_log.h"
+
+namespace binlog = simpler::log::binlog;
+
 // =============================================================================
 // Severity enable flags + verbosity threshold (mutated by setters below)
 // =============================================================================
@@ -55,6 +63,15 @@ extern "C" void set_log_info_v(int v) {
 
 extern "C" int get_log_info_v() { return g_log_info_v; }
 
+// Separate from the host HostLogger sink: this SO is dlopen'd RTLD_LOCAL and
+// owns its own format table. Both sinks append self-contained chunks to the
+// same file, ordered by CLOCK_MONOTONIC at decode time.
+static binlog::Sink g_binlog;
+
+extern "C" void set_log_binary_path(const char *path) { g_binlog.set_path(path); }
+
+extern "C" int flush_log_binary() { return g_binlog.flush(); }
+
 // =============================================================================
 // init_log_switch: sim respects host-pushed config — this is now a no-op
 // (kept for ABI compatibility with onboard, where it queries CANN dlog).
@@ -67,28 +84,43 @@ void init_log_switch() {
 }
 
 // =============================================================================
-// Low-level dev_log_* / dev_vlog_* (sim: fprintf to stderr; no buffer needed)
+// Low-level dev_log_* / dev_vlog_* (sim: fprintf to stderr, or binlog ring)
 // =============================================================================
 
 void dev_vlog_debug(const char *func, const char *fmt, va_list args) {
+    if (g_binlog.enabled()) {
+        g_binlog.record(binlog::kTagDebug, func, fmt, args);
+        return;
+    }
     fprintf(stderr, "[DEBUG] %s: ", func);
     vfprintf(stderr, fmt, args);
     fputc('\n', stderr);
 }
 
 void dev_vlog_warn(const char *func, const char *fmt, va_list args) {
+    if (g_binlog.enabled()) {
+        g_binlog.record(binlog::kTagWarn, func, fmt, args);
+        return;
+    }
     fprintf(stderr, "[WARN] %s: ", func);
     vfprintf(stderr, fmt, args);
     fputc('\n', stderr);
 }
 
 void dev_vlog_error(const char *func, const char *fmt, va_list args) {
+    if (g_binlog.enabled()) {
+        g_binlog.record(binlog::kTagError, func, fmt, args);
+    }
     fprintf(stderr, "[ERROR] %s: ", func);
     vfprintf(stderr, fmt, args);
     fputc('\n', stderr);
 }
 
 void dev_vlog_info_v(int v, const char *func, const char *fmt, va_list args) {
+    if (g_binlog.enabled()) {
+        g_binlog.record(binlog::info_v_tag(v), func, fmt, args);
+        return;
+    }
     fprintf(stderr, "[INFO_V%d] %s: ", v, func);
     vfprintf(stderr, fmt, args);
     fputc('\n', stderr);
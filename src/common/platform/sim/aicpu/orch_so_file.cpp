@@ -19,15 +19,70 @@
 
 #include <fcntl.h>
 #include <stdlib.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
 #include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+// memfd-backed orch SOs keyed by the /proc/self/fd/<N> path handed to the
+// caller. The owning fd stays open until release_orch_so_file so <N> cannot
+// be recycled while glibc still holds the image under that name.
+std::mutex g_memfd_mutex;
+std::unordered_map<std::string, int> g_memfd_paths;
+
+int32_t create_orch_so_memfd(int32_t callable_id, int32_t device_id, char *out_path, size_t out_path_size) {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+    char name[64];
+    snprintf(name, sizeof(name), "libdevice_orch_cid%d_dev%d.so", callable_id, device_id);
+    int fd = memfd_create(name, MFD_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    int written = snprintf(out_path, out_path_size, "/proc/self/fd/%d", fd);
+    if (written < 0 || static_cast<size_t>(written) >= out_path_size) {
+        close(fd);
+        return -1;
+    }
+    // The caller closes the returned fd after writing; hand out a dup so the
+    // owning fd (and with it the /proc path) survives until release.
+    int write_fd = dup(fd);
+    if (write_fd < 0) {
+        close(fd);
+        return -1;
+    }
+    std::lock_guard<std::mutex> lock(g_memfd_mutex);
+    g_memfd_paths[out_path] = fd;
+    return write_fd;
+#else
+    (void)callable_id;
+    (void)device_id;
+    (void)out_path;
+    (void)out_path_size;
+    return -1;
+#endif
+}
+
+}  // namespace
 
 int32_t
 create_orch_so_file(const char *dir, int32_t callable_id, int32_t device_id, char *out_path, size_t out_path_size) {
-    // mkstemps: multiple sim workers can share a process, so names must be
-    // unique per call.  The "XXXXXX" template is replaced in-place.
+    // Preferred: anonymous memfd. No /tmp round-trip, so parallel sim shards
+    // on a busy CI host do not contend on (or fsync to) a shared filesystem.
+    int32_t memfd = create_orch_so_memfd(callable_id, device_id, out_path, out_path_size);
+    if (memfd >= 0) {
+        return memfd;
+    }
+
+    // Fallback (non-Linux, or memfd_create unavailable): mkstemps under `dir`.
+    // Multiple sim workers can share a process, so names must be unique per
+    // call. The "XXXXXX" template is replaced in-place.
     // callable_id / device_id are embedded purely for log readability
     // (mkstemps already guarantees uniqueness; sim has no shared preinstall
     // filesystem, so the onboard cross-die concern does not apply here).
@@ -54,3 +109,21 @@ create_orch_so_file(const char *dir, int32_t callable_id, int32_t device_id, cha
     }
     return fd;
 }
+
+void release_orch_so_file(const char *path) {
+    if (path == nullptr || path[0] == '\0') {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(g_memfd_mutex);
+        auto it = g_memfd_paths.find(path);
+        if (it != g_memfd_paths.end()) {
+            close(it->second);
+            g_memfd_paths.erase(it);
+            return;
+        }
+    }
+    if (std::strncmp(path, "/proc/self/fd/", 14) != 0) {
+        unlink(path);
+    }
+}
@@ -193,14 +193,54 @@ int copy_from_device_ctx(DeviceContextHandle ctx, void *host_ptr, const void *de
     }
 }
 
+int copy_to_device_async_ctx(
+    DeviceContextHandle ctx, void *dev_ptr, const void *host_ptr, size_t size, uint64_t *token
+) {
+    if (ctx == NULL || dev_ptr == NULL || host_ptr == NULL || token == NULL) return -1;
+    try {
+        return static_cast<SimDeviceRunnerBase *>(ctx)->copy_to_device_async(dev_ptr, host_ptr, size, token);
+    } catch (...) {
+        return -1;
+    }
+}
+
+int copy_from_device_async_ctx(
+    DeviceContextHandle ctx, void *host_ptr, const void *dev_ptr, size_t size, uint64_t *token
+) {
+    if (ctx == NULL || host_ptr == NULL || dev_ptr == NULL || token == NULL) return -1;
+    try {
+        return static_cast<SimDeviceRunnerBase *>(ctx)->copy_from_device_async(host_ptr, dev_ptr, size, token);
+    } catch (...) {
+        return -1;
+    }
+}
+
+int wait_copy_ctx(DeviceContextHandle ctx, uint64_t token) {
+    if (ctx == NULL) return -1;
+    try {
+        return static_cast<SimDeviceRunnerBase *>(ctx)->wait_copy(token);
+    } catch (...) {
+        return -1;
+    }
+}
+
+int query_copy_ctx(DeviceContextHandle ctx, uint64_t token) {
+    if (ctx == NULL) return -1;
+    try {
+        return static_cast<SimDeviceRunnerBase *>(ctx)->query_copy(token);
+    } catch (...) {
+        return -1;
+    }
+}
+
 int finalize_device(DeviceContextHandle ctx) {
     if (ctx == NULL) return -1;
     try {
-        int rc = static_cast<SimDeviceRunnerBase *>(ctx)->finalize();
-        int dev = pto_cpu_sim_get_bound_device();
-        if (dev >= 0) {
-            pto_cpu_sim_release_device(dev);
-        }
+        SimDeviceRunnerBase *runner = static_cast<SimDeviceRunnerBase *>(ctx);
+        int rc = runner->finalize();
+        // The runner's own context, not the calling thread's binding: with run
+        // lanes that thread may last have been bound to another lane.
+        runner->release_sim_context();
         return rc;
     } catch (...) {
         return -1;
@@ -380,6 +420,7 @@ int run_prepared(
 
         rc = runner->run(*r, block_dim, aicpu_thread_num);
         if (rc != 0) {
+            runner->maybe_dump_flight_recorder(rc);
             validate_runtime_impl(r);
             pthread_setspecific(g_runner_key, nullptr);
             return rc;
@@ -394,6 +435,7 @@ int run_prepared(
         }
 
         rc = validate_runtime_impl(r);
+        runner->maybe_dump_flight_recorder(rc);
         pthread_setspecific(g_runner_key, nullptr);
         if (out_timing != NULL) {
             const auto host_t1 = std::chrono::steady_clock::now();
@@ -417,6 +459,11 @@ int unregister_callable(DeviceContextHandle ctx, int32_t callable_id) {
     }
 }
 
+int supports_run_lanes(void) {
+    // Each SimDeviceRunner dlopens its own memfd copy of the AICPU executor.
+    return 1;
+}
+
 size_t get_host_dlopen_count(DeviceContextHandle ctx) {
     if (ctx == NULL) return 0;
     try {
@@ -426,6 +473,25 @@ size_t get_host_dlopen_count(DeviceContextHandle ctx) {
     }
 }
 
+int configure_flight_recorder(DeviceContextHandle ctx, int enable, uint64_t slow_step_ns, const char *dump_dir) {
+    if (ctx == NULL) return -1;
+    try {
+        static_cast<SimDeviceRunnerBase *>(ctx)->configure_flight_recorder(enable != 0, slow_step_ns, dump_dir);
+        return 0;
+    } catch (...) {
+        return -1;
+    }
+}
+
+int dump_flight_recorder(DeviceContextHandle ctx, const char *path) {
+    if (ctx == NULL) return -1;
+    try {
+        return static_cast<SimDeviceRunnerBase *>(ctx)->dump_flight_recorder(path);
+    } catch (...) {
+        return -1;
+    }
+}
+
 size_t get_aicpu_dlopen_count(DeviceContextHandle ctx) {
     if (ctx == NULL) return 0;
     try {
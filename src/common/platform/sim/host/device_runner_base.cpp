@@ -10,10 +10,13 @@
  */
 #include "device_runner_base.h"
 
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <stdlib.h>
 
 #include <cstdio>
+#include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -38,6 +41,47 @@ bool write_all_bytes(int fd, const uint8_t *data, size_t size) {
     return true;
 }
 
+struct KernelDsoEntry {
+    void *handle{nullptr};
+    int memfd{-1};  // -1 when loaded through the create_temp_so_file fallback
+    int refcount{0};
+};
+
+using KernelDsoKey = std::pair<uint64_t, size_t>;  // (content hash, size)
+
+std::mutex g_kernel_dso_mutex;
+std::map<KernelDsoKey, KernelDsoEntry> g_kernel_dsos;
+std::unordered_map<void *, KernelDsoKey> g_kernel_dso_keys;
+
+// dlopen `data` through an anonymous memfd. On success *out_fd owns the memfd,
+// which the caller must keep open until dlclose. Returns nullptr when memfd is
+// unavailable or the load fails (the caller then falls back to a temp file).
+void *dlopen_from_memfd(const char *name, const uint8_t *data, size_t size, int *out_fd) {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+    int fd = memfd_create(name, MFD_CLOEXEC);
+    if (fd < 0) return nullptr;
+    if (!write_all_bytes(fd, data, size)) {
+        close(fd);
+        return nullptr;
+    }
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fd);
+    void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr) {
+        close(fd);
+        return nullptr;
+    }
+    *out_fd = fd;
+    return handle;
+#else
+    (void)name;
+    (void)data;
+    (void)size;
+    (void)out_fd;
+    return nullptr;
+#endif
+}
+
 }  // namespace
 
 bool create_temp_so_file(const std::string &path_template, const uint8_t *data, size_t size, std::string *out_path) {
@@ -69,12 +113,61 @@ bool create_temp_so_file(const std::string &path_template, const uint8_t *data,
     return true;
 }
 
+void *acquire_kernel_dso(const uint8_t *data, size_t size, int func_id) {
+    const KernelDsoKey key{simpler::common::utils::elf_build_id_memo_key_64(data, size), size};
+
+    std::lock_guard<std::mutex> lock(g_kernel_dso_mutex);
+    auto it = g_kernel_dsos.find(key);
+    if (it != g_kernel_dsos.end()) {
+        it->second.refcount++;
+        return it->second.handle;
+    }
+
+    const std::string name = "kernel_" + std::to_string(func_id);
+    KernelDsoEntry entry;
+    entry.handle = dlopen_from_memfd(name.c_str(), data, size, &entry.memfd);
+    if (entry.handle == nullptr) {
+        std::string tmpfile;
+        if (!create_temp_so_file("/tmp/" + name + "_XXXXXX", data, size, &tmpfile)) {
+            return nullptr;
+        }
+        entry.handle = dlopen(tmpfile.c_str(), RTLD_NOW | RTLD_LOCAL);
+        std::remove(tmpfile.c_str());
+        if (entry.handle == nullptr) {
+            return nullptr;
+        }
+    }
+    entry.refcount = 1;
+    g_kernel_dsos.emplace(key, entry);
+    g_kernel_dso_keys.emplace(entry.handle, key);
+    return entry.handle;
+}
+
+void release_kernel_dso(void *handle) {
+    if (handle == nullptr) return;
+    std::lock_guard<std::mutex> lock(g_kernel_dso_mutex);
+    auto key_it = g_kernel_dso_keys.find(handle);
+    if (key_it == g_kernel_dso_keys.end()) return;
+    auto it = g_kernel_dsos.find(key_it->second);
+    if (--it->second.refcount > 0) return;
+    dlclose(it->second.handle);
+    if (it->second.memfd >= 0) {
+        close(it->second.memfd);
+    }
+    g_kernel_dsos.erase(it);
+    g_kernel_dso_keys.erase(key_it);
+}
+
 }  // namespace simpler::common::sim_host
 
 // =============================================================================
 // SimDeviceRunnerBase Implementation
 // =============================================================================
 
+// Backstop for contexts destroyed without finalize_device (e.g. a failed
+// simpler_init); the normal path has already released it.
+SimDeviceRunnerBase::~SimDeviceRunnerBase() { release_sim_context(); }
+
 int SimDeviceRunnerBase::setup_static_arena(size_t gm_heap_size, size_t gm_sm_size, size_t runtime_arena_size) {
     // Three independent device_malloc'd buffers: GM heap, PTO2 SM, prebuilt
     // runtime arena. Split out from a single large allocation because the
@@ -141,11 +234,11 @@ void *SimDeviceRunnerBase::acquire_pooled_runtime_arena() {
 }
 
 std::thread SimDeviceRunnerBase::create_thread(std::function<void()> fn) {
-    int dev_id = device_id_;
-    return std::thread([dev_id, fn = std::move(fn)]() {
-        pto_cpu_sim_bind_device(dev_id);
+    int key = sim_context_key_;
+    return std::thread([key, fn = std::move(fn)]() {
+        pto_cpu_sim_bind_context(key);
         fn();
-        pto_cpu_sim_bind_device(-1);
+        pto_cpu_sim_bind_context(-1);
     });
 }
 
@@ -163,14 +256,25 @@ int SimDeviceRunnerBase::attach_current_thread(int device_id) {
     }
 
     // Per-thread bind so sim hooks (TPUSH/TPOP, identity helpers) route through
-    // the correct context. acquire is process-wide and idempotent (no-op after
-    // first call for a given device_id), so it is safe to fold in here.
-    pto_cpu_sim_bind_device(device_id);
-    pto_cpu_sim_acquire_device(device_id);
+    // this runner's context. The context is acquired once per runner, not per
+    // device_id, so run lanes sharing a device never share pipe state.
+    if (sim_context_key_ < 0) {
+        sim_context_key_ = pto_cpu_sim_acquire_context(device_id);
+    }
+    pto_cpu_sim_bind_context(sim_context_key_);
     device_id_ = device_id;
     return 0;
 }
 
+void SimDeviceRunnerBase::release_sim_context() {
+    if (sim_context_key_ < 0) return;
+    if (pto_cpu_sim_get_bound_context() == sim_context_key_) {
+        pto_cpu_sim_bind_context(-1);
+    }
+    pto_cpu_sim_release_context(sim_context_key_);
+    sim_context_key_ = -1;
+}
+
 int SimDeviceRunnerBase::ensure_device_initialized() {
     // device_id_ was set in attach_current_thread() during simpler_init.
     int rc = attach_current_thread(device_id_);
@@ -201,6 +305,92 @@ int SimDeviceRunnerBase::device_memset(void *dev_ptr, int value, size_t bytes) {
     return 0;
 }
 
+int SimDeviceRunnerBase::submit_async_copy(void *dst, const void *src, size_t bytes, uint64_t *token) {
+    if (token == nullptr) return -1;
+    *token = 0;
+    memcpy_pool_.start(PLATFORM_SIM_ASYNC_COPY_LANES);
+    async_copy_.start([this](std::function<void()> fn) {
+        return create_thread(std::move(fn));
+    });
+    *token = async_copy_.submit([this, dst, src, bytes]() {
+        memcpy_pool_.copy(dst, src, bytes, PLATFORM_ASYNC_COPY_CHUNK_BYTES);
+        return 0;
+    });
+    return *token != 0 ? 0 : -1;
+}
+
+int SimDeviceRunnerBase::copy_to_device_async(void *dev_ptr, const void *host_ptr, size_t bytes, uint64_t *token) {
+    return submit_async_copy(dev_ptr, host_ptr, bytes, token);
+}
+
+int SimDeviceRunnerBase::copy_from_device_async(void *host_ptr, const void *dev_ptr, size_t bytes, uint64_t *token) {
+    return submit_async_copy(host_ptr, dev_ptr, bytes, token);
+}
+
+void SimDeviceRunnerBase::stop_async_copy() {
+    async_copy_.stop();
+    memcpy_pool_.stop();
+}
+
+void SimDeviceRunnerBase::ensure_flight_recorder_buffer() {
+    if (!flight_recorder_.enabled()) {
+        kernel_args_.flight_recorder_data_base = 0;
+        return;
+    }
+    if (flight_recorder_dev_ptr_ == nullptr) {
+        const size_t bytes = calc_flight_recorder_size(PLATFORM_MAX_AICPU_THREADS);
+        void *ptr = allocate_tensor(bytes);
+        if (ptr == nullptr) {
+            LOG_WARN("flight_recorder: failed to allocate %zu bytes; recorder off this run", bytes);
+            kernel_args_.flight_recorder_data_base = 0;
+            return;
+        }
+        std::memset(ptr, 0, bytes);
+        flight_recorder_init_header(get_flight_recorder_header(ptr), PLATFORM_MAX_AICPU_THREADS);
+        flight_recorder_dev_ptr_ = ptr;
+    }
+    kernel_args_.flight_recorder_data_base = reinterpret_cast<uint64_t>(flight_recorder_dev_ptr_);
+}
+
+void SimDeviceRunnerBase::release_flight_recorder_buffer() {
+    if (flight_recorder_dev_ptr_ != nullptr) {
+        free_tensor(flight_recorder_dev_ptr_);
+        flight_recorder_dev_ptr_ = nullptr;
+    }
+    kernel_args_.flight_recorder_data_base = 0;
+}
+
+int SimDeviceRunnerBase::snapshot_flight_recorder(const std::string &path, const char *reason) {
+    if (flight_recorder_dev_ptr_ == nullptr) {
+        LOG_WARN("flight_recorder: nothing recorded yet (recorder disabled or no run)");
+        return -1;
+    }
+    const size_t bytes = calc_flight_recorder_size(PLATFORM_MAX_AICPU_THREADS);
+    std::vector<uint8_t> image(bytes);
+    copy_from_device(image.data(), flight_recorder_dev_ptr_, bytes);
+    FlightRecorderSnapshot snap;
+    if (!flight_recorder_decode(image.data(), bytes, &snap)) return -1;
+    return flight_recorder_write_json(snap, path, reason, PLATFORM_PROF_SYS_CNT_FREQ);
+}
+
+int SimDeviceRunnerBase::dump_flight_recorder(const char *path) {
+    std::string out = (path != nullptr) ? path : "";
+    if (out.empty()) {
+        if (flight_recorder_.dump_dir().empty()) {
+            LOG_ERROR("flight_recorder: dump requested without a path or a configured dump directory");
+            return -1;
+        }
+        out = flight_recorder_.next_dump_path("explicit");
+    }
+    return snapshot_flight_recorder(out, "explicit");
+}
+
+void SimDeviceRunnerBase::maybe_dump_flight_recorder(int run_rc) {
+    const char *reason = flight_recorder_.auto_dump_reason(run_rc, device_wall_ns_);
+    if (reason == nullptr || flight_recorder_dev_ptr_ == nullptr) return;
+    snapshot_flight_recorder(flight_recorder_.next_dump_path(reason), reason);
+}
+
 int SimDeviceRunnerBase::stamp_orch_so(Runtime &runtime, int32_t cid, bool force_reload) {
     if (cid < 0) {
         LOG_ERROR("stamp_orch_so: invalid callable_id=%d", cid);
@@ -307,7 +497,7 @@ int SimDeviceRunnerBase::register_callable(
         return -1;
     }
 
-    const uint64_t hash = simpler::common::utils::elf_build_id_64(orch_so_data, orch_so_size);
+    const uint64_t hash = simpler::common::utils::elf_build_id_memo_key_64(orch_so_data, orch_so_size);
 
     auto buf_it = orch_so_dedup_.find(hash);
     uint64_t dev_addr = 0;
@@ -430,7 +620,7 @@ uint64_t SimDeviceRunnerBase::upload_chip_callable_buffer(const ChipCallable *ca
         return 0;
     }
 
-    const ChipCallableLayout layout = compute_chip_callable_layout(callable);
+    const ChipCallableLayout layout = chip_callable_layout_memo_.compute(callable);
 
     auto it = chip_callable_buffers_.find(layout.content_hash);
     if (it != chip_callable_buffers_.end()) {
@@ -454,7 +644,7 @@ uint64_t SimDeviceRunnerBase::upload_chip_callable_buffer(const ChipCallable *ca
     dlopen_handles.reserve(callable->child_count());
     auto cleanup = RAIIScopeGuard([&]() {
         for (void *h : dlopen_handles)
-            dlclose(h);
+            simpler::common::sim_host::release_kernel_dso(h);
         delete[] scratch;
     });
 
@@ -464,19 +654,12 @@ uint64_t SimDeviceRunnerBase::upload_chip_callable_buffer(const ChipCallable *ca
         const void *kernel_binary = child_in_scratch->binary_data();
         size_t kernel_size = static_cast<size_t>(child_in_scratch->binary_size());
 
-        std::string tmpfile;
-        if (!simpler::common::sim_host::create_temp_so_file(
-                "/tmp/kernel_" + std::to_string(callable->child_func_id(i)) + "_XXXXXX",
-                reinterpret_cast<const uint8_t *>(kernel_binary), kernel_size, &tmpfile
-            )) {
-            LOG_ERROR("Failed to create temp file for child kernel #%d", i);
-            return 0;
-        }
-
-        void *handle = dlopen(tmpfile.c_str(), RTLD_NOW | RTLD_LOCAL);
-        std::remove(tmpfile.c_str());
+        void *handle = simpler::common::sim_host::acquire_kernel_dso(
+            reinterpret_cast<const uint8_t *>(kernel_binary), kernel_size, callable->child_func_id(i)
+        );
         if (!handle) {
-            LOG_ERROR("dlopen failed for child kernel #%d: %s", i, dlerror());
+            const char *err = dlerror();
+            LOG_ERROR("dlopen failed for child kernel #%d: %s", i, err ? err : "unknown");
             return 0;
         }
         dlopen_handles.push_back(handle);
@@ -529,7 +712,7 @@ void SimDeviceRunnerBase::release_callable_state() {
     // Pool semantics mirror per-fid binaries: never freed until finalize.
     for (auto &kv : chip_callable_buffers_) {
         for (void *h : kv.second.dlopen_handles) {
-            if (h != nullptr) dlclose(h);
+            simpler::common::sim_host::release_kernel_dso(h);
         }
         delete[] kv.second.host_scratch;
         LOG_DEBUG(
@@ -538,6 +721,7 @@ void SimDeviceRunnerBase::release_callable_state() {
         );
     }
     chip_callable_buffers_.clear();
+    chip_callable_layout_memo_.clear();
 
     // Release any prepared-callable orch SO buffers callers forgot to drop.
     for (auto &kv : orch_so_dedup_) {
@@ -38,12 +38,15 @@
 #include <vector>
 
 #include "callable.h"
+#include "chip_callable_layout.h"
 #include "prepare_callable_common.h"
 #include "utils/device_arena.h"
 #include "common/kernel_args.h"
 #include "common/l2_swimlane_profiling.h"
 #include "common/platform_config.h"
 #include "common/unified_log.h"
+#include "host/async_copy_queue.h"
+#include "host/flight_recorder.h"
 #include "host/memory_allocator.h"
 #include "host/l2_swimlane_collector.h"
 #include "host/tensor_dump_collector.h"
@@ -60,7 +63,7 @@ public:
 
     // Public virtual dtor so c_api_shared can `delete` a SimDeviceRunnerBase *
     // (destroy_device_context entrypoint).
-    virtual ~SimDeviceRunnerBase() = default;
+    virtual ~SimDeviceRunnerBase();
 
     // --- Pure / no-op virtuals dispatched from the shared c_api glue ----
     virtual int run(Runtime &runtime, int block_dim, int launch_aicpu_num = 1) = 0;
@@ -79,12 +82,29 @@ public:
     std::thread create_thread(std::function<void()> fn);
     int attach_current_thread(int device_id);
 
+    /**
+     * Destroy this runner's sim context (TPUSH/TPOP pipe state). Called by
+     * finalize_device after finalize() has joined every simulated core;
+     * idempotent.
+     */
+    void release_sim_context();
+
     void *allocate_tensor(size_t bytes);
     void free_tensor(void *dev_ptr);
     int copy_to_device(void *dev_ptr, const void *host_ptr, size_t bytes);
     int copy_from_device(void *host_ptr, const void *dev_ptr, size_t bytes);
     int device_memset(void *dev_ptr, int value, size_t bytes);
 
+    /**
+     * Async copies (host/async_copy_queue.h). Same contract as onboard; the
+     * transfer is a memcpy striped across StripedMemcpyPool lanes on the
+     * runner's copy thread.
+     */
+    int copy_to_device_async(void *dev_ptr, const void *host_ptr, size_t bytes, uint64_t *token);
+    int copy_from_device_async(void *host_ptr, const void *dev_ptr, size_t bytes, uint64_t *token);
+    int wait_copy(uint64_t token) { return async_copy_.wait(token); }
+    int query_copy(uint64_t token) { return async_copy_.query(token); }
+
     int register_callable(
         int32_t callable_id, const void *orch_so_data, size_t orch_so_size, const char *func_name,
         const char *config_name, std::vector<std::pair<int, uint64_t>> kernel_addrs, std::vector<ArgDirection> signature
@@ -110,6 +130,13 @@ public:
     uint64_t last_device_wall_ns() const { return device_wall_ns_; }
 
     void set_l2_swimlane_enabled(int level) {
+        // Low byte is the level; L2_SWIMLANE_EDGES_FLAG rides above it. Edges
+        // alone still need the swimlane pipeline, so they imply AICORE_TIMING.
+        enable_l2_edges_ = (level & L2_SWIMLANE_EDGES_FLAG) != 0;
+        level &= L2_SWIMLANE_LEVEL_MASK;
+        if (enable_l2_edges_ && level == 0) {
+            level = static_cast<int>(L2SwimlaneLevel::AICORE_TIMING);
+        }
         l2_swimlane_level_ = static_cast<L2SwimlaneLevel>(level);
         enable_l2_swimlane_ = (l2_swimlane_level_ != L2SwimlaneLevel::DISABLED);
     }
@@ -130,6 +157,16 @@ public:
     size_t aicpu_dlopen_count() const { return aicpu_dlopen_total_; }
     size_t host_dlopen_count() const { return host_dlopen_total_; }
 
+    // Flight recorder (host/flight_recorder.h). On by default; the region is
+    // allocated on the next run. dump_flight_recorder writes a snapshot to
+    // `path`, or to the dump directory when `path` is empty.
+    void configure_flight_recorder(bool enable, uint64_t slow_step_ns, const char *dump_dir) {
+        flight_recorder_.configure(enable, slow_step_ns, dump_dir);
+    }
+    int dump_flight_recorder(const char *path);
+    // Post-run trigger check (error / slow step); called after run() returns.
+    void maybe_dump_flight_recorder(int run_rc);
+
 protected:
     // --- Helpers usable by subclass run() / finalize() -------------------
     int ensure_device_initialized();
@@ -149,6 +186,9 @@ protected:
     // simpler_init and read afterwards; the user's call sequence is single-
     // threaded with respect to it so plain int is sufficient.
     int device_id_{-1};
+    // This runner's cpu_sim_context key, acquired on first attach. Never
+    // shared: run lanes on one device_id each get their own pipe state.
+    int sim_context_key_{-1};
     int block_dim_{0};
     int cores_per_blockdim_{PLATFORM_CORES_PER_BLOCKDIM};
     int worker_count_{0};
@@ -193,11 +233,30 @@ protected:
     void *device_wall_dev_ptr_{nullptr};
     uint64_t device_wall_ns_{0};
 
-    // Chip-callable buffer pool (sim path). Keyed by FNV-1a 64-bit content
-    // hash. Each entry owns a host scratch holding the ChipCallable with each
-    // child's resolved_addr_ fixed up to the dlopen'd function pointer;
-    // chip_dev == (uint64_t)host_scratch. The dlopen handles in
-    // dlopen_handles are bulk-dlclose'd in finalize().
+    // Flight-recorder region (FlightRecorderHeader + per-thread rings).
+    // Allocated lazily by ensure_flight_recorder_buffer() in run() and kept
+    // across runs so the rings carry history; freed in finalize().
+    void ensure_flight_recorder_buffer();
+    void release_flight_recorder_buffer();
+    int snapshot_flight_recorder(const std::string &path, const char *reason);
+    FlightRecorderPolicy flight_recorder_;
+    void *flight_recorder_dev_ptr_{nullptr};
+
+    // Async copy engine, started by the first copy_*_async call. Arch
+    // finalize() calls stop_async_copy() before releasing device memory.
+    // The pool is declared first so the queue stops before its lanes do.
+    int submit_async_copy(void *dst, const void *src, size_t bytes, uint64_t *token);
+    void stop_async_copy();
+    StripedMemcpyPool memcpy_pool_;
+    AsyncCopyQueue async_copy_;
+
+    // Chip-callable buffer pool (sim path). Keyed by content_hash_64 of the
+    // ChipCallable bytes. Each entry owns a host scratch holding the
+    // ChipCallable with each child's resolved_addr_ fixed up to the dlopen'd
+    // function pointer;
+    // chip_dev == (uint64_t)host_scratch. The handles in dlopen_handles are
+    // references into the process-wide kernel DSO cache (acquire_kernel_dso)
+    // and are released back to it in finalize().
     struct ChipCallableBuffer {
         uint64_t chip_dev{0};  // (uint64_t)host_scratch
         uint8_t *host_scratch{nullptr};
@@ -205,6 +264,8 @@ protected:
         std::vector<void *> dlopen_handles;
     };
     std::unordered_map<uint64_t, ChipCallableBuffer> chip_callable_buffers_;
+    // Skips rehashing a caller buffer already seen at the same address.
+    ChipCallableLayoutMemo chip_callable_layout_memo_;
 
     // Per-callable_id prepared state. Mirrors onboard.
     struct CallableState {
@@ -259,6 +320,7 @@ protected:
     bool enable_pmu_{false};
     bool enable_scope_stats_{false};
     L2SwimlaneLevel l2_swimlane_level_{L2SwimlaneLevel::DISABLED};  // resolved from set_l2_swimlane_enabled()
+    bool enable_l2_edges_{false};                                   // L2_SWIMLANE_EDGES_FLAG, same setter
     PmuEventType pmu_event_type_{PmuEventType::PIPE_UTILIZATION};   // resolved from set_pmu_enabled()
     std::string output_prefix_{};                                   // diagnostic artifact root directory
 };
@@ -270,6 +332,18 @@ namespace simpler::common::sim_host {
 // fchmod 0755 + write_all + close; on success out_path receives the path.
 bool create_temp_so_file(const std::string &path_template, const uint8_t *data, size_t size, std::string *out_path);
 
+// Process-wide cache of dlopen'd child kernel DSOs, keyed by (content hash,
+// size) and shared by every DeviceRunner in the process, so re-registering the
+// same kernel (new Worker, new callable sharing a kernel) skips the load.
+// Misses load from an anonymous memfd via /proc/self/fd/<N>; the fd stays open
+// while the DSO is resident so glibc's path-based dlopen dedup never aliases a
+// recycled fd number. Falls back to create_temp_so_file where memfd_create is
+// unavailable. Returns a refcounted handle, or nullptr (dlerror() set) on failure.
+void *acquire_kernel_dso(const uint8_t *data, size_t size, int func_id);
+
+// Drop one reference taken by acquire_kernel_dso; dlcloses on the last one.
+void release_kernel_dso(void *handle);
+
 }  // namespace simpler::common::sim_host
 
 #endif  // SRC_COMMON_PLATFORM_SIM_HOST_DEVICE_RUNNER_BASE_H_
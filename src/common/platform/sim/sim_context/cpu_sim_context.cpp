@@ -11,25 +11,30 @@
 
 /**
  * @file cpu_sim_context.cpp
- * @brief Per-device CPU simulation context for TPUSH/TPOP
+ * @brief Per-runner CPU simulation context for TPUSH/TPOP
  *
  * Provides per-thread core identity (subblock_id, cluster_id, dispatch_id)
- * and per-device pipe shared state maps.
+ * and per-context pipe shared state maps.
  *
- * Each simulated device has an independent DeviceSimContext so that multiple
- * ChipWorkers (each simulating a different device) can run concurrently.
+ * Each sim DeviceRunner has an independent DeviceSimContext, so ChipWorkers
+ * on different devices and run lanes of one ChipWorker on the same device
+ * can run concurrently.
  *
- * The current device is bound to each thread via a pthread key set in
- * pto_cpu_sim_bind_device(). Hooks called by pto-isa route through this
+ * The current context key is bound to each thread via a pthread key set in
+ * pto_cpu_sim_bind_context(). Hooks called by pto-isa route through this
  * binding to find the correct DeviceSimContext.
  *
  * Exported hooks (resolved by pto-isa via dlsym(RTLD_DEFAULT)):
  *   - pto_sim_get_subblock_id: returns current thread's AIV lane (0 or 1)
- *   - pto_sim_get_pipe_shared_state: returns per-device per-cluster
+ *   - pto_sim_get_pipe_shared_state: returns per-context per-cluster
  *     per-dispatch pipe shared memory keyed by a uint32 pipe configuration
  *
  * Per-thread TLS values (subblock_id, cluster_id, dispatch_id) are set by
  * the sim aicore platform code via the sim_context_set_* setter functions.
+ *
+ * Pipe state lookups are on the per-pipe-op hot path of every simulated
+ * core, so they resolve through a per-thread cache and a lock-free
+ * published index; pipe_state_mutex is only taken on first touch.
  */
 
 #include "cpu_sim_context.h"
@@ -39,14 +44,16 @@
 #include <atomic>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <mutex>
 #include <pthread.h>
 #include <unordered_map>
+#include <vector>
 
 namespace {
 
 // ---------------------------------------------------------------------------
-// Per-device pipe shared state
+// Per-context pipe shared state
 // ---------------------------------------------------------------------------
 
 // Key identifying a pipe shared state entry: per-cluster, per-pipe configuration.
@@ -65,56 +72,140 @@ struct PipeStateKeyHash {
     }
 };
 
+// Entries published into a fixed open-addressed index so the per-pipe-op hot
+// path resolves without taking pipe_state_mutex. Slots are only ever written
+// null -> entry (under the mutex) and stay valid until the context is
+// destroyed; a probe window overflow just falls back to the locked map.
+constexpr uint32_t PIPE_INDEX_CAPACITY = 1024;  // power of two
+constexpr uint32_t PIPE_INDEX_MAX_PROBE = 16;
+
+// Storage plus the size it was allocated with. Immutable once published: a
+// request for more bytes swaps in a new block rather than resizing in place.
+struct PipeStateBlock {
+    void *storage;
+    size_t size;
+};
+
+struct PipeStateEntry {
+    PipeStateKey key{};
+    std::atomic<PipeStateBlock *> block{nullptr};
+};
+
 struct DeviceSimContext {
-    std::mutex pipe_state_mutex;
-    std::unordered_map<PipeStateKey, void *, PipeStateKeyHash> pipe_states;
+    int device_id;  // for logs only; run lanes give several contexts the same one
+    std::mutex pipe_state_mutex;  // first-touch allocation, growth + in-place reset
+    // Owns the entries; node-based, so &entry is stable for pipe_index.
+    std::unordered_map<PipeStateKey, PipeStateEntry, PipeStateKeyHash> pipe_states;
+    std::atomic<PipeStateEntry *> pipe_index[PIPE_INDEX_CAPACITY];
+    // Blocks replaced by a larger one. A core that resolved the old pointer
+    // earlier in the run may still touch it, so they live until release.
+    std::vector<PipeStateBlock *> retired_blocks;
+    // Bumped on every reset or growth, so per-thread caches drop their lines.
+    std::atomic<uint64_t> generation{1};
+
+    explicit DeviceSimContext(int device) :
+        device_id(device) {
+        for (auto &slot : pipe_index) {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
 };
 
+uint32_t pipe_index_hash(const PipeStateKey &key) {
+    uint64_t h = PipeStateKeyHash{}(key);
+    h ^= h >> 29;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    return static_cast<uint32_t>(h >> 32);
+}
+
+// Returns the published block for key, or nullptr if it is not published or
+// is smaller than `size` (the caller then grows it under the mutex).
+PipeStateBlock *lookup_published_pipe_state(DeviceSimContext *dev, const PipeStateKey &key, size_t size) {
+    uint32_t h = pipe_index_hash(key);
+    for (uint32_t i = 0; i < PIPE_INDEX_MAX_PROBE; i++) {
+        PipeStateEntry *e = dev->pipe_index[(h + i) & (PIPE_INDEX_CAPACITY - 1)].load(std::memory_order_acquire);
+        if (e == nullptr) {
+            return nullptr;
+        }
+        if (e->key == key) {
+            PipeStateBlock *block = e->block.load(std::memory_order_acquire);
+            return (block != nullptr && block->size >= size) ? block : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+PipeStateBlock *alloc_pipe_state_block(size_t size) {
+    void *storage = std::calloc(1, size);
+    if (storage == nullptr) {
+        return nullptr;
+    }
+    return new PipeStateBlock{storage, size};
+}
+
+void free_pipe_state_block(PipeStateBlock *block) {
+    if (block != nullptr) {
+        std::free(block->storage);
+        delete block;
+    }
+}
+
+// Caller holds dev->pipe_state_mutex.
+void publish_pipe_state(DeviceSimContext *dev, PipeStateEntry *entry) {
+    uint32_t h = pipe_index_hash(entry->key);
+    for (uint32_t i = 0; i < PIPE_INDEX_MAX_PROBE; i++) {
+        auto &slot = dev->pipe_index[(h + i) & (PIPE_INDEX_CAPACITY - 1)];
+        if (slot.load(std::memory_order_relaxed) == nullptr) {
+            slot.store(entry, std::memory_order_release);
+            return;
+        }
+    }
+}
+
 std::mutex g_registry_mutex;
-std::unordered_map<int, DeviceSimContext *> g_device_contexts;
+std::unordered_map<int, DeviceSimContext *> g_contexts;
+int g_next_context_key = 0;
+// Bumped whenever a context is destroyed, so per-thread caches holding its
+// pointer (or pipe storage inside it) notice and refill.
+std::atomic<uint64_t> g_registry_epoch{1};
 
-DeviceSimContext *lookup_device_context(int device_id) {
+DeviceSimContext *lookup_context(int key) {
     std::lock_guard<std::mutex> lock(g_registry_mutex);
-    auto it = g_device_contexts.find(device_id);
-    return (it != g_device_contexts.end()) ? it->second : nullptr;
+    auto it = g_contexts.find(key);
+    return (it != g_contexts.end()) ? it->second : nullptr;
 }
 
 // ---------------------------------------------------------------------------
-// Per-thread device binding (pthread key, not thread_local)
+// Per-thread context binding (pthread key, not thread_local)
 // ---------------------------------------------------------------------------
 
-// Encode device_id as (void*)(intptr_t)(device_id + 1) so that
-// device_id 0 is distinguishable from "not set" (nullptr).
-constexpr intptr_t DEVICE_ID_OFFSET = 1;
+// Encode the context key as (void*)(intptr_t)(key + 1) so that
+// key 0 is distinguishable from "not set" (nullptr).
+constexpr intptr_t CONTEXT_KEY_OFFSET = 1;
 
-std::mutex g_device_key_mutex;
-pthread_key_t g_device_id_key{};
-std::atomic<bool> g_device_key_initialized{false};
+std::mutex g_context_key_mutex;
+pthread_key_t g_context_key{};
+std::atomic<bool> g_context_key_initialized{false};
 
-void ensure_device_key() {
-    if (g_device_key_initialized.load(std::memory_order_acquire)) {
+void ensure_context_key() {
+    if (g_context_key_initialized.load(std::memory_order_acquire)) {
         return;
     }
-    std::lock_guard<std::mutex> lock(g_device_key_mutex);
-    if (!g_device_key_initialized.load(std::memory_order_relaxed)) {
-        if (pthread_key_create(&g_device_id_key, nullptr) != 0) {
+    std::lock_guard<std::mutex> lock(g_context_key_mutex);
+    if (!g_context_key_initialized.load(std::memory_order_relaxed)) {
+        if (pthread_key_create(&g_context_key, nullptr) != 0) {
             return;
         }
-        g_device_key_initialized.store(true, std::memory_order_release);
+        g_context_key_initialized.store(true, std::memory_order_release);
     }
 }
 
-int get_current_device_id() {
-    if (!g_device_key_initialized.load(std::memory_order_acquire)) {
+int get_current_context_key() {
+    if (!g_context_key_initialized.load(std::memory_order_acquire)) {
         return -1;
     }
-    auto val = reinterpret_cast<intptr_t>(pthread_getspecific(g_device_id_key));
-    return (val != 0) ? static_cast<int>(val - DEVICE_ID_OFFSET) : -1;
-}
-
-DeviceSimContext *get_current_device_context() {
-    int id = get_current_device_id();
-    return (id >= 0) ? lookup_device_context(id) : nullptr;
+    auto val = reinterpret_cast<intptr_t>(pthread_getspecific(g_context_key));
+    return (val != 0) ? static_cast<int>(val - CONTEXT_KEY_OFFSET) : -1;
 }
 
 // ---------------------------------------------------------------------------
@@ -144,70 +235,157 @@ void ensure_identity_keys() {
     g_identity_keys_initialized.store(true, std::memory_order_release);
 }
 
-}  // namespace
-
 // ---------------------------------------------------------------------------
-// Device lifecycle
+// Per-thread pipe state cache
 // ---------------------------------------------------------------------------
 
-extern "C" void pto_cpu_sim_bind_device(int device_id) {
-    ensure_device_key();
-    pthread_setspecific(g_device_id_key, reinterpret_cast<void *>(static_cast<intptr_t>(device_id + DEVICE_ID_OFFSET)));
+// Direct-mapped cache of resolved pipe pointers, tagged with the context it
+// was filled from. Lives behind a pthread key (heap-allocated,
+// freed on thread exit) for the same TLSDESC reason as the bindings above.
+constexpr uint32_t PIPE_CACHE_LINES = 64;  // power of two
+
+struct PipeStateThreadCache {
+    uint64_t registry_epoch;  // g_registry_epoch at fill time; 0 = empty
+    uint64_t generation;      // ctx->generation at fill time
+    int context_key;
+    DeviceSimContext *ctx;
+    struct Line {
+        uint64_t pipe_key;
+        uint32_t cluster_id;
+        size_t size;
+        void *storage;  // nullptr = empty line
+    } lines[PIPE_CACHE_LINES];
+};
+
+std::mutex g_pipe_cache_key_mutex;
+pthread_key_t g_pipe_cache_key{};
+std::atomic<bool> g_pipe_cache_key_initialized{false};
+
+PipeStateThreadCache *get_thread_pipe_cache() {
+    if (!g_pipe_cache_key_initialized.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(g_pipe_cache_key_mutex);
+        if (!g_pipe_cache_key_initialized.load(std::memory_order_relaxed)) {
+            if (pthread_key_create(&g_pipe_cache_key, std::free) != 0) {
+                return nullptr;
+            }
+            g_pipe_cache_key_initialized.store(true, std::memory_order_release);
+        }
+    }
+    auto *cache = static_cast<PipeStateThreadCache *>(pthread_getspecific(g_pipe_cache_key));
+    if (cache == nullptr) {
+        cache = static_cast<PipeStateThreadCache *>(std::calloc(1, sizeof(PipeStateThreadCache)));
+        if (cache != nullptr && pthread_setspecific(g_pipe_cache_key, cache) != 0) {
+            std::free(cache);
+            cache = nullptr;
+        }
+    }
+    return cache;
+}
+
+// Resolve the calling thread's context through its cache; refills (and drops
+// every cached line) on a rebind, registry change, or a reset / growth of the
+// context's pipe states.
+DeviceSimContext *resolve_cached_context(PipeStateThreadCache *cache, int key) {
+    uint64_t epoch = g_registry_epoch.load(std::memory_order_acquire);
+    if (cache->registry_epoch == epoch && cache->context_key == key) {
+        uint64_t generation = cache->ctx->generation.load(std::memory_order_acquire);
+        if (cache->generation != generation) {
+            std::memset(cache->lines, 0, sizeof(cache->lines));
+            cache->generation = generation;
+        }
+        return cache->ctx;
+    }
+    DeviceSimContext *ctx = lookup_context(key);
+    if (ctx == nullptr) {
+        return nullptr;
+    }
+    std::memset(cache->lines, 0, sizeof(cache->lines));
+    cache->registry_epoch = epoch;
+    cache->generation = ctx->generation.load(std::memory_order_acquire);
+    cache->context_key = key;
+    cache->ctx = ctx;
+    return ctx;
 }
 
-extern "C" int pto_cpu_sim_get_bound_device(void) { return get_current_device_id(); }
+}  // namespace
+
+// ---------------------------------------------------------------------------
+// Context lifecycle
+// ---------------------------------------------------------------------------
 
-extern "C" void pto_cpu_sim_acquire_device(int device_id) {
+extern "C" int pto_cpu_sim_acquire_context(int device_id) {
     std::lock_guard<std::mutex> lock(g_registry_mutex);
-    if (g_device_contexts.find(device_id) == g_device_contexts.end()) {
-        g_device_contexts[device_id] = new DeviceSimContext();
-        // Verifies process-wide HostLogger singleton: this LOG_INFO_V0 call
-        // resolves into libsimpler_log.so loaded by ChipWorker with
-        // RTLD_GLOBAL — same instance as host_runtime.so writes to.
-        LOG_INFO_V0("cpu_sim_context: acquired device %d", device_id);
-    }
+    int key = g_next_context_key++;
+    g_contexts[key] = new DeviceSimContext(device_id);
+    // Verifies process-wide HostLogger singleton: this LOG_INFO_V0 call
+    // resolves into libsimpler_log.so loaded by ChipWorker with
+    // RTLD_GLOBAL — same instance as host_runtime.so writes to.
+    LOG_INFO_V0("cpu_sim_context: acquired context %d for device %d", key, device_id);
+    return key;
 }
 
-/** Release and destroy the context for device_id.
+/** Release and destroy the context for key.
  *
- * Safety: the caller (finalize_device in pto_runtime_c_api.cpp) must ensure
- * that all DeviceRunner worker threads for this device have been joined
- * before calling this function. This is guaranteed by DeviceRunner::finalize()
+ * Safety: the caller (finalize_device in c_api_shared.cpp) must ensure that
+ * all worker threads of the owning DeviceRunner have been joined before
+ * calling this function. This is guaranteed by DeviceRunner::finalize()
  * which joins all threads before returning.
  */
-extern "C" void pto_cpu_sim_release_device(int device_id) {
+extern "C" void pto_cpu_sim_release_context(int key) {
     DeviceSimContext *ctx = nullptr;
     {
         std::lock_guard<std::mutex> lock(g_registry_mutex);
-        auto it = g_device_contexts.find(device_id);
-        if (it == g_device_contexts.end()) {
+        auto it = g_contexts.find(key);
+        if (it == g_contexts.end()) {
             return;
         }
         ctx = it->second;
-        g_device_contexts.erase(it);
+        g_contexts.erase(it);
+        g_registry_epoch.fetch_add(1, std::memory_order_acq_rel);
     }
 
     {
         std::lock_guard<std::mutex> lock(ctx->pipe_state_mutex);
-        for (auto &[key, storage] : ctx->pipe_states) {
-            (void)key;
-            std::free(storage);
+        for (auto &[pipe, entry] : ctx->pipe_states) {
+            (void)pipe;
+            free_pipe_state_block(entry.block.load(std::memory_order_relaxed));
+        }
+        for (PipeStateBlock *block : ctx->retired_blocks) {
+            free_pipe_state_block(block);
         }
     }
     delete ctx;
 }
 
-void clear_cpu_sim_shared_storage() {
-    DeviceSimContext *ctx = get_current_device_context();
+extern "C" void pto_cpu_sim_bind_context(int key) {
+    ensure_context_key();
+    pthread_setspecific(g_context_key, reinterpret_cast<void *>(static_cast<intptr_t>(key + CONTEXT_KEY_OFFSET)));
+}
+
+extern "C" int pto_cpu_sim_get_bound_context(void) { return get_current_context_key(); }
+
+/** Zero every pipe state of context key in place.
+ *
+ * Storage is kept (not freed) across runs so pointers already published in
+ * the lock-free index stay valid; the next run sees the same zeroed state a
+ * fresh calloc would give. Per-thread caches are invalidated so every core
+ * re-checks the entry's size on its first lookup of the run. Called between
+ * runs, while no simulated core of this context is executing. Takes the key
+ * rather than the calling thread's binding, so a run entered from a thread
+ * last bound to another lane cannot wipe that lane.
+ */
+void clear_cpu_sim_shared_storage(int key) {
+    DeviceSimContext *ctx = lookup_context(key);
     if (ctx == nullptr) {
         return;
     }
     std::lock_guard<std::mutex> lock(ctx->pipe_state_mutex);
-    for (auto &[key, storage] : ctx->pipe_states) {
-        (void)key;
-        std::free(storage);
+    for (auto &[pipe, entry] : ctx->pipe_states) {
+        (void)pipe;
+        PipeStateBlock *block = entry.block.load(std::memory_order_relaxed);
+        std::memset(block->storage, 0, block->size);
     }
-    ctx->pipe_states.clear();
+    ctx->generation.fetch_add(1, std::memory_order_acq_rel);
 }
 
 // ---------------------------------------------------------------------------
@@ -240,8 +418,8 @@ extern "C" void *pto_sim_get_pipe_shared_state(uint64_t pipe_key, size_t size) {
         return nullptr;
     }
 
-    DeviceSimContext *dev = get_current_device_context();
-    if (dev == nullptr) {
+    int context_key = get_current_context_key();
+    if (context_key < 0) {
         return nullptr;
     }
 
@@ -252,13 +430,68 @@ extern "C" void *pto_sim_get_pipe_shared_state(uint64_t pipe_key, size_t size) {
 
     PipeStateKey key{cluster_id, pipe_key};
 
-    std::lock_guard<std::mutex> lock(dev->pipe_state_mutex);
-    auto it = dev->pipe_states.find(key);
-    if (it != dev->pipe_states.end()) {
-        return it->second;
+    // Fast path 1: this thread already resolved the pipe for this context.
+    PipeStateThreadCache *cache = get_thread_pipe_cache();
+    DeviceSimContext *dev =
+        (cache != nullptr) ? resolve_cached_context(cache, context_key) : lookup_context(context_key);
+    if (dev == nullptr) {
+        return nullptr;
+    }
+    PipeStateThreadCache::Line *line = nullptr;
+    if (cache != nullptr) {
+        line = &cache->lines[pipe_index_hash(key) & (PIPE_CACHE_LINES - 1)];
+        if (line->storage != nullptr && line->pipe_key == pipe_key && line->cluster_id == cluster_id &&
+            line->size >= size) {
+            return line->storage;
+        }
+    }
+
+    // Fast path 2: another core of the context already allocated it.
+    PipeStateBlock *block = lookup_published_pipe_state(dev, key, size);
+
+    // Slow path: first touch, a larger request than the existing allocation,
+    // or index overflow -- allocate under the mutex.
+    if (block == nullptr) {
+        std::lock_guard<std::mutex> lock(dev->pipe_state_mutex);
+        auto it = dev->pipe_states.find(key);
+        if (it != dev->pipe_states.end()) {
+            block = it->second.block.load(std::memory_order_relaxed);
+            if (block->size < size) {
+                PipeStateBlock *grown = alloc_pipe_state_block(size);
+                if (grown == nullptr) {
+                    LOG_ERROR(
+                        "cpu_sim_context: cannot grow pipe state 0x%llx (cluster %u) from %zu to %zu bytes",
+                        static_cast<unsigned long long>(pipe_key), cluster_id, block->size, size
+                    );
+                    return nullptr;
+                }
+                LOG_WARN(
+                    "cpu_sim_context: pipe state 0x%llx (cluster %u) grown from %zu to %zu bytes",
+                    static_cast<unsigned long long>(pipe_key), cluster_id, block->size, size
+                );
+                dev->retired_blocks.push_back(block);
+                it->second.block.store(grown, std::memory_order_release);
+                dev->generation.fetch_add(1, std::memory_order_acq_rel);
+                block = grown;
+            }
+        } else {
+            block = alloc_pipe_state_block(size);
+            if (block == nullptr) {
+                return nullptr;
+            }
+            auto &entry = dev->pipe_states[key];
+            entry.key = key;
+            entry.block.store(block, std::memory_order_release);
+            publish_pipe_state(dev, &entry);
+        }
     }
+    void *storage = block->storage;
 
-    void *storage = std::calloc(1, size);
-    dev->pipe_states.emplace(key, storage);
+    if (line != nullptr) {
+        line->pipe_key = pipe_key;
+        line->cluster_id = cluster_id;
+        line->size = block->size;
+        line->storage = storage;
+    }
     return storage;
 }
@@ -11,20 +11,19 @@
 
 /**
  * @file cpu_sim_context.h
- * @brief Per-device CPU simulation context for CANN intrinsic emulation
+ * @brief Per-runner CPU simulation context for CANN intrinsic emulation
  *
- * Each simulated device gets an isolated context (pipe shared state)
- * so multiple ChipWorkers can run concurrently without interference.
+ * Every sim DeviceRunner gets an isolated context (pipe shared state), keyed
+ * by an int handed out by pto_cpu_sim_acquire_context. Two runners on the
+ * same device_id (ChipWorker run lanes) therefore never share pipe slots, and
+ * resetting or releasing one leaves the other untouched.
  *
  * All pto_sim_* functions operate on the context bound to the calling
- * thread's device_id (set via pto_cpu_sim_bind_device).
+ * thread (set via pto_cpu_sim_bind_context).
  *
- * Invariant: each simulated device_id has a single owner ChipWorker per
- * process. The owner calls acquire_device() inside DeviceRunner's
- * attach_current_thread() (driven by ChipWorker::init) and release_device()
- * at finalize_device() time, after all worker threads for that device
- * have been joined. Concurrent access from multiple ChipWorkers to the
- * same device_id is undefined behavior.
+ * Lifetime: the runner acquires its context in attach_current_thread()
+ * (driven by simpler_init) and releases it at finalize_device() time, after
+ * all of its worker threads have been joined.
  */
 
 #pragma once
@@ -36,22 +35,22 @@
 extern "C" {
 #endif
 
-/** Bind the calling thread to a simulated device ID. */
-void pto_cpu_sim_bind_device(int device_id);
+/** Create a context for one runner on `device_id` and return its key (>= 0). */
+int pto_cpu_sim_acquire_context(int device_id);
 
-/** Return the device ID bound to the calling thread, or -1 if unbound. */
-int pto_cpu_sim_get_bound_device(void);
+/** Release and destroy the context for `key`. Unknown keys are ignored. */
+void pto_cpu_sim_release_context(int key);
 
-/** Ensure a context exists for the given device_id. */
-void pto_cpu_sim_acquire_device(int device_id);
+/** Bind the calling thread to context `key` (-1 unbinds). */
+void pto_cpu_sim_bind_context(int key);
 
-/** Release and destroy the context for the given device_id. */
-void pto_cpu_sim_release_device(int device_id);
+/** Return the context key bound to the calling thread, or -1 if unbound. */
+int pto_cpu_sim_get_bound_context(void);
 
 /** Return the current thread's AIV lane (0 or 1). Resolved by pto-isa via function pointer injection. */
 uint32_t pto_sim_get_subblock_id(void);
 
-/** Return per-device per-cluster per-dispatch pipe shared memory. Resolved by pto-isa via function pointer injection.
+/** Return per-context per-cluster per-dispatch pipe shared memory. Resolved by pto-isa via function pointer injection.
  */
 void *pto_sim_get_pipe_shared_state(uint64_t pipe_key, size_t size);
 
@@ -73,7 +72,7 @@ void sim_context_set_subblock_id(uint32_t subblock_id);
  */
 void sim_context_set_cluster_id(uint32_t cluster_id);
 
-/** Clear pipe shared state for the current thread's device. */
-void clear_cpu_sim_shared_storage();
+/** Zero pipe shared state of context `key` in place (storage and pointers are kept). */
+void clear_cpu_sim_shared_storage(int key);
 
 #endif
@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "sched_sim.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+
+namespace simpler::sched_sim {
+
+// =============================================================================
+// SchedSimGraph
+// =============================================================================
+
+SchedSimGraph::SchedSimGraph(
+    uint32_t num_tasks, const std::vector<uint32_t> &edge_src, const std::vector<uint32_t> &edge_dst,
+    const std::vector<uint32_t> &sub_task, const std::vector<uint8_t> &sub_core_type,
+    const std::vector<uint64_t> &sub_duration_ns
+) :
+    num_tasks_(num_tasks) {
+    if (edge_src.size() != edge_dst.size()) {
+        throw std::invalid_argument("SchedSimGraph: edge_src / edge_dst length mismatch");
+    }
+    if (sub_task.size() != sub_core_type.size() || sub_task.size() != sub_duration_ns.size()) {
+        throw std::invalid_argument("SchedSimGraph: subtask array length mismatch");
+    }
+
+    // Successor CSR via counting sort on src, then per-row sort + unique.
+    std::vector<uint64_t> count(static_cast<size_t>(num_tasks) + 1, 0);
+    for (size_t e = 0; e < edge_src.size(); ++e) {
+        uint32_t s = edge_src[e];
+        uint32_t d = edge_dst[e];
+        if (s >= num_tasks || d >= num_tasks) {
+            throw std::invalid_argument("SchedSimGraph: edge endpoint out of range (edge " + std::to_string(e) + ")");
+        }
+        if (s == d) {
+            throw std::invalid_argument("SchedSimGraph: self-loop on task " + std::to_string(s));
+        }
+        ++count[s + 1];
+    }
+    for (uint32_t i = 0; i < num_tasks; ++i) count[i + 1] += count[i];
+    std::vector<uint32_t> raw(edge_src.size());
+    {
+        std::vector<uint64_t> cursor(count.begin(), count.end() - 1);
+        for (size_t e = 0; e < edge_src.size(); ++e) raw[cursor[edge_src[e]]++] = edge_dst[e];
+    }
+    succ_off_.assign(static_cast<size_t>(num_tasks) + 1, 0);
+    succ_.reserve(raw.size());
+    indegree_.assign(num_tasks, 0);
+    for (uint32_t i = 0; i < num_tasks; ++i) {
+        auto b = raw.begin() + static_cast<std::ptrdiff_t>(count[i]);
+        auto e = raw.begin() + static_cast<std::ptrdiff_t>(count[i + 1]);
+        std::sort(b, e);
+        auto last = std::unique(b, e);
+        for (auto it = b; it != last; ++it) {
+            succ_.push_back(*it);
+            ++indegree_[*it];
+        }
+        succ_off_[i + 1] = succ_.size();
+    }
+
+    // Subtasks grouped by task (stable, so SPMD block order is preserved).
+    std::vector<uint64_t> scount(static_cast<size_t>(num_tasks) + 1, 0);
+    for (size_t s = 0; s < sub_task.size(); ++s) {
+        if (sub_task[s] >= num_tasks) {
+            throw std::invalid_argument("SchedSimGraph: subtask task index out of range (subtask " + std::to_string(s) + ")");
+        }
+        if (sub_core_type[s] >= kNumCoreTypes) {
+            throw std::invalid_argument("SchedSimGraph: subtask core type must be 0 (AIC) or 1 (AIV)");
+        }
+        ++scount[sub_task[s] + 1];
+    }
+    for (uint32_t i = 0; i < num_tasks; ++i) scount[i + 1] += scount[i];
+    sub_off_ = scount;
+    sub_type_.resize(sub_task.size());
+    sub_dur_.resize(sub_task.size());
+    {
+        std::vector<uint64_t> cursor(scount.begin(), scount.end() - 1);
+        for (size_t s = 0; s < sub_task.size(); ++s) {
+            uint64_t at = cursor[sub_task[s]]++;
+            sub_type_[at] = sub_core_type[s];
+            sub_dur_[at] = sub_duration_ns[s];
+        }
+    }
+
+    // Kahn topological order: detects cycles and drives bottom_level.
+    std::vector<uint32_t> order;
+    order.reserve(num_tasks);
+    std::vector<uint32_t> pending(indegree_);
+    for (uint32_t i = 0; i < num_tasks; ++i) {
+        if (pending[i] == 0) order.push_back(i);
+    }
+    for (size_t head = 0; head < order.size(); ++head) {
+        uint32_t t = order[head];
+        for (uint64_t k = succ_off_[t]; k < succ_off_[t + 1]; ++k) {
+            if (--pending[succ_[k]] == 0) order.push_back(succ_[k]);
+        }
+    }
+    if (order.size() != num_tasks) {
+        throw std::invalid_argument("SchedSimGraph: dependency graph has a cycle");
+    }
+    bottom_level_.assign(num_tasks, 0);
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        uint32_t t = *it;
+        uint64_t weight = 0;
+        for (uint64_t s = sub_off_[t]; s < sub_off_[t + 1]; ++s) weight = std::max(weight, sub_dur_[s]);
+        uint64_t tail = 0;
+        for (uint64_t k = succ_off_[t]; k < succ_off_[t + 1]; ++k) tail = std::max(tail, bottom_level_[succ_[k]]);
+        bottom_level_[t] = weight + tail;
+    }
+}
+
+// =============================================================================
+// SchedSimulator — one replay
+// =============================================================================
+
+class SchedSimulator {
+public:
+    SchedSimulator(const SchedSimGraph &g, const SchedSimConfig &cfg) :
+        g_(g),
+        cfg_(cfg) {}
+
+    SchedSimResult run();
+
+private:
+    enum class EvKind : uint8_t { SUBMIT, CORE_FIN, THREAD_DONE };
+    enum class Op : uint8_t { COMPLETE, DISPATCH, STAGE };
+
+    struct Event {
+        uint64_t time;
+        uint64_t seq;
+        uint64_t arg;  // task (SUBMIT) / subtask (CORE_FIN, THREAD_DONE)
+        int32_t thread;
+        EvKind kind;
+        Op op;
+        bool operator>(const Event &o) const { return time != o.time ? time > o.time : seq > o.seq; }
+    };
+
+    struct ReadyEntry {
+        uint64_t key;
+        uint64_t seq;
+        uint64_t sub;
+        bool operator>(const ReadyEntry &o) const { return key != o.key ? key > o.key : seq > o.seq; }
+    };
+    using ReadyHeap = std::priority_queue<ReadyEntry, std::vector<ReadyEntry>, std::greater<ReadyEntry>>;
+
+    struct Thread {
+        bool busy{false};
+    };
+
+    int32_t pool_of_thread(int32_t th) const { return shared_ ? 0 : th; }
+    int32_t pool_of_core(int32_t core) const { return shared_ ? 0 : core % cfg_.num_threads; }
+
+    void push_event(uint64_t time, EvKind kind, uint64_t arg, int32_t thread = -1, Op op = Op::COMPLETE) {
+        events_.push(Event{time, seq_++, arg, thread, kind, op});
+    }
+
+    void on_submit(uint64_t now, uint32_t task);
+    void make_ready(uint64_t now, uint32_t task);
+    void task_completed(uint64_t now, uint32_t task);
+    void task_dispatched(uint32_t task);
+    void maybe_spec_candidate(uint32_t task);
+    void schedule_next_submit(uint64_t earliest);
+    void try_start(uint64_t now, int32_t th);
+    bool try_dispatch(uint64_t now, int32_t th, bool spec);
+
+    const SchedSimGraph &g_;
+    const SchedSimConfig &cfg_;
+    bool shared_{false};
+
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events_;
+    uint64_t seq_{0};
+
+    // Per task.
+    std::vector<uint32_t> remaining_;   // producers not yet completed
+    std::vector<uint32_t> dispatched_;  // producers fully dispatched (early dispatch)
+    std::vector<uint32_t> subs_left_;   // subtasks not yet retired
+    std::vector<uint32_t> undispatched_;
+    std::vector<uint8_t> submitted_;
+    std::vector<uint8_t> ready_;
+    std::vector<uint8_t> completed_;
+    std::vector<uint64_t> ready_time_;
+
+    // Per subtask.
+    std::vector<int32_t> sub_core_;
+    std::vector<uint8_t> sub_staged_;
+    std::vector<uint64_t> sub_earliest_start_;
+    std::vector<uint32_t> sub_task_;
+
+    // Cores / pools.
+    std::vector<uint8_t> core_type_;
+    std::vector<std::vector<int32_t>> idle_[kNumCoreTypes];  // [type][pool] -> stack
+    std::vector<std::deque<uint64_t>> fin_queue_;           // [pool] -> subtasks with FIN pending
+    ReadyHeap ready_q_[kNumCoreTypes];
+    std::deque<uint64_t> spec_q_[kNumCoreTypes];
+    std::vector<Thread> threads_;
+
+    // Orchestrator.
+    uint32_t next_submit_{0};
+    uint32_t retired_prefix_{0};
+    bool orch_stalled_{false};
+    uint64_t stall_from_{0};
+
+    // Stats.
+    uint64_t completed_count_{0};
+    uint64_t last_complete_{0};
+    uint64_t kernel_busy_[kNumCoreTypes]{0, 0};
+    uint64_t thread_busy_{0};
+    uint64_t ready_wait_sum_{0};
+    uint64_t ready_wait_n_{0};
+    uint64_t spec_staged_{0};
+    uint64_t ring_stall_{0};
+};
+
+void SchedSimulator::schedule_next_submit(uint64_t earliest) {
+    if (next_submit_ >= g_.num_tasks_) return;
+    if (cfg_.ring_size > 0 && static_cast<uint64_t>(next_submit_) >=
+                                  static_cast<uint64_t>(retired_prefix_) + static_cast<uint64_t>(cfg_.ring_size)) {
+        orch_stalled_ = true;
+        stall_from_ = earliest;
+        return;
+    }
+    push_event(earliest, EvKind::SUBMIT, next_submit_);
+}
+
+void SchedSimulator::on_submit(uint64_t now, uint32_t task) {
+    submitted_[task] = 1;
+    ++next_submit_;
+    if (remaining_[task] == 0) {
+        make_ready(now, task);
+    } else {
+        maybe_spec_candidate(task);
+    }
+    schedule_next_submit(now + cfg_.orch_submit_ns);
+}
+
+void SchedSimulator::maybe_spec_candidate(uint32_t task) {
+    if (!cfg_.early_dispatch || ready_[task] || !submitted_[task] || dispatched_[task] != g_.indegree_[task]) return;
+    for (uint64_t s = g_.sub_off_[task]; s < g_.sub_off_[task + 1]; ++s) {
+        spec_q_[g_.sub_type_[s]].push_back(s);
+    }
+}
+
+void SchedSimulator::make_ready(uint64_t now, uint32_t task) {
+    ready_[task] = 1;
+    ready_time_[task] = now;
+    if (g_.sub_off_[task] == g_.sub_off_[task + 1]) {
+        task_dispatched(task);
+        task_completed(now, task);
+        return;
+    }
+    for (uint64_t s = g_.sub_off_[task]; s < g_.sub_off_[task + 1]; ++s) {
+        if (sub_staged_[s]) {
+            // Doorbell release: the gated block starts without another pass
+            // through the ready queue.
+            uint64_t start = std::max(now + cfg_.spec_release_ns, sub_earliest_start_[s]);
+            push_event(start + g_.sub_dur_[s], EvKind::CORE_FIN, s);
+            ++spec_staged_;
+            ++ready_wait_n_;
+            continue;
+        }
+        uint64_t key = 0;
+        switch (cfg_.policy) {
+        case ReadyPolicy::FIFO:
+            key = seq_;
+            break;
+        case ReadyPolicy::PRIORITY:
+            key = std::numeric_limits<uint64_t>::max() - g_.bottom_level_[task];
+            break;
+        case ReadyPolicy::SUBMIT_ORDER:
+            key = task;
+            break;
+        }
+        ready_q_[g_.sub_type_[s]].push(ReadyEntry{key, seq_++, s});
+    }
+}
+
+void SchedSimulator::task_dispatched(uint32_t task) {
+    if (!cfg_.early_dispatch) return;
+    for (uint64_t k = g_.succ_off_[task]; k < g_.succ_off_[task + 1]; ++k) {
+        uint32_t c = g_.succ_[k];
+        ++dispatched_[c];
+        maybe_spec_candidate(c);
+    }
+}
+
+void SchedSimulator::task_completed(uint64_t now, uint32_t task) {
+    completed_[task] = 1;
+    ++completed_count_;
+    last_complete_ = std::max(last_complete_, now);
+    for (uint64_t k = g_.succ_off_[task]; k < g_.succ_off_[task + 1]; ++k) {
+        uint32_t c = g_.succ_[k];
+        if (--remaining_[c] == 0 && submitted_[c]) make_ready(now, c);
+    }
+    uint32_t before = retired_prefix_;
+    while (retired_prefix_ < g_.num_tasks_ && completed_[retired_prefix_]) ++retired_prefix_;
+    if (orch_stalled_ && retired_prefix_ != before) {
+        if (static_cast<uint64_t>(next_submit_) <
+            static_cast<uint64_t>(retired_prefix_) + static_cast<uint64_t>(cfg_.ring_size)) {
+            orch_stalled_ = false;
+            uint64_t at = std::max(now, stall_from_);
+            ring_stall_ += at - stall_from_;
+            push_event(at, EvKind::SUBMIT, next_submit_);
+        }
+    }
+}
+
+bool SchedSimulator::try_dispatch(uint64_t now, int32_t th, bool spec) {
+    int32_t pool = pool_of_thread(th);
+    // Pick the best head across core types that have an idle core here.
+    int best_type = -1;
+    for (int t = 0; t < kNumCoreTypes; ++t) {
+        if (idle_[t][pool].empty()) continue;
+        if (spec) {
+            auto &q = spec_q_[t];
+            while (!q.empty() && (ready_[sub_task_[q.front()]] || sub_staged_[q.front()])) q.pop_front();
+            if (q.empty()) continue;
+            if (best_type < 0) best_type = t;
+        } else {
+            if (ready_q_[t].empty()) continue;
+            if (best_type < 0 || ready_q_[t].top().key < ready_q_[best_type].top().key ||
+                (ready_q_[t].top().key == ready_q_[best_type].top().key &&
+                 ready_q_[t].top().seq < ready_q_[best_type].top().seq)) {
+                best_type = t;
+            }
+        }
+    }
+    if (best_type < 0) return false;
+
+    uint64_t s;
+    if (spec) {
+        s = spec_q_[best_type].front();
+        spec_q_[best_type].pop_front();
+    } else {
+        s = ready_q_[best_type].top().sub;
+        ready_q_[best_type].pop();
+    }
+    int32_t core = idle_[best_type][pool].back();
+    idle_[best_type][pool].pop_back();
+    sub_core_[s] = core;
+    uint64_t done = now + cfg_.dispatch_ns;
+    threads_[th].busy = true;
+    thread_busy_ += cfg_.dispatch_ns;
+    kernel_busy_[best_type] += g_.sub_dur_[s];
+    if (spec) {
+        sub_staged_[s] = 1;
+        sub_earliest_start_[s] = done + cfg_.launch_ns;
+        push_event(done, EvKind::THREAD_DONE, s, th, Op::STAGE);
+    } else {
+        uint32_t task = sub_task_[s];
+        ready_wait_sum_ += now - ready_time_[task];
+        ++ready_wait_n_;
+        push_event(done + cfg_.launch_ns + g_.sub_dur_[s], EvKind::CORE_FIN, s);
+        push_event(done, EvKind::THREAD_DONE, s, th, Op::DISPATCH);
+    }
+    return true;
+}
+
+void SchedSimulator::try_start(uint64_t now, int32_t th) {
+    if (threads_[th].busy) return;
+    int32_t pool = pool_of_thread(th);
+    auto &fins = fin_queue_[pool];
+    if (!fins.empty()) {
+        uint64_t s = fins.front();
+        fins.pop_front();
+        uint32_t task = sub_task_[s];
+        uint64_t cost = cfg_.complete_ns;
+        if (subs_left_[task] == 1) cost += cfg_.fanout_edge_ns * (g_.succ_off_[task + 1] - g_.succ_off_[task]);
+        threads_[th].busy = true;
+        thread_busy_ += cost;
+        push_event(now + cost, EvKind::THREAD_DONE, s, th, Op::COMPLETE);
+        return;
+    }
+    if (try_dispatch(now, th, false)) return;
+    if (cfg_.early_dispatch) try_dispatch(now, th, true);
+}
+
+SchedSimResult SchedSimulator::run() {
+    if (cfg_.num_threads <= 0) throw std::invalid_argument("SchedSimConfig: num_threads must be > 0");
+    if (cfg_.num_aic < 0 || cfg_.num_aiv < 0) throw std::invalid_argument("SchedSimConfig: core counts must be >= 0");
+    if (cfg_.ring_size < 0) throw std::invalid_argument("SchedSimConfig: ring_size must be >= 0");
+    const int32_t cores_of[kNumCoreTypes] = {cfg_.num_aic, cfg_.num_aiv};
+    for (uint64_t s = 0; s < g_.sub_dur_.size(); ++s) {
+        if (cores_of[g_.sub_type_[s]] == 0) {
+            throw std::invalid_argument(
+                std::string("SchedSimConfig: graph has ") + (g_.sub_type_[s] == 0 ? "AIC" : "AIV") +
+                " subtasks but zero cores of that type"
+            );
+        }
+    }
+
+    shared_ = cfg_.core_assignment == CoreAssignment::SHARED;
+    const uint32_t n = g_.num_tasks_;
+    const uint64_t ns = g_.sub_dur_.size();
+    remaining_ = g_.indegree_;
+    dispatched_.assign(n, 0);
+    subs_left_.resize(n);
+    undispatched_.resize(n);
+    for (uint32_t t = 0; t < n; ++t) {
+        subs_left_[t] = static_cast<uint32_t>(g_.sub_off_[t + 1] - g_.sub_off_[t]);
+        undispatched_[t] = subs_left_[t];
+    }
+    submitted_.assign(n, 0);
+    ready_.assign(n, 0);
+    completed_.assign(n, 0);
+    ready_time_.assign(n, 0);
+    sub_core_.assign(ns, -1);
+    sub_staged_.assign(ns, 0);
+    sub_earliest_start_.assign(ns, 0);
+    sub_task_.resize(ns);
+    for (uint32_t t = 0; t < n; ++t) {
+        for (uint64_t s = g_.sub_off_[t]; s < g_.sub_off_[t + 1]; ++s) sub_task_[s] = t;
+    }
+
+    const int32_t pools = shared_ ? 1 : cfg_.num_threads;
+    const int32_t total_cores = cfg_.num_aic + cfg_.num_aiv;
+    core_type_.resize(total_cores);
+    for (int t = 0; t < kNumCoreTypes; ++t) idle_[t].assign(pools, {});
+    // AIC cores take ids [0, num_aic), AIV the rest; both round-robin over
+    // threads so each partition gets a proportional slice of each type.
+    for (int32_t c = total_cores - 1; c >= 0; --c) {
+        int type = c < cfg_.num_aic ? 0 : 1;
+        int32_t local = type == 0 ? c : c - cfg_.num_aic;
+        core_type_[c] = static_cast<uint8_t>(type);
+        idle_[type][shared_ ? 0 : local % cfg_.num_threads].push_back(c);
+    }
+    fin_queue_.assign(pools, {});
+    threads_.assign(cfg_.num_threads, Thread{});
+
+    schedule_next_submit(0);
+    uint64_t now = 0;
+    while (!events_.empty()) {
+        Event ev = events_.top();
+        events_.pop();
+        now = ev.time;
+        switch (ev.kind) {
+        case EvKind::SUBMIT:
+            on_submit(now, static_cast<uint32_t>(ev.arg));
+            break;
+        case EvKind::CORE_FIN: {
+            int32_t core = sub_core_[ev.arg];
+            int32_t type = core_type_[core];
+            int32_t local = type == 0 ? core : core - cfg_.num_aic;
+            fin_queue_[shared_ ? 0 : local % cfg_.num_threads].push_back(ev.arg);
+            break;
+        }
+        case EvKind::THREAD_DONE: {
+            threads_[ev.thread].busy = false;
+            uint64_t s = ev.arg;
+            uint32_t task = sub_task_[s];
+            if (ev.op == Op::COMPLETE) {
+                int32_t core = sub_core_[s];
+                int32_t type = core_type_[core];
+                int32_t local = type == 0 ? core : core - cfg_.num_aic;
+                idle_[type][shared_ ? 0 : local % cfg_.num_threads].push_back(core);
+                if (--subs_left_[task] == 0) task_completed(now, task);
+            } else if (--undispatched_[task] == 0) {
+                task_dispatched(task);
+            }
+            break;
+        }
+        }
+        // Same-timestamp events settle before any thread picks work, so a
+        // batch of simultaneous FINs is seen together (matches one poll pass).
+        if (!events_.empty() && events_.top().time == now) continue;
+        for (int32_t th = 0; th < cfg_.num_threads; ++th) try_start(now, th);
+    }
+
+    if (completed_count_ != n) {
+        throw std::runtime_error(
+            "SchedSim: replay stalled with " + std::to_string(n - completed_count_) + " task(s) incomplete"
+        );
+    }
+
+    SchedSimResult r;
+    r.makespan_ns = last_complete_;
+    for (uint32_t t = 0; t < n; ++t) {
+        if (g_.indegree_[t] == 0) r.critical_path_ns = std::max(r.critical_path_ns, g_.bottom_level_[t]);
+    }
+    if (r.makespan_ns > 0) {
+        double span = static_cast<double>(r.makespan_ns);
+        if (cfg_.num_aic > 0) r.aic_utilization = static_cast<double>(kernel_busy_[0]) / (span * cfg_.num_aic);
+        if (cfg_.num_aiv > 0) r.aiv_utilization = static_cast<double>(kernel_busy_[1]) / (span * cfg_.num_aiv);
+        r.thread_utilization = static_cast<double>(thread_busy_) / (span * cfg_.num_threads);
+    }
+    r.orch_ring_stall_ns = ring_stall_;
+    r.mean_ready_wait_ns = ready_wait_n_ ? static_cast<double>(ready_wait_sum_) / ready_wait_n_ : 0.0;
+    r.tasks = n;
+    r.subtasks = ns;
+    r.spec_staged = spec_staged_;
+    return r;
+}
+
+SchedSimResult simulate(const SchedSimGraph &graph, const SchedSimConfig &config) {
+    SchedSimulator sim(graph, config);
+    return sim.run();
+}
+
+}  // namespace simpler::sched_sim
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * SchedSim — discrete-event "what-if" replay of a PTO2 task DAG.
+ *
+ * Input is the graph a run actually produced: dep_gen's deps.json edges plus
+ * per-subtask kernel durations from l2_swimlane_records_*.json. The graph is
+ * flattened into CSR arrays once (`SchedSimGraph`). It is then replayed any
+ * number of times under a `SchedSimConfig`, which sets scheduler thread
+ * count, ready-queue policy, core ownership, speculative early dispatch and
+ * task-ring size. The result is a predicted makespan and utilisation
+ * (`SchedSimResult`). The Python front end is
+ * simpler_setup/tools/sched_whatif.py.
+ *
+ * Model (mirrors the tensormap_and_ringbuffer scheduler at the level the
+ * swimlane can calibrate; see docs/dfx/sched-whatif.md):
+ *
+ *   - Orchestrator: one serial submitter. Task i is submitted
+ *     `orch_submit_ns` after task i-1. With `ring_size > 0` it also waits
+ *     until task i - ring_size has retired. Retirement is FIFO: it is the
+ *     contiguous prefix of completed tasks, like last_task_alive.
+ *   - Scheduler threads: serial servers. A free thread first drains its
+ *     pending completions (`complete_ns` per subtask, plus
+ *     `fanout_edge_ns` per successor when the task's last subtask
+ *     finishes). It then pops ready subtasks onto its idle cores
+ *     (`dispatch_ns` each). A dispatched subtask starts on its core after
+ *     `launch_ns` more.
+ *   - Cores: AIC / AIV pools. PARTITIONED gives the k-th core of each type
+ *     to thread k % num_threads, and only the owner dispatches to it and
+ *     retires its FINs. SHARED lets any thread use any core. A core stays
+ *     busy until its FIN has been processed.
+ *   - Early dispatch: once every producer of a task has been dispatched, an
+ *     otherwise idle thread may stage the task's subtasks onto idle cores
+ *     (paying `dispatch_ns`). The core is held while gated. When the last
+ *     producer completes, the staged blocks start after `spec_release_ns`
+ *     instead of going through the ready queue.
+ *
+ * A subtask is one (core type, duration) dispatch: SPMD blocks and the
+ * AIC/AIV halves of a mixed task are separate subtasks. A task completes
+ * when all its subtasks complete. Tasks with no subtasks (alloc / dummy)
+ * complete as soon as they are ready, at zero cost.
+ *
+ * Complexity is O((V + E + S) log(V + S)) per replay with flat arrays only,
+ * so a 1M-task graph replays in about a second.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace simpler::sched_sim {
+
+enum class CoreType : uint8_t { AIC = 0, AIV = 1 };
+constexpr int kNumCoreTypes = 2;
+
+enum class ReadyPolicy : uint8_t {
+    FIFO = 0,          // ready order (runtime default)
+    PRIORITY = 1,      // longest remaining critical path first
+    SUBMIT_ORDER = 2,  // lowest submission index first
+};
+
+enum class CoreAssignment : uint8_t {
+    PARTITIONED = 0,  // core c owned by thread c % num_threads (runtime default)
+    SHARED = 1,       // any thread dispatches to / retires any core
+};
+
+struct SchedSimConfig {
+    int32_t num_threads{3};
+    int32_t num_aic{24};
+    int32_t num_aiv{48};
+    ReadyPolicy policy{ReadyPolicy::FIFO};
+    CoreAssignment core_assignment{CoreAssignment::PARTITIONED};
+    bool early_dispatch{false};
+    int64_t ring_size{0};  // 0 = unbounded task window
+
+    // Cost model, nanoseconds.
+    uint64_t orch_submit_ns{0};
+    uint64_t dispatch_ns{200};
+    uint64_t complete_ns{100};
+    uint64_t fanout_edge_ns{20};
+    uint64_t launch_ns{500};
+    uint64_t spec_release_ns{100};
+};
+
+struct SchedSimResult {
+    uint64_t makespan_ns{0};
+    uint64_t critical_path_ns{0};  // infinite-resource, zero-overhead bound
+    double aic_utilization{0.0};   // kernel-busy / (num_aic * makespan)
+    double aiv_utilization{0.0};
+    double thread_utilization{0.0};  // scheduler-busy / (num_threads * makespan)
+    uint64_t orch_ring_stall_ns{0};  // orchestrator time blocked on ring_size
+    double mean_ready_wait_ns{0.0};  // ready -> dispatch start, per subtask
+    uint64_t tasks{0};
+    uint64_t subtasks{0};
+    uint64_t spec_staged{0};  // subtasks that started via early dispatch
+};
+
+/**
+ * Immutable CSR view of a task DAG. Task indices are submission order.
+ * Edges may arrive in any order and may repeat; duplicates are dropped.
+ * Construction throws std::invalid_argument for out-of-range indices,
+ * self-loops or cycles.
+ */
+class SchedSimGraph {
+public:
+    SchedSimGraph(
+        uint32_t num_tasks, const std::vector<uint32_t> &edge_src, const std::vector<uint32_t> &edge_dst,
+        const std::vector<uint32_t> &sub_task, const std::vector<uint8_t> &sub_core_type,
+        const std::vector<uint64_t> &sub_duration_ns
+    );
+
+    uint32_t num_tasks() const { return num_tasks_; }
+    uint64_t num_edges() const { return succ_.size(); }
+    uint64_t num_subtasks() const { return sub_dur_.size(); }
+
+    // Longest path (sum of per-task max subtask duration) from each task to a sink.
+    const std::vector<uint64_t> &bottom_level() const { return bottom_level_; }
+
+private:
+    friend class SchedSimulator;
+
+    uint32_t num_tasks_;
+    std::vector<uint64_t> succ_off_;  // size num_tasks + 1
+    std::vector<uint32_t> succ_;
+    std::vector<uint32_t> indegree_;
+    std::vector<uint64_t> sub_off_;  // size num_tasks + 1, subtasks grouped by task
+    std::vector<uint8_t> sub_type_;
+    std::vector<uint64_t> sub_dur_;
+    std::vector<uint64_t> bottom_level_;
+};
+
+// Replays `graph` under `config`. Throws std::invalid_argument when the
+// config cannot run the graph (no threads, or a subtask needs a core type
+// with zero cores).
+SchedSimResult simulate(const SchedSimGraph &graph, const SchedSimConfig &config);
+
+}  // namespace simpler::sched_sim
@@ -110,7 +110,7 @@ struct RuntimeEnv {
 struct CallConfig {
     int32_t block_dim = 0;  // 0 = auto; resolved by DeviceRunner at run() time
     int32_t aicpu_thread_num = 3;
-    int32_t enable_l2_swimlane = 0;
+    int32_t enable_l2_swimlane = 0;  // low byte = level (0-4); 0x100 = also export wired edges
     int32_t enable_dump_tensor = 0;
     int32_t enable_pmu = 0;  // 0 = disabled; >0 = enabled, value selects event type
     int32_t enable_dep_gen = 0;
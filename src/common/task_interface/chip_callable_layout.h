@@ -12,8 +12,8 @@
  * Platform-agnostic ChipCallable layout / content-hash helpers used by
  * DeviceRunner::upload_chip_callable_buffer on every platform variant.
  *
- * The byte-size math (mirroring make_callable<>()'s layout) and FNV-1a dedup
- * hash are identical on onboard and sim. Only the H2D mechanism diverges:
+ * The byte-size math (mirroring make_callable<>()'s layout) and content_hash_64
+ * dedup hash are identical on onboard and sim. Only the H2D mechanism diverges:
  * onboard rtMemcpy's the scratch into device GM after rewriting each child's
  * resolved_addr_ to a device offset; sim instead dlopen's each child kernel
  * and writes the resulting function pointer into resolved_addr_. The
@@ -25,14 +25,16 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <unordered_map>
 
 #include "callable.h"
-#include "utils/fnv1a_64.h"
+#include "utils/content_hash_64.h"
+#include "utils/elf_build_id.h"
 
 struct ChipCallableLayout {
     size_t header_size;     // offsetof(ChipCallable, storage_)
     size_t total_size;      // header_size + storage_used (matches make_callable())
-    uint64_t content_hash;  // FNV-1a 64 over [callable, total_size)
+    uint64_t content_hash;  // content_hash_64 over [callable, total_size)
 };
 
 /**
@@ -52,10 +54,75 @@ inline ChipCallableLayout compute_chip_callable_layout(const ChipCallable *calla
         if (end > storage_used) storage_used = end;
     }
     const size_t total_size = kHeaderSize + storage_used;
-    const uint64_t hash = simpler::common::utils::fnv1a_64(reinterpret_cast<const uint8_t *>(callable), total_size);
+    const uint64_t hash =
+        simpler::common::utils::content_hash_64(reinterpret_cast<const uint8_t *>(callable), total_size);
     return ChipCallableLayout{kHeaderSize, total_size, hash};
 }
 
+/**
+ * Per-pointer memo over compute_chip_callable_layout().
+ *
+ * prepare_callable re-uploads the same host ChipCallable buffer on every
+ * (re)registration; rehashing multi-MB of child kernels each time is pure
+ * waste. Entries are keyed by buffer address and validated by a cheap probe
+ * (ChipCallable header, every CoreCallable header, and the ELF Build-ID of
+ * the orch binary and each child kernel). Build-IDs are byte-identity by
+ * linker contract, so a freed-and-reused address with new content misses.
+ * Callables whose binaries lack a Build-ID are never memoized and always take
+ * the full hash. Not thread-safe: one instance per DeviceRunner.
+ */
+class ChipCallableLayoutMemo {
+public:
+    ChipCallableLayout compute(const ChipCallable *callable) {
+        uint64_t probe = 0;
+        const bool probe_ok = compute_probe(callable, &probe);
+        if (probe_ok) {
+            auto it = entries_.find(callable);
+            if (it != entries_.end() && it->second.probe == probe) {
+                return it->second.layout;
+            }
+        }
+        const ChipCallableLayout layout = compute_chip_callable_layout(callable);
+        if (probe_ok) {
+            if (entries_.size() >= kMaxEntries) entries_.clear();
+            entries_[callable] = Entry{probe, layout};
+        }
+        return layout;
+    }
+
+    void clear() { entries_.clear(); }
+
+private:
+    static constexpr size_t kMaxEntries = 256;
+
+    struct Entry {
+        uint64_t probe;
+        ChipCallableLayout layout;
+    };
+
+    static bool compute_probe(const ChipCallable *callable, uint64_t *out) {
+        using simpler::common::utils::content_hash_64;
+        using simpler::common::utils::elf_find_build_id_64;
+        constexpr size_t kHeaderSize = offsetof(ChipCallable, storage_);
+        uint64_t h = content_hash_64(callable, kHeaderSize);
+        uint64_t id = 0;
+        if (callable->binary_size() > 0) {
+            if (!elf_find_build_id_64(callable->binary_data(), callable->binary_size(), &id)) return false;
+            h = content_hash_64(&id, sizeof(id)) ^ (h * 0x9E3779B185EBCA87ULL);
+        }
+        for (int32_t i = 0; i < callable->child_count(); ++i) {
+            const CoreCallable &c = callable->child(i);
+            if (!elf_find_build_id_64(c.binary_data(), c.binary_size(), &id)) return false;
+            const uint64_t child_words[2] = {id, content_hash_64(&c, CoreCallable::binary_data_offset())};
+            h = content_hash_64(child_words, sizeof(child_words)) ^ (h * 0x9E3779B185EBCA87ULL);
+        }
+        *out = h;
+        return true;
+    }
+
+    std::unordered_map<const ChipCallable *, Entry> entries_;
+};
+
 /**
  * Onboard-style scratch patch: rewrite each child's resolved_addr_ in the
  * host scratch buffer to the device-side code address of the child's binary,
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Native SUB callable ABI.
+ *
+ * A SUB callable may be a plain C symbol exported from a shared library
+ * instead of a Python function (see `NativeSubCallable` in worker.py). The
+ * worker hands it a borrowed `TaskArgsView` — over the mailbox blob in a
+ * forked SUB child, or straight over the slot's TaskArgs for in-process SUB
+ * workers — so nothing is decoded or copied per task.
+ *
+ * Contract:
+ *   - return 0 on success;
+ *   - on failure return non-zero and optionally write a NUL-terminated
+ *     message of at most `err_size` bytes (including the NUL) into `err`;
+ *   - never throw across the boundary;
+ *   - the view and everything it points at are only valid for the call.
+ *
+ * In-process SUB workers call the symbol concurrently from several worker
+ * threads, so it must be reentrant.
+ *
+ *     #include "native_sub_abi.h"
+ *     SIMPLER_NATIVE_SUB(argmax_rows) {
+ *         Tensor logits = args->tensors(0);
+ *         ...
+ *         return 0;
+ *     }
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "task_args.h"
+
+extern "C" {
+typedef int32_t (*SimplerNativeSubFn)(const TaskArgsView *args, char *err, size_t err_size);
+}
+
+#define SIMPLER_NATIVE_SUB(name)                                 \
+    extern "C" __attribute__((visibility("default"))) int32_t name( \
+        const TaskArgsView *args, char *err, size_t err_size     \
+    )
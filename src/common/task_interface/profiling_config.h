@@ -16,6 +16,15 @@
 #define PTO2_PROFILING 1
 #endif
 
+// Flight-recorder probes (dispatch / FIN / scope / allocator block).
+// Independent of PTO2_PROFILING so serving builds that compile profiling out
+// can still turn the recorder on. Compiled in, they cost a null-pointer branch
+// until configure_flight_recorder(True) maps a region; see
+// docs/dfx/flight-recorder.md.
+#ifndef PTO2_FLIGHT_RECORDER
+#define PTO2_FLIGHT_RECORDER 1
+#endif
+
 #ifndef PTO2_ORCH_PROFILING
 #define PTO2_ORCH_PROFILING 0
 #endif
@@ -290,6 +290,17 @@ struct alignas(64) Tensor {
         return result;
     }
 
+    /// Re-base this view in place: patch start_offset and version only.
+    /// shapes / strides / is_contiguous / extent_elem_cache do not depend on
+    /// the origin, so nothing else is recomputed. Lets a caller that already
+    /// built one view of a given shape step it to its siblings (e.g.
+    /// successive KV blocks) for the cost of two stores instead of a view().
+    void reoffset(uint64_t new_start_offset, int32_t in_version) {
+        start_offset = new_start_offset;
+        version = in_version;
+        assert_in_buffer_bounds();
+    }
+
     bool valid_transpose(uint32_t x, uint32_t y) const { return x < ndims && y < ndims; }
 
     /// Swap two dimensions: shapes/stride swapped together. start_offset unchanged.
@@ -15,7 +15,10 @@
 // Read the first 8 bytes of the ELF64 GNU Build-ID (NT_GNU_BUILD_ID) as a
 // uint64_t. Falls back to FNV-1a over the full buffer when the note is
 // missing (e.g. linker invoked without --build-id) or the input is not a
-// well-formed ELF64 image.
+// well-formed ELF64 image. elf_build_id_64 is persisted (installed inner-SO
+// names) and recomputed by the AICPU side, so its fallback must stay on the
+// stable fnv1a_64; elf_build_id_memo_key_64 falls back to the faster
+// content_hash_64 and is for in-process dedup keys only.
 //
 // The Build-ID is a linker-computed hash written into `.note.gnu.build-id`
 // whenever `-Wl,--build-id` is passed (the compiler default on GCC/Clang).
@@ -27,6 +30,7 @@
 #include <cstdint>
 #include <cstring>
 
+#include "content_hash_64.h"
 #include "fnv1a_64.h"
 
 // <elf.h> is Linux-only. On other platforms (macOS, Windows) we embed the
@@ -91,28 +95,29 @@ struct Elf64_Nhdr {
 
 namespace simpler::common::utils {
 
-// Returns a 64-bit identifier derived from the ELF64 GNU Build-ID. Falls
-// back to FNV-1a over the whole buffer when no Build-ID is available.
-inline uint64_t elf_build_id_64(const void *data, std::size_t len) {
+// Look up the ELF64 GNU Build-ID. Returns true and writes its first 8 bytes
+// to *out when the note is present; false for non-ELF64 / malformed inputs or
+// images linked without --build-id.
+inline bool elf_find_build_id_64(const void *data, std::size_t len, uint64_t *out) {
     if (data == nullptr || len < sizeof(Elf64_Ehdr)) {
-        return fnv1a_64(data, len);
+        return false;
     }
     const auto *base = static_cast<const uint8_t *>(data);
     Elf64_Ehdr ehdr{};
     std::memcpy(&ehdr, base, sizeof(ehdr));
 
-    // Validate ELF magic and 64-bit class; otherwise fall back.
+    // Validate ELF magic and 64-bit class.
     if (ehdr.e_ident[EI_MAG0] != ELFMAG0 || ehdr.e_ident[EI_MAG1] != ELFMAG1 || ehdr.e_ident[EI_MAG2] != ELFMAG2 ||
         ehdr.e_ident[EI_MAG3] != ELFMAG3 || ehdr.e_ident[EI_CLASS] != ELFCLASS64) {
-        return fnv1a_64(data, len);
+        return false;
     }
     if (ehdr.e_phoff == 0 || ehdr.e_phentsize < sizeof(Elf64_Phdr)) {
-        return fnv1a_64(data, len);
+        return false;
     }
     // Guard against truncated / malformed inputs.
     std::size_t phdr_end = ehdr.e_phoff + static_cast<std::size_t>(ehdr.e_phnum) * ehdr.e_phentsize;
     if (phdr_end > len) {
-        return fnv1a_64(data, len);
+        return false;
     }
 
     for (std::size_t i = 0; i < ehdr.e_phnum; ++i) {
@@ -139,17 +144,37 @@ inline uint64_t elf_build_id_64(const void *data, std::size_t len) {
             }
             if (nhdr.n_type == NT_GNU_BUILD_ID && nhdr.n_namesz == 4 && std::memcmp(name, "GNU\0", 4) == 0 &&
                 nhdr.n_descsz >= sizeof(uint64_t)) {
-                uint64_t id = 0;
-                std::memcpy(&id, desc, sizeof(id));
-                return id;
+                std::memcpy(out, desc, sizeof(*out));
+                return true;
             }
             note = next;
         }
     }
+    return false;
+}
+
+// Returns a 64-bit identifier derived from the ELF64 GNU Build-ID. Falls
+// back to FNV-1a over the whole buffer when no Build-ID is available. Stable
+// across builds: safe to persist or compare with a peer.
+inline uint64_t elf_build_id_64(const void *data, std::size_t len) {
+    uint64_t id = 0;
+    if (elf_find_build_id_64(data, len, &id)) {
+        return id;
+    }
     // No Build-ID found; the SO was likely linked without --build-id.
     return fnv1a_64(data, len);
 }
 
+// Same Build-ID lookup, but falls back to content_hash_64. Values may change
+// between releases: use only for keys that never leave the process.
+inline uint64_t elf_build_id_memo_key_64(const void *data, std::size_t len) {
+    uint64_t id = 0;
+    if (elf_find_build_id_64(data, len, &id)) {
+        return id;
+    }
+    return content_hash_64(data, len);
+}
+
 }  // namespace simpler::common::utils
 
 #endif  // SIMPLER_COMMON_UTILS_ELF_BUILD_ID_H_
@@ -13,6 +13,7 @@
 
 #include <dlfcn.h>
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <stdexcept>
@@ -101,6 +102,10 @@ void ChipWorker::init(
         device_free_ctx_fn_ = load_symbol<DeviceFreeCtxFn>(handle, "device_free_ctx");
         copy_to_device_ctx_fn_ = load_symbol<CopyToDeviceCtxFn>(handle, "copy_to_device_ctx");
         copy_from_device_ctx_fn_ = load_symbol<CopyFromDeviceCtxFn>(handle, "copy_from_device_ctx");
+        copy_to_device_async_ctx_fn_ = load_symbol<CopyAsyncCtxFn>(handle, "copy_to_device_async_ctx");
+        copy_from_device_async_ctx_fn_ = load_symbol<CopyAsyncCtxFn>(handle, "copy_from_device_async_ctx");
+        wait_copy_ctx_fn_ = load_symbol<CopyTokenFn>(handle, "wait_copy_ctx");
+        query_copy_ctx_fn_ = load_symbol<CopyTokenFn>(handle, "query_copy_ctx");
         get_runtime_size_fn_ = load_symbol<GetRuntimeSizeFn>(handle, "get_runtime_size");
         simpler_init_fn_ = load_symbol<SimplerInitFn>(handle, "simpler_init");
         prepare_callable_fn_ = load_symbol<PrepareCallableFn>(handle, "prepare_callable");
@@ -108,6 +113,9 @@ void ChipWorker::init(
         unregister_callable_fn_ = load_symbol<UnregisterCallableFn>(handle, "unregister_callable");
         get_aicpu_dlopen_count_fn_ = load_symbol<GetAicpuDlopenCountFn>(handle, "get_aicpu_dlopen_count");
         get_host_dlopen_count_fn_ = load_symbol<GetAicpuDlopenCountFn>(handle, "get_host_dlopen_count");
+        supports_run_lanes_fn_ = load_symbol<SupportsRunLanesFn>(handle, "supports_run_lanes");
+        configure_flight_recorder_fn_ = load_symbol<ConfigureFlightRecorderFn>(handle, "configure_flight_recorder");
+        dump_flight_recorder_fn_ = load_symbol<DumpFlightRecorderFn>(handle, "dump_flight_recorder");
         finalize_device_fn_ = load_symbol<FinalizeDeviceFn>(handle, "finalize_device");
         // ACL lifecycle + comm_* are part of the uniform host_runtime.so ABI.
         // Every platform runtime exports all of them — runtimes that do not
@@ -182,6 +190,10 @@ void ChipWorker::init(
         device_free_ctx_fn_ = nullptr;
         copy_to_device_ctx_fn_ = nullptr;
         copy_from_device_ctx_fn_ = nullptr;
+        copy_to_device_async_ctx_fn_ = nullptr;
+        copy_from_device_async_ctx_fn_ = nullptr;
+        wait_copy_ctx_fn_ = nullptr;
+        query_copy_ctx_fn_ = nullptr;
         get_runtime_size_fn_ = nullptr;
         simpler_init_fn_ = nullptr;
         prepare_callable_fn_ = nullptr;
@@ -189,6 +201,9 @@ void ChipWorker::init(
         unregister_callable_fn_ = nullptr;
         get_aicpu_dlopen_count_fn_ = nullptr;
         get_host_dlopen_count_fn_ = nullptr;
+        supports_run_lanes_fn_ = nullptr;
+        configure_flight_recorder_fn_ = nullptr;
+        dump_flight_recorder_fn_ = nullptr;
         finalize_device_fn_ = nullptr;
         ensure_acl_ready_fn_ = nullptr;
         create_comm_stream_fn_ = nullptr;
@@ -220,6 +235,10 @@ void ChipWorker::init(
         device_free_ctx_fn_ = nullptr;
         copy_to_device_ctx_fn_ = nullptr;
         copy_from_device_ctx_fn_ = nullptr;
+        copy_to_device_async_ctx_fn_ = nullptr;
+        copy_from_device_async_ctx_fn_ = nullptr;
+        wait_copy_ctx_fn_ = nullptr;
+        query_copy_ctx_fn_ = nullptr;
         get_runtime_size_fn_ = nullptr;
         simpler_init_fn_ = nullptr;
         prepare_callable_fn_ = nullptr;
@@ -227,6 +246,9 @@ void ChipWorker::init(
         unregister_callable_fn_ = nullptr;
         get_aicpu_dlopen_count_fn_ = nullptr;
         get_host_dlopen_count_fn_ = nullptr;
+        supports_run_lanes_fn_ = nullptr;
+        configure_flight_recorder_fn_ = nullptr;
+        dump_flight_recorder_fn_ = nullptr;
         finalize_device_fn_ = nullptr;
         ensure_acl_ready_fn_ = nullptr;
         create_comm_stream_fn_ = nullptr;
@@ -244,6 +266,9 @@ void ChipWorker::init(
         throw std::runtime_error("simpler_init failed with code " + std::to_string(init_rc));
     }
 
+    aicpu_path_ = aicpu_path;
+    aicore_path_ = aicore_path;
+    dispatcher_path_ = dispatcher_path;
     device_id_ = device_id;
     initialized_ = true;
 }
@@ -252,6 +277,7 @@ void ChipWorker::finalize() {
     // Defensive: if the user never called comm_destroy, reclaim all owned
     // communicator handles and streams before tearing down the device context.
     clear_comm_sessions();
+    destroy_run_lanes();
 
     if (device_ctx_ != nullptr && finalize_device_fn_ != nullptr && initialized_) {
         finalize_device_fn_(device_ctx_);
@@ -270,12 +296,19 @@ void ChipWorker::finalize() {
     device_free_ctx_fn_ = nullptr;
     copy_to_device_ctx_fn_ = nullptr;
     copy_from_device_ctx_fn_ = nullptr;
+    copy_to_device_async_ctx_fn_ = nullptr;
+    copy_from_device_async_ctx_fn_ = nullptr;
+    wait_copy_ctx_fn_ = nullptr;
+    query_copy_ctx_fn_ = nullptr;
     get_runtime_size_fn_ = nullptr;
     prepare_callable_fn_ = nullptr;
     run_prepared_fn_ = nullptr;
     unregister_callable_fn_ = nullptr;
     get_aicpu_dlopen_count_fn_ = nullptr;
     get_host_dlopen_count_fn_ = nullptr;
+    supports_run_lanes_fn_ = nullptr;
+    configure_flight_recorder_fn_ = nullptr;
+    dump_flight_recorder_fn_ = nullptr;
     finalize_device_fn_ = nullptr;
     ensure_acl_ready_fn_ = nullptr;
     create_comm_stream_fn_ = nullptr;
@@ -290,11 +323,156 @@ void ChipWorker::finalize() {
     comm_barrier_fn_ = nullptr;
     comm_destroy_fn_ = nullptr;
     runtime_buf_.clear();
+    prepared_callable_mask_ = 0;
     initialized_ = false;
     device_id_ = -1;
     finalized_ = true;
 }
 
+void ChipWorker::configure_run_lanes(const std::vector<int> &block_dims, const std::vector<int> &aicpu_thread_nums) {
+    if (!initialized_) {
+        throw std::runtime_error("ChipWorker not initialized; call init() first");
+    }
+    if (!run_lanes_.empty()) {
+        throw std::runtime_error("configure_run_lanes: run lanes already configured");
+    }
+    if (prepared_callable_mask_ != 0) {
+        throw std::runtime_error("configure_run_lanes must be called before any prepare_callable");
+    }
+    if (supports_run_lanes_fn_() == 0) {
+        throw std::runtime_error(
+            "configure_run_lanes: run lanes are sim-only; this runtime shares one AICPU executor per device"
+        );
+    }
+    if (block_dims.empty() || block_dims.size() != aicpu_thread_nums.size()) {
+        throw std::runtime_error(
+            "configure_run_lanes: block_dims and aicpu_thread_nums must be non-empty and equal length"
+        );
+    }
+    for (size_t i = 0; i < block_dims.size(); i++) {
+        if (block_dims[i] < 1 || aicpu_thread_nums[i] < 1) {
+            throw std::runtime_error(
+                "configure_run_lanes: lane " + std::to_string(i) + " needs block_dim >= 1 and aicpu_thread_num >= 1"
+            );
+        }
+    }
+
+    std::vector<RunLane> lanes(block_dims.size());
+    for (size_t i = 0; i < lanes.size(); i++) {
+        lanes[i].block_dim = block_dims[i];
+        lanes[i].aicpu_thread_num = aicpu_thread_nums[i];
+        lanes[i].runtime_buf.resize(get_runtime_size_fn_());
+    }
+    lanes[0].device_ctx = device_ctx_;
+
+    // Extra lanes are full device contexts on the same device: simpler_init
+    // attaches them and hands them their own copy of the executors, so each
+    // gets its own streams and runtime arena on first run.
+    auto teardown = [this, &lanes]() {
+        for (size_t i = 1; i < lanes.size(); i++) {
+            if (lanes[i].device_ctx != nullptr) {
+                finalize_device_fn_(lanes[i].device_ctx);
+                destroy_device_context_fn_(lanes[i].device_ctx);
+                lanes[i].device_ctx = nullptr;
+            }
+        }
+    };
+    try {
+        std::vector<uint8_t> aicpu_bytes = read_binary_file(aicpu_path_);
+        std::vector<uint8_t> aicore_bytes = read_binary_file(aicore_path_);
+        std::vector<uint8_t> dispatcher_bytes;
+        if (!dispatcher_path_.empty()) {
+            dispatcher_bytes = read_binary_file(dispatcher_path_);
+        }
+        const uint8_t *dispatcher_ptr = dispatcher_bytes.empty() ? nullptr : dispatcher_bytes.data();
+        for (size_t i = 1; i < lanes.size(); i++) {
+            void *ctx = create_device_context_fn_();
+            if (ctx == nullptr) {
+                throw std::runtime_error("configure_run_lanes: create_device_context returned null");
+            }
+            int rc = simpler_init_fn_(
+                ctx, device_id_, aicpu_bytes.data(), aicpu_bytes.size(), aicore_bytes.data(), aicore_bytes.size(),
+                dispatcher_ptr, dispatcher_bytes.size()
+            );
+            if (rc != 0) {
+                destroy_device_context_fn_(ctx);
+                throw std::runtime_error("configure_run_lanes: simpler_init failed with code " + std::to_string(rc));
+            }
+            lanes[i].device_ctx = ctx;
+            if (flight_recorder_configured_) {
+                rc = configure_flight_recorder_fn_(
+                    ctx, flight_recorder_enabled_ ? 1 : 0, flight_recorder_slow_step_ns_,
+                    flight_recorder_dump_dir_.c_str()
+                );
+                if (rc != 0) {
+                    throw std::runtime_error(
+                        "configure_run_lanes: configure_flight_recorder failed with code " + std::to_string(rc)
+                    );
+                }
+            }
+        }
+    } catch (...) {
+        teardown();
+        throw;
+    }
+    run_lanes_ = std::move(lanes);
+}
+
+void ChipWorker::destroy_run_lanes() {
+    // Lane 0 is device_ctx_ itself; finalize() tears it down afterwards.
+    for (size_t i = 1; i < run_lanes_.size(); i++) {
+        void *ctx = run_lanes_[i].device_ctx;
+        if (ctx == nullptr) {
+            continue;
+        }
+        if (finalize_device_fn_ != nullptr) {
+            finalize_device_fn_(ctx);
+        }
+        if (destroy_device_context_fn_ != nullptr) {
+            destroy_device_context_fn_(ctx);
+        }
+    }
+    run_lanes_.clear();
+}
+
+size_t ChipWorker::acquire_run_lane(int block_dim) {
+    std::unique_lock<std::mutex> lock(run_lanes_mutex_);
+    bool fits_any = false;
+    for (const RunLane &lane : run_lanes_) {
+        fits_any = fits_any || block_dim <= lane.block_dim;
+    }
+    if (!fits_any) {
+        throw std::runtime_error("run: block_dim " + std::to_string(block_dim) + " exceeds every run lane's block_dim");
+    }
+    for (;;) {
+        // Best fit: the smallest free lane that covers the request, so big
+        // lanes stay available for the runs that need them.
+        size_t best = run_lanes_.size();
+        for (size_t i = 0; i < run_lanes_.size(); i++) {
+            const RunLane &lane = run_lanes_[i];
+            if (lane.busy || block_dim > lane.block_dim) {
+                continue;
+            }
+            if (best == run_lanes_.size() || lane.block_dim < run_lanes_[best].block_dim) {
+                best = i;
+            }
+        }
+        if (best != run_lanes_.size()) {
+            run_lanes_[best].busy = true;
+            return best;
+        }
+        run_lane_freed_.wait(lock);
+    }
+}
+
+void ChipWorker::release_run_lane(size_t index) {
+    {
+        std::lock_guard<std::mutex> lock(run_lanes_mutex_);
+        run_lanes_[index].busy = false;
+    }
+    run_lane_freed_.notify_all();
+}
+
 void ChipWorker::prepare_callable(int32_t callable_id, const void *callable) {
     if (!initialized_) {
         throw std::runtime_error("ChipWorker not initialized; call init() first");
@@ -306,6 +484,20 @@ void ChipWorker::prepare_callable(int32_t callable_id, const void *callable) {
     if (rc != 0) {
         throw std::runtime_error("prepare_callable failed with code " + std::to_string(rc));
     }
+    for (size_t i = 1; i < run_lanes_.size(); i++) {
+        rc = prepare_callable_fn_(run_lanes_[i].device_ctx, callable_id, callable);
+        if (rc != 0) {
+            for (size_t j = i; j-- > 0;) {
+                unregister_callable_fn_(run_lanes_[j].device_ctx, callable_id);
+            }
+            throw std::runtime_error(
+                "prepare_callable failed on run lane " + std::to_string(i) + " with code " + std::to_string(rc)
+            );
+        }
+    }
+    if (callable_id >= 0 && callable_id < 64) {
+        prepared_callable_mask_ |= uint64_t{1} << callable_id;
+    }
 }
 
 RunTiming ChipWorker::run(int32_t callable_id, TaskArgsView args, const CallConfig &config) {
@@ -318,11 +510,36 @@ RunTiming ChipWorker::run(int32_t callable_id, const ChipStorageTaskArgs *args,
     if (!initialized_) {
         throw std::runtime_error("ChipWorker not initialized; call init() first");
     }
+    if (run_lanes_.empty()) {
+        return run_prepared_checked(
+            device_ctx_, runtime_buf_.data(), callable_id, args, config, config.block_dim, config.aicpu_thread_num
+        );
+    }
 
-    void *rt = runtime_buf_.data();
+    size_t index = acquire_run_lane(config.block_dim);
+    RunLane &lane = run_lanes_[index];
+    int block_dim = config.block_dim == 0 ? lane.block_dim : config.block_dim;
+    int aicpu_thread_num = std::min<int>(config.aicpu_thread_num, lane.aicpu_thread_num);
+    RunTiming timing;
+    try {
+        timing = run_prepared_checked(
+            lane.device_ctx, lane.runtime_buf.data(), callable_id, args, config, block_dim, aicpu_thread_num
+        );
+    } catch (...) {
+        release_run_lane(index);
+        throw;
+    }
+    release_run_lane(index);
+    return timing;
+}
+
+RunTiming ChipWorker::run_prepared_checked(
+    void *ctx, void *runtime, int32_t callable_id, const ChipStorageTaskArgs *args, const CallConfig &config,
+    int block_dim, int aicpu_thread_num
+) {
     PtoRunTiming timing{0, 0};
     int rc = run_prepared_fn_(
-        device_ctx_, rt, callable_id, args, config.block_dim, config.aicpu_thread_num, config.enable_l2_swimlane,
+        ctx, runtime, callable_id, args, block_dim, aicpu_thread_num, config.enable_l2_swimlane,
         config.enable_dump_tensor, config.enable_pmu, config.enable_dep_gen, config.enable_scope_stats,
         config.runtime_env.ring_task_window, config.runtime_env.ring_heap, config.runtime_env.ring_dep_pool,
         config.output_prefix, &timing
@@ -338,6 +555,15 @@ void ChipWorker::unregister_callable(int32_t callable_id) {
         throw std::runtime_error("ChipWorker not initialized; call init() first");
     }
     int rc = unregister_callable_fn_(device_ctx_, callable_id);
+    for (size_t i = 1; i < run_lanes_.size(); i++) {
+        int lane_rc = unregister_callable_fn_(run_lanes_[i].device_ctx, callable_id);
+        if (rc == 0) {
+            rc = lane_rc;
+        }
+    }
+    if (callable_id >= 0 && callable_id < 64) {
+        prepared_callable_mask_ &= ~(uint64_t{1} << callable_id);
+    }
     if (rc != 0) {
         throw std::runtime_error("unregister_callable failed with code " + std::to_string(rc));
     }
@@ -357,6 +583,33 @@ size_t ChipWorker::host_dlopen_count() const {
     return get_host_dlopen_count_fn_(device_ctx_);
 }
 
+void ChipWorker::configure_flight_recorder(bool enable, uint64_t slow_step_ns, const std::string &dump_dir) {
+    if (!initialized_) {
+        throw std::runtime_error("ChipWorker not initialized; call init() first");
+    }
+    int rc = configure_flight_recorder_fn_(device_ctx_, enable ? 1 : 0, slow_step_ns, dump_dir.c_str());
+    for (size_t i = 1; i < run_lanes_.size() && rc == 0; i++) {
+        rc = configure_flight_recorder_fn_(run_lanes_[i].device_ctx, enable ? 1 : 0, slow_step_ns, dump_dir.c_str());
+    }
+    if (rc != 0) {
+        throw std::runtime_error("configure_flight_recorder failed with code " + std::to_string(rc));
+    }
+    flight_recorder_configured_ = true;
+    flight_recorder_enabled_ = enable;
+    flight_recorder_slow_step_ns_ = slow_step_ns;
+    flight_recorder_dump_dir_ = dump_dir;
+}
+
+void ChipWorker::dump_flight_recorder(const std::string &path) {
+    if (!initialized_) {
+        throw std::runtime_error("ChipWorker not initialized; call init() first");
+    }
+    int rc = dump_flight_recorder_fn_(device_ctx_, path.c_str());
+    if (rc != 0) {
+        throw std::runtime_error("dump_flight_recorder failed with code " + std::to_string(rc));
+    }
+}
+
 void *ChipWorker::create_comm_stream_checked(const char *op_name) {
     int rc = ensure_acl_ready_fn_(device_ctx_, device_id_);
     if (rc != 0) {
@@ -496,6 +749,55 @@ void ChipWorker::copy_from(uint64_t dst, uint64_t src, size_t size) {
     }
 }
 
+uint64_t ChipWorker::copy_to_async(uint64_t dst, uint64_t src, size_t size) {
+    if (!initialized_) {
+        throw std::runtime_error("ChipWorker not initialized; call init() first");
+    }
+    uint64_t token = 0;
+    int rc = copy_to_device_async_ctx_fn_(
+        device_ctx_, reinterpret_cast<void *>(dst), reinterpret_cast<const void *>(src), size, &token
+    );
+    if (rc != 0) {
+        throw std::runtime_error("copy_to_async failed with code " + std::to_string(rc));
+    }
+    return token;
+}
+
+uint64_t ChipWorker::copy_from_async(uint64_t dst, uint64_t src, size_t size) {
+    if (!initialized_) {
+        throw std::runtime_error("ChipWorker not initialized; call init() first");
+    }
+    uint64_t token = 0;
+    int rc = copy_from_device_async_ctx_fn_(
+        device_ctx_, reinterpret_cast<void *>(dst), reinterpret_cast<const void *>(src), size, &token
+    );
+    if (rc != 0) {
+        throw std::runtime_error("copy_from_async failed with code " + std::to_string(rc));
+    }
+    return token;
+}
+
+void ChipWorker::wait_copy(uint64_t token) {
+    if (!initialized_) {
+        throw std::runtime_error("ChipWorker not initialized; call init() first");
+    }
+    int rc = wait_copy_ctx_fn_(device_ctx_, token);
+    if (rc != 0) {
+        throw std::runtime_error("async copy " + std::to_string(token) + " failed with code " + std::to_string(rc));
+    }
+}
+
+bool ChipWorker::copy_done(uint64_t token) {
+    if (!initialized_) {
+        throw std::runtime_error("ChipWorker not initialized; call init() first");
+    }
+    int rc = query_copy_ctx_fn_(device_ctx_, token);
+    if (rc < 0) {
+        throw std::runtime_error("async copy " + std::to_string(token) + " failed with code " + std::to_string(rc));
+    }
+    return rc == 1;
+}
+
 uint64_t ChipWorker::comm_init(int rank, int nranks, const std::string &rootinfo_path) {
     if (!initialized_) {
         throw std::runtime_error("ChipWorker not initialized; call init() first");
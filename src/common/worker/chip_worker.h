@@ -12,7 +12,9 @@
 #ifndef SRC_COMMON_WORKER_CHIP_WORKER_H_
 #define SRC_COMMON_WORKER_CHIP_WORKER_H_
 
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -62,10 +64,33 @@ public:
     RunTiming run(int32_t callable_id, const ChipStorageTaskArgs *args, const CallConfig &config);
 
     // Per-callable_id preparation. Requires init() first and a callable_id
-    // in [0, MAX_REGISTERED_CALLABLE_IDS) (cap 64).
+    // in [0, MAX_REGISTERED_CALLABLE_IDS) (cap 64). With run lanes
+    // configured, the callable is prepared on every lane.
     void prepare_callable(int32_t callable_id, const void *callable);
     void unregister_callable(int32_t callable_id);
 
+    /// Split the device into run lanes so independent graphs can share it
+    /// (docs/chip-level-arch.md, "Run Lanes"). Lane i is a separate device
+    /// context — its own AICPU/AICore streams and runtime arena — that runs
+    /// with at most `block_dims[i]` AICore blocks and `aicpu_thread_nums[i]`
+    /// AICPU threads. Lane 0 reuses the context created by init().
+    ///
+    /// Once configured, `run` may be called concurrently from several
+    /// threads: each call takes the smallest free lane whose block_dim cap
+    /// covers `config.block_dim` (0 = the lane's cap), clamps
+    /// `config.aicpu_thread_num` to the lane's cap, and blocks while every
+    /// fitting lane is busy. All other methods keep the single-thread rule.
+    ///
+    /// Sim only: throws on runtimes whose supports_run_lanes() is 0 (onboard,
+    /// where every context on a device shares one AICPU executor).
+    ///
+    /// Must be called after init(), before any prepare_callable, and at most
+    /// once. Caps should sum to no more than the chip's AICore / AICPU
+    /// resources — lanes only bound each run, the hardware scheduler places
+    /// the blocks.
+    void configure_run_lanes(const std::vector<int> &block_dims, const std::vector<int> &aicpu_thread_nums);
+    size_t run_lane_count() const { return run_lanes_.size(); }
+
     /// Number of distinct callable_ids the AICPU has been asked to dlopen for
     /// on the bound device. Returns 0 when not initialized or the runtime
     /// variant has no per-cid registration support. Used by tests to assert
@@ -77,11 +102,29 @@ public:
     /// `aicpu_dlopen_count` for the trb path; returns 0 on device-orch variants.
     size_t host_dlopen_count() const;
 
+    /// Flight recorder (docs/dfx/flight-recorder.md). `configure` sets the
+    /// automatic-dump policy: with a non-empty `dump_dir`, failed runs and runs
+    /// whose device wall exceeds `slow_step_ns` (0 = off) are snapshotted
+    /// there. `dump` writes the current ring contents to `path` on demand.
+    void configure_flight_recorder(bool enable, uint64_t slow_step_ns, const std::string &dump_dir);
+    void dump_flight_recorder(const std::string &path);
+
     uint64_t malloc(size_t size);
     void free(uint64_t ptr);
     void copy_to(uint64_t dst, uint64_t src, size_t size);
     void copy_from(uint64_t dst, uint64_t src, size_t size);
 
+    /// Async variants of copy_to / copy_from. Return a completion token
+    /// immediately; the transfer runs on the runtime's copy thread through
+    /// pinned staging (onboard) or a striped memcpy pool (sim). The host
+    /// buffer must stay alive until `wait_copy(token)` returns or
+    /// `copy_done(token)` is true. `wait_copy` / `copy_done` throw if the
+    /// transfer failed.
+    uint64_t copy_to_async(uint64_t dst, uint64_t src, size_t size);
+    uint64_t copy_from_async(uint64_t dst, uint64_t src, size_t size);
+    void wait_copy(uint64_t token);
+    bool copy_done(uint64_t token);
+
     /// Distributed communication primitives (optional — only available when
     /// the bound runtime exports comm_*).  Wraps the backend-neutral C API
     /// defined in src/<arch>/platform/include/host/comm.h.
@@ -135,6 +178,8 @@ private:
     using DeviceFreeCtxFn = void (*)(void *, void *);
     using CopyToDeviceCtxFn = int (*)(void *, void *, const void *, size_t);
     using CopyFromDeviceCtxFn = int (*)(void *, void *, const void *, size_t);
+    using CopyAsyncCtxFn = int (*)(void *, void *, const void *, size_t, uint64_t *);
+    using CopyTokenFn = int (*)(void *, uint64_t);
     using GetRuntimeSizeFn = size_t (*)();
     // From host_runtime.so. Single platform-side init that does (a) thread
     // attach + device-id record, (b) executor binary takeover, (c) onboard
@@ -149,6 +194,9 @@ private:
     using UnregisterCallableFn = int (*)(void *, int32_t);
     using GetAicpuDlopenCountFn = size_t (*)(void *);
     using FinalizeDeviceFn = int (*)(void *);
+    using SupportsRunLanesFn = int (*)();
+    using ConfigureFlightRecorderFn = int (*)(void *, int, uint64_t, const char *);
+    using DumpFlightRecorderFn = int (*)(void *, const char *);
     using EnsureAclReadyFn = int (*)(void *, int);
     using CreateCommStreamFn = void *(*)(void *);
     using DestroyCommStreamFn = int (*)(void *, void *);
@@ -163,6 +211,14 @@ private:
     using CommBarrierFn = int (*)(void *);
     using CommDestroyFn = int (*)(void *);
 
+    struct RunLane {
+        void *device_ctx = nullptr;  // lane 0 borrows device_ctx_
+        std::vector<uint8_t> runtime_buf;
+        int block_dim = 0;
+        int aicpu_thread_num = 0;
+        bool busy = false;
+    };
+
     struct CommSession {
         void *handle = nullptr;
         void *stream = nullptr;
@@ -172,6 +228,14 @@ private:
         size_t window_size = 0;
     };
 
+    RunTiming run_prepared_checked(
+        void *ctx, void *runtime, int32_t callable_id, const ChipStorageTaskArgs *args, const CallConfig &config,
+        int block_dim, int aicpu_thread_num
+    );
+    size_t acquire_run_lane(int block_dim);
+    void release_run_lane(size_t index);
+    void destroy_run_lanes();
+
     void *create_comm_stream_checked(const char *op_name);
     void destroy_comm_stream_best_effort(void *stream, int *rc);
     CommSession *find_comm_session(uint64_t comm_handle);
@@ -187,6 +251,10 @@ private:
     DeviceFreeCtxFn device_free_ctx_fn_ = nullptr;
     CopyToDeviceCtxFn copy_to_device_ctx_fn_ = nullptr;
     CopyFromDeviceCtxFn copy_from_device_ctx_fn_ = nullptr;
+    CopyAsyncCtxFn copy_to_device_async_ctx_fn_ = nullptr;
+    CopyAsyncCtxFn copy_from_device_async_ctx_fn_ = nullptr;
+    CopyTokenFn wait_copy_ctx_fn_ = nullptr;
+    CopyTokenFn query_copy_ctx_fn_ = nullptr;
     GetRuntimeSizeFn get_runtime_size_fn_ = nullptr;
     SimplerInitFn simpler_init_fn_ = nullptr;
     PrepareCallableFn prepare_callable_fn_ = nullptr;
@@ -194,6 +262,9 @@ private:
     UnregisterCallableFn unregister_callable_fn_ = nullptr;
     GetAicpuDlopenCountFn get_aicpu_dlopen_count_fn_ = nullptr;
     GetAicpuDlopenCountFn get_host_dlopen_count_fn_ = nullptr;
+    SupportsRunLanesFn supports_run_lanes_fn_ = nullptr;
+    ConfigureFlightRecorderFn configure_flight_recorder_fn_ = nullptr;
+    DumpFlightRecorderFn dump_flight_recorder_fn_ = nullptr;
     FinalizeDeviceFn finalize_device_fn_ = nullptr;
     EnsureAclReadyFn ensure_acl_ready_fn_ = nullptr;
     CreateCommStreamFn create_comm_stream_fn_ = nullptr;
@@ -213,6 +284,24 @@ private:
     uint64_t base_comm_handle_ = 0;
 
     std::vector<uint8_t> runtime_buf_;
+
+    // Run lanes (empty = single-lane mode on device_ctx_ / runtime_buf_).
+    // busy flags are guarded by run_lanes_mutex_; the vector itself only
+    // changes in configure_run_lanes / finalize.
+    std::vector<RunLane> run_lanes_;
+    std::mutex run_lanes_mutex_;
+    std::condition_variable run_lane_freed_;
+    // Kept from init() so configure_run_lanes can bring up extra contexts.
+    std::string aicpu_path_;
+    std::string aicore_path_;
+    std::string dispatcher_path_;
+    // One bit per prepared callable_id; lanes cannot be added once set.
+    uint64_t prepared_callable_mask_ = 0;
+    // Last configure_flight_recorder call, replayed onto new lanes.
+    bool flight_recorder_configured_ = false;
+    bool flight_recorder_enabled_ = false;
+    uint64_t flight_recorder_slow_step_ns_ = 0;
+    std::string flight_recorder_dump_dir_;
     // device_id_ is set once in init() and never modified afterward. All
     // ChipWorker callers run on the thread that called init() (the same
     // thread is the only one that subsequently calls malloc / copy_to /
@@ -24,8 +24,11 @@
  *   - sizing:       get_runtime_size
  *   - device-mem:   device_malloc_ctx, device_free_ctx,
  *                   copy_to_device_ctx, copy_from_device_ctx
+ *   - async copy:   copy_to_device_async_ctx, copy_from_device_async_ctx,
+ *                   wait_copy_ctx, query_copy_ctx
  *   - prepared run: prepare_callable, run_prepared, unregister_callable,
  *                   get_aicpu_dlopen_count, get_host_dlopen_count
+ *   - run lanes:    supports_run_lanes
  *   - ACL/stream:   ensure_acl_ready_ctx, create_comm_stream_ctx,
  *                   destroy_comm_stream_ctx
  *   - comm:         comm_init, comm_alloc_windows, comm_get_local_window_base,
@@ -105,6 +108,30 @@ int copy_to_device_ctx(DeviceContextHandle ctx, void *dev_ptr, const void *host_
 /** Copy device memory to a host pointer within the given device context. */
 int copy_from_device_ctx(DeviceContextHandle ctx, void *host_ptr, const void *dev_ptr, size_t size);
 
+/**
+ * Asynchronous host->device copy. Enqueues the transfer on the context's
+ * copy thread (pinned staging + dedicated stream onboard, striped memcpy on
+ * sim) and stores a completion token in `*token`. `host_ptr` must stay valid
+ * and unmodified until the token completes. Returns 0 when enqueued.
+ */
+int copy_to_device_async_ctx(
+    DeviceContextHandle ctx, void *dev_ptr, const void *host_ptr, size_t size, uint64_t *token
+);
+
+/** Asynchronous device->host copy; same contract as copy_to_device_async_ctx. */
+int copy_from_device_async_ctx(
+    DeviceContextHandle ctx, void *host_ptr, const void *dev_ptr, size_t size, uint64_t *token
+);
+
+/**
+ * Block until the copy behind `token` completes. Returns its rc (0 on
+ * success), or -1 for an unknown token.
+ */
+int wait_copy_ctx(DeviceContextHandle ctx, uint64_t token);
+
+/** Non-blocking status of `token`: 1 = done, 0 = pending, negative = error rc. */
+int query_copy_ctx(DeviceContextHandle ctx, uint64_t token);
+
 /**
  * One-shot platform-side init. Called once by ChipWorker::init() right
  * after dlopen, before any other entry. Three responsibilities, in order:
@@ -119,7 +146,7 @@ int copy_from_device_ctx(DeviceContextHandle ctx, void *host_ptr, const void *de
  *      by simpler_log_init); it never travels through this ABI.
  *
  *   2. Attach the calling thread to `device_id` (rtSetDevice on onboard,
- *      pto_cpu_sim_bind_device + pto_cpu_sim_acquire_device on sim) and
+ *      pto_cpu_sim_acquire_context + pto_cpu_sim_bind_context on sim) and
  *      record the device id on the DeviceRunner so subsequent device-ops
  *      can re-attach their own caller threads idempotently.
  *
@@ -227,6 +254,30 @@ int run_prepared(
  */
 int unregister_callable(DeviceContextHandle ctx, int32_t callable_id);
 
+/**
+ * Configure the always-on flight recorder (per-AICPU-thread overwrite rings
+ * of dispatch / FIN / scope / allocator-block events, see
+ * docs/dfx/flight-recorder.md). The recorder is enabled by default; the
+ * setting applies from the next `run_prepared`.
+ *
+ * After each run the rings are snapshotted to `dump_dir` when the run failed
+ * or its device wall exceeded `slow_step_ns` (0 disables the slow-step
+ * trigger). A NULL or empty `dump_dir` disables automatic snapshots.
+ *
+ * @return 0 on success, -1 on NULL ctx.
+ */
+int configure_flight_recorder(DeviceContextHandle ctx, int enable, uint64_t slow_step_ns, const char *dump_dir);
+
+/**
+ * Snapshot the flight-recorder rings to `path` as JSON (or into the
+ * configured dump directory when `path` is NULL / empty). Must not be called
+ * while a run is in flight on `ctx`.
+ *
+ * @return 0 on success, negative when nothing has been recorded yet, no
+ *         destination is known, or the write failed.
+ */
+int dump_flight_recorder(DeviceContextHandle ctx, const char *path);
+
 /**
  * Number of distinct callable_ids the AICPU has been asked to dlopen for on
  * the device bound to `ctx`. Returns 0 on runtime variants without per-cid
@@ -243,6 +294,15 @@ size_t get_aicpu_dlopen_count(DeviceContextHandle ctx);
  */
 size_t get_host_dlopen_count(DeviceContextHandle ctx);
 
+/**
+ * Nonzero when several device contexts on one device may run_prepared
+ * concurrently (ChipWorker run lanes). Sim loads a private copy of the AICPU
+ * executor per context. Onboard every context on a device dlopens the same
+ * installed inner AICPU SO, whose executor state is process-global, so
+ * concurrent runs would race inside it; onboard returns 0.
+ */
+int supports_run_lanes(void);
+
 #ifdef __cplusplus
 }
 #endif
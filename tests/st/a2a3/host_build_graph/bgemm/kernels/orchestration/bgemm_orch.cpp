@@ -144,6 +144,10 @@ int build_bgemm_graph(OrchestrationRuntime *runtime, const ChipStorageTaskArgs &
         }
     }
 
+    // The graph shape is fixed by the grid, so let the host levelize it into
+    // 2 * GRID_K waves (gemm, add, gemm, ...) instead of per-edge fanin tracking.
+    enable_wave_schedule(runtime);
+
     std::cout << "Created " << get_task_count(runtime) << " tasks\n";
     return 0;
 }
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Unit tests for the host_build_graph static wave schedule
+ * (host_build_graph/runtime/wave_plan.h).
+ *
+ * Every edge must go from an earlier wave to a later one, each wave must list
+ * its AIC lanes before its AIV lanes, and graphs that cannot be levelized
+ * must be rejected so the runtime keeps dynamic dispatch.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "host_build_graph/runtime/wave_plan.h"
+
+namespace {
+
+struct FakeTask {
+    int fanin = 0;
+    int fanout[8] = {};
+    int fanout_count = 0;
+    CoreType core_type = CoreType::AIV;
+};
+
+struct Graph {
+    std::vector<FakeTask> tasks;
+
+    int add(CoreType type) {
+        FakeTask t;
+        t.core_type = type;
+        tasks.push_back(t);
+        return static_cast<int>(tasks.size()) - 1;
+    }
+
+    void edge(int from, int to) {
+        tasks[from].fanout[tasks[from].fanout_count++] = to;
+        tasks[to].fanin++;
+    }
+};
+
+// Wave index of every task, or an empty vector if the plan is malformed.
+std::vector<int> wave_of(const std::vector<uint8_t> &storage, int task_count) {
+    WavePlanView view{};
+    if (!wave_plan_view(storage.data(), storage.size(), &view)) return {};
+    std::vector<int> wave(task_count, -1);
+    for (uint32_t w = 0; w < view.header->wave_count; w++) {
+        const WavePlanWave &wv = view.waves[w];
+        for (uint32_t k = 0; k < wv.aic_count + wv.aiv_count; k++) {
+            wave[view.task_ids[wv.begin + k]] = static_cast<int>(w);
+        }
+    }
+    return wave;
+}
+
+// bgemm's per-tile chain: gemm(k) -> add(k) -> gemm(k+1) -> ...
+Graph make_bgemm(int tiles, int grid_k) {
+    Graph g;
+    for (int t = 0; t < tiles; t++) {
+        int last_add = -1;
+        for (int k = 0; k < grid_k; k++) {
+            int gemm = g.add(CoreType::AIC);
+            int add = g.add(CoreType::AIV);
+            g.edge(gemm, add);
+            if (last_add >= 0) g.edge(last_add, gemm);
+            last_add = add;
+        }
+    }
+    return g;
+}
+
+}  // namespace
+
+TEST(HbgWavePlan, BgemmLevelizesIntoAlternatingWaves) {
+    Graph g = make_bgemm(16, 4);
+    std::vector<uint8_t> storage;
+    ASSERT_TRUE(wave_plan_build(g.tasks.data(), static_cast<int>(g.tasks.size()), &storage));
+
+    WavePlanView view{};
+    ASSERT_TRUE(wave_plan_view(storage.data(), storage.size(), &view));
+    EXPECT_EQ(view.header->wave_count, 8U);
+    EXPECT_EQ(view.header->task_count, 128U);
+    EXPECT_EQ(view.header->aic_task_count, 64U);
+    EXPECT_EQ(view.header->aiv_task_count, 64U);
+    for (uint32_t w = 0; w < view.header->wave_count; w++) {
+        EXPECT_EQ(view.waves[w].aic_count, (w % 2 == 0) ? 16U : 0U);
+        EXPECT_EQ(view.waves[w].aiv_count, (w % 2 == 0) ? 0U : 16U);
+    }
+    // The input table is untouched.
+    EXPECT_EQ(g.tasks[0].fanin, 0);
+    EXPECT_EQ(g.tasks[1].fanin, 1);
+}
+
+TEST(HbgWavePlan, EveryEdgeCrossesForward) {
+    // Diamond plus a long tail: waves come from the longest path, not the
+    // first predecessor seen.
+    Graph g;
+    int a = g.add(CoreType::AIC);
+    int b = g.add(CoreType::AIV);
+    int c = g.add(CoreType::AIC);
+    int d = g.add(CoreType::AIV);
+    int e = g.add(CoreType::AIV);
+    g.edge(a, b);
+    g.edge(a, c);
+    g.edge(b, d);
+    g.edge(c, e);
+    g.edge(d, e);
+    std::vector<uint8_t> storage;
+    ASSERT_TRUE(wave_plan_build(g.tasks.data(), static_cast<int>(g.tasks.size()), &storage));
+
+    std::vector<int> wave = wave_of(storage, static_cast<int>(g.tasks.size()));
+    ASSERT_EQ(wave.size(), g.tasks.size());
+    for (size_t t = 0; t < g.tasks.size(); t++) {
+        ASSERT_GE(wave[t], 0);
+        for (int j = 0; j < g.tasks[t].fanout_count; j++) {
+            EXPECT_LT(wave[t], wave[g.tasks[t].fanout[j]]);
+        }
+    }
+    EXPECT_EQ(wave[e], 3);
+}
+
+TEST(HbgWavePlan, AicLanesPrecedeAivLanesInIdOrder) {
+    Graph g;
+    g.add(CoreType::AIV);
+    g.add(CoreType::AIC);
+    g.add(CoreType::AIV);
+    g.add(CoreType::AIC);
+    std::vector<uint8_t> storage;
+    ASSERT_TRUE(wave_plan_build(g.tasks.data(), static_cast<int>(g.tasks.size()), &storage));
+
+    WavePlanView view{};
+    ASSERT_TRUE(wave_plan_view(storage.data(), storage.size(), &view));
+    ASSERT_EQ(view.header->wave_count, 1U);
+    EXPECT_EQ(view.waves[0].aic_count, 2U);
+    EXPECT_EQ(view.waves[0].aiv_count, 2U);
+    EXPECT_EQ(view.task_ids[0], 1);
+    EXPECT_EQ(view.task_ids[1], 3);
+    EXPECT_EQ(view.task_ids[2], 0);
+    EXPECT_EQ(view.task_ids[3], 2);
+}
+
+TEST(HbgWavePlan, CycleAndBadSuccessorFallBack) {
+    Graph cycle;
+    int a = cycle.add(CoreType::AIC);
+    int b = cycle.add(CoreType::AIV);
+    cycle.edge(a, b);
+    cycle.edge(b, a);
+    std::vector<uint8_t> storage(4, 0xff);
+    EXPECT_FALSE(wave_plan_build(cycle.tasks.data(), static_cast<int>(cycle.tasks.size()), &storage));
+    EXPECT_TRUE(storage.empty());
+
+    Graph bad;
+    int c = bad.add(CoreType::AIC);
+    bad.tasks[c].fanout[bad.tasks[c].fanout_count++] = 7;
+    EXPECT_FALSE(wave_plan_build(bad.tasks.data(), static_cast<int>(bad.tasks.size()), &storage));
+    EXPECT_FALSE(wave_plan_build(bad.tasks.data(), 0, &storage));
+}
+
+TEST(HbgWavePlan, ViewRejectsTruncatedStorage) {
+    Graph g = make_bgemm(2, 2);
+    std::vector<uint8_t> storage;
+    ASSERT_TRUE(wave_plan_build(g.tasks.data(), static_cast<int>(g.tasks.size()), &storage));
+    WavePlanView view{};
+    EXPECT_TRUE(wave_plan_view(storage.data(), storage.size(), &view));
+    EXPECT_FALSE(wave_plan_view(storage.data(), storage.size() - 1, &view));
+    EXPECT_FALSE(wave_plan_view(nullptr, storage.size(), &view));
+}
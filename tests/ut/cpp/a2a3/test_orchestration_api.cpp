@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Unit tests for the A2A3 orchestration API query wrappers
+ * (pto_orchestration_api.h) against a stand-in ops table.
+ */
+
+#include <gtest/gtest.h>
+
+#include "pto_orchestration_api.h"
+[[noreturn]] void assert_impl(const char *, const char *, int) { throw "assert_impl"; }
+
+namespace {
+
+PTO2Runtime *g_bound_runtime = nullptr;
+
+extern "C" PTO2Runtime *framework_current_runtime(void) { return g_bound_runtime; }
+
+void fake_core_counts(PTO2Runtime *, int32_t *aic_count, int32_t *aiv_count) {
+    *aic_count = 24;
+    *aiv_count = 48;
+}
+
+const PTO2RuntimeOps kOpsWithCounts = {.get_core_counts = fake_core_counts};
+const PTO2RuntimeOps kOpsWithoutCounts = {.get_core_counts = nullptr};
+
+struct BoundRuntime {
+    explicit BoundRuntime(const PTO2RuntimeOps *ops) {
+        rt.ops = ops;
+        g_bound_runtime = &rt;
+    }
+    ~BoundRuntime() { g_bound_runtime = nullptr; }
+    PTO2Runtime rt{};
+};
+
+}  // namespace
+
+TEST(A2A3OrchestrationApi, CoreCountsComeFromTheRuntimeOp) {
+    BoundRuntime bound(&kOpsWithCounts);
+    int32_t aic_count = -1;
+    int32_t aiv_count = -1;
+    rt_get_core_counts(&aic_count, &aiv_count);
+    EXPECT_EQ(aic_count, 24);
+    EXPECT_EQ(aiv_count, 48);
+}
+
+TEST(A2A3OrchestrationApi, CoreCountsReportZeroWithoutRuntimeOp) {
+    BoundRuntime bound(&kOpsWithoutCounts);
+    int32_t aic_count = -1;
+    int32_t aiv_count = -1;
+    rt_get_core_counts(&aic_count, &aiv_count);
+    EXPECT_EQ(aic_count, 0);
+    EXPECT_EQ(aiv_count, 0);
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Unit tests for multiplexed PMU aggregation (host/pmu_metrics.h) and the
+ * a2a3sim synthetic counter source (sim/aicpu/inner_platform_regs.cpp).
+ *
+ * Records sampled under different event groups must land in separate
+ * per-group sums, each derived metric must divide by its own group's cycles,
+ * and the columnar summary must round-trip.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "aicpu/platform_regs.h"
+#include "host/pmu_metrics.h"
+
+namespace {
+
+PmuRecord make_record(uint32_t func_id, CoreType core_type, PmuEventType type, uint64_t cycles) {
+    PmuRecord r{};
+    r.func_id = func_id;
+    r.core_type = core_type;
+    r.event_type = static_cast<uint32_t>(type);
+    r.pmu_total_cycles = cycles;
+    return r;
+}
+
+int slot_of(const PmuEventConfig &evt, const char *name) {
+    for (int i = 0; i < PMU_COUNTER_COUNT_A2A3; i++) {
+        if (std::strcmp(evt.counter_names[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+// The simulated register block is plain memory; read it the way read_reg does.
+uint64_t sim_reg(const std::vector<uint32_t> &block, RegId reg) { return block[reg_offset(reg) / sizeof(uint32_t)]; }
+
+double metric(const PmuKernelAggregate &agg, PmuMetric m) {
+    double out[PMU_METRIC_COUNT];
+    pmu_derive_metrics(agg, out);
+    return out[static_cast<int>(m)];
+}
+
+}  // namespace
+
+TEST(PmuMetrics, GroupsAreNormalizedByTheirOwnCycles) {
+    PmuKernelAggregator agg;
+
+    // PIPE_UTILIZATION sample: cube busy for half of 1000 cycles.
+    PmuRecord pipe = make_record(7, CoreType::AIC, PmuEventType::PIPE_UTILIZATION, 1000);
+    pipe.pmu_counters[slot_of(PMU_EVENTS_A2A3_PIPE_UTIL, "cube_busy_cycles")] = 500;
+    pipe.pmu_counters[slot_of(PMU_EVENTS_A2A3_PIPE_UTIL, "icache_req")] = 100;
+    pipe.pmu_counters[slot_of(PMU_EVENTS_A2A3_PIPE_UTIL, "icache_miss")] = 5;
+    agg.add(pipe);
+
+    // RESOURCE_CONFLICT samples on a different task with different cycles.
+    for (int i = 0; i < 2; i++) {
+        PmuRecord rc = make_record(7, CoreType::AIC, PmuEventType::RESOURCE_CONFLICT, 4000);
+        rc.pmu_counters[slot_of(PMU_EVENTS_A2A3_RESOURCE_CONFLICT, "bank_stall_cycles")] = 400;
+        agg.add(rc);
+    }
+
+    ASSERT_EQ(agg.size(), 1u);
+    const PmuKernelAggregate &k = *agg.kernels()[0];
+    EXPECT_EQ(k.tasks(), 3u);
+    EXPECT_EQ(k.cycles(), 9000u);
+    EXPECT_EQ(
+        k.group_mask(), (1u << static_cast<int>(PmuEventType::PIPE_UTILIZATION)) |
+                            (1u << static_cast<int>(PmuEventType::RESOURCE_CONFLICT))
+    );
+    EXPECT_DOUBLE_EQ(metric(k, PmuMetric::CUBE_UTIL), 0.5);
+    EXPECT_DOUBLE_EQ(metric(k, PmuMetric::ICACHE_MISS_RATE), 0.05);
+    EXPECT_DOUBLE_EQ(metric(k, PmuMetric::BANK_STALL_RATIO), 0.1);
+    EXPECT_TRUE(std::isnan(metric(k, PmuMetric::L2_HIT_RATE)));
+    EXPECT_TRUE(std::isnan(metric(k, PmuMetric::ARITHMETIC_INTENSITY)));
+}
+
+TEST(PmuMetrics, KernelsSplitByFuncIdAndCoreType) {
+    PmuKernelAggregator agg;
+    agg.add(make_record(1, CoreType::AIC, PmuEventType::PIPE_UTILIZATION, 100));
+    agg.add(make_record(1, CoreType::AIV, PmuEventType::PIPE_UTILIZATION, 100));
+    agg.add(make_record(2, CoreType::AIV, PmuEventType::MEMORY, 100));
+    agg.add(make_record(2, CoreType::AIV, PmuEventType::MEMORY, 100));
+
+    // Unknown groups carry counters of unknown meaning and are dropped.
+    agg.add(make_record(3, CoreType::AIV, static_cast<PmuEventType>(3), 100));
+    agg.add(make_record(3, CoreType::AIV, static_cast<PmuEventType>(0), 100));
+
+    std::vector<const PmuKernelAggregate *> rows = agg.kernels();
+    ASSERT_EQ(rows.size(), 3u);
+    EXPECT_EQ(rows[0]->func_id, 1u);
+    EXPECT_EQ(rows[0]->core_type, CoreType::AIC);
+    EXPECT_EQ(rows[1]->core_type, CoreType::AIV);
+    EXPECT_EQ(rows[2]->func_id, 2u);
+    EXPECT_EQ(rows[2]->tasks(), 2u);
+}
+
+TEST(PmuMetrics, RooflineNeedsArithmeticAndMemoryGroups) {
+    PmuKernelAggregator agg;
+
+    PmuRecord arith = make_record(4, CoreType::AIC, PmuEventType::ARITHMETIC_UTILIZATION, 1000);
+    arith.pmu_counters[slot_of(PMU_EVENTS_A2A3_ARITHMETIC, "cube_fp16_exec")] = 600;
+    arith.pmu_counters[slot_of(PMU_EVENTS_A2A3_ARITHMETIC, "vec_misc_exec")] = 200;
+    agg.add(arith);
+    EXPECT_DOUBLE_EQ(metric(*agg.kernels()[0], PmuMetric::OPS_PER_CYCLE), 0.8);
+    EXPECT_TRUE(std::isnan(metric(*agg.kernels()[0], PmuMetric::ARITHMETIC_INTENSITY)));
+
+    PmuRecord mem = make_record(4, CoreType::AIC, PmuEventType::MEMORY, 2000);
+    mem.pmu_counters[slot_of(PMU_EVENTS_A2A3_MEMORY, "main_read_req")] = 50;
+    mem.pmu_counters[slot_of(PMU_EVENTS_A2A3_MEMORY, "main_write_req")] = 50;
+    agg.add(mem);
+
+    const PmuKernelAggregate &k = *agg.kernels()[0];
+    double bytes_per_cycle = 100.0 * PMU_A2A3_MEM_REQ_BYTES / 2000.0;
+    EXPECT_DOUBLE_EQ(metric(k, PmuMetric::MAIN_MEM_BYTES_PER_CYCLE), bytes_per_cycle);
+    EXPECT_DOUBLE_EQ(metric(k, PmuMetric::ARITHMETIC_INTENSITY), 0.8 / bytes_per_cycle);
+}
+
+TEST(PmuMetrics, ColumnarSummaryRoundTrips) {
+    PmuKernelAggregator agg;
+    PmuRecord pipe = make_record(9, CoreType::AIV, PmuEventType::PIPE_UTILIZATION, 800);
+    pipe.pmu_counters[slot_of(PMU_EVENTS_A2A3_PIPE_UTIL, "vec_busy_cycles")] = 200;
+    agg.add(pipe);
+    agg.add(make_record(11, CoreType::AIC, PmuEventType::L2_CACHE, 300));
+
+    std::vector<uint8_t> bytes = agg.encode_columnar();
+    ASSERT_GE(bytes.size(), 16u);
+    uint32_t head[4];
+    std::memcpy(head, bytes.data(), sizeof(head));
+    EXPECT_EQ(head[0], PMU_SUMMARY_MAGIC);
+    EXPECT_EQ(head[1], PMU_SUMMARY_VERSION);
+    const uint32_t rows = head[2];
+    const uint32_t cols = head[3];
+    ASSERT_EQ(rows, 2u);
+    ASSERT_EQ(cols, 5u + PMU_METRIC_COUNT);
+
+    // Walk the column table, then the data blocks.
+    size_t off = sizeof(head);
+    std::vector<std::pair<std::string, PmuColumnType>> columns;
+    for (uint32_t c = 0; c < cols; c++) {
+        uint8_t type = bytes[off];
+        uint16_t len;
+        std::memcpy(&len, &bytes[off + 2], sizeof(len));
+        std::string name(reinterpret_cast<const char *>(&bytes[off + 4]), len);
+        columns.emplace_back(name, static_cast<PmuColumnType>(type));
+        off += 4 + len;
+    }
+    off = (off + 7) & ~static_cast<size_t>(7);
+
+    std::map<std::string, size_t> column_offset;
+    for (const auto &col : columns) {
+        column_offset[col.first] = off;
+        size_t width = col.second == PmuColumnType::U32 ? 4 : 8;
+        off = (off + rows * width + 7) & ~static_cast<size_t>(7);
+    }
+    EXPECT_EQ(off, bytes.size());
+
+    uint32_t func_ids[2];
+    std::memcpy(func_ids, &bytes[column_offset["func_id"]], sizeof(func_ids));
+    EXPECT_EQ(func_ids[0], 9u);
+    EXPECT_EQ(func_ids[1], 11u);
+
+    double vec_util[2];
+    std::memcpy(vec_util, &bytes[column_offset["vec_util"]], sizeof(vec_util));
+    EXPECT_DOUBLE_EQ(vec_util[0], 0.25);
+    EXPECT_TRUE(std::isnan(vec_util[1]));
+
+    uint64_t cycles[2];
+    std::memcpy(cycles, &bytes[column_offset["total_cycles"]], sizeof(cycles));
+    EXPECT_EQ(cycles[1], 300u);
+}
+
+TEST(PmuSimCounters, SyntheticCountersFollowCoreTypeAndAreDeterministic) {
+    std::vector<uint32_t> block(0x2000 / sizeof(uint32_t), 0);
+    uint64_t base = reinterpret_cast<uint64_t>(block.data());
+    const uint32_t *ids = PMU_EVENTS_A2A3_PIPE_UTIL.event_ids;
+    const int cube = slot_of(PMU_EVENTS_A2A3_PIPE_UTIL, "cube_busy_cycles");
+    const int vec = slot_of(PMU_EVENTS_A2A3_PIPE_UTIL, "vec_busy_cycles");
+
+    auto sample = [&](uint64_t task_id, uint32_t func_id, CoreType type) {
+        inner_pmu_synthesize_counters(base, ids, task_id, func_id, type);
+        PmuRecord r{};
+        for (int i = 0; i < PMU_COUNTER_COUNT_A2A3; i++) {
+            r.pmu_counters[i] = static_cast<uint32_t>(sim_reg(block, reg_index(RegId::PMU_CNT0, i)));
+        }
+        r.pmu_total_cycles = sim_reg(block, RegId::PMU_CNT_TOTAL0) | (sim_reg(block, RegId::PMU_CNT_TOTAL1) << 32);
+        return r;
+    };
+
+    PmuRecord aic = sample(1, 5, CoreType::AIC);
+    PmuRecord aiv = sample(1, 5, CoreType::AIV);
+    EXPECT_GT(aic.pmu_total_cycles, 0u);
+    EXPECT_GT(aic.pmu_counters[cube], 0u);
+    EXPECT_LT(aic.pmu_counters[cube], aic.pmu_total_cycles);
+    EXPECT_EQ(aic.pmu_counters[vec], 0u);
+    EXPECT_EQ(aiv.pmu_counters[cube], 0u);
+    EXPECT_GT(aiv.pmu_counters[vec], 0u);
+
+    PmuRecord again = sample(1, 5, CoreType::AIC);
+    EXPECT_EQ(std::memcmp(again.pmu_counters, aic.pmu_counters, sizeof(aic.pmu_counters)), 0);
+    EXPECT_EQ(again.pmu_total_cycles, aic.pmu_total_cycles);
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Unit tests for the split-KV work partitioner (pto_split_kv.h).
+ *
+ * Covers block counting, split sizing against the core count, and that the
+ * per-split ranges tile each row exactly with near-equal lengths.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "pto_split_kv.h"
+
+namespace {
+
+struct PlanStats {
+    uint32_t items = 0;
+    uint32_t max_split_blocks = 0;
+};
+
+// Walk a plan the way an orchestration would and check every row is tiled
+// by its splits in order, with no gap, overlap, or empty split.
+PlanStats walk_plan(const std::vector<int32_t> &context_lens, uint64_t block_size, uint32_t blocks_per_split) {
+    PlanStats stats;
+    for (int32_t len : context_lens) {
+        uint32_t row_blocks = pto2_split_kv_row_blocks(len, block_size);
+        uint32_t num_splits = pto2_split_kv_num_splits(row_blocks, blocks_per_split);
+        uint32_t next = 0;
+        for (uint32_t s = 0; s < num_splits; s++) {
+            PTO2SplitKvRange r = pto2_split_kv_range(row_blocks, num_splits, s);
+            EXPECT_EQ(r.block_begin, next);
+            EXPECT_LT(r.block_begin, r.block_end);
+            uint32_t len_blocks = r.block_end - r.block_begin;
+            EXPECT_LE(len_blocks, blocks_per_split);
+            if (len_blocks > stats.max_split_blocks) stats.max_split_blocks = len_blocks;
+            next = r.block_end;
+            stats.items++;
+        }
+        EXPECT_EQ(next, row_blocks);
+    }
+    return stats;
+}
+
+uint64_t total_blocks(const std::vector<int32_t> &context_lens, uint64_t block_size) {
+    uint64_t total = 0;
+    for (int32_t len : context_lens) total += pto2_split_kv_row_blocks(len, block_size);
+    return total;
+}
+
+}  // namespace
+
+TEST(SplitKv, RowBlocksRoundsUpAndIgnoresEmptyRows) {
+    EXPECT_EQ(pto2_split_kv_row_blocks(0, 16), 0U);
+    EXPECT_EQ(pto2_split_kv_row_blocks(-1, 16), 0U);
+    EXPECT_EQ(pto2_split_kv_row_blocks(1, 16), 1U);
+    EXPECT_EQ(pto2_split_kv_row_blocks(16, 16), 1U);
+    EXPECT_EQ(pto2_split_kv_row_blocks(33, 16), 3U);
+    EXPECT_EQ(pto2_split_kv_num_splits(0, 4), 0U);
+}
+
+TEST(SplitKv, NoCoreCountKeepsOneSplitPerRow) {
+    std::vector<int32_t> lens = {33, 17, 128, 15};
+    uint32_t bps = pto2_split_kv_blocks_per_split(total_blocks(lens, 16), 0, 4);
+    PlanStats stats = walk_plan(lens, 16, bps);
+    EXPECT_EQ(stats.items, lens.size());
+}
+
+TEST(SplitKv, LargeBatchDoesNotSplit) {
+    std::vector<int32_t> lens(256, 8192);
+    uint32_t bps = pto2_split_kv_blocks_per_split(total_blocks(lens, 128), 24, 4);
+    PlanStats stats = walk_plan(lens, 128, bps);
+    EXPECT_EQ(stats.items, 256U);
+}
+
+TEST(SplitKv, SingleLongRowFansOutToCores) {
+    std::vector<int32_t> lens = {8192};
+    uint32_t bps = pto2_split_kv_blocks_per_split(total_blocks(lens, 64), 24, 1);
+    PlanStats stats = walk_plan(lens, 64, bps);
+    EXPECT_GT(stats.items, 1U);
+    EXPECT_LE(stats.items, 24U);
+    EXPECT_EQ(stats.max_split_blocks, bps);
+}
+
+TEST(SplitKv, MinBlocksPerSplitBoundsSplitCount) {
+    std::vector<int32_t> lens = {128};  // 8 blocks of 16
+    uint32_t bps = pto2_split_kv_blocks_per_split(total_blocks(lens, 16), 24, 4);
+    EXPECT_EQ(bps, 4U);
+    PlanStats stats = walk_plan(lens, 16, bps);
+    EXPECT_EQ(stats.items, 2U);
+}
+
+TEST(SplitKv, RaggedBatchSplitsLongRowsOnly) {
+    std::vector<int32_t> lens = {4096, 64, 64, 64};  // 256 + 3 x 4 blocks of 16
+    uint32_t bps = pto2_split_kv_blocks_per_split(total_blocks(lens, 16), 16, 1);
+    PlanStats stats = walk_plan(lens, 16, bps);
+    EXPECT_EQ(pto2_split_kv_num_splits(pto2_split_kv_row_blocks(64, 16), bps), 1U);
+    EXPECT_GT(pto2_split_kv_num_splits(pto2_split_kv_row_blocks(4096, 16), bps), 1U);
+    EXPECT_LE(stats.items, 16U + static_cast<uint32_t>(lens.size()));
+}
+
+TEST(SplitKv, RangesAreNearEqual) {
+    for (uint32_t row_blocks = 1; row_blocks <= 64; row_blocks++) {
+        for (uint32_t num_splits = 1; num_splits <= row_blocks; num_splits++) {
+            uint32_t lo = UINT32_MAX;
+            uint32_t hi = 0;
+            uint32_t next = 0;
+            for (uint32_t s = 0; s < num_splits; s++) {
+                PTO2SplitKvRange r = pto2_split_kv_range(row_blocks, num_splits, s);
+                ASSERT_EQ(r.block_begin, next);
+                uint32_t n = r.block_end - r.block_begin;
+                lo = n < lo ? n : lo;
+                hi = n > hi ? n : hi;
+                next = r.block_end;
+            }
+            ASSERT_EQ(next, row_blocks);
+            ASSERT_LE(hi - lo, 1U);
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Unit tests for Tensor::reoffset and the orchestration view cache
+ * (pto_view_cache.h).
+ *
+ * Every cached view must match what Tensor::view() would have built, and a
+ * parent that differs in any identity field (buffer, owner task, origin,
+ * strides) must miss.
+ */
+
+#include <gtest/gtest.h>
+
+#include "pto_view_cache.h"
+
+namespace {
+
+void expect_same_view(const Tensor &a, const Tensor &b) {
+    EXPECT_EQ(a.buffer.addr, b.buffer.addr);
+    EXPECT_EQ(a.buffer.size, b.buffer.size);
+    EXPECT_EQ(a.owner_task_id, b.owner_task_id);
+    EXPECT_EQ(a.start_offset, b.start_offset);
+    EXPECT_EQ(a.version, b.version);
+    EXPECT_EQ(a.ndims, b.ndims);
+    EXPECT_EQ(a.dtype, b.dtype);
+    EXPECT_EQ(a.manual_dep, b.manual_dep);
+    EXPECT_EQ(a.is_contiguous, b.is_contiguous);
+    EXPECT_EQ(a.child_memory, b.child_memory);
+    EXPECT_EQ(a.extent_elem(), b.extent_elem());
+    for (uint32_t i = 0; i < a.ndims; i++) {
+        EXPECT_EQ(a.shapes[i], b.shapes[i]);
+        EXPECT_EQ(a.strides[i], b.strides[i]);
+    }
+}
+
+alignas(64) uint8_t g_buf[1 << 16];
+
+Tensor make_parent(uint32_t rows, uint32_t cols, int32_t version = 0) {
+    uint32_t shapes[2] = {rows, cols};
+    return make_tensor_external(g_buf, shapes, 2, DataType::FLOAT32, false, version);
+}
+
+}  // namespace
+
+TEST(TensorReoffset, PatchesOnlyOriginAndVersion) {
+    Tensor parent = make_parent(64, 32);
+    uint32_t shapes[2] = {16, 32};
+    uint32_t off_a[2] = {0, 0};
+    uint32_t off_b[2] = {32, 0};
+    Tensor a = parent.view(shapes, off_a);
+    Tensor b = parent.view(shapes, off_b);
+    a.reoffset(b.start_offset, b.version);
+    expect_same_view(a, b);
+
+    a.reoffset(0, 7);
+    EXPECT_EQ(a.version, 7);
+    EXPECT_EQ(a.start_offset, 0U);
+}
+
+TEST(ViewCache, MatchesTensorViewAcrossOffsets) {
+    Tensor parent = make_parent(64, 32);
+    PTO2ViewCache<> cache;
+    uint32_t shapes[2] = {8, 16};
+    for (uint32_t r = 0; r + 8 <= 64; r += 8) {
+        for (uint32_t c = 0; c + 16 <= 32; c += 16) {
+            uint32_t offsets[2] = {r, c};
+            expect_same_view(cache.view(parent, shapes, offsets), parent.view(shapes, offsets));
+        }
+    }
+    EXPECT_EQ(cache.misses(), 1U);
+    EXPECT_EQ(cache.hits(), 15U);
+}
+
+TEST(ViewCache, NonContiguousParentKeepsDerivedFields) {
+    Tensor parent = make_parent(64, 32).transpose(0, 1);
+    PTO2ViewCache<> cache;
+    uint32_t shapes[2] = {4, 8};
+    for (uint32_t r = 0; r < 4; r++) {
+        uint32_t offsets[2] = {r * 4, r * 8};
+        expect_same_view(cache.view(parent, shapes, offsets), parent.view(shapes, offsets));
+    }
+    EXPECT_EQ(cache.misses(), 1U);
+}
+
+TEST(ViewCache, DistinctParentIdentityMisses) {
+    Tensor parent = make_parent(64, 32);
+    PTO2ViewCache<> cache;
+    uint32_t shapes[2] = {8, 32};
+    uint32_t offsets[2] = {8, 0};
+    cache.view(parent, shapes, offsets);
+
+    Tensor reused = parent;  // same address, produced by another task
+    reused.owner_task_id = PTO2TaskId::make(0, 5);
+    expect_same_view(cache.view(reused, shapes, offsets), reused.view(shapes, offsets));
+
+    uint32_t sub_shapes[2] = {32, 32};
+    uint32_t sub_offsets[2] = {16, 0};
+    Tensor shifted = parent.view(sub_shapes, sub_offsets);  // same buffer, different origin
+    expect_same_view(cache.view(shifted, shapes, offsets), shifted.view(shapes, offsets));
+
+    uint32_t other_shapes[2] = {16, 32};
+    expect_same_view(cache.view(parent, other_shapes, offsets), parent.view(other_shapes, offsets));
+    EXPECT_EQ(cache.misses(), 4U);
+    EXPECT_EQ(cache.hits(), 0U);
+}
+
+TEST(ViewCache, ReferenceSurvivesOtherKeys) {
+    Tensor query = make_parent(64, 32);
+    uint32_t kv_shapes_parent[2] = {32, 32};
+    uint32_t kv_origin[2] = {32, 0};
+    Tensor kv = query.view(kv_shapes_parent, kv_origin);  // second parent: same buffer, other origin
+    PTO2ViewCache<> cache;
+    uint32_t tile[2] = {8, 32};
+    uint32_t q_off[2] = {8, 0};
+    const Tensor &qi = cache.view(query, tile, q_off);
+    const uint64_t qi_start = qi.start_offset;
+    for (uint32_t r = 0; r < 32; r += 8) {
+        uint32_t off[2] = {r, 0};
+        expect_same_view(cache.view(kv, tile, off), kv.view(tile, off));
+    }
+    EXPECT_EQ(qi.start_offset, qi_start);
+    expect_same_view(qi, query.view(tile, q_off));
+}
+
+TEST(ViewCache, VersionFollowsParent) {
+    PTO2ViewCache<> cache;
+    uint32_t shapes[2] = {8, 32};
+    uint32_t offsets[2] = {0, 0};
+    cache.view(make_parent(64, 32, 1), shapes, offsets);
+    Tensor v = cache.view(make_parent(64, 32, 2), shapes, offsets);
+    EXPECT_EQ(cache.hits(), 1U);
+    EXPECT_EQ(v.version, 2);
+}
+
+TEST(ViewCache, RoundRobinEvictionStaysCorrect) {
+    Tensor parent = make_parent(64, 32);
+    PTO2ViewCache<2> cache;
+    uint32_t offsets[2] = {0, 0};
+    for (int round = 0; round < 3; round++) {
+        for (uint32_t rows = 1; rows <= 3; rows++) {
+            uint32_t shapes[2] = {rows, 32};
+            expect_same_view(cache.view(parent, shapes, offsets), parent.view(shapes, offsets));
+        }
+    }
+    EXPECT_EQ(cache.hits(), 0U);  // three shapes cycling through two entries always evict
+    cache.clear();
+    EXPECT_EQ(cache.misses(), 0U);
+}
@@ -107,6 +107,7 @@ const PTO2RuntimeOps kFakeOps = {
     .alloc_tensors = fake_alloc_tensors,
     .submit_dummy_task = fake_submit_dummy,
     .scope_set_site = nullptr,
+    .get_core_counts = nullptr,
 };
 
 class RuntimeBindingGuard {
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Dirty-range mirroring vs bulk mirroring of the a5 PMU shm (sim memcpy
+ * transport). Two identical "devices" run the same AICPU-side operation
+ * sequence; one host manager refreshes through the dirty summary, the other
+ * through the bulk mirror. Both must pop the same entries and hold the same
+ * view of every field the mgmt tick reads, while the dirty path moves far
+ * fewer shm bytes.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "host/pmu_collector.h"
+
+namespace {
+
+using Manager = profiling_common::BufferPoolManager<PmuModule>;
+using Alg = profiling_common::ProfilerAlgorithms<PmuModule>;
+
+constexpr int kNumCores = 6;
+constexpr int kNumThreads = 3;
+
+struct PoppedEntry {
+    uint32_t core_index;
+    uint32_t buffer_seq;
+    bool operator==(const PoppedEntry &o) const { return core_index == o.core_index && buffer_seq == o.buffer_seq; }
+};
+
+// One simulated device + its host shadow + the manager mirroring it.
+struct World {
+    size_t shm_size = 0;
+    void *dev = nullptr;
+    void *host = nullptr;
+    size_t shm_bytes_pulled = 0;
+    std::vector<PoppedEntry> popped;
+    Manager mgr;
+
+    explicit World(bool full_mirror) {
+        shm_size = calc_pmu_data_size(kNumCores);
+        dev = std::aligned_alloc(64, shm_size);
+        host = std::aligned_alloc(64, shm_size);
+        std::memset(dev, 0, shm_size);
+        get_pmu_header(dev)->num_cores = kNumCores;
+        std::memcpy(host, dev, shm_size);
+
+        profiling_common::MemoryOps ops;
+        ops.alloc = [](size_t size) {
+            return std::calloc(1, size);
+        };
+        ops.reg = [this](void *dev_ptr, size_t size, int, void **host_out) {
+            *host_out = std::malloc(size);
+            std::memcpy(*host_out, dev_ptr, size);
+            mgr.add_malloc_shadow(*host_out);
+            return 0;
+        };
+        ops.free_ = [](void *p) {
+            std::free(p);
+            return 0;
+        };
+        ops.copy_to_device = [](void *dst, const void *src, size_t size) {
+            std::memcpy(dst, src, size);
+            return 0;
+        };
+        ops.copy_from_device = [this](void *dst, const void *src, size_t size) {
+            const char *d = static_cast<const char *>(dst);
+            const char *h = static_cast<const char *>(host);
+            if (d >= h && d < h + shm_size) shm_bytes_pulled += size;
+            std::memcpy(dst, src, size);
+            return 0;
+        };
+        mgr.set_memory_context(std::move(ops), dev, host, shm_size, 0);
+        mgr.set_full_mirror(full_mirror);
+
+        // Host init: fill every free_queue before AICPU starts.
+        Alg::proactive_replenish(mgr, get_pmu_header(host));
+        shm_bytes_pulled = 0;
+    }
+
+    ~World() {
+        mgr.release_all_owned([](void *p) {
+            std::free(p);
+        });
+        std::free(dev);
+        std::free(host);
+    }
+
+    // --- AICPU side (mirrors pmu_collector_aicpu.cpp) -----------------------
+
+    void device_init(bool publish) {
+        PmuDataHeader *header = get_pmu_header(dev);
+        for (int c = 0; c < kNumCores; c++) {
+            PmuBufferState *state = get_pmu_buffer_state(dev, c);
+            uint32_t head = state->free_queue.head;
+            if (head != state->free_queue.tail) {
+                state->current_buf_ptr = state->free_queue.buffer_ptrs[head % PLATFORM_PMU_SLOT_COUNT];
+                state->free_queue.head = head + 1;
+                state->current_buf_seq = 0;
+            }
+            prof_dirty_mark(&header->dirty, PMU_DIRTY_CORE_SLOT_BASE + c);
+        }
+        if (publish) prof_dirty_publish(&header->dirty);
+    }
+
+    // Buffer-full switch for one core: enqueue current, pop next.
+    void device_switch(int core, int q) {
+        PmuDataHeader *header = get_pmu_header(dev);
+        PmuBufferState *state = get_pmu_buffer_state(dev, core);
+        state->total_record_count += PLATFORM_PMU_RECORDS_PER_BUFFER;  // untracked by the summary
+        uint32_t head = state->free_queue.head;
+        if (state->current_buf_ptr == 0 || head == state->free_queue.tail) return;
+
+        uint32_t tail = header->queue_tails[q];
+        uint32_t next_tail = (tail + 1) % PLATFORM_PMU_READYQUEUE_SIZE;
+        if (next_tail == header->queue_heads[q]) return;
+        header->queues[q][tail].core_index = static_cast<uint32_t>(core);
+        header->queues[q][tail].buffer_ptr = state->current_buf_ptr;
+        header->queues[q][tail].buffer_seq = state->current_buf_seq;
+        header->queue_tails[q] = next_tail;
+        prof_dirty_mark(&header->dirty, PMU_DIRTY_QUEUE_SLOT_BASE + q);
+
+        state->current_buf_ptr = state->free_queue.buffer_ptrs[head % PLATFORM_PMU_SLOT_COUNT];
+        state->free_queue.head = head + 1;
+        state->current_buf_seq += 1;
+        prof_dirty_mark(&header->dirty, PMU_DIRTY_CORE_SLOT_BASE + core);
+    }
+
+    // --- Host side (mirrors ProfilerBase::mgmt_loop + collector) ------------
+
+    void host_tick() {
+        mgr.refresh_shm_from_device();
+        PmuDataHeader *header = get_pmu_header(host);
+        mgr.drain_done_into_recycled();
+        for (int q = 0; q < PLATFORM_MAX_AICPU_THREADS; q++) {
+            PmuReadyQueueEntry entry;
+            while (Alg::try_pop_aicpu_entry(mgr, header, q, entry)) {
+                popped.push_back({entry.core_index, entry.buffer_seq});
+                Alg::process_entry(mgr, header, q, entry);
+            }
+        }
+        PmuReadyBufferInfo info;
+        while (mgr.try_pop_ready(info)) {
+            mgr.notify_copy_done(info.dev_buffer_ptr, 0);
+        }
+        Alg::proactive_replenish(mgr, header);
+    }
+};
+
+// Fields the mgmt tick reads, compared between two shm images.
+void expect_same_tick_view(void *a, void *b) {
+    PmuDataHeader *ha = get_pmu_header(a);
+    PmuDataHeader *hb = get_pmu_header(b);
+    for (int q = 0; q < PLATFORM_MAX_AICPU_THREADS; q++) {
+        EXPECT_EQ(ha->queue_tails[q], hb->queue_tails[q]) << "q=" << q;
+        EXPECT_EQ(ha->queue_heads[q], hb->queue_heads[q]) << "q=" << q;
+    }
+    for (int c = 0; c < kNumCores; c++) {
+        PmuBufferState *sa = get_pmu_buffer_state(a, c);
+        PmuBufferState *sb = get_pmu_buffer_state(b, c);
+        EXPECT_EQ(sa->free_queue.head, sb->free_queue.head) << "core=" << c;
+        EXPECT_EQ(sa->free_queue.tail, sb->free_queue.tail) << "core=" << c;
+        EXPECT_EQ(sa->current_buf_seq, sb->current_buf_seq) << "core=" << c;
+    }
+}
+
+}  // namespace
+
+TEST(PmuDirtyMirror, MatchesBulkMirrorUnderRandomTraffic) {
+    auto bulk = std::make_unique<World>(/*full_mirror=*/true);
+    auto dirty = std::make_unique<World>(/*full_mirror=*/false);
+    bulk->device_init(true);
+    dirty->device_init(true);
+
+    std::mt19937 rng(20260417);
+    for (int tick = 0; tick < 200; tick++) {
+        const int ops = static_cast<int>(rng() % 5);
+        for (int i = 0; i < ops; i++) {
+            const int core = static_cast<int>(rng() % kNumCores);
+            bulk->device_switch(core, core % kNumThreads);
+            dirty->device_switch(core, core % kNumThreads);
+        }
+        bulk->host_tick();
+        dirty->host_tick();
+
+        ASSERT_EQ(bulk->popped, dirty->popped) << "tick=" << tick;
+        expect_same_tick_view(bulk->host, dirty->host);
+        // The dirty shadow agrees with its own device on every tracked field.
+        expect_same_tick_view(dirty->host, dirty->dev);
+    }
+
+    EXPECT_GT(dirty->popped.size(), 100u);
+    EXPECT_EQ(bulk->shm_bytes_pulled, 200 * bulk->shm_size + bulk->popped.size() * sizeof(PmuReadyQueueEntry));
+    EXPECT_LT(dirty->shm_bytes_pulled * 10, bulk->shm_bytes_pulled);
+}
+
+TEST(PmuDirtyMirror, IdleTickPullsOnlyTheSummary) {
+    World w(/*full_mirror=*/false);
+    w.device_init(true);
+    w.host_tick();
+    w.shm_bytes_pulled = 0;
+
+    w.host_tick();
+    EXPECT_EQ(w.shm_bytes_pulled, sizeof(PmuDirtySummary));
+}
+
+TEST(PmuDirtyMirror, UnpublishedSummaryFallsBackToBulk) {
+    World w(/*full_mirror=*/false);
+    w.device_init(/*publish=*/false);
+
+    w.host_tick();
+    EXPECT_EQ(w.shm_bytes_pulled, sizeof(PmuDirtySummary) + w.shm_size);
+    for (int c = 0; c < kNumCores; c++) {
+        EXPECT_EQ(get_pmu_buffer_state(w.host, c)->current_buf_ptr, get_pmu_buffer_state(w.dev, c)->current_buf_ptr);
+    }
+
+    // Once the device publishes, the generations latched during the bulk
+    // pull keep already-mirrored ranges from being fetched again.
+    prof_dirty_publish(&get_pmu_header(w.dev)->dirty);
+    w.shm_bytes_pulled = 0;
+    w.host_tick();
+    EXPECT_EQ(w.shm_bytes_pulled, sizeof(PmuDirtySummary));
+
+    w.device_switch(2, 1);
+    w.shm_bytes_pulled = 0;
+    w.host_tick();
+    ASSERT_EQ(w.popped.size(), 1u);
+    EXPECT_EQ(w.popped[0].core_index, 2u);
+    expect_same_tick_view(w.host, w.dev);
+}
+
+TEST(PmuDirtyMirror, EnvForcesFullMirror) {
+    ::setenv("SIMPLER_PROF_FULL_MIRROR", "1", 1);
+    {
+        Manager probe;
+        probe.set_memory_context({}, nullptr, nullptr, 0, 0);
+        EXPECT_TRUE(probe.full_mirror());
+    }
+    ::setenv("SIMPLER_PROF_FULL_MIRROR", "0", 1);
+    {
+        Manager probe;
+        probe.set_memory_context({}, nullptr, nullptr, 0, 0);
+        EXPECT_FALSE(probe.full_mirror());
+    }
+    ::unsetenv("SIMPLER_PROF_FULL_MIRROR");
+}
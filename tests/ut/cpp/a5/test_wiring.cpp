@@ -401,9 +401,9 @@ TEST_F(WiringTest, DrainWiringQueueProcessesTasks) {
     task_slot.task = &desc;
 
     // Push into wiring SPSC queue (orchestrator side)
-    ASSERT_TRUE(sched.wiring.queue.push(&task_slot));
+    ASSERT_TRUE(sched.wiring.shards[0].queue.push(&task_slot));
 
-    // Drain (scheduler thread 0 side)
+    // Drain (shard-owner side)
     int wired = sched.drain_wiring_queue(true /* force_drain */);
     EXPECT_EQ(wired, 1);
 
@@ -424,13 +424,13 @@ TEST_F(WiringTest, DrainWiringQueueBackoffDefers) {
     task_slot.payload = &payload;
     task_slot.task = &desc;
 
-    sched.wiring.queue.push(&task_slot);
+    sched.wiring.shards[0].queue.push(&task_slot);
 
     // Without force_drain, single item < BATCH_SIZE → backoff
-    sched.wiring.backoff_counter = 0;
+    sched.wiring.shards[0].backoff_counter = 0;
     int wired = sched.drain_wiring_queue(false);
     EXPECT_EQ(wired, 0) << "Backoff should defer when queue < BATCH_SIZE";
-    EXPECT_EQ(sched.wiring.backoff_counter, 1);
+    EXPECT_EQ(sched.wiring.shards[0].backoff_counter, 1);
 }
 
 TEST_F(WiringTest, DrainWiringQueueBackoffLimitForcesProcess) {
@@ -444,10 +444,92 @@ TEST_F(WiringTest, DrainWiringQueueBackoffLimitForcesProcess) {
     task_slot.payload = &payload;
     task_slot.task = &desc;
 
-    sched.wiring.queue.push(&task_slot);
+    sched.wiring.shards[0].queue.push(&task_slot);
 
     // Set backoff at limit → should process
-    sched.wiring.backoff_counter = PTO2SchedulerState::WiringState::BACKOFF_LIMIT;
+    sched.wiring.shards[0].backoff_counter = PTO2SchedulerState::WiringShard::BACKOFF_LIMIT;
     int wired = sched.drain_wiring_queue(false);
     EXPECT_EQ(wired, 1) << "Backoff limit reached should force processing";
 }
+
+// =============================================================================
+// drain_wiring_queue: per-ring shards, one owning thread each
+// =============================================================================
+
+TEST_F(WiringTest, DrainWiringQueueOnlyDrainsOwnedShards) {
+    alignas(64) PTO2TaskSlotState slots[PTO2_MAX_RING_DEPTH];
+    alignas(64) PTO2TaskPayload payloads[PTO2_MAX_RING_DEPTH];
+    PTO2TaskDescriptor desc{};
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        init_slot(slots[r], PTO2_TASK_PENDING, 0, 1, static_cast<uint8_t>(r));
+        memset(&payloads[r], 0, sizeof(payloads[r]));
+        slots[r].payload = &payloads[r];
+        slots[r].task = &desc;
+        ASSERT_TRUE(sched.wiring.shards[r].queue.push(&slots[r]));
+    }
+
+    // Two wiring threads: thread 0 owns rings {0, 2}, thread 1 owns {1, 3}.
+    sched.wiring.thread_count = 2;
+    EXPECT_EQ(sched.drain_wiring_queue(true, /*thread_idx=*/2), 0) << "thread past thread_count owns no shard";
+    EXPECT_EQ(sched.drain_wiring_queue(true, /*thread_idx=*/1), PTO2_MAX_RING_DEPTH / 2);
+    EXPECT_EQ(sched.wiring.shards[0].queue.size(), 1u);
+    EXPECT_EQ(sched.wiring.shards[1].queue.size(), 0u);
+    EXPECT_EQ(sched.drain_wiring_queue(true, /*thread_idx=*/0), PTO2_MAX_RING_DEPTH / 2);
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        EXPECT_EQ(sched.wiring.shards[r].queue.size(), 0u) << "ring " << r;
+        EXPECT_EQ(slots[r].fanin_count, 1) << "ring " << r;
+    }
+}
+
+TEST_F(WiringTest, ShardsWireConcurrentlyOnSharedProducer) {
+    // Consumers on rings 0 and 1 all depend on one pending producer. Two
+    // threads drain their own shard at once: the producer's fanout list is
+    // shared (fanout_lock), each ring's dep_pool has a single writer.
+    constexpr int kPerRing = 200;
+    alignas(64) PTO2TaskSlotState producer;
+    init_slot(producer, PTO2_TASK_PENDING, 1, 2 * kPerRing);
+
+    std::vector<PTO2TaskSlotState> consumers(2 * kPerRing);
+    std::vector<PTO2TaskPayload> payloads(2 * kPerRing);
+    PTO2TaskDescriptor desc{};
+    for (int i = 0; i < 2 * kPerRing; i++) {
+        uint8_t ring = static_cast<uint8_t>(i % 2);
+        init_slot(consumers[i], PTO2_TASK_PENDING, 0, 1, ring);
+        memset(&payloads[i], 0, sizeof(payloads[i]));
+        payloads[i].fanin_actual_count = 1;
+        payloads[i].fanin_inline_slot_states[0] = &producer;
+        consumers[i].payload = &payloads[i];
+        consumers[i].task = &desc;
+        ASSERT_TRUE(sched.wiring.shards[ring].queue.push(&consumers[i]));
+    }
+
+    int32_t used_before[2] = {
+        sched.ring_sched_states[0].dep_pool.used(), sched.ring_sched_states[1].dep_pool.used()
+    };
+    sched.wiring.thread_count = 2;
+    std::atomic<int> wired[2] = {{0}, {0}};
+    auto drain = [&](int thread_idx) {
+        while (wired[thread_idx].load() < kPerRing) {
+            wired[thread_idx].fetch_add(sched.drain_wiring_queue(true, thread_idx));
+        }
+    };
+    std::thread t0(drain, 0);
+    std::thread t1(drain, 1);
+    t0.join();
+    t1.join();
+
+    EXPECT_EQ(wired[0].load(), kPerRing);
+    EXPECT_EQ(wired[1].load(), kPerRing);
+    EXPECT_EQ(sched.ring_sched_states[0].dep_pool.used() - used_before[0], kPerRing);
+    EXPECT_EQ(sched.ring_sched_states[1].dep_pool.used() - used_before[1], kPerRing);
+
+    int listed = 0;
+    for (PTO2DepListEntry *e = producer.fanout_head; e != nullptr; e = e->next) {
+        listed++;
+    }
+    EXPECT_EQ(listed, 2 * kPerRing);
+    for (const auto &c : consumers) {
+        EXPECT_EQ(c.fanin_count, 2);
+        EXPECT_EQ(c.fanin_refcount.load(), 1);
+    }
+}
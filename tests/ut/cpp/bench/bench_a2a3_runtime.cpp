@@ -0,0 +1,763 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Microbenchmarks for the a2a3 tensormap_and_ringbuffer runtime hot structures.
+ *
+ * The correctness side lives in tests/ut/cpp/a2a3 (test_ready_queue,
+ * test_spsc_queue, test_tensormap, test_task_allocator, test_wiring); the
+ * fixtures here are built the same way, against the same a2a3_rt_objs.
+ *
+ * Cases (item = unit that ns/item is reported for):
+ *
+ *   ready_queue/push_pop/threads:T        one push + pop on a shared MPMC queue
+ *   ready_queue/batch16/threads:T         one slot through push_batch/pop_batch(16)
+ *   spsc_queue/same_thread                one push + pop, single thread
+ *   spsc_queue/cross_thread               one item producer -> consumer thread
+ *   tensormap/lookup/chain:C/overlap:O    one lookup against C same-buffer producers;
+ *                                         O = none (all disjoint), covered, partial
+ *   tensormap/insert_retire/entries:K     one insert, retired in batches of K per task
+ *   task_allocator/alloc_retire/bytes:B/inflight:N
+ *                                         one alloc, retired N at a time
+ *   wiring/fanin:K                        one edge: wire_task with K pending producers,
+ *                                         then on_subtask_complete + on_task_complete each
+ *   wiring/fanout:K                       one edge: K consumers wired on one producer,
+ *                                         then one completion releasing all of them
+ *   flight_recorder/task_path/recorder:R  one task through wire_task + completion + ready pop, plus the
+ *                                         DISPATCH and FIN records the scheduler writes for it;
+ *                                         R = none (probes compiled out), off (null region), on
+ *   tensor_view/direct                    one 2-D Tensor::view() at a moving origin
+ *   tensor_view/cached                    the same view through PTO2ViewCache (in-place reoffset)
+ *   hbg_dispatch/dynamic/threads:T        one host_build_graph task through the AICPU bookkeeping
+ *                                         of dynamic dispatch: shared ready queue pop, fanout walk
+ *                                         with a fanin fetch_sub per edge, push of released tasks
+ *   hbg_dispatch/wave/threads:T           the same task through the static wave plan: plan entry
+ *                                         read for an owned lane, one barrier per wave
+ *
+ * The hbg_dispatch cases run a bgemm-shaped graph (64 tiles x 8 K steps) with
+ * the AICore side reduced to nothing, so ns/item is the scheduler's own cost
+ * per task; on hardware the register round-trip comes on top for both modes.
+ *
+ * Run: bench_a2a3_runtime [--filter S] [--json PATH] [--quick]; see micro_bench.h.
+ * Thread counts above std::thread::hardware_concurrency() are not registered:
+ * the queues spin inside push/pop, so an oversubscribed run measures the OS
+ * time slice, not the queue (and can take minutes on a 1-CPU runner).
+ * ctest runs it once with --quick as a smoke test so the target does not rot.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "aicpu/flight_recorder_aicpu.h"
+#include "common/flight_recorder.h"
+#include "host_build_graph/runtime/wave_plan.h"
+#include "micro_bench.h"
+#include "pto_ring_buffer.h"
+#include "pto_tensormap.h"
+#include "pto_view_cache.h"
+#include "scheduler/pto_scheduler.h"
+#include "tensor.h"
+#include "utils/device_arena.h"
+
+using micro_bench::Body;
+using micro_bench::Case;
+using micro_bench::do_not_optimize;
+
+namespace {
+
+// Run `fn(thread_idx)` on `threads` threads released together.
+template <typename Fn>
+void run_threads(int threads, Fn &&fn) {
+    std::atomic<bool> go{false};
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t]() {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            fn(t);
+        });
+    }
+    go.store(true, std::memory_order_release);
+    for (auto &th : pool) {
+        th.join();
+    }
+}
+
+// =============================================================================
+// PTO2ReadyQueue (MPMC)
+// =============================================================================
+
+struct ReadyQueueFixture {
+    static constexpr uint64_t CAPACITY = 1024;
+    static constexpr int BATCH = 16;
+    PTO2ReadyQueue queue{};
+    DeviceArena arena;
+    alignas(64) PTO2TaskSlotState slots[8 * BATCH]{};
+
+    ReadyQueueFixture() {
+        const size_t off = ready_queue_reserve_layout(arena, CAPACITY);
+        arena.commit();
+        ready_queue_init_data_from_layout(&queue, arena, off, CAPACITY);
+        ready_queue_wire_arena_pointers(&queue, arena, off);
+    }
+    ~ReadyQueueFixture() {
+        ready_queue_destroy(&queue);
+        arena.release();
+    }
+};
+
+Case ready_queue_push_pop(int threads) {
+    return {"ready_queue/push_pop/threads:" + std::to_string(threads), [threads]() -> Body {
+                auto fx = std::make_shared<ReadyQueueFixture>();
+                return [fx, threads](uint64_t iters) {
+                    const uint64_t per_thread = (iters + threads - 1) / threads;
+                    run_threads(threads, [&](int t) {
+                        PTO2TaskSlotState *mine = &fx->slots[t];
+                        for (uint64_t i = 0; i < per_thread; ++i) {
+                            fx->queue.push(mine);
+                            // Every thread pushes before it pops, so an item is always
+                            // published; a nullptr is only a racing in-flight push.
+                            PTO2TaskSlotState *got = nullptr;
+                            while ((got = fx->queue.pop()) == nullptr) {
+                                std::this_thread::yield();
+                            }
+                            do_not_optimize(got);
+                        }
+                    });
+                    return per_thread * threads;
+                };
+            }};
+}
+
+Case ready_queue_batch(int threads) {
+    return {"ready_queue/batch16/threads:" + std::to_string(threads), [threads]() -> Body {
+                auto fx = std::make_shared<ReadyQueueFixture>();
+                return [fx, threads](uint64_t iters) {
+                    constexpr int B = ReadyQueueFixture::BATCH;
+                    const uint64_t per_thread = (iters + threads - 1) / threads;
+                    run_threads(threads, [&](int t) {
+                        PTO2TaskSlotState *in[B];
+                        PTO2TaskSlotState *out[B];
+                        for (int k = 0; k < B; ++k) {
+                            in[k] = &fx->slots[t * B + k];
+                        }
+                        for (uint64_t i = 0; i < per_thread; ++i) {
+                            fx->queue.push_batch(in, B);
+                            int got = 0;
+                            while ((got += fx->queue.pop_batch(out, B - got)) < B) {
+                                std::this_thread::yield();
+                            }
+                            do_not_optimize(out[0]);
+                        }
+                    });
+                    return per_thread * threads * B;
+                };
+            }};
+}
+
+// =============================================================================
+// PTO2SpscQueue
+// =============================================================================
+
+struct SpscFixture {
+    static constexpr uint64_t CAPACITY = 1024;
+    PTO2SpscQueue queue{};
+    DeviceArena arena;
+    alignas(64) PTO2TaskSlotState slot{};
+
+    SpscFixture() {
+        const size_t off = PTO2SpscQueue::reserve_layout(arena, CAPACITY);
+        arena.commit();
+        queue.init_data_from_layout(arena, off, CAPACITY);
+        queue.wire_arena_pointers(arena, off);
+    }
+    ~SpscFixture() {
+        queue.destroy();
+        arena.release();
+    }
+};
+
+Case spsc_same_thread() {
+    return {"spsc_queue/same_thread", []() -> Body {
+                auto fx = std::make_shared<SpscFixture>();
+                return [fx](uint64_t iters) {
+                    PTO2TaskSlotState *out[1];
+                    for (uint64_t i = 0; i < iters; ++i) {
+                        fx->queue.push(&fx->slot);
+                        do_not_optimize(fx->queue.pop_batch(out, 1));
+                    }
+                    return iters;
+                };
+            }};
+}
+
+Case spsc_cross_thread() {
+    return {"spsc_queue/cross_thread", []() -> Body {
+                auto fx = std::make_shared<SpscFixture>();
+                return [fx](uint64_t iters) {
+                    run_threads(2, [&](int t) {
+                        if (t == 0) {
+                            for (uint64_t i = 0; i < iters; ++i) {
+                                while (!fx->queue.push(&fx->slot)) {
+                                    std::this_thread::yield();
+                                }
+                            }
+                            return;
+                        }
+                        PTO2TaskSlotState *out[64];
+                        for (uint64_t got = 0; got < iters;) {
+                            const int n = fx->queue.pop_batch(out, 64);
+                            if (n == 0) std::this_thread::yield();
+                            got += static_cast<uint64_t>(n);
+                        }
+                    });
+                    return iters;
+                };
+            }};
+}
+
+// =============================================================================
+// PTO2TensorMap
+// =============================================================================
+
+struct TensorMapFixture {
+    static constexpr int32_t NUM_BUCKETS = 1024;
+    static constexpr int32_t POOL_SIZE = 8192;
+    static constexpr int32_t WINDOW_SIZE = 1024;
+    PTO2TensorMap tmap{};
+    DeviceArena arena;
+
+    TensorMapFixture() {
+        int32_t window_sizes[PTO2_MAX_RING_DEPTH] = {WINDOW_SIZE, WINDOW_SIZE, WINDOW_SIZE, WINDOW_SIZE};
+        auto layout = PTO2TensorMap::reserve_layout(arena, NUM_BUCKETS, POOL_SIZE, window_sizes);
+        arena.commit();
+        tmap.init_data_from_layout(layout, arena);
+        tmap.wire_arena_pointers(layout, arena);
+    }
+    ~TensorMapFixture() {
+        tmap.destroy();
+        arena.release();
+    }
+};
+
+Tensor make_2d(uint64_t addr, uint32_t rows, uint32_t cols) {
+    uint32_t shapes[MAX_TENSOR_DIMS] = {rows, cols};
+    return make_tensor_external(reinterpret_cast<void *>(addr), shapes, 2, DataType::FLOAT32, false, 0);
+}
+
+// C producers each write a 16-row band [16i, 16i+16) x [0, 2) of one buffer, so
+// every entry shares the bucket and goes through check_overlap. The consumer
+// reads rows past all bands (none), all bands (covered) or column 1 of all
+// bands (partial: the slow path with OTHER on every entry).
+Case tensormap_lookup(int chain, const char *overlap) {
+    std::string name = "tensormap/lookup/chain:" + std::to_string(chain) + "/overlap:" + overlap;
+    std::string mode = overlap;
+    return {name, [chain, mode]() -> Body {
+                auto fx = std::make_shared<TensorMapFixture>();
+                const uint32_t band = 16;
+                const uint32_t rows = 2 * band * static_cast<uint32_t>(chain);
+                Tensor base = make_2d(0x100000, rows, 2);
+                for (int i = 0; i < chain; ++i) {
+                    uint32_t shapes[] = {band, 2};
+                    uint32_t offsets[] = {band * static_cast<uint32_t>(i), 0};
+                    fx->tmap.insert(base.view(shapes, offsets), PTO2TaskId::make(0, static_cast<uint32_t>(i)));
+                }
+                const uint32_t produced = band * static_cast<uint32_t>(chain);
+                uint32_t shapes[] = {produced, 2};
+                uint32_t offsets[] = {0, 0};
+                if (mode == "none") {
+                    offsets[0] = produced;
+                } else if (mode == "partial") {
+                    shapes[1] = 1;
+                    offsets[1] = 1;
+                }
+                auto consumer = std::make_shared<Tensor>(base.view(shapes, offsets));
+                return [fx, consumer](uint64_t iters) {
+                    uint64_t matches = 0;
+                    for (uint64_t i = 0; i < iters; ++i) {
+                        fx->tmap.lookup(*consumer, [&](PTO2TensorMapEntry &, OverlapStatus) {
+                            ++matches;
+                            return true;
+                        });
+                    }
+                    do_not_optimize(matches);
+                    return iters;
+                };
+            }};
+}
+
+// Each task inserts K outputs (spread across buckets), and tasks retire in
+// order one window-eighth behind, as the orchestrator's cleanup does.
+Case tensormap_insert_retire(int entries) {
+    return {"tensormap/insert_retire/entries:" + std::to_string(entries), [entries]() -> Body {
+                auto fx = std::make_shared<TensorMapFixture>();
+                auto next_task = std::make_shared<int32_t>(0);
+                auto retired = std::make_shared<int32_t>(0);
+                std::vector<Tensor> outs;
+                for (int k = 0; k < 64; ++k) {
+                    outs.push_back(make_2d(0x100000 + static_cast<uint64_t>(k) * 0x10000, 64, 64));
+                }
+                auto tensors = std::make_shared<std::vector<Tensor>>(std::move(outs));
+                return [fx, next_task, retired, tensors, entries](uint64_t iters) {
+                    constexpr int32_t LAG = TensorMapFixture::WINDOW_SIZE / 8;
+                    const uint64_t tasks = (iters + entries - 1) / entries;
+                    for (uint64_t i = 0; i < tasks; ++i) {
+                        const int32_t t = (*next_task)++;
+                        for (int k = 0; k < entries; ++k) {
+                            const Tensor &out = (*tensors)[(t + k) & 63];
+                            fx->tmap.insert(out, PTO2TaskId::make(0, static_cast<uint32_t>(t)));
+                        }
+                        if (t - *retired >= LAG) {
+                            fx->tmap.cleanup_retired(0, *retired, t - LAG / 2);
+                            *retired = t - LAG / 2;
+                        }
+                    }
+                    return tasks * entries;
+                };
+            }};
+}
+
+// =============================================================================
+// PTO2TaskAllocator
+// =============================================================================
+
+struct AllocatorFixture {
+    static constexpr int32_t WINDOW_SIZE = 1024;
+    static constexpr uint64_t HEAP_SIZE = 8 * 1024 * 1024;
+    std::vector<PTO2TaskDescriptor> descriptors;
+    std::unique_ptr<uint8_t[]> heap_storage;
+    std::atomic<int32_t> current_index{0};
+    std::atomic<int32_t> last_alive{0};
+    std::atomic<int32_t> error_code{PTO2_ERROR_NONE};
+    PTO2TaskAllocator allocator{};
+
+    AllocatorFixture() :
+        descriptors(WINDOW_SIZE),
+        heap_storage(new uint8_t[HEAP_SIZE + 64]) {
+        auto base = reinterpret_cast<uintptr_t>(heap_storage.get());
+        void *heap = reinterpret_cast<void *>((base + 63) & ~uintptr_t{63});
+        allocator.init(descriptors.data(), WINDOW_SIZE, &current_index, &last_alive, heap, HEAP_SIZE, &error_code);
+    }
+};
+
+// Retiring = what the scheduler publishes: the last retired task's
+// packed_buffer_end, then last_alive (same white-box protocol as
+// test_task_allocator's consume_up_to).
+Case allocator_alloc_retire(int32_t bytes, int inflight) {
+    std::string name =
+        "task_allocator/alloc_retire/bytes:" + std::to_string(bytes) + "/inflight:" + std::to_string(inflight);
+    return {name, [bytes, inflight]() -> Body {
+                auto fx = std::make_shared<AllocatorFixture>();
+                return [fx, bytes, inflight](uint64_t iters) {
+                    const uint64_t rounds = (iters + inflight - 1) / inflight;
+                    for (uint64_t r = 0; r < rounds; ++r) {
+                        PTO2TaskAllocResult last{};
+                        for (int k = 0; k < inflight; ++k) {
+                            last = fx->allocator.alloc(bytes);
+                            fx->descriptors[last.slot].packed_buffer_end = last.packed_end;
+                        }
+                        fx->last_alive.store(last.task_id + 1, std::memory_order_release);
+                    }
+                    return rounds * inflight;
+                };
+            }};
+}
+
+// =============================================================================
+// Scheduler wiring / completion
+// =============================================================================
+
+struct WiringFixture {
+    static constexpr int MAX_SLOTS = 65;
+    PTO2SchedulerState sched{};
+    PTO2SharedMemoryHandle *sm_handle = nullptr;
+    DeviceArena sm_arena;
+    DeviceArena sched_arena;
+    alignas(64) PTO2TaskSlotState slots[MAX_SLOTS];
+    alignas(64) PTO2TaskPayload payloads[MAX_SLOTS];
+    PTO2TaskDescriptor descs[MAX_SLOTS]{};
+
+    WiringFixture() {
+        sm_handle = PTO2SharedMemoryHandle::create_and_init_default(sm_arena);
+        auto layout = PTO2SchedulerState::reserve_layout(sched_arena);
+        sched_arena.commit();
+        sched.init_data_from_layout(layout, sched_arena, sm_handle->header);
+        sched.wire_arena_pointers(layout, sched_arena);
+        for (int i = 0; i < MAX_SLOTS; ++i) {
+            std::memset(&payloads[i], 0, sizeof(payloads[i]));
+            reset_slot(i, PTO2_TASK_PENDING);
+        }
+    }
+    ~WiringFixture() {
+        sched.destroy();
+        sched_arena.release();
+        sm_arena.release();
+    }
+
+    // Same field set as test_wiring's init_slot, minus the payload wipe.
+    void reset_slot(int i, PTO2TaskState state) {
+        PTO2TaskSlotState &s = slots[i];
+        s.task_state.store(state, std::memory_order_relaxed);
+        s.fanin_count = 0;
+        s.fanin_refcount.store(0, std::memory_order_relaxed);
+        s.fanout_count = 1;
+        s.fanout_refcount.store(0, std::memory_order_relaxed);
+        s.fanout_lock.store(0, std::memory_order_relaxed);
+        s.fanout_head = nullptr;
+        s.ring_id = 0;
+        s.active_mask = ActiveMask(PTO2_SUBTASK_MASK_AIC);
+        s.completed_subtasks.store(0, std::memory_order_relaxed);
+        s.total_required_subtasks = 1;
+        s.logical_block_num = 1;
+        s.dep_pool_mark = 0;
+        s.payload = &payloads[i];
+        s.task = &descs[i];
+    }
+
+    void complete(int i) {
+        if (sched.on_subtask_complete(slots[i])) sched.on_task_complete(slots[i]);
+    }
+
+    // Pop everything the round made ready and hand the dep-pool entries back
+    // (the reclaim that advance_ring_pointers would do).
+    void drain(int expected) {
+        auto &rq = sched.ready_queues[static_cast<int32_t>(PTO2ResourceShape::AIC)];
+        PTO2TaskSlotState *out[64];
+        for (int got = 0; got < expected;) {
+            got += rq.pop_batch(out, 64);
+        }
+        auto &pool = sched.ring_sched_states[0].dep_pool;
+        pool.tail = pool.top;
+    }
+};
+
+// Slot 0 is the consumer, slots 1..K its producers.
+Case wiring_fanin(int fanin) {
+    return {"wiring/fanin:" + std::to_string(fanin), [fanin]() -> Body {
+                auto fx = std::make_shared<WiringFixture>();
+                PTO2TaskPayload &pl = fx->payloads[0];
+                pl.fanin_actual_count = fanin;
+                for (int k = 0; k < fanin; ++k) {
+                    pl.fanin_inline_slot_states[k] = &fx->slots[1 + k];
+                }
+                return [fx, fanin](uint64_t iters) {
+                    const uint64_t rounds = (iters + fanin - 1) / fanin;
+                    auto &rss = fx->sched.ring_sched_states[0];
+                    for (uint64_t r = 0; r < rounds; ++r) {
+                        for (int i = 0; i <= fanin; ++i) {
+                            fx->reset_slot(i, PTO2_TASK_PENDING);
+                        }
+                        fx->sched.wire_task(rss, &fx->slots[0], fanin);
+                        for (int k = 1; k <= fanin; ++k) {
+                            fx->complete(k);
+                        }
+                        fx->drain(1);
+                    }
+                    return rounds * fanin;
+                };
+            }};
+}
+
+// Slot 0 is the producer, slots 1..K its consumers (fanin 1 each).
+Case wiring_fanout(int fanout) {
+    return {"wiring/fanout:" + std::to_string(fanout), [fanout]() -> Body {
+                auto fx = std::make_shared<WiringFixture>();
+                for (int k = 1; k <= fanout; ++k) {
+                    fx->payloads[k].fanin_actual_count = 1;
+                    fx->payloads[k].fanin_inline_slot_states[0] = &fx->slots[0];
+                }
+                return [fx, fanout](uint64_t iters) {
+                    const uint64_t rounds = (iters + fanout - 1) / fanout;
+                    auto &rss = fx->sched.ring_sched_states[0];
+                    for (uint64_t r = 0; r < rounds; ++r) {
+                        for (int i = 0; i <= fanout; ++i) {
+                            fx->reset_slot(i, PTO2_TASK_PENDING);
+                        }
+                        for (int k = 1; k <= fanout; ++k) {
+                            fx->sched.wire_task(rss, &fx->slots[k], 1);
+                        }
+                        fx->complete(0);
+                        fx->drain(fanout);
+                    }
+                    return rounds * fanout;
+                };
+            }};
+}
+
+// The scheduler-side part of one task's life (the producer/consumer pair of
+// wiring/fanout:1) with the two flight recorder probes dispatch and completion
+// write per task. "none" is the PTO2_FLIGHT_RECORDER=0 build, "off" the
+// configure_flight_recorder(False) branch on a null region. The wiring path is
+// a lower bound on the real per-task cost, so on-vs-none is an upper bound on
+// the recorder's share.
+Case flight_recorder_task_path(const char *mode) {
+    return {std::string("flight_recorder/task_path/recorder:") + mode, [mode]() -> Body {
+                struct Fixture {
+                    WiringFixture wiring;
+                    void *region = nullptr;
+                    ~Fixture() {
+                        set_platform_flight_recorder_base(0);
+                        std::free(region);
+                    }
+                };
+                auto fx = std::make_shared<Fixture>();
+                const bool probes = std::strcmp(mode, "none") != 0;
+                if (std::strcmp(mode, "on") == 0) {
+                    const size_t bytes = calc_flight_recorder_size(PLATFORM_MAX_AICPU_THREADS);
+                    fx->region = std::aligned_alloc(64, bytes);
+                    // The writer only needs zeroed rings; the header is the host decoder's.
+                    std::memset(fx->region, 0, bytes);
+                }
+                set_platform_flight_recorder_base(reinterpret_cast<uint64_t>(fx->region));
+                WiringFixture &w = fx->wiring;
+                w.payloads[1].fanin_actual_count = 1;
+                w.payloads[1].fanin_inline_slot_states[0] = &w.slots[0];
+                return [fx, probes](uint64_t iters) {
+                    WiringFixture &w = fx->wiring;
+                    auto &rss = w.sched.ring_sched_states[0];
+                    for (uint64_t i = 0; i < iters; ++i) {
+                        w.reset_slot(0, PTO2_TASK_PENDING);
+                        w.reset_slot(1, PTO2_TASK_PENDING);
+                        w.sched.wire_task(rss, &w.slots[1], 1);
+                        if (probes) flight_recorder_record(1, FLIGHT_RECORDER_EVENT_DISPATCH, i, 0);
+                        w.complete(0);
+                        if (probes) flight_recorder_record(1, FLIGHT_RECORDER_EVENT_FIN, i, 0);
+                        w.drain(1);
+                    }
+                    return iters;
+                };
+            }};
+}
+
+// KV-block walk as in paged attention: fixed tile shape, origin moves by one
+// block per item across a 4096-row cache.
+Case tensor_view(bool cached) {
+    return {std::string("tensor_view/") + (cached ? "cached" : "direct"), [cached]() -> Body {
+                struct Fixture {
+                    std::vector<uint8_t> storage = std::vector<uint8_t>(4096u * 128u * 2u);
+                    Tensor parent;
+                    PTO2ViewCache<> cache;
+                };
+                auto fx = std::make_shared<Fixture>();
+                uint32_t shapes[2] = {4096, 128};
+                fx->parent = make_tensor_external(fx->storage.data(), shapes, 2, DataType::FLOAT16);
+                return [fx, cached](uint64_t iters) {
+                    uint32_t kv_shapes[2] = {64, 128};
+                    for (uint64_t i = 0; i < iters; ++i) {
+                        uint32_t kv_offsets[2] = {static_cast<uint32_t>((i * 64) % 4096), 0};
+                        if (cached) {
+                            const Tensor &v = fx->cache.view(fx->parent, kv_shapes, kv_offsets);
+                            do_not_optimize(&v);
+                        } else {
+                            Tensor v = fx->parent.view(kv_shapes, kv_offsets);
+                            do_not_optimize(v);
+                        }
+                    }
+                    return iters;
+                };
+            }};
+}
+
+// =============================================================================
+// host_build_graph dispatch: dynamic fanin/fanout vs static wave plan
+// =============================================================================
+
+struct HbgTask {
+    std::atomic<int> fanin{0};
+    int fanout[2] = {};
+    int fanout_count = 0;
+    CoreType core_type = CoreType::AIV;
+};
+
+// Monotonic spin barrier, the same shape as the executor's wave barrier.
+struct SpinBarrier {
+    std::atomic<uint64_t> arrivals{0};
+    int threads = 1;
+
+    void wait(uint64_t &generation) {
+        generation++;
+        arrivals.fetch_add(1, std::memory_order_acq_rel);
+        while (arrivals.load(std::memory_order_acquire) < generation * static_cast<uint64_t>(threads)) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+struct HbgDispatchFixture {
+    static constexpr int TILES = 64;
+    static constexpr int GRID_K = 8;
+    static constexpr int TASKS = TILES * GRID_K * 2;
+    std::vector<HbgTask> tasks = std::vector<HbgTask>(TASKS);
+    std::vector<int> initial_fanin = std::vector<int>(TASKS, 0);
+    std::vector<uint8_t> plan;
+    WavePlanView view{};
+
+    // Shared ready queue of the dynamic path (hbg's ready_queue_aic_/aiv_).
+    std::mutex queue_mutex;
+    std::vector<int> queue = std::vector<int>(TASKS);
+    int queue_head = 0;
+    int queue_tail = 0;
+    std::atomic<int> completed{0};
+    SpinBarrier barrier;
+
+    HbgDispatchFixture() {
+        int id = 0;
+        for (int t = 0; t < TILES; t++) {
+            int last_add = -1;
+            for (int k = 0; k < GRID_K; k++) {
+                int gemm = id++;
+                int add = id++;
+                tasks[gemm].core_type = CoreType::AIC;
+                edge(gemm, add);
+                if (last_add >= 0) edge(last_add, gemm);
+                last_add = add;
+            }
+        }
+        for (int i = 0; i < TASKS; i++) {
+            initial_fanin[i] = tasks[i].fanin.load(std::memory_order_relaxed);
+        }
+        wave_plan_build(tasks.data(), TASKS, &plan);
+        wave_plan_view(plan.data(), plan.size(), &view);
+    }
+
+    void edge(int from, int to) {
+        tasks[from].fanout[tasks[from].fanout_count++] = to;
+        tasks[to].fanin.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Re-arm the graph for another round (the host rebuild does this per run).
+    void reset_dynamic() {
+        queue_head = 0;
+        queue_tail = 0;
+        for (int i = 0; i < TASKS; i++) {
+            tasks[i].fanin.store(initial_fanin[i], std::memory_order_relaxed);
+            if (initial_fanin[i] == 0) queue[queue_tail++] = i;
+        }
+        completed.store(0, std::memory_order_release);
+    }
+
+    void run_dynamic(uint64_t &generation) {
+        while (completed.load(std::memory_order_acquire) < TASKS) {
+            int task_id = -1;
+            {
+                std::scoped_lock lock(queue_mutex);
+                if (queue_head < queue_tail) task_id = queue[queue_head++];
+            }
+            if (task_id < 0) {
+                std::this_thread::yield();
+                continue;
+            }
+            do_not_optimize(task_id);  // dispatch + FIN observation
+            const HbgTask &task = tasks[task_id];
+            for (int j = 0; j < task.fanout_count; j++) {
+                int dep = task.fanout[j];
+                if (tasks[dep].fanin.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    std::scoped_lock lock(queue_mutex);
+                    queue[queue_tail++] = dep;
+                }
+            }
+            completed.fetch_add(1, std::memory_order_release);
+        }
+        barrier.wait(generation);
+    }
+
+    // One AIC and one AIV core per thread: thread t owns lane t of each group.
+    void run_wave(int thread_idx, uint64_t &generation) {
+        const int stride = barrier.threads;
+        for (uint32_t w = 0; w < view.header->wave_count; w++) {
+            const WavePlanWave &wave = view.waves[w];
+            for (uint32_t lane = thread_idx; lane < wave.aic_count; lane += stride) {
+                do_not_optimize(view.task_ids[wave.begin + lane]);
+            }
+            for (uint32_t lane = thread_idx; lane < wave.aiv_count; lane += stride) {
+                do_not_optimize(view.task_ids[wave.begin + wave.aic_count + lane]);
+            }
+            barrier.wait(generation);
+        }
+    }
+};
+
+Case hbg_dispatch(bool wave, int threads) {
+    return {std::string("hbg_dispatch/") + (wave ? "wave" : "dynamic") + "/threads:" + std::to_string(threads),
+            [wave, threads]() -> Body {
+                auto fx = std::make_shared<HbgDispatchFixture>();
+                return [fx, wave, threads](uint64_t iters) {
+                    const uint64_t rounds = (iters + HbgDispatchFixture::TASKS - 1) / HbgDispatchFixture::TASKS;
+                    fx->barrier.arrivals.store(0, std::memory_order_relaxed);
+                    fx->barrier.threads = threads;
+                    run_threads(threads, [&](int t) {
+                        uint64_t generation = 0;
+                        for (uint64_t r = 0; r < rounds; ++r) {
+                            if (wave) {
+                                fx->run_wave(t, generation);
+                                continue;
+                            }
+                            if (t == 0) fx->reset_dynamic();
+                            fx->barrier.wait(generation);
+                            fx->run_dynamic(generation);
+                        }
+                    });
+                    return rounds * HbgDispatchFixture::TASKS;
+                };
+            }};
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<Case> cases;
+    for (int t : {1, 2, 4, 8}) {
+        if (t <= cores) cases.push_back(ready_queue_push_pop(t));
+    }
+    for (int t : {1, 2, 4, 8}) {
+        if (t <= cores) cases.push_back(ready_queue_batch(t));
+    }
+    cases.push_back(spsc_same_thread());
+    if (cores >= 2) cases.push_back(spsc_cross_thread());
+    for (int chain : {1, 8, 64}) {
+        for (const char *overlap : {"none", "covered", "partial"}) {
+            cases.push_back(tensormap_lookup(chain, overlap));
+        }
+    }
+    for (int entries : {1, 4}) {
+        cases.push_back(tensormap_insert_retire(entries));
+    }
+    for (int32_t bytes : {0, 256, 16384}) {
+        for (int inflight : {1, 64}) {
+            cases.push_back(allocator_alloc_retire(bytes, inflight));
+        }
+    }
+    for (int k : {1, 4, 16, 64}) {
+        cases.push_back(wiring_fanin(k));
+    }
+    for (int k : {1, 4, 16, 64}) {
+        cases.push_back(wiring_fanout(k));
+    }
+    for (const char *mode : {"none", "off", "on"}) {
+        cases.push_back(flight_recorder_task_path(mode));
+    }
+    cases.push_back(tensor_view(false));
+    cases.push_back(tensor_view(true));
+    for (int t : {1, 4}) {
+        if (t > cores) continue;
+        cases.push_back(hbg_dispatch(false, t));
+        cases.push_back(hbg_dispatch(true, t));
+    }
+    return micro_bench::run_main(argc, argv, cases);
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Minimal in-tree microbenchmark harness for tests/ut/cpp/bench.
+ *
+ * Google Benchmark is not a dependency of this tree, so this covers only what
+ * the runtime benchmarks need:
+ *
+ * - A case is a name plus a setup function. Setup runs once (only for cases
+ *   that pass --filter) and returns the body: `uint64_t body(uint64_t iters)`
+ *   runs `iters` iterations and returns how many items it processed. What an
+ *   item is (one push+pop, one edge, one lookup) is part of the case name.
+ * - The iteration count is calibrated until one call takes at least --min-ms,
+ *   then the call is repeated --repetitions times. Median / min / max ns per
+ *   item across repetitions are reported.
+ * - The whole body call is timed, so bodies that spawn threads rely on the
+ *   calibrated run dwarfing thread start-up.
+ * - --json PATH writes a `simpler-microbench/1` report for trend tracking.
+ */
+
+#ifndef SIMPLER_TESTS_UT_CPP_BENCH_MICRO_BENCH_H
+#define SIMPLER_TESTS_UT_CPP_BENCH_MICRO_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace micro_bench {
+
+using Body = std::function<uint64_t(uint64_t iters)>;
+
+struct Case {
+    std::string name;
+    std::function<Body()> setup;
+};
+
+struct Result {
+    std::string name;
+    uint64_t iterations{0};
+    uint64_t items{0};
+    double ns_per_item_median{0};
+    double ns_per_item_min{0};
+    double ns_per_item_max{0};
+};
+
+// Keep `value` observable so the compiler cannot drop the work producing it.
+template <typename T>
+inline void do_not_optimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline double time_ns(const Body &body, uint64_t iters, uint64_t &items) {
+    const auto t0 = std::chrono::steady_clock::now();
+    items = body(iters);
+    const auto t1 = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+}
+
+inline Result measure(const Case &c, double min_ms, int repetitions) {
+    Body body = c.setup();
+    const double target_ns = min_ms * 1e6;
+    uint64_t iters = 1;
+    uint64_t items = 0;
+    // Untimed first call: page faults and first-touch thread start-up would
+    // otherwise end calibration at a single iteration.
+    body(1);
+    for (;;) {
+        const double ns = time_ns(body, iters, items);
+        if (ns >= target_ns || iters >= (uint64_t{1} << 34)) break;
+        // Aim ~20% past the target so the next probe usually lands; at most 100x per step.
+        const double scale = ns > 0 ? std::min(100.0, std::max(2.0, 1.2 * target_ns / ns)) : 100.0;
+        iters = static_cast<uint64_t>(static_cast<double>(iters) * scale);
+    }
+
+    std::vector<double> per_item;
+    for (int r = 0; r < repetitions; ++r) {
+        const double ns = time_ns(body, iters, items);
+        per_item.push_back(ns / static_cast<double>(std::max<uint64_t>(items, 1)));
+    }
+    std::sort(per_item.begin(), per_item.end());
+    Result res;
+    res.name = c.name;
+    res.iterations = iters;
+    res.items = items;
+    res.ns_per_item_median = per_item[per_item.size() / 2];
+    res.ns_per_item_min = per_item.front();
+    res.ns_per_item_max = per_item.back();
+    return res;
+}
+
+inline bool write_json(const char *path, const std::vector<Result> &results, double min_ms, int repetitions) {
+    FILE *f = std::fopen(path, "w");
+    if (f == nullptr) {
+        std::fprintf(stderr, "micro_bench: cannot open %s\n", path);
+        return false;
+    }
+    std::fprintf(f, "{\n  \"schema\": \"simpler-microbench/1\",\n");
+    std::fprintf(f, "  \"min_ms\": %.3f,\n  \"repetitions\": %d,\n  \"results\": [", min_ms, repetitions);
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        std::fprintf(
+            f,
+            "%s\n    {\"name\": \"%s\", \"iterations\": %llu, \"items\": %llu, "
+            "\"ns_per_item\": {\"median\": %.3f, \"min\": %.3f, \"max\": %.3f}, \"items_per_sec\": %.1f}",
+            i == 0 ? "" : ",", r.name.c_str(), static_cast<unsigned long long>(r.iterations),
+            static_cast<unsigned long long>(r.items), r.ns_per_item_median, r.ns_per_item_min, r.ns_per_item_max,
+            r.ns_per_item_median > 0 ? 1e9 / r.ns_per_item_median : 0.0
+        );
+    }
+    std::fprintf(f, "\n  ]\n}\n");
+    return std::fclose(f) == 0;
+}
+
+/**
+ * CLI: [--filter SUBSTR] [--json PATH] [--min-ms X] [--repetitions N] [--quick] [--list]
+ * --quick (1 ms, one repetition) is the ctest smoke mode. Returns a process exit code.
+ */
+inline int run_main(int argc, char **argv, const std::vector<Case> &cases) {
+    const char *filter = "";
+    const char *json_path = nullptr;
+    double min_ms = 50.0;
+    int repetitions = 5;
+    bool list = false;
+    for (int i = 1; i < argc; ++i) {
+        const bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--filter") == 0 && has_value) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--json") == 0 && has_value) {
+            json_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-ms") == 0 && has_value) {
+            min_ms = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--repetitions") == 0 && has_value) {
+            repetitions = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--quick") == 0) {
+            min_ms = 1.0;
+            repetitions = 1;
+        } else if (std::strcmp(argv[i], "--list") == 0) {
+            list = true;
+        } else {
+            std::fprintf(
+                stderr, "usage: %s [--filter S] [--json PATH] [--min-ms X] [--repetitions N] [--quick] [--list]\n",
+                argv[0]
+            );
+            return 2;
+        }
+    }
+
+    std::vector<Result> results;
+    if (!list) std::printf("%-52s %14s %12s %12s %14s\n", "case", "iterations", "ns/item", "min", "items/s");
+    for (const Case &c : cases) {
+        if (c.name.find(filter) == std::string::npos) continue;
+        if (list) {
+            std::printf("%s\n", c.name.c_str());
+            continue;
+        }
+        Result r = measure(c, min_ms, repetitions);
+        std::printf(
+            "%-52s %14llu %12.2f %12.2f %14.3e\n", r.name.c_str(), static_cast<unsigned long long>(r.iterations),
+            r.ns_per_item_median, r.ns_per_item_min, r.ns_per_item_median > 0 ? 1e9 / r.ns_per_item_median : 0.0
+        );
+        std::fflush(stdout);
+        results.push_back(r);
+    }
+    if (json_path != nullptr && !write_json(json_path, results, min_ms, repetitions)) return 1;
+    return 0;
+}
+
+}  // namespace micro_bench
+
+#endif  // SIMPLER_TESTS_UT_CPP_BENCH_MICRO_BENCH_H
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Shared-library fixture for test_binary_log. It logs through a callback,
+// the way runtime SOs reach the host logger, so its format and __FUNCTION__
+// strings live in this SO's .rodata and go away when the test dlcloses it.
+// It must not include binary_log.h: inline statics would make it
+// STB_GNU_UNIQUE and therefore never unloaded.
+
+using BinlogFixtureLogFn = void (*)(const char *func, const char *fmt, ...);
+
+extern "C" __attribute__((visibility("default"))) void binlog_fixture_log(BinlogFixtureLogFn log, int value) {
+    log(__FUNCTION__, "fixture value %d from %s", value, "the fixture");
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "host/async_copy_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+int ok_job() { return 0; }
+
+AsyncCopyQueue::ThreadFactory plain_threads() {
+    return [](std::function<void()> fn) {
+        return std::thread(std::move(fn));
+    };
+}
+
+}  // namespace
+
+TEST(AsyncCopyQueue, SubmitBeforeStartIsRejected) {
+    AsyncCopyQueue q;
+    EXPECT_EQ(q.submit(ok_job), 0u);
+    EXPECT_EQ(q.query(1), -1);
+    EXPECT_EQ(q.wait(1), -1);
+}
+
+TEST(AsyncCopyQueue, TokensRetireInOrderWithPerTokenRc) {
+    AsyncCopyQueue q;
+    q.start(plain_threads());
+
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    std::vector<int> order;
+    const uint64_t t1 = q.submit([&]() {
+        opened.wait();
+        order.push_back(1);
+        return 0;
+    });
+    const uint64_t t2 = q.submit([&]() {
+        order.push_back(2);
+        return -7;
+    });
+    const uint64_t t3 = q.submit([&]() {
+        order.push_back(3);
+        return 0;
+    });
+    ASSERT_GT(t1, 0u);
+    EXPECT_LT(t1, t2);
+    EXPECT_LT(t2, t3);
+
+    // t1 is parked on the gate, so nothing behind it can have retired.
+    EXPECT_EQ(q.query(t1), 0);
+    EXPECT_EQ(q.query(t3), 0);
+    gate.set_value();
+
+    EXPECT_EQ(q.wait(t3), 0);
+    EXPECT_EQ(q.wait(t2), -7);
+    EXPECT_EQ(q.query(t1), 1);
+    EXPECT_EQ(q.query(t2), -7);
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(q.query(t3 + 1), -1);
+}
+
+TEST(AsyncCopyQueue, WaitAllReportsFailuresOnce) {
+    AsyncCopyQueue q;
+    q.start(plain_threads());
+    q.submit(ok_job);
+    q.submit([]() -> int {
+        throw std::runtime_error("boom");
+    });
+    q.submit([]() {
+        return -3;
+    });
+    EXPECT_EQ(q.wait_all(), -1);  // Exceptions map to -1; earliest failure wins.
+    EXPECT_EQ(q.wait_all(), 0);   // Already reported.
+}
+
+TEST(AsyncCopyQueue, StopDrainsPendingJobs) {
+    std::atomic<int> ran{0};
+    AsyncCopyQueue q;
+    q.start(plain_threads());
+    for (int i = 0; i < 16; ++i) {
+        q.submit([&]() {
+            ran.fetch_add(1);
+            return 0;
+        });
+    }
+    q.stop();
+    EXPECT_EQ(ran.load(), 16);
+    EXPECT_FALSE(q.running());
+    EXPECT_EQ(q.submit(ok_job), 0u);
+
+    // Restartable; tokens keep increasing across restarts.
+    q.start(plain_threads());
+    const uint64_t t = q.submit(ok_job);
+    EXPECT_GT(t, 16u);
+    EXPECT_EQ(q.wait(t), 0);
+}
+
+TEST(StripedMemcpyPool, CopiesExactlyAcrossStripes) {
+    StripedMemcpyPool pool;
+    pool.start(4);
+    for (size_t bytes : {size_t{0}, size_t{1}, size_t{4095}, size_t{64 * 1024 + 13}, size_t{1 << 20}}) {
+        std::vector<uint8_t> src(bytes + 2), dst(bytes + 2, 0xEE);
+        for (size_t i = 0; i < src.size(); ++i) {
+            src[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+        pool.copy(dst.data() + 1, src.data() + 1, bytes, 4096);
+        EXPECT_EQ(std::memcmp(dst.data() + 1, src.data() + 1, bytes), 0) << bytes;
+        // Guard bytes around the destination stay untouched.
+        EXPECT_EQ(dst[0], 0xEE);
+        EXPECT_EQ(dst[bytes + 1], 0xEE);
+    }
+    pool.stop();
+}
+
+TEST(StripedMemcpyPool, BackToBackCopiesUnderQueue) {
+    StripedMemcpyPool pool;
+    pool.start(3);
+    AsyncCopyQueue q;
+    q.start(plain_threads());
+
+    constexpr size_t kBytes = 3 * 1024 * 1024 + 5;
+    std::vector<uint8_t> src(kBytes);
+    for (size_t i = 0; i < kBytes; ++i) {
+        src[i] = static_cast<uint8_t>(i ^ (i >> 9));
+    }
+    std::vector<std::vector<uint8_t>> dsts(8, std::vector<uint8_t>(kBytes));
+    std::vector<uint64_t> tokens;
+    for (auto &d : dsts) {
+        tokens.push_back(q.submit([&pool, &d, &src]() {
+            pool.copy(d.data(), src.data(), kBytes, 256 * 1024);
+            return 0;
+        }));
+    }
+    for (uint64_t t : tokens) {
+        EXPECT_EQ(q.wait(t), 0);
+    }
+    for (const auto &d : dsts) {
+        EXPECT_EQ(std::memcmp(d.data(), src.data(), kBytes), 0);
+    }
+    q.stop();
+    pool.stop();
+}
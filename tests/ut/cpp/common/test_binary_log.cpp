@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Deferred-format binary log: argument capture must render byte-identical to
+// printf, the sink must write self-describing chunks, and HostLogger's binary
+// mode must keep non-ERROR records off stderr.
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <dlfcn.h>
+#include <map>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/binary_log.h"
+#include "host_log.h"
+
+using simpler::log::LogLevel;
+namespace binlog = simpler::log::binlog;
+
+namespace {
+
+std::string roundtrip(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    binlog::Record r{};
+    binlog::encode_args(r, fmt, args);
+    va_end(args);
+    return binlog::format_record(r, fmt);
+}
+
+std::string printf_text(const char *fmt, ...) {
+    char buf[1024];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    return buf;
+}
+
+void sink_record(binlog::Sink &sink, uint8_t tag, const char *func, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    sink.record(tag, func, fmt, args);
+    va_end(args);
+}
+
+struct Chunk {
+    binlog::ChunkHeader header;
+    std::map<uint32_t, std::string> fmts;
+    std::vector<binlog::Record> records;
+};
+
+std::vector<Chunk> read_chunks(const std::string &path) {
+    std::vector<Chunk> chunks;
+    FILE *f = fopen(path.c_str(), "rb");
+    if (f == nullptr) return chunks;
+    Chunk c;
+    while (fread(&c.header, sizeof(c.header), 1, f) == 1) {
+        c.fmts.clear();
+        c.records.assign(c.header.nrec, binlog::Record{});
+        for (uint32_t i = 0; i < c.header.nfmt; ++i) {
+            uint32_t entry[2];
+            EXPECT_EQ(fread(entry, sizeof(entry), 1, f), 1u);
+            std::string s(entry[1], '\0');
+            if (entry[1] > 0) EXPECT_EQ(fread(&s[0], entry[1], 1, f), 1u);
+            c.fmts[entry[0]] = s;
+        }
+        if (c.header.nrec > 0) {
+            EXPECT_EQ(fread(c.records.data(), sizeof(binlog::Record), c.header.nrec, f), c.header.nrec);
+        }
+        chunks.push_back(c);
+    }
+    fclose(f);
+    return chunks;
+}
+
+// Runs fn() with stderr redirected to a temp file; returns what it wrote.
+template <typename F>
+std::string capture_stderr(F &&fn) {
+    fflush(stderr);
+    FILE *err_tmp = tmpfile();
+    int saved_err = dup(fileno(stderr));
+    dup2(fileno(err_tmp), fileno(stderr));
+    fn();
+    fflush(stderr);
+    dup2(saved_err, fileno(stderr));
+    close(saved_err);
+
+    std::string err;
+    rewind(err_tmp);
+    char buf[512];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), err_tmp)) > 0) err.append(buf, n);
+    fclose(err_tmp);
+    return err;
+}
+
+size_t count_substr(const std::string &s, const std::string &needle) {
+    size_t n = 0;
+    for (size_t pos = s.find(needle); pos != std::string::npos; pos = s.find(needle, pos + 1)) ++n;
+    return n;
+}
+
+std::string temp_path(const char *tag) {
+    char tmpl[64];
+    snprintf(tmpl, sizeof(tmpl), "/tmp/binlog_%s_XXXXXX", tag);
+    int fd = mkstemp(tmpl);
+    EXPECT_GE(fd, 0);
+    close(fd);
+    unlink(tmpl);
+    return tmpl;
+}
+
+}  // namespace
+
+TEST(BinaryLogTest, RoundTripMatchesPrintf) {
+    EXPECT_EQ(
+        roundtrip("[%s:%d] x=%5.2f y=%-4lu z=%#llx", "a.cpp", 42, 3.14159, 7ul, 255ull),
+        printf_text("[%s:%d] x=%5.2f y=%-4lu z=%#llx", "a.cpp", 42, 3.14159, 7ul, 255ull)
+    );
+    EXPECT_EQ(
+        roundtrip("%c|%%|%zu|%*d|%.*s", 'Q', size_t{9}, 6, -3, 2, "abc"),
+        printf_text("%c|%%|%zu|%*d|%.*s", 'Q', size_t{9}, 6, -3, 2, "abc")
+    );
+    EXPECT_EQ(
+        roundtrip("%hhd %hu %lld %e", 300, 70000, -1LL, 1e-9), printf_text("%hhd %hu %lld %e", 300, 70000, -1LL, 1e-9)
+    );
+    EXPECT_EQ(roundtrip("%p", reinterpret_cast<void *>(0x1234)), printf_text("%p", reinterpret_cast<void *>(0x1234)));
+}
+
+TEST(BinaryLogTest, NullAndOverflowArgumentsAreMarked) {
+    EXPECT_EQ(roundtrip("s=%s", static_cast<const char *>(nullptr)), "s=(null)");
+    // Thirteen conversions: the last one exceeds kMaxArgs and renders "<?>".
+    std::string text = roundtrip("%d %d %d %d %d %d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13);
+    EXPECT_EQ(text, "1 2 3 4 5 6 7 8 9 10 11 12 <?>");
+}
+
+TEST(BinaryLogTest, StringArgumentsAreCopiedAtRecordTime) {
+    char buf[16] = "before";
+    binlog::Record r{};
+    auto encode = [&r](const char *fmt, ...) {
+        va_list args;
+        va_start(args, fmt);
+        binlog::encode_args(r, fmt, args);
+        va_end(args);
+    };
+    encode("%s", buf);
+    snprintf(buf, sizeof(buf), "after");
+    EXPECT_EQ(binlog::format_record(r, "%s"), "before");
+}
+
+TEST(BinaryLogTest, FlushWritesSelfDescribingChunks) {
+    std::string path = temp_path("flush");
+    binlog::Sink sink;
+    sink.set_path(path.c_str());
+    ASSERT_TRUE(sink.enabled());
+
+    std::thread t1([&sink] {
+        for (int i = 0; i < 100; ++i) sink_record(sink, binlog::info_v_tag(3), "worker", "t1 %d", i);
+    });
+    std::thread t2([&sink] {
+        for (int i = 0; i < 100; ++i) sink_record(sink, binlog::kTagWarn, "worker", "t2 %d", i);
+    });
+    t1.join();
+    t2.join();
+    ASSERT_EQ(sink.flush(), 0);
+    sink_record(sink, binlog::kTagDebug, "main", "late %s", "record");
+    ASSERT_EQ(sink.flush(), 0);
+
+    auto chunks = read_chunks(path);
+    ASSERT_EQ(chunks.size(), 2u);
+    EXPECT_EQ(std::string(chunks[0].header.magic, 8), "SIMPLBL1");
+    EXPECT_EQ(chunks[0].header.record_size, sizeof(binlog::Record));
+    ASSERT_EQ(chunks[0].records.size(), 200u);
+    for (size_t i = 1; i < chunks[0].records.size(); ++i) {
+        EXPECT_LE(chunks[0].records[i - 1].ts_ns, chunks[0].records[i].ts_ns);
+    }
+    int t1_seen = 0;
+    for (const auto &r : chunks[0].records) {
+        const std::string &fmt = chunks[0].fmts.at(r.fmt_id);
+        EXPECT_EQ(chunks[0].fmts.at(r.func_id), "worker");
+        if (fmt == "t1 %d") {
+            EXPECT_EQ(r.tag, binlog::info_v_tag(3));
+            EXPECT_EQ(binlog::format_record(r, fmt.c_str()), "t1 " + std::to_string(t1_seen++));
+        }
+    }
+    EXPECT_EQ(t1_seen, 100);
+    ASSERT_EQ(chunks[1].records.size(), 1u);
+    const binlog::Record &late = chunks[1].records[0];
+    EXPECT_EQ(binlog::format_record(late, chunks[1].fmts.at(late.fmt_id).c_str()), "late record");
+    unlink(path.c_str());
+}
+
+TEST(BinaryLogTest, FullRingDropsAndReportsCount) {
+    std::string path = temp_path("drop");
+    binlog::Sink sink;
+    sink.set_path(path.c_str());
+    for (uint32_t i = 0; i < binlog::kRingRecords + 5; ++i) {
+        sink_record(sink, binlog::kTagDebug, "fn", "%u", i);
+    }
+    ASSERT_EQ(sink.flush(), 0);
+    auto chunks = read_chunks(path);
+    ASSERT_EQ(chunks.size(), 1u);
+    EXPECT_EQ(chunks[0].records.size(), binlog::kRingRecords);
+    EXPECT_EQ(chunks[0].header.dropped, 5u);
+    unlink(path.c_str());
+}
+
+TEST(BinaryLogTest, DropsAreReportedOnStderrOnce) {
+    std::string path = temp_path("dropwarn");
+    binlog::Sink sink;
+    sink.set_path(path.c_str());
+    std::string err = capture_stderr([&sink] {
+        for (int round = 0; round < 2; ++round) {
+            for (uint32_t i = 0; i < binlog::kRingRecords + 1; ++i) {
+                sink_record(sink, binlog::kTagDebug, "fn", "%u", i);
+            }
+            EXPECT_EQ(sink.flush(), 0);
+        }
+    });
+    EXPECT_EQ(count_substr(err, "[binlog]"), 1u);
+    auto chunks = read_chunks(path);
+    ASSERT_EQ(chunks.size(), 2u);
+    EXPECT_EQ(chunks[1].header.dropped, 1u);
+    unlink(path.c_str());
+}
+
+TEST(BinaryLogTest, ThreadRingsAreRecycledAcrossThreadLifetimes) {
+    // Sim spawns fresh AICPU / AICore threads every run: far more thread
+    // lifetimes than kMaxRings must all keep their records.
+    std::string path = temp_path("recycle");
+    binlog::Sink sink;
+    sink.set_path(path.c_str());
+    const uint32_t lifetimes = binlog::kMaxRings * 2 + 7;
+    for (uint32_t i = 0; i < lifetimes; ++i) {
+        std::thread t([&sink, i] {
+            sink_record(sink, binlog::kTagDebug, "worker", "life %u", i);
+        });
+        t.join();
+        if (i % 100 == 99) ASSERT_EQ(sink.flush(), 0);
+    }
+    ASSERT_EQ(sink.flush(), 0);
+
+    size_t total = 0;
+    uint64_t dropped = 0;
+    for (const auto &c : read_chunks(path)) {
+        total += c.records.size();
+        dropped += c.header.dropped;
+    }
+    EXPECT_EQ(total, lifetimes);
+    EXPECT_EQ(dropped, 0u);
+    unlink(path.c_str());
+}
+
+binlog::Sink *g_fixture_sink = nullptr;
+
+void fixture_log(const char *func, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    g_fixture_sink->record(binlog::info_v_tag(0), func, fmt, args);
+    va_end(args);
+}
+
+TEST(BinaryLogTest, FlushAfterLoggingSoIsUnloadedWritesItsStrings) {
+    // ChipWorker dlcloses the host runtime SO, and re-register dlcloses
+    // orchestration SOs, while their records still wait for a flush.
+    std::string path = temp_path("dlclose");
+    binlog::Sink sink;
+    sink.set_path(path.c_str());
+    g_fixture_sink = &sink;
+
+    void *so = dlopen(BINARY_LOG_SO_FIXTURE_PATH, RTLD_NOW | RTLD_LOCAL);
+    ASSERT_NE(so, nullptr) << dlerror();
+    using LogFn = void (*)(void (*)(const char *, const char *, ...), int);
+    auto fn = reinterpret_cast<LogFn>(dlsym(so, "binlog_fixture_log"));
+    ASSERT_NE(fn, nullptr) << dlerror();
+    fn(fixture_log, 7);
+    ASSERT_EQ(dlclose(so), 0);
+    // The fixture's .rodata is really gone.
+    EXPECT_EQ(dlopen(BINARY_LOG_SO_FIXTURE_PATH, RTLD_NOW | RTLD_NOLOAD), nullptr);
+
+    ASSERT_EQ(sink.flush(), 0);
+    g_fixture_sink = nullptr;
+
+    auto chunks = read_chunks(path);
+    ASSERT_EQ(chunks.size(), 1u);
+    ASSERT_EQ(chunks[0].records.size(), 1u);
+    const binlog::Record &r = chunks[0].records[0];
+    EXPECT_EQ(chunks[0].fmts.at(r.func_id), "binlog_fixture_log");
+    EXPECT_EQ(binlog::format_record(r, chunks[0].fmts.at(r.fmt_id).c_str()), "fixture value 7 from the fixture");
+    unlink(path.c_str());
+}
+
+TEST(BinaryLogTest, EqualStringsAtDifferentAddressesShareOneId) {
+    binlog::FormatTable table;
+    char a[] = "same text %d";
+    char b[] = "same text %d";
+    uint32_t id = table.intern(a);
+    ASSERT_NE(id, 0u);
+    EXPECT_EQ(table.intern(b), id);
+    a[0] = 'S';  // the table kept its own copy
+    EXPECT_STREQ(table.lookup(id), "same text %d");
+    EXPECT_NE(table.intern(a), id);
+}
+
+TEST(BinaryLogTest, HostLoggerBinaryModeKeepsOnlyErrorsOnStderr) {
+    std::string path = temp_path("host");
+    HostLogger &logger = HostLogger::get_instance();
+    logger.set_level(LogLevel::DEBUG);
+    logger.set_info_v(0);
+    logger.set_binary_path(path.c_str());
+
+    std::string err = capture_stderr([&logger] {
+        logger.log_info_v(5, "fn", "info %d", 1);
+        logger.log(LogLevel::WARN, "fn", "warn %s", "two");
+        logger.log(LogLevel::ERROR, "fn", "error %d", 3);
+    });
+
+    EXPECT_EQ(err.find("info 1"), std::string::npos);
+    EXPECT_EQ(err.find("warn two"), std::string::npos);
+    EXPECT_NE(err.find("error 3"), std::string::npos);
+
+    ASSERT_EQ(logger.flush_binary(), 0);
+    logger.set_binary_path(nullptr);
+    logger.set_level(LogLevel::INFO);
+    logger.set_info_v(simpler::log::kDefaultInfoV);
+
+    auto chunks = read_chunks(path);
+    ASSERT_EQ(chunks.size(), 1u);
+    ASSERT_EQ(chunks[0].records.size(), 3u);
+    std::vector<std::string> texts;
+    for (const auto &r : chunks[0].records) {
+        texts.push_back(binlog::format_record(r, chunks[0].fmts.at(r.fmt_id).c_str()));
+    }
+    EXPECT_EQ(texts, (std::vector<std::string>{"info 1", "warn two", "error 3"}));
+    EXPECT_EQ(chunks[0].records[0].tag, binlog::info_v_tag(5));
+    EXPECT_EQ(chunks[0].records[2].tag, binlog::kTagError);
+    unlink(path.c_str());
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+// Unit tests for src/common/utils/content_hash_64.h.
+//
+// The hash is a dedup key, so the properties that matter are determinism and
+// sensitivity: every byte position (short path, partial block, full blocks,
+// overlapping tail stripe) must influence the result, and reordering stripes
+// inside a block must not cancel out.
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/content_hash_64.h"
+
+using simpler::common::utils::content_hash_64;
+
+namespace {
+
+std::vector<uint8_t> make_pattern(size_t len) {
+    std::vector<uint8_t> buf(len);
+    uint32_t x = 0x12345678u;
+    for (size_t i = 0; i < len; ++i) {
+        x = x * 1664525u + 1013904223u;
+        buf[i] = static_cast<uint8_t>(x >> 24);
+    }
+    return buf;
+}
+
+}  // namespace
+
+TEST(ContentHash64, DeterministicAcrossCalls) {
+    auto buf = make_pattern(5000);
+    EXPECT_EQ(content_hash_64(buf.data(), buf.size()), content_hash_64(buf.data(), buf.size()));
+    EXPECT_EQ(content_hash_64(nullptr, 0), content_hash_64(buf.data(), 0));
+}
+
+TEST(ContentHash64, EveryLengthPrefixIsDistinct) {
+    // Covers the short path (<= 64), partial blocks, and the first few full
+    // 1 KiB blocks, including lengths that share all bytes but the last.
+    auto buf = make_pattern(3 * 1024 + 7);
+    std::set<uint64_t> seen;
+    for (size_t len = 0; len <= buf.size(); ++len) {
+        EXPECT_TRUE(seen.insert(content_hash_64(buf.data(), len)).second) << "collision at len=" << len;
+    }
+}
+
+TEST(ContentHash64, SingleBitFlipAtAnyPositionChangesHash) {
+    for (size_t len : {1u, 8u, 63u, 64u, 65u, 1000u, 1024u, 1025u, 4096u + 33u}) {
+        auto buf = make_pattern(len);
+        const uint64_t base = content_hash_64(buf.data(), buf.size());
+        for (size_t pos = 0; pos < len; ++pos) {
+            buf[pos] ^= 0x01;
+            EXPECT_NE(content_hash_64(buf.data(), buf.size()), base) << "len=" << len << " pos=" << pos;
+            buf[pos] ^= 0x01;
+        }
+    }
+}
+
+TEST(ContentHash64, SwappedStripesDoNotCancel) {
+    auto buf = make_pattern(2048);
+    const uint64_t base = content_hash_64(buf.data(), buf.size());
+    std::vector<uint8_t> swapped(buf);
+    std::memcpy(swapped.data(), buf.data() + 64, 64);
+    std::memcpy(swapped.data() + 64, buf.data(), 64);
+    EXPECT_NE(content_hash_64(swapped.data(), swapped.size()), base);
+}
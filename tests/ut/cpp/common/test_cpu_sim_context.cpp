@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+// Contract test for the sim pipe shared state hook
+// (src/common/platform/sim/sim_context/cpu_sim_context.cpp).
+//
+// pto-isa calls pto_sim_get_pipe_shared_state once per pipe op from every
+// simulated core. All cores of a cluster must resolve the same pointer, the
+// pointer must survive the between-runs reset (state zeroed in place), a
+// larger request under an existing key must never get the smaller buffer, and
+// a device release must not leave per-thread caches pointing at freed storage.
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "cpu_sim_context.h"
+
+namespace {
+
+constexpr int kDevice = 7;
+constexpr size_t kStateSize = 256;
+
+class CpuSimContextTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        key_ = pto_cpu_sim_acquire_context(kDevice);
+        pto_cpu_sim_bind_context(key_);
+        sim_context_set_cluster_id(0);
+    }
+    void TearDown() override {
+        pto_cpu_sim_release_context(key_);
+        pto_cpu_sim_bind_context(-1);
+    }
+
+    int key_{-1};
+};
+
+}  // namespace
+
+TEST_F(CpuSimContextTest, SameKeyResolvesSamePointerPerCluster) {
+    void *a = pto_sim_get_pipe_shared_state(0x11, kStateSize);
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(pto_sim_get_pipe_shared_state(0x11, kStateSize), a);
+    EXPECT_NE(pto_sim_get_pipe_shared_state(0x22, kStateSize), a);
+
+    sim_context_set_cluster_id(1);
+    void *b = pto_sim_get_pipe_shared_state(0x11, kStateSize);
+    EXPECT_NE(b, a) << "clusters must not share pipe state";
+    sim_context_set_cluster_id(0);
+    EXPECT_EQ(pto_sim_get_pipe_shared_state(0x11, kStateSize), a);
+}
+
+TEST_F(CpuSimContextTest, UnboundThreadGetsNull) {
+    void *result = reinterpret_cast<void *>(1);
+    std::thread t([&] { result = pto_sim_get_pipe_shared_state(0x11, kStateSize); });
+    t.join();
+    EXPECT_EQ(result, nullptr);
+}
+
+TEST_F(CpuSimContextTest, ConcurrentFirstTouchAgreesOnOnePointer) {
+    constexpr int kThreads = 16;
+    constexpr int kClusters = 4;
+    std::vector<void *> seen(kThreads * 64, nullptr);
+    std::atomic<int> start{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&, t] {
+            pto_cpu_sim_bind_context(key_);
+            sim_context_set_cluster_id(static_cast<uint32_t>(t % kClusters));
+            while (start.load() == 0) {}
+            for (int p = 0; p < 64; p++) {
+                seen[t * 64 + p] = pto_sim_get_pipe_shared_state(0x1000 + p, kStateSize);
+            }
+        });
+    }
+    start.store(1);
+    for (auto &th : threads) {
+        th.join();
+    }
+    for (int t = 0; t < kThreads; t++) {
+        for (int p = 0; p < 64; p++) {
+            ASSERT_NE(seen[t * 64 + p], nullptr);
+            EXPECT_EQ(seen[t * 64 + p], seen[(t % kClusters) * 64 + p]) << "thread " << t << " pipe " << p;
+        }
+    }
+}
+
+TEST_F(CpuSimContextTest, ClearZeroesInPlaceAndKeepsPointer) {
+    auto *a = static_cast<uint8_t *>(pto_sim_get_pipe_shared_state(0x11, kStateSize));
+    ASSERT_NE(a, nullptr);
+    std::memset(a, 0xab, kStateSize);
+
+    clear_cpu_sim_shared_storage(key_);
+
+    EXPECT_EQ(pto_sim_get_pipe_shared_state(0x11, kStateSize), a);
+    for (size_t i = 0; i < kStateSize; i++) {
+        ASSERT_EQ(a[i], 0) << "byte " << i;
+    }
+}
+
+TEST_F(CpuSimContextTest, ReleaseInvalidatesThreadCache) {
+    auto *a = static_cast<uint8_t *>(pto_sim_get_pipe_shared_state(0x11, kStateSize));
+    ASSERT_NE(a, nullptr);
+    std::memset(a, 0xab, kStateSize);
+
+    pto_cpu_sim_release_context(key_);
+    EXPECT_EQ(pto_sim_get_pipe_shared_state(0x11, kStateSize), nullptr) << "released context has no state";
+
+    key_ = pto_cpu_sim_acquire_context(kDevice);
+    pto_cpu_sim_bind_context(key_);
+    auto *b = static_cast<uint8_t *>(pto_sim_get_pipe_shared_state(0x11, kStateSize));
+    ASSERT_NE(b, nullptr);
+    for (size_t i = 0; i < kStateSize; i++) {
+        ASSERT_EQ(b[i], 0) << "byte " << i;
+    }
+}
+
+TEST_F(CpuSimContextTest, LargerRequestGrowsStorage) {
+    void *a = pto_sim_get_pipe_shared_state(0x11, kStateSize);
+    ASSERT_NE(a, nullptr);
+    clear_cpu_sim_shared_storage(key_);
+
+    constexpr size_t kBigger = kStateSize * 16;
+    auto *b = static_cast<uint8_t *>(pto_sim_get_pipe_shared_state(0x11, kBigger));
+    ASSERT_NE(b, nullptr);
+    for (size_t i = 0; i < kBigger; i++) {
+        ASSERT_EQ(b[i], 0) << "byte " << i;
+    }
+    std::memset(b, 0xcd, kBigger);
+    EXPECT_EQ(pto_sim_get_pipe_shared_state(0x11, kStateSize), b) << "smaller request reuses the grown block";
+    EXPECT_EQ(pto_sim_get_pipe_shared_state(0x11, kBigger), b);
+
+    clear_cpu_sim_shared_storage(key_);
+    EXPECT_EQ(pto_sim_get_pipe_shared_state(0x11, kBigger), b);
+    EXPECT_EQ(b[kBigger - 1], 0) << "reset covers the grown size";
+}
+
+TEST_F(CpuSimContextTest, GrowthByAnotherThreadInvalidatesThreadCache) {
+    void *a = pto_sim_get_pipe_shared_state(0x33, kStateSize);  // cached on this thread
+    ASSERT_NE(a, nullptr);
+
+    void *grown = nullptr;
+    std::thread t([&] {
+        pto_cpu_sim_bind_context(key_);
+        sim_context_set_cluster_id(0);
+        grown = pto_sim_get_pipe_shared_state(0x33, kStateSize * 4);
+    });
+    t.join();
+
+    ASSERT_NE(grown, nullptr);
+    EXPECT_EQ(pto_sim_get_pipe_shared_state(0x33, kStateSize), grown) << "stale cached line after growth";
+}
+
+// Two runners on one device (ChipWorker run lanes): pipe slots, resets and
+// release stay per lane.
+TEST_F(CpuSimContextTest, LanesOnOneDeviceAreIsolated) {
+    const int lane1 = pto_cpu_sim_acquire_context(kDevice);
+    ASSERT_NE(lane1, key_);
+
+    auto *a = static_cast<uint8_t *>(pto_sim_get_pipe_shared_state(0x11, kStateSize));
+    ASSERT_NE(a, nullptr);
+    std::memset(a, 0xab, kStateSize);
+
+    uint8_t *b = nullptr;
+    std::thread t([&] {
+        pto_cpu_sim_bind_context(lane1);
+        sim_context_set_cluster_id(0);
+        b = static_cast<uint8_t *>(pto_sim_get_pipe_shared_state(0x11, kStateSize));
+        if (b != nullptr) std::memset(b, 0xcd, kStateSize);
+    });
+    t.join();
+    ASSERT_NE(b, nullptr);
+    EXPECT_NE(b, a) << "same pipe key on two lanes must not share a slot";
+
+    clear_cpu_sim_shared_storage(lane1);
+    EXPECT_EQ(a[0], 0xab) << "clearing lane 1 wiped lane 0";
+    EXPECT_EQ(b[0], 0);
+
+    pto_cpu_sim_release_context(lane1);
+    EXPECT_EQ(pto_sim_get_pipe_shared_state(0x11, kStateSize), a) << "releasing lane 1 dropped lane 0";
+    EXPECT_EQ(a[kStateSize - 1], 0xab);
+}
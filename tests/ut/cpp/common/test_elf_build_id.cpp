@@ -14,11 +14,10 @@
 // a real linker:
 //   1. well-formed ELF64 + NT_GNU_BUILD_ID note → returns the first 8 bytes
 //      of the descriptor verbatim.
-//   2. well-formed ELF64 without any GNU Build-ID note → falls back to
-//      FNV-1a over the whole buffer, and two identical buffers produce the
-//      same hash while different buffers produce different hashes.
-//   3. non-ELF / truncated input → also falls back to FNV-1a and does not
-//      crash.
+//   2. well-formed ELF64 without any GNU Build-ID note → elf_build_id_64
+//      falls back to fnv1a_64 over the whole buffer (the persisted, wire-stable
+//      fingerprint), elf_build_id_memo_key_64 to content_hash_64.
+//   3. non-ELF / truncated input → same fallbacks, no crash.
 
 #include <cstdint>
 #include <cstring>
@@ -103,6 +102,11 @@ TEST(ElfBuildId, NonElfFallsBackToFnv1aAndIsStable) {
     uint64_t a = simpler::common::utils::elf_build_id_64(data, len);
     uint64_t b = simpler::common::utils::elf_build_id_64(data, len);
     EXPECT_EQ(a, b);
+    // The fingerprint names installed inner SOs: it must stay FNV-1a.
+    EXPECT_EQ(a, simpler::common::utils::fnv1a_64(data, len));
+    EXPECT_EQ(
+        simpler::common::utils::elf_build_id_memo_key_64(data, len), simpler::common::utils::content_hash_64(data, len)
+    );
 
     const char *other = "totally-different-bytes";
     uint64_t c = simpler::common::utils::elf_build_id_64(other, std::strlen(other));
@@ -111,7 +115,7 @@ TEST(ElfBuildId, NonElfFallsBackToFnv1aAndIsStable) {
 
 TEST(ElfBuildId, ElfWithoutBuildIdFallsBack) {
     // Build a valid ELF64 header but skip the note → should fall through to
-    // FNV-1a. The important check is that it does not crash and produces a
+    // fnv1a_64. The important check is that it does not crash and produces a
     // stable hash for identical inputs.
     std::vector<uint8_t> buf(sizeof(Elf64_Ehdr), 0);
     Elf64_Ehdr ehdr{};
@@ -126,4 +130,23 @@ TEST(ElfBuildId, ElfWithoutBuildIdFallsBack) {
     uint64_t a = simpler::common::utils::elf_build_id_64(buf.data(), buf.size());
     uint64_t b = simpler::common::utils::elf_build_id_64(buf.data(), buf.size());
     EXPECT_EQ(a, b);
+    EXPECT_EQ(a, simpler::common::utils::fnv1a_64(buf.data(), buf.size()));
+}
+
+TEST(ElfBuildId, FindReportsPresenceOfBuildId) {
+    std::vector<uint8_t> id(20, 0x5A);
+    auto with_id = make_elf_with_build_id(id);
+    uint64_t got = 0;
+    ASSERT_TRUE(simpler::common::utils::elf_find_build_id_64(with_id.data(), with_id.size(), &got));
+    uint64_t want = 0;
+    std::memcpy(&want, id.data(), 8);
+    EXPECT_EQ(got, want);
+
+    const char *not_elf = "not-an-elf-binary";
+    EXPECT_FALSE(simpler::common::utils::elf_find_build_id_64(not_elf, std::strlen(not_elf), &got));
+    EXPECT_FALSE(simpler::common::utils::elf_find_build_id_64(nullptr, 0, &got));
+
+    // With a Build-ID both entry points agree.
+    EXPECT_EQ(simpler::common::utils::elf_build_id_memo_key_64(with_id.data(), with_id.size()), want);
+    EXPECT_EQ(simpler::common::utils::elf_build_id_64(with_id.data(), with_id.size()), want);
 }
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "host/flight_recorder.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unistd.h>
+
+#include "aicpu/flight_recorder_aicpu.h"
+
+namespace {
+
+constexpr int kRings = PLATFORM_MAX_AICPU_THREADS;
+constexpr uint64_t kCap = PLATFORM_FLIGHT_RECORDER_RECORDS_PER_THREAD;
+
+class FlightRecorderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        bytes_ = calc_flight_recorder_size(kRings);
+        region_ = std::aligned_alloc(64, bytes_);
+        std::memset(region_, 0, bytes_);
+        flight_recorder_init_header(get_flight_recorder_header(region_), kRings);
+        set_platform_flight_recorder_base(reinterpret_cast<uint64_t>(region_));
+    }
+
+    void TearDown() override {
+        set_platform_flight_recorder_base(0);
+        std::free(region_);
+    }
+
+    void *region_{nullptr};
+    size_t bytes_{0};
+};
+
+std::string read_file(const std::string &path) {
+    std::ifstream in(path);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST_F(FlightRecorderTest, RecordsDecodePerThreadAndMergeByTime) {
+    const uint64_t task = (uint64_t{2} << 32) | 17;
+    flight_recorder_record(0, FLIGHT_RECORDER_EVENT_RUN_BEGIN, 0, 1);
+    flight_recorder_record(1, FLIGHT_RECORDER_EVENT_DISPATCH, task, 5);
+    flight_recorder_record(1, FLIGHT_RECORDER_EVENT_FIN, task, 5);
+    flight_recorder_set_orch_thread_idx(0);
+    flight_recorder_orch_record(FLIGHT_RECORDER_EVENT_SCOPE_BEGIN, 3, 1);
+
+    FlightRecorderSnapshot snap;
+    ASSERT_TRUE(flight_recorder_decode(region_, bytes_, &snap));
+    ASSERT_EQ(snap.written.size(), static_cast<size_t>(kRings));
+    EXPECT_EQ(snap.written[0], 2u);
+    EXPECT_EQ(snap.written[1], 2u);
+    EXPECT_EQ(snap.written[2], 0u);
+    ASSERT_EQ(snap.events.size(), 4u);
+    EXPECT_FALSE(snap.error_latched);
+
+    for (size_t i = 1; i < snap.events.size(); ++i) {
+        EXPECT_LE(snap.events[i - 1].record.timestamp, snap.events[i].record.timestamp);
+    }
+    int dispatch_seen = 0;
+    for (const auto &ev : snap.events) {
+        if (ev.record.kind != FLIGHT_RECORDER_EVENT_DISPATCH) continue;
+        ++dispatch_seen;
+        EXPECT_EQ(ev.thread, 1);
+        EXPECT_EQ(ev.record.ring_id, 2u);
+        EXPECT_EQ(ev.record.arg, 17u);
+        EXPECT_EQ(ev.record.aux, 5u);
+    }
+    EXPECT_EQ(dispatch_seen, 1);
+}
+
+TEST_F(FlightRecorderTest, WraparoundKeepsNewestWindow) {
+    const uint64_t total = kCap + 100;
+    for (uint64_t i = 0; i < total; ++i) {
+        flight_recorder_record(2, FLIGHT_RECORDER_EVENT_FIN, i, 0);
+    }
+
+    FlightRecorderSnapshot snap;
+    ASSERT_TRUE(flight_recorder_decode(region_, bytes_, &snap));
+    EXPECT_EQ(snap.written[2], total);
+    ASSERT_EQ(snap.events.size(), kCap);
+    EXPECT_EQ(snap.events.front().record.arg, 100u);
+    EXPECT_EQ(snap.events.back().record.arg, static_cast<uint32_t>(total - 1));
+}
+
+TEST_F(FlightRecorderTest, ErrorLatchesHeader) {
+    flight_recorder_set_orch_thread_idx(3);
+    flight_recorder_orch_record(FLIGHT_RECORDER_EVENT_ERROR, 7, 0);
+
+    FlightRecorderSnapshot snap;
+    ASSERT_TRUE(flight_recorder_decode(region_, bytes_, &snap));
+    EXPECT_TRUE(snap.error_latched);
+    ASSERT_EQ(snap.events.size(), 1u);
+    EXPECT_EQ(snap.events[0].thread, 3);
+}
+
+TEST_F(FlightRecorderTest, NullBaseAndBadThreadAreDropped) {
+    flight_recorder_record(kRings, FLIGHT_RECORDER_EVENT_FIN, 1, 0);
+    flight_recorder_record(-1, FLIGHT_RECORDER_EVENT_FIN, 1, 0);
+    set_platform_flight_recorder_base(0);
+    flight_recorder_record(0, FLIGHT_RECORDER_EVENT_FIN, 1, 0);
+
+    FlightRecorderSnapshot snap;
+    ASSERT_TRUE(flight_recorder_decode(region_, bytes_, &snap));
+    EXPECT_TRUE(snap.events.empty());
+}
+
+TEST_F(FlightRecorderTest, DecodeRejectsBadImage) {
+    FlightRecorderSnapshot snap;
+    EXPECT_FALSE(flight_recorder_decode(region_, sizeof(FlightRecorderHeader), &snap));
+    get_flight_recorder_header(region_)->magic = 0;
+    EXPECT_FALSE(flight_recorder_decode(region_, bytes_, &snap));
+}
+
+TEST_F(FlightRecorderTest, WriteJson) {
+    flight_recorder_record(0, FLIGHT_RECORDER_EVENT_ALLOC_BLOCK, 9, FLIGHT_RECORDER_ALLOC_HEAP);
+    flight_recorder_record(0, FLIGHT_RECORDER_EVENT_RUN_END, static_cast<uint32_t>(-3), 0);
+
+    FlightRecorderSnapshot snap;
+    ASSERT_TRUE(flight_recorder_decode(region_, bytes_, &snap));
+    const std::string path =
+        (std::filesystem::temp_directory_path() / ("fr_test_" + std::to_string(getpid()) + ".json")).string();
+    ASSERT_EQ(flight_recorder_write_json(snap, path, "error", 50000000), 0);
+
+    const std::string text = read_file(path);
+    std::filesystem::remove(path);
+    EXPECT_NE(text.find("\"reason\": \"error\""), std::string::npos);
+    EXPECT_NE(text.find("\"clock_freq_hz\": 50000000"), std::string::npos);
+    EXPECT_NE(text.find("\"event\": \"alloc_block\", \"task_id\": 9, \"resource\": \"heap\""), std::string::npos);
+    EXPECT_NE(text.find("\"event\": \"run_end\", \"code\": -3"), std::string::npos);
+    EXPECT_NE(text.find("{\"thread\": 0, \"written\": 2, \"kept\": 2}"), std::string::npos);
+}
+
+TEST(FlightRecorderPolicyTest, AutoDumpReasons) {
+    FlightRecorderPolicy policy;
+    EXPECT_FALSE(policy.enabled());
+    // No dump dir -> never auto-dumps.
+    EXPECT_EQ(policy.auto_dump_reason(-1, 0), nullptr);
+
+    policy.configure(true, 1000, "/tmp/fr");
+    EXPECT_STREQ(policy.auto_dump_reason(-1, 0), "error");
+    EXPECT_STREQ(policy.auto_dump_reason(0, 1001), "slow_step");
+    EXPECT_EQ(policy.auto_dump_reason(0, 1000), nullptr);
+
+    policy.configure(true, 0, "/tmp/fr");
+    EXPECT_EQ(policy.auto_dump_reason(0, UINT64_MAX), nullptr);
+
+    policy.configure(false, 1000, "/tmp/fr");
+    EXPECT_EQ(policy.auto_dump_reason(-1, 5000), nullptr);
+}
+
+TEST(FlightRecorderPolicyTest, DumpPathsAreUnique) {
+    const auto dir = std::filesystem::temp_directory_path() / ("fr_dir_" + std::to_string(getpid()));
+    FlightRecorderPolicy policy;
+    policy.configure(true, 0, dir.c_str());
+    const std::string a = policy.next_dump_path("error");
+    const std::string b = policy.next_dump_path("slow_step");
+    EXPECT_NE(a, b);
+    EXPECT_TRUE(std::filesystem::is_directory(dir));
+    EXPECT_NE(a.find("_error.json"), std::string::npos);
+    EXPECT_NE(b.find("_slow_step.json"), std::string::npos);
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+// Contract test for the sim `create_orch_so_file` / `release_orch_so_file`
+// pair (src/common/platform/sim/aicpu/orch_so_file.cpp).
+//
+// The sim AICPU executor writes the orch SO through the returned fd, closes
+// it, then dlopen()s the returned path. On Linux the path is a memfd exposed
+// as /proc/self/fd/<N>, so the path must stay resolvable after the writer fd
+// is closed and until release_orch_so_file() — otherwise <N> could be
+// recycled while glibc still caches the loaded image under that name.
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "aicpu/orch_so_file.h"
+
+TEST(OrchSoFileSim, PathOutlivesWriterFdUntilRelease) {
+    char path[256] = {};
+    int32_t fd = create_orch_so_file("/tmp", /*callable_id=*/0, /*device_id=*/0, path, sizeof(path));
+    ASSERT_GE(fd, 0);
+
+    const char payload[] = "orch-so-bytes";
+    ASSERT_EQ(write(fd, payload, sizeof(payload)), static_cast<ssize_t>(sizeof(payload)));
+    close(fd);
+
+    struct stat st {};
+    ASSERT_EQ(stat(path, &st), 0) << "path must stay valid after the writer fd is closed: " << path;
+    EXPECT_EQ(st.st_size, static_cast<off_t>(sizeof(payload)));
+
+    release_orch_so_file(path);
+    EXPECT_NE(stat(path, &st), 0) << "path must be gone after release: " << path;
+
+    // Double release is a no-op and must not close an unrelated fd.
+    release_orch_so_file(path);
+}
+
+TEST(OrchSoFileSim, DistinctCallsProduceDistinctPaths) {
+    char path0[256] = {};
+    char path1[256] = {};
+    int32_t fd0 = create_orch_so_file("/tmp", /*callable_id=*/0, /*device_id=*/0, path0, sizeof(path0));
+    int32_t fd1 = create_orch_so_file("/tmp", /*callable_id=*/0, /*device_id=*/0, path1, sizeof(path1));
+    ASSERT_GE(fd0, 0);
+    ASSERT_GE(fd1, 0);
+    close(fd0);
+    close(fd1);
+
+    EXPECT_STRNE(path0, path1) << "Multiple sim workers can share a process; paths must be unique per call.";
+
+    release_orch_so_file(path0);
+    release_orch_so_file(path1);
+}
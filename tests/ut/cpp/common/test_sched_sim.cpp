@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// SchedSim what-if replay: graph validation, closed-form makespans on tiny
+// DAGs, and the direction of each knob (threads, policy, ring, early dispatch).
+
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sched_sim.h"
+
+using namespace simpler::sched_sim;
+
+namespace {
+
+struct GraphSpec {
+    uint32_t n{0};
+    std::vector<uint32_t> src, dst;
+    std::vector<uint32_t> sub_task;
+    std::vector<uint8_t> sub_type;
+    std::vector<uint64_t> sub_dur;
+
+    void edge(uint32_t a, uint32_t b) {
+        src.push_back(a);
+        dst.push_back(b);
+    }
+    void sub(uint32_t task, CoreType type, uint64_t dur) {
+        sub_task.push_back(task);
+        sub_type.push_back(static_cast<uint8_t>(type));
+        sub_dur.push_back(dur);
+    }
+    SchedSimGraph build() const { return SchedSimGraph(n, src, dst, sub_task, sub_type, sub_dur); }
+};
+
+// Zero scheduler overhead: makespan is pure kernel time.
+SchedSimConfig free_config() {
+    SchedSimConfig c;
+    c.dispatch_ns = 0;
+    c.complete_ns = 0;
+    c.fanout_edge_ns = 0;
+    c.launch_ns = 0;
+    c.spec_release_ns = 0;
+    return c;
+}
+
+}  // namespace
+
+TEST(SchedSimGraphTest, RejectsBadInput) {
+    EXPECT_THROW(SchedSimGraph(2, {0}, {2}, {}, {}, {}), std::invalid_argument);
+    EXPECT_THROW(SchedSimGraph(2, {1}, {1}, {}, {}, {}), std::invalid_argument);
+    EXPECT_THROW(SchedSimGraph(3, {0, 1, 2}, {1, 2, 0}, {}, {}, {}), std::invalid_argument);
+    EXPECT_THROW(SchedSimGraph(1, {}, {}, {0}, {2}, {10}), std::invalid_argument);
+    EXPECT_THROW(SchedSimGraph(1, {}, {}, {0, 0}, {0}, {10}), std::invalid_argument);
+}
+
+TEST(SchedSimGraphTest, DedupsEdgesAndComputesBottomLevel) {
+    GraphSpec g;
+    g.n = 3;
+    g.edge(0, 1);
+    g.edge(0, 1);
+    g.edge(1, 2);
+    g.edge(0, 2);
+    g.sub(0, CoreType::AIC, 10);
+    g.sub(1, CoreType::AIV, 20);
+    g.sub(1, CoreType::AIV, 5);
+    g.sub(2, CoreType::AIC, 7);
+    SchedSimGraph graph = g.build();
+    EXPECT_EQ(graph.num_edges(), 3u);
+    EXPECT_EQ(graph.num_subtasks(), 4u);
+    EXPECT_EQ(graph.bottom_level(), (std::vector<uint64_t>{37, 27, 7}));
+}
+
+TEST(SchedSimTest, ChainMakespanIsKernelPlusOverheadPerHop) {
+    GraphSpec g;
+    g.n = 4;
+    for (uint32_t i = 0; i < g.n; ++i) g.sub(i, CoreType::AIV, 1000);
+    for (uint32_t i = 0; i + 1 < g.n; ++i) g.edge(i, i + 1);
+    SchedSimGraph graph = g.build();
+
+    SchedSimResult r = simulate(graph, free_config());
+    EXPECT_EQ(r.makespan_ns, 4000u);
+    EXPECT_EQ(r.critical_path_ns, 4000u);
+
+    SchedSimConfig c = free_config();
+    c.dispatch_ns = 10;
+    c.launch_ns = 20;
+    c.complete_ns = 5;
+    c.fanout_edge_ns = 1;
+    r = simulate(graph, c);
+    // Per hop: dispatch + launch + kernel + complete (+1 fanout except the sink).
+    EXPECT_EQ(r.makespan_ns, 4u * (10 + 20 + 1000 + 5) + 3u);
+}
+
+TEST(SchedSimTest, IndependentTasksUseAllCores) {
+    GraphSpec g;
+    g.n = 8;
+    for (uint32_t i = 0; i < g.n; ++i) g.sub(i, CoreType::AIC, 100);
+    SchedSimGraph graph = g.build();
+    SchedSimConfig c = free_config();
+    c.num_threads = 2;
+    c.num_aic = 4;
+    c.num_aiv = 0;
+    SchedSimResult r = simulate(graph, c);
+    EXPECT_EQ(r.makespan_ns, 200u);
+    EXPECT_DOUBLE_EQ(r.aic_utilization, 1.0);
+    EXPECT_EQ(r.tasks, 8u);
+    EXPECT_EQ(r.subtasks, 8u);
+}
+
+TEST(SchedSimTest, RejectsConfigWithoutNeededCores) {
+    GraphSpec g;
+    g.n = 1;
+    g.sub(0, CoreType::AIC, 100);
+    SchedSimGraph graph = g.build();
+    SchedSimConfig c = free_config();
+    c.num_aic = 0;
+    EXPECT_THROW(simulate(graph, c), std::invalid_argument);
+    c = free_config();
+    c.num_threads = 0;
+    EXPECT_THROW(simulate(graph, c), std::invalid_argument);
+}
+
+TEST(SchedSimTest, PriorityPolicyFavoursCriticalPath) {
+    // Two cores, one thread. Two short tasks are submitted before the head of
+    // a long chain: FIFO runs the shorts first and delays the chain by one
+    // slot, PRIORITY starts the chain head immediately.
+    GraphSpec g;
+    g.n = 5;
+    g.sub(0, CoreType::AIV, 100);
+    g.sub(1, CoreType::AIV, 100);
+    g.sub(2, CoreType::AIV, 1000);
+    g.sub(3, CoreType::AIV, 1000);
+    g.sub(4, CoreType::AIV, 1000);
+    g.edge(2, 3);
+    g.edge(3, 4);
+    SchedSimGraph graph = g.build();
+
+    SchedSimConfig c = free_config();
+    c.num_threads = 1;
+    c.num_aic = 0;
+    c.num_aiv = 2;
+    c.policy = ReadyPolicy::FIFO;
+    EXPECT_EQ(simulate(graph, c).makespan_ns, 3100u);
+    c.policy = ReadyPolicy::PRIORITY;
+    EXPECT_EQ(simulate(graph, c).makespan_ns, 3000u);
+    c.policy = ReadyPolicy::SUBMIT_ORDER;
+    EXPECT_EQ(simulate(graph, c).makespan_ns, 3100u);
+}
+
+TEST(SchedSimTest, RingSizeStallsOrchestrator) {
+    GraphSpec g;
+    g.n = 6;
+    for (uint32_t i = 0; i < g.n; ++i) g.sub(i, CoreType::AIV, 100);
+    SchedSimGraph graph = g.build();
+    SchedSimConfig c = free_config();
+    c.num_threads = 1;
+    c.num_aic = 0;
+    c.num_aiv = 6;
+    c.orch_submit_ns = 10;
+
+    SchedSimResult free_run = simulate(graph, c);
+    EXPECT_EQ(free_run.makespan_ns, 150u);
+    EXPECT_EQ(free_run.orch_ring_stall_ns, 0u);
+
+    c.ring_size = 2;
+    SchedSimResult gated = simulate(graph, c);
+    EXPECT_GT(gated.makespan_ns, free_run.makespan_ns);
+    EXPECT_GT(gated.orch_ring_stall_ns, 0u);
+}
+
+TEST(SchedSimTest, EarlyDispatchHidesDispatchLatency) {
+    GraphSpec g;
+    g.n = 8;
+    for (uint32_t i = 0; i < g.n; ++i) g.sub(i, CoreType::AIV, 1000);
+    for (uint32_t i = 0; i + 1 < g.n; ++i) g.edge(i, i + 1);
+    SchedSimGraph graph = g.build();
+    SchedSimConfig c;
+    c.num_threads = 1;
+    c.num_aic = 0;
+    c.num_aiv = 2;
+    c.dispatch_ns = 200;
+    c.launch_ns = 500;
+    c.spec_release_ns = 50;
+
+    SchedSimResult off = simulate(graph, c);
+    c.early_dispatch = true;
+    SchedSimResult on = simulate(graph, c);
+    EXPECT_EQ(off.spec_staged, 0u);
+    EXPECT_EQ(on.spec_staged, 7u);
+    EXPECT_LT(on.makespan_ns, off.makespan_ns);
+}
+
+TEST(SchedSimTest, SharedCoresNoSlowerThanPartitioned) {
+    // Overhead-bound load: under PARTITIONED a thread can only retire and
+    // refill its own cores, SHARED lets an idle thread pick up any of them.
+    GraphSpec g;
+    g.n = 16;
+    for (uint32_t i = 0; i < g.n; ++i) g.sub(i, CoreType::AIV, 10);
+    SchedSimGraph graph = g.build();
+    SchedSimConfig c;
+    c.num_threads = 2;
+    c.num_aic = 0;
+    c.num_aiv = 4;
+    c.dispatch_ns = 100;
+    c.complete_ns = 100;
+    c.launch_ns = 0;
+    c.core_assignment = CoreAssignment::PARTITIONED;
+    uint64_t part = simulate(graph, c).makespan_ns;
+    c.core_assignment = CoreAssignment::SHARED;
+    uint64_t shared = simulate(graph, c).makespan_ns;
+    EXPECT_LE(shared, part);
+}
+
+TEST(SchedSimTest, MillionTaskReplayIsFast) {
+    // Layered DAG: 1000 layers of 1000 tasks, each task depends on two tasks
+    // of the previous layer. Guards against accidental O(n^2) behaviour.
+    constexpr uint32_t kLayers = 1000;
+    constexpr uint32_t kWidth = 1000;
+    GraphSpec g;
+    g.n = kLayers * kWidth;
+    g.src.reserve(2 * g.n);
+    g.dst.reserve(2 * g.n);
+    g.sub_task.reserve(g.n);
+    g.sub_type.reserve(g.n);
+    g.sub_dur.reserve(g.n);
+    for (uint32_t l = 0; l < kLayers; ++l) {
+        for (uint32_t w = 0; w < kWidth; ++w) {
+            uint32_t t = l * kWidth + w;
+            g.sub(t, (w & 1) ? CoreType::AIV : CoreType::AIC, 1000 + (w % 7) * 100);
+            if (l > 0) {
+                g.edge((l - 1) * kWidth + w, t);
+                g.edge((l - 1) * kWidth + (w + 1) % kWidth, t);
+            }
+        }
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    SchedSimGraph graph = g.build();
+    SchedSimResult r = simulate(graph, SchedSimConfig{});
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    EXPECT_EQ(r.tasks, g.n);
+    EXPECT_GE(r.makespan_ns, r.critical_path_ns);
+    EXPECT_LT(secs, 20.0);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Shared-library fixture for test_compiled_orch. Built without any runtime
+// objects: everything goes through the ops table, as in production.
+
+#include <stdexcept>
+
+#include "l3_orchestration_api.h"
+
+namespace {
+
+TaskArgs one_tensor(uint64_t addr, TensorArgType tag) {
+    TaskArgs a;
+    Tensor t{};
+    t.buffer.addr = addr;
+    t.ndims = 1;
+    t.shapes[0] = 1;
+    t.dtype = DataType::UINT8;
+    a.add_tensor(t, tag);
+    return a;
+}
+
+}  // namespace
+
+// scalar 0 = task count. Independent SUB tasks on callable 0.
+SIMPLER_L3_ORCHESTRATION(fan_out_subs) {
+    (void)config;
+    for (uint64_t i = 0; i < args.scalar(0); ++i) {
+        TaskArgs a;
+        a.add_scalar(i);
+        if (!orch.submit_sub(0, a)) return 1;
+    }
+    return 0;
+}
+
+// NEXT_LEVEL producer (callable 0) writing an alloc'd intermediate, then a
+// SUB consumer (callable 1) reading it.
+SIMPLER_L3_ORCHESTRATION(produce_consume) {
+    (void)args;
+    Tensor buf = orch.alloc({16}, DataType::FLOAT32);
+    TaskArgs p;
+    p.add_tensor(buf, TensorArgType::OUTPUT_EXISTING);
+    orch.submit_next_level(0, p, config);
+    TaskArgs c;
+    c.add_tensor(buf, TensorArgType::INPUT);
+    orch.submit_sub(1, c);
+    return orch.ok() ? 0 : 1;
+}
+
+// Index 5 does not exist; the follow-up submit must be a no-op.
+SIMPLER_L3_ORCHESTRATION(bad_index) {
+    (void)args;
+    (void)config;
+    orch.submit_sub(5, one_tensor(0x10, TensorArgType::OUTPUT));
+    orch.submit_sub(0, one_tensor(0x20, TensorArgType::OUTPUT));
+    return orch.ok() ? 0 : 1;
+}
+
+SIMPLER_L3_ORCHESTRATION(throws) {
+    (void)orch;
+    (void)args;
+    (void)config;
+    throw std::runtime_error("boom");
+}
+
+SIMPLER_L3_ORCHESTRATION(returns_code) {
+    (void)orch;
+    (void)args;
+    (void)config;
+    return 3;
+}
+
+SIMPLER_L3_ORCHESTRATION(leaves_scope_open) {
+    (void)args;
+    (void)config;
+    orch.scope_begin();
+    orch.scope_begin();
+    orch.scope_end();
+    orch.submit_sub(0, one_tensor(0x30, TensorArgType::OUTPUT));
+    return 0;
+}
+
+SIMPLER_L3_ORCHESTRATION(ends_outer_scope) {
+    (void)args;
+    (void)config;
+    orch.scope_end();
+    return orch.ok() ? 0 : 1;
+}
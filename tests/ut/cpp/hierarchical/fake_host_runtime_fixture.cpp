@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Stand-in host_runtime.so for test_chip_worker_lanes. Exports the full
+// symbol set ChipWorker::init resolves; every device context is a plain
+// struct, and run_prepared records which context ran with which block_dim /
+// aicpu_thread_num and how many runs overlapped. The test reads the record
+// back through fake_host_runtime_stats().
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "pto_runtime_c_api.h"
+
+namespace {
+
+struct FakeContext {
+    int id;
+    int prepared = 0;
+};
+
+std::mutex g_mutex;
+int g_next_id = 0;
+int g_live_contexts = 0;
+int g_prepare_calls = 0;
+std::atomic<int> g_running{0};
+int g_peak_running = 0;
+int g_supports_run_lanes = 1;
+std::vector<int> g_run_ctx;
+std::vector<int> g_run_block_dim;
+std::vector<int> g_run_aicpu;
+
+}  // namespace
+
+extern "C" {
+
+struct FakeHostRuntimeStats {
+    int contexts_created;
+    int live_contexts;
+    int prepare_calls;
+    int peak_running;
+    int runs;
+};
+
+void fake_host_runtime_reset() {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_next_id = 0;
+    g_live_contexts = 0;
+    g_prepare_calls = 0;
+    g_peak_running = 0;
+    g_supports_run_lanes = 1;
+    g_run_ctx.clear();
+    g_run_block_dim.clear();
+    g_run_aicpu.clear();
+}
+
+// What supports_run_lanes() reports (1 = sim-like, 0 = onboard-like).
+void fake_host_runtime_set_supports_run_lanes(int supported) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_supports_run_lanes = supported;
+}
+
+void fake_host_runtime_stats(FakeHostRuntimeStats *out) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    out->contexts_created = g_next_id;
+    out->live_contexts = g_live_contexts;
+    out->prepare_calls = g_prepare_calls;
+    out->peak_running = g_peak_running;
+    out->runs = static_cast<int>(g_run_ctx.size());
+}
+
+// Run i: context id, block_dim, aicpu_thread_num. Returns 0 if i is out of range.
+int fake_host_runtime_run(int i, int *ctx_id, int *block_dim, int *aicpu_thread_num) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    if (i < 0 || i >= static_cast<int>(g_run_ctx.size())) return 0;
+    *ctx_id = g_run_ctx[i];
+    *block_dim = g_run_block_dim[i];
+    *aicpu_thread_num = g_run_aicpu[i];
+    return 1;
+}
+
+DeviceContextHandle create_device_context(void) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_live_contexts++;
+    return new FakeContext{g_next_id++};
+}
+
+void destroy_device_context(DeviceContextHandle ctx) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_live_contexts--;
+    delete static_cast<FakeContext *>(ctx);
+}
+
+size_t get_runtime_size(void) { return 64; }
+
+void *device_malloc_ctx(DeviceContextHandle, size_t size) { return ::operator new(size); }
+void device_free_ctx(DeviceContextHandle, void *dev_ptr) { ::operator delete(dev_ptr); }
+int copy_to_device_ctx(DeviceContextHandle, void *, const void *, size_t) { return 0; }
+int copy_from_device_ctx(DeviceContextHandle, void *, const void *, size_t) { return 0; }
+int copy_to_device_async_ctx(DeviceContextHandle, void *, const void *, size_t, uint64_t *token) {
+    *token = 1;
+    return 0;
+}
+int copy_from_device_async_ctx(DeviceContextHandle, void *, const void *, size_t, uint64_t *token) {
+    *token = 1;
+    return 0;
+}
+int wait_copy_ctx(DeviceContextHandle, uint64_t) { return 0; }
+int query_copy_ctx(DeviceContextHandle, uint64_t) { return 1; }
+
+int simpler_init(
+    DeviceContextHandle ctx, int device_id, const uint8_t *, size_t, const uint8_t *, size_t, const uint8_t *, size_t
+) {
+    return (ctx != nullptr && device_id >= 0) ? 0 : -1;
+}
+
+int finalize_device(DeviceContextHandle ctx) { return ctx != nullptr ? 0 : -1; }
+
+int prepare_callable(DeviceContextHandle ctx, int32_t, const void *) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    static_cast<FakeContext *>(ctx)->prepared++;
+    g_prepare_calls++;
+    return 0;
+}
+
+int run_prepared(
+    DeviceContextHandle ctx, RuntimeHandle, int32_t, const void *, int block_dim, int aicpu_thread_num, int, int, int,
+    int, int, const uint64_t *, const uint64_t *, const uint64_t *, const char *, PtoRunTiming *out_timing
+) {
+    auto *fake = static_cast<FakeContext *>(ctx);
+    if (fake->prepared == 0) return -1;
+    int running = g_running.fetch_add(1) + 1;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        if (running > g_peak_running) g_peak_running = running;
+        g_run_ctx.push_back(fake->id);
+        g_run_block_dim.push_back(block_dim);
+        g_run_aicpu.push_back(aicpu_thread_num);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    g_running.fetch_sub(1);
+    if (out_timing != nullptr) {
+        out_timing->host_wall_ns = 0;
+        out_timing->device_wall_ns = 0;
+    }
+    return 0;
+}
+
+int unregister_callable(DeviceContextHandle ctx, int32_t) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    static_cast<FakeContext *>(ctx)->prepared--;
+    return 0;
+}
+
+size_t get_aicpu_dlopen_count(DeviceContextHandle) { return 0; }
+size_t get_host_dlopen_count(DeviceContextHandle) { return 0; }
+int supports_run_lanes(void) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    return g_supports_run_lanes;
+}
+int configure_flight_recorder(DeviceContextHandle, int, uint64_t, const char *) { return 0; }
+int dump_flight_recorder(DeviceContextHandle, const char *) { return 0; }
+
+int ensure_acl_ready_ctx(void *, int) { return 0; }
+void *create_comm_stream_ctx(void *) { return nullptr; }
+int destroy_comm_stream_ctx(void *, void *) { return 0; }
+void *comm_init(int, int, void *, const char *) { return nullptr; }
+int comm_alloc_windows(void *, size_t, uint64_t *) { return -1; }
+int comm_get_local_window_base(void *, uint64_t *) { return -1; }
+int comm_get_window_size(void *, size_t *) { return -1; }
+int comm_derive_context(void *, const uint32_t *, size_t, uint32_t, size_t, size_t, uint64_t *) { return -1; }
+int comm_alloc_domain_windows(void *, uint64_t, const uint32_t *, size_t, uint32_t, size_t, uint64_t *, uint64_t *) {
+    return -1;
+}
+int comm_release_domain_windows(void *, uint64_t, size_t, uint32_t) { return -1; }
+int comm_barrier(void *) { return -1; }
+int comm_destroy(void *) { return 0; }
+
+}  // extern "C"
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Shared-library fixture for test_native_sub. Scalar 0 is always the address
+// of a uint64_t the test owns; the callables write their result there.
+
+#include <cstdio>
+
+#include "native_sub_abi.h"
+
+SIMPLER_NATIVE_SUB(sum_scalars) {
+    (void)err;
+    (void)err_size;
+    if (args->scalar_count < 1) return 1;
+    uint64_t sum = 0;
+    for (int32_t i = 1; i < args->scalar_count; ++i) {
+        sum += args->scalars[i];
+    }
+    *reinterpret_cast<uint64_t *>(args->scalars[0]) = sum;
+    return 0;
+}
+
+SIMPLER_NATIVE_SUB(count_tensors) {
+    (void)err;
+    (void)err_size;
+    *reinterpret_cast<uint64_t *>(args->scalars[0]) = static_cast<uint64_t>(args->tensor_count);
+    return 0;
+}
+
+SIMPLER_NATIVE_SUB(fail_with_message) {
+    (void)args;
+    std::snprintf(err, err_size, "bad input");
+    return 7;
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "chip_child_loop.h"
+#include "chip_worker.h"
+#include "worker_manager.h"
+
+// The loop is driven against an uninitialized ChipWorker: every device call
+// throws "not initialized", which is enough to exercise dispatch, the digest
+// table, the hooks and the error-reporting path without a runtime.
+
+namespace {
+
+class ChipChildLoopTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        storage_.reset(new uint64_t[MAILBOX_SIZE / sizeof(uint64_t)]());
+        mbox_ = reinterpret_cast<char *>(storage_.get());
+    }
+
+    void TearDown() override {
+        if (thread_.joinable()) {
+            set_state(MailboxState::SHUTDOWN);
+            thread_.join();
+        }
+    }
+
+    void start(ChipChildLoopOptions options = {}) {
+        loop_.reset(new ChipChildLoop(worker_, mbox_, 3, options));
+    }
+
+    void spawn() {
+        thread_ = std::thread([this] {
+            loop_->run();
+        });
+    }
+
+    void set_state(MailboxState s) {
+        int32_t *ptr = reinterpret_cast<int32_t *>(mbox_ + MAILBOX_OFF_STATE);
+        __atomic_store_n(ptr, static_cast<int32_t>(s), __ATOMIC_RELEASE);
+    }
+
+    MailboxState state() const {
+        return static_cast<MailboxState>(
+            __atomic_load_n(reinterpret_cast<int32_t *>(mbox_ + MAILBOX_OFF_STATE), __ATOMIC_ACQUIRE)
+        );
+    }
+
+    // Parent side of one round trip: post `req`, wait for `done`, reset to
+    // IDLE and return the child's error code.
+    int32_t round_trip(MailboxState req, MailboxState done) {
+        set_state(req);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (state() != done) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                ADD_FAILURE() << "child did not answer";
+                return -1;
+            }
+            std::this_thread::yield();
+        }
+        int32_t code = 0;
+        std::memcpy(&code, mbox_ + MAILBOX_OFF_ERROR, sizeof(code));
+        set_state(MailboxState::IDLE);
+        return code;
+    }
+
+    int32_t send_task(uint8_t digest_byte) {
+        std::memset(mbox_ + MAILBOX_OFF_TASK_CALLABLE_HASH, digest_byte, CALLABLE_HASH_DIGEST_SIZE);
+        // Empty args blob: tensor_count = scalar_count = 0.
+        std::memset(mbox_ + MAILBOX_OFF_TASK_ARGS_BLOB, 0, TASK_ARGS_BLOB_HEADER_SIZE);
+        return round_trip(MailboxState::TASK_READY, MailboxState::TASK_DONE);
+    }
+
+    int32_t send_control(uint64_t sub_cmd) {
+        std::memcpy(mbox_ + MAILBOX_OFF_CALLABLE, &sub_cmd, sizeof(sub_cmd));
+        return round_trip(MailboxState::CONTROL_REQUEST, MailboxState::CONTROL_DONE);
+    }
+
+    std::string error_msg() const {
+        const char *p = mbox_ + MAILBOX_OFF_ERROR_MSG;
+        return std::string(p, strnlen(p, MAILBOX_ERROR_MSG_SIZE));
+    }
+
+    static ChipChildLoop::Digest digest_of(uint8_t b) {
+        ChipChildLoop::Digest d;
+        d.fill(b);
+        return d;
+    }
+
+    std::unique_ptr<uint64_t[]> storage_;
+    char *mbox_{nullptr};
+    ChipWorker worker_;
+    std::unique_ptr<ChipChildLoop> loop_;
+    std::thread thread_;
+};
+
+}  // namespace
+
+TEST_F(ChipChildLoopTest, ShutdownExitsAndIdleParks) {
+    ChipChildLoopOptions options;
+    options.spin_iters = 0;
+    options.yield_iters = 0;
+    options.max_park_us = 50;
+    start(options);
+    spawn();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    set_state(MailboxState::SHUTDOWN);
+    thread_.join();
+    EXPECT_GT(loop_->stats().parks, 0u);
+    EXPECT_EQ(loop_->stats().tasks, 0u);
+}
+
+TEST_F(ChipChildLoopTest, UnknownDigestFailsTask) {
+    start();
+    spawn();
+    EXPECT_EQ(send_task(0xab), 1);
+    const std::string msg = error_msg();
+    EXPECT_NE(msg.find("chip_process dev=3: "), std::string::npos) << msg;
+    EXPECT_NE(msg.find("sha256:abab"), std::string::npos) << msg;
+    EXPECT_NE(msg.find("not registered"), std::string::npos) << msg;
+}
+
+TEST_F(ChipChildLoopTest, LazyPrepareRunsOnceAndFailureSkipsTaskDoneHook) {
+    start();
+    int prepares = 0;
+    int done_hooks = 0;
+    loop_->bind(digest_of(0x11), 5, /*prepared=*/false);
+    loop_->set_prepare_hook([&](int32_t cid) {
+        EXPECT_EQ(cid, 5);
+        ++prepares;
+    });
+    loop_->set_task_done_hook([&]() {
+        ++done_hooks;
+        return ChipChildLoop::Outcome{0, ""};
+    });
+    spawn();
+    EXPECT_EQ(send_task(0x11), 1);
+    EXPECT_NE(error_msg().find("not initialized"), std::string::npos) << error_msg();
+    EXPECT_EQ(send_task(0x11), 1);
+    EXPECT_EQ(prepares, 1);
+    EXPECT_EQ(done_hooks, 0);
+}
+
+TEST_F(ChipChildLoopTest, FailedPrepareFailsTaskAndStaysUnprepared) {
+    start();
+    int prepares = 0;
+    loop_->bind(digest_of(0x22), 1, false);
+    loop_->set_prepare_hook([&](int32_t) {
+        ++prepares;
+        throw std::runtime_error("no such slot");
+    });
+    spawn();
+    EXPECT_EQ(send_task(0x22), 1);
+    EXPECT_NE(error_msg().find("no such slot"), std::string::npos) << error_msg();
+    EXPECT_EQ(send_task(0x22), 1);
+    EXPECT_EQ(prepares, 2);
+}
+
+TEST_F(ChipChildLoopTest, MemoryControlsAreNative) {
+    start();
+    int hook_calls = 0;
+    loop_->set_control_hook([&](uint64_t) {
+        ++hook_calls;
+        return ChipChildLoop::Outcome{0, ""};
+    });
+    spawn();
+    EXPECT_EQ(send_control(CTRL_MALLOC), 1);
+    const std::string msg = error_msg();
+    EXPECT_NE(msg.find("chip_process dev=3 ctrl=0: "), std::string::npos) << msg;
+    EXPECT_NE(msg.find("not initialized"), std::string::npos) << msg;
+    EXPECT_EQ(send_control(CTRL_COPY_FROM), 1);
+    EXPECT_EQ(send_control(CTRL_COPY_TO_ASYNC), 1);
+    EXPECT_NE(error_msg().find("ctrl=14: "), std::string::npos) << error_msg();
+    EXPECT_EQ(send_control(CTRL_COPY_QUERY), 1);
+    EXPECT_NE(error_msg().find("not initialized"), std::string::npos) << error_msg();
+    EXPECT_EQ(hook_calls, 0);
+}
+
+TEST_F(ChipChildLoopTest, OtherControlsGoToHookWhichMayRebind) {
+    start();
+    loop_->set_control_hook([&](uint64_t sub_cmd) {
+        if (sub_cmd == CTRL_REGISTER) {
+            loop_->bind(digest_of(0x33), 9, true);
+            return ChipChildLoop::Outcome{0, ""};
+        }
+        return ChipChildLoop::Outcome{1, "boom"};
+    });
+    spawn();
+    EXPECT_EQ(send_control(CTRL_REGISTER), 0);
+    EXPECT_EQ(error_msg(), "");
+    EXPECT_EQ(send_control(CTRL_COMM_INIT), 1);
+    EXPECT_EQ(error_msg(), "boom");
+    // Bound + prepared: goes straight to ChipWorker::run.
+    EXPECT_EQ(send_task(0x33), 1);
+    EXPECT_NE(error_msg().find("not initialized"), std::string::npos) << error_msg();
+    EXPECT_EQ(loop_->stats().python_controls, 2u);
+}
+
+TEST_F(ChipChildLoopTest, ControlWithoutHookIsUnknown) {
+    start();
+    spawn();
+    EXPECT_EQ(send_control(CTRL_PREPARE), 1);
+    EXPECT_NE(error_msg().find("unknown control sub-command 4"), std::string::npos) << error_msg();
+}
+
+TEST_F(ChipChildLoopTest, ErrorMessageTruncatedAndPadded) {
+    start();
+    int calls = 0;
+    loop_->set_control_hook([&](uint64_t) {
+        if (calls++ == 0) return ChipChildLoop::Outcome{1, std::string(2 * MAILBOX_ERROR_MSG_SIZE, 'x')};
+        return ChipChildLoop::Outcome{1, "short"};
+    });
+    std::memset(mbox_ + MAILBOX_OFF_ERROR_MSG, 'y', MAILBOX_ERROR_MSG_SIZE);
+    spawn();
+    EXPECT_EQ(send_control(CTRL_REGISTER), 1);
+    EXPECT_EQ(error_msg(), std::string(MAILBOX_ERROR_MSG_SIZE - 1, 'x'));
+    EXPECT_EQ(send_control(CTRL_REGISTER), 1);
+    EXPECT_EQ(error_msg(), "short");
+    EXPECT_EQ(mbox_[MAILBOX_OFF_ERROR_MSG + MAILBOX_ERROR_MSG_SIZE - 1], '\0');
+}
+
+TEST_F(ChipChildLoopTest, UnbindDropsDigest) {
+    start();
+    loop_->bind(digest_of(0x44), 2, true);
+    EXPECT_EQ(loop_->size(), 1u);
+    loop_->unbind(digest_of(0x44));
+    EXPECT_EQ(loop_->size(), 0u);
+    spawn();
+    EXPECT_EQ(send_task(0x44), 1);
+    EXPECT_NE(error_msg().find("not registered"), std::string::npos) << error_msg();
+}
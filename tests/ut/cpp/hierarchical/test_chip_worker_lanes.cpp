@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// ChipWorker run lanes, driven against fake_host_runtime_fixture: lane
+// contexts are created and torn down with the worker, callables are prepared
+// on every lane, runs take a fitting lane with its caps applied, and two runs
+// overlap when two lanes are free.
+
+#include <dlfcn.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "chip_worker.h"
+
+namespace {
+
+struct FakeHostRuntimeStats {
+    int contexts_created;
+    int live_contexts;
+    int prepare_calls;
+    int peak_running;
+    int runs;
+};
+
+struct RunRecord {
+    int ctx_id;
+    int block_dim;
+    int aicpu_thread_num;
+};
+
+class ChipWorkerLanesTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Hold our own reference so the fixture's counters survive the
+        // worker's dlclose in finalize().
+        lib_ = dlopen(FAKE_HOST_RUNTIME_PATH, RTLD_NOW | RTLD_LOCAL);
+        ASSERT_NE(lib_, nullptr) << dlerror();
+        reset_ = reinterpret_cast<void (*)()>(dlsym(lib_, "fake_host_runtime_reset"));
+        stats_ = reinterpret_cast<void (*)(FakeHostRuntimeStats *)>(dlsym(lib_, "fake_host_runtime_stats"));
+        run_ = reinterpret_cast<int (*)(int, int *, int *, int *)>(dlsym(lib_, "fake_host_runtime_run"));
+        set_supports_run_lanes_ =
+            reinterpret_cast<void (*)(int)>(dlsym(lib_, "fake_host_runtime_set_supports_run_lanes"));
+        ASSERT_TRUE(reset_ && stats_ && run_ && set_supports_run_lanes_);
+        reset_();
+
+        char path[] = "/tmp/chip_worker_lanes_binXXXXXX";
+        int fd = mkstemp(path);
+        ASSERT_GE(fd, 0);
+        ASSERT_EQ(write(fd, "bin", 3), 3);
+        close(fd);
+        bin_path_ = path;
+
+        worker_.init(FAKE_HOST_RUNTIME_PATH, bin_path_, bin_path_, "", 0);
+    }
+
+    void TearDown() override {
+        worker_.finalize();
+        if (!bin_path_.empty()) std::remove(bin_path_.c_str());
+        if (lib_ != nullptr) dlclose(lib_);
+    }
+
+    FakeHostRuntimeStats stats() {
+        FakeHostRuntimeStats s{};
+        stats_(&s);
+        return s;
+    }
+
+    RunRecord run_record(int i) {
+        RunRecord r{-1, -1, -1};
+        run_(i, &r.ctx_id, &r.block_dim, &r.aicpu_thread_num);
+        return r;
+    }
+
+    RunTiming run_once(int block_dim, int aicpu_thread_num = 3) {
+        CallConfig config;
+        config.block_dim = block_dim;
+        config.aicpu_thread_num = aicpu_thread_num;
+        return worker_.run(0, &args_, config);
+    }
+
+    void *lib_ = nullptr;
+    void (*reset_)() = nullptr;
+    void (*stats_)(FakeHostRuntimeStats *) = nullptr;
+    int (*run_)(int, int *, int *, int *) = nullptr;
+    void (*set_supports_run_lanes_)(int) = nullptr;
+    std::string bin_path_;
+    ChipWorker worker_;
+    ChipStorageTaskArgs args_{};
+    char callable_[8] = {};
+};
+
+}  // namespace
+
+TEST_F(ChipWorkerLanesTest, WithoutLanesRunsOnPrimaryContextUnchanged) {
+    worker_.prepare_callable(0, callable_);
+    run_once(0);
+    EXPECT_EQ(worker_.run_lane_count(), 0U);
+    RunRecord r = run_record(0);
+    EXPECT_EQ(r.ctx_id, 0);
+    EXPECT_EQ(r.block_dim, 0);  // auto stays for the runner to resolve
+    EXPECT_EQ(r.aicpu_thread_num, 3);
+}
+
+TEST_F(ChipWorkerLanesTest, LanesOwnContextsAndPrepareOnEach) {
+    worker_.configure_run_lanes({8, 16, 4}, {1, 2, 1});
+    EXPECT_EQ(worker_.run_lane_count(), 3U);
+    EXPECT_EQ(stats().contexts_created, 3);
+    EXPECT_EQ(stats().live_contexts, 3);
+
+    worker_.prepare_callable(0, callable_);
+    EXPECT_EQ(stats().prepare_calls, 3);
+
+    worker_.finalize();
+    EXPECT_EQ(stats().live_contexts, 0);
+}
+
+TEST_F(ChipWorkerLanesTest, RunTakesSmallestFittingLaneWithItsCaps) {
+    worker_.configure_run_lanes({8, 16}, {1, 2});
+    worker_.prepare_callable(0, callable_);
+
+    run_once(0);  // auto -> smallest lane, its full block_dim
+    run_once(12);
+    run_once(16, 1);
+
+    RunRecord auto_run = run_record(0);
+    EXPECT_EQ(auto_run.ctx_id, 0);
+    EXPECT_EQ(auto_run.block_dim, 8);
+    EXPECT_EQ(auto_run.aicpu_thread_num, 1);
+
+    RunRecord explicit_run = run_record(1);
+    EXPECT_EQ(explicit_run.ctx_id, 1);
+    EXPECT_EQ(explicit_run.block_dim, 12);
+    EXPECT_EQ(explicit_run.aicpu_thread_num, 2);
+
+    RunRecord fewer_threads = run_record(2);
+    EXPECT_EQ(fewer_threads.ctx_id, 1);
+    EXPECT_EQ(fewer_threads.aicpu_thread_num, 1);
+}
+
+TEST_F(ChipWorkerLanesTest, ConcurrentRunsUseSeparateLanes) {
+    worker_.configure_run_lanes({8, 8}, {2, 2});
+    worker_.prepare_callable(0, callable_);
+
+    std::thread a([this]() {
+        run_once(0);
+    });
+    std::thread b([this]() {
+        run_once(0);
+    });
+    a.join();
+    b.join();
+
+    EXPECT_EQ(stats().peak_running, 2);
+    std::set<int> contexts = {run_record(0).ctx_id, run_record(1).ctx_id};
+    EXPECT_EQ(contexts, (std::set<int>{0, 1}));
+}
+
+TEST_F(ChipWorkerLanesTest, RunsQueueWhenLanesAreBusy) {
+    worker_.configure_run_lanes({4, 16}, {1, 1});
+    worker_.prepare_callable(0, callable_);
+
+    // Both need the 16-wide lane, so they serialize on it.
+    std::thread a([this]() {
+        run_once(16);
+    });
+    std::thread b([this]() {
+        run_once(10);
+    });
+    a.join();
+    b.join();
+
+    EXPECT_EQ(stats().peak_running, 1);
+    EXPECT_EQ(run_record(0).ctx_id, 1);
+    EXPECT_EQ(run_record(1).ctx_id, 1);
+}
+
+TEST_F(ChipWorkerLanesTest, OversizedBlockDimThrows) {
+    worker_.configure_run_lanes({8, 16}, {1, 1});
+    worker_.prepare_callable(0, callable_);
+    EXPECT_THROW(run_once(17), std::runtime_error);
+    run_once(16);  // the lane was not left busy
+    EXPECT_EQ(stats().runs, 1);
+}
+
+TEST_F(ChipWorkerLanesTest, ConfigureRejectsBadInput) {
+    EXPECT_THROW(worker_.configure_run_lanes({}, {}), std::runtime_error);
+    EXPECT_THROW(worker_.configure_run_lanes({8, 8}, {1}), std::runtime_error);
+    EXPECT_THROW(worker_.configure_run_lanes({8, 0}, {1, 1}), std::runtime_error);
+    EXPECT_THROW(worker_.configure_run_lanes({8}, {0}), std::runtime_error);
+    EXPECT_EQ(stats().contexts_created, 1);
+
+    worker_.configure_run_lanes({8, 8}, {1, 1});
+    EXPECT_THROW(worker_.configure_run_lanes({8, 8}, {1, 1}), std::runtime_error);
+}
+
+TEST_F(ChipWorkerLanesTest, ConfigureAfterPrepareThrows) {
+    worker_.prepare_callable(0, callable_);
+    EXPECT_THROW(worker_.configure_run_lanes({8, 8}, {1, 1}), std::runtime_error);
+    worker_.unregister_callable(0);
+    worker_.configure_run_lanes({8, 8}, {1, 1});
+    EXPECT_EQ(worker_.run_lane_count(), 2U);
+}
+
+TEST_F(ChipWorkerLanesTest, RuntimeWithoutLaneSupportRejectsLanes) {
+    // Onboard: every context on a device shares one AICPU executor.
+    set_supports_run_lanes_(0);
+    EXPECT_THROW(worker_.configure_run_lanes({8, 8}, {1, 1}), std::runtime_error);
+    EXPECT_EQ(worker_.run_lane_count(), 0U);
+    EXPECT_EQ(stats().contexts_created, 1);
+
+    worker_.prepare_callable(0, callable_);
+    run_once(0);  // single-lane mode is unaffected
+    EXPECT_EQ(run_record(0).ctx_id, 0);
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "call_config.h"
+#include "compiled_orch.h"
+#include "orchestrator.h"
+#include "ring.h"
+#include "scope.h"
+#include "task_args.h"
+#include "tensormap.h"
+#include "types.h"
+
+// The entries live in a real shared library (compiled_orch_fixture.cpp) that
+// links no runtime objects, so every call provably goes through the ops table.
+
+namespace {
+
+const std::string kFixture = COMPILED_ORCH_FIXTURE_PATH;
+
+struct CompiledOrchTest : public ::testing::Test {
+    TensorMap tm;
+    Ring allocator;
+    Scope scope;
+    ReadyQueue rq_next_level;
+    ReadyQueue rq_sub;
+    Orchestrator orch;
+    CallConfig cfg;
+    TaskArgs no_args;
+
+    void SetUp() override {
+        allocator.init(/*heap_bytes=*/1ULL << 20);
+        orch.init(&tm, &allocator, &scope, &rq_next_level, &rq_sub);
+        orch.scope_begin();  // the outer scope Worker.run opens
+    }
+
+    void TearDown() override { allocator.shutdown(); }
+
+    TaskSlotState &S(TaskSlot id) { return *allocator.slot_state(id); }
+
+    static CompiledOrchCallable C(uint8_t seed, TargetNamespace ns) {
+        CompiledOrchCallable c;
+        c.identity.digest.fill(seed);
+        c.identity.target_namespace = ns;
+        c.identity.kind = ns == TargetNamespace::LOCAL_CHIP ? CallableKind::CHIP_CALLABLE :
+                                                              CallableKind::PYTHON_SERIALIZED;
+        return c;
+    }
+
+    std::vector<TaskSlot> pop_all(ReadyQueue &q) {
+        std::vector<TaskSlot> out;
+        TaskSlot s;
+        while (q.try_pop(s))
+            out.push_back(s);
+        return out;
+    }
+
+    std::string run_error(const char *symbol, const std::vector<CompiledOrchCallable> &callables) {
+        CompiledOrchFunction fn(kFixture, symbol);
+        try {
+            fn.run(orch, no_args, cfg, callables);
+        } catch (const std::runtime_error &e) {
+            return e.what();
+        }
+        return "";
+    }
+};
+
+}  // namespace
+
+TEST_F(CompiledOrchTest, SubmitsThroughOpsTable) {
+    CompiledOrchFunction fn(kFixture, "fan_out_subs");
+    EXPECT_EQ(fn.symbol(), "fan_out_subs");
+    TaskArgs args;
+    args.add_scalar(uint64_t{5});
+    fn.run(orch, args, cfg, {C(0x11, TargetNamespace::LOCAL_PYTHON)});
+
+    std::vector<TaskSlot> ready = pop_all(rq_sub);
+    ASSERT_EQ(ready.size(), 5u);
+    for (size_t i = 0; i < ready.size(); ++i) {
+        const TaskSlotState &s = S(ready[i]);
+        EXPECT_EQ(s.worker_type, WorkerType::SUB);
+        EXPECT_EQ(s.callable.digest[0], 0x11);
+        EXPECT_EQ(s.task_args.scalar(0), i);
+    }
+    EXPECT_TRUE(pop_all(rq_next_level).empty());
+}
+
+TEST_F(CompiledOrchTest, AllocAndDependenciesMatchPythonSubmits) {
+    CompiledOrchFunction fn(kFixture, "produce_consume");
+    fn.run(orch, no_args, cfg, {C(0x21, TargetNamespace::LOCAL_CHIP), C(0x22, TargetNamespace::LOCAL_PYTHON)});
+
+    std::vector<TaskSlot> producers = pop_all(rq_next_level);
+    ASSERT_EQ(producers.size(), 1u);
+    EXPECT_EQ(S(producers[0]).callable.digest[0], 0x21);
+    EXPECT_NE(S(producers[0]).task_args.tensor(0).buffer.addr, 0u);
+
+    // The SUB consumer waits on the producer (and on alloc's synthetic slot
+    // through it), so nothing is ready on the sub queue yet.
+    EXPECT_TRUE(pop_all(rq_sub).empty());
+}
+
+TEST_F(CompiledOrchTest, ErrorsAreStickyAndReported) {
+    const std::string err = run_error("bad_index", {C(0x31, TargetNamespace::LOCAL_PYTHON)});
+    EXPECT_NE(err.find("bad_index: submit_sub: callable index 5 out of range (1 callables"), std::string::npos)
+        << err;
+    // The second submit after the failure was a no-op.
+    EXPECT_TRUE(pop_all(rq_sub).empty());
+}
+
+TEST_F(CompiledOrchTest, SubRequiresPythonNamespace) {
+    TaskArgs args;
+    args.add_scalar(uint64_t{1});
+    CompiledOrchFunction fn(kFixture, "fan_out_subs");
+    try {
+        fn.run(orch, args, cfg, {C(0x41, TargetNamespace::LOCAL_CHIP)});
+        FAIL() << "expected throw";
+    } catch (const std::runtime_error &e) {
+        EXPECT_NE(std::string(e.what()).find("callable index 0 is not a SUB callable"), std::string::npos)
+            << e.what();
+    }
+    EXPECT_TRUE(pop_all(rq_sub).empty());
+}
+
+TEST_F(CompiledOrchTest, ExceptionsAndReturnCodesBecomeErrors) {
+    EXPECT_EQ(run_error("throws", {}), "throws: boom");
+    EXPECT_EQ(run_error("returns_code", {}), "returns_code returned 3");
+}
+
+TEST_F(CompiledOrchTest, HostBalancesScopesButKeepsOuterScope) {
+    ASSERT_EQ(scope.depth(), 1);
+    CompiledOrchFunction fn(kFixture, "leaves_scope_open");
+    fn.run(orch, no_args, cfg, {C(0x51, TargetNamespace::LOCAL_PYTHON)});
+    EXPECT_EQ(scope.depth(), 1);
+    EXPECT_EQ(pop_all(rq_sub).size(), 1u);
+
+    const std::string err = run_error("ends_outer_scope", {});
+    EXPECT_NE(err.find("scope_end without a matching scope_begin"), std::string::npos) << err;
+    EXPECT_EQ(scope.depth(), 1);
+}
+
+TEST(CompiledOrchFunction, LoadErrorsAreReported) {
+    try {
+        CompiledOrchFunction fn(kFixture, "no_such_entry");
+        FAIL() << "expected throw";
+    } catch (const std::runtime_error &e) {
+        EXPECT_NE(std::string(e.what()).find("symbol 'no_such_entry' not found"), std::string::npos) << e.what();
+    }
+    EXPECT_THROW(CompiledOrchFunction("/nonexistent/liborch.so", "fan_out_subs"), std::runtime_error);
+    EXPECT_THROW(CompiledOrchFunction(kFixture, ""), std::invalid_argument);
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "native_sub.h"
+#include "ring.h"
+#include "worker_manager.h"
+
+// The callables live in a real shared library (native_sub_fixture.cpp) so
+// the dlopen / dlsym path is exercised exactly as in production.
+
+namespace {
+
+const std::string kFixture = NATIVE_SUB_FIXTURE_PATH;
+
+std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> digest_of(uint8_t b) {
+    std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> d;
+    d.fill(b);
+    return d;
+}
+
+uint64_t addr_of(uint64_t *p) { return reinterpret_cast<uint64_t>(p); }
+
+// Stage a payload in POSIX shm the way broadcast_control_all does.
+class StagedShm {
+public:
+    explicit StagedShm(const std::string &payload) :
+        name_("simpler-ut-native-sub-" + std::to_string(getpid())),
+        size_(payload.size()) {
+        const std::string full = "/" + name_;
+        int fd = shm_open(full.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0600);
+        if (fd < 0) throw std::runtime_error("shm_open failed");
+        if (ftruncate(fd, static_cast<off_t>(size_)) != 0) {
+            ::close(fd);
+            throw std::runtime_error("ftruncate failed");
+        }
+        void *addr = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) throw std::runtime_error("mmap failed");
+        std::memcpy(addr, payload.data(), size_);
+        munmap(addr, size_);
+    }
+    ~StagedShm() { shm_unlink(("/" + name_).c_str()); }
+
+    const char *name() const { return name_.c_str(); }
+    size_t size() const { return size_; }
+
+private:
+    std::string name_;
+    size_t size_;
+};
+
+std::string payload(const std::string &path, const std::string &symbol) {
+    std::string out = path;
+    out.push_back('\0');
+    out += symbol;
+    return out;
+}
+
+class NativeSubEndpointTest : public ::testing::Test {
+protected:
+    void SetUp() override { ring_.init(/*heap_bytes=*/1ULL << 20); }
+
+    // One slot carrying `digest` and scalars (out_addr, extra...).
+    TaskSlot make_slot(uint8_t digest_byte, std::initializer_list<uint64_t> scalars) {
+        AllocResult r = ring_.alloc();
+        TaskSlotState &s = *ring_.slot_state(r.slot);
+        s.callable.digest = digest_of(digest_byte);
+        s.callable.kind = CallableKind::NATIVE_SO;
+        s.callable.target_namespace = TargetNamespace::LOCAL_PYTHON;
+        for (uint64_t v : scalars)
+            s.task_args.add_scalar(v);
+        return r.slot;
+    }
+
+    WorkerCompletion run(NativeSubEndpoint &ep, TaskSlot slot) {
+        WorkerDispatch d;
+        d.task_slot = slot;
+        return ep.run(&ring_, d);
+    }
+
+    Ring ring_;
+};
+
+}  // namespace
+
+TEST(NativeSubFunction, RunsSymbolOverView) {
+    NativeSubFunction fn(kFixture, "sum_scalars");
+    uint64_t out = 0;
+    TaskArgs args;
+    args.add_scalar(addr_of(&out));
+    args.add_scalar(40);
+    args.add_scalar(2);
+    fn.run(make_view(args));
+    EXPECT_EQ(out, 42u);
+    EXPECT_EQ(fn.symbol(), "sum_scalars");
+}
+
+TEST(NativeSubFunction, NonZeroReturnCarriesMessage) {
+    NativeSubFunction fn(kFixture, "fail_with_message");
+    TaskArgs args;
+    try {
+        fn.run(make_view(args));
+        FAIL() << "expected throw";
+    } catch (const std::runtime_error &e) {
+        EXPECT_STREQ(e.what(), "fail_with_message returned 7: bad input");
+    }
+}
+
+TEST(NativeSubFunction, LoadErrorsAreReported) {
+    try {
+        NativeSubFunction fn(kFixture, "no_such_symbol");
+        FAIL() << "expected throw";
+    } catch (const std::runtime_error &e) {
+        EXPECT_NE(std::string(e.what()).find("symbol 'no_such_symbol' not found"), std::string::npos) << e.what();
+    }
+    try {
+        NativeSubFunction fn("/nonexistent/libnope.so", "sum_scalars");
+        FAIL() << "expected throw";
+    } catch (const std::runtime_error &e) {
+        EXPECT_NE(std::string(e.what()).find("dlopen(/nonexistent/libnope.so)"), std::string::npos) << e.what();
+    }
+    EXPECT_THROW(NativeSubFunction("", "sum_scalars"), std::invalid_argument);
+}
+
+TEST(NativeSubPayload, SplitsPathAndSymbol) {
+    std::string path;
+    std::string symbol;
+    const std::string p = payload("/a/lib.so", "fn");
+    parse_native_sub_payload(p.data(), p.size(), path, symbol);
+    EXPECT_EQ(path, "/a/lib.so");
+    EXPECT_EQ(symbol, "fn");
+
+    const std::string no_sep = "/a/lib.so";
+    EXPECT_THROW(parse_native_sub_payload(no_sep.data(), no_sep.size(), path, symbol), std::runtime_error);
+    const std::string no_symbol = payload("/a/lib.so", "");
+    EXPECT_THROW(parse_native_sub_payload(no_symbol.data(), no_symbol.size(), path, symbol), std::runtime_error);
+}
+
+TEST_F(NativeSubEndpointTest, CapsAreInProcess) {
+    NativeSubEndpoint ep(3);
+    EXPECT_EQ(ep.caps().kind, WorkerEndpointKind::IN_PROCESS);
+    EXPECT_EQ(ep.caps().worker_id, 3);
+    EXPECT_EQ(ep.caps().transport, "in-process");
+    EXPECT_FALSE(ep.caps().remote);
+}
+
+TEST_F(NativeSubEndpointTest, RunsOnSlotArgsWithoutCopy) {
+    NativeSubPreload pre;
+    pre.digest = digest_of(0x11);
+    pre.path = kFixture;
+    pre.symbol = "sum_scalars";
+    NativeSubEndpoint ep(0, {pre});
+    uint64_t out = 0;
+    WorkerCompletion c = run(ep, make_slot(0x11, {addr_of(&out), 5, 6, 7}));
+    EXPECT_EQ(c.outcome, EndpointOutcome::SUCCESS) << c.error_message;
+    EXPECT_EQ(out, 18u);
+}
+
+TEST_F(NativeSubEndpointTest, UnknownDigestAndCalleeFailureAreTaskFailures) {
+    NativeSubEndpoint ep(1);
+    WorkerCompletion c = run(ep, make_slot(0x22, {}));
+    EXPECT_EQ(c.outcome, EndpointOutcome::TASK_FAILURE);
+    EXPECT_NE(c.error_message.find("sha256:2222"), std::string::npos) << c.error_message;
+    EXPECT_NE(c.error_message.find("not a registered NATIVE_SO callable"), std::string::npos) << c.error_message;
+
+    ep.install(digest_of(0x22).data(), kFixture, "fail_with_message");
+    c = run(ep, make_slot(0x22, {}));
+    EXPECT_EQ(c.outcome, EndpointOutcome::TASK_FAILURE);
+    EXPECT_NE(c.error_message.find("worker_id=1: fail_with_message returned 7: bad input"), std::string::npos)
+        << c.error_message;
+}
+
+TEST_F(NativeSubEndpointTest, InstallIsRefcounted) {
+    NativeSubEndpoint ep(0);
+    const auto d = digest_of(0x33);
+    ep.install(d.data(), kFixture, "count_tensors");
+    ep.install(d.data(), kFixture, "count_tensors");
+    EXPECT_EQ(ep.size(), 1u);
+    ep.remove(d.data());
+    EXPECT_EQ(ep.size(), 1u);
+    ep.remove(d.data());
+    EXPECT_EQ(ep.size(), 0u);
+    ep.remove(d.data());  // unknown digest: no-op
+    EXPECT_THROW(ep.install(d.data(), kFixture, "no_such_symbol"), std::runtime_error);
+    EXPECT_EQ(ep.size(), 0u);
+}
+
+TEST_F(NativeSubEndpointTest, ControlRegisterAndUnregister) {
+    NativeSubEndpoint ep(0);
+    const auto d = digest_of(0x44);
+    StagedShm shm(payload(kFixture, "sum_scalars"));
+    ep.control_generic(CTRL_NATIVE_SO_REGISTER, shm.name(), shm.size(), -1.0, d.data());
+    EXPECT_EQ(ep.size(), 1u);
+
+    uint64_t out = 0;
+    WorkerCompletion c = run(ep, make_slot(0x44, {addr_of(&out), 1, 2}));
+    EXPECT_EQ(c.outcome, EndpointOutcome::SUCCESS) << c.error_message;
+    EXPECT_EQ(out, 3u);
+
+    ep.control_generic(CTRL_PY_UNREGISTER, nullptr, 0, -1.0, d.data());
+    EXPECT_EQ(ep.size(), 0u);
+
+    try {
+        ep.control_generic(CTRL_PY_REGISTER, shm.name(), shm.size(), -1.0, d.data());
+        FAIL() << "expected throw";
+    } catch (const std::runtime_error &e) {
+        EXPECT_NE(std::string(e.what()).find("only run NATIVE_SO callables"), std::string::npos) << e.what();
+    }
+    EXPECT_THROW(ep.control_malloc(64), std::runtime_error);
+}
+
+TEST(NativeSubManager, EndpointIdsFollowMailboxSubs) {
+    WorkerManager manager;
+    std::unique_ptr<uint64_t[]> mailbox(new uint64_t[MAILBOX_SIZE / sizeof(uint64_t)]());
+    manager.add_sub(mailbox.get());
+    EXPECT_EQ(manager.sub_count(), 1);
+    EXPECT_THROW(manager.add_sub_endpoint(std::make_unique<NativeSubEndpoint>(0)), std::invalid_argument);
+    manager.add_sub_endpoint(std::make_unique<NativeSubEndpoint>(1));
+    EXPECT_EQ(manager.sub_count(), 2);
+    EXPECT_THROW(manager.add_sub(mailbox.get()), std::runtime_error);
+}
@@ -21,8 +21,10 @@
 #include <csignal>
 #include <chrono>
 #include <cstring>
+#include <future>
 #include <memory>
 #include <stdexcept>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -83,7 +85,9 @@ malloc_result(int32_t worker_id, uint64_t buffer_id, uint64_t generation, int32_
     return out;
 }
 
-uint16_t start_closing_server(std::thread &server_thread) {
+// Accepts one connection and resets it once `connected` is ready, so the RST
+// cannot race the client's own connect().
+uint16_t start_closing_server(std::thread &server_thread, std::shared_future<void> connected) {
     int listener = ::socket(AF_INET, SOCK_STREAM, 0);
     if (listener < 0) throw std::runtime_error(std::string("socket failed: ") + std::strerror(errno));
     int one = 1;
@@ -109,8 +113,9 @@ uint16_t start_closing_server(std::thread &server_thread) {
         ::close(listener);
         throw std::runtime_error(std::string("getsockname failed: ") + std::strerror(err));
     }
-    server_thread = std::thread([listener]() {
+    server_thread = std::thread([listener, connected]() {
         int fd = ::accept(listener, nullptr, nullptr);
+        connected.wait();
         if (fd >= 0) {
             struct linger rst{};
             rst.l_onoff = 1;
@@ -128,6 +133,9 @@ public:
     int32_t next_error_code{0};
     std::string next_error_message;
     std::vector<uint8_t> next_control_result_bytes;
+    std::string next_prepare_error;  // one-shot error reply to the next PREPARE_REGISTER_CALLABLE
+    int32_t next_prepare_error_code{remote_l3::CONTROL_ERROR};
+    std::vector<remote_l3::RemoteChipCallablePayload> prepared_chip_payloads;
     std::vector<uint8_t> last_frame;
     remote_l3::ControlName last_control_name{remote_l3::ControlName::PREPARE_CALLABLE};
     remote_l3::RemoteRegistryTarget last_target_registry{remote_l3::RemoteRegistryTarget::REMOTE_TASK_DISPATCHER};
@@ -163,6 +171,21 @@ public:
             payload.control_name = control.control_name;
             payload.control_version = control.control_version;
             payload.result_bytes = next_control_result_bytes;
+            if (control.control_name == remote_l3::ControlName::PREPARE_REGISTER_CALLABLE &&
+                last_callable_kind == CallableKind::CHIP_CALLABLE) {
+                auto command = remote_l3::decode_register_callable_command(
+                    control.command_bytes.data(), control.command_bytes.size()
+                );
+                prepared_chip_payloads.push_back(
+                    remote_l3::decode_remote_chip_callable_payload(command.payload.data(), command.payload.size())
+                );
+                if (!next_prepare_error.empty()) {
+                    payload.error_code = next_prepare_error_code;
+                    payload.error_message = next_prepare_error;
+                    payload.result_bytes.clear();
+                    next_prepare_error.clear();
+                }
+            }
             remote_l3::FrameHeader header;
             header.frame_type = remote_l3::FrameType::CONTROL_REPLY;
             header.session_id = submitted.header.session_id;
@@ -201,6 +224,15 @@ TaskSlot make_slot(Ring &ring, const TaskArgs &args) {
     return ar.slot;
 }
 
+std::vector<uint8_t> inline_chip_payload() {
+    remote_l3::RemoteChipCallablePayload payload;
+    payload.descriptor_bytes = {1, 2, 3};
+    payload.inline_blob = {9, 9, 9, 9};
+    payload.blob_size = payload.inline_blob.size();
+    payload.blob_sha256.fill(0x42);
+    return remote_l3::encode_remote_chip_callable_payload(payload);
+}
+
 TaskArgs scalar_args() {
     TaskArgs args;
     args.add_scalar(7);
@@ -272,7 +304,7 @@ TEST(RemoteEndpoint, RemoteRegisterPrepareCarriesRequestedRegistryTarget) {
     RemoteL3Endpoint endpoint(3, 99, "fake", std::unique_ptr<RemoteL3Transport>(transport));
     std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> digest{};
     digest.fill(0x7B);
-    std::vector<uint8_t> payload{'x'};
+    std::vector<uint8_t> payload = inline_chip_payload();
 
     endpoint.control_remote_prepare_register(
         remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data(), payload.data(),
@@ -284,6 +316,95 @@ TEST(RemoteEndpoint, RemoteRegisterPrepareCarriesRequestedRegistryTarget) {
     EXPECT_EQ(transport->last_callable_kind, CallableKind::CHIP_CALLABLE);
 }
 
+TEST(RemoteEndpoint, ChipRegisterSendsHeldBlobOnceCommittedAndFallsBackInline) {
+    auto *transport = new FakeRemoteTransport();
+    RemoteL3Endpoint endpoint(
+        3, 99, "fake", std::unique_ptr<RemoteL3Transport>(transport), remote_l3::HELLO_FEATURE_HELD_CHIP_BLOB
+    );
+    std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> digest{};
+    digest.fill(0x7B);
+    std::vector<uint8_t> payload = inline_chip_payload();
+    auto target = remote_l3::RemoteRegistryTarget::INNER_L3_WORKER;
+    auto prepare = [&]() {
+        endpoint.control_remote_prepare_register(
+            target, CallableKind::CHIP_CALLABLE, digest.data(), payload.data(), payload.size()
+        );
+    };
+    auto locations = [&]() {
+        std::vector<remote_l3::ChipCallableBlobLocation> out;
+        for (const auto &p : transport->prepared_chip_payloads)
+            out.push_back(p.blob_location);
+        transport->prepared_chip_payloads.clear();
+        return out;
+    };
+    using Loc = remote_l3::ChipCallableBlobLocation;
+
+    // Prepared but never committed: the session may not hold it yet.
+    prepare();
+    endpoint.control_remote_abort_register(target, CallableKind::CHIP_CALLABLE, digest.data());
+    prepare();
+    EXPECT_EQ(locations(), (std::vector<Loc>{Loc::INLINE_BLOB, Loc::INLINE_BLOB}));
+
+    endpoint.control_remote_commit_register(target, CallableKind::CHIP_CALLABLE, digest.data());
+    prepare();
+    ASSERT_EQ(transport->prepared_chip_payloads.size(), 1u);
+    const auto &held = transport->prepared_chip_payloads[0];
+    EXPECT_EQ(held.blob_location, Loc::HELD_BLOB);
+    EXPECT_TRUE(held.inline_blob.empty());
+    EXPECT_EQ(held.blob_size, 4u);
+    EXPECT_EQ(held.blob_sha256[0], 0x42);
+    EXPECT_EQ(held.descriptor_bytes, (std::vector<uint8_t>{1, 2, 3}));
+    transport->prepared_chip_payloads.clear();
+
+    // Held is per registry: the same digest committed on INNER_L3_WORKER is
+    // still shipped to the REMOTE_TASK_DISPATCHER registry.
+    endpoint.control_remote_prepare_register(
+        remote_l3::RemoteRegistryTarget::REMOTE_TASK_DISPATCHER, CallableKind::CHIP_CALLABLE, digest.data(),
+        payload.data(), payload.size()
+    );
+    EXPECT_EQ(locations(), (std::vector<Loc>{Loc::INLINE_BLOB}));
+
+    // A session that lost the digest asks for the bytes; the retry is inline
+    // and the endpoint stops announcing HELD_BLOB until the next commit.
+    transport->next_prepare_error = "held digest is gone";
+    transport->next_prepare_error_code = remote_l3::CONTROL_ERROR_BLOB_NOT_HELD;
+    prepare();
+    EXPECT_EQ(locations(), (std::vector<Loc>{Loc::HELD_BLOB, Loc::INLINE_BLOB}));
+    prepare();
+    EXPECT_EQ(locations(), (std::vector<Loc>{Loc::INLINE_BLOB}));
+
+    // Any other HELD_BLOB rejection is the caller's error, not a retry, even
+    // if its text mentions a missing blob.
+    endpoint.control_remote_commit_register(target, CallableKind::CHIP_CALLABLE, digest.data());
+    transport->next_prepare_error = "CHIP_CALLABLE HELD_BLOB does not hold up: blob mismatch";
+    transport->next_prepare_error_code = remote_l3::CONTROL_ERROR;
+    EXPECT_THROW(prepare(), std::runtime_error);
+    EXPECT_EQ(locations(), (std::vector<Loc>{Loc::HELD_BLOB}));
+
+    endpoint.control_remote_unregister(target, CallableKind::CHIP_CALLABLE, digest.data());
+    prepare();
+    EXPECT_EQ(locations(), (std::vector<Loc>{Loc::INLINE_BLOB}));
+}
+
+TEST(RemoteEndpoint, ChipRegisterStaysInlineWhenSessionDidNotAdvertiseHeldBlob) {
+    auto *transport = new FakeRemoteTransport();
+    RemoteL3Endpoint endpoint(3, 99, "fake", std::unique_ptr<RemoteL3Transport>(transport));
+    std::array<uint8_t, CALLABLE_HASH_DIGEST_SIZE> digest{};
+    digest.fill(0x7B);
+    std::vector<uint8_t> payload = inline_chip_payload();
+    auto target = remote_l3::RemoteRegistryTarget::INNER_L3_WORKER;
+
+    for (int i = 0; i < 2; ++i) {
+        endpoint.control_remote_prepare_register(
+            target, CallableKind::CHIP_CALLABLE, digest.data(), payload.data(), payload.size()
+        );
+        endpoint.control_remote_commit_register(target, CallableKind::CHIP_CALLABLE, digest.data());
+    }
+    ASSERT_EQ(transport->prepared_chip_payloads.size(), 2u);
+    for (const auto &p : transport->prepared_chip_payloads)
+        EXPECT_EQ(p.blob_location, remote_l3::ChipCallableBlobLocation::INLINE_BLOB);
+}
+
 TEST(RemoteEndpoint, RemoteMallocAcceptsValidOwnerHandle) {
     auto *transport = new FakeRemoteTransport();
     transport->next_control_result_bytes =
@@ -355,9 +476,19 @@ TEST(RemoteEndpoint, RemoteBufferControlsRejectOutOfRangeSlices) {
 
 TEST(RemoteSocketTransport, ClosedPeerWriteDoesNotRaiseSigpipe) {
     std::thread server_thread;
-    uint16_t port = start_closing_server(server_thread);
-    RemoteL3SocketTransport transport("127.0.0.1", port, "127.0.0.1", 1, 1.0);
+    std::promise<void> connected;
+    uint16_t port = start_closing_server(server_thread, connected.get_future().share());
+    std::unique_ptr<RemoteL3SocketTransport> connecting;
+    try {
+        connecting = std::make_unique<RemoteL3SocketTransport>("127.0.0.1", port, "127.0.0.1", 1, 1.0);
+    } catch (...) {
+        connected.set_value();
+        server_thread.join();
+        throw;
+    }
+    connected.set_value();
     server_thread.join();
+    RemoteL3SocketTransport &transport = *connecting;
     std::this_thread::sleep_for(std::chrono::milliseconds(50));
 
     ScopedSigpipeCounter sigpipe_counter;
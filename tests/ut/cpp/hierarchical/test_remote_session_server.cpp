@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Loopback of the C++ client (RemoteL3SocketTransport + RemoteL3Endpoint)
+// against the native RemoteL3SessionServer, hosting a ChipWorker on
+// fake_host_runtime_fixture: HELLO/health attach, shm buffer controls,
+// export/import, CHIP_CALLABLE registration and TASK dispatch, and the
+// error replies that must leave the session usable.
+
+#include <dlfcn.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chip_worker.h"
+#include "remote_endpoint.h"
+#include "remote_session_server.h"
+
+namespace {
+
+constexpr uint64_t kSession = 77;
+constexpr int32_t kWorker = 3;
+
+struct FakeHostRuntimeStats {
+    int contexts_created;
+    int live_contexts;
+    int prepare_calls;
+    int peak_running;
+    int runs;
+};
+
+// SHA-256("abc"), FIPS 180-4 appendix B.1.
+constexpr std::array<uint8_t, 32> kAbcSha256 = {
+    0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+    0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+};
+
+std::vector<uint8_t> chip_payload(const std::vector<uint8_t> &blob, const std::array<uint8_t, 32> &sha) {
+    remote_l3::RemoteChipCallablePayload payload;
+    payload.descriptor_bytes = {1, 2, 3};
+    payload.blob_location = remote_l3::ChipCallableBlobLocation::INLINE_BLOB;
+    payload.blob_size = blob.size();
+    payload.blob_sha256 = sha;
+    payload.inline_blob = blob;
+    return remote_l3::encode_remote_chip_callable_payload(payload);
+}
+
+std::vector<uint8_t> held_chip_payload(uint64_t blob_size, const std::array<uint8_t, 32> &sha) {
+    remote_l3::RemoteChipCallablePayload payload;
+    payload.descriptor_bytes = {1, 2, 3};
+    payload.blob_location = remote_l3::ChipCallableBlobLocation::HELD_BLOB;
+    payload.blob_size = blob_size;
+    payload.blob_sha256 = sha;
+    return remote_l3::encode_remote_chip_callable_payload(payload);
+}
+
+class RemoteSessionServerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        lib_ = dlopen(FAKE_HOST_RUNTIME_PATH, RTLD_NOW | RTLD_LOCAL);
+        ASSERT_NE(lib_, nullptr) << dlerror();
+        reset_ = reinterpret_cast<void (*)()>(dlsym(lib_, "fake_host_runtime_reset"));
+        stats_ = reinterpret_cast<void (*)(FakeHostRuntimeStats *)>(dlsym(lib_, "fake_host_runtime_stats"));
+        ASSERT_TRUE(reset_ && stats_);
+        reset_();
+
+        char path[] = "/tmp/remote_session_server_binXXXXXX";
+        int fd = mkstemp(path);
+        ASSERT_GE(fd, 0);
+        ASSERT_EQ(write(fd, "bin", 3), 3);
+        close(fd);
+        bin_path_ = path;
+        chip_.init(FAKE_HOST_RUNTIME_PATH, bin_path_, bin_path_, "", 0);
+
+        RemoteL3SessionOptions options;
+        options.session_id = kSession;
+        options.worker_id = kWorker;
+        options.accept_timeout_s = 10.0;
+        server_ = std::make_unique<RemoteL3SessionServer>(&chip_, options);
+        // A manifest-preloaded callable, bound before serving starts.
+        chip_.prepare_callable(7, "preloaded");
+        bound_digest_.fill(0x33);
+        server_->bind(bound_digest_, 7);
+        server_->listen();
+        serve_thread_ = std::thread([this]() {
+            try {
+                server_->serve();
+            } catch (const std::exception &e) {
+                serve_error_ = e.what();
+            }
+        });
+
+        auto transport = std::make_unique<RemoteL3SocketTransport>(
+            "127.0.0.1", server_->command_port(), "127.0.0.1", server_->health_port(), 10.0
+        );
+        hello_ = transport->expect_hello_ready(kSession, kWorker, "sim");
+        transport_ = transport.get();
+        endpoint_ =
+            std::make_unique<RemoteL3Endpoint>(kWorker, kSession, "sim", std::move(transport), hello_.feature_flags);
+    }
+
+    void TearDown() override {
+        if (endpoint_) endpoint_->shutdown_child();
+        if (serve_thread_.joinable()) serve_thread_.join();
+        EXPECT_EQ(serve_error_, "");
+        server_.reset();
+        chip_.finalize();
+        if (!bin_path_.empty()) std::remove(bin_path_.c_str());
+        if (lib_ != nullptr) dlclose(lib_);
+    }
+
+    FakeHostRuntimeStats stats() {
+        FakeHostRuntimeStats s{};
+        stats_(&s);
+        return s;
+    }
+
+    // TASK frames bypass the endpoint (which needs a Ring slot); sequences
+    // start well above the endpoint's command lane.
+    remote_l3::CompletionPayload run_task(const remote_l3::TaskPayloadWire &task) {
+        remote_l3::FrameHeader header;
+        header.frame_type = remote_l3::FrameType::TASK;
+        header.session_id = kSession;
+        header.worker_id = kWorker;
+        header.sequence = next_task_sequence_++;
+        transport_->submit_frame(remote_l3::encode_frame(header, remote_l3::encode_task_payload(task)));
+        auto reply =
+            remote_l3::decode_frame(transport_->wait_for_reply(remote_l3::FrameType::COMPLETION, header.sequence));
+        return remote_l3::decode_completion(reply.payload.data(), reply.payload.size(), header.sequence);
+    }
+
+    // Like run_task, for a control whose error_code the endpoint would fold
+    // into an exception.
+    remote_l3::ControlReplyPayload
+    run_raw_control(remote_l3::ControlName control_name, const std::vector<uint8_t> &command_bytes) {
+        remote_l3::ControlPayload control;
+        control.control_name = control_name;
+        control.command_bytes = command_bytes;
+        remote_l3::FrameHeader header;
+        header.frame_type = remote_l3::FrameType::CONTROL;
+        header.session_id = kSession;
+        header.worker_id = kWorker;
+        header.sequence = next_task_sequence_++;
+        transport_->submit_frame(remote_l3::encode_frame(header, remote_l3::encode_control(control)));
+        auto reply =
+            remote_l3::decode_frame(transport_->wait_for_reply(remote_l3::FrameType::CONTROL_REPLY, header.sequence));
+        return remote_l3::decode_control_reply(
+            reply.payload.data(), reply.payload.size(), header.sequence, control_name, 1
+        );
+    }
+
+    remote_l3::TaskPayloadWire buffer_task(const RemoteL3SessionServer::Digest &digest, const RemoteBufferHandle &h) {
+        remote_l3::TaskPayloadWire task;
+        task.callable_digest = digest;
+        const uint32_t shapes[1] = {static_cast<uint32_t>(h.nbytes)};
+        task.args.tensor_metadata.push_back(make_tensor_external(nullptr, shapes, 1, DataType::UINT8));
+        RemoteTensorSidecar sidecar;
+        sidecar.present = true;
+        sidecar.desc.address_space = RemoteAddressSpace::REMOTE_DEVICE;
+        sidecar.desc.owner_worker_id = kWorker;
+        sidecar.desc.buffer_id = h.buffer_id;
+        sidecar.desc.generation = h.generation;
+        sidecar.desc.nbytes = h.nbytes;
+        task.args.remote_desc.push_back(sidecar);
+        task.args.scalars.push_back(5);
+        return task;
+    }
+
+    RemoteL3SessionServer::Digest bound_digest_{};
+    void *lib_{nullptr};
+    void (*reset_)(){nullptr};
+    void (*stats_)(FakeHostRuntimeStats *){nullptr};
+    std::string bin_path_;
+    ChipWorker chip_;
+    std::unique_ptr<RemoteL3SessionServer> server_;
+    std::thread serve_thread_;
+    std::string serve_error_;
+    RemoteL3Transport *transport_{nullptr};
+    remote_l3::HelloPayload hello_;
+    std::unique_ptr<RemoteL3Endpoint> endpoint_;
+    uint64_t next_task_sequence_{1000};
+};
+
+}  // namespace
+
+TEST_F(RemoteSessionServerTest, BufferControlsRoundTripThroughSharedMemory) {
+    RemoteBufferHandle h = endpoint_->control_remote_malloc(64);
+    EXPECT_EQ(h.worker_id, kWorker);
+    EXPECT_EQ(h.buffer_id, 1u);
+    EXPECT_EQ(h.generation, 1u);
+    EXPECT_EQ(h.nbytes, 64u);
+    EXPECT_NE(h.remote_addr, 0u);
+
+    std::vector<uint8_t> src(16);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = static_cast<uint8_t>(i + 1);
+    endpoint_->control_remote_copy_to(h, 8, src.data(), src.size());
+    std::vector<uint8_t> dst(16, 0);
+    endpoint_->control_remote_copy_from(dst.data(), h, 8, dst.size());
+    EXPECT_EQ(dst, src);
+
+    endpoint_->control_remote_free(h);
+    EXPECT_THROW(endpoint_->control_remote_copy_from(dst.data(), h, 0, 4), std::runtime_error);
+    EXPECT_EQ(endpoint_->control_remote_malloc(8).buffer_id, 2u);
+}
+
+TEST_F(RemoteSessionServerTest, ExportImportMapsTheSameSegment) {
+    RemoteBufferHandle h = endpoint_->control_remote_malloc(32);
+    std::vector<uint8_t> src(32, 0x5A);
+    endpoint_->control_remote_copy_to(h, 0, src.data(), src.size());
+
+    RemoteBufferExport exp =
+        endpoint_->control_remote_export(h, 16, 16, remote_l3::REMOTE_BUFFER_ACCESS_READ_WRITE, "sim");
+    EXPECT_EQ(exp.address_space, RemoteAddressSpace::REMOTE_WINDOW);
+    EXPECT_EQ(exp.export_id, 1u);
+    EXPECT_EQ(exp.rkey_or_token, 1u);
+    EXPECT_EQ(exp.remote_addr, h.remote_addr + 16);
+    EXPECT_EQ(exp.transport_profile, "sim");
+    std::string shm_name(exp.transport_descriptor.begin(), exp.transport_descriptor.end());
+    EXPECT_EQ(shm_name.rfind("simpler_l3_", 0), 0u) << shm_name;
+
+    RemoteBufferHandle imported =
+        endpoint_->control_remote_import(kWorker, exp, remote_l3::REMOTE_BUFFER_ACCESS_READ);
+    EXPECT_EQ(imported.import_id, 1u);
+    EXPECT_EQ(imported.rkey_or_token, 1u);
+    EXPECT_EQ(imported.offset, 16u);
+    EXPECT_EQ(imported.access_flags, remote_l3::REMOTE_BUFFER_ACCESS_READ);
+    // Client and server share the process here, so the import's mapping is
+    // directly readable.
+    const auto *mapped = reinterpret_cast<const uint8_t *>(imported.remote_addr);
+    EXPECT_EQ(mapped[16], 0x5A);
+    endpoint_->control_remote_release_import(imported);
+    EXPECT_THROW(endpoint_->control_remote_release_import(imported), std::runtime_error);
+
+    EXPECT_THROW(
+        (void)endpoint_->control_remote_export(h, 0, 8, remote_l3::REMOTE_BUFFER_ACCESS_READ, "hccs"),
+        std::runtime_error
+    );
+}
+
+TEST_F(RemoteSessionServerTest, RejectedControlsLeaveTheSessionUsable) {
+    RemoteL3SessionServer::Digest digest{};
+    digest.fill(0x11);
+    try {
+        endpoint_->control_prepare(digest.data());
+        FAIL() << "PREPARE_CALLABLE of an uncommitted digest must fail";
+    } catch (const std::runtime_error &e) {
+        EXPECT_NE(std::string(e.what()).find("not committed"), std::string::npos) << e.what();
+        EXPECT_NE(std::string(e.what()).find("remote worker_id=3 control sequence="), std::string::npos) << e.what();
+    }
+    std::vector<uint8_t> module{'m'};
+    EXPECT_THROW(
+        endpoint_->control_remote_prepare_register(
+            remote_l3::RemoteRegistryTarget::REMOTE_TASK_DISPATCHER, CallableKind::PYTHON_IMPORT, digest.data(),
+            module.data(), module.size()
+        ),
+        std::runtime_error
+    );
+    std::vector<uint8_t> bad_blob{'a', 'b', 'd'};
+    EXPECT_THROW(
+        endpoint_->control_remote_prepare_register(
+            remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data(),
+            chip_payload(bad_blob, kAbcSha256).data(), chip_payload(bad_blob, kAbcSha256).size()
+        ),
+        std::runtime_error
+    );
+    EXPECT_EQ(endpoint_->control_remote_malloc(4).buffer_id, 1u);
+    EXPECT_EQ(server_->stats().failed_controls, 3u);
+}
+
+TEST_F(RemoteSessionServerTest, ChipCallableRegistersAndRunsOnTheChipWorker) {
+    RemoteL3SessionServer::Digest digest{};
+    digest.fill(0x22);
+    std::vector<uint8_t> blob{'a', 'b', 'c'};
+    std::vector<uint8_t> payload = chip_payload(blob, kAbcSha256);
+    endpoint_->control_remote_prepare_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data(), payload.data(),
+        payload.size()
+    );
+    endpoint_->control_remote_commit_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data()
+    );
+    endpoint_->control_prepare(digest.data());
+    EXPECT_EQ(stats().prepare_calls, 2);
+
+    RemoteBufferHandle h = endpoint_->control_remote_malloc(16);
+    remote_l3::CompletionPayload done = run_task(buffer_task(digest, h));
+    EXPECT_EQ(done.error_code, 0) << done.error_message;
+    EXPECT_EQ(stats().runs, 1);
+
+    // A stale generation is a task failure, not a session failure.
+    RemoteBufferHandle stale = h;
+    stale.generation = 9;
+    done = run_task(buffer_task(digest, stale));
+    EXPECT_EQ(done.error_code, 1);
+    EXPECT_NE(done.error_message.find("hashid=2222"), std::string::npos) << done.error_message;
+
+    endpoint_->control_remote_unregister(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data()
+    );
+    done = run_task(buffer_task(digest, h));
+    EXPECT_EQ(done.error_code, 1);
+    EXPECT_NE(done.error_message.find("no callable"), std::string::npos) << done.error_message;
+    EXPECT_EQ(stats().runs, 1);
+    EXPECT_EQ(server_->stats().tasks, 3u);
+    EXPECT_EQ(server_->stats().failed_tasks, 2u);
+}
+
+TEST_F(RemoteSessionServerTest, BoundCidDispatchesWithoutRegistration) {
+    endpoint_->control_prepare(bound_digest_.data());
+    RemoteBufferHandle h = endpoint_->control_remote_malloc(8);
+    remote_l3::CompletionPayload done = run_task(buffer_task(bound_digest_, h));
+    EXPECT_EQ(done.error_code, 0) << done.error_message;
+    EXPECT_EQ(stats().runs, 1);
+}
+
+TEST_F(RemoteSessionServerTest, HeldBlobReRegistersWithoutUpload) {
+    RemoteL3SessionServer::Digest digest{};
+    digest.fill(0x44);
+    std::vector<uint8_t> held = held_chip_payload(3, kAbcSha256);
+    EXPECT_NE(hello_.feature_flags & remote_l3::HELLO_FEATURE_HELD_CHIP_BLOB, 0u);
+    // Nothing held yet: the reply code tells the sender to fall back to INLINE_BLOB.
+    remote_l3::ControlReplyPayload unknown = run_raw_control(
+        remote_l3::ControlName::PREPARE_REGISTER_CALLABLE,
+        remote_l3::encode_register_callable_command(
+            remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest, 1, held
+        )
+    );
+    EXPECT_EQ(unknown.error_code, remote_l3::CONTROL_ERROR_BLOB_NOT_HELD) << unknown.error_message;
+
+    std::vector<uint8_t> blob{'a', 'b', 'c'};
+    std::vector<uint8_t> inline_payload = chip_payload(blob, kAbcSha256);
+    endpoint_->control_remote_prepare_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data(),
+        inline_payload.data(), inline_payload.size()
+    );
+    endpoint_->control_remote_commit_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data()
+    );
+    EXPECT_EQ(stats().prepare_calls, 2);
+
+    endpoint_->control_remote_prepare_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data(), held.data(),
+        held.size()
+    );
+    endpoint_->control_remote_commit_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data()
+    );
+    EXPECT_EQ(stats().prepare_calls, 2);  // no second device prepare
+
+    std::vector<uint8_t> wrong = held_chip_payload(4, kAbcSha256);
+    EXPECT_THROW(
+        endpoint_->control_remote_prepare_register(
+            remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data(),
+            wrong.data(), wrong.size()
+        ),
+        std::runtime_error
+    );
+
+    // A manifest-bound callable is held too.
+    endpoint_->control_remote_prepare_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, bound_digest_.data(),
+        held.data(), held.size()
+    );
+    endpoint_->control_remote_commit_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, bound_digest_.data()
+    );
+
+    // The endpoint turns a committed callable's INLINE_BLOB re-register into HELD_BLOB itself.
+    std::vector<uint8_t> reupload = chip_payload(blob, kAbcSha256);
+    endpoint_->control_remote_prepare_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data(),
+        reupload.data(), reupload.size()
+    );
+    endpoint_->control_remote_commit_register(
+        remote_l3::RemoteRegistryTarget::INNER_L3_WORKER, CallableKind::CHIP_CALLABLE, digest.data()
+    );
+    EXPECT_EQ(stats().prepare_calls, 2);
+
+    RemoteBufferHandle h = endpoint_->control_remote_malloc(16);
+    remote_l3::CompletionPayload done = run_task(buffer_task(digest, h));
+    EXPECT_EQ(done.error_code, 0) << done.error_message;
+}
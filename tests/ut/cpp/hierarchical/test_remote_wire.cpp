@@ -270,12 +270,14 @@ TEST(RemoteWire, RemoteBufferExportImportControlsRoundTrip) {
     import_result.nbytes = 64;
     import_result.rkey_or_token = 7;
     import_result.access_flags = remote_l3::REMOTE_BUFFER_ACCESS_READ;
+    import_result.transport_profile = "sim";
     auto import_result_bytes = remote_l3::encode_import_buffer_result(import_result);
     auto decoded_import_result =
         remote_l3::decode_import_buffer_result(import_result_bytes.data(), import_result_bytes.size());
     EXPECT_EQ(decoded_import_result.worker_id, 4);
     EXPECT_EQ(decoded_import_result.owner_worker_id, 3);
     EXPECT_EQ(decoded_import_result.import_id, 7u);
+    EXPECT_EQ(decoded_import_result.transport_profile, "sim");
 
     remote_l3::ReleaseImportRequest release_request;
     release_request.importer_worker_id = 4;
@@ -16,6 +16,8 @@
 #include <atomic>
 #include <chrono>
 #include <cstring>
+#include <functional>
+#include <future>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -462,6 +464,26 @@ TEST_F(SchedulerFixture, FailedProducerPoisonsDependentTask) {
     EXPECT_EQ(S(b.task_slot).state.load(), TaskState::CONSUMED);
 }
 
+// Copy nodes poll their tokens from other workers' threads; a poll must not
+// park behind the task the child is running.
+TEST_F(SchedulerFixture, CopyPollDoesNotWaitForRunningTask) {
+    auto res = orch.submit_next_level(C(31), single_tensor_args(0xF00D, TensorArgType::OUTPUT), cfg);
+    mock_worker.wait_running();
+    ASSERT_TRUE(mock_worker.is_running.load());
+
+    WorkerThread *wt = manager.get_worker_by_id(WorkerType::NEXT_LEVEL, 0);
+    ASSERT_NE(wt, nullptr);
+    auto poll = std::async(std::launch::async, [wt] {
+        return wt->control_copy_done(1);
+    });
+    EXPECT_EQ(poll.wait_for(std::chrono::milliseconds(200)), std::future_status::ready);
+    EXPECT_TRUE(mock_worker.is_running.load());
+
+    mock_worker.complete();
+    EXPECT_FALSE(poll.get());
+    wait_consumed(res.task_slot);
+}
+
 // ===========================================================================
 // Group task tests -- fixture with 2 MockMailboxWorkers
 // ===========================================================================
@@ -882,3 +904,238 @@ TEST_F(GroupSchedulerFixture, GroupDependencyChain) {
     wait_consumed(b.task_slot);
     (void)a;  // suppress unused
 }
+
+// ---------------------------------------------------------------------------
+// Copy tasks (Orchestrator::submit_copy)
+// ---------------------------------------------------------------------------
+
+// Local endpoint whose "device memory" is ordinary process memory, so the
+// control copies behind a copy node are plain memcpys. `run` lets the test
+// act as the kernel; every run / copy hop is appended to a shared log.
+// While `*hold` is set, async hops land at once but their tokens report
+// in flight, so the test decides when the copy node may complete.
+class CopyEndpoint final : public WorkerEndpoint {
+public:
+    using RunFn = std::function<void(const TaskSlotState &)>;
+
+    CopyEndpoint(
+        int32_t worker_id, std::vector<std::string> *log, std::mutex *log_mu, RunFn on_run,
+        const std::atomic<bool> *hold
+    ) :
+        log_(log),
+        log_mu_(log_mu),
+        on_run_(std::move(on_run)),
+        hold_(hold) {
+        caps_.worker_id = worker_id;
+        caps_.transport = "test-copy";
+    }
+
+    const WorkerEndpointCaps &caps() const override { return caps_; }
+
+    WorkerCompletion run(Ring *ring, const WorkerDispatch &dispatch) override {
+        if (on_run_) on_run_(*ring->slot_state(dispatch.task_slot));
+        record("run");
+        WorkerCompletion completion;
+        completion.task_slot = dispatch.task_slot;
+        completion.group_index = dispatch.group_index;
+        completion.outcome = EndpointOutcome::SUCCESS;
+        return completion;
+    }
+
+    void control_copy_to(uint64_t dst, uint64_t src, size_t size) override {
+        std::memcpy(reinterpret_cast<void *>(dst), reinterpret_cast<const void *>(src), size);
+        record("to");
+    }
+
+    void control_copy_from(uint64_t dst, uint64_t src, size_t size) override {
+        std::memcpy(reinterpret_cast<void *>(dst), reinterpret_cast<const void *>(src), size);
+        record("from");
+    }
+
+    uint64_t control_copy_to_async(uint64_t dst, uint64_t src, size_t size) override {
+        control_copy_to(dst, src, size);
+        return 1;
+    }
+
+    uint64_t control_copy_from_async(uint64_t dst, uint64_t src, size_t size) override {
+        control_copy_from(dst, src, size);
+        return 1;
+    }
+
+    bool control_copy_done(uint64_t) override { return !hold_->load(std::memory_order_acquire); }
+
+private:
+    void record(const char *what) {
+        std::lock_guard<std::mutex> lk(*log_mu_);
+        log_->push_back(std::string(what) + std::to_string(caps_.worker_id));
+    }
+
+    WorkerEndpointCaps caps_;
+    std::vector<std::string> *log_;
+    std::mutex *log_mu_;
+    RunFn on_run_;
+    const std::atomic<bool> *hold_;
+};
+
+struct CopySchedulerFixture : public ::testing::Test {
+    TensorMap tm;
+    Ring allocator;
+    Scope scope;
+    ReadyQueue rq_next_level;
+    ReadyQueue rq_sub;
+    Orchestrator orch;
+    WorkerManager manager;
+    Scheduler sched;
+    CallConfig cfg;
+
+    std::vector<std::string> log;
+    std::mutex log_mu;
+    std::vector<TaskSlot> consumed_slots;
+    std::mutex consumed_mu;
+
+    // Kernel stand-in: fills OUTPUT_EXISTING tensors with 0x5A and samples
+    // the first byte of INPUT tensors into `seen`.
+    std::atomic<int> seen{-1};
+    std::atomic<bool> hold_copies{false};
+
+    TaskSlotState &S(TaskSlot id) { return *allocator.slot_state(id); }
+
+    void SetUp() override {
+        allocator.init(/*heap_bytes=*/1ULL << 20);
+        orch.init(&tm, &allocator, &scope, &rq_next_level, &rq_sub, &manager);
+
+        auto kernel = [this](const TaskSlotState &s) {
+            const TaskArgs &a = s.task_args;
+            for (int32_t i = 0; i < a.tensor_count(); ++i) {
+                auto *p = reinterpret_cast<uint8_t *>(a.tensor(i).buffer.addr);
+                if (a.tag(i) == TensorArgType::OUTPUT_EXISTING) std::memset(p, 0x5A, a.tensor(i).nbytes());
+                if (a.tag(i) == TensorArgType::INPUT) seen.store(p[0]);
+            }
+        };
+        manager.add_next_level_endpoint(std::make_unique<CopyEndpoint>(0, &log, &log_mu, kernel, &hold_copies));
+        manager.add_next_level_endpoint(std::make_unique<CopyEndpoint>(1, &log, &log_mu, kernel, &hold_copies));
+        manager.start(&allocator, [this](WorkerCompletion completion) {
+            sched.worker_done(std::move(completion));
+        });
+
+        Scheduler::Config c;
+        c.ring = &allocator;
+        c.ready_next_level_queue = &rq_next_level;
+        c.ready_sub_queue = &rq_sub;
+        c.manager = &manager;
+        c.on_consumed_cb = [this](TaskSlot s) {
+            orch.on_consumed(s);
+            std::lock_guard<std::mutex> lk(consumed_mu);
+            consumed_slots.push_back(s);
+        };
+        sched.start(c);
+    }
+
+    void TearDown() override {
+        sched.stop();
+        manager.stop();
+        allocator.shutdown();
+    }
+
+    static Tensor chip_tensor(std::vector<uint8_t> &mem) {
+        Tensor t{};
+        t.buffer.addr = reinterpret_cast<uint64_t>(mem.data());
+        t.ndims = 1;
+        t.shapes[0] = static_cast<uint32_t>(mem.size());
+        t.dtype = DataType::UINT8;
+        t.child_memory = 1;
+        return t;
+    }
+
+    void wait_consumed(TaskSlot slot, int timeout_ms = 1000) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (std::chrono::steady_clock::now() < deadline) {
+            {
+                std::lock_guard<std::mutex> lk(consumed_mu);
+                if (std::find(consumed_slots.begin(), consumed_slots.end(), slot) != consumed_slots.end()) return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        FAIL() << "Timed out waiting for slot " << slot << " to be consumed";
+    }
+};
+
+TEST_F(CopySchedulerFixture, ChipToChipCopyOrdersBetweenProducerAndConsumer) {
+    std::vector<uint8_t> on_chip0(4096, 0), on_chip1(4096, 0);
+    Tensor a = chip_tensor(on_chip0);
+    Tensor b = chip_tensor(on_chip1);
+
+    TaskArgs produce;
+    produce.add_tensor(a, TensorArgType::OUTPUT_EXISTING);
+    orch.submit_next_level(C(1), produce, cfg, 0);
+
+    auto copy = orch.submit_copy(0, a, 1, b);
+
+    TaskArgs consume;
+    consume.add_tensor(b, TensorArgType::INPUT);
+    auto consumer = orch.submit_next_level(C(2), consume, cfg, 1);
+
+    wait_consumed(consumer.task_slot);
+    EXPECT_EQ(seen.load(), 0x5A);
+    EXPECT_EQ(on_chip0, on_chip1);
+    std::lock_guard<std::mutex> lk(log_mu);
+    EXPECT_EQ(log, (std::vector<std::string>{"run0", "from0", "to1", "run1"}));
+    (void)copy;
+}
+
+// The copy node is pinned to chip 1, yet an independent kernel on chip 1
+// runs to completion while the copy is still in flight; the copy's reader
+// waits for the copy.
+TEST_F(CopySchedulerFixture, KernelRunsWhileCopyInFlight) {
+    std::vector<uint8_t> on_chip0(4096, 0x77), on_chip1(4096, 0), scratch(64, 0);
+    Tensor a = chip_tensor(on_chip0);
+    Tensor b = chip_tensor(on_chip1);
+    hold_copies.store(true);
+
+    auto copy = orch.submit_copy(0, a, 1, b);
+    TaskArgs other;
+    other.add_tensor(chip_tensor(scratch), TensorArgType::OUTPUT_EXISTING);
+    auto independent = orch.submit_next_level(C(3), other, cfg, 1);
+    wait_consumed(independent.task_slot);
+    EXPECT_EQ(scratch[0], 0x5A);
+    EXPECT_EQ(S(copy.task_slot).state.load(), TaskState::RUNNING);
+
+    TaskArgs consume;
+    consume.add_tensor(b, TensorArgType::INPUT);
+    auto consumer = orch.submit_next_level(C(2), consume, cfg, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(S(consumer.task_slot).state.load(), TaskState::PENDING);
+    EXPECT_EQ(seen.load(), -1);
+
+    hold_copies.store(false);
+    wait_consumed(consumer.task_slot);
+    EXPECT_EQ(seen.load(), 0x77);
+    EXPECT_EQ(on_chip0, on_chip1);
+    std::lock_guard<std::mutex> lk(log_mu);
+    EXPECT_EQ(log, (std::vector<std::string>{"from0", "run1", "to1", "run1"}));
+}
+
+TEST_F(CopySchedulerFixture, ChipToHostCopyLandsWithoutStaging) {
+    std::vector<uint8_t> on_chip0(256);
+    for (size_t i = 0; i < on_chip0.size(); ++i) {
+        on_chip0[i] = static_cast<uint8_t>(i);
+    }
+    Tensor host = orch.alloc({256}, DataType::UINT8);
+
+    auto copy = orch.submit_copy(0, chip_tensor(on_chip0), -1, host);
+    wait_consumed(copy.task_slot);
+
+    // Slot state survives CONSUMED until the next drain resets the ring.
+    EXPECT_EQ(S(copy.task_slot).copy.staging, 0u);
+    EXPECT_EQ(S(copy.task_slot).get_affinity(0), 0);
+    EXPECT_EQ(std::memcmp(host.data_as<uint8_t>(), on_chip0.data(), on_chip0.size()), 0);
+    std::lock_guard<std::mutex> lk(log_mu);
+    EXPECT_EQ(log, (std::vector<std::string>{"from0"}));
+}
+
+TEST_F(CopySchedulerFixture, SubmitCopyRejectsBadEndpoints) {
+    std::vector<uint8_t> small(16), big(64);
+    EXPECT_THROW(orch.submit_copy(-1, chip_tensor(big), -1, chip_tensor(small)), std::invalid_argument);
+    EXPECT_THROW(orch.submit_copy(0, chip_tensor(big), 1, chip_tensor(small)), std::invalid_argument);
+    EXPECT_THROW(orch.submit_copy(0, chip_tensor(small), 5, chip_tensor(big)), std::invalid_argument);
+}
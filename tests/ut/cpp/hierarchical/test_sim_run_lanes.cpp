@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+// Run lanes against the real a2a3 sim host_runtime.so (not the stand-in that
+// test_chip_worker_lanes binds). Every lane is its own SimDeviceRunner on the
+// same device_id; each must own its cpu_sim_context, so TPUSH/TPOP pipe slots,
+// the between-runs reset and finalize_device stay per lane.
+//
+// The pipe state is inspected through the same hook pto-isa calls
+// (pto_sim_get_pipe_shared_state) on whatever context the calling thread is
+// bound to. Skips when the sim runtime has not been built
+// (python -m simpler_setup.build_runtimes --platforms a2a3sim).
+
+#include <dlfcn.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "chip_worker.h"
+
+namespace {
+
+constexpr int kDevice = 3;
+constexpr uint64_t kPipeKey = 0x11;
+constexpr size_t kStateSize = 256;
+
+struct SimContextApi {
+    int (*get_bound_context)();
+    void (*bind_context)(int);
+    void *(*get_pipe_shared_state)(uint64_t, size_t);
+};
+
+struct HostRuntimeApi {
+    void *(*create_device_context)();
+    void (*destroy_device_context)(void *);
+    int (*simpler_init)(void *, int, const uint8_t *, size_t, const uint8_t *, size_t, const uint8_t *, size_t);
+    int (*finalize_device)(void *);
+};
+
+template <typename F>
+F resolve(void *handle, const char *name) {
+    return reinterpret_cast<F>(dlsym(handle, name));
+}
+
+class SimRunLanesTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (const char *path : {SIM_HOST_RUNTIME_LIB_PATH, SIMPLER_LOG_LIB_PATH, CPU_SIM_CONTEXT_LIB_PATH}) {
+            if (!std::filesystem::exists(path)) {
+                GTEST_SKIP() << "sim runtime not built: " << path
+                             << "\n(python -m simpler_setup.build_runtimes --platforms a2a3sim)";
+            }
+        }
+        // Same preload ChipWorker's Python wrapper does: host_runtime.so
+        // resolves its log and sim-context symbols against these globals.
+        log_lib_ = dlopen(SIMPLER_LOG_LIB_PATH, RTLD_NOW | RTLD_GLOBAL);
+        ASSERT_NE(log_lib_, nullptr) << dlerror();
+        sim_lib_ = dlopen(CPU_SIM_CONTEXT_LIB_PATH, RTLD_NOW | RTLD_GLOBAL);
+        ASSERT_NE(sim_lib_, nullptr) << dlerror();
+        sim_.get_bound_context = resolve<decltype(sim_.get_bound_context)>(sim_lib_, "pto_cpu_sim_get_bound_context");
+        sim_.bind_context = resolve<decltype(sim_.bind_context)>(sim_lib_, "pto_cpu_sim_bind_context");
+        sim_.get_pipe_shared_state =
+            resolve<decltype(sim_.get_pipe_shared_state)>(sim_lib_, "pto_sim_get_pipe_shared_state");
+        ASSERT_TRUE(sim_.get_bound_context && sim_.bind_context && sim_.get_pipe_shared_state);
+    }
+
+    void TearDown() override {
+        if (sim_.bind_context != nullptr) sim_.bind_context(-1);
+        if (sim_lib_ != nullptr) dlclose(sim_lib_);
+        if (log_lib_ != nullptr) dlclose(log_lib_);
+    }
+
+    uint8_t *pipe_state() { return static_cast<uint8_t *>(sim_.get_pipe_shared_state(kPipeKey, kStateSize)); }
+
+    void *log_lib_{nullptr};
+    void *sim_lib_{nullptr};
+    SimContextApi sim_{};
+};
+
+}  // namespace
+
+TEST_F(SimRunLanesTest, EachLaneOwnsItsPipeState) {
+    ChipWorker worker;
+    worker.init(SIM_HOST_RUNTIME_LIB_PATH, SIM_AICPU_LIB_PATH, SIM_AICORE_LIB_PATH, "", kDevice);
+    const int lane0 = sim_.get_bound_context();
+    ASSERT_GE(lane0, 0);
+    uint8_t *a = pipe_state();
+    ASSERT_NE(a, nullptr);
+    std::memset(a, 0xab, kStateSize);
+
+    worker.configure_run_lanes({2, 1}, {2, 1});
+    // simpler_init on lane 1 bound this thread to lane 1's context.
+    const int lane1 = sim_.get_bound_context();
+    ASSERT_GE(lane1, 0);
+    EXPECT_NE(lane1, lane0);
+    uint8_t *b = pipe_state();
+    ASSERT_NE(b, nullptr);
+    EXPECT_NE(b, a) << "two lanes on one device share a pipe slot";
+    EXPECT_EQ(b[0], 0);
+
+    sim_.bind_context(lane0);
+    EXPECT_EQ(pipe_state(), a);
+    EXPECT_EQ(a[0], 0xab);
+
+    worker.finalize();
+    for (int key : {lane0, lane1}) {
+        sim_.bind_context(key);
+        EXPECT_EQ(pipe_state(), nullptr) << "context " << key << " outlived finalize";
+    }
+}
+
+// finalize_device on one lane, from a thread last bound to another lane (what
+// configure_run_lanes' error teardown does), must release only its own context.
+TEST_F(SimRunLanesTest, FinalizingOneLaneKeepsTheOther) {
+    void *host = dlopen(SIM_HOST_RUNTIME_LIB_PATH, RTLD_NOW | RTLD_LOCAL);
+    ASSERT_NE(host, nullptr) << dlerror();
+    HostRuntimeApi api{};
+    api.create_device_context = resolve<decltype(api.create_device_context)>(host, "create_device_context");
+    api.destroy_device_context = resolve<decltype(api.destroy_device_context)>(host, "destroy_device_context");
+    api.simpler_init = resolve<decltype(api.simpler_init)>(host, "simpler_init");
+    api.finalize_device = resolve<decltype(api.finalize_device)>(host, "finalize_device");
+    ASSERT_TRUE(api.create_device_context && api.destroy_device_context && api.simpler_init && api.finalize_device);
+
+    void *ctx0 = api.create_device_context();
+    ASSERT_EQ(api.simpler_init(ctx0, kDevice, nullptr, 0, nullptr, 0, nullptr, 0), 0);
+    const int lane0 = sim_.get_bound_context();
+    uint8_t *a = pipe_state();
+    ASSERT_NE(a, nullptr);
+    std::memset(a, 0xab, kStateSize);
+
+    void *ctx1 = api.create_device_context();
+    ASSERT_EQ(api.simpler_init(ctx1, kDevice, nullptr, 0, nullptr, 0, nullptr, 0), 0);
+    ASSERT_NE(sim_.get_bound_context(), lane0);
+
+    sim_.bind_context(lane0);
+    EXPECT_EQ(api.finalize_device(ctx1), 0);
+    api.destroy_device_context(ctx1);
+
+    EXPECT_EQ(sim_.get_bound_context(), lane0);
+    EXPECT_EQ(pipe_state(), a) << "finalizing lane 1 released lane 0's context";
+    EXPECT_EQ(a[kStateSize - 1], 0xab);
+
+    EXPECT_EQ(api.finalize_device(ctx0), 0);
+    api.destroy_device_context(ctx0);
+    EXPECT_EQ(sim_.get_bound_context(), -1) << "finalize_device leaves the thread bound to a dead context";
+    dlclose(host);
+}
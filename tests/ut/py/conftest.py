@@ -15,8 +15,16 @@ and host_worker modules are importable without installing the package.
 import sys
 from pathlib import Path
 
+import pytest
+
 _ROOT = Path(__file__).resolve().parent.parent.parent.parent
 for _d in [_ROOT, _ROOT / "python"]:
     _s = str(_d)
     if _s not in sys.path:
         sys.path.insert(0, _s)
+
+
+@pytest.fixture(autouse=True)
+def _isolated_identity_cache(monkeypatch):
+    """Keep unit tests from reading or writing the user's persisted file-digest cache."""
+    monkeypatch.setenv("SIMPLER_IDENTITY_CACHE", "")
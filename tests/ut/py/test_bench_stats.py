@@ -0,0 +1,171 @@
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Tests for simpler_setup.tools.bench_stats (robust round statistics + baseline compare)."""
+
+import json
+
+import pytest
+
+from simpler_setup.tools.bench_stats import (
+    SCHEMA,
+    compare,
+    log2_histogram,
+    main,
+    median_ci,
+    merge_into_file,
+    percentile,
+    sched_phase_samples,
+    summarize,
+)
+from simpler_setup.tools.swimlane_converter import read_perf_data
+
+
+def _report(tmp_path, name, samples_by_case):
+    path = tmp_path / name
+    for label, samples in samples_by_case.items():
+        merge_into_file(path, label, {"host_wall_us": samples}, {"platform": "a2a3sim", "rounds": len(samples)})
+    return path
+
+
+def test_percentile_interpolates():
+    vals = [1.0, 2.0, 3.0, 4.0, 5.0]
+    assert percentile(vals, 50) == 3.0
+    assert percentile(vals, 90) == pytest.approx(4.6)
+    assert percentile(vals, 0) == 1.0
+    assert percentile(vals, 100) == 5.0
+    assert percentile([], 50) == 0.0
+
+
+def test_median_ci_brackets_median_and_narrows_with_n():
+    small = [float(v) for v in range(10)]
+    large = [float(v) for v in range(1000)]
+    lo_s, hi_s = median_ci(small)
+    lo_l, hi_l = median_ci(large)
+    assert lo_s <= percentile(small, 50) <= hi_s
+    assert lo_l <= percentile(large, 50) <= hi_l
+    # Width relative to the range shrinks like 1/sqrt(n).
+    assert (hi_l - lo_l) / 999 < (hi_s - lo_s) / 9
+    assert median_ci([7.0]) == (7.0, 7.0)
+
+
+@pytest.mark.parametrize(("n", "ranks"), [(6, (1, 6)), (10, (2, 9)), (20, (6, 15)), (100, (40, 61))])
+def test_median_ci_matches_binomial_table_ranks(n, ranks):
+    # 95% sign-test ranks for the median (1-based), as tabulated in Conover,
+    # Practical Nonparametric Statistics, Table A3.
+    vals = [float(v) for v in range(1, n + 1)]
+    assert median_ci(vals) == (float(ranks[0]), float(ranks[1]))
+
+
+def test_median_ci_normal_ranks_for_large_n():
+    # floor(n/2 - z*sqrt(n)/2) and ceil(1 + n/2 + z*sqrt(n)/2), 1-based.
+    n = 2000
+    vals = [float(v) for v in range(1, n + 1)]
+    assert median_ci(vals) == (956.0, 1045.0)
+
+
+def test_summarize_ignores_sample_order_and_keeps_raw():
+    s = summarize([30.0, 10.0, 20.0, 1000.0])
+    assert s["n"] == 4
+    assert s["median"] == 25.0
+    assert s["min"] == 10.0 and s["max"] == 1000.0
+    assert s["samples"] == [30.0, 10.0, 20.0, 1000.0]
+    assert s["median_ci"][0] <= s["median"] <= s["median_ci"][1]
+
+
+def test_merge_into_file_accumulates_cases(tmp_path):
+    path = _report(tmp_path, "bench.json", {"A::x": [1.0, 2.0, 3.0], "B::y": [4.0, 5.0]})
+    report = json.loads(path.read_text())
+    assert report["schema"] == SCHEMA
+    assert report["meta"]["platform"] == "a2a3sim"
+    assert set(report["cases"]) == {"A::x", "B::y"}
+    assert report["cases"]["A::x"]["host_wall_us"]["median"] == 2.0
+
+
+def test_compare_needs_shift_and_disjoint_ci(tmp_path):
+    base = [100.0 + (i % 5) for i in range(50)]
+    slower = [v * 1.2 for v in base]
+    jitter = [v * 1.2 if i % 2 else v for i, v in enumerate(base)]
+    faster = [v * 0.8 for v in base]
+    b = json.loads(_report(tmp_path, "b.json", {"S::slow": base, "S::jit": base, "S::fast": base}).read_text())
+    c = json.loads(_report(tmp_path, "c.json", {"S::slow": slower, "S::jit": jitter, "S::fast": faster}).read_text())
+    verdicts = {r["case"]: r["verdict"] for r in compare(b, c, threshold=0.05)}
+    assert verdicts["S::slow"] == "regression"
+    assert verdicts["S::fast"] == "improvement"
+    # Median moved but half the rounds still overlap the baseline: not flagged.
+    assert verdicts["S::jit"] == "same"
+
+
+def test_cli_compare_exit_code(tmp_path, capsys):
+    base = [100.0 + (i % 5) for i in range(50)]
+    b = _report(tmp_path, "b.json", {"S::c": base})
+    same = _report(tmp_path, "same.json", {"S::c": list(reversed(base))})
+    slow = _report(tmp_path, "slow.json", {"S::c": [v * 1.5 for v in base]})
+    assert main(["compare", str(b), str(same)]) == 0
+    assert main(["compare", str(b), str(slow), "--json", str(tmp_path / "rows.json")]) == 1
+    rows = json.loads((tmp_path / "rows.json").read_text())
+    assert rows[0]["verdict"] == "regression"
+    assert main(["show", str(b)]) == 0
+    assert "host_wall_us: median" in capsys.readouterr().out
+
+
+def test_log2_histogram_buckets():
+    hist = log2_histogram([0.01, 0.2, 1.0, 1.5, 6.0])
+    # Below 1/16 us shares the first bucket; 0.2 lands in [0.125, 0.25).
+    assert hist == {"lo_us": [0.0, 0.125, 0.25, 0.5, 1.0, 2.0, 4.0], "count": [1, 1, 0, 0, 2, 0, 1]}
+    assert log2_histogram([]) == {"lo_us": [], "count": []}
+
+
+def _swimlane_file(tmp_path, name, dispatch_cycles):
+    # Raw l2_swimlane_records.json at level 3: only the scheduler phase stream.
+    raw = {
+        "l2_swimlane_level": 3,
+        "metadata": {"clock_freq_hz": 50_000_000, "num_cores": 1, "core_types": ["aiv"]},
+        "aicore_tasks": [],
+        "aicpu_tasks": [],
+        "aicpu_scheduler_phases": [
+            [{"kind": "dispatch", "start_cycles": 100, "end_cycles": 100 + c, "loop_iter": i} for i, c in enumerate(t)]
+            + [{"kind": "complete", "start_cycles": 1000, "end_cycles": 1010, "loop_iter": 0}]
+            for t in dispatch_cycles
+        ],
+    }
+    path = tmp_path / name
+    path.write_text(json.dumps(raw))
+    return path
+
+
+def test_sched_phase_metrics_from_swimlane_records(tmp_path, capsys):
+    # Two scheduler threads; 50 cycles = 1 us at 50 MHz.
+    perf = read_perf_data(_swimlane_file(tmp_path, "base.json", [[50] * 30, [110] * 30]))
+    samples = sched_phase_samples(perf)
+    assert sorted(samples) == ["sched_complete_us", "sched_dispatch_us"]
+    assert len(samples["sched_dispatch_us"]) == 60
+    assert samples["sched_complete_us"] == pytest.approx([0.2, 0.2])
+
+    report = tmp_path / "b.json"
+    merge_into_file(report, "S::c", {"host_wall_us": [1.0, 2.0], **samples}, {"platform": "a2a3sim"})
+    case = json.loads(report.read_text())["cases"]["S::c"]
+    assert "hist" not in case["host_wall_us"]
+    assert case["sched_dispatch_us"]["hist"] == {"lo_us": [1.0, 2.0], "count": [30, 30]}  # 1.0 and 2.2 us
+    assert main(["show", str(report)]) == 0
+    assert "    hist 1:30 2:30" in capsys.readouterr().out
+
+    # A slower dispatch phase is flagged like any other metric.
+    slow = sched_phase_samples(read_perf_data(_swimlane_file(tmp_path, "slow.json", [[130] * 30, [150] * 30])))
+    cur = tmp_path / "c.json"
+    merge_into_file(cur, "S::c", {"host_wall_us": [1.0, 2.0], **slow}, {"platform": "a2a3sim"})
+    verdicts = {r["metric"]: r["verdict"] for r in compare(json.loads(report.read_text()), json.loads(cur.read_text()))}
+    assert verdicts["sched_dispatch_us"] == "regression"
+    assert verdicts["sched_complete_us"] == "same"
+
+
+def test_load_rejects_foreign_json(tmp_path):
+    other = tmp_path / "other.json"
+    other.write_text("{}")
+    with pytest.raises(ValueError):
+        main(["show", str(other)])
@@ -0,0 +1,77 @@
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Tests for the binary (deferred-format) log decoder in device_log_resolver."""
+
+import struct
+
+import pytest
+
+from simpler_setup.tools.device_log_resolver import decode_binary_log
+
+_HEADER = struct.Struct("<8sIIIIQQ")
+_RECORD = struct.Struct("<QIIIBBH12Q136s")
+
+
+def _chunk(fmts, records, dropped=0):
+    """Pack one chunk the way binlog::Sink::flush writes it.
+
+    records: (ts_ns, fmt_id, func_id, tid, tag, args, strs)
+    """
+    out = bytearray(_HEADER.pack(b"SIMPLBL1", 1, _RECORD.size, len(fmts), 0, len(records), dropped))
+    for fid, text in fmts.items():
+        raw = text.encode()
+        out += struct.pack("<II", fid, len(raw)) + raw
+    for ts, fmt_id, func_id, tid, tag, args, strs in records:
+        padded = list(args) + [0] * (12 - len(args))
+        out += _RECORD.pack(ts, fmt_id, func_id, tid, tag, len(args), len(strs), *padded, strs)
+    return bytes(out)
+
+
+def _double_bits(d):
+    return struct.unpack("<Q", struct.pack("<d", d))[0]
+
+
+def test_decode_renders_printf_and_merges_chunks_by_timestamp(tmp_path):
+    host = _chunk(
+        {1: "[%s:%d] x=%5.2f n=%lld", 2: "run"},
+        [(200, 1, 2, 7, 0x15, [0, 42, _double_bits(3.14159), (1 << 64) - 3], b"a.cpp\0")],
+    )
+    aicpu = _chunk(
+        {9: "%-4u|%#x|%c|%%|%.*s", 3: "sched"},
+        [(100, 9, 3, 8, 2, [7, 255, ord("Q"), 2, 0], b"abcdef\0")],
+        dropped=4,
+    )
+    path = tmp_path / "run.binlog"
+    path.write_bytes(host + aicpu)
+
+    records, dropped = decode_binary_log(path)
+
+    assert dropped == 4
+    assert [r.message for r in records] == ["7   |0xff|Q|%|ab", "[a.cpp:42] x= 3.14 n=-3"]
+    assert [(r.level, r.func, r.tid) for r in records] == [("WARN", "sched", 8), ("INFO_V5", "run", 7)]
+    assert records[1].format() == "[0.000000200][T7][INFO_V5] run: [a.cpp:42] x= 3.14 n=-3"
+
+
+def test_decode_marks_missing_args_and_ignores_truncated_tail(tmp_path):
+    good = _chunk({1: "%d %s %d"}, [(1, 1, 0, 1, 0, [5, 0xFFFFFFFF], b"")])
+    path = tmp_path / "cut.binlog"
+    path.write_bytes(good + good[: _HEADER.size + 10])
+
+    records, _ = decode_binary_log(path)
+
+    assert len(records) == 1
+    assert records[0].message == "5 (null) <?>"
+    assert records[0].func == "?"
+
+
+def test_decode_rejects_foreign_file(tmp_path):
+    path = tmp_path / "text.log"
+    path.write_bytes(b"not a binary log at all, just some text....\n")
+    with pytest.raises(ValueError):
+        decode_binary_log(path)
@@ -0,0 +1,153 @@
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Tests for buffer_planner: lifetime extraction, FIFO / live-set peaks and the offset plan."""
+
+import random
+
+import pytest
+from simpler_setup.tools.buffer_planner import (
+    fifo_peak,
+    lifetimes_from_deps,
+    load_lifetimes,
+    max_live,
+    plan_offsets,
+    plan_rings,
+    verify_plan,
+)
+
+_RING1 = 1 << 32
+_KIB = 1024
+
+
+def _buf(name, def_index, last_use, nbytes=_KIB, ring=0):
+    return {"name": name, "ring": ring, "bytes": nbytes, "def": def_index, "last_use": last_use}
+
+
+def test_lifetimes_from_deps():
+    # t0 allocs A (ring 0), t1 writes B (ring 1) reading A, t2 reads A and B,
+    # t3 reads only the external input X.
+    deps = {
+        "tasks": [
+            {"task_id": "0", "args": []},
+            {"task_id": str(_RING1), "args": [{"idx": 0, "type": "INPUT", "tensor_id": "11"}]},
+            {"task_id": "1", "args": [{"idx": 0, "type": "INPUT", "tensor_id": "12"}]},
+            {"task_id": "2", "args": [{"idx": 0, "type": "INPUT", "tensor_id": "30"}]},
+        ],
+        "tensors": [
+            {"tensor_id": "11", "buffer_addr": "4096", "version": 0, "dtype": "FLOAT32", "buffer_numel": "300"},
+            {"tensor_id": "12", "buffer_addr": "4096", "version": 1, "dtype": "FLOAT32", "buffer_numel": "300"},
+            {"tensor_id": "20", "buffer_addr": "8192", "version": 0, "dtype": "FLOAT16", "buffer_numel": "2048"},
+            {"tensor_id": "30", "buffer_addr": "65536", "version": 0, "dtype": "INT8", "buffer_numel": "64"},
+        ],
+        "edges": [
+            {"pred": "0", "succ": str(_RING1), "arg": 0, "source": "creator", "tensor_id": "11"},
+            {"pred": str(_RING1), "succ": "1", "arg": 1, "source": "creator", "tensor_id": "20"},
+            {"pred": "0", "succ": "1", "arg": 0, "source": "tensormap", "tensor_id": "12"},
+        ],
+    }
+
+    buffers = lifetimes_from_deps(deps)
+
+    # The external input (no creator edge) is not an intermediate.
+    assert buffers == [
+        {"name": hex(4096), "ring": 0, "bytes": 2 * _KIB, "def": 0, "last_use": 2},
+        {"name": hex(8192), "ring": 1, "bytes": 4 * _KIB, "def": 1, "last_use": 2},
+    ]
+    assert lifetimes_from_deps(deps, align=1)[0]["bytes"] == 1200
+
+
+def test_lifetimes_from_deps_splits_a_reused_address():
+    # The ring wraps: t0 allocs A at 4096 (read by t1), t2 allocs B at the same
+    # address (read by t3 and t4). Both are version 0, so they share tensor 11;
+    # only the creator edges and submission order tell them apart.
+    deps = {
+        "tasks": [
+            {"task_id": str(i), "args": [{"idx": 0, "type": "INPUT", "tensor_id": "11"}] if i in (1, 4) else []}
+            for i in range(5)
+        ],
+        "tensors": [
+            {"tensor_id": "11", "buffer_addr": "4096", "version": 0, "dtype": "FLOAT32", "buffer_numel": "256"},
+            {"tensor_id": "12", "buffer_addr": "4096", "version": 1, "dtype": "FLOAT32", "buffer_numel": "512"},
+        ],
+        "edges": [
+            {"pred": "0", "succ": "1", "arg": 0, "source": "creator", "tensor_id": "11"},
+            {"pred": "2", "succ": "3", "arg": 0, "source": "creator", "tensor_id": "11"},
+            {"pred": "3", "succ": "4", "arg": 1, "source": "tensormap", "tensor_id": "12"},
+        ],
+    }
+
+    buffers = lifetimes_from_deps(deps)
+
+    assert buffers == [
+        {"name": hex(4096), "ring": 0, "bytes": _KIB, "def": 0, "last_use": 1},
+        {"name": hex(4096) + "#1", "ring": 0, "bytes": 2 * _KIB, "def": 2, "last_use": 4},
+    ]
+    assert max_live(buffers) == 2 * _KIB
+
+
+def test_decode_chain_collapses_to_two_buffers():
+    # Each task writes one buffer read only by the next task.
+    buffers = [_buf(str(i), i, i + 1) for i in range(32)]
+
+    [r] = plan_rings(buffers)
+
+    assert r["naive_bytes"] == 32 * _KIB
+    assert r["max_live_bytes"] == 2 * _KIB
+    assert r["fifo_peak_bytes"] == 2 * _KIB
+    assert r["planned_bytes"] == 2 * _KIB
+    assert r["fragmentation"] == 0.0
+
+
+def test_long_lived_head_pins_fifo_ring():
+    # Buffer 0 lives to the end, so FIFO reclaims nothing behind it, while
+    # the planner reuses one slot for the short-lived chain.
+    buffers = [_buf("head", 0, 20, 4 * _KIB)] + [_buf(str(i), i, i) for i in range(1, 20)]
+
+    assert fifo_peak(buffers) == 4 * _KIB + 19 * _KIB
+    assert max_live(buffers) == 5 * _KIB
+    offsets, arena = plan_offsets(buffers)
+    assert arena == 5 * _KIB
+    assert verify_plan(buffers, offsets) == []
+    [r] = plan_rings(buffers)
+    assert r["fifo_overhead"] == pytest.approx(23 / 5 - 1)
+    assert r["suggested_ring_bytes"] == 32 * _KIB
+
+
+def test_plan_is_conflict_free_and_bounded_on_random_lifetimes():
+    rng = random.Random(7)
+    buffers = []
+    for i in range(200):
+        start = rng.randrange(0, 400)
+        buffers.append(_buf(str(i), start, start + rng.randrange(0, 40), rng.choice([1, 2, 4, 16]) * _KIB))
+    buffers.sort(key=lambda b: b["def"])
+
+    offsets, arena = plan_offsets(buffers)
+
+    assert verify_plan(buffers, offsets) == []
+    live = max_live(buffers)
+    assert live <= arena <= sum(b["bytes"] for b in buffers)
+    assert live <= fifo_peak(buffers) <= sum(b["bytes"] for b in buffers)
+
+
+def test_rings_are_planned_independently():
+    buffers = [_buf("a", 0, 5, ring=0), _buf("b", 0, 5, ring=1), _buf("c", 1, 5, ring=1)]
+
+    results = plan_rings(buffers)
+
+    assert [(r["ring"], r["buffers"], r["planned_bytes"]) for r in results] == [(0, 1, _KIB), (1, 2, 2 * _KIB)]
+    assert [p["offset"] for p in results[1]["plan"]] == [0, _KIB]
+
+
+def test_load_lifetimes_accepts_trace_and_rejects_other_json():
+    trace = {"buffers": [{"name": "0x1000", "ring": 1, "bytes": 100, "def": 3, "last_use": 1}]}
+
+    # Sizes are re-aligned and a use before def collapses to the def point.
+    assert load_lifetimes(trace) == [_buf("0x1000", 3, 3, _KIB, ring=1)]
+    with pytest.raises(ValueError):
+        load_lifetimes({"tasks_per_core": []})
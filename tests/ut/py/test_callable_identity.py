@@ -25,9 +25,11 @@ from simpler.callable_identity import (
     CallableKindName,
     TargetNamespaceName,
     build_chip_callable_descriptor,
+    build_native_so_descriptor,
     build_python_import_descriptor,
     build_python_serialized_descriptor,
     compute_callable_hashid,
+    hash_shared_library,
     hashid_to_digest,
     parse_python_import_target,
     validate_hashid,
@@ -60,6 +62,8 @@ from simpler.task_interface import (
     TensorArgType,
 )
 from simpler.worker import (
+    CompiledOrchestration,
+    NativeSubCallable,
     RemoteCallable,
     RemoteWorkerSpec,
     Worker,
@@ -222,6 +226,93 @@ def test_remote_inner_chip_callable_payload_validates_descriptor_and_context():
     assert isinstance(got_target, ChipCallable)
 
 
+def test_remote_inner_chip_callable_held_blob_reuses_the_held_callable():
+    chip = ChipCallable.build(signature=[], func_name="x", binary=b"\x01", children=[])
+    manifest = {"platform": "a2a3sim", "runtime": "tensormap_and_ringbuffer"}
+    descriptor = build_chip_callable_descriptor(target=chip, platform=manifest["platform"], runtime=manifest["runtime"])
+    digest = hashid_to_digest(compute_callable_hashid(descriptor))
+    blob = ctypes.string_at(int(chip.buffer_ptr()), int(chip.buffer_size()))
+    payload = encode_remote_chip_callable_payload(
+        RemoteChipCallablePayload(
+            descriptor_bytes=descriptor,
+            blob_location=ChipCallableBlobLocation.HELD_BLOB,
+            blob_size=len(blob),
+            blob_sha256=hashlib.sha256(blob).digest(),
+            inline_blob=b"",
+            staged_blob_token=b"",
+        )
+    )
+    command = encode_register_callable_command(
+        RemoteRegistryTarget.INNER_L3_WORKER, CallableKind.CHIP_CALLABLE, digest, 1, payload
+    )
+
+    with pytest.raises(ValueError, match="resend INLINE_BLOB"):
+        _prepare_register_callable(command, manifest, lambda _digest: None)
+    got_digest, _kind, _registry, got_target = _prepare_register_callable(command, manifest, {digest: chip}.get)
+    assert got_digest == digest
+    assert got_target is chip
+
+    other = ChipCallable.build(signature=[], func_name="y", binary=b"\x02", children=[])
+    with pytest.raises(ValueError, match="does not match the held executable blob"):
+        _prepare_register_callable(command, manifest, {digest: other}.get)
+
+
+def test_chip_blob_digest_is_taken_once_per_callable(monkeypatch):
+    chip = ChipCallable.build(signature=[], func_name="x", binary=b"\x01", children=[])
+    views = []
+    real_view = callable_identity._chip_callable_view
+
+    def counting_view(target):
+        views.append(target)
+        return real_view(target)
+
+    monkeypatch.setattr(callable_identity, "_chip_callable_view", counting_view)
+
+    first = build_chip_callable_descriptor(target=chip, platform="a2a3sim", runtime="tensormap_and_ringbuffer")
+    second = build_chip_callable_descriptor(target=chip, platform="a5sim", runtime="tensormap_and_ringbuffer")
+
+    assert len(views) == 1
+    assert first != second
+    blob = ctypes.string_at(int(chip.buffer_ptr()), int(chip.buffer_size()))
+    assert callable_identity.hash_chip_callable_blob(chip) == hashlib.sha256(blob).digest()
+
+
+def test_shared_library_digest_is_cached_by_file_identity(tmp_path, monkeypatch):
+    cache_file = tmp_path / "cache" / "identity.json"
+    monkeypatch.setenv("SIMPLER_IDENTITY_CACHE", str(cache_file))
+    monkeypatch.setattr(callable_identity, "_FILE_DIGESTS", callable_identity._FileDigestCache())
+    hashed = []
+    real_hash = callable_identity._hash_file
+
+    def counting_hash(path):
+        hashed.append(path)
+        return real_hash(path)
+
+    monkeypatch.setattr(callable_identity, "_hash_file", counting_hash)
+    lib = tmp_path / "libpost.so"
+    lib.write_bytes(b"\x7fELF-v1")
+
+    assert hash_shared_library(str(lib)) == hashlib.sha256(b"\x7fELF-v1").digest()
+    assert hash_shared_library(str(lib)) == hashlib.sha256(b"\x7fELF-v1").digest()
+    assert len(hashed) == 1
+    assert cache_file.is_file()
+
+    # A fresh process starts from the persisted digests.
+    monkeypatch.setattr(callable_identity, "_FILE_DIGESTS", callable_identity._FileDigestCache())
+    assert hash_shared_library(str(lib)) == hashlib.sha256(b"\x7fELF-v1").digest()
+    assert len(hashed) == 1
+
+    lib.write_bytes(b"\x7fELF-v2-rebuilt")
+    assert hash_shared_library(str(lib)) == hashlib.sha256(b"\x7fELF-v2-rebuilt").digest()
+    assert len(hashed) == 2
+
+    # A corrupt cache file only costs a rehash.
+    cache_file.write_text("{not json")
+    monkeypatch.setattr(callable_identity, "_FILE_DIGESTS", callable_identity._FileDigestCache())
+    assert hash_shared_library(str(lib)) == hashlib.sha256(b"\x7fELF-v2-rebuilt").digest()
+    assert len(hashed) == 3
+
+
 def test_remote_dispatcher_rejects_chip_callable_target():
     command = encode_register_callable_command(
         RemoteRegistryTarget.REMOTE_TASK_DISPATCHER,
@@ -395,6 +486,85 @@ def test_python_import_descriptor_hash_is_stable():
     )
 
 
+def test_native_so_identity_is_content_hash_plus_symbol(tmp_path):
+    lib = tmp_path / "libpost.so"
+    lib.write_bytes(b"\x7fELF-not-really-a-library")
+    copy = tmp_path / "copy" / "libpost.so"
+    copy.parent.mkdir()
+    copy.write_bytes(lib.read_bytes())
+
+    a = NativeSubCallable(str(lib), "argmax_rows")
+    b = NativeSubCallable(str(copy), "argmax_rows")
+    assert a.so_sha256 == hash_shared_library(str(lib)) == hashlib.sha256(lib.read_bytes()).digest()
+    # The path is where to load from, not part of the identity.
+    assert compute_callable_hashid(a.descriptor()) == compute_callable_hashid(b.descriptor())
+    assert compute_callable_hashid(a.descriptor()) != compute_callable_hashid(
+        build_native_so_descriptor(a.so_sha256, "topk_rows")
+    )
+    assert a.payload() == str(lib).encode() + b"\x00argmax_rows"
+
+    lib.write_bytes(b"\x7fELF-rebuilt")
+    rebuilt = NativeSubCallable(str(lib), "argmax_rows")
+    assert compute_callable_hashid(rebuilt.descriptor()) != compute_callable_hashid(a.descriptor())
+    with pytest.raises(RuntimeError, match="HASHID_DESCRIPTOR_MISMATCH"):
+        a.verify()
+
+
+@pytest.mark.parametrize("symbol", ["", "has space", "1leading", "ns::fn"])
+def test_native_so_descriptor_rejects_non_c_symbols(symbol):
+    with pytest.raises(ValueError, match="NATIVE_SO symbol"):
+        build_native_so_descriptor(b"\x00" * 32, symbol)
+
+
+def test_worker_register_native_so_targets_local_python(tmp_path):
+    lib = tmp_path / "libpost.so"
+    lib.write_bytes(b"\x7fELF")
+    worker = Worker(level=3, num_sub_workers=0)
+    try:
+        handle = worker.register(NativeSubCallable(str(lib), "argmax_rows"))
+        assert handle.kind == "NATIVE_SO"
+        assert handle.target_namespace == "LOCAL_PYTHON"
+        again = worker.register(NativeSubCallable(str(lib), "argmax_rows"))
+        assert again.digest == handle.digest
+        assert worker._identity_registry[handle.digest].ref_count == 2
+    finally:
+        worker.close()
+
+
+def test_compiled_orchestration_identity_is_distinct_from_native_so(tmp_path):
+    lib = tmp_path / "liborch.so"
+    lib.write_bytes(b"\x7fELF-orch")
+    orch = CompiledOrchestration(str(lib), "build_dag")
+    sub = NativeSubCallable(str(lib), "build_dag")
+    assert orch.so_sha256 == sub.so_sha256
+    # Same bytes and symbol, different kind: the hashids must not collide.
+    assert compute_callable_hashid(orch.descriptor()) != compute_callable_hashid(sub.descriptor())
+    lib.write_bytes(b"\x7fELF-orch-rebuilt")
+    with pytest.raises(RuntimeError, match="HASHID_DESCRIPTOR_MISMATCH"):
+        orch.load()
+
+
+def test_compiled_orchestration_resolves_handles_before_scope(tmp_path):
+    lib = tmp_path / "liborch.so"
+    lib.write_bytes(b"\x7fELF-orch")
+    worker = Worker(level=3, num_sub_workers=0)
+    other = Worker(level=3, num_sub_workers=0)
+    try:
+        foreign = other.register(NativeSubCallable(str(lib), "argmax_rows"))
+        orch = CompiledOrchestration(str(lib), "build_dag", callables=[foreign])
+        worker._compiled_orch_cache[compute_callable_hashid(orch.descriptor())] = object()
+        with pytest.raises(KeyError, match="does not belong to this Worker"):
+            worker._bind_compiled_orchestration(orch)
+    finally:
+        worker.close()
+        other.close()
+
+
+def test_worker_rejects_unknown_sub_mode():
+    with pytest.raises(ValueError, match="sub_mode"):
+        Worker(level=3, num_sub_workers=1, sub_mode="fiber")
+
+
 def test_raw_control_payload_uses_explicit_size():
     payload = b"tests.ut.py.test_callable_identity:_remote_inner_sub_noop"
     shm = SharedMemory(create=True, size=len(payload) + 16)
@@ -0,0 +1,97 @@
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Orchestrator.lifetime_trace(): L3 alloc/submit lifetimes in buffer_planner's input format."""
+
+import pytest
+from simpler.callable_identity import CallableHandle
+from simpler.orchestrator import Orchestrator
+from simpler.task_interface import DataType, TaskArgs, Tensor, TensorArgType
+from simpler_setup.tools.buffer_planner import load_lifetimes, plan_rings
+
+
+class FakeCOrchestrator:
+    def __init__(self):
+        self.next_addr = 0x10000
+
+    def alloc(self, shape, dtype):
+        addr = self.next_addr
+        self.next_addr += 0x10000
+        return Tensor.make(addr, tuple(shape), dtype)
+
+    def submit_sub(self, *args):
+        pass
+
+    def submit_copy(self, *args):
+        pass
+
+    def scope_begin(self):
+        pass
+
+    def scope_end(self):
+        pass
+
+
+def _args(*tensors):
+    a = TaskArgs()
+    for t in tensors:
+        a.add_tensor(t, TensorArgType.INPUT)
+    return a
+
+
+def test_lifetime_trace_records_alloc_def_last_use_and_ring():
+    handle = CallableHandle("sha256:" + "00" * 32, "PYTHON_IMPORT", "LOCAL_PYTHON")
+    orch = Orchestrator(FakeCOrchestrator())  # type: ignore[arg-type]
+
+    with orch.lifetime_trace() as trace:
+        a = orch.alloc((256,), DataType.FLOAT32)
+        orch.submit_sub(handle, _args(a))  # submit 0
+        b = orch.alloc((64,), DataType.FLOAT16)
+        orch.submit_sub(handle, _args(a, b))  # submit 1
+        with orch.scope():
+            c = orch.alloc((16,), DataType.INT8)
+            orch.submit_copy(-1, b, -1, c)  # submit 2
+        orch.submit_sub(handle, _args())  # submit 3
+    orch.alloc((8,), DataType.INT8)  # after the trace: not recorded
+
+    assert trace.to_dict() == {
+        "buffers": [
+            {"name": hex(a.data), "ring": 0, "bytes": 1024, "def": 0, "last_use": 1},
+            {"name": hex(b.data), "ring": 0, "bytes": 128, "def": 1, "last_use": 2},
+            {"name": hex(c.data), "ring": 1, "bytes": 16, "def": 2, "last_use": 2},
+        ]
+    }
+    rings = plan_rings(load_lifetimes(trace.to_dict()))
+    assert [(r["ring"], r["max_live_bytes"]) for r in rings] == [(0, 2048), (1, 1024)]
+
+
+def test_lifetime_trace_attributes_offset_views_to_their_buffer():
+    handle = CallableHandle("sha256:" + "00" * 32, "PYTHON_IMPORT", "LOCAL_PYTHON")
+    orch = Orchestrator(FakeCOrchestrator())  # type: ignore[arg-type]
+
+    with orch.lifetime_trace() as trace:
+        a = orch.alloc((256,), DataType.FLOAT32)  # 1 KiB
+        orch.submit_sub(handle, _args(a))  # submit 0
+        orch.submit_sub(handle, _args())  # submit 1
+        tail = Tensor.make(a.data + 512, (128,), DataType.FLOAT32)
+        orch.submit_sub(handle, _args(tail))  # submit 2: a view into the back half of a
+        past_end = Tensor.make(a.data + 1024, (4,), DataType.FLOAT32)
+        orch.submit_sub(handle, _args(past_end))  # submit 3: just outside a
+
+    [entry] = trace.to_dict()["buffers"]
+    assert entry["def"] == 0
+    assert entry["last_use"] == 2
+
+
+def test_lifetime_trace_is_not_reentrant():
+    orch = Orchestrator(FakeCOrchestrator())  # type: ignore[arg-type]
+    with orch.lifetime_trace():
+        with pytest.raises(RuntimeError, match="already active"):
+            with orch.lifetime_trace():
+                pass
+    assert orch._trace is None
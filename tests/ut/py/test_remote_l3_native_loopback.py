@@ -0,0 +1,320 @@
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Differential loopback: the Python session runner and the native
+``_RemoteL3SessionServer`` answer one scripted frame stream identically.
+
+Addresses and shm names are process-local, so they are masked before the
+replies are compared; error replies compare their ``remote worker_id=...``
+prefix and require the native reason to appear in the Python traceback.
+"""
+
+import ctypes
+import dataclasses
+import hashlib
+import json
+import os
+import socket
+import struct
+import sys
+import threading
+import types
+from multiprocessing import shared_memory
+
+from _task_interface import ChipCallable, _RemoteL3SessionServer  # pyright: ignore[reportMissingImports]
+from simpler import remote_l3_session
+from simpler.callable_identity import build_chip_callable_descriptor, compute_callable_hashid, hashid_to_digest
+from simpler.remote_l3_protocol import (
+    CONTROL_ERROR_BLOB_NOT_HELD,
+    HELLO_FEATURE_HELD_CHIP_BLOB,
+    REMOTE_BUFFER_ACCESS_READ_WRITE,
+    CallableKind,
+    ChipCallableBlobLocation,
+    ControlName,
+    ExportBufferResult,
+    FrameHeader,
+    FrameType,
+    RemoteAddressSpace,
+    RemoteChipCallablePayload,
+    RemoteRegistryTarget,
+    decode_export_buffer_result,
+    decode_import_buffer_result,
+    encode_digest_callable_command,
+    encode_export_buffer_result,
+    encode_frame,
+    encode_register_callable_command,
+    encode_remote_chip_callable_payload,
+    read_frame,
+)
+
+SESSION_ID = 41
+WORKER_ID = 2
+OWNER_ID = 5
+IMPORT_BYTES = 64
+
+
+def _control(sequence, name, command=b""):
+    payload = struct.pack("<III", int(name), 1, len(command)) + command
+    return FrameHeader(FrameType.CONTROL, SESSION_ID, WORKER_ID, sequence), payload
+
+
+def _copy(buffer_id, offset, size, data=b""):
+    return struct.pack("<iQQQQ", WORKER_ID, buffer_id, 1, offset, size) + data
+
+
+def _export(buffer_id, offset, nbytes, profile):
+    data = profile.encode("utf-8")
+    return struct.pack("<iQQQQI", WORKER_ID, buffer_id, 1, offset, nbytes, 3) + struct.pack("<I", len(data)) + data
+
+
+def _import(shm_name, profile):
+    # An export owned by another worker, backed by a shm segment the test created.
+    export = ExportBufferResult(
+        owner_worker_id=OWNER_ID,
+        buffer_id=3,
+        generation=1,
+        address_space=RemoteAddressSpace.REMOTE_WINDOW,
+        offset=0,
+        nbytes=IMPORT_BYTES,
+        export_id=1,
+        remote_addr=0,
+        rkey_or_token=1,
+        ub_ldst_va=0,
+        access_flags=REMOTE_BUFFER_ACCESS_READ_WRITE,
+        transport_profile=profile,
+        transport_descriptor=shm_name.encode("utf-8"),
+    )
+    head = struct.pack("<iI", WORKER_ID, REMOTE_BUFFER_ACCESS_READ_WRITE)
+    return head + encode_export_buffer_result(export) + struct.pack("<I", 0)
+
+
+def _release_import(import_id):
+    return struct.pack("<iiQQQI", WORKER_ID, OWNER_ID, 3, 1, import_id, 0)
+
+
+def _chip_register(blob_location, *, corrupt_sha=False):
+    chip = ChipCallable.build(signature=[], func_name="loopback", binary=b"\x01", children=[])
+    blob = ctypes.string_at(int(chip.buffer_ptr()), int(chip.buffer_size()))
+    descriptor = build_chip_callable_descriptor(target=chip)
+    digest = hashid_to_digest(compute_callable_hashid(descriptor))
+    sha = hashlib.sha256(blob + (b"x" if corrupt_sha else b"")).digest()
+    inline = blob if blob_location == ChipCallableBlobLocation.INLINE_BLOB else b""
+    payload = encode_remote_chip_callable_payload(
+        RemoteChipCallablePayload(descriptor, blob_location, len(blob), sha, inline, b"")
+    )
+    command = encode_register_callable_command(
+        RemoteRegistryTarget.INNER_L3_WORKER, CallableKind.CHIP_CALLABLE, digest, 1, payload
+    )
+    return digest, command
+
+
+def _chip_digest_command(digest):
+    return encode_digest_callable_command(RemoteRegistryTarget.INNER_L3_WORKER, CallableKind.CHIP_CALLABLE, digest)
+
+
+def _task(sequence, digest):
+    # Empty CallConfig (7 x int32 + empty output_prefix) and empty RemoteTaskArgs.
+    payload = digest + struct.pack("<7iI", 0, 0, 0, 0, 0, 0, 0, 0) + struct.pack("<III", 0, 0, 0)
+    return FrameHeader(FrameType.TASK, SESSION_ID, WORKER_ID, sequence), payload
+
+
+def _script(shm_name):
+    digest = bytes([0x11]) * 32
+    chip_digest, chip_inline = _chip_register(ChipCallableBlobLocation.INLINE_BLOB)
+    _, chip_held = _chip_register(ChipCallableBlobLocation.HELD_BLOB)
+    _, chip_bad_sha = _chip_register(ChipCallableBlobLocation.INLINE_BLOB, corrupt_sha=True)
+    return [
+        _control(1, ControlName.ALLOC_REMOTE_BUFFER, struct.pack("<Q", 64)),
+        _control(2, ControlName.COPY_TO_REMOTE, _copy(1, 8, 4, b"\x01\x02\x03\x04")),
+        _control(3, ControlName.COPY_FROM_REMOTE, _copy(1, 6, 8)),
+        _control(4, ControlName.COPY_TO_REMOTE, _copy(1, 62, 4, b"\x00" * 4)),
+        _control(5, ControlName.EXPORT_BUFFER, _export(1, 16, 16, "sim")),
+        _control(6, ControlName.EXPORT_BUFFER, _export(1, 0, 8, "hccs")),
+        _control(7, ControlName.COMM_INIT),
+        _control(
+            8,
+            ControlName.PREPARE_CALLABLE,
+            encode_digest_callable_command(
+                RemoteRegistryTarget.REMOTE_TASK_DISPATCHER, CallableKind.PYTHON_IMPORT, digest
+            ),
+        ),
+        _control(9, ControlName.ALLOC_REMOTE_BUFFER, struct.pack("<Q", 0)),
+        _control(10, ControlName.FREE_REMOTE_BUFFER, struct.pack("<iQQ", WORKER_ID, 1, 1)),
+        _control(11, ControlName.FREE_REMOTE_BUFFER, struct.pack("<iQQ", WORKER_ID, 99, 1)),
+        _control(12, ControlName.COPY_FROM_REMOTE, _copy(1, 0, 4)),
+        (FrameHeader(FrameType.HEALTH, SESSION_ID, WORKER_ID, 13), b""),
+        _control(14, ControlName.IMPORT_BUFFER, _import(shm_name, "sim")),
+        _control(15, ControlName.IMPORT_BUFFER, _import(shm_name, "hccs")),
+        _control(16, ControlName.RELEASE_IMPORT, _release_import(1)),
+        _control(17, ControlName.RELEASE_IMPORT, _release_import(1)),
+        # CHIP_CALLABLE registration; neither server has a ChipWorker attached.
+        _control(18, ControlName.PREPARE_REGISTER_CALLABLE, chip_held),
+        _control(19, ControlName.PREPARE_REGISTER_CALLABLE, chip_bad_sha),
+        _control(20, ControlName.PREPARE_REGISTER_CALLABLE, chip_inline),
+        _control(21, ControlName.COMMIT_REGISTER_CALLABLE, _chip_digest_command(chip_digest)),
+        _control(22, ControlName.ABORT_REGISTER_CALLABLE, _chip_digest_command(chip_digest)),
+        _control(23, ControlName.COMMIT_REGISTER_CALLABLE, _chip_digest_command(chip_digest)),
+        _task(24, digest),
+        _task(25, chip_digest),
+    ]
+
+
+def _parse_reply(frame):
+    """(frame_type, sequence, control_name, version, error_code, message, result) with local addresses masked."""
+    header = frame.header
+    if header.frame_type != FrameType.CONTROL_REPLY:
+        seq, code, msg_len = struct.unpack_from("<QiI", frame.payload, 0)
+        return (int(header.frame_type), seq, None, None, code, frame.payload[16 : 16 + msg_len].decode("utf-8"), b"")
+    seq, name, version, code, msg_len = struct.unpack_from("<QIIiI", frame.payload, 0)
+    off = struct.calcsize("<QIIiI")
+    msg = frame.payload[off : off + msg_len].decode("utf-8")
+    off += msg_len
+    (result_len,) = struct.unpack_from("<I", frame.payload, off)
+    result = frame.payload[off + 4 : off + 4 + result_len]
+    if code == 0 and name == ControlName.ALLOC_REMOTE_BUFFER:
+        result = result[:32] + b"\x00" * 8 + result[40:]
+    elif code == 0 and name == ControlName.EXPORT_BUFFER:
+        export = decode_export_buffer_result(result)
+        assert export.transport_descriptor
+        result = dataclasses.replace(export, remote_addr=0, transport_descriptor=b"")
+    elif code == 0 and name == ControlName.IMPORT_BUFFER:
+        imported = decode_import_buffer_result(result)
+        assert imported.transport_profile == "sim"
+        result = dataclasses.replace(imported, remote_addr=0)
+    return (int(header.frame_type), seq, name, version, code, msg, result)
+
+
+def _drive(sock, shm_name):
+    hello = read_frame(sock)
+    replies = []
+    for header, payload in _script(shm_name):
+        sock.sendall(encode_frame(header, payload))
+        replies.append(_parse_reply(read_frame(sock)))
+    sock.sendall(encode_frame(FrameHeader(FrameType.SHUTDOWN, SESSION_ID, WORKER_ID, 99), b""))
+    return hello, replies
+
+
+def _python_replies(shm_name):
+    manifest = {"session_id": SESSION_ID, "worker_id": WORKER_ID, "transport": "sim"}
+    server_sock, client_sock = socket.socketpair()
+    errors = []
+
+    def serve():
+        try:
+            remote_l3_session._run_command_loop(server_sock, manifest, None)  # noqa: SLF001
+        except BaseException as exc:  # noqa: BLE001
+            errors.append(exc)
+
+    thread = threading.Thread(target=serve, daemon=True)
+    thread.start()
+    with client_sock:
+        result = _drive(client_sock, shm_name)
+    thread.join(timeout=5.0)
+    server_sock.close()
+    assert not errors
+    return result
+
+
+def _native_replies(shm_name):
+    server = _RemoteL3SessionServer(None, SESSION_ID, WORKER_ID, accept_timeout_s=5.0)
+    server.listen()
+    errors = []
+
+    def serve():
+        try:
+            server.serve()
+        except BaseException as exc:  # noqa: BLE001
+            errors.append(exc)
+
+    thread = threading.Thread(target=serve, daemon=True)
+    thread.start()
+    with socket.create_connection(("127.0.0.1", server.command_port), timeout=5.0) as client_sock:
+        result = _drive(client_sock, shm_name)
+    thread.join(timeout=5.0)
+    server.stop()
+    assert not errors
+    return result
+
+
+def test_native_and_python_session_servers_reply_identically():
+    exported = shared_memory.SharedMemory(create=True, size=IMPORT_BYTES)
+    try:
+        py_hello, py_replies = _python_replies(exported.name)
+        native_hello, native_replies = _native_replies(exported.name)
+    finally:
+        exported.close()
+        exported.unlink()
+
+    assert native_hello == py_hello
+    # HELLO ends with uint64 feature_flags, uint32 ready_state.
+    feature_flags, _ready = struct.unpack_from("<QI", native_hello.payload, len(native_hello.payload) - 12)
+    assert feature_flags & HELLO_FEATURE_HELD_CHIP_BLOB
+    assert len(native_replies) == len(py_replies)
+    # Sequence 18 is a HELD_BLOB prepare of a digest neither server holds.
+    assert native_replies[17][:2] == (int(FrameType.CONTROL_REPLY), 18)
+    assert native_replies[17][4] == CONTROL_ERROR_BLOB_NOT_HELD
+    for native, py in zip(native_replies, py_replies):
+        assert native[:5] == py[:5]
+        assert native[6] == py[6]
+        native_msg, py_msg = native[5], py[5]
+        if native_msg.startswith("remote worker_id="):
+            # Python appends a traceback; the prefix and the reason must match.
+            native_prefix, native_reason = native_msg.split(": ", 1)
+            assert py_msg.split(": ", 1)[0] == native_prefix
+            assert native_reason in py_msg
+        else:
+            assert native_msg == py_msg
+
+
+def test_native_session_sends_ready_once_when_serve_fails(monkeypatch):
+    class FakeChipWorker:
+        _impl = None
+
+        def init(self, *args):
+            pass
+
+        def finalize(self):
+            pass
+
+    class FailingServer:
+        command_port = 1
+        health_port = 2
+
+        def __init__(self, *args, **kwargs):
+            pass
+
+        def listen(self):
+            pass
+
+        def serve(self):
+            raise RuntimeError("command attach timed out")
+
+        def stop(self):
+            pass
+
+    class FakeRuntimeBuilder:
+        def __init__(self, platform):
+            pass
+
+        def get_binaries(self, runtime):
+            return None
+
+    monkeypatch.setattr(remote_l3_session, "ChipWorker", FakeChipWorker)
+    monkeypatch.setattr(remote_l3_session, "_RemoteL3SessionServer", FailingServer)
+    monkeypatch.setitem(
+        sys.modules, "simpler_setup.runtime_builder", types.SimpleNamespace(RuntimeBuilder=FakeRuntimeBuilder)
+    )
+    read_fd, write_fd = os.pipe()
+    manifest = {"session_id": SESSION_ID, "worker_id": WORKER_ID, "transport": "sim", "platform": "a2a3sim"}
+    manifest["device_ids"] = [0]
+
+    assert remote_l3_session.run_native_session(manifest, write_fd) == 1
+
+    with os.fdopen(read_fd, "rb") as ready:
+        lines = ready.read().splitlines()
+    assert [json.loads(line)["ok"] for line in lines] == [True]
@@ -0,0 +1,108 @@
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Tests for the deps.json + swimlane -> SchedSimGraph flattening in sched_whatif."""
+
+import json
+
+from simpler_setup.tools.sched_whatif import build_sim_inputs
+from simpler_setup.tools.swimlane_converter import deps_from_task_edges, read_perf_data
+
+_RING1 = 1 << 32
+
+
+def _row(task_id, core_id, core_type, start, end, dispatch=0.0):
+    return {
+        "task_id": task_id,
+        "core_id": core_id,
+        "core_type": core_type,
+        "start_time_us": start,
+        "end_time_us": end,
+        "duration_us": end - start,
+        "dispatch_time_us": dispatch,
+        "finish_time_us": end + 0.5 if dispatch else 0.0,
+    }
+
+
+def test_submission_order_edges_and_subtasks():
+    deps = {
+        "tasks": [{"task_id": "0"}, {"task_id": str(_RING1)}, {"task_id": "5"}],
+        "edges": [
+            {"pred": "0", "succ": str(_RING1), "source": "creator"},
+            {"pred": "0", "succ": str(_RING1), "source": "tensormap"},
+            {"pred": str(_RING1), "succ": "5", "source": "tensormap"},
+            {"pred": "5", "succ": "9", "source": "explicit"},
+        ],
+    }
+    perf = {
+        "tasks": [
+            _row(_RING1, 0, "aic", 10.0, 12.0, dispatch=9.0),
+            _row(_RING1, 30, "aiv", 10.0, 11.5, dispatch=9.5),
+            _row(5, 31, "aiv", 13.0, 14.0, dispatch=12.0),
+            _row(7, 32, "aiv", 1.0, 2.0, dispatch=0.5),
+        ],
+        "core_to_thread": [0, 0, 1, -1],
+    }
+
+    inputs = build_sim_inputs(deps, perf)
+
+    # tasks[] order first, then ids seen only in edges / swimlane (sorted).
+    assert inputs["task_ids"] == [0, _RING1, 5, 7, 9]
+    assert inputs["num_tasks"] == 5
+    # Duplicate (pred, succ) pairs collapse.
+    assert sorted(zip(inputs["edge_src"], inputs["edge_dst"])) == [(0, 1), (1, 2), (2, 4)]
+    assert inputs["sub_task"] == [1, 1, 2, 3]
+    assert inputs["sub_core_type"] == [0, 1, 1, 1]
+    assert inputs["sub_duration_ns"] == [2000, 1500, 1000, 1000]
+    assert inputs["aic_cores"] == 1
+    assert inputs["aiv_cores"] == 3
+    assert inputs["threads"] == 2
+    assert inputs["launch_us"] == 0.75
+    # dispatch of the earliest row -> latest finish.
+    assert inputs["measured_makespan_us"] == 14.5 - 0.5
+
+
+def test_empty_inputs():
+    inputs = build_sim_inputs({"tasks": [], "edges": []}, {"tasks": []})
+    assert inputs["num_tasks"] == 0
+    assert inputs["measured_makespan_us"] == 0.0
+    assert inputs["launch_us"] is None
+    assert inputs["threads"] is None
+
+
+def test_wired_task_edges_stand_in_for_deps(tmp_path):
+    # Level-1 swimlane with --enable-l2-edges: read_perf_data surfaces the
+    # edges and deps_from_task_edges turns them into a deps.json-shaped DAG.
+    perf_path = tmp_path / "l2_swimlane_records.json"
+    perf_path.write_text(
+        json.dumps(
+            {
+                "l2_swimlane_level": 1,
+                "metadata": {"clock_freq_hz": 1_000_000, "num_cores": 2, "core_types": ["aic", "aiv"]},
+                "aicore_tasks": [[0, _RING1, 0, 10, 12], [1, 5, 0, 13, 14]],
+                "aicpu_tasks": [],
+                "task_edges": [[_RING1, 5], [0, _RING1]],
+            }
+        )
+    )
+    perf = read_perf_data(perf_path)
+    assert perf["task_edges"] == [(_RING1, 5), (0, _RING1)]
+
+    deps = deps_from_task_edges(perf)
+    assert deps["tasks"] == []
+    assert {e["source"] for e in deps["edges"]} == {"wired"}
+
+    inputs = build_sim_inputs(deps, perf)
+    # No tasks[]: task-id order.
+    assert inputs["task_ids"] == [0, 5, _RING1]
+    assert sorted(zip(inputs["edge_src"], inputs["edge_dst"])) == [(0, 2), (2, 1)]
+
+
+def test_no_task_edges_means_no_wired_deps():
+    assert deps_from_task_edges({"tasks": []}) is None
+    assert deps_from_task_edges({"tasks": [], "task_edges": []}) == {"tasks": [], "edges": []}
@@ -185,3 +185,46 @@ class TestShlexJoinSafety:
         flags_arg = next(a for a in args if a.startswith("-DCMAKE_C_FLAGS="))
         # shlex.join must re-quote the path so CMake re-parses it as one token.
         assert "'/opt/my compilers/compat'" in flags_arg
+
+
+class TestGxx15ToolchainSimProfile:
+    """The "fast" sim profile swaps in host-native SIMD codegen for sim kernels
+    but must keep fp results identical to "default" (no FMA contraction, no
+    fast-math), and must not change the default build at all."""
+
+    @pytest.fixture
+    def toolchain(self):
+        from simpler_setup.toolchain import Gxx15Toolchain  # noqa: PLC0415
+
+        return Gxx15Toolchain()
+
+    def test_default_profile_unchanged(self, toolchain):
+        flags = toolchain.get_compile_flags(core_type="aiv")
+        assert "-O2" in flags
+        # GCC's default -ffp-contract=fast would fuse to FMA on aarch64.
+        assert "-ffp-contract=off" in flags
+        assert not any(f.startswith("-march=") for f in flags)
+        assert "-DSIMPLER_SIM_FAST=1" not in flags
+        assert "-D__DAV_VEC__" in flags
+
+    def test_fast_profile_flags(self, toolchain, monkeypatch):
+        monkeypatch.delenv("SIMPLER_SIM_MARCH", raising=False)
+        flags = toolchain.get_compile_flags(core_type="aic", profile="fast")
+        assert "-O3" in flags and "-O2" not in flags
+        assert "-march=native" in flags
+        assert "-ffp-contract=off" in flags
+        assert "-D__DAV_CUBE__" in flags
+        assert not any("fast-math" in f for f in flags)
+        # -fopenmp-simd lets `omp simd reduction` reorder fp sums; -fopenmp
+        # would also spin an OpenMP pool inside every simulated core thread.
+        assert not any(f.startswith("-fopenmp") for f in flags)
+
+    def test_fast_profile_march_override(self, toolchain, monkeypatch):
+        monkeypatch.setenv("SIMPLER_SIM_MARCH", "x86-64-v3")
+        assert "-march=x86-64-v3" in toolchain.get_compile_flags(profile="fast")
+        monkeypatch.setenv("SIMPLER_SIM_MARCH", "")
+        assert not any(f.startswith("-march=") for f in toolchain.get_compile_flags(profile="fast"))
+
+    def test_unknown_profile_rejected(self, toolchain):
+        with pytest.raises(ValueError, match="Unknown sim profile"):
+            toolchain.get_compile_flags(profile="turbo")
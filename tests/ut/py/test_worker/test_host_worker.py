@@ -1183,8 +1183,8 @@ class TestLifecycle:
         calls = []
 
         class FakeWorker:
-            def broadcast_register_all(self, blob_ptr, blob_size, digest):
-                calls.append(("binary_register", blob_size, digest))
+            def broadcast_register_all(self, blob_ptr, blob_size, digest, probe_held=False):
+                calls.append(("binary_register", blob_size, digest, probe_held))
                 return [_FakeControlResult("NEXT_LEVEL", 0, True)]
 
         hw = Worker(level=3, num_sub_workers=1)
@@ -1200,9 +1200,10 @@ class TestLifecycle:
         assert slot == 0
         assert _slot_for(hw, second) == slot
         assert hw._identity_registry[first.digest].ref_count == 2
+        # The repeat register asks children digest-only before staging the blob.
         assert calls == [
-            ("binary_register", int(callable_obj.buffer_size()), first.digest),
-            ("binary_register", int(callable_obj.buffer_size()), second.digest),
+            ("binary_register", int(callable_obj.buffer_size()), first.digest, False),
+            ("binary_register", int(callable_obj.buffer_size()), second.digest, True),
         ]
 
     def test_duplicate_chip_prepare_partial_failure_preserves_existing_handle(self):
@@ -1212,7 +1213,7 @@ class TestLifecycle:
             def __init__(self):
                 self.register_count = 0
 
-            def broadcast_register_all(self, blob_ptr, blob_size, digest):
+            def broadcast_register_all(self, blob_ptr, blob_size, digest, probe_held=False):
                 self.register_count += 1
                 calls.append(("binary_register", self.register_count, digest))
                 if self.register_count == 1:
@@ -1247,7 +1248,7 @@ class TestLifecycle:
         calls = []
 
         class FakeWorker:
-            def broadcast_register_all(self, blob_ptr, blob_size, digest):
+            def broadcast_register_all(self, blob_ptr, blob_size, digest, probe_held=False):
                 calls.append(("binary_register", digest))
                 raise RuntimeError("register failed")
 
@@ -1999,6 +2000,55 @@ class TestChipMainLoopDigestRegister:
             payload_shm.close()
             payload_shm.unlink()
 
+    def test_digest_only_register_reuses_held_blob(self):
+        from unittest.mock import MagicMock  # noqa: PLC0415
+
+        from simpler.worker import _CTRL_OFF_RESULT, _CTRL_REGISTER_HELD  # noqa: PLC0415
+
+        cw = MagicMock()
+        cw._impl = MagicMock()
+        cw._unregister_slot = MagicMock()
+        cw._impl.prepare_callable_from_blob = MagicMock()
+
+        callable_obj = _unique_chip_callable(7)
+        digest = _chip_digest(callable_obj)
+        payload_shm = _chip_payload_shm(callable_obj)
+        identity_refs: dict[bytes, int] = {}
+        shm, buf, state_addr = self._build_mailbox()
+        try:
+            t = self._spawn_loop(cw, buf, state_addr, identity_refs=identity_refs)
+            try:
+                # Not held yet: success with result 0 asks for the blob.
+                struct.pack_into("Q", buf, _CTRL_OFF_RESULT, 0)
+                self._send_ctrl_register(buf, state_addr, shm_name="", payload_size=0, digest=digest)
+                assert self._wait_for_done_and_reset(buf, state_addr) == 0
+                assert struct.unpack_from("Q", buf, _CTRL_OFF_RESULT)[0] == 0
+                assert digest not in identity_refs
+
+                self._send_ctrl_register(
+                    buf,
+                    state_addr,
+                    shm_name=payload_shm.name,
+                    payload_size=int(callable_obj.buffer_size()),
+                    digest=digest,
+                )
+                assert self._wait_for_done_and_reset(buf, state_addr) == 0
+
+                struct.pack_into("Q", buf, _CTRL_OFF_RESULT, 0)
+                self._send_ctrl_register(buf, state_addr, shm_name="", payload_size=0, digest=digest)
+                assert self._wait_for_done_and_reset(buf, state_addr) == 0
+                assert struct.unpack_from("Q", buf, _CTRL_OFF_RESULT)[0] == _CTRL_REGISTER_HELD
+                assert identity_refs[digest] == 2
+                assert cw._impl.prepare_callable_from_blob.call_count == 1
+            finally:
+                self._shutdown(state_addr)
+                t.join(timeout=2.0)
+        finally:
+            shm.close()
+            shm.unlink()
+            payload_shm.close()
+            payload_shm.unlink()
+
     def test_unregister_removes_only_after_last_digest_ref(self):
         from unittest.mock import MagicMock  # noqa: PLC0415
 